@@ -203,9 +203,21 @@ public:
     // Storage is allocated by <src>DefaultAllocator<T></src>.
     Array(const IPosition &shape, const T &initialValue);
 
+    // Create an array of the given shape, where storage is allocated by
+    // the given allocator (e.g. <src>ArenaAllocator<T>::value</src>).
+    // The initPolicy parameter has the same meaning as above.
+    Array(const IPosition &shape, ArrayInitPolicy initPolicy,
+          AbstractAllocator<T> const &allocator);
+
     // After construction, this and other reference the same storage.
     Array(const Array<T> &other);
 
+    // Move constructor. After construction, this array has the shape and
+    // storage of <src>other</src>, while <src>other</src> is left empty
+    // (all axes have length zero, but the dimensionality is kept).
+    // No reference count is incremented and no data are copied.
+    Array(Array<T>&& other);
+
     // Create an Array of a given shape from a pointer.
     // If <src>policy</src> is <src>COPY</src>, storage of a new copy is allocated by <src>DefaultAllocator<T></src>.
     // If <src>policy</src> is <src>TAKE_OVER</src>, <src>storage</src> will be destructed and released by <src>NewDelAllocator<T></src>.
@@ -298,6 +310,13 @@ public:
     // non-conforming array.
     virtual Array<T> &operator=(const Array<T> &other);
 
+    // Move assignment. It behaves the same as the copy assignment above,
+    // but if this array is empty and <src>other</src> is the only owner of
+    // its storage, the storage is taken over instead of copied.
+    // After the assignment <src>other</src> is empty (all axes have length
+    // zero, but the dimensionality is kept).
+    Array<T> &operator=(Array<T>&& other);
+
     // Set every element of this array to "value". In other words, a scalar
     // behaves as if it were a constant conformant array.
     Array<T> &operator=(const T &value);
@@ -890,6 +909,18 @@ protected:
     static ArrayInitPolicy defaultArrayInitPolicy() {
         return Block<T>::init_anyway() ? ArrayInitPolicies::INIT : ArrayInitPolicies::NO_INIT;
     }
+    // Take over the storage of <src>other</src> if this array is empty and
+    // <src>other</src> is the only owner of its storage (thus no other
+    // array references it and it was not created with SHARE).
+    // It returns False if not possible; then nothing has been done.
+    // It is the implementation of the move assignment.
+    Bool moveStorage (Array<T>& other);
+
+    // Make the array empty, keeping its dimensionality. It is used to
+    // leave a moved-from array in a valid state. All empty arrays share
+    // the same empty storage block, so no memory is allocated.
+    void makeEmpty();
+
     // pre/post processing hook of takeStorage() for subclasses.
     virtual void preTakeStorage(const IPosition &) {}
     virtual void postTakeStorage() {}
@@ -936,6 +967,7 @@ protected:
   extern template class Array<Int>;
   extern template class Array<uInt>;
   extern template class Array<Int64>;
+  extern template class Array<uInt64>;
   extern template class Array<Float>;
   extern template class Array<Double>;
   extern template class Array<Complex>;
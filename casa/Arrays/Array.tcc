@@ -97,6 +97,17 @@ Array<T>::Array(const IPosition &Shape, ArrayInitPolicy initPolicy,
     DebugAssert(ok(), ArrayError);
 }
 
+template<class T>
+Array<T>::Array(const IPosition &Shape, ArrayInitPolicy initPolicy,
+                AbstractAllocator<T> const &allocator)
+: ArrayBase(Shape)
+{
+    data_p = new Block<T>(nelements(), initPolicy, allocator.getAllocator());
+    begin_p = data_p->storage();
+    setEndIter();
+    DebugAssert(ok(), ArrayError);
+}
+
 // <thrown>
 //   <item> ArrayShapeError
 // </thrown>
@@ -120,6 +131,16 @@ template<class T> Array<T>::Array(const Array<T> &other)
     DebugAssert(ok(), ArrayError);
 }
 
+template<class T> Array<T>::Array(Array<T>&& other)
+: ArrayBase (other),
+  begin_p   (other.begin_p),
+  end_p     (other.end_p)
+{
+    data_p.swap (other.data_p);
+    other.makeEmpty();
+    DebugAssert(ok(), ArrayError);
+}
+
 template<class T>
 Array<T>::Array(const IPosition &shape, T *storage, 
 		StorageInitPolicy policy)
@@ -375,6 +396,50 @@ template<class T> Array<T> &Array<T>::operator=(const Array<T> &other)
     return *this;
 }
 
+template<class T> Array<T> &Array<T>::operator=(Array<T>&& other)
+{
+    DebugAssert(ok(), ArrayError);
+    if (this != &other) {
+        if (! moveStorage (other)) {
+            // Copy the values; this can also be a derived class (e.g. Vector).
+            operator= (static_cast<const Array<T>&>(other));
+        }
+        other.makeEmpty();
+    }
+    return *this;
+}
+
+template<class T> Bool Array<T>::moveStorage (Array<T>& other)
+{
+    // The storage can only be taken over if this array is empty (so no
+    // values have to be copied into existing storage) and if nobody else
+    // uses the storage of other. A derived class cannot change its
+    // dimensionality, so only take over if it matches.
+    if (nelements() != 0  ||  other.data_p.nrefs() != 1  ||
+        !other.data_p->destroyPointer  ||
+        (ndim() != other.ndim()  &&  ndim() != 0)) {
+        return False;
+    }
+    data_p.swap (other.data_p);
+    begin_p = other.begin_p;
+    end_p   = other.end_p;
+    baseCopy (other);
+    // Let a derived class update its indexing constants.
+    postTakeStorage();
+    return True;
+}
+
+template<class T> void Array<T>::makeEmpty()
+{
+    // An empty Block is shared by all empty arrays to avoid an allocation.
+    static CountedPtr<Block<T> > emptyBlock (new Block<T>(0));
+    data_p  = emptyBlock;
+    begin_p = data_p->storage();
+    end_p   = 0;
+    baseMakeEmpty();
+    postTakeStorage();
+}
+
 template<class T> Array<T> &Array<T>::operator=(const T &val)
 {
     DebugAssert(ok(), ArrayError);
@@ -588,6 +588,16 @@ void ArrayBase::baseMakeSteps()
   }
 }
 
+void ArrayBase::baseMakeEmpty()
+{
+  nels_p           = 0;
+  contiguous_p     = True;
+  length_p         = 0;
+  originalLength_p = 0;
+  inc_p            = 1;
+  baseMakeSteps();
+}
+
 IPosition ArrayBase::endPosition() const
 {
   DebugAssert(ok(), ArrayError);
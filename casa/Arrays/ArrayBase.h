@@ -242,6 +242,11 @@ protected:
   // Make the indexing step sizes.
   void baseMakeSteps();
 
+  // Make the array empty by setting all axes to length zero.
+  // The dimensionality is kept, so a moved-from Vector or Matrix
+  // keeps its number of axes.
+  void baseMakeEmpty();
+
   // Throw expection if vector dimensionality is incorrect.
   void throwNdimVector();
 
@@ -0,0 +1,457 @@
+//# ArrayExpr.h: Lazily evaluated element-wise array expressions
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_ARRAYEXPR_H
+#define CASA_ARRAYEXPR_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/BasicMath/Functors.h>
+//# Needed to get the proper Complex typedef's
+#include <casacore/casa/BasicSL/Complex.h>
+#include <functional>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Lazily evaluated element-wise array expressions
+// </summary>
+//
+// <use visibility=export>
+//
+// <reviewed reviewer="" date="" tests="tArrayExpr">
+//
+// <prerequisite>
+//   <li> <linkto class=Array>Array</linkto>
+//   <li> <linkto group="ArrayMath.h#Array mathematical operations">ArrayMath</linkto>
+// </prerequisite>
+//
+// <etymology>
+// ArrayExpr is an expression of Arrays.
+// </etymology>
+//
+// <synopsis>
+// The operators and functions in ArrayMath evaluate eagerly; each of them
+// creates a temporary Array for its result. An expression like
+// <src>a*b + c*d - e</src> therefore makes four passes over the data and
+// allocates four temporary arrays.
+// <br>The classes in this file form a small expression template layer on
+// top of ArrayMath. The operators and functions in it do not evaluate
+// anything, but build a lightweight expression object. The whole expression
+// is evaluated in a single loop over the elements when it is assigned to
+// an Array (by the conversion operator or function <src>evaluate</src>),
+// or when reduced by the function <src>sum</src>. No temporary arrays
+// are created.
+// <br>An expression is started by wrapping an Array in function
+// <src>arrayExpr</src>. Thereafter the usual arithmetic operators and
+// mathematical functions can be used with other expressions, Arrays and
+// scalars. Note that each product of two plain Arrays is evaluated by
+// ArrayMath before it takes part in the expression, so in
+// <src>arrayExpr(a)*b + c*d</src> the product <src>c*d</src> is evaluated
+// eagerly. Write <src>arrayExpr(a)*b + arrayExpr(c)*d</src> to fuse it.
+// <br>The operands of an expression are kept as references to the Array
+// data, so an expression is cheap to copy. An operand that is not
+// contiguous in memory (e.g. a slice) is copied once into a contiguous
+// array, so the evaluation loop itself always uses plain indexing.
+// If the result array overlaps with one of the operands (other than being
+// the very same array), the expression is first evaluated into a temporary
+// array to preserve the semantics of ArrayMath.
+// <br>The element-wise operations use the same functors as ArrayMath, so the
+// results are the same as the corresponding ArrayMath expression.
+// <br>The shapes of the operands are checked when building the expression;
+// an ArrayConformanceError is thrown if they mismatch.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   Vector<Double> a(n), b(n), c(n), d(n), e(n);
+//   ...
+//   // Evaluate in a single loop into a new array.
+//   Array<Double> res = arrayExpr(a)*b + arrayExpr(c)*d - e;
+//   // Evaluate in place into an existing vector.
+//   (arrayExpr(a)*b + sin(arrayExpr(c))).evaluate (e);
+//   // Accumulate into an existing array.
+//   res += arrayExpr(a) * 2.;
+//   // Reduce without creating a temporary.
+//   Double norm = sum (square (arrayExpr(a) - b));
+//   Vector<Complex> vis(n);
+//   Array<Float> amp = amplitude (arrayExpr(vis) * conj(arrayExpr(vis)));
+// </srcblock>
+// </example>
+//
+// <motivation>
+// Array expressions in calibration and imaging code are memory bandwidth
+// bound. Evaluating them in a single pass avoids the temporaries.
+// </motivation>
+//
+// <templating arg=T>
+//  <li> T must be a type for which the used operators and functions
+//       are defined.
+// </templating>
+
+
+// <summary>
+// Base class of all array expression classes.
+// </summary>
+// <synopsis>
+// This class uses the curiously recurring template pattern; E is the
+// type of the actual expression class and T the type of its elements.
+// It offers the functions to evaluate an expression. The actual expression
+// class must have the functions:
+// <ul>
+//  <li> <src>T operator[] (size_t i) const</src> returning element
+//       <src>i</src> of the expression.
+//  <li> <src>const IPosition& shape() const</src> returning the shape.
+//  <li> <src>Bool aliases (const char* start, const char* end,
+//       Bool exactOK) const</src> telling if an operand overlaps
+//       with the given memory range, where an operand starting and ending
+//       at the same address as the range is fine if <src>exactOK</src>.
+// </ul>
+// and enum value <src>isScalar</src>.
+// </synopsis>
+template<typename E, typename T>
+class ArrayExprBase
+{
+public:
+  typedef T value_type;
+
+  // Get the actual expression object.
+  const E& expr() const
+    { return static_cast<const E&>(*this); }
+
+  // Get the shape of the expression.
+  const IPosition& exprShape() const
+    { return expr().shape(); }
+
+  // Evaluate the expression into a new Array.
+  operator Array<T>() const;
+
+  // Evaluate the expression into the given Array. If the array is empty,
+  // it is resized to the shape of the expression. Otherwise its shape
+  // must conform, else an ArrayConformanceError is thrown.
+  // The array does not need to be contiguous.
+  void evaluate (Array<T>& result) const;
+
+protected:
+  ArrayExprBase()
+    {}
+};
+
+
+// <summary>
+// Array operand of an array expression.
+// </summary>
+template<typename T>
+class ArrayExprArray : public ArrayExprBase<ArrayExprArray<T>, T>
+{
+public:
+  enum {isScalar = 0};
+
+  // The array is referenced if contiguous, otherwise copied.
+  explicit ArrayExprArray (const Array<T>& arr)
+    : itsArray (arr.contiguousStorage()  ?  arr : arr.copy()),
+      itsData  (itsArray.data())
+    {}
+
+  T operator[] (size_t i) const
+    { return itsData[i]; }
+
+  const IPosition& shape() const
+    { return itsArray.shape(); }
+
+  Bool aliases (const char* start, const char* end, Bool exactOK) const
+  {
+    const char* dstart = reinterpret_cast<const char*>(itsData);
+    const char* dend   = reinterpret_cast<const char*>
+                                   (itsData + itsArray.nelements());
+    if (dend <= start  ||  dstart >= end) {
+      return False;
+    }
+    return !(exactOK  &&  dstart == start  &&  dend == end);
+  }
+
+private:
+  Array<T> itsArray;
+  const T* itsData;
+};
+
+
+// <summary>
+// Scalar operand of an array expression.
+// </summary>
+template<typename T>
+class ArrayExprScalar : public ArrayExprBase<ArrayExprScalar<T>, T>
+{
+public:
+  enum {isScalar = 1};
+
+  explicit ArrayExprScalar (const T& value)
+    : itsValue (value)
+    {}
+
+  T operator[] (size_t) const
+    { return itsValue; }
+
+  // A scalar has no shape.
+  const IPosition& shape() const
+    { return itsShape; }
+
+  Bool aliases (const char*, const char*, Bool) const
+    { return False; }
+
+private:
+  T         itsValue;
+  IPosition itsShape;
+};
+
+
+// <summary>
+// Array expression applying a unary functor.
+// </summary>
+template<typename E, typename OP>
+class ArrayExprUnary
+  : public ArrayExprBase<ArrayExprUnary<E,OP>, typename OP::result_type>
+{
+public:
+  enum {isScalar = E::isScalar};
+  typedef typename OP::result_type value_type;
+
+  explicit ArrayExprUnary (const E& operand, OP op = OP())
+    : itsOperand (operand),
+      itsOp      (op)
+    {}
+
+  value_type operator[] (size_t i) const
+    { return itsOp (itsOperand[i]); }
+
+  const IPosition& shape() const
+    { return itsOperand.shape(); }
+
+  Bool aliases (const char* start, const char* end, Bool exactOK) const
+    { return itsOperand.aliases (start, end, exactOK); }
+
+private:
+  E  itsOperand;
+  OP itsOp;
+};
+
+
+// <summary>
+// Array expression applying a binary functor.
+// </summary>
+// <synopsis>
+// At most one of the operands can be a scalar.
+// The ctor checks if the shapes of the array operands conform.
+// </synopsis>
+template<typename L, typename R, typename OP>
+class ArrayExprBinary
+  : public ArrayExprBase<ArrayExprBinary<L,R,OP>, typename OP::result_type>
+{
+public:
+  enum {isScalar = 0};
+  typedef typename OP::result_type value_type;
+
+  ArrayExprBinary (const L& left, const R& right, OP op = OP())
+    : itsLeft  (left),
+      itsRight (right),
+      itsOp    (op)
+  {
+    if (!L::isScalar  &&  !R::isScalar  &&
+        !itsLeft.shape().isEqual (itsRight.shape())) {
+      throwArrayShapes (itsLeft.shape(), itsRight.shape(), "ArrayExpr");
+    }
+  }
+
+  value_type operator[] (size_t i) const
+    { return itsOp (itsLeft[i], itsRight[i]); }
+
+  const IPosition& shape() const
+    { return L::isScalar  ?  itsRight.shape() : itsLeft.shape(); }
+
+  Bool aliases (const char* start, const char* end, Bool exactOK) const
+  {
+    return itsLeft.aliases (start, end, exactOK)  ||
+           itsRight.aliases (start, end, exactOK);
+  }
+
+private:
+  L  itsLeft;
+  R  itsRight;
+  OP itsOp;
+};
+
+
+// <summary>
+// Functions and operators to build and evaluate array expressions.
+// </summary>
+// <group name="Array expressions">
+
+// Start an array expression from an Array.
+template<typename T>
+inline ArrayExprArray<T> arrayExpr (const Array<T>& arr)
+  { return ArrayExprArray<T> (arr); }
+
+// Sum all elements of an array expression without creating a temporary.
+template<typename E, typename T>
+T sum (const ArrayExprBase<E,T>& expr);
+
+// Element-wise accumulation of an array expression into an array.
+// The array must conform the expression.
+// <group>
+template<typename E, typename T>
+Array<T>& operator+= (Array<T>& left, const ArrayExprBase<E,T>& right);
+template<typename E, typename T>
+Array<T>& operator-= (Array<T>& left, const ArrayExprBase<E,T>& right);
+template<typename E, typename T>
+Array<T>& operator*= (Array<T>& left, const ArrayExprBase<E,T>& right);
+template<typename E, typename T>
+Array<T>& operator/= (Array<T>& left, const ArrayExprBase<E,T>& right);
+// </group>
+
+// Unary minus.
+template<typename E, typename T>
+inline ArrayExprUnary<E, std::negate<T> >
+operator- (const ArrayExprBase<E,T>& expr)
+  { return ArrayExprUnary<E, std::negate<T> > (expr.expr()); }
+
+// Define the versions of a binary operator or function taking two
+// expressions, an expression and an Array or scalar, or an Array or
+// scalar and an expression.
+#define CASA_ARRAYEXPR_BINARY(NAME, FUNCTOR) \
+template<typename L, typename R, typename T> \
+inline ArrayExprBinary<L, R, FUNCTOR > \
+NAME (const ArrayExprBase<L,T>& left, const ArrayExprBase<R,T>& right) \
+  { return ArrayExprBinary<L, R, FUNCTOR > (left.expr(), right.expr()); } \
+template<typename L, typename T> \
+inline ArrayExprBinary<L, ArrayExprArray<T>, FUNCTOR > \
+NAME (const ArrayExprBase<L,T>& left, const Array<T>& right) \
+  { return ArrayExprBinary<L, ArrayExprArray<T>, FUNCTOR > \
+      (left.expr(), ArrayExprArray<T>(right)); } \
+template<typename R, typename T> \
+inline ArrayExprBinary<ArrayExprArray<T>, R, FUNCTOR > \
+NAME (const Array<T>& left, const ArrayExprBase<R,T>& right) \
+  { return ArrayExprBinary<ArrayExprArray<T>, R, FUNCTOR > \
+      (ArrayExprArray<T>(left), right.expr()); } \
+template<typename L, typename T> \
+inline ArrayExprBinary<L, ArrayExprScalar<T>, FUNCTOR > \
+NAME (const ArrayExprBase<L,T>& left, \
+      const typename ArrayExprBase<L,T>::value_type& right) \
+  { return ArrayExprBinary<L, ArrayExprScalar<T>, FUNCTOR > \
+      (left.expr(), ArrayExprScalar<T>(right)); } \
+template<typename R, typename T> \
+inline ArrayExprBinary<ArrayExprScalar<T>, R, FUNCTOR > \
+NAME (const typename ArrayExprBase<R,T>::value_type& left, \
+      const ArrayExprBase<R,T>& right) \
+  { return ArrayExprBinary<ArrayExprScalar<T>, R, FUNCTOR > \
+      (ArrayExprScalar<T>(left), right.expr()); }
+
+// Define a unary function on an expression.
+#define CASA_ARRAYEXPR_UNARY(NAME, FUNCTOR) \
+template<typename E, typename T> \
+inline ArrayExprUnary<E, FUNCTOR > \
+NAME (const ArrayExprBase<E,T>& expr) \
+  { return ArrayExprUnary<E, FUNCTOR > (expr.expr()); }
+
+// Element-wise arithmetic operators.
+// <group>
+CASA_ARRAYEXPR_BINARY (operator+, std::plus<T>)
+CASA_ARRAYEXPR_BINARY (operator-, std::minus<T>)
+CASA_ARRAYEXPR_BINARY (operator*, std::multiplies<T>)
+CASA_ARRAYEXPR_BINARY (operator/, std::divides<T>)
+// </group>
+
+// Element-wise binary mathematical functions.
+// <group>
+CASA_ARRAYEXPR_BINARY (pow,   casacore::Pow<T>)
+CASA_ARRAYEXPR_BINARY (atan2, casacore::Atan2<T>)
+CASA_ARRAYEXPR_BINARY (fmod,  casacore::Fmod<T>)
+CASA_ARRAYEXPR_BINARY (min,   casacore::Min<T>)
+CASA_ARRAYEXPR_BINARY (max,   casacore::Max<T>)
+// </group>
+
+// Element-wise unary mathematical functions.
+// <group>
+CASA_ARRAYEXPR_UNARY (sin,    casacore::Sin<T>)
+CASA_ARRAYEXPR_UNARY (sinh,   casacore::Sinh<T>)
+CASA_ARRAYEXPR_UNARY (asin,   casacore::Asin<T>)
+CASA_ARRAYEXPR_UNARY (cos,    casacore::Cos<T>)
+CASA_ARRAYEXPR_UNARY (cosh,   casacore::Cosh<T>)
+CASA_ARRAYEXPR_UNARY (acos,   casacore::Acos<T>)
+CASA_ARRAYEXPR_UNARY (tan,    casacore::Tan<T>)
+CASA_ARRAYEXPR_UNARY (tanh,   casacore::Tanh<T>)
+CASA_ARRAYEXPR_UNARY (atan,   casacore::Atan<T>)
+CASA_ARRAYEXPR_UNARY (exp,    casacore::Exp<T>)
+CASA_ARRAYEXPR_UNARY (log,    casacore::Log<T>)
+CASA_ARRAYEXPR_UNARY (log10,  casacore::Log10<T>)
+CASA_ARRAYEXPR_UNARY (sqrt,   casacore::Sqrt<T>)
+CASA_ARRAYEXPR_UNARY (square, casacore::Sqr<T>)
+CASA_ARRAYEXPR_UNARY (cube,   casacore::Pow3<T>)
+CASA_ARRAYEXPR_UNARY (abs,    casacore::Abs<T>)
+CASA_ARRAYEXPR_UNARY (floor,  casacore::Floor<T>)
+CASA_ARRAYEXPR_UNARY (ceil,   casacore::Ceil<T>)
+CASA_ARRAYEXPR_UNARY (round,  casacore::Round<T>)
+CASA_ARRAYEXPR_UNARY (sign,   casacore::Sign<T>)
+CASA_ARRAYEXPR_UNARY (conj,   casacore::Conj<T>)
+// </group>
+
+// Functions on a complex expression resulting in a real expression.
+// <group>
+template<typename E, typename T>
+inline ArrayExprUnary<E, casacore::Real<T, typename T::value_type> >
+real (const ArrayExprBase<E,T>& expr)
+  { return ArrayExprUnary<E, casacore::Real<T, typename T::value_type> >
+      (expr.expr()); }
+template<typename E, typename T>
+inline ArrayExprUnary<E, casacore::Imag<T, typename T::value_type> >
+imag (const ArrayExprBase<E,T>& expr)
+  { return ArrayExprUnary<E, casacore::Imag<T, typename T::value_type> >
+      (expr.expr()); }
+template<typename E, typename T>
+inline ArrayExprUnary<E, casacore::CAbs<T, typename T::value_type> >
+amplitude (const ArrayExprBase<E,T>& expr)
+  { return ArrayExprUnary<E, casacore::CAbs<T, typename T::value_type> >
+      (expr.expr()); }
+template<typename E, typename T>
+inline ArrayExprUnary<E, casacore::CArg<T, typename T::value_type> >
+phase (const ArrayExprBase<E,T>& expr)
+  { return ArrayExprUnary<E, casacore::CArg<T, typename T::value_type> >
+      (expr.expr()); }
+// </group>
+
+#undef CASA_ARRAYEXPR_BINARY
+#undef CASA_ARRAYEXPR_UNARY
+
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/casa/Arrays/ArrayExpr.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
@@ -0,0 +1,129 @@
+//# ArrayExpr.tcc: Lazily evaluated element-wise array expressions
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_ARRAYEXPR_TCC
+#define CASA_ARRAYEXPR_TCC
+
+#include <casacore/casa/Arrays/ArrayExpr.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+template<typename E, typename T>
+ArrayExprBase<E,T>::operator Array<T>() const
+{
+  Array<T> result(expr().shape());
+  evaluate (result);
+  return result;
+}
+
+template<typename E, typename T>
+void ArrayExprBase<E,T>::evaluate (Array<T>& result) const
+{
+  const E& ex = expr();
+  const IPosition& shape = ex.shape();
+  if (result.nelements() == 0) {
+    result.resize (shape);
+  } else if (! result.shape().isEqual (shape)) {
+    throwArrayShapes (result.shape(), shape, "ArrayExpr::evaluate");
+  }
+  size_t n = result.nelements();
+  if (n == 0) {
+    return;
+  }
+  // Check if the result overlaps with an operand. An operand being the
+  // same contiguous array as the result is fine, because each element
+  // is read before it is written.
+  Bool contiguous = result.contiguousStorage();
+  const char* start = reinterpret_cast<const char*>(result.data());
+  const char* end   = reinterpret_cast<const char*>
+                                 (&(result(result.endPosition())) + 1);
+  if (ex.aliases (start, end, contiguous)) {
+    Array<T> tmp(shape);
+    T* data = tmp.data();
+    for (size_t i=0; i<n; ++i) {
+      data[i] = ex[i];
+    }
+    result = tmp;
+  } else if (contiguous) {
+    T* data = result.data();
+    for (size_t i=0; i<n; ++i) {
+      data[i] = ex[i];
+    }
+  } else {
+    typename Array<T>::iterator iter = result.begin();
+    for (size_t i=0; i<n; ++i, ++iter) {
+      *iter = ex[i];
+    }
+  }
+}
+
+
+template<typename E, typename T>
+T sum (const ArrayExprBase<E,T>& expr)
+{
+  const E& ex = expr.expr();
+  size_t n = ex.shape().product();
+  T result = T();
+  for (size_t i=0; i<n; ++i) {
+    result += ex[i];
+  }
+  return result;
+}
+
+template<typename E, typename T>
+Array<T>& operator+= (Array<T>& left, const ArrayExprBase<E,T>& right)
+{
+  (arrayExpr(left) + right).evaluate (left);
+  return left;
+}
+
+template<typename E, typename T>
+Array<T>& operator-= (Array<T>& left, const ArrayExprBase<E,T>& right)
+{
+  (arrayExpr(left) - right).evaluate (left);
+  return left;
+}
+
+template<typename E, typename T>
+Array<T>& operator*= (Array<T>& left, const ArrayExprBase<E,T>& right)
+{
+  (arrayExpr(left) * right).evaluate (left);
+  return left;
+}
+
+template<typename E, typename T>
+Array<T>& operator/= (Array<T>& left, const ArrayExprBase<E,T>& right)
+{
+  (arrayExpr(left) / right).evaluate (left);
+  return left;
+}
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
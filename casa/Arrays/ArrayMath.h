@@ -32,6 +32,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicMath/Functors.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArraySIMD.h>
 //# Needed to get the proper Complex typedef's
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -194,8 +195,8 @@ inline void arrayContTransform (const Array<L>& left, const Array<R>& right,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (left.contiguousStorage()  &&  right.contiguousStorage()) {
-    std::transform (left.cbegin(), left.cend(), right.cbegin(),
-                    result.cbegin(), op);
+    simdTransform (left.data(), right.data(), result.data(),
+                   result.nelements(), op);
   } else {
     std::transform (left.begin(), left.end(), right.begin(),
                     result.cbegin(), op);
@@ -210,10 +211,8 @@ inline void arrayContTransform (const Array<L>& left, R right,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (left.contiguousStorage()) {
-    myrtransform (left.cbegin(), left.cend(),
-                 result.cbegin(), right, op);
-    ////    std::transform (left.cbegin(), left.cend(),
-    ////                    result.cbegin(), bind2nd(op, right));
+    simdTransformRight (left.data(), right, result.data(),
+                        result.nelements(), op);
   } else {
     myrtransform (left.begin(), left.end(),
                  result.cbegin(), right, op);
@@ -230,10 +229,8 @@ inline void arrayContTransform (L left, const Array<R>& right,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (right.contiguousStorage()) {
-    myltransform (right.cbegin(), right.cend(),
-                  result.cbegin(), left, op);
-    ////    std::transform (right.cbegin(), right.cend(),
-    ////                    result.cbegin(), bind1st(op, left));
+    simdTransformLeft (left, right.data(), result.data(),
+                       result.nelements(), op);
   } else {
     myltransform (right.begin(), right.end(),
                   result.cbegin(), left, op);
@@ -308,7 +305,8 @@ inline void arrayTransformInPlace (Array<L>& left, const Array<R>& right,
                                    BinaryOperator op)
 {
   if (left.contiguousStorage()  &&  right.contiguousStorage()) {
-    transformInPlace (left.cbegin(), left.cend(), right.cbegin(), op);
+    simdTransform (left.data(), right.data(), left.data(),
+                   left.nelements(), op);
   } else {
     transformInPlace (left.begin(), left.end(), right.begin(), op);
   }
@@ -320,8 +318,8 @@ template<typename L, typename R, typename BinaryOperator>
 inline void arrayTransformInPlace (Array<L>& left, R right, BinaryOperator op)
 {
   if (left.contiguousStorage()) {
-    myiptransform (left.cbegin(), left.cend(), right, op);
-    ////    transformInPlace (left.cbegin(), left.cend(), bind2nd(op, right));
+    simdTransformRight (left.data(), right, left.data(),
+                        left.nelements(), op);
   } else {
     myiptransform (left.begin(), left.end(), right, op);
     ////    transformInPlace (left.begin(), left.end(), bind2nd(op, right));
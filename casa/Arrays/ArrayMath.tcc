@@ -757,22 +757,7 @@ template<class T> void minMax(T &minVal, T &maxVal, const Array<T> &array)
                      "Array has no elements"));	
   }
   if (array.contiguousStorage()) {
-    // minimal scope as some compilers may spill onto stack otherwise
-    T minv = array.data()[0];
-    T maxv = minv;
-    typename Array<T>::const_contiter iterEnd = array.cend();
-    for (typename Array<T>::const_contiter iter = array.cbegin();
-         iter!=iterEnd; ++iter) {
-      if (*iter < minv) {
-        minv = *iter;
-      }
-      // no else allows compiler to use branchless instructions
-      if (*iter > maxv) {
-        maxv = *iter;
-      }
-    }
-    maxVal = maxv;
-    minVal = minv;
+    simdMinMax (minVal, maxVal, array.data(), array.nelements());
   } else {
     T minv = array.data()[0];
     T maxv = minv;
@@ -1070,14 +1055,14 @@ template<class T> Array<T> floormod(const Array<T> &a, const T &b)
 template<class T> T sum(const Array<T> &a)
 {
   return a.contiguousStorage() ?
-    std::accumulate(a.cbegin(), a.cend(), T(), std::plus<T>()) :
+    simdSum (a.data(), a.nelements()) :
     std::accumulate(a.begin(),  a.end(),  T(), std::plus<T>());
 }
 
 template<class T> T sumsqr(const Array<T> &a)
 {
   return a.contiguousStorage() ?
-    std::accumulate(a.cbegin(), a.cend(), T(), casacore::SumSqr<T>()) :
+    simdSumSqr (a.data(), a.nelements()) :
     std::accumulate(a.begin(),  a.end(),  T(), casacore::SumSqr<T>());
 }
 
@@ -1126,7 +1111,7 @@ template<class T> T pvariance(const Array<T> &a, T mean, uInt ddof)
                      " elements"));
   }
   T sum = a.contiguousStorage() ?
-    std::accumulate(a.cbegin(), a.cend(), T(), casacore::SumSqrDiff<T>(mean)) :
+    simdSumSqrDiff (a.data(), a.nelements(), mean) :
     std::accumulate(a.begin(),  a.end(),  T(), casacore::SumSqrDiff<T>(mean));
   return T(sum/(1.0*a.nelements() - ddof));
 }
@@ -1206,7 +1191,7 @@ template<class T> T rms(const Array<T> &a)
 			 "element"));
     }
     T sum = a.contiguousStorage() ?
-      std::accumulate(a.cbegin(), a.cend(), T(), casacore::SumSqr<T>()) :
+      simdSumSqr (a.data(), a.nelements()) :
       std::accumulate(a.begin(),  a.end(),  T(), casacore::SumSqr<T>());
     return T(sqrt(sum/(1.0*a.nelements())));
 }
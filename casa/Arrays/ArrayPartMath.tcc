@@ -75,11 +75,12 @@ template<class T> Array<T> partialSums (const Array<T>& array,
   IPosition pos(ndim, 0);
   while (True) {
     if (cont) {
-      T tmp = *res;
-      for (uInt i=0; i<n0; i++) {
-	tmp += *data++;
-      }
-      *res = tmp;
+      *res += simdSum (data, n0);
+      data += n0;
+    } else if (incr0 == 1) {
+      simdTransform (res, data, res, n0, std::plus<T>());
+      data += n0;
+      res  += n0;
     } else {
       for (uInt i=0; i<n0; i++) {
 	*res += *data++;
@@ -142,12 +143,8 @@ template<class T> Array<T> partialSumSqrs (const Array<T>& array,
   IPosition pos(ndim, 0);
   while (True) {
     if (cont) {
-      T tmp = *res;
-      for (uInt i=0; i<n0; i++) {
-	tmp += *data * *data;
-        data++;
-      }
-      *res = tmp;
+      *res += simdSumSqr (data, n0);
+      data += n0;
     } else {
       for (uInt i=0; i<n0; i++) {
 	*res += *data * *data;
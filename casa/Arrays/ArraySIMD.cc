@@ -0,0 +1,584 @@
+//# ArraySIMD.cc: SIMD kernels for reductions and arithmetic on contiguous data
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/Arrays/ArraySIMD.h>
+#include <atomic>
+#include <cstring>
+
+//# The vectorized kernels use the GCC vector extensions (also supported
+//# by clang). On x86 the kernels for AVX2 and AVX-512 are compiled using
+//# the target attribute, so no special compiler flags are needed.
+#if defined(__GNUC__)
+# define CASA_SIMD_VECTOR 1
+# if defined(__x86_64__)  ||  defined(__i386__)
+#  define CASA_SIMD_X86 1
+# endif
+//# The vector functions are always inlined, so a vector ABI change
+//# between the instruction sets does not matter.
+# if !defined(__clang__)
+#  pragma GCC diagnostic ignored "-Wpsabi"
+# endif
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  // The element-wise operations, applicable to scalars and vectors.
+  struct AddOp { template<typename X> static X apply (const X& l, const X& r)
+                   { return l + r; } };
+  struct SubOp { template<typename X> static X apply (const X& l, const X& r)
+                   { return l - r; } };
+  struct MulOp { template<typename X> static X apply (const X& l, const X& r)
+                   { return l * r; } };
+  struct DivOp { template<typename X> static X apply (const X& l, const X& r)
+                   { return l / r; } };
+
+  // The scalar kernels.
+  // <group>
+  template<typename S>
+  void sumScalar (const S* data, size_t n, S& even, S& odd)
+  {
+    S e = 0;
+    S o = 0;
+    size_t i = 0;
+    for (; i+1<n; i+=2) {
+      e += data[i];
+      o += data[i+1];
+    }
+    if (i < n) {
+      e += data[i];
+    }
+    even = e;
+    odd  = o;
+  }
+
+  template<typename S>
+  S sumSqrScalar (const S* data, size_t n)
+  {
+    S sum = 0;
+    for (size_t i=0; i<n; ++i) {
+      sum += data[i] * data[i];
+    }
+    return sum;
+  }
+
+  template<typename S>
+  S sumSqrDiffScalar (const S* data, size_t n, S base0, S base1)
+  {
+    S sum = 0;
+    for (size_t i=0; i<n; ++i) {
+      S diff = data[i] - (i%2 == 0  ?  base0 : base1);
+      sum += diff * diff;
+    }
+    return sum;
+  }
+
+  template<typename S>
+  void minMaxScalar (const S* data, size_t n, S& minVal, S& maxVal)
+  {
+    S minv = data[0];
+    S maxv = minv;
+    for (size_t i=0; i<n; ++i) {
+      if (data[i] < minv) {
+        minv = data[i];
+      }
+      if (data[i] > maxv) {
+        maxv = data[i];
+      }
+    }
+    minVal = minv;
+    maxVal = maxv;
+  }
+
+  template<typename S, typename OP>
+  void transformScalarOp (const S* left, const S* right, S* result, size_t n)
+  {
+    for (size_t i=0; i<n; ++i) {
+      result[i] = OP::apply (left[i], right[i]);
+    }
+  }
+
+  template<typename S, typename OP>
+  void transformScalarOp (const S* data, S scalar0, S scalar1,
+                          Bool scalarLeft, S* result, size_t n)
+  {
+    for (size_t i=0; i<n; ++i) {
+      S scalar = (i%2 == 0  ?  scalar0 : scalar1);
+      result[i] = scalarLeft ?
+        OP::apply (scalar, data[i]) : OP::apply (data[i], scalar);
+    }
+  }
+  // </group>
+
+#ifdef CASA_SIMD_VECTOR
+
+  // Define a vector of NB bytes of element type S.
+  template<typename S, int NB> struct SIMDVec
+  {
+    typedef S type __attribute__((vector_size(NB)));
+    enum {nelem = NB / sizeof(S)};
+  };
+
+  // The vectorized kernels. They are inlined into the functions for each
+  // instruction set, so the vector operations are compiled for it.
+  // The data do not need to be aligned.
+  // <group>
+#define CASA_SIMD_INLINE inline __attribute__((always_inline))
+
+  template<typename V>
+  CASA_SIMD_INLINE V loadVec (const void* data)
+  {
+    V v;
+    std::memcpy (&v, data, sizeof(V));
+    return v;
+  }
+
+  template<typename V>
+  CASA_SIMD_INLINE void storeVec (void* data, const V& v)
+  {
+    std::memcpy (data, &v, sizeof(V));
+  }
+
+  // Make a vector with alternating values.
+  template<typename S, int NB>
+  CASA_SIMD_INLINE typename SIMDVec<S,NB>::type
+  patternVec (S value0, S value1)
+  {
+    typename SIMDVec<S,NB>::type v;
+    for (int k=0; k<SIMDVec<S,NB>::nelem; ++k) {
+      v[k] = (k%2 == 0  ?  value0 : value1);
+    }
+    return v;
+  }
+
+  template<typename S, int NB>
+  CASA_SIMD_INLINE void sumVec (const S* data, size_t n, S& even, S& odd)
+  {
+    typedef typename SIMDVec<S,NB>::type V;
+    const size_t W = SIMDVec<S,NB>::nelem;
+    // Use 4 accumulators to hide the latency of the additions.
+    V acc0 = V(), acc1 = V(), acc2 = V(), acc3 = V();
+    size_t i = 0;
+    for (; i+4*W<=n; i+=4*W) {
+      acc0 += loadVec<V> (data+i);
+      acc1 += loadVec<V> (data+i+W);
+      acc2 += loadVec<V> (data+i+2*W);
+      acc3 += loadVec<V> (data+i+3*W);
+    }
+    for (; i+W<=n; i+=W) {
+      acc0 += loadVec<V> (data+i);
+    }
+    acc0 += acc1;
+    acc2 += acc3;
+    acc0 += acc2;
+    // W is even, so the parity of a lane is the parity of the index.
+    S e, o;
+    sumScalar (data+i, n-i, e, o);
+    for (size_t k=0; k<W; k+=2) {
+      e += acc0[k];
+      o += acc0[k+1];
+    }
+    even = e;
+    odd  = o;
+  }
+
+  template<typename S, int NB>
+  CASA_SIMD_INLINE S sumSqrVec (const S* data, size_t n)
+  {
+    typedef typename SIMDVec<S,NB>::type V;
+    const size_t W = SIMDVec<S,NB>::nelem;
+    V acc0 = V(), acc1 = V();
+    size_t i = 0;
+    for (; i+2*W<=n; i+=2*W) {
+      V v0 = loadVec<V> (data+i);
+      V v1 = loadVec<V> (data+i+W);
+      acc0 += v0*v0;
+      acc1 += v1*v1;
+    }
+    for (; i+W<=n; i+=W) {
+      V v0 = loadVec<V> (data+i);
+      acc0 += v0*v0;
+    }
+    acc0 += acc1;
+    S sum = sumSqrScalar (data+i, n-i);
+    for (size_t k=0; k<W; ++k) {
+      sum += acc0[k];
+    }
+    return sum;
+  }
+
+  template<typename S, int NB>
+  CASA_SIMD_INLINE S sumSqrDiffVec (const S* data, size_t n,
+                                    S base0, S base1)
+  {
+    typedef typename SIMDVec<S,NB>::type V;
+    const size_t W = SIMDVec<S,NB>::nelem;
+    const V base = patternVec<S,NB> (base0, base1);
+    V acc0 = V(), acc1 = V();
+    size_t i = 0;
+    for (; i+2*W<=n; i+=2*W) {
+      V v0 = loadVec<V> (data+i) - base;
+      V v1 = loadVec<V> (data+i+W) - base;
+      acc0 += v0*v0;
+      acc1 += v1*v1;
+    }
+    for (; i+W<=n; i+=W) {
+      V v0 = loadVec<V> (data+i) - base;
+      acc0 += v0*v0;
+    }
+    acc0 += acc1;
+    // i is even, so the parity of the tail is the same.
+    S sum = sumSqrDiffScalar (data+i, n-i, base0, base1);
+    for (size_t k=0; k<W; ++k) {
+      sum += acc0[k];
+    }
+    return sum;
+  }
+
+  template<typename S, int NB>
+  CASA_SIMD_INLINE void minMaxVec (const S* data, size_t n,
+                                   S& minVal, S& maxVal)
+  {
+    typedef typename SIMDVec<S,NB>::type V;
+    const size_t W = SIMDVec<S,NB>::nelem;
+    // Start all lanes with the first value, so a NaN is handled in
+    // the same way as in the scalar loop.
+    S minv = data[0];
+    S maxv = minv;
+    if (n >= W) {
+      V vmin = patternVec<S,NB> (minv, minv);
+      V vmax = vmin;
+      size_t i = 0;
+      for (; i+W<=n; i+=W) {
+        V v = loadVec<V> (data+i);
+        vmin = v < vmin  ?  v : vmin;
+        vmax = v > vmax  ?  v : vmax;
+      }
+      for (size_t k=0; k<W; ++k) {
+        if (vmin[k] < minv) {
+          minv = vmin[k];
+        }
+        if (vmax[k] > maxv) {
+          maxv = vmax[k];
+        }
+      }
+      data += i;
+      n    -= i;
+    }
+    for (size_t i=0; i<n; ++i) {
+      if (data[i] < minv) {
+        minv = data[i];
+      }
+      if (data[i] > maxv) {
+        maxv = data[i];
+      }
+    }
+    minVal = minv;
+    maxVal = maxv;
+  }
+
+  template<typename S, int NB, typename OP>
+  CASA_SIMD_INLINE void transformVec (const S* left, const S* right,
+                                      S* result, size_t n)
+  {
+    typedef typename SIMDVec<S,NB>::type V;
+    const size_t W = SIMDVec<S,NB>::nelem;
+    size_t i = 0;
+    for (; i+W<=n; i+=W) {
+      storeVec (result+i, OP::apply (loadVec<V>(left+i),
+                                     loadVec<V>(right+i)));
+    }
+    transformScalarOp<S,OP> (left+i, right+i, result+i, n-i);
+  }
+
+  template<typename S, int NB, typename OP>
+  CASA_SIMD_INLINE void transformVec (const S* data, S scalar0, S scalar1,
+                                      Bool scalarLeft, S* result, size_t n)
+  {
+    typedef typename SIMDVec<S,NB>::type V;
+    const size_t W = SIMDVec<S,NB>::nelem;
+    const V scalar = patternVec<S,NB> (scalar0, scalar1);
+    size_t i = 0;
+    if (scalarLeft) {
+      for (; i+W<=n; i+=W) {
+        storeVec (result+i, OP::apply (scalar, loadVec<V>(data+i)));
+      }
+    } else {
+      for (; i+W<=n; i+=W) {
+        storeVec (result+i, OP::apply (loadVec<V>(data+i), scalar));
+      }
+    }
+    transformScalarOp<S,OP> (data+i, scalar0, scalar1, scalarLeft,
+                             result+i, n-i);
+  }
+
+  template<typename S, int NB>
+  CASA_SIMD_INLINE void transformOperVec (ArraySIMD::Oper oper,
+                                          const S* left, const S* right,
+                                          S* result, size_t n)
+  {
+    switch (oper) {
+    case ArraySIMD::Add:
+      transformVec<S,NB,AddOp> (left, right, result, n);
+      break;
+    case ArraySIMD::Sub:
+      transformVec<S,NB,SubOp> (left, right, result, n);
+      break;
+    case ArraySIMD::Mul:
+      transformVec<S,NB,MulOp> (left, right, result, n);
+      break;
+    case ArraySIMD::Div:
+      transformVec<S,NB,DivOp> (left, right, result, n);
+      break;
+    }
+  }
+
+  template<typename S, int NB>
+  CASA_SIMD_INLINE void transformOperVec (ArraySIMD::Oper oper,
+                                          const S* data,
+                                          S scalar0, S scalar1,
+                                          Bool scalarLeft,
+                                          S* result, size_t n)
+  {
+    switch (oper) {
+    case ArraySIMD::Add:
+      transformVec<S,NB,AddOp> (data, scalar0, scalar1, scalarLeft,
+                                result, n);
+      break;
+    case ArraySIMD::Sub:
+      transformVec<S,NB,SubOp> (data, scalar0, scalar1, scalarLeft,
+                                result, n);
+      break;
+    case ArraySIMD::Mul:
+      transformVec<S,NB,MulOp> (data, scalar0, scalar1, scalarLeft,
+                                result, n);
+      break;
+    case ArraySIMD::Div:
+      transformVec<S,NB,DivOp> (data, scalar0, scalar1, scalarLeft,
+                                result, n);
+      break;
+    }
+  }
+  // </group>
+
+  // Define the kernel functions for an instruction set.
+  // NAME is the suffix of the function names, TARGET the target attribute
+  // and NB the vector size in bytes.
+#define CASA_SIMD_DEFINE_KERNELS(NAME, TARGET, NB) \
+  template<typename S> TARGET \
+  void sum##NAME (const S* data, size_t n, S& even, S& odd) \
+    { sumVec<S,NB> (data, n, even, odd); } \
+  template<typename S> TARGET \
+  S sumSqr##NAME (const S* data, size_t n) \
+    { return sumSqrVec<S,NB> (data, n); } \
+  template<typename S> TARGET \
+  S sumSqrDiff##NAME (const S* data, size_t n, S base0, S base1) \
+    { return sumSqrDiffVec<S,NB> (data, n, base0, base1); } \
+  template<typename S> TARGET \
+  void minMax##NAME (const S* data, size_t n, S& minVal, S& maxVal) \
+    { minMaxVec<S,NB> (data, n, minVal, maxVal); } \
+  template<typename S> TARGET \
+  void transform##NAME (ArraySIMD::Oper oper, const S* left, \
+                        const S* right, S* result, size_t n) \
+    { transformOperVec<S,NB> (oper, left, right, result, n); } \
+  template<typename S> TARGET \
+  void transform##NAME (ArraySIMD::Oper oper, const S* data, \
+                        S scalar0, S scalar1, Bool scalarLeft, \
+                        S* result, size_t n) \
+    { transformOperVec<S,NB> (oper, data, scalar0, scalar1, scalarLeft, \
+                              result, n); }
+
+  CASA_SIMD_DEFINE_KERNELS (SSE2, , 16)
+#ifdef CASA_SIMD_X86
+  CASA_SIMD_DEFINE_KERNELS (AVX2, __attribute__((target("avx2"))), 32)
+  CASA_SIMD_DEFINE_KERNELS (AVX512, __attribute__((target("avx512f"))), 64)
+#endif
+
+#undef CASA_SIMD_DEFINE_KERNELS
+#undef CASA_SIMD_INLINE
+
+#endif
+
+  // Determine the best level supported by the CPU.
+  ArraySIMD::Level detectLevel()
+  {
+#if defined(CASA_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports ("avx512f")) {
+      return ArraySIMD::AVX512;
+    }
+    if (__builtin_cpu_supports ("avx2")) {
+      return ArraySIMD::AVX2;
+    }
+    return ArraySIMD::SSE2;
+#elif defined(CASA_SIMD_VECTOR)
+    return ArraySIMD::SSE2;
+#else
+    return ArraySIMD::NoSIMD;
+#endif
+  }
+
+  std::atomic<int>& currentLevel()
+  {
+    static std::atomic<int> level(detectLevel());
+    return level;
+  }
+
+} //# end anonymous namespace
+
+
+//# Call the kernel function for the current level.
+#if defined(CASA_SIMD_X86)
+# define CASA_SIMD_DISPATCH(FUNC, ARGS) \
+  switch (level()) { \
+  case AVX512: return FUNC##AVX512 ARGS; \
+  case AVX2:   return FUNC##AVX2 ARGS; \
+  case SSE2:   return FUNC##SSE2 ARGS; \
+  default:     return FUNC##Scalar ARGS; \
+  }
+#elif defined(CASA_SIMD_VECTOR)
+# define CASA_SIMD_DISPATCH(FUNC, ARGS) \
+  if (level() != NoSIMD) { \
+    return FUNC##SSE2 ARGS; \
+  } \
+  return FUNC##Scalar ARGS;
+#else
+# define CASA_SIMD_DISPATCH(FUNC, ARGS) \
+  return FUNC##Scalar ARGS;
+#endif
+
+//# Define the scalar transform kernels for the given type.
+#define CASA_SIMD_TRANSFORM(S) \
+  void transformScalar (ArraySIMD::Oper oper, const S* left, \
+                        const S* right, S* result, size_t n) \
+  { \
+    switch (oper) { \
+    case ArraySIMD::Add: \
+      return transformScalarOp<S,AddOp> (left, right, result, n); \
+    case ArraySIMD::Sub: \
+      return transformScalarOp<S,SubOp> (left, right, result, n); \
+    case ArraySIMD::Mul: \
+      return transformScalarOp<S,MulOp> (left, right, result, n); \
+    case ArraySIMD::Div: \
+      return transformScalarOp<S,DivOp> (left, right, result, n); \
+    } \
+  } \
+  void transformScalar (ArraySIMD::Oper oper, const S* data, \
+                        S scalar0, S scalar1, Bool scalarLeft, \
+                        S* result, size_t n) \
+  { \
+    switch (oper) { \
+    case ArraySIMD::Add: \
+      return transformScalarOp<S,AddOp> (data, scalar0, scalar1, \
+                                         scalarLeft, result, n); \
+    case ArraySIMD::Sub: \
+      return transformScalarOp<S,SubOp> (data, scalar0, scalar1, \
+                                         scalarLeft, result, n); \
+    case ArraySIMD::Mul: \
+      return transformScalarOp<S,MulOp> (data, scalar0, scalar1, \
+                                         scalarLeft, result, n); \
+    case ArraySIMD::Div: \
+      return transformScalarOp<S,DivOp> (data, scalar0, scalar1, \
+                                         scalarLeft, result, n); \
+    } \
+  }
+
+namespace {
+  CASA_SIMD_TRANSFORM (Float)
+  CASA_SIMD_TRANSFORM (Double)
+}
+#undef CASA_SIMD_TRANSFORM
+
+
+ArraySIMD::Level ArraySIMD::level()
+{
+  return Level(currentLevel().load (std::memory_order_relaxed));
+}
+
+ArraySIMD::Level ArraySIMD::supportedLevel()
+{
+  static const Level level = detectLevel();
+  return level;
+}
+
+ArraySIMD::Level ArraySIMD::setLevel (Level level)
+{
+  return Level(currentLevel().exchange (std::min (level, supportedLevel())));
+}
+
+void ArraySIMD::sum (const Float* data, size_t n, Float& even, Float& odd)
+  { CASA_SIMD_DISPATCH (sum, (data, n, even, odd)) }
+void ArraySIMD::sum (const Double* data, size_t n, Double& even, Double& odd)
+  { CASA_SIMD_DISPATCH (sum, (data, n, even, odd)) }
+
+Float ArraySIMD::sumSqr (const Float* data, size_t n)
+  { CASA_SIMD_DISPATCH (sumSqr, (data, n)) }
+Double ArraySIMD::sumSqr (const Double* data, size_t n)
+  { CASA_SIMD_DISPATCH (sumSqr, (data, n)) }
+
+Float ArraySIMD::sumSqrDiff (const Float* data, size_t n,
+                             Float base0, Float base1)
+  { CASA_SIMD_DISPATCH (sumSqrDiff, (data, n, base0, base1)) }
+Double ArraySIMD::sumSqrDiff (const Double* data, size_t n,
+                              Double base0, Double base1)
+  { CASA_SIMD_DISPATCH (sumSqrDiff, (data, n, base0, base1)) }
+
+void ArraySIMD::minMax (const Float* data, size_t n,
+                        Float& minVal, Float& maxVal)
+  { CASA_SIMD_DISPATCH (minMax, (data, n, minVal, maxVal)) }
+void ArraySIMD::minMax (const Double* data, size_t n,
+                        Double& minVal, Double& maxVal)
+  { CASA_SIMD_DISPATCH (minMax, (data, n, minVal, maxVal)) }
+
+void ArraySIMD::transform (Oper oper, const Float* left, const Float* right,
+                           Float* result, size_t n)
+  { CASA_SIMD_DISPATCH (transform, (oper, left, right, result, n)) }
+void ArraySIMD::transform (Oper oper, const Double* left,
+                           const Double* right, Double* result, size_t n)
+  { CASA_SIMD_DISPATCH (transform, (oper, left, right, result, n)) }
+
+void ArraySIMD::transform (Oper oper, const Float* data,
+                           Float scalar0, Float scalar1, Bool scalarLeft,
+                           Float* result, size_t n)
+{
+  CASA_SIMD_DISPATCH (transform, (oper, data, scalar0, scalar1, scalarLeft,
+                                  result, n))
+}
+void ArraySIMD::transform (Oper oper, const Double* data,
+                           Double scalar0, Double scalar1, Bool scalarLeft,
+                           Double* result, size_t n)
+{
+  CASA_SIMD_DISPATCH (transform, (oper, data, scalar0, scalar1, scalarLeft,
+                                  result, n))
+}
+
+#undef CASA_SIMD_DISPATCH
+
+
+} //# NAMESPACE CASACORE - END
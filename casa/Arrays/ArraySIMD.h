@@ -0,0 +1,457 @@
+//# ArraySIMD.h: SIMD kernels for reductions and arithmetic on contiguous data
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_ARRAYSIMD_H
+#define CASA_ARRAYSIMD_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicMath/Functors.h>
+//# Needed to get the proper Complex typedef's
+#include <casacore/casa/BasicSL/Complex.h>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// SIMD kernels for reductions and arithmetic on contiguous data
+// </summary>
+//
+// <use visibility=local>
+//
+// <reviewed reviewer="" date="" tests="tArraySIMD">
+//
+// <synopsis>
+// This class contains vectorized kernels for the reductions (sum, sum of
+// squares, sum of squared differences, minimum and maximum) and the
+// element-wise arithmetic (+, -, *, /) on contiguous Float and Double data.
+// They are used by ArrayMath and ArrayPartMath for contiguous arrays of
+// type Float, Double, Complex and DComplex (through the overloaded
+// <src>simd*</src> functions defined below). A Complex array is processed
+// as an array of Floats of twice the length.
+// <p>
+// The kernels are compiled for SSE2, AVX2 and AVX-512 (on x86 platforms
+// using GCC or clang) and the best level supported by the CPU is selected
+// at run time. A portable scalar version is used on other platforms.
+// The level can be lowered using <src>setLevel</src>, which is mainly
+// meant for testing and benchmarking.
+// <p>
+// Note that the reductions use multiple partial sums, so the result can
+// differ in the last bits from a sequential accumulation (usually it is
+// more accurate). The element-wise operations give exactly the same
+// results as the scalar operations.
+// </synopsis>
+//
+// <motivation>
+// Compilers rarely vectorize the floating point reductions, because that
+// requires a reordering of the operations. They dominate the image
+// statistics and flagging.
+// </motivation>
+
+class ArraySIMD
+{
+public:
+  // The vectorization levels.
+  enum Level {
+    // Plain scalar code.
+    NoSIMD,
+    // 128-bit vectors (SSE2 on x86 platforms).
+    SSE2,
+    // 256-bit vectors.
+    AVX2,
+    // 512-bit vectors.
+    AVX512
+  };
+
+  // The element-wise operations.
+  enum Oper {Add, Sub, Mul, Div};
+
+  // Get the level used by the kernels.
+  static Level level();
+
+  // Get the best level supported by the CPU.
+  static Level supportedLevel();
+
+  // Set the level to use. It is limited to the supported level.
+  // It returns the previous level.
+  static Level setLevel (Level level);
+
+  // Sum the data, where the elements with an even and odd index
+  // are summed separately (for the real and imaginary parts of complex data).
+  // <group>
+  static void sum (const Float* data, size_t n, Float& even, Float& odd);
+  static void sum (const Double* data, size_t n, Double& even, Double& odd);
+  // </group>
+
+  // Sum the squares of the data.
+  // <group>
+  static Float sumSqr (const Float* data, size_t n);
+  static Double sumSqr (const Double* data, size_t n);
+  // </group>
+
+  // Sum the squared differences of the data and a base value, where the
+  // elements with an even index use base0, those with an odd index base1.
+  // <group>
+  static Float sumSqrDiff (const Float* data, size_t n,
+                           Float base0, Float base1);
+  static Double sumSqrDiff (const Double* data, size_t n,
+                            Double base0, Double base1);
+  // </group>
+
+  // Get the minimum and maximum of the data; n must be > 0.
+  // NaN values are handled as in the scalar loop in ArrayMath's minMax.
+  // <group>
+  static void minMax (const Float* data, size_t n,
+                      Float& minVal, Float& maxVal);
+  static void minMax (const Double* data, size_t n,
+                      Double& minVal, Double& maxVal);
+  // </group>
+
+  // Do the element-wise operation on two arrays. The result array can
+  // be the same as the left or right array.
+  // <group>
+  static void transform (Oper oper, const Float* left, const Float* right,
+                         Float* result, size_t n);
+  static void transform (Oper oper, const Double* left, const Double* right,
+                         Double* result, size_t n);
+  // </group>
+
+  // Do the element-wise operation on an array and a scalar, where the
+  // elements with an even index use scalar0, those with an odd index scalar1.
+  // If <src>scalarLeft</src> is true, the scalar is the left operand.
+  // The result array can be the same as the input array.
+  // <group>
+  static void transform (Oper oper, const Float* data,
+                         Float scalar0, Float scalar1, Bool scalarLeft,
+                         Float* result, size_t n);
+  static void transform (Oper oper, const Double* data,
+                         Double scalar0, Double scalar1, Bool scalarLeft,
+                         Double* result, size_t n);
+  // </group>
+
+  // Tell if the SIMD kernels can be used for the result and an operand,
+  // which is the case if they do not partially overlap.
+  static Bool canTransform (const void* result, const void* operand,
+                            size_t nbytes)
+  {
+    const char* res = static_cast<const char*>(result);
+    const char* opd = static_cast<const char*>(operand);
+    return res == opd  ||  res + nbytes <= opd  ||  opd + nbytes <= res;
+  }
+};
+
+
+// <summary>
+// Map an STL functor to an ArraySIMD operation.
+// </summary>
+// <synopsis>
+// <src>supported</src> tells if the functor is supported by ArraySIMD;
+// if so, <src>oper</src> gives the corresponding operation.
+// </synopsis>
+template<typename OP> struct ArraySIMDOper
+  { static const Bool supported = False;
+    static const ArraySIMD::Oper oper = ArraySIMD::Add; };
+template<typename T> struct ArraySIMDOper<std::plus<T> >
+  { static const Bool supported = True;
+    static const ArraySIMD::Oper oper = ArraySIMD::Add; };
+template<typename T> struct ArraySIMDOper<std::minus<T> >
+  { static const Bool supported = True;
+    static const ArraySIMD::Oper oper = ArraySIMD::Sub; };
+template<typename T> struct ArraySIMDOper<std::multiplies<T> >
+  { static const Bool supported = True;
+    static const ArraySIMD::Oper oper = ArraySIMD::Mul; };
+template<typename T> struct ArraySIMDOper<std::divides<T> >
+  { static const Bool supported = True;
+    static const ArraySIMD::Oper oper = ArraySIMD::Div; };
+
+
+// <summary>
+// Reductions and element-wise operations on contiguous data.
+// </summary>
+// <synopsis>
+// These functions operate on contiguous data. The generic templates
+// use the same algorithms as ArrayMath. The overloads for Float,
+// Double, Complex and DComplex use the ArraySIMD kernels.
+// For complex data only addition and subtraction are vectorized.
+// </synopsis>
+// <group name="SIMD kernels">
+
+// Sum the data.
+// <group>
+template<typename T>
+inline T simdSum (const T* data, size_t n)
+  { return std::accumulate (data, data+n, T(), std::plus<T>()); }
+inline Float simdSum (const Float* data, size_t n)
+  { Float e, o; ArraySIMD::sum (data, n, e, o); return e+o; }
+inline Double simdSum (const Double* data, size_t n)
+  { Double e, o; ArraySIMD::sum (data, n, e, o); return e+o; }
+inline Complex simdSum (const Complex* data, size_t n)
+{
+  Float re, im;
+  ArraySIMD::sum (reinterpret_cast<const Float*>(data), 2*n, re, im);
+  return Complex(re, im);
+}
+inline DComplex simdSum (const DComplex* data, size_t n)
+{
+  Double re, im;
+  ArraySIMD::sum (reinterpret_cast<const Double*>(data), 2*n, re, im);
+  return DComplex(re, im);
+}
+// </group>
+
+// Sum the squares of the data.
+// <group>
+template<typename T>
+inline T simdSumSqr (const T* data, size_t n)
+  { return std::accumulate (data, data+n, T(), casacore::SumSqr<T>()); }
+inline Float simdSumSqr (const Float* data, size_t n)
+  { return ArraySIMD::sumSqr (data, n); }
+inline Double simdSumSqr (const Double* data, size_t n)
+  { return ArraySIMD::sumSqr (data, n); }
+// </group>
+
+// Sum the squared differences of the data and the mean.
+// For complex values the squared absolute difference is summed.
+// <group>
+template<typename T>
+inline T simdSumSqrDiff (const T* data, size_t n, T mean)
+{
+  return std::accumulate (data, data+n, T(),
+                          casacore::SumSqrDiff<T>(mean));
+}
+inline Float simdSumSqrDiff (const Float* data, size_t n, Float mean)
+  { return ArraySIMD::sumSqrDiff (data, n, mean, mean); }
+inline Double simdSumSqrDiff (const Double* data, size_t n, Double mean)
+  { return ArraySIMD::sumSqrDiff (data, n, mean, mean); }
+inline Complex simdSumSqrDiff (const Complex* data, size_t n, Complex mean)
+{
+  return ArraySIMD::sumSqrDiff (reinterpret_cast<const Float*>(data), 2*n,
+                                mean.real(), mean.imag());
+}
+inline DComplex simdSumSqrDiff (const DComplex* data, size_t n,
+                                DComplex mean)
+{
+  return ArraySIMD::sumSqrDiff (reinterpret_cast<const Double*>(data), 2*n,
+                                mean.real(), mean.imag());
+}
+// </group>
+
+// Get the minimum and maximum of the data; n must be > 0.
+// <group>
+template<typename T>
+inline void simdMinMax (T& minVal, T& maxVal, const T* data, size_t n)
+{
+  T minv = data[0];
+  T maxv = minv;
+  for (size_t i=0; i<n; ++i) {
+    if (data[i] < minv) {
+      minv = data[i];
+    }
+    // no else allows compiler to use branchless instructions
+    if (data[i] > maxv) {
+      maxv = data[i];
+    }
+  }
+  minVal = minv;
+  maxVal = maxv;
+}
+inline void simdMinMax (Float& minVal, Float& maxVal,
+                        const Float* data, size_t n)
+  { ArraySIMD::minMax (data, n, minVal, maxVal); }
+inline void simdMinMax (Double& minVal, Double& maxVal,
+                        const Double* data, size_t n)
+  { ArraySIMD::minMax (data, n, minVal, maxVal); }
+// </group>
+
+// Apply the binary operator to left and right giving result.
+// The result can be the same as left or right.
+// <group>
+template<typename L, typename R, typename RES, typename BinaryOperator>
+inline void simdTransform (const L* left, const R* right, RES* result,
+                           size_t n, BinaryOperator op)
+  { std::transform (left, left+n, right, result, op); }
+template<typename T, typename BinaryOperator>
+inline void simdTransformReal (const T* left, const T* right, T* result,
+                               size_t n, BinaryOperator op)
+{
+  if (ArraySIMDOper<BinaryOperator>::supported  &&
+      ArraySIMD::canTransform (result, left, n*sizeof(T))  &&
+      ArraySIMD::canTransform (result, right, n*sizeof(T))) {
+    ArraySIMD::transform
+      (ArraySIMDOper<BinaryOperator>::oper,
+       left, right, result, n);
+  } else {
+    std::transform (left, left+n, right, result, op);
+  }
+}
+template<typename T, typename BinaryOperator>
+inline void simdTransformComplex (const std::complex<T>* left,
+                                  const std::complex<T>* right,
+                                  std::complex<T>* result,
+                                  size_t n, BinaryOperator op)
+{
+  if (ArraySIMDOper<BinaryOperator>::supported  &&
+      (ArraySIMDOper<BinaryOperator>::oper == ArraySIMD::Add  ||
+       ArraySIMDOper<BinaryOperator>::oper == ArraySIMD::Sub)  &&
+      ArraySIMD::canTransform (result, left, n*sizeof(std::complex<T>))  &&
+      ArraySIMD::canTransform (result, right, n*sizeof(std::complex<T>))) {
+    ArraySIMD::transform
+      (ArraySIMDOper<BinaryOperator>::oper,
+       reinterpret_cast<const T*>(left), reinterpret_cast<const T*>(right),
+       reinterpret_cast<T*>(result), 2*n);
+  } else {
+    std::transform (left, left+n, right, result, op);
+  }
+}
+template<typename BinaryOperator>
+inline void simdTransform (const Float* left, const Float* right,
+                           Float* result, size_t n, BinaryOperator op)
+  { simdTransformReal (left, right, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransform (const Double* left, const Double* right,
+                           Double* result, size_t n, BinaryOperator op)
+  { simdTransformReal (left, right, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransform (const Complex* left, const Complex* right,
+                           Complex* result, size_t n, BinaryOperator op)
+  { simdTransformComplex (left, right, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransform (const DComplex* left, const DComplex* right,
+                           DComplex* result, size_t n, BinaryOperator op)
+  { simdTransformComplex (left, right, result, n, op); }
+// </group>
+
+// Apply the binary operator to the data and a scalar giving result.
+// The scalar is the right operand. The result can be the same as the data.
+// <group>
+template<typename L, typename R, typename RES, typename BinaryOperator>
+inline void simdTransformRight (const L* left, R right, RES* result,
+                                size_t n, BinaryOperator op)
+{
+  for (size_t i=0; i<n; ++i) {
+    result[i] = op(left[i], right);
+  }
+}
+template<typename T, typename BinaryOperator>
+inline void simdTransformRealScalar (const T* data, T scalar, Bool scalarLeft,
+                                     T* result, size_t n, BinaryOperator op)
+{
+  if (ArraySIMDOper<BinaryOperator>::supported  &&
+      ArraySIMD::canTransform (result, data, n*sizeof(T))) {
+    ArraySIMD::transform
+      (ArraySIMDOper<BinaryOperator>::oper,
+       data, scalar, scalar, scalarLeft, result, n);
+  } else if (scalarLeft) {
+    for (size_t i=0; i<n; ++i) {
+      result[i] = op(scalar, data[i]);
+    }
+  } else {
+    for (size_t i=0; i<n; ++i) {
+      result[i] = op(data[i], scalar);
+    }
+  }
+}
+template<typename T, typename BinaryOperator>
+inline void simdTransformComplexScalar (const std::complex<T>* data,
+                                        std::complex<T> scalar,
+                                        Bool scalarLeft,
+                                        std::complex<T>* result,
+                                        size_t n, BinaryOperator op)
+{
+  if (ArraySIMDOper<BinaryOperator>::supported  &&
+      (ArraySIMDOper<BinaryOperator>::oper == ArraySIMD::Add  ||
+       ArraySIMDOper<BinaryOperator>::oper == ArraySIMD::Sub)  &&
+      ArraySIMD::canTransform (result, data, n*sizeof(std::complex<T>))) {
+    ArraySIMD::transform
+      (ArraySIMDOper<BinaryOperator>::oper,
+       reinterpret_cast<const T*>(data), scalar.real(), scalar.imag(),
+       scalarLeft, reinterpret_cast<T*>(result), 2*n);
+  } else if (scalarLeft) {
+    for (size_t i=0; i<n; ++i) {
+      result[i] = op(scalar, data[i]);
+    }
+  } else {
+    for (size_t i=0; i<n; ++i) {
+      result[i] = op(data[i], scalar);
+    }
+  }
+}
+template<typename BinaryOperator>
+inline void simdTransformRight (const Float* left, Float right,
+                                Float* result, size_t n, BinaryOperator op)
+  { simdTransformRealScalar (left, right, False, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransformRight (const Double* left, Double right,
+                                Double* result, size_t n, BinaryOperator op)
+  { simdTransformRealScalar (left, right, False, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransformRight (const Complex* left, Complex right,
+                                Complex* result, size_t n, BinaryOperator op)
+  { simdTransformComplexScalar (left, right, False, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransformRight (const DComplex* left, DComplex right,
+                                DComplex* result, size_t n,
+                                BinaryOperator op)
+  { simdTransformComplexScalar (left, right, False, result, n, op); }
+// </group>
+
+// Apply the binary operator to a scalar and the data giving result.
+// The scalar is the left operand. The result can be the same as the data.
+// <group>
+template<typename L, typename R, typename RES, typename BinaryOperator>
+inline void simdTransformLeft (L left, const R* right, RES* result,
+                               size_t n, BinaryOperator op)
+{
+  for (size_t i=0; i<n; ++i) {
+    result[i] = op(left, right[i]);
+  }
+}
+template<typename BinaryOperator>
+inline void simdTransformLeft (Float left, const Float* right,
+                               Float* result, size_t n, BinaryOperator op)
+  { simdTransformRealScalar (right, left, True, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransformLeft (Double left, const Double* right,
+                               Double* result, size_t n, BinaryOperator op)
+  { simdTransformRealScalar (right, left, True, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransformLeft (Complex left, const Complex* right,
+                               Complex* result, size_t n, BinaryOperator op)
+  { simdTransformComplexScalar (right, left, True, result, n, op); }
+template<typename BinaryOperator>
+inline void simdTransformLeft (DComplex left, const DComplex* right,
+                               DComplex* result, size_t n, BinaryOperator op)
+  { simdTransformComplexScalar (right, left, True, result, n, op); }
+// </group>
+
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
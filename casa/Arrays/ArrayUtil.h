@@ -266,6 +266,13 @@ Array<T> reverseArray (const Array<T>& array, uInt axis,
 // functions partialMedians and partialFractiles.
 // </motivation>
 
+// <note>
+// If the first axis is moved, the data are transposed in cache-sized blocks
+// of the input's first axis and the axis that becomes the first one, so
+// reading and writing both use the cache well. If the array is large and
+// OpenMP is used, the blocks are divided over multiple threads.
+// </note>
+
 // <group name=reorderArray>
 template<class T>
 Array<T> reorderArray (const Array<T>& array,
@@ -299,6 +306,40 @@ uInt reorderArrayHelper (IPosition& newShape, IPosition& incr,
 // </group>
 
 
+// <summary>
+// Cache-blocked transposition for function reorderArray.
+// </summary>
+
+// <use visibility=local>
+
+// <synopsis>
+// This function does the reordering in reorderArray if the first axis
+// is moved. Both input and output must be contiguous.
+// <br>Let <src>axis1</src> be the input axis that becomes the first output
+// axis. The data are transposed in square blocks of the first input
+// axis and <src>axis1</src>. Inside a block the input is read along the
+// first input axis and the output is written along the first output axis
+// without leaving the cache. The blocks (including the positions of the
+// other axes) are independent, so they are divided over multiple threads
+// if OpenMP is used and the array is large enough.
+// <br>The helper function determines <src>axis1</src>, the input stride of
+// <src>axis1</src>, the output stride of the first input axis, and the
+// shape and input and output strides of the remaining axes.
+// </synopsis>
+
+// <group name=reorderArrayBlocked>
+template<class T>
+void reorderArrayBlocked (T* out, const T* in, const IPosition& shape,
+                          const IPosition& newAxisOrder);
+void reorderArrayBlockedHelper (uInt& axis1, Int64& inStride1,
+                                Int64& outStride0, IPosition& otherShape,
+                                IPosition& otherInStride,
+                                IPosition& otherOutStride,
+                                const IPosition& shape,
+                                const IPosition& newAxisOrder);
+// </group>
+
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -31,6 +31,8 @@
 #include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/Arrays/ArrayError.h>
 #include <casacore/casa/Utilities/Copy.h>
+#include <casacore/casa/OS/OMP.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -83,30 +85,24 @@ Array<T> reorderArray (const Array<T>& array,
   const T* data = arrData;
   T* resData = result.getStorage (deleteRes);
   T* res = resData;
+  // If the first axis is moved, use the blocked transposition.
+  if (contAxes == 0) {
+    reorderArrayBlocked (res, data, shape, newAxisOrder);
+    array.freeStorage (arrData, deleteData);
+    result.putStorage (resData, deleteRes);
+    return result;
+  }
   // Find out the nr of contiguous elements.
   uInt nrcont = 1;
-  if (contAxes == 0) {
-    contAxes = 1;
-  } else {
-    for (uInt i=0; i<contAxes; i++) {
-      nrcont *= shape(i);
-    }
+  for (uInt i=0; i<contAxes; i++) {
+    nrcont *= shape(i);
   }
-  uInt incr0 = incr(0);
-  uInt n0 = shape(0);
   // Loop through all data and copy as needed.
   IPosition pos(ndim, 0);
   while (True) {
-    if (nrcont > 1) {
-      objcopy (res, data, nrcont);
-      data += nrcont;
-      res += nrcont;
-    } else {
-      for (uInt i=0; i<n0; i++) {
-	*res = *data++;
-	res += incr0;
-      }
-    }
+    objcopy (res, data, nrcont);
+    data += nrcont;
+    res += nrcont;
     uInt ax;
     for (ax=contAxes; ax<ndim; ax++) {
       res += incr(ax);
@@ -126,6 +122,63 @@ Array<T> reorderArray (const Array<T>& array,
 
 
 
+template<class T>
+void reorderArrayBlocked (T* out, const T* in, const IPosition& shape,
+                          const IPosition& newAxisOrder)
+{
+  uInt axis1;
+  Int64 inStride1, outStride0;
+  IPosition otherShape, otherInStride, otherOutStride;
+  reorderArrayBlockedHelper (axis1, inStride1, outStride0, otherShape,
+                             otherInStride, otherOutStride,
+                             shape, newAxisOrder);
+  const Int64 n0 = shape(0);
+  const Int64 n1 = shape(axis1);
+  // A block of input and output should fit in the L1 cache.
+  const Int64 blockSize = std::max (size_t(4), size_t(256/sizeof(T)));
+  const Int64 nb0 = (n0 + blockSize - 1) / blockSize;
+  const Int64 nb1 = (n1 + blockSize - 1) / blockSize;
+  const uInt nother = otherShape.nelements();
+  Int64 nblock = nb0 * nb1;
+  for (uInt k=0; k<nother; ++k) {
+    nblock *= otherShape[k];
+  }
+#ifdef _OPENMP
+  // Only use multiple threads for arrays exceeding a typical last-level
+  // cache (8 MB).
+  uInt nthreads = 1;
+  if (shape.product() * sizeof(T) > 8*1024*1024) {
+    nthreads = OMP::maxThreads();
+  }
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+  for (Int64 block=0; block<nblock; ++block) {
+    // Determine the block start and the position in the other axes.
+    Int64 st0 = (block % nb0) * blockSize;
+    Int64 rest = block / nb0;
+    Int64 st1 = (rest % nb1) * blockSize;
+    rest /= nb1;
+    const T* inPtr = in + st0;
+    T* outPtr = out + st0*outStride0;
+    for (uInt k=0; k<nother; ++k) {
+      Int64 pos = rest % otherShape[k];
+      rest /= otherShape[k];
+      inPtr  += pos * otherInStride[k];
+      outPtr += pos * otherOutStride[k];
+    }
+    Int64 end0 = std::min (st0 + blockSize, n0) - st0;
+    Int64 end1 = std::min (st1 + blockSize, n1);
+    for (Int64 i=0; i<end0; ++i) {
+      const T* inp = inPtr + i;
+      T* outp = outPtr + i*outStride0;
+      for (Int64 j=st1; j<end1; ++j) {
+        outp[j] = inp[j*inStride1];
+      }
+    }
+  }
+}
+
+
 template<class T>
 Array<T> reverseArray (const Array<T>& array, uInt axis, Bool alwaysCopy)
 {
@@ -171,5 +171,44 @@ uInt reorderArrayHelper (IPosition& newShape, IPosition& incr,
   return contAxes;
 }
 
+void reorderArrayBlockedHelper (uInt& axis1, Int64& inStride1,
+                                Int64& outStride0, IPosition& otherShape,
+                                IPosition& otherInStride,
+                                IPosition& otherOutStride,
+                                const IPosition& shape,
+                                const IPosition& newAxisOrder)
+{
+  uInt ndim = shape.nelements();
+  IPosition toOld = IPosition::makeAxisPath (ndim, newAxisOrder);
+  // Determine the input and output stride of each input axis.
+  IPosition inStride(ndim);
+  IPosition outStride(ndim);
+  Int64 inVolume = 1;
+  Int64 outVolume = 1;
+  for (uInt i=0; i<ndim; i++) {
+    inStride(i) = inVolume;
+    inVolume *= shape(i);
+    outStride(toOld(i)) = outVolume;
+    outVolume *= shape(toOld(i));
+  }
+  axis1 = toOld(0);
+  inStride1 = inStride(axis1);
+  outStride0 = outStride(0);
+  // The other axes are iterated in input order.
+  uInt nother = (axis1 == 0  ?  ndim-1 : ndim-2);
+  otherShape.resize (nother);
+  otherInStride.resize (nother);
+  otherOutStride.resize (nother);
+  uInt k = 0;
+  for (uInt i=1; i<ndim; i++) {
+    if (i != axis1) {
+      otherShape(k) = shape(i);
+      otherInStride(k) = inStride(i);
+      otherOutStride(k) = outStride(i);
+      k++;
+    }
+  }
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -40,6 +40,7 @@ namespace casacore {
   template class Array<Int>;
   template class Array<uInt>;
   template class Array<Int64>;
+  template class Array<uInt64>;
   template class Array<Float>;
   template class Array<Double>;
   template class Array<Complex>;
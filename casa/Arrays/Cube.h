@@ -107,6 +107,10 @@ public:
     // The copy constructor uses reference semantics.
     Cube(const Cube<T> &);
 
+    // Move the other Cube to this one. Thereafter other is an empty
+    // Cube (shape 0x0x0).
+    Cube(Cube<T>&& other);
+
     // Construct a cube by reference from "other". "other must have
     // ndim() of 3 or less. The warning which applies to the copy constructor
     // is also valid here.
@@ -153,6 +157,12 @@ public:
     virtual Array<T> &operator=(const Array<T> &other);
     // </group>
 
+    // Move assignment. If this Cube is empty and other is the only
+    // owner of its storage, the storage of other is taken over. Otherwise
+    // the values are copied as in the copy assignment.
+    // Thereafter other is an empty Cube.
+    Cube<T> &operator=(Cube<T>&& other);
+
     // Copy val into every element of this cube; i.e. behaves as if
     // val were a constant conformant cube.
     Array<T> &operator=(const T &val)
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/MaskedArray.h>
 #include <casacore/casa/Arrays/ArrayError.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <utility>
 #include <casacore/casa/iostream.h>
 
 
@@ -98,6 +99,13 @@ template<class T> Cube<T>::Cube(const Cube<T> &other)
     DebugAssert(ok(), ArrayError);
 }
 
+template<class T> Cube<T>::Cube(Cube<T>&& other)
+  : Array<T>(std::move(other))
+{
+    makeIndexingConstants();
+    DebugAssert(ok(), ArrayError);
+}
+
 // <thrown>
 //   <item> ArrayNDimError
 // </thrown>
@@ -176,6 +184,18 @@ template<class T> Cube<T> &Cube<T>::operator=(const Cube<T> &other)
     return *this;
 }
 
+template<class T> Cube<T> &Cube<T>::operator=(Cube<T>&& other)
+{
+    DebugAssert(ok(), ArrayError);
+    if (this != &other) {
+        if (! this->moveStorage (other)) {
+            operator= (static_cast<const Cube<T>&>(other));
+        }
+        other.makeEmpty();
+    }
+    return *this;
+}
+
 template<class T> Array<T> &Cube<T>::operator=(const Array<T> &a)
 {
     DebugAssert(ok(), ArrayError);
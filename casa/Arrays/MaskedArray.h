@@ -460,6 +460,11 @@ public:
     MaskedArray(const MaskedArray<T> &other);
     // </group>
 
+    // Move constructor. The array and mask of <src>other</src> are
+    // taken over, so thereafter <src>other</src> is empty (as if default
+    // constructed).
+    MaskedArray(MaskedArray<T>&& other);
+
     ~MaskedArray();
 
     // Return a MaskedArray.  The new MaskedArray is masked by the input
@@ -586,6 +591,12 @@ public:
     MaskedArray<T> &operator=(const MaskedArray<T> &other);
     // </group>
 
+    // Move assignment. It behaves as the copy assignment, but if this
+    // MaskedArray is empty (default constructed), the storage of the array
+    // and mask of <src>other</src> is taken over if nobody else uses it.
+    // Thereafter <src>other</src> is empty (as if default constructed).
+    MaskedArray<T> &operator=(MaskedArray<T>&& other);
+
     // Set every element of this array to "value", only setting those elements
     // for which the corresponding mask element is True.
     // In other words, a scalar behaves as if it were a constant conformant
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/ArrayError.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <utility>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -308,6 +309,22 @@ template<class T> MaskedArray<T>::MaskedArray(const MaskedArray<T> &other)
 }
 
 
+template<class T> MaskedArray<T>::MaskedArray(MaskedArray<T>&& other)
+: pArray (other.pArray), pMask (other.pMask),
+  nelemValid (other.nelemValid), nelemValidIsOK (other.nelemValidIsOK),
+  isRO (other.isRO)
+{
+    other.pArray = 0;
+    other.pMask  = 0;
+    other.nelemValid = 0;
+    other.nelemValidIsOK = False;
+    other.isRO = False;
+
+    DebugAssert(ok(), ArrayError);
+
+}
+
+
 template<class T> MaskedArray<T>::~MaskedArray()
 {
     if (pArray) {
@@ -740,6 +757,42 @@ template<class T> MaskedArray<T> & MaskedArray<T>::operator=
     return *this;
 }
 
+template<class T>
+MaskedArray<T> &MaskedArray<T>::operator= (MaskedArray<T>&& other)
+{
+    DebugAssert(ok(), ArrayError);
+
+    if (this == &other)
+	return *this;
+
+    if (!pArray) {
+      if (other.pArray) {
+        // Like the copy assignment, this gets a copy of the data.
+        // The move assignment of Array takes over the storage if nobody
+        // else uses it, thus avoids the copy if possible.
+        pArray = new Array<T>();
+        *pArray = std::move (*(other.pArray));
+        delete pMask;
+        pMask = new LogicalArray();
+        *pMask = std::move (*(other.pMask));
+        nelemValid = other.nelemValid;
+        nelemValidIsOK = other.nelemValidIsOK;
+        isRO = False;
+      }
+    } else {
+      operator= (static_cast<const MaskedArray<T>&>(other));
+    }
+    delete other.pArray;
+    delete other.pMask;
+    other.pArray = 0;
+    other.pMask  = 0;
+    other.nelemValid = 0;
+    other.nelemValidIsOK = False;
+    other.isRO = False;
+    return *this;
+}
+
+
 template<class T>
 MaskedArray<T> &MaskedArray<T>::operator= (const MaskedArray<T> &other)
 {
@@ -120,6 +120,10 @@ public:
     // The copy constructor uses reference semantics.
     Matrix(const Matrix<T> &other);
 
+    // Move the other Matrix to this one. Thereafter other is an empty
+    // Matrix (shape 0x0).
+    Matrix(Matrix<T>&& other);
+
     // Construct a Matrix by reference from "other". "other must have
     // ndim() of 2 or less.
     Matrix(const Array<T> &other);
@@ -169,6 +173,12 @@ public:
     virtual Array<T> &operator=(const Array<T> &other);
     // </group>
 
+    // Move assignment. If this Matrix is empty and other is the only
+    // owner of its storage, the storage of other is taken over. Otherwise
+    // the values are copied as in the copy assignment.
+    // Thereafter other is an empty Matrix.
+    Matrix<T> &operator=(Matrix<T>&& other);
+
     // Copy val into every element of this Matrix; i.e. behaves as if
     // val were a constant conformant matrix.
     Array<T> &operator=(const T &val)
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/MaskedArray.h>
 #include <casacore/casa/Arrays/ArrayError.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <utility>
 #include <casacore/casa/iostream.h>
 
 
@@ -96,6 +97,13 @@ template<class T> Matrix<T>::Matrix(const Matrix<T> &other)
     DebugAssert(ok(), ArrayError);
 }
 
+template<class T> Matrix<T>::Matrix(Matrix<T>&& other)
+  : Array<T>(std::move(other))
+{
+    makeIndexingConstants();
+    DebugAssert(ok(), ArrayError);
+}
+
 // <thrown>
 //    <item> ArrayNDimError
 // </thrown>
@@ -177,6 +185,18 @@ template<class T> Matrix<T> &Matrix<T>::operator=(const Matrix<T> &other)
     return *this;
 }
 
+template<class T> Matrix<T> &Matrix<T>::operator=(Matrix<T>&& other)
+{
+    DebugAssert(ok(), ArrayError);
+    if (this != &other) {
+        if (! this->moveStorage (other)) {
+            operator= (static_cast<const Matrix<T>&>(other));
+        }
+        other.makeEmpty();
+    }
+    return *this;
+}
+
 template<class T> Array<T> &Matrix<T>::operator=(const Array<T> &a)
 {
     DebugAssert(ok(), ArrayError);
@@ -32,6 +32,7 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/ArrayError.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/math.h>
 
@@ -151,10 +152,8 @@ Matrix<T> product (const Matrix<T> &A, const Matrix<T> &B) {
 }
 
 template <class T> Matrix<T> transpose (const Matrix<T> &A) {
-  Matrix<T> aT(A.ncolumn(), A.nrow());
-  for (uInt i=0; i<A.nrow(); i++)
-    for (uInt j=0; j<A.ncolumn(); j++) aT(j,i) = A(i,j);
-  return aT;
+  // reorderArray transposes in cache-sized blocks.
+  return reorderArray (A, IPosition(2,1,0), True);
 }
 
 template <class T> 
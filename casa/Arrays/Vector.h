@@ -114,6 +114,10 @@ public:
 
     // Create a reference to other.
     Vector(const Vector<T> &other);
+
+    // Move the other Vector to this one. Thereafter other is an empty
+    // Vector (its length is zero).
+    Vector(Vector<T>&& other);
     
     // Create a reference to the other array.
     // It is always possible if the array has zero or one axes.
@@ -183,6 +187,12 @@ public:
     virtual Array<T> &operator=(const Array<T> &other);
     // </group>
 
+    // Move assignment. If this Vector is zero-length and other is the only
+    // owner of its storage, the storage of other is taken over. Otherwise
+    // the values are copied as in the copy assignment.
+    // Thereafter other is an empty Vector.
+    Vector<T> &operator=(Vector<T>&& other);
+
     // Set every element of this Vector to Val.
     Array<T> &operator=(const T &val)
       { return Array<T>::operator=(val); }
@@ -320,6 +330,7 @@ private:
   extern template class Vector<Int>;
   extern template class Vector<uInt>;
   extern template class Vector<Int64>;
+  extern template class Vector<uInt64>;
   extern template class Vector<Float>;
   extern template class Vector<Double>;
   extern template class Vector<Complex>;
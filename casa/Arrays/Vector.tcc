@@ -35,6 +35,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <utility>
 #include <casacore/casa/iostream.h>
 
 namespace casacore { //#Begin casa namespace
@@ -124,6 +125,12 @@ template<class T> Vector<T>::Vector(const Vector<T> &other)
     DebugAssert(ok(), ArrayError);
 }
 
+template<class T> Vector<T>::Vector(Vector<T>&& other)
+: Array<T>(std::move(other))
+{
+    DebugAssert(ok(), ArrayError);
+}
+
 // <thrown>
 //    <item> ArrayNDimError
 // </thrown>
@@ -227,6 +234,18 @@ template<class T> Vector<T> &Vector<T>::operator=(const Vector<T> &other)
     return *this;
 }
 
+template<class T> Vector<T> &Vector<T>::operator=(Vector<T>&& other)
+{
+    DebugAssert(ok(), ArrayError);
+    if (this != &other) {
+        if (! this->moveStorage (other)) {
+            operator= (static_cast<const Vector<T>&>(other));
+        }
+        other.makeEmpty();
+    }
+    return *this;
+}
+
 // Copy a vector to a block. 
 template<class T> void Vector<T>::toBlock(Block<T> & other) const
 {
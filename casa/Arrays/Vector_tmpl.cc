@@ -37,6 +37,7 @@ namespace casacore {
   template class Vector<Int>;
   template class Vector<uInt>;
   template class Vector<Int64>;
+  template class Vector<uInt64>;
   template class Vector<Float>;
   template class Vector<Double>;
   template class Vector<Complex>;
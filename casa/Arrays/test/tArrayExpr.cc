@@ -0,0 +1,197 @@
+//# tArrayExpr.cc: Test program for the array expression templates
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# If AIPS_DEBUG is not set, the Assert's won't be called.
+#if !defined(AIPS_DEBUG)
+#define AIPS_DEBUG
+#endif
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayExpr.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Slice.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayError.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the lazily evaluated array expressions in ArrayExpr.h.
+// The results are compared with the eagerly evaluated ArrayMath results.
+// </summary>
+
+void testArithmetic()
+{
+  Vector<Double> a(10), b(10), c(10), d(10), e(10);
+  indgen (a, 1.);
+  indgen (b, 2., 0.5);
+  indgen (c, -3.);
+  indgen (d, 4., 2.);
+  e = 0.25;
+  // Conversion to Array evaluates the expression.
+  Array<Double> res = arrayExpr(a)*b + arrayExpr(c)*d - e;
+  AlwaysAssertExit (allNear (res, a*b + c*d - e, 1e-13));
+  // Scalars on both sides and unary minus.
+  Array<Double> res2 = 2. * arrayExpr(a) / 4 - (-arrayExpr(b)) + 1;
+  AlwaysAssertExit (allNear (res2, 2.*a/4. + b + 1., 1e-13));
+  // Array on the left side.
+  Vector<Double> res3 (a - arrayExpr(b) * c);
+  AlwaysAssertExit (allNear (res3, a - b*c, 1e-13));
+  // Evaluate into an existing array.
+  Vector<Double> res4(10);
+  (arrayExpr(a) + b).evaluate (res4);
+  AlwaysAssertExit (allNear (res4, a+b, 1e-13));
+  // Evaluate into an empty array resizes it.
+  Vector<Double> res5;
+  (arrayExpr(a) * 3.).evaluate (res5);
+  AlwaysAssertExit (res5.size() == 10  &&  allNear (res5, a*3., 1e-13));
+  // Compound assignments.
+  Vector<Double> res6 (a.copy());
+  res6 += arrayExpr(b) * c;
+  res6 -= arrayExpr(d) / 2.;
+  res6 *= arrayExpr(e) + 1.;
+  res6 /= arrayExpr(b) + 1.;
+  AlwaysAssertExit (allNear (res6, (a + b*c - d/2.) * (e+1.) / (b+1.),
+                             1e-13));
+  // Reduction.
+  AlwaysAssertExit (near (sum (square (arrayExpr(a) - b)),
+                          sum (square (a-b)), 1e-13));
+}
+
+void testFunctions()
+{
+  Vector<Double> a(8);
+  indgen (a, 0.1, 0.1);
+  AlwaysAssertExit (allNear (Array<Double>(sin(arrayExpr(a)) + cos(arrayExpr(a))),
+                             sin(a) + cos(a), 1e-13));
+  AlwaysAssertExit (allNear (Array<Double>(sqrt(exp(arrayExpr(a)) * 2.)),
+                             sqrt(exp(a) * 2.), 1e-13));
+  AlwaysAssertExit (allNear (Array<Double>(pow(arrayExpr(a), 2.5)),
+                             pow(a, 2.5), 1e-13));
+  AlwaysAssertExit (allNear (Array<Double>(atan2(arrayExpr(a), a+1.)),
+                             atan2(a, a+1.), 1e-13));
+  AlwaysAssertExit (allNear (Array<Double>(abs(arrayExpr(a) - 0.45)),
+                             abs(a - 0.45), 1e-13));
+  AlwaysAssertExit (allNear (Array<Double>(max(arrayExpr(a), 0.45) +
+                                           min(arrayExpr(a), 0.45)),
+                             a + 0.45, 1e-13));
+  AlwaysAssertExit (allNear (Array<Double>(cube(log(arrayExpr(a)))),
+                             cube(log(a)), 1e-13));
+  // Complex functions resulting in a real expression.
+  Vector<Complex> vis(5);
+  for (uInt i=0; i<vis.size(); ++i) {
+    vis[i] = Complex(i+1, 2-Float(i));
+  }
+  Array<Float> amp = amplitude (arrayExpr(vis) * Complex(2,1));
+  AlwaysAssertExit (allNear (amp, amplitude(vis * Complex(2,1)), 1e-6));
+  Array<Complex> cvis = conj (arrayExpr(vis)) * vis;
+  AlwaysAssertExit (allNear (cvis, conj(vis) * vis, 1e-6));
+  AlwaysAssertExit (allNear (Array<Float>(real (arrayExpr(vis))), real(vis),
+                             1e-6));
+  AlwaysAssertExit (allNear (Array<Float>(imag (arrayExpr(vis))), imag(vis),
+                             1e-6));
+  AlwaysAssertExit (allNear (Array<Float>(phase (arrayExpr(vis))), phase(vis),
+                             1e-6));
+}
+
+void testNonContiguous()
+{
+  Matrix<Float> m(6,5);
+  indgen (m);
+  // Slices as operands.
+  Matrix<Float> s1 = m(Slice(0,3,2), Slice(0,5));
+  Matrix<Float> s2 = m(Slice(1,3,2), Slice(0,5));
+  AlwaysAssertExit (!s1.contiguousStorage());
+  Array<Float> res = arrayExpr(s1) * s2 + s1;
+  AlwaysAssertExit (allEQ (res, s1*s2 + s1));
+  // Slice as result.
+  Matrix<Float> m2(6,5, 0.);
+  Matrix<Float> r = m2(Slice(0,3,2), Slice(0,5));
+  (arrayExpr(s1) + 1.f).evaluate (r);
+  AlwaysAssertExit (allEQ (r, s1 + 1.f));
+  AlwaysAssertExit (allEQ (m2(Slice(1,3,2), Slice(0,5)), 0.f));
+  // Result is the same array as an operand.
+  Matrix<Float> m3 (m.copy());
+  const Float* data = m3.data();
+  m3 *= arrayExpr(m3) + 1.f;
+  AlwaysAssertExit (m3.data() == data);
+  AlwaysAssertExit (allEQ (m3, m * (m+1.f)));
+  // Result overlaps partially with an operand.
+  Vector<Int> v(10);
+  indgen (v);
+  Vector<Int> vexp = v(Slice(1,9)) + 1;
+  Vector<Int> vres = v(Slice(0,9));
+  (arrayExpr(v(Slice(1,9))) + 1).evaluate (vres);
+  AlwaysAssertExit (allEQ (vres, vexp));
+  AlwaysAssertExit (v[8] == 10  &&  v[9] == 9);
+}
+
+void testErrors()
+{
+  Vector<Double> a(5, 1.), b(6, 1.);
+  Bool failed = False;
+  try {
+    arrayExpr(a) + b;
+  } catch (const ArrayConformanceError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  failed = False;
+  try {
+    Vector<Double> c(4);
+    (arrayExpr(a) * 2.).evaluate (c);
+  } catch (const ArrayConformanceError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  failed = False;
+  try {
+    b += arrayExpr(a);
+  } catch (const ArrayConformanceError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+int main()
+{
+  try {
+    testArithmetic();
+    testFunctions();
+    testNonContiguous();
+    testErrors();
+  } catch (const AipsError& x) {
+    cout << "\nCaught an unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
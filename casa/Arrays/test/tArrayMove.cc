@@ -0,0 +1,267 @@
+//# tArrayMove.cc: Test program for the move semantics of the Array classes
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# If AIPS_DEBUG is not set, the Assert's won't be called.
+#if !defined(AIPS_DEBUG)
+#define AIPS_DEBUG
+#endif
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/MaskedArray.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayError.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <utility>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the move constructors and move assignments of
+// Array, Vector, Matrix, Cube, MaskedArray and Block.
+// </summary>
+
+// Check that a moved-from array is empty, but kept its dimensionality.
+void checkMovedFrom (const ArrayBase& arr, uInt ndim)
+{
+  AlwaysAssertExit (arr.ndim() == ndim);
+  AlwaysAssertExit (arr.nelements() == 0);
+  AlwaysAssertExit (arr.shape() == IPosition(ndim, 0));
+  AlwaysAssertExit (arr.contiguousStorage());
+}
+
+void testArray()
+{
+  IPosition shape(3,4,5,6);
+  Array<Int> arr(shape);
+  indgen (arr);
+  const Int* data = arr.data();
+  // Move construction takes over the storage.
+  Array<Int> arr2 (std::move(arr));
+  AlwaysAssertExit (arr2.shape() == shape);
+  AlwaysAssertExit (arr2.data() == data);
+  AlwaysAssertExit (arr2.nrefs() == 1);
+  checkMovedFrom (arr, 3);
+  // A moved-from array can be used again.
+  arr.resize (shape);
+  arr = 3;
+  AlwaysAssertExit (allEQ (arr, 3));
+  // Move assignment to an empty array takes over the storage.
+  Array<Int> arr3;
+  arr3 = std::move(arr2);
+  AlwaysAssertExit (arr3.data() == data);
+  AlwaysAssertExit (arr3(IPosition(3,3,4,5)) == 119);
+  checkMovedFrom (arr2, 3);
+  // Move assignment to a non-empty array copies the values into it,
+  // so references to it see the new values.
+  Array<Int> ref(arr);
+  arr = std::move(arr3);
+  AlwaysAssertExit (arr.data() == ref.data());
+  AlwaysAssertExit (ref(IPosition(3,3,4,5)) == 119);
+  checkMovedFrom (arr3, 3);
+  // Move assignment of non-conforming arrays must fail.
+  Array<Int> arr4(IPosition(2,2,2), 1);
+  Bool failed = False;
+  try {
+    arr = std::move(arr4);
+  } catch (const ArrayConformanceError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  AlwaysAssertExit (arr4.shape() == IPosition(2,2,2));
+  // Moving a shared array (e.g. a slice) must copy the data.
+  Array<Int> arr5;
+  arr5 = arr(IPosition(3,0,0,0), IPosition(3,1,1,1));
+  AlwaysAssertExit (arr5.shape() == IPosition(3,2,2,2));
+  AlwaysAssertExit (arr5.nrefs() == 1);
+  arr5 = -1;
+  AlwaysAssertExit (arr(IPosition(3,0,0,0)) == 0);
+  // Self-assignment is a no-op.
+  Array<Int>& arr5ref = arr5;
+  arr5 = std::move(arr5ref);
+  AlwaysAssertExit (arr5.shape() == IPosition(3,2,2,2));
+  AlwaysAssertExit (allEQ (arr5, -1));
+  // Move an array of a non-trivial type.
+  Array<String> sarr(IPosition(1,3), "abc");
+  Array<String> sarr2 (std::move(sarr));
+  AlwaysAssertExit (allEQ (sarr2, String("abc")));
+  checkMovedFrom (sarr, 1);
+}
+
+void testVector()
+{
+  Vector<Double> vec(10);
+  indgen (vec);
+  const Double* data = vec.data();
+  Vector<Double> vec2 (std::move(vec));
+  AlwaysAssertExit (vec2.size() == 10  &&  vec2.data() == data);
+  AlwaysAssertExit (vec2[9] == 9);
+  checkMovedFrom (vec, 1);
+  Vector<Double> vec3;
+  vec3 = std::move(vec2);
+  AlwaysAssertExit (vec3.data() == data);
+  checkMovedFrom (vec2, 1);
+  // Assignment to a vector with a different length must fail.
+  Vector<Double> vec4(3, 1.);
+  Bool failed = False;
+  try {
+    vec3 = std::move(vec4);
+  } catch (const ArrayConformanceError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // A vector returned by a function is moved.
+  Vector<Double> vec5 = vec3 + 1.;
+  AlwaysAssertExit (vec5[9] == 10);
+  vec.resize (10);
+  vec = vec3 * 2.;
+  AlwaysAssertExit (vec[9] == 18);
+  // Move a vector through an Array reference.
+  Array<Double>& arr = vec2;
+  arr = std::move(vec5);
+  AlwaysAssertExit (vec2.size() == 10  &&  vec2[9] == 10);
+  checkMovedFrom (vec5, 1);
+}
+
+void testMatrixCube()
+{
+  Matrix<Float> mat(3,4);
+  indgen (mat);
+  Matrix<Float> mat2 (std::move(mat));
+  AlwaysAssertExit (mat2.shape() == IPosition(2,3,4));
+  AlwaysAssertExit (mat2(2,3) == 11);
+  checkMovedFrom (mat, 2);
+  Matrix<Float> mat3;
+  mat3 = std::move(mat2);
+  AlwaysAssertExit (mat3(1,2) == 7);
+  AlwaysAssertExit (mat3.row(1)(2) == 7);
+  checkMovedFrom (mat2, 2);
+  // Indexing in the moved-to matrix must be correct for a slice.
+  Matrix<Float> mat4;
+  mat4 = mat3(Slice(1,2), Slice(1,3));
+  AlwaysAssertExit (mat4.shape() == IPosition(2,2,3));
+  AlwaysAssertExit (mat4(1,2) == mat3(2,3));
+  // Moving a non-contiguous matrix not shared with another matrix
+  // takes over the storage.
+  Matrix<Float> mat5;
+  {
+    Matrix<Float> tmp(mat3.copy());
+    Matrix<Float> slice = tmp(Slice(1,2), Slice(1,3));
+    tmp.reference (Matrix<Float>());
+    AlwaysAssertExit (!slice.contiguousStorage());
+    const Float* data = slice.data();
+    mat5 = std::move(slice);
+    AlwaysAssertExit (mat5.data() == data);
+    checkMovedFrom (slice, 2);
+  }
+  AlwaysAssertExit (!mat5.contiguousStorage());
+  AlwaysAssertExit (allEQ (mat5, mat4));
+  AlwaysAssertExit (mat5(1,2) == mat3(2,3));
+  Cube<Int> cube(2,3,4);
+  indgen (cube);
+  Cube<Int> cube2 (std::move(cube));
+  AlwaysAssertExit (cube2(1,2,3) == 23);
+  checkMovedFrom (cube, 3);
+  Cube<Int> cube3;
+  cube3 = std::move(cube2);
+  AlwaysAssertExit (cube3(1,1,1) == 9);
+  AlwaysAssertExit (cube3.xyPlane(3)(1,2) == 23);
+  checkMovedFrom (cube2, 3);
+}
+
+void testMaskedArray()
+{
+  Vector<Int> vec(5);
+  indgen (vec);
+  MaskedArray<Int> marr (vec, vec > 1);
+  MaskedArray<Int> marr2 (std::move(marr));
+  AlwaysAssertExit (marr2.nelementsValid() == 3);
+  AlwaysAssertExit (marr2.getArray().data() == vec.data());
+  // Move assignment to an empty MaskedArray gets a copy of the data.
+  MaskedArray<Int> marr3;
+  marr3 = std::move(marr2);
+  AlwaysAssertExit (marr3.nelementsValid() == 3);
+  AlwaysAssertExit (marr3.getArray().data() != vec.data());
+  AlwaysAssertExit (allEQ (marr3.getArray(), vec));
+  // Move assignment of a MaskedArray owning its data takes it over.
+  MaskedArray<Int> marr4 (Array<Int>(IPosition(1,5), 2),
+                          LogicalArray(IPosition(1,5), True));
+  const Int* data = marr4.getArray().data();
+  MaskedArray<Int> marr5;
+  marr5 = std::move(marr4);
+  AlwaysAssertExit (marr5.getArray().data() == data);
+  // Move assignment to a non-empty MaskedArray copies the masked values.
+  MaskedArray<Int> marr6 (vec, vec > 2);
+  marr6 = std::move(marr5);
+  AlwaysAssertExit (vec[0] == 0  &&  vec[2] == 2);
+  AlwaysAssertExit (vec[3] == 2  &&  vec[4] == 2);
+}
+
+void testBlock()
+{
+  Block<Int> blk(10, 1);
+  const Int* data = blk.storage();
+  Block<Int> blk2 (std::move(blk));
+  AlwaysAssertExit (blk2.size() == 10  &&  blk2.storage() == data);
+  AlwaysAssertExit (blk.size() == 0  &&  blk.storage() == 0);
+  Block<Int> blk3(3, 2);
+  blk3 = std::move(blk2);
+  AlwaysAssertExit (blk3.size() == 10  &&  blk3.storage() == data);
+  AlwaysAssertExit (blk3[9] == 1);
+  AlwaysAssertExit (blk2.size() == 0  &&  blk2.storage() == 0);
+  // A moved-from block can be used again.
+  blk2.resize (5);
+  blk2 = 3;
+  AlwaysAssertExit (blk2[4] == 3);
+  Block<String> sblk(2, "a");
+  Block<String> sblk2;
+  sblk2 = std::move(sblk);
+  AlwaysAssertExit (sblk2.size() == 2  &&  sblk2[1] == "a");
+}
+
+int main()
+{
+  try {
+    testArray();
+    testVector();
+    testMatrixCube();
+    testMaskedArray();
+    testBlock();
+  } catch (const AipsError& x) {
+    cout << "\nCaught an unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,222 @@
+//# tArraySIMD.cc: Test program for the SIMD kernels of ArrayMath
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# If AIPS_DEBUG is not set, the Assert's won't be called.
+#if !defined(AIPS_DEBUG)
+#define AIPS_DEBUG
+#endif
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArraySIMD.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayPartMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <limits>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the SIMD kernels in ArraySIMD.
+// All kernels are tested for each level supported by the CPU and
+// compared with straightforward scalar loops.
+// </summary>
+
+// Fill with values that have no exact sum in the lower precision.
+template<typename T>
+void fillData (std::vector<T>& data, size_t n)
+{
+  data.resize (n);
+  for (size_t i=0; i<n; ++i) {
+    data[i] = T(((i*37) % 101) / 7.) - T(6);
+  }
+}
+
+template<typename T>
+void testReductions (Double tol)
+{
+  for (size_t offset=0; offset<3; ++offset) {
+    for (size_t n=0; n<260; n += (n<70 ? 1 : 37)) {
+      std::vector<T> vec;
+      fillData (vec, n+offset);
+      const T* data = vec.data() + offset;
+      Double sumE = 0, sumO = 0, sumSq = 0, sumDiff = 0;
+      const T base0 = T(1.5);
+      const T base1 = T(-0.25);
+      for (size_t i=0; i<n; ++i) {
+        (i%2 == 0 ? sumE : sumO) += data[i];
+        sumSq += Double(data[i]) * data[i];
+        Double diff = data[i] - (i%2 == 0 ? base0 : base1);
+        sumDiff += diff * diff;
+      }
+      T e, o;
+      ArraySIMD::sum (data, n, e, o);
+      AlwaysAssertExit (nearAbs (Double(e), sumE, tol));
+      AlwaysAssertExit (nearAbs (Double(o), sumO, tol));
+      AlwaysAssertExit (nearAbs (Double(ArraySIMD::sumSqr (data, n)),
+                                 sumSq, tol*10));
+      AlwaysAssertExit (nearAbs (Double(ArraySIMD::sumSqrDiff
+                                        (data, n, base0, base1)),
+                                 sumDiff, tol*10));
+      if (n > 0) {
+        T minv, maxv;
+        ArraySIMD::minMax (data, n, minv, maxv);
+        AlwaysAssertExit (minv == *std::min_element (data, data+n));
+        AlwaysAssertExit (maxv == *std::max_element (data, data+n));
+      }
+    }
+  }
+  // A NaN is ignored, unless it is the first value (as in a scalar loop).
+  std::vector<T> vec;
+  fillData (vec, 77);
+  vec[40] = std::numeric_limits<T>::quiet_NaN();
+  T minv, maxv;
+  ArraySIMD::minMax (vec.data(), vec.size(), minv, maxv);
+  AlwaysAssertExit (minv == -6  &&  maxv == T(100/7.) - T(6));
+  vec[0] = vec[40];
+  ArraySIMD::minMax (vec.data(), vec.size(), minv, maxv);
+  AlwaysAssertExit (isNaN(minv)  &&  isNaN(maxv));
+}
+
+template<typename T>
+void testTransform()
+{
+  for (size_t n=0; n<140; n += (n<40 ? 1 : 23)) {
+    std::vector<T> left, right, res(n);
+    fillData (left, n);
+    fillData (right, n+5);
+    for (size_t i=0; i<n; ++i) {
+      right[i] = right[i+5] + T(7);     // avoid zeroes
+    }
+    for (int op=ArraySIMD::Add; op<=ArraySIMD::Div; ++op) {
+      ArraySIMD::Oper oper = ArraySIMD::Oper(op);
+      ArraySIMD::transform (oper, left.data(), right.data(), res.data(), n);
+      for (size_t i=0; i<n; ++i) {
+        T l = left[i];
+        T r = right[i];
+        T exp = (op==ArraySIMD::Add ? l+r : op==ArraySIMD::Sub ? l-r :
+                 op==ArraySIMD::Mul ? l*r : l/r);
+        AlwaysAssertExit (res[i] == exp);
+      }
+      for (int sl=0; sl<2; ++sl) {
+        ArraySIMD::transform (oper, right.data(), T(3), T(-2), sl==1,
+                              res.data(), n);
+        for (size_t i=0; i<n; ++i) {
+          T l = (i%2 == 0 ? T(3) : T(-2));
+          T r = right[i];
+          if (sl == 0) {
+            std::swap (l, r);
+          }
+          T exp = (op==ArraySIMD::Add ? l+r : op==ArraySIMD::Sub ? l-r :
+                   op==ArraySIMD::Mul ? l*r : l/r);
+          AlwaysAssertExit (res[i] == exp);
+        }
+      }
+    }
+  }
+}
+
+// Test the use of the kernels in ArrayMath and ArrayPartMath.
+void testArrayMath()
+{
+  Vector<Float> vec(1001);
+  indgen (vec, -500.f);
+  AlwaysAssertExit (sum(vec) == 0);
+  AlwaysAssertExit (mean(vec) == 0);
+  AlwaysAssertExit (min(vec) == -500  &&  max(vec) == 500);
+  Vector<Double> dvec(1001);
+  indgen (dvec, -500.);
+  AlwaysAssertExit (near (variance(dvec), 83583.5, 1e-13));
+  AlwaysAssertExit (near (rms(dvec), sqrt(83500.), 1e-13));
+  AlwaysAssertExit (near (variance(vec), 83583.5f, 1e-5));
+  AlwaysAssertExit (allEQ (vec + vec, vec * 2.f));
+  AlwaysAssertExit (allEQ (1.f - vec, -(vec - 1.f)));
+  Vector<Float> vec2(vec.copy());
+  vec2 += vec;
+  vec2 /= 2.f;
+  AlwaysAssertExit (allEQ (vec2, vec));
+  // Complex arrays.
+  Vector<Complex> cvec(101);
+  for (uInt i=0; i<cvec.size(); ++i) {
+    cvec[i] = Complex(i, -2*Float(i));
+  }
+  AlwaysAssertExit (sum(cvec) == Complex(5050, -10100));
+  AlwaysAssertExit (mean(cvec) == Complex(50, -100));
+  AlwaysAssertExit (near (real(pvariance(cvec, 0)), 4250.f, 1e-6));
+  AlwaysAssertExit (allEQ (cvec + Complex(1,1) - cvec,
+                           Complex(1,1)));
+  AlwaysAssertExit (allEQ (Complex(2,3) - cvec, -(cvec - Complex(2,3))));
+  // A partially overlapping in-place operation uses the scalar loop.
+  Vector<Double> ovec(10, 1.);
+  Vector<Double> part1 (ovec(Slice(1,9)));
+  Vector<Double> part2 (ovec(Slice(0,9)));
+  part1 += part2;
+  AlwaysAssertExit (ovec[9] == 10);
+  // Partial sums and means.
+  Cube<Double> cube(7,9,5);
+  indgen (cube);
+  Array<Double> sums = partialSums (cube, IPosition(2,0,1));
+  Array<Double> means = partialMeans (cube, IPosition(1,2));
+  for (uInt k=0; k<5; ++k) {
+    AlwaysAssertExit (near (sums(IPosition(1,k)),
+                            sum(cube.xyPlane(k)), 1e-13));
+  }
+  AlwaysAssertExit (near (means(IPosition(2,3,4)), cube(3,4,2), 1e-13));
+  Array<Double> sums2 = partialSums (cube, IPosition(1,2));
+  AlwaysAssertExit (near (sums2(IPosition(2,6,8)),
+                          5*cube(6,8,2), 1e-13));
+}
+
+int main()
+{
+  try {
+    ArraySIMD::Level supported = ArraySIMD::supportedLevel();
+    AlwaysAssertExit (ArraySIMD::level() == supported);
+    for (int level=ArraySIMD::NoSIMD; level<=supported; ++level) {
+      ArraySIMD::setLevel (ArraySIMD::Level(level));
+      AlwaysAssertExit (ArraySIMD::level() == level);
+      testReductions<Float> (1e-3);
+      testReductions<Double> (1e-10);
+      testTransform<Float>();
+      testTransform<Double>();
+      testArrayMath();
+    }
+    // The level cannot exceed the supported level.
+    ArraySIMD::setLevel (ArraySIMD::AVX512);
+    AlwaysAssertExit (ArraySIMD::level() == supported);
+  } catch (const AipsError& x) {
+    cout << "\nCaught an unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -29,6 +29,7 @@
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayError.h>
 #include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/MatrixMath.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Utilities/Regex.h>
 #include <casacore/casa/OS/Timer.h>
@@ -332,6 +333,66 @@ Bool testReorderArray (Bool doExcp)
       }
     }
   }
+  {
+    cout << "arrayReorder 3D blocked..." << endl;
+    // Use axes exceeding the block size, also for a non-contiguous array.
+    IPosition shape(3,70,3,130);
+    Array<Int> arrFull(shape+1);
+    indgen (arrFull);
+    for (Int k=0; k<2; k++) {
+      Array<Int> arr (arrFull(IPosition(3,k), shape-1+k));
+      for (Int j0=0; j0<3; j0++) {
+        for (Int j1=0; j1<3; j1++) {
+          if (j1 != j0) {
+            IPosition axisOrder(3, j0, j1, 3-j0-j1);
+            Array<Int> res = reorderArray (arr, axisOrder);
+            const IPosition& resShape = res.shape();
+            IPosition posOld(3);
+            IPosition posNew(3);
+            for (Int i2=0; i2<resShape(2); i2++) {
+              posNew(2) = i2;
+              posOld(axisOrder(2)) = i2;
+              for (Int i1=0; i1<resShape(1); i1++) {
+                posNew(1) = i1;
+                posOld(axisOrder(1)) = i1;
+                for (Int i0=0; i0<resShape(0); i0++) {
+                  posNew(0) = i0;
+                  posOld(axisOrder(0)) = i0;
+                  if (arr(posOld) != res(posNew)) {
+                    ok = False;
+                    cout << "for shape " << shape << resShape
+                         << ", axisorder " << axisOrder << endl;
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  {
+    cout << "transpose..." << endl;
+    Matrix<DComplex> mat(130, 67);
+    for (uInt j=0; j<mat.ncolumn(); j++) {
+      for (uInt i=0; i<mat.nrow(); i++) {
+        mat(i,j) = DComplex(i, j);
+      }
+    }
+    Matrix<DComplex> matT = transpose(mat);
+    if (matT.shape() != IPosition(2,67,130)) {
+      ok = False;
+      cout << "transposed shape " << matT.shape() << " is incorrect" << endl;
+    }
+    for (uInt j=0; j<mat.ncolumn(); j++) {
+      for (uInt i=0; i<mat.nrow(); i++) {
+        if (matT(j,i) != mat(i,j)) {
+          ok = False;
+          cout << "transpose incorrect for " << i << ',' << j << endl;
+        }
+      }
+    }
+  }
   if (doExcp) {
     try {
       reorderArray (Array<Int>(IPosition(2,3,4)), IPosition(2,1,1));
@@ -32,6 +32,7 @@
 #include <casacore/casa/config.h>
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Utilities/DataType.h>
+#include <casacore/casa/Containers/MemoryArena.h>
 
 #include <cstdlib>
 #include <memory>
@@ -206,6 +207,64 @@ inline bool operator!=(const new_del_allocator<T>&,
   return false;
 }
 
+// An allocator taking memory from the current MemoryArena of the thread,
+// or from the heap if the thread has no current arena.
+// The memory is aligned on <src>MemoryArena::Alignment</src> bytes.
+template<typename T>
+struct arena_allocator: public std11_allocator<T> {
+  typedef std11_allocator<T> Super;
+  typedef typename Super::size_type size_type;
+  typedef typename Super::difference_type difference_type;
+  typedef typename Super::pointer pointer;
+  typedef typename Super::const_pointer const_pointer;
+  typedef typename Super::reference reference;
+  typedef typename Super::const_reference const_reference;
+  typedef typename Super::value_type value_type;
+
+  static constexpr size_t alignment = MemoryArena::Alignment;
+
+  template<typename TOther>
+  struct rebind {
+    typedef arena_allocator<TOther> other;
+  };
+  arena_allocator() noexcept {
+  }
+
+  arena_allocator(const arena_allocator&other) noexcept
+  :Super(other) {
+  }
+
+  template<typename TOther>
+  arena_allocator(const arena_allocator<TOther>&) noexcept {
+  }
+
+  ~arena_allocator() noexcept {
+  }
+
+  pointer allocate(size_type elements, const void* = 0) {
+    if (elements > this->max_size()) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(MemoryArena::allocateCurrent(sizeof(T) * elements));
+  }
+
+  void deallocate(pointer ptr, size_type) {
+    MemoryArena::deallocate(ptr);
+  }
+};
+
+template<typename T>
+inline bool operator==(const arena_allocator<T>&,
+    const arena_allocator<T>&) {
+  return true;
+}
+
+template<typename T>
+inline bool operator!=(const arena_allocator<T>&,
+    const arena_allocator<T>&) {
+  return false;
+}
+
 template<typename T> class Array;
 template<typename T> class Block;
 
@@ -401,6 +460,22 @@ protected:
 template<typename T>
 DefaultAllocator<T> DefaultAllocator<T>::value;
 
+// An allocator which allocates from the current MemoryArena of the thread.
+// It is meant for short-lived temporaries created within a
+// <src>MemoryArena::Scope</src>. Outside a scope it allocates from the heap.
+// The memory is aligned on 64 bytes.
+template<typename T>
+class ArenaAllocator: public BaseAllocator<T, ArenaAllocator<T> > {
+public:
+  typedef arena_allocator<T> type;
+  // an instance of this allocator.
+  static ArenaAllocator<T> value;
+protected:
+  ArenaAllocator(){}
+};
+template<typename T>
+ArenaAllocator<T> ArenaAllocator<T>::value;
+
 // <summary>Allocator specifier</summary>
 // <synopsis>
 // This class is just used to avoid ambiguity between overloaded functions.
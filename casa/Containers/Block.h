@@ -345,6 +345,43 @@ public:
     return *this;
   }
   
+  // Move the other block into this one. The storage of <src>other</src>
+  // is taken over (not copied), so thereafter <src>other</src> is empty.
+  Block(Block<T> &&other) :
+      allocator_p(other.allocator_p), capacity_p(other.capacity_p),
+      used_p(other.used_p), array(other.array),
+      destroyPointer(other.destroyPointer), keep_allocator_p(False) {
+    other.capacity_p = 0;
+    other.used_p = 0;
+    other.array = 0;
+    other.destroyPointer = True;
+  }
+
+  // Move other to this. The storage of <src>other</src> is taken over,
+  // unless this Block has to keep an allocator differing from the one of
+  // <src>other</src>, in which case the values are copied.
+  // Thereafter <src>other</src> is empty.
+  Block<T> &operator=(Block<T> &&other) {
+    if (&other != this) {
+      if (keep_allocator_p  &&  allocator_p != other.allocator_p) {
+        operator= (static_cast<const Block<T>&>(other));
+        other.deinit();
+      } else {
+        deinit();
+        allocator_p = other.allocator_p;
+        capacity_p = other.capacity_p;
+        used_p = other.used_p;
+        array = other.array;
+        destroyPointer = other.destroyPointer;
+      }
+      other.capacity_p = 0;
+      other.used_p = 0;
+      other.array = 0;
+      other.destroyPointer = True;
+    }
+    return *this;
+  }
+
   // Frees up the storage pointed contained in the Block.
   ~Block() {
     deinit();
@@ -854,6 +891,7 @@ public:
   extern template class Block<Int>;
   extern template class Block<uInt>;
   extern template class Block<Int64>;
+  extern template class Block<uInt64>;
   extern template class Block<Float>;
   extern template class Block<Double>;
   extern template class Block<Complex>;
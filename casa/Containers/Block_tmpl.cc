@@ -37,6 +37,7 @@ namespace casacore {
   template class Block<Int>;
   template class Block<uInt>;
   template class Block<Int64>;
+  template class Block<uInt64>;
   template class Block<Float>;
   template class Block<Double>;
   template class Block<Complex>;
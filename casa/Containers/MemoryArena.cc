@@ -0,0 +1,175 @@
+//# MemoryArena.cc: Bump allocator for short-lived temporaries
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/Containers/MemoryArena.h>
+#include <cstdlib>
+#include <new>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+thread_local MemoryArena* MemoryArena::theirCurrent = 0;
+
+// Each allocation is preceded by a header of Alignment bytes containing
+// the pointer to the chunk it is part of (0 if allocated from the heap).
+
+MemoryArena::Scope::Scope (MemoryArena& arena, Bool resetAtExit)
+  : itsArena    (arena),
+    itsPrevious (theirCurrent),
+    itsReset    (resetAtExit)
+{
+  theirCurrent = &arena;
+}
+
+MemoryArena::Scope::~Scope()
+{
+  theirCurrent = itsPrevious;
+  if (itsReset) {
+    itsArena.reset();
+  }
+}
+
+
+MemoryArena::MemoryArena (size_t chunkSize)
+  : itsCurChunk (0),
+    itsOffset   (0),
+    itsNUsed    (0)
+{
+  // Use a multiple of the alignment and at least a page.
+  if (chunkSize < 4096) {
+    chunkSize = 4096;
+  }
+  itsChunkSize = (chunkSize + Alignment - 1) / Alignment * Alignment;
+}
+
+MemoryArena::~MemoryArena()
+{
+  if (theirCurrent == this) {
+    theirCurrent = 0;
+  }
+  for (size_t i=0; i<itsChunks.size(); ++i) {
+    unref (itsChunks[i]);
+  }
+}
+
+MemoryArena::Chunk* MemoryArena::newChunk()
+{
+  void* mem = 0;
+  if (posix_memalign (&mem, Alignment, Alignment + itsChunkSize) != 0) {
+    throw std::bad_alloc();
+  }
+  Chunk* chunk = new (mem) Chunk;
+  chunk->nref.store (1, std::memory_order_relaxed);
+  return chunk;
+}
+
+void* MemoryArena::allocate (size_t nbytes)
+{
+  size_t total = Alignment + (nbytes + Alignment - 1) / Alignment * Alignment;
+  // Large allocations are taken from the heap.
+  if (total > itsChunkSize/2) {
+    return allocateHeap (nbytes);
+  }
+  if (itsChunks.empty()  ||  itsOffset + total > itsChunkSize) {
+    // Use the next chunk, which can be one kept by reset.
+    if (! itsChunks.empty()) {
+      itsCurChunk++;
+    }
+    if (itsCurChunk >= itsChunks.size()) {
+      itsChunks.push_back (newChunk());
+      itsCurChunk = itsChunks.size() - 1;
+    }
+    itsOffset = 0;
+  }
+  Chunk* chunk = itsChunks[itsCurChunk];
+  char* header = reinterpret_cast<char*>(chunk) + Alignment + itsOffset;
+  *reinterpret_cast<Chunk**>(header) = chunk;
+  chunk->nref.fetch_add (1, std::memory_order_relaxed);
+  itsOffset += total;
+  itsNUsed  += total;
+  return header + Alignment;
+}
+
+void MemoryArena::reset()
+{
+  // Keep the chunks not containing allocations anymore; the arena is
+  // the only one referencing them, so their count cannot change.
+  size_t nkeep = 0;
+  for (size_t i=0; i<itsChunks.size(); ++i) {
+    if (itsChunks[i]->nref.load (std::memory_order_acquire) == 1) {
+      itsChunks[nkeep++] = itsChunks[i];
+    } else {
+      unref (itsChunks[i]);
+    }
+  }
+  itsChunks.resize (nkeep);
+  itsCurChunk = 0;
+  itsOffset   = 0;
+  itsNUsed    = 0;
+}
+
+void* MemoryArena::allocateHeap (size_t nbytes)
+{
+  void* mem = 0;
+  if (posix_memalign (&mem, Alignment, Alignment + nbytes) != 0) {
+    throw std::bad_alloc();
+  }
+  char* header = static_cast<char*>(mem);
+  *reinterpret_cast<Chunk**>(header) = 0;
+  return header + Alignment;
+}
+
+void* MemoryArena::allocateCurrent (size_t nbytes)
+{
+  if (theirCurrent) {
+    return theirCurrent->allocate (nbytes);
+  }
+  return allocateHeap (nbytes);
+}
+
+void MemoryArena::deallocate (void* ptr)
+{
+  if (ptr) {
+    char* header = static_cast<char*>(ptr) - Alignment;
+    Chunk* chunk = *reinterpret_cast<Chunk**>(header);
+    if (chunk) {
+      unref (chunk);
+    } else {
+      free (header);
+    }
+  }
+}
+
+void MemoryArena::unref (Chunk* chunk)
+{
+  if (chunk->nref.fetch_sub (1, std::memory_order_acq_rel) == 1) {
+    chunk->~Chunk();
+    free (chunk);
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,196 @@
+//# MemoryArena.h: Bump allocator for short-lived temporaries
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_MEMORYARENA_H
+#define CASA_MEMORYARENA_H
+
+#include <casacore/casa/aips.h>
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Bump allocator for short-lived temporaries
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tMemoryArena">
+// </reviewed>
+
+// <synopsis>
+// A MemoryArena hands out memory from large chunks by simply bumping
+// a pointer. Individual deallocations do not make the memory available
+// again; instead all memory is released at once by function
+// <src>reset</src>, after which the chunks are reused. In this way a
+// processing loop (e.g. over the chunks of an MS or the tiles of a lattice)
+// allocating many temporary arrays does not need malloc and free at all
+// after the first iteration, and does not fragment the heap.
+// <br>All memory is aligned on <src>MemoryArena::Alignment</src> (64) bytes,
+// which is the cache line size and suits all SIMD instruction sets.
+// <p>
+// An arena is used by the allocator <linkto class=ArenaAllocator>
+// ArenaAllocator</linkto> after it has been made the current arena of
+// a thread by creating a <src>MemoryArena::Scope</src> object. If no arena
+// is current, ArenaAllocator allocates from the heap. Thus only arrays
+// created with ArenaAllocator within the scope are allocated in the arena.
+// By default the arena is reset when the scope ends.
+// <p>
+// It is safe to keep an array allocated in an arena beyond a reset
+// or beyond the lifetime of the arena, or to free it in another thread.
+// Each allocation records the chunk it was taken from and a chunk
+// is counted. A chunk still containing allocations is not reused by
+// <src>reset</src>, but it is released when its last allocation is freed.
+// <br>Allocations larger than half the chunk size are taken from the heap.
+// <p>
+// An arena can only be used for allocations by a single thread at a time,
+// so usually each thread has its own arena.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   MemoryArena arena;
+//   for (...) {
+//     // Make the arena current for this thread; reset it at end of scope.
+//     MemoryArena::Scope scope(arena);
+//     Array<Complex> tmp(shape, ArrayInitPolicies::NO_INIT,
+//                        ArenaAllocator<Complex>::value);
+//     Block<Int> counts(n, 0, AllocSpec<ArenaAllocator<Int> >::value);
+//     ...
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Per-chunk calibration loops allocate and free thousands of temporary
+// arrays. The heap allocations showed up in profiles and fragmentation
+// of the heap inflated the memory use of long runs.
+// </motivation>
+
+class MemoryArena
+{
+public:
+  // The alignment of all memory handed out.
+  enum {Alignment = 64};
+
+  // Make the given arena the current arena of this thread for
+  // the lifetime of the Scope object. Scopes can be nested; the previous
+  // current arena is restored at the end of the scope.
+  // If <src>resetAtExit</src> is True, the arena is reset at the end
+  // of the scope.
+  class Scope
+  {
+  public:
+    explicit Scope (MemoryArena& arena, Bool resetAtExit=True);
+    ~Scope();
+  private:
+    Scope (const Scope&);
+    Scope& operator= (const Scope&);
+
+    MemoryArena& itsArena;
+    MemoryArena* itsPrevious;
+    Bool         itsReset;
+  };
+
+  // Create the arena with the given chunk size (in bytes).
+  // No memory is allocated until needed.
+  explicit MemoryArena (size_t chunkSize = 1024*1024);
+
+  // Release the memory. Chunks still containing allocations are
+  // released when their last allocation is freed.
+  ~MemoryArena();
+
+  // Allocate the given number of bytes aligned on <src>Alignment</src>.
+  // It throws std::bad_alloc if no memory can be allocated.
+  void* allocate (size_t nbytes);
+
+  // Release all memory at once. Chunks containing allocations not freed
+  // yet are given up; the others are kept for reuse.
+  void reset();
+
+  // Get the chunk size.
+  size_t chunkSize() const
+    { return itsChunkSize; }
+
+  // Get the number of bytes handed out from the chunks since the last reset
+  // (including the alignment padding).
+  size_t nbytesUsed() const
+    { return itsNUsed; }
+
+  // Get the total size of the chunks held by the arena.
+  size_t nbytesReserved() const
+    { return itsChunks.size() * itsChunkSize; }
+
+  // Get the current arena of this thread (0 if none).
+  static MemoryArena* current()
+    { return theirCurrent; }
+
+  // Allocate from the current arena of this thread if there is one,
+  // otherwise from the heap. The memory is aligned on <src>Alignment</src>.
+  static void* allocateCurrent (size_t nbytes);
+
+  // Free memory allocated by <src>allocate</src> or
+  // <src>allocateCurrent</src>. A null pointer is ignored.
+  // It can be done in any thread.
+  static void deallocate (void* ptr);
+
+private:
+  // The header of a chunk; the data follow after <src>Alignment</src> bytes.
+  // The reference count contains the number of allocations plus one
+  // for the arena itself.
+  struct Chunk {
+    std::atomic<size_t> nref;
+  };
+
+  // Forbid copy.
+  MemoryArena (const MemoryArena&);
+  MemoryArena& operator= (const MemoryArena&);
+
+  // Allocate a new chunk.
+  Chunk* newChunk();
+
+  // Allocate from the heap with a header telling it is not in a chunk.
+  static void* allocateHeap (size_t nbytes);
+
+  // Decrement the reference count of a chunk and free it if zero.
+  static void unref (Chunk* chunk);
+
+  //# Data members.
+  size_t              itsChunkSize;
+  std::vector<Chunk*> itsChunks;
+  size_t              itsCurChunk;
+  size_t              itsOffset;
+  size_t              itsNUsed;
+  static thread_local MemoryArena* theirCurrent;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
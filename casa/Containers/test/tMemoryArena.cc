@@ -0,0 +1,167 @@
+//# tMemoryArena.cc: Test program for class MemoryArena and ArenaAllocator
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/MemoryArena.h>
+#include <casacore/casa/Containers/Allocator.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class MemoryArena and ArenaAllocator.
+// </summary>
+
+Bool isAligned (const void* ptr)
+{
+  return reinterpret_cast<size_t>(ptr) % MemoryArena::Alignment == 0;
+}
+
+void testArena()
+{
+  MemoryArena arena(8192);
+  AlwaysAssertExit (arena.chunkSize() == 8192);
+  AlwaysAssertExit (arena.nbytesReserved() == 0);
+  // Allocate a few small pieces; they are aligned and follow each other.
+  char* p1 = static_cast<char*>(arena.allocate (10));
+  char* p2 = static_cast<char*>(arena.allocate (100));
+  AlwaysAssertExit (isAligned(p1)  &&  isAligned(p2));
+  AlwaysAssertExit (p2 == p1 + 2*MemoryArena::Alignment);
+  AlwaysAssertExit (arena.nbytesUsed() == 5*MemoryArena::Alignment);
+  AlwaysAssertExit (arena.nbytesReserved() == 8192);
+  // Fill the first chunk, so a second one is needed.
+  for (int i=0; i<50; ++i) {
+    MemoryArena::deallocate (arena.allocate (100));
+  }
+  AlwaysAssertExit (arena.nbytesReserved() == 2*8192);
+  // A large allocation comes from the heap.
+  void* p3 = arena.allocate (5000);
+  AlwaysAssertExit (isAligned(p3));
+  AlwaysAssertExit (arena.nbytesReserved() == 2*8192);
+  MemoryArena::deallocate (p3);
+  // After a reset the first chunk is still in use, so it is given up.
+  // The second chunk is reused.
+  arena.reset();
+  AlwaysAssertExit (arena.nbytesUsed() == 0);
+  AlwaysAssertExit (arena.nbytesReserved() == 8192);
+  char* p4 = static_cast<char*>(arena.allocate (10));
+  AlwaysAssertExit (p4 != p1);
+  // The given up chunk is released after its last allocation is freed.
+  MemoryArena::deallocate (p1);
+  MemoryArena::deallocate (p2);
+  MemoryArena::deallocate (p4);
+  MemoryArena::deallocate (0);
+  arena.reset();
+  AlwaysAssertExit (arena.nbytesReserved() == 8192);
+  void* p5 = arena.allocate (10);
+  AlwaysAssertExit (p5 == p4);
+  MemoryArena::deallocate (p5);
+}
+
+void testScope()
+{
+  MemoryArena arena;
+  MemoryArena arena2;
+  AlwaysAssertExit (MemoryArena::current() == 0);
+  {
+    MemoryArena::Scope scope(arena);
+    AlwaysAssertExit (MemoryArena::current() == &arena);
+    MemoryArena::deallocate (MemoryArena::allocateCurrent (16));
+    AlwaysAssertExit (arena.nbytesUsed() > 0);
+    {
+      MemoryArena::Scope scope2(arena2, False);
+      AlwaysAssertExit (MemoryArena::current() == &arena2);
+      MemoryArena::deallocate (MemoryArena::allocateCurrent (16));
+    }
+    AlwaysAssertExit (MemoryArena::current() == &arena);
+    AlwaysAssertExit (arena2.nbytesUsed() > 0);
+  }
+  AlwaysAssertExit (MemoryArena::current() == 0);
+  AlwaysAssertExit (arena.nbytesUsed() == 0);
+  // Outside a scope the heap is used.
+  void* ptr = MemoryArena::allocateCurrent (16);
+  AlwaysAssertExit (isAligned(ptr));
+  AlwaysAssertExit (arena.nbytesUsed() == 0);
+  MemoryArena::deallocate (ptr);
+}
+
+void testArray()
+{
+  MemoryArena arena;
+  Array<Float> keep;
+  for (Int iter=0; iter<3; ++iter) {
+    MemoryArena::Scope scope(arena);
+    Array<Float> arr(IPosition(2,10,20), ArrayInitPolicies::NO_INIT,
+                     ArenaAllocator<Float>::value);
+    AlwaysAssertExit (isAligned(arr.data()));
+    AlwaysAssertExit (arena.nbytesUsed() > 0);
+    indgen (arr);
+    Array<Float> arr2(IPosition(2,10,20), ArrayInitPolicies::INIT,
+                      ArenaAllocator<Float>::value);
+    AlwaysAssertExit (allEQ (arr2, Float(0)));
+    arr2 += arr;
+    AlwaysAssertExit (arr2(IPosition(2,9,19)) == 199);
+    // Copy an array in the arena.
+    Array<Float> arr3 (arr.copy());
+    AlwaysAssertExit (allEQ (arr3, arr));
+    Block<String> blk(5, "abc", AllocSpec<ArenaAllocator<String> >::value);
+    AlwaysAssertExit (blk[4] == "abc");
+    Block<Int> blk2(100, AllocSpec<ArenaAllocator<Int> >::value);
+    AlwaysAssertExit (isAligned(blk2.storage()));
+    // An array can outlive the scope.
+    if (iter == 1) {
+      keep.reference (arr);
+    }
+  }
+  AlwaysAssertExit (keep(IPosition(2,9,19)) == 199);
+  AlwaysAssertExit (arena.nbytesUsed() == 0);
+  // Outside a scope the heap is used.
+  Array<Int> arr4(IPosition(1,5), ArrayInitPolicies::INIT,
+                  ArenaAllocator<Int>::value);
+  AlwaysAssertExit (allEQ (arr4, 0));
+  AlwaysAssertExit (arena.nbytesUsed() == 0);
+}
+
+int main()
+{
+  try {
+    testArena();
+    testScope();
+    testArray();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
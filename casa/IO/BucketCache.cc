@@ -28,8 +28,11 @@
 
 //# Includes
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -61,6 +64,9 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
   its_LRU           (cacheSize, uInt(0)),
   its_LRUCounter    (0),
   its_Buffer        (0),
+  its_ReadAhead     (0),
+  its_LengthCallBack(0),
+  its_AllocateCallBack(0),
   its_NrOfFree      (0),
   its_FirstFree     (-1)
 {
@@ -89,6 +95,12 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
 	    its_CurNrOfBuckets = its_NewNrOfBuckets;
 	}
     }
+    // Default is no read-ahead.
+    Int readAhead;
+    AipsrcValue<Int>::find (readAhead, "table.cache.readahead", 0);
+    if (readAhead > 0) {
+        setReadAhead (readAhead);
+    }
 }
 
 BucketCache::~BucketCache()
@@ -97,6 +109,7 @@ BucketCache::~BucketCache()
     // It is not flushed (that should have been done before).
     // In that way no needless flushes are done for a temporary table.
     clear (0, False);
+    delete its_ReadAhead;
     delete [] its_Buffer;
 }
 
@@ -113,6 +126,9 @@ void BucketCache::clear (uInt fromSlot, Bool doFlush)
     if (fromSlot == 0) {
 	its_LRUCounter = 0;
 	initStatistics();
+        if (its_ReadAhead) {
+            its_ReadAhead->clear();
+        }
     }
     if (fromSlot < its_CacheSizeUsed) {
 	its_CacheSizeUsed = fromSlot;
@@ -122,7 +138,8 @@ void BucketCache::clear (uInt fromSlot, Bool doFlush)
 Bool BucketCache::flush (uInt fromSlot)
 {
     // Initialize remaining buckets when everything has to be flushed.
-    if (fromSlot == 0  &&  its_NewNrOfBuckets > 0) {
+    // Variable-length buckets not written are left out of the file.
+    if (fromSlot == 0  &&  its_NewNrOfBuckets > 0  &&  !isVariableLength()) {
 	initializeBuckets (its_NewNrOfBuckets - 1);
     }
     Bool hasWritten = False;
@@ -182,6 +199,46 @@ void BucketCache::resync (uInt nrBucket, uInt nrOfFreeBucket,
 }
 
 
+void BucketCache::setReadAhead (uInt maxNrBuckets)
+{
+    delete its_ReadAhead;
+    its_ReadAhead = 0;
+    if (maxNrBuckets > 0  &&  its_file->canReadParallel()  &&
+        !isVariableLength()) {
+        its_ReadAhead = new BucketReadAhead (its_file, its_StartOffset,
+                                             its_BucketSize, maxNrBuckets);
+    }
+}
+
+void BucketCache::setVariableLength (const Block<Int64>& offsets,
+                                     const Block<uInt>& lengths,
+                                     BucketCacheLength lengthCallBack,
+                                     BucketCacheAllocate allocateCallBack)
+{
+    // Do not flush, because the buckets are laid out differently.
+    clear (0, False);
+    setReadAhead (0);
+    its_LengthCallBack   = lengthCallBack;
+    its_AllocateCallBack = allocateCallBack;
+    its_Offsets.resize (its_SlotNr.nelements(), True, False);
+    its_Lengths.resize (its_SlotNr.nelements(), True, False);
+    for (uInt i=0; i<its_Offsets.nelements(); i++) {
+        if (i < offsets.nelements()) {
+            its_Offsets[i] = offsets[i];
+            its_Lengths[i] = lengths[i];
+        } else {
+            its_Offsets[i] = -1;
+            its_Lengths[i] = 0;
+        }
+    }
+    // The buckets in the file are the ones already written.
+    its_CurNrOfBuckets = 0;
+    while (its_CurNrOfBuckets < its_NewNrOfBuckets  &&
+           its_Offsets[its_CurNrOfBuckets] >= 0) {
+        its_CurNrOfBuckets++;
+    }
+}
+
 uInt BucketCache::nBucket() const
 {
     return its_NewNrOfBuckets;
@@ -220,7 +277,11 @@ char* BucketCache::getBucket (uInt bucketNr)
     // Not in cache, so get a slot.
     // Read the bucket when it is already in the file.
     // Otherwise get a new initialized bucket.
-    if (bucketNr < its_CurNrOfBuckets) {
+    // A variable-length bucket not written yet is initialized by readBucket.
+    if (bucketNr < its_CurNrOfBuckets  ||  isVariableLength()) {
+        if (its_ReadAhead) {
+            its_ReadAhead->access (bucketNr, its_CurNrOfBuckets, its_SlotNr);
+        }
 	getSlot (bucketNr);
 	readBucket (its_ActualSlot);
     }else{
@@ -234,6 +295,91 @@ char* BucketCache::getBucket (uInt bucketNr)
     return its_Cache[its_ActualSlot];
 }
 
+Bool BucketCache::readBuckets (const Block<uInt>& bucketNrs, uInt nthreads)
+{
+    if (nthreads <= 1  ||  !its_file->canReadParallel()) {
+        return False;
+    }
+    // First mark the buckets already in the cache as used, so they are
+    // not removed from the cache to make room for the others.
+    for (uInt i=0; i<bucketNrs.size(); ++i) {
+        uInt bucketNr = bucketNrs[i];
+        if (bucketNr < its_CurNrOfBuckets  &&  its_SlotNr[bucketNr] >= 0) {
+            its_ActualSlot = its_SlotNr[bucketNr];
+            setLRU();
+        }
+    }
+    // Determine the buckets to read (at most the cache size).
+    // Get a slot for them; the LRU ensures they do not reuse each other's.
+    Bool allCached = (bucketNrs.size() <= its_CacheSize);
+    Block<uInt> slots(std::min (size_t(its_CacheSize), bucketNrs.size()));
+    uInt nr = 0;
+    for (uInt i=0; i<bucketNrs.size()  &&  nr<slots.size(); ++i) {
+        uInt bucketNr = bucketNrs[i];
+        if (bucketNr >= its_CurNrOfBuckets  ||
+            (isVariableLength()  &&  its_Offsets[bucketNr] < 0)) {
+            allCached = False;
+        } else if (its_SlotNr[bucketNr] < 0) {
+            getSlot (bucketNr);
+            slots[nr++] = its_ActualSlot;
+            if (its_ReadAhead) {
+                its_ReadAhead->discard (bucketNr);
+            }
+        }
+    }
+    if (nr == 0) {
+        return allCached;
+    }
+    if (nr < nthreads) {
+        nthreads = nr;
+    }
+    // Read and convert the buckets in parallel.
+    // Exceptions cannot leave a parallel region, so keep the first message.
+    String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+    {
+        std::vector<char> buffer(its_BucketSize);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (Int i=0; i<Int(nr); ++i) {
+            uInt slotNr = slots[i];
+            try {
+                Int64 offset;
+                uInt  length;
+                getLocation (its_BucketNr[slotNr], offset, length);
+                its_file->pread (buffer.data(), length, offset);
+                its_Cache[slotNr] = its_ReadCallBack (its_Owner,
+                                                      buffer.data());
+            } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(BucketCache_readBuckets)
+#endif
+                {
+                    if (errMsg.empty()) {
+                        errMsg = x.what();
+                    }
+                }
+            }
+        }
+    }
+    nread_p += nr;
+    if (! errMsg.empty()) {
+        // Release the slots of the buckets that could not be read.
+        for (uInt i=0; i<nr; ++i) {
+            uInt slotNr = slots[i];
+            if (its_Cache[slotNr] == 0) {
+                its_SlotNr[its_BucketNr[slotNr]] = -1;
+                its_LRU[slotNr] = 0;
+            }
+        }
+        throw AipsError ("BucketCache::readBuckets: " + errMsg);
+    }
+    return allCached;
+}
+
 void BucketCache::extend (uInt nrBucket)
 {
     its_NewNrOfBuckets += nrBucket;
@@ -247,6 +393,14 @@ void BucketCache::extend (uInt nrBucket)
 	for (uInt i=oldSize; i<newSize; i++) {
 	    its_SlotNr[i] = -1;
 	}
+        if (isVariableLength()) {
+            its_Offsets.resize (newSize);
+            its_Lengths.resize (newSize);
+            for (uInt i=oldSize; i<newSize; i++) {
+                its_Offsets[i] = -1;
+                its_Lengths[i] = 0;
+            }
+        }
     }
 }
     
@@ -261,6 +415,10 @@ uInt BucketCache::addBucket (char* data)
 		   CanonicalConversion::canonicalSize (static_cast<Int*>(0)));
 	CanonicalConversion::toLocal (its_FirstFree, its_Buffer);
 	its_NrOfFree--;
+        // The bucket gets new contents, so it cannot be read ahead.
+        if (its_ReadAhead) {
+            its_ReadAhead->discard (bucketNr);
+        }
     }else{
 	// No free buckets, so extend the file.
 	// Initialize all uninitialized buckets before the newly added bucket.
@@ -282,6 +440,10 @@ void BucketCache::removeBucket()
     // Removing a bucket means adding it to the beginning of the free list.
     // Thus store the bucket nr of the first free in this bucket
     // and make this bucket the first free.
+    if (isVariableLength()) {
+        throw AipsError ("BucketCache::removeBucket: not possible for "
+                         "variable-length buckets");
+    }
     uInt bucketNr = its_BucketNr[its_ActualSlot];
     CanonicalConversion::fromLocal (its_Buffer, its_FirstFree);
     its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
@@ -353,21 +515,61 @@ void BucketCache::writeBucket (uInt slotNr)
 {
 ///    cout << "write " << its_BucketNr[slotNr] << " " << slotNr;
     its_WriteCallBack (its_Owner, its_Buffer, its_Cache[slotNr]);
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->write (its_Buffer, its_BucketSize);
+    if (isVariableLength()) {
+        // Write the used part of the bucket. Allocate a new area if it
+        // does not fit in the current one.
+        uInt bucketNr = its_BucketNr[slotNr];
+        uInt length = its_LengthCallBack (its_Owner, its_Buffer);
+        if (its_Offsets[bucketNr] < 0  ||  length > its_Lengths[bucketNr]) {
+            its_Offsets[bucketNr] = its_AllocateCallBack (its_Owner, length);
+            its_Lengths[bucketNr] = length;
+        }
+        its_file->seek (its_Offsets[bucketNr]);
+        its_file->write (its_Buffer, length);
+    } else {
+        its_file->seek (its_StartOffset +
+                        Int64(its_BucketNr[slotNr]) * its_BucketSize);
+        its_file->write (its_Buffer, its_BucketSize);
+    }
     its_Dirty[slotNr] = 0;
     nwrite_p++;
 }
 void BucketCache::readBucket (uInt slotNr)
 {
 ///    cout << "read " << its_BucketNr[slotNr] << " " << slotNr;
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->read (its_Buffer, its_BucketSize);
+    // Use the bucket if it has been read ahead.
+    if (its_ReadAhead  &&
+        its_ReadAhead->get (its_BucketNr[slotNr], its_Buffer)) {
+        its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer);
+        nread_p++;
+        return;
+    }
+    Int64 offset;
+    uInt  length;
+    getLocation (its_BucketNr[slotNr], offset, length);
+    // A variable-length bucket not written yet gets initialized.
+    // It is not dirty, so it is only written if it gets changed.
+    if (offset < 0) {
+        its_Cache[slotNr] = its_InitCallBack (its_Owner);
+        ninit_p++;
+        return;
+    }
+    its_file->seek (offset);
+    its_file->read (its_Buffer, length);
     its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer);
     nread_p++;
 }
+void BucketCache::getLocation (uInt bucketNr, Int64& offset,
+                               uInt& length) const
+{
+    if (isVariableLength()) {
+        offset = its_Offsets[bucketNr];
+        length = its_Lengths[bucketNr];
+    } else {
+        offset = its_StartOffset + Int64(bucketNr) * its_BucketSize;
+        length = its_BucketSize;
+    }
+}
 void BucketCache::initializeBuckets (uInt bucketNr)
 {
     // Initialize this bucket and all uninitialized ones before it.
@@ -403,6 +605,9 @@ void BucketCache::showStatistics (ostream& os) const
     if (nwrite_p > 0) {
 	os << "#writes:   " << nwrite_p << endl;
     }
+    if (its_ReadAhead) {
+        its_ReadAhead->showStatistics (os);
+    }
     os << "#accesses: " << naccess_p;
     if (naccess_p > 0) {
 	os << "        hit-rate:  "
@@ -418,6 +623,9 @@ void BucketCache::initStatistics()
     nread_p   = 0;
     ninit_p   = 0;
     nwrite_p  = 0;
+    if (its_ReadAhead) {
+        its_ReadAhead->initStatistics();
+    }
 }
 
 } //# NAMESPACE CASACORE - END
@@ -31,6 +31,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/BucketReadAhead.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 
@@ -93,6 +94,31 @@ typedef char* (*BucketCacheAddBuffer) (void* ownerObject);
 typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
 // </group>
 
+// <summary>
+// Define the type of the static functions for variable-length buckets.
+// </summary>
+// <use visibility=export>
+// <reviewed reviewer="" date="" tests="" demos="">
+// </reviewed>
+
+// <synopsis>
+// These callback functions are only needed if BucketCache is used with
+// buckets of variable length (see function
+// <src>BucketCache::setVariableLength</src>).
+// <p>
+// The Length callback function has to return the number of bytes used
+// in the canonical buffer filled by the FromLocal callback function.
+// Only that part of the buffer is written.
+// <p>
+// The Allocate callback function has to return the file offset of a new
+// area of the given length. Usually it is the end of the file.
+// </synopsis>
+
+// <group name=BucketCache_VarCallBack>
+typedef uInt (*BucketCacheLength) (void* ownerObject, const char* canonical);
+typedef Int64 (*BucketCacheAllocate) (void* ownerObject, uInt length);
+// </group>
+
 
 
 // <summary>
@@ -141,6 +167,28 @@ typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
 // for example, be used to have tiled arrays with different tile shapes
 // in the same file.
 // <p>
+// When a bucket has to be read from the file and the buckets read before
+// show a sequential or strided access pattern, the next buckets can be
+// read ahead by a helper thread (see class
+// <linkto class=BucketReadAhead>BucketReadAhead</linkto>).
+// In this way the IO overlaps with the processing of the data.
+// Read-ahead is switched on with function <src>setReadAhead</src> or with
+// aipsrc variable <src>table.cache.readahead</src> giving the maximum
+// number of buckets to read ahead. It defaults to 0, thus no read-ahead.
+// <p>
+// Normally all buckets have the same length and are stored consecutively
+// in the file. Using <src>setVariableLength</src> the buckets can have
+// a variable length (e.g. if compressed). In that case an index gives
+// the file offset and length of each bucket. The bucket size given at
+// construction time is the maximum length of a bucket.
+// When a bucket is written and does not fit in its current area,
+// a new area is allocated using a callback function.
+// Buckets that have never been changed are not written at all (thus
+// get offset -1); when read, they are initialized using the init callback.
+// In this way a sparse file is kept, where only the changed buckets take
+// space.
+// Variable-length buckets cannot be removed and cannot be read ahead.
+// <p>
 // Statistics are kept to know how efficient the cache is working.
 // It is possible to initialize and show the statistics.
 // </synopsis> 
@@ -264,6 +312,32 @@ public:
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
+    // Use buckets with a variable length in the file.
+    // The file offset and (allocated) length of the buckets are given.
+    // An offset -1 means that the bucket has not been written yet, thus
+    // has the contents given by the init callback.
+    // It clears the cache without flushing it, so it should be called
+    // before buckets are accessed.
+    void setVariableLength (const Block<Int64>& offsets,
+                            const Block<uInt>& lengths,
+                            BucketCacheLength lengthCallBack,
+                            BucketCacheAllocate allocateCallBack);
+
+    // Is the length of the buckets variable?
+    Bool isVariableLength() const;
+
+    // Get the file offsets and lengths of variable-length buckets.
+    // The blocks can be longer than the number of buckets.
+    // <group>
+    const Block<Int64>& bucketOffsets() const;
+    const Block<uInt>& bucketLengths() const;
+    // </group>
+
+    // Set the maximum number of buckets to read ahead in case of a
+    // sequential or strided access pattern. 0 means no read-ahead.
+    // Read-ahead is not possible if the file cannot be read in parallel.
+    void setReadAhead (uInt maxNrBuckets);
+
     // Set the dirty bit for the current bucket.
     void setDirty();
 
@@ -276,6 +350,17 @@ public:
     // A pointer to the data in converted format is returned.
     char* getBucket (uInt bucketNr);
 
+    // Read the given buckets into the cache (if not in there yet) using
+    // the given number of threads. Each thread reads a bucket with
+    // <src>BucketFile::pread</src> and converts it using the ToLocal
+    // callback function, which must be thread-safe.
+    // <br>At most <src>cacheSize()</src> buckets are read. Buckets not
+    // in the file yet are ignored. Nothing is done if only one thread is
+    // used or if the file cannot be read in parallel; then the buckets are
+    // read when accessed by <src>getBucket</src>.
+    // <br>It returns True if all given buckets are in the cache thereafter.
+    Bool readBuckets (const Block<uInt>& bucketNrs, uInt nthreads);
+
     // Extend the file with the given number of buckets.
     // The buckets get initialized when they are acquired
     // (using getBucket) for the first time.
@@ -360,6 +445,14 @@ private:
     uInt         its_LRUCounter;
     // The internal buffer.
     char*        its_Buffer;
+    // The object reading buckets ahead (0 = no read-ahead).
+    BucketReadAhead* its_ReadAhead;
+    // The callback functions for variable-length buckets (0 = fixed).
+    BucketCacheLength   its_LengthCallBack;
+    BucketCacheAllocate its_AllocateCallBack;
+    // The file offsets and lengths of variable-length buckets.
+    Block<Int64> its_Offsets;
+    Block<uInt>  its_Lengths;
     // The number of free buckets.
     uInt its_NrOfFree;
     // The first free bucket (-1 = no free buckets).
@@ -396,6 +489,9 @@ private:
 
     // Check if the offset of a non-cached part is correct.
     void checkOffset (uInt length, Int64 offset) const;
+
+    // Get the file offset and length of a bucket to read.
+    void getLocation (uInt bucketNr, Int64& offset, uInt& length) const;
 };
 
 
@@ -409,6 +505,15 @@ inline Int BucketCache::firstFreeBucket() const
 inline uInt BucketCache::nFreeBucket() const
     { return its_NrOfFree; }
 
+inline Bool BucketCache::isVariableLength() const
+    { return its_LengthCallBack != 0; }
+
+inline const Block<Int64>& BucketCache::bucketOffsets() const
+    { return its_Offsets; }
+
+inline const Block<uInt>& BucketCache::bucketLengths() const
+    { return its_Lengths; }
+
 
 
 
@@ -205,6 +205,32 @@ uInt BucketFile::read (void* buffer, uInt length)
   return file_p->read (length, buffer);
 }
 
+uInt BucketFile::pread (void* buffer, uInt length, Int64 offset)
+{
+  return file_p->pread (length, offset, buffer);
+}
+
+void BucketFile::adviseWillNeed (Int64 offset, Int64 length)
+{
+#if defined(POSIX_FADV_WILLNEED)
+  if (fd_p >= 0) {
+    // It is only advice, so errors can be ignored.
+    posix_fadvise (fd_p, offset, length, POSIX_FADV_WILLNEED);
+  }
+#else
+  (void)offset;
+  (void)length;
+#endif
+}
+
+char* BucketFile::mapRegion (Int64 offset, Int64 length)
+{
+  if (fd_p < 0) {
+    return 0;
+  }
+  return MMapfdIO::mapRegion (fd_p, offset, length);
+}
+
 uInt BucketFile::write (const void* buffer, uInt length)
 {
   file_p->write (length, buffer);
@@ -170,6 +170,30 @@ public:
     // Write bytes into the file.
     virtual uInt write (const void* buffer, uInt length);
 
+    // Read bytes from the file at the given offset without using the
+    // file pointer. Multiple threads can do it in parallel if
+    // <src>canReadParallel</src> is True.
+    uInt pread (void* buffer, uInt length, Int64 offset);
+
+    // Can the file be read by multiple threads in parallel using
+    // <src>pread</src>? This is the case for a regular file, but not for a
+    // file in a MultiFileBase.
+    Bool canReadParallel() const
+      { return fd_p >= 0; }
+
+    // Tell the operating system that the given part of the file will be
+    // read soon, so it can start reading it in the background
+    // (using <src>posix_fadvise</src>). It does nothing if not supported
+    // by the system or if the file is part of a MultiFileBase.
+    void adviseWillNeed (Int64 offset, Int64 length);
+
+    // Map the given part of the file privately into memory using
+    // <src>MMapfdIO::mapRegion</src>. The region must be unmapped using
+    // <src>MMapfdIO::unmapRegion</src>.
+    // A null pointer is returned if not possible (e.g. if the file is
+    // part of a MultiFileBase).
+    char* mapRegion (Int64 offset, Int64 length);
+
     // Seek in the file.
     // <group>
     virtual void seek (Int64 offset);
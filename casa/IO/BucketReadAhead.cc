@@ -0,0 +1,346 @@
+//# BucketReadAhead.cc: Read buckets ahead depending on the access pattern
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+//# Includes
+#include <casacore/casa/IO/BucketReadAhead.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/FiledesIO.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+BucketReadAhead::BucketReadAhead (BucketFile* file, Int64 startOffset,
+                                  uInt bucketSize, uInt maxNrBuckets)
+: itsFile         (file),
+  itsStartOffset  (startOffset),
+  itsBucketSize   (bucketSize),
+  itsMaxNrBuckets (maxNrBuckets),
+  itsLastNr       (-1),
+  itsStride       (0),
+  itsNrSeq        (0),
+  itsDepth        (1),
+  itsAdvised      (-1)
+#ifdef USE_THREADS
+ ,itsStop         (False),
+  itsReadFd       (-1)
+#endif
+{
+    initStatistics();
+}
+
+BucketReadAhead::~BucketReadAhead()
+{
+#ifdef USE_THREADS
+    if (itsThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(itsMutex);
+            itsStop = True;
+        }
+        itsCondition.notify_all();
+        itsThread.join();
+    }
+    if (itsReadFd >= 0) {
+        FiledesIO::close (itsReadFd);
+    }
+#endif
+}
+
+void BucketReadAhead::access (uInt bucketNr, uInt nrBuckets,
+                              const Block<Int>& slotNr)
+{
+    // Determine if the access pattern continues.
+    Int64 stride = Int64(bucketNr) - itsLastNr;
+    if (itsLastNr >= 0  &&  stride != 0  &&  stride == itsStride) {
+        itsNrSeq++;
+    } else {
+        if (itsNrSeq > 0) {
+#ifdef USE_THREADS
+            std::lock_guard<std::mutex> lock(itsMutex);
+#endif
+            discardAll();
+        }
+        itsNrSeq   = 0;
+        itsDepth   = 1;
+        itsAdvised = bucketNr;
+    }
+    itsStride = stride;
+    itsLastNr = bucketNr;
+    // Only read ahead after at least 3 accesses with the same stride.
+    if (itsNrSeq == 0) {
+        return;
+    }
+    // Read the next buckets in the pattern up to the current depth.
+    // Advise the OS about the ones thereafter.
+    uInt nread = 0;
+    uInt nadvise = 2*itsDepth;
+#ifdef USE_THREADS
+    if (itsFile->canReadParallel()  &&  openReadFile()) {
+        nread = itsDepth;
+    }
+#else
+    nadvise = itsMaxNrBuckets;
+#endif
+    Block<uInt> advNrs(nadvise);
+    uInt nadv = 0;
+    {
+#ifdef USE_THREADS
+        std::lock_guard<std::mutex> lock(itsMutex);
+#endif
+        for (uInt k=1; k<=nadvise; ++k) {
+            Int64 nr = Int64(bucketNr) + k*stride;
+            if (nr < 0  ||  nr >= nrBuckets) {
+                break;
+            }
+            if (slotNr[nr] < 0) {
+                if (k > nread  ||  !request (nr)) {
+                    // Only advise buckets not advised before.
+                    if ((nr - itsAdvised) * stride > 0) {
+                        advNrs[nadv++] = nr;
+                        itsAdvised = nr;
+                    }
+                }
+            }
+        }
+#ifdef USE_THREADS
+        if (nread > 0  &&  !itsThread.joinable()  &&  !itsQueue.empty()) {
+            itsThread = std::thread (&BucketReadAhead::run, this);
+        }
+#endif
+    }
+#ifdef USE_THREADS
+    itsCondition.notify_all();
+#endif
+    for (uInt i=0; i<nadv; ++i) {
+        advise (advNrs[i]);
+    }
+}
+
+Bool BucketReadAhead::openReadFile()
+{
+#ifdef USE_THREADS
+    // The helper thread uses its own file descriptor, so it is not
+    // affected if the BucketFile is reopened or closed.
+    if (itsReadFile.null()) {
+        try {
+            itsReadFd   = FiledesIO::open (itsFile->name().chars(), False);
+            itsReadFile = new FiledesIO (itsReadFd, itsFile->name());
+        } catch (const std::exception&) {
+            // Do not read ahead if the file cannot be opened.
+            itsMaxNrBuckets = 0;
+        }
+    }
+#endif
+    return itsMaxNrBuckets > 0;
+}
+
+Bool BucketReadAhead::request (uInt bucketNr)
+{
+    if (itsEntries.find(bucketNr) != itsEntries.end()) {
+        return True;
+    }
+    if (itsEntries.size() >= itsMaxNrBuckets) {
+        return False;
+    }
+    Entry& entry = itsEntries[bucketNr];
+    entry.state = Queued;
+    if (itsFreeBuffers.empty()) {
+        entry.data.resize (itsBucketSize);
+    } else {
+        entry.data.swap (itsFreeBuffers.back());
+        itsFreeBuffers.pop_back();
+    }
+    itsQueue.push_back (bucketNr);
+    return True;
+}
+
+Bool BucketReadAhead::get (uInt bucketNr, char* buffer)
+{
+#ifdef USE_THREADS
+    std::unique_lock<std::mutex> lock(itsMutex);
+    std::map<uInt,Entry>::iterator iter = itsEntries.find (bucketNr);
+    if (iter == itsEntries.end()) {
+        return False;
+    }
+    // Wait until the helper thread has read the bucket.
+    if (iter->second.state == Queued  ||  iter->second.state == Reading) {
+        itsNWait++;
+        itsCondition.wait (lock, [&iter]() {
+            return iter->second.state != Queued  &&
+                   iter->second.state != Reading; });
+    }
+    Bool found = (iter->second.state == Ready);
+    if (found) {
+        memcpy (buffer, iter->second.data.data(), itsBucketSize);
+        itsNHit++;
+        // The bucket read ahead is used, so read further ahead.
+        itsDepth = std::min (2*itsDepth, itsMaxNrBuckets);
+    }
+    itsFreeBuffers.push_back (std::vector<char>());
+    itsFreeBuffers.back().swap (iter->second.data);
+    itsEntries.erase (iter);
+    return found;
+#else
+    (void)bucketNr;
+    (void)buffer;
+    return False;
+#endif
+}
+
+void BucketReadAhead::discard (uInt bucketNr)
+{
+#ifdef USE_THREADS
+    std::lock_guard<std::mutex> lock(itsMutex);
+#endif
+    std::map<uInt,Entry>::iterator iter = itsEntries.find (bucketNr);
+    if (iter != itsEntries.end()) {
+        discardEntry (iter);
+    }
+}
+
+void BucketReadAhead::clear()
+{
+    {
+#ifdef USE_THREADS
+        std::lock_guard<std::mutex> lock(itsMutex);
+#endif
+        discardAll();
+    }
+    itsLastNr  = -1;
+    itsStride  = 0;
+    itsNrSeq   = 0;
+    itsDepth   = 1;
+    itsAdvised = -1;
+}
+
+void BucketReadAhead::discardAll()
+{
+    std::map<uInt,Entry>::iterator iter = itsEntries.begin();
+    while (iter != itsEntries.end()) {
+        // Erasing an element does not invalidate the other iterators.
+        std::map<uInt,Entry>::iterator cur = iter++;
+        discardEntry (cur);
+    }
+    itsQueue.clear();
+}
+
+void BucketReadAhead::discardEntry (std::map<uInt,Entry>::iterator iter)
+{
+    if (iter->second.state == Reading) {
+        // The helper thread will remove it after reading it.
+        iter->second.state = Cancelled;
+    } else if (iter->second.state != Cancelled) {
+        if (iter->second.state == Ready) {
+            itsNWasted++;
+        }
+        itsFreeBuffers.push_back (std::vector<char>());
+        itsFreeBuffers.back().swap (iter->second.data);
+        itsEntries.erase (iter);
+    }
+}
+
+void BucketReadAhead::advise (uInt bucketNr)
+{
+    itsFile->adviseWillNeed (itsStartOffset + Int64(bucketNr) * itsBucketSize,
+                             itsBucketSize);
+}
+
+void BucketReadAhead::run()
+{
+#ifdef USE_THREADS
+    std::unique_lock<std::mutex> lock(itsMutex);
+    while (True) {
+        itsCondition.wait (lock, [this]() {
+            return itsStop  ||  !itsQueue.empty(); });
+        if (itsStop) {
+            break;
+        }
+        uInt bucketNr = itsQueue.front();
+        itsQueue.pop_front();
+        // Skip if discarded or requested again while still in the queue.
+        std::map<uInt,Entry>::iterator iter = itsEntries.find (bucketNr);
+        if (iter == itsEntries.end()  ||  iter->second.state != Queued) {
+            continue;
+        }
+        // The entry cannot be removed while being read, so the buffer
+        // can be filled without holding the lock.
+        iter->second.state = Reading;
+        char* buffer = iter->second.data.data();
+        lock.unlock();
+        Bool ok = True;
+        try {
+            itsReadFile->pread (itsBucketSize,
+                                itsStartOffset + Int64(bucketNr) * itsBucketSize,
+                                buffer);
+        } catch (...) {
+            // The bucket will be read again by the BucketCache.
+            ok = False;
+        }
+        lock.lock();
+        itsNRead++;
+        if (iter->second.state == Cancelled) {
+            itsNWasted++;
+            itsFreeBuffers.push_back (std::vector<char>());
+            itsFreeBuffers.back().swap (iter->second.data);
+            itsEntries.erase (iter);
+        } else {
+            iter->second.state = (ok ? Ready : Failed);
+        }
+        itsCondition.notify_all();
+    }
+#endif
+}
+
+void BucketReadAhead::initStatistics()
+{
+#ifdef USE_THREADS
+    std::lock_guard<std::mutex> lock(itsMutex);
+#endif
+    itsNRead   = 0;
+    itsNHit    = 0;
+    itsNWait   = 0;
+    itsNWasted = 0;
+}
+
+void BucketReadAhead::showStatistics (ostream& os) const
+{
+#ifdef USE_THREADS
+    std::lock_guard<std::mutex> lock(itsMutex);
+#endif
+    if (itsNRead > 0) {
+        os << "#readahead: " << itsNRead
+           << "        hit-rate:  " << 100 * float(itsNHit) / float(itsNRead)
+           << "%" << endl;
+        os << "  #waits:  " << itsNWait
+           << "        #wasted:   " << itsNWasted << endl;
+    }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,207 @@
+//# BucketReadAhead.h: Read buckets ahead depending on the access pattern
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_BUCKETREADAHEAD_H
+#define CASA_BUCKETREADAHEAD_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
+#include <casacore/casa/iosfwd.h>
+#include <map>
+#include <deque>
+#include <vector>
+#ifdef USE_THREADS
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class BucketFile;
+class FiledesIO;
+
+
+// <summary>
+// Read buckets ahead depending on the access pattern
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tBucketCache">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+// </prerequisite>
+
+// <synopsis>
+// BucketReadAhead is used by class BucketCache to read buckets before they
+// are needed, so the IO can overlap with the processing of the buckets
+// already read.
+// <p>
+// BucketCache tells the buckets it has to read from the file (i.e. the
+// cache misses). If the last bucket numbers have a constant difference
+// (stride), it is assumed the access is sequential or strided and the
+// next buckets with that stride are read ahead. A helper thread reads
+// them (in external format) into spare buffers, from where BucketCache
+// takes them when needed. Furthermore, the operating system is told
+// (using <src>posix_fadvise</src>) that the buckets thereafter will be
+// needed. The number of buckets read ahead starts at 1 and is doubled
+// for each bucket read ahead that is actually used, until the maximum
+// number given at construction time. All buckets read ahead are
+// discarded when the access pattern changes.
+// <p>
+// The helper thread is only started once a sequential or strided
+// pattern is found. It reads the file using its own file descriptor.
+// If casacore is built without thread support, only
+// <src>posix_fadvise</src> is used.
+// <br>Because the data are kept in external format, the BucketCache
+// callback functions do not need to be thread-safe. The BucketCache has to
+// discard a bucket read ahead when it gets the bucket in another way,
+// because the data in the file might change thereafter.
+// </synopsis>
+
+// <motivation>
+// When streaming through a column, the wall time should be the maximum
+// of the compute and IO time instead of their sum.
+// </motivation>
+
+class BucketReadAhead
+{
+public:
+    // Create the object for the given part of the file.
+    // At most <src>maxNrBuckets</src> buckets are read ahead.
+    // The file can only be read ahead if it can be read in parallel.
+    BucketReadAhead (BucketFile* file, Int64 startOffset, uInt bucketSize,
+                     uInt maxNrBuckets);
+
+    // The destructor stops the helper thread.
+    ~BucketReadAhead();
+
+    // Register that the bucket is read from the file (i.e., a cache miss).
+    // If part of a sequential or strided pattern, reads of the next
+    // buckets are issued. Buckets from <src>nrBuckets</src> on and buckets
+    // having a slot in the cache (<src>slotNr[i] >= 0</src>) are not read.
+    void access (uInt bucketNr, uInt nrBuckets, const Block<Int>& slotNr);
+
+    // Copy the data of the bucket into the buffer if the bucket has been
+    // read ahead. If still being read, it waits until the read is done.
+    // False is returned if the bucket has not been read ahead.
+    // The bucket is removed from the read-ahead buffers.
+    Bool get (uInt bucketNr, char* buffer);
+
+    // Discard the bucket if it has been read ahead.
+    void discard (uInt bucketNr);
+
+    // Discard all buckets read ahead and reset the access pattern.
+    void clear();
+
+    // (Re)initialize the statistics.
+    void initStatistics();
+
+    // Show the statistics (if buckets have been read ahead).
+    void showStatistics (ostream& os) const;
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    BucketReadAhead (const BucketReadAhead&);
+    BucketReadAhead& operator= (const BucketReadAhead&);
+    // </group>
+
+    // The state of a bucket read ahead.
+    enum State {Queued, Reading, Ready, Failed, Cancelled};
+
+    // A bucket read ahead.
+    struct Entry {
+        State state;
+        std::vector<char> data;
+    };
+
+    // Open the file to be used by the helper thread (if not open yet).
+    // It returns False if the file cannot be opened.
+    Bool openReadFile();
+
+    // Issue the read of a bucket (if not issued yet).
+    // It returns False if no more buffers are available.
+    Bool request (uInt bucketNr);
+
+    // Discard all buckets without locking.
+    void discardAll();
+
+    // Discard a bucket without locking.
+    void discardEntry (std::map<uInt,Entry>::iterator iter);
+
+    // Tell the OS that the bucket will be needed.
+    void advise (uInt bucketNr);
+
+    // The loop executed by the helper thread.
+    void run();
+
+    //# Data members.
+    BucketFile* itsFile;
+    Int64       itsStartOffset;
+    uInt        itsBucketSize;
+    uInt        itsMaxNrBuckets;
+    // The access pattern (only used by the main thread).
+    Int64       itsLastNr;
+    Int64       itsStride;
+    uInt        itsNrSeq;
+    uInt        itsDepth;
+    // The last bucket advised to the OS.
+    Int64       itsAdvised;
+    // The buckets read ahead and the queue of buckets to read.
+    std::map<uInt,Entry> itsEntries;
+    std::deque<uInt>     itsQueue;
+    // Buffers that can be reused.
+    std::vector<std::vector<char> > itsFreeBuffers;
+    // The statistics.
+    uInt itsNRead;
+    uInt itsNHit;
+    uInt itsNWait;
+    uInt itsNWasted;
+#ifdef USE_THREADS
+    Bool                    itsStop;
+    // The file (with its own file descriptor) read by the helper thread.
+    int                     itsReadFd;
+    CountedPtr<FiledesIO>   itsReadFile;
+    std::thread             itsThread;
+    mutable std::mutex      itsMutex;
+    std::condition_variable itsCondition;
+#endif
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -29,7 +29,10 @@
 #include <casacore/casa/IO/MMapfdIO.h>
 #include <casacore/casa/IO/RegularFileIO.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/OS/Mutex.h>
+#include <map>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
@@ -37,7 +40,13 @@
 
 namespace casacore
 {
-  
+
+  // The regions mapped by mapRegion, keyed by data pointer.
+  // It gives the start and length of the page-aligned mapping.
+  typedef std::map<const void*, std::pair<void*,size_t> > MMapRegionMap;
+  static MMapRegionMap theirRegions;
+  static Mutex theirRegionMutex;
+
   MMapfdIO::MMapfdIO()
     : itsFileSize   (0),
       itsPosition   (0),
@@ -179,4 +188,48 @@ namespace casacore
     return itsPtr+offset;
   }
 
+  char* MMapfdIO::mapRegion (int fd, Int64 offset, Int64 length)
+  {
+    struct stat st;
+    if (fd < 0  ||  offset < 0  ||  length <= 0  ||  ::fstat (fd, &st) != 0
+        ||  offset + length > st.st_size) {
+      return 0;
+    }
+    // mmap needs an offset at a page boundary.
+    Int64 pageSize = ::sysconf (_SC_PAGESIZE);
+    Int64 start    = offset - offset % pageSize;
+    size_t mapLen  = offset + length - start;
+    void* ptr = ::mmap (0, mapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                        fd, start);
+    if (ptr == MAP_FAILED) {
+      return 0;
+    }
+    char* data = static_cast<char*>(ptr) + (offset - start);
+    ScopedMutexLock lock(theirRegionMutex);
+    theirRegions[data] = std::make_pair (ptr, mapLen);
+    return data;
+  }
+
+  Bool MMapfdIO::unmapRegion (const void* ptr)
+  {
+    std::pair<void*,size_t> region;
+    {
+      ScopedMutexLock lock(theirRegionMutex);
+      MMapRegionMap::iterator iter = theirRegions.find (ptr);
+      if (iter == theirRegions.end()) {
+        return False;
+      }
+      region = iter->second;
+      theirRegions.erase (iter);
+    }
+    ::munmap (region.first, region.second);
+    return True;
+  }
+
+  uInt MMapfdIO::nrMappedRegions()
+  {
+    ScopedMutexLock lock(theirRegionMutex);
+    return theirRegions.size();
+  }
+
 } // end namespace
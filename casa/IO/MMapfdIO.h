@@ -33,6 +33,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/FiledesIO.h>
 #include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/Containers/Allocator.h>
 
 namespace casacore
 {
@@ -58,6 +59,12 @@ namespace casacore
 // it will cause a segmentation if the file is readonly. If the file is
 // writable, writing into the mapped data segment means changing the file
 // contents.
+// <p>
+// The static function <src>mapRegion</src> makes a private read-only view of
+// a part of a file, which can be used to get the data without copying them.
+// Such a region stays mapped until <src>unmapRegion</src> is called; usually
+// that is done by <linkto class=MappedAllocator>MappedAllocator</linkto>
+// when the Array using the region is destructed.
 // </synopsis>
 
 class MMapfdIO: public FiledesIO
@@ -119,6 +126,23 @@ public:
   Int64 getFileSize() const
     { return itsFileSize; }
 
+  // Map <src>length</src> bytes starting at the given offset of the file
+  // into memory and return a pointer to the first byte.
+  // The region is mapped privately (copy-on-write), so changing the data
+  // does not change the file. It is independent of the lifetime of the
+  // file descriptor and of any MMapfdIO object.
+  // A null pointer is returned if the region exceeds the file size or
+  // if the mapping fails.
+  static char* mapRegion (int fd, Int64 offset, Int64 length);
+
+  // Unmap a region mapped by <src>mapRegion</src>. The pointer must be the
+  // one returned by <src>mapRegion</src>.
+  // False is returned if the pointer is not a mapped region.
+  static Bool unmapRegion (const void* ptr);
+
+  // Get the number of regions currently mapped by <src>mapRegion</src>.
+  static uInt nrMappedRegions();
+
 protected:
   // Reset the position pointer to the given value. It returns the
   // new position.
@@ -140,6 +164,69 @@ private:
   Bool   itsIsWritable;
 };
 
+
+// An allocator for arrays referencing a region mapped by
+// <src>MMapfdIO::mapRegion</src>. Deallocation unmaps the region.
+// Memory allocated by it (e.g. when copying such an array) comes from the
+// heap and is freed as usual.
+template<typename T>
+struct mapped_allocator: public casacore_allocator<T> {
+  typedef casacore_allocator<T> Super;
+  typedef typename Super::size_type size_type;
+  typedef typename Super::pointer pointer;
+
+  template<typename TOther>
+  struct rebind {
+    typedef mapped_allocator<TOther> other;
+  };
+  mapped_allocator() noexcept {
+  }
+
+  mapped_allocator(const mapped_allocator&other) noexcept
+  :Super(other) {
+  }
+
+  template<typename TOther>
+  mapped_allocator(const mapped_allocator<TOther>&) noexcept {
+  }
+
+  ~mapped_allocator() noexcept {
+  }
+
+  void deallocate(pointer ptr, size_type n) {
+    if (! MMapfdIO::unmapRegion(ptr)) {
+      Super::deallocate(ptr, n);
+    }
+  }
+};
+
+template<typename T>
+inline bool operator==(const mapped_allocator<T>&,
+    const mapped_allocator<T>&) {
+  return true;
+}
+
+template<typename T>
+inline bool operator!=(const mapped_allocator<T>&,
+    const mapped_allocator<T>&) {
+  return false;
+}
+
+// An allocator to be used with the TAKE_OVER policy for an Array
+// referencing a region mapped by <src>MMapfdIO::mapRegion</src>.
+// The region is unmapped when the Array's storage is released.
+template<typename T>
+class MappedAllocator: public BaseAllocator<T, MappedAllocator<T> > {
+public:
+  typedef mapped_allocator<T> type;
+  // an instance of this allocator.
+  static MappedAllocator<T> value;
+protected:
+  MappedAllocator(){}
+};
+template<typename T>
+MappedAllocator<T> MappedAllocator<T>::value;
+
 } // end namespace
 
 #endif
@@ -40,6 +40,7 @@ void a (Bool);
 void b (Bool);
 void c (uInt bufSize);
 void d (uInt bufSize);
+void e();
 
 int main (int argc, const char*[])
 {
@@ -54,6 +55,7 @@ int main (int argc, const char*[])
 //	d (1024);
 //	d (32768);
 //	d (327680);
+	e();
     } catch (AipsError& x) {
 	cout << "Caught an exception: " << x.getMesg() << endl;
 	return 1;
@@ -256,3 +258,33 @@ void d (uInt)
     timer.show();
     cout << "<<<" << endl;
 }
+
+// Check if reading ahead gives the same results.
+void e()
+{
+    // Open the file.
+    BucketFile file("tBucketCache_tmp.data", False);
+    file.open();
+    Int rec[128];
+    file.read ((char*)rec, 512);
+    BucketCache cache (&file, 512, 32768, rec[0], 10, 0, bToLocal, bFromLocal,
+		       aInitBuffer, aDeleteBuffer);
+    BucketCache raCache (&file, 512, 32768, rec[0], 10, 0,
+                         bToLocal, bFromLocal, aInitBuffer, aDeleteBuffer);
+    raCache.setReadAhead (8);
+    Int nbucket = cache.nBucket();
+    uInt nerr = 0;
+    // Read forward, strided, backward and forward again.
+    Int strides[] = {1, 3, -1, 2, 1};
+    for (uInt j=0; j<sizeof(strides)/sizeof(Int); ++j) {
+        Int st = strides[j];
+        for (Int i=(st>0 ? 0 : nbucket-1); i>=0 && i<nbucket; i+=st) {
+            const char* buf = raCache.getBucket(i);
+            if (memcmp (buf, cache.getBucket(i), 32768) != 0) {
+                nerr++;
+            }
+        }
+    }
+    cout << "checked read-ahead of " << nbucket << " buckets; #errors="
+         << nerr << endl;
+}
@@ -152,6 +152,11 @@ public:
       { pointerRep_p.reset(); }
     // </group>
 
+    // Swap the pointers of this and the other <src>CountedPtr</src>.
+    // The reference counts are not changed.
+    void swap (CountedPtr<t>& other)
+      { pointerRep_p.swap (other.pointerRep_p); }
+
     // The <src>CountedPtr</src> indirection operator simply
     // returns a reference to the value being protected. If the pointer
     // is un-initialized (null), an exception will be thrown. The member
@@ -202,53 +202,56 @@ private:
 // comparison. However, this sort allows to sort const data.
 // Another advantage is that this sort is always stable (i.e. equal
 // values are kept in their original order).
+// <br>The template parameter <src>INX</src> gives the type of the indices.
+// By default it is <src>uInt</src>, but <src>uInt64</src> can be used
+// to sort more than 4 billion values (e.g. 64-bit table row numbers).
 
-template<class T> class GenSortIndirect
+template<class T, class INX=uInt> class GenSortIndirect
 {
 public:
 
     // Sort a C-array containing <src>nr</src> <src>T</src>-type objects.
     // The resulting index vector gives the sorted indices.
-    static uInt sort (Vector<uInt>& indexVector, const T* data, uInt nr,
+    static INX sort (Vector<INX>& indexVector, const T* data, INX nr,
 		      Sort::Order = Sort::Ascending,
 		      int options = Sort::QuickSort);
 
     // Sort a C-array containing <src>nr</src> <src>T</src>-type objects.
     // The resulting index vector gives the sorted indices.
-    static uInt sort (Vector<uInt>& indexVector, const Array<T>& data,
+    static INX sort (Vector<INX>& indexVector, const Array<T>& data,
 		      Sort::Order = Sort::Ascending,
 		      int options = Sort::QuickSort);
 
     // Sort a C-array containing <src>nr</src> <src>T</src>-type objects.
     // The resulting index vector gives the sorted indices.
-    static uInt sort (Vector<uInt>& indexVector, const Block<T>& data, uInt nr,
+    static INX sort (Vector<INX>& indexVector, const Block<T>& data, INX nr,
 		      Sort::Order = Sort::Ascending,
 		      int options = Sort::QuickSort);
 
     // Find the index of the k-th largest value.
-    static uInt kthLargest (T* data, uInt nr, uInt k);
+    static INX kthLargest (T* data, INX nr, INX k);
 
     // Sort container using quicksort.
     // The argument <src>inx</src> gives the index defining the order of the
     // values in the data array. Its length must be at least <src>nr</src>
     // and it must be filled with the index values of the data.
     // Usually this is 0..nr, but it could contain a selection of the data.
-    static uInt quickSort (uInt* inx, const T* data,
-			   uInt nr, Sort::Order, int options);
+    static INX quickSort (INX* inx, const T* data,
+			   INX nr, Sort::Order, int options);
     // Sort container using heapsort.
-    static uInt heapSort (uInt* inx, const T* data,
-			  uInt nr, Sort::Order, int options);
+    static INX heapSort (INX* inx, const T* data,
+			  INX nr, Sort::Order, int options);
     // Sort container using insertion sort.
-    static uInt insSort (uInt* inx, const T* data,
-			 uInt nr, Sort::Order, int options);
+    static INX insSort (INX* inx, const T* data,
+			 INX nr, Sort::Order, int options);
     // Sort container using parallel merge sort (using OpenMP).
     // By default the maximum number of threads is used.
-    static uInt parSort (uInt* inx, const T* data,
-			 uInt nr, Sort::Order, int options, int nthreads=0);
+    static INX parSort (INX* inx, const T* data,
+			 INX nr, Sort::Order, int options, int nthreads=0);
 
 private:
     // Swap 2 indices.
-    static inline void swapInx (uInt& index1, uInt& index2);
+    static inline void swapInx (INX& index1, INX& index2);
 
     // The<src>data</src> buffer is divided in <src>nparts</src> parts.
     // In each part the values are in ascending order.
@@ -258,31 +261,31 @@ private:
     // are used for the merge result. The pointer containing the final result
     // is returned.
     // <br>If possible, merging the parts is done in parallel (using OpenMP).
-    static uInt* merge (const T* data, uInt* inx, uInt* tmp, uInt nrrec,
-                        uInt* index, uInt nparts);
+    static INX* merge (const T* data, INX* inx, INX* tmp, INX nrrec,
+                        INX* index, INX nparts);
 
     // Check if 2 values are in ascending order.
     // When equal, the order is correct if index1<index2.
-    static inline int isAscending (const T* data, Int index1, Int index2);
+    static inline int isAscending (const T* data, Int64 index1, Int64 index2);
 
 
     // Quicksort in ascending order.
-    static void quickSortAsc (uInt* inx, const T*, Int nr,
+    static void quickSortAsc (INX* inx, const T*, Int64 nr,
                               Bool multiThread=False, Int rec_lim=128);
 
     // Heapsort in ascending order.
-    static void heapSortAsc (uInt* inx, const T*, Int nr);
+    static void heapSortAsc (INX* inx, const T*, Int64 nr);
     // Helper function for ascending heapsort.
-    static void heapAscSiftDown (uInt* inx, Int, Int, const T*);
+    static void heapAscSiftDown (INX* inx, Int64, Int64, const T*);
 
     // Insertion sort in ascending order.
-    static uInt insSortAsc (uInt* inx, const T*, Int nr, int option);
+    static INX insSortAsc (INX* inx, const T*, Int64 nr, int option);
     // Insertion sort in ascending order allowing duplicates.
     // This is also used by quicksort for its last steps.
-    static uInt insSortAscDup (uInt* inx, const T*, Int nr);
+    static INX insSortAscDup (INX* inx, const T*, Int64 nr);
     // Insertion sort in ascending order allowing no duplicates.
     // This is also used by the other sort algorithms to skip duplicates.
-    static uInt insSortAscNoDup (uInt* inx, const T*, Int nr);
+    static INX insSortAscNoDup (INX* inx, const T*, Int64 nr);
 };
 
 
@@ -377,6 +380,35 @@ inline
 uInt genSort (Vector<uInt>& indexVector, const Block<T>& data, uInt nr,
               Sort::Order order = Sort::Ascending, int options=0)
   { return GenSortIndirect<T>::sort (indexVector, data, nr, order, options); }
+
+template<class T>
+inline
+uInt64 genSort (Vector<uInt64>& indexVector, const T* data, uInt64 nr,
+                Sort::Order order = Sort::Ascending, int options=0)
+  { return GenSortIndirect<T,uInt64>::sort (indexVector, data, nr,
+                                            order, options); }
+
+template<class T>
+inline
+uInt64 genSort (Vector<uInt64>& indexVector, const Array<T>& data,
+                Sort::Order order = Sort::Ascending, int options=0)
+  { return GenSortIndirect<T,uInt64>::sort (indexVector, data,
+                                            order, options); }
+
+template<class T>
+inline
+uInt64 genSort (Vector<uInt64>& indexVector, const Block<T>& data,
+                Sort::Order order = Sort::Ascending, int options=0)
+  { return GenSortIndirect<T,uInt64>::sort (indexVector, data,
+                                            data.nelements(),
+                                            order, options); }
+
+template<class T>
+inline
+uInt64 genSort (Vector<uInt64>& indexVector, const Block<T>& data, uInt64 nr,
+                Sort::Order order = Sort::Ascending, int options=0)
+  { return GenSortIndirect<T,uInt64>::sort (indexVector, data, nr,
+                                            order, options); }
 // </group>
 
 
@@ -390,15 +422,15 @@ inline void GenSort<T>::swap (T& l, T& r)
     l = r;
     r = t;
 }
-template<class T>
-inline void GenSortIndirect<T>::swapInx (uInt& i, uInt& j)
+template<class T, class INX>
+inline void GenSortIndirect<T,INX>::swapInx (INX& i, INX& j)
 {
-    uInt t = i;
+    INX t = i;
     i = j;
     j = t;
 }
-template<class T>
-inline int GenSortIndirect<T>::isAscending (const T* data, Int i, Int j)
+template<class T, class INX>
+inline int GenSortIndirect<T,INX>::isAscending (const T* data, Int64 i, Int64 j)
 {
     return (data[i] > data[j]  ||  (data[i] == data[j]  &&  i > j));
 }
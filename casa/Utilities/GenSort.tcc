@@ -486,29 +486,29 @@ uInt GenSort<T>::sort (Block<T>& data, uInt nr, Sort::Order ord, int opt)
 
 
 
-template<class T>
-uInt GenSortIndirect<T>::sort (Vector<uInt>& indexVector, const Array<T>& data,
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::sort (Vector<INX>& indexVector, const Array<T>& data,
 			       Sort::Order ord, int opt)
 {
     Bool del;
     const T* dptr = data.getStorage(del);
-    uInt nr = sort (indexVector, dptr, data.nelements(), ord, opt);
+    INX nr = sort (indexVector, dptr, data.nelements(), ord, opt);
     data.freeStorage (dptr, del);
     return nr;
 }
 
-template<class T>
-uInt GenSortIndirect<T>::sort (Vector<uInt>& indexVector, const Block<T>& data,
-			       uInt nr, Sort::Order ord, int opt)
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::sort (Vector<INX>& indexVector, const Block<T>& data,
+			       INX nr, Sort::Order ord, int opt)
 {
     return sort (indexVector, data.storage(), min(nr, data.nelements()),
 		 ord, opt);
 }
 
 // Use quicksort if nothing given.
-template<class T>
-uInt GenSortIndirect<T>::sort (Vector<uInt>& indexVector, const T* data,
-			       uInt nr, Sort::Order ord, int opt)
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::sort (Vector<INX>& indexVector, const T* data,
+			       INX nr, Sort::Order ord, int opt)
 {
     // Fill the index vector with the indices.
     indexVector.resize (nr);
@@ -516,9 +516,9 @@ uInt GenSortIndirect<T>::sort (Vector<uInt>& indexVector, const T* data,
     // Pass the sort function a C-array of indices, because indexing
     // in there is (much) faster than in a vector.
     Bool del;
-    uInt* inx = indexVector.getStorage (del);
+    INX* inx = indexVector.getStorage (del);
     // Choose the sort required.
-    uInt n;
+    INX n;
     // Determine the default sort to use.
     if (opt - (opt&Sort::NoDuplicates) == Sort::DefaultSort) {
         int nthr = 1;
@@ -542,30 +542,30 @@ uInt GenSortIndirect<T>::sort (Vector<uInt>& indexVector, const T* data,
     // If n < nr, some duplicates have been deleted.
     // This means we have to resize the Vector.
     if (n < nr) {
-	Vector<uInt> vec(n);
+	Vector<INX> vec(n);
 	vec = indexVector (Slice(0,n));
 	indexVector.reference (vec);
     }
     return n;
 }
 
-template<class T>
-uInt GenSortIndirect<T>::insSort (uInt* inx, const T* data, uInt nr,
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::insSort (INX* inx, const T* data, INX nr,
 				  Sort::Order ord, int opt)
 {
-  uInt n = insSortAsc (inx, data, nr, opt);
+  INX n = insSortAsc (inx, data, nr, opt);
   if (ord == Sort::Descending) {
-    GenSort<uInt>::reverse (inx, inx, n);
+    GenSort<INX>::reverse (inx, inx, n);
   }
   return n;
 }
 
-template<class T>
-uInt GenSortIndirect<T>::quickSort (uInt* inx, const T* data, uInt nr,
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::quickSort (INX* inx, const T* data, INX nr,
 				    Sort::Order ord, int opt)
 {
   // Use quicksort to do rough sorting. expected recursion limit log2(nr)
-  uInt unr = nr;
+  INX unr = nr;
   Int rec_limit = 0;
   while (unr >>= 1)  {
     rec_limit++;
@@ -578,23 +578,23 @@ uInt GenSortIndirect<T>::quickSort (uInt* inx, const T* data, uInt nr,
   return insSort (inx, data, nr, ord, opt);
 }
 
-template<class T>
-uInt GenSortIndirect<T>::heapSort (uInt* inx, const T* data, uInt nr,
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::heapSort (INX* inx, const T* data, INX nr,
 				   Sort::Order ord, int opt)
 {
-  uInt n = nr;
+  INX n = nr;
   heapSortAsc (inx, data, nr);
   if ((opt & Sort::NoDuplicates) != 0) {
     n = insSortAscNoDup (inx, data, nr);
   }
   if (ord == Sort::Descending) {
-    GenSort<uInt>::reverse (inx, inx, n);
+    GenSort<INX>::reverse (inx, inx, n);
   }
   return n;
 }
 
-template<class T>
-uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::parSort (INX* inx, const T* data, INX nr,
                                   Sort::Order ord, int opt, int nthread)
 {
   int nthr = nthread;    // to avoid compiler warning
@@ -602,20 +602,20 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
   if (nthread > 0) {
     nthr = nthread;
     // Do not use more threads than there are values.
-    if (uInt(nthr) > nr) nthr = nr;
+    if (INX(nthr) > nr) nthr = nr;
   } else {
     nthr = omp_get_max_threads();
-    if (uInt(nthr) > nr) nthr = nr;
+    if (INX(nthr) > nr) nthr = nr;
   }
 #else
   nthr = 1;
 #endif
-  Block<uInt> index(nr+1);
-  Block<uInt> tinx(nthr+1);
-  Block<uInt> np(nthr);
+  Block<INX> index(nr+1);
+  Block<INX> tinx(nthr+1);
+  Block<INX> np(nthr);
   // Determine ordered parts in the array.
   // It is done in parallel, whereafter the parts are combined.
-  int step = nr/nthr;
+  INX step = nr/nthr;
   for (int i=0; i<nthr; ++i) tinx[i] = i*step;
   tinx[nthr] = nr;
 #ifdef _OPENMP
@@ -624,7 +624,7 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
   for (int i=0; i<nthr; ++i) {
     int nparts = 1;
     index[tinx[i]] = tinx[i];
-    for (uInt j=tinx[i]+1; j<tinx[i+1]; ++j) {
+    for (INX j=tinx[i]+1; j<tinx[i+1]; ++j) {
       if (data[inx[j-1]] > data[inx[j]]) {
         index[tinx[i]+nparts] = j;    // out of order, thus new part
         nparts++;
@@ -634,7 +634,7 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
   }
   // Make index parts consecutive by shifting to the left.
   // See if last and next part can be combined.
-  uInt nparts = np[0];
+  INX nparts = np[0];
   for (int i=1; i<nthr; ++i) {
     if (data[tinx[i]-1] > data[tinx[i]]) {
       index[nparts++] = index[tinx[i]];
@@ -642,7 +642,7 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
     if (nparts == tinx[i]+1) {
       nparts += np[i]-1;
     } else {
-      for (uInt j=1; j<np[i]; ++j) {
+      for (INX j=1; j<np[i]; ++j) {
 	index[nparts++] = index[tinx[i]+j];
       }
     }
@@ -651,8 +651,8 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
   //cout<<"nparts="<<nparts<<endl;
   // Merge the array parts. Each part is ordered.
   if (nparts < nr) {
-    Block<uInt> inxtmp(nr);
-    uInt* res = merge (data, inx, inxtmp.storage(), nr,
+    Block<INX> inxtmp(nr);
+    INX* res = merge (data, inx, inxtmp.storage(), nr,
                        index.storage(), nparts);
     // Skip duplicates if needed.
     if ((opt & Sort::NoDuplicates) != 0) {
@@ -660,7 +660,7 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
     }
     // Result is in ascending order; reverse if descending is needed.
     if (ord == Sort::Descending) {
-      GenSort<uInt>::reverse (inx, res, nr);
+      GenSort<INX>::reverse (inx, res, nr);
     } else if (res != inx) {
       // The final result must end up in inx.
       objcopy (inx, res, nr);
@@ -669,24 +669,24 @@ uInt GenSortIndirect<T>::parSort (uInt* inx, const T* data, uInt nr,
     // Each part has length 1, so the array is in reversed order and unique.
     // Reverse if ascending is needed.
     if (ord == Sort::Ascending) {
-      GenSort<uInt>::reverse (inx, inx, nr);
+      GenSort<INX>::reverse (inx, inx, nr);
     }
   }
   return nr;
 }  
 
-template<class T>
-uInt* GenSortIndirect<T>::merge (const T* data, uInt* inx, uInt* tmp, uInt nr,
-                                 uInt* index, uInt nparts)
+template<class T, class INX>
+INX* GenSortIndirect<T,INX>::merge (const T* data, INX* inx, INX* tmp, INX nr,
+                                 INX* index, INX nparts)
 {
-  uInt* a = inx;
-  uInt* b = tmp;
+  INX* a = inx;
+  INX* b = tmp;
   int np = nparts;
   // If the nr of parts is odd, the last part is not merged. To avoid having
   // to copy it to the other array, a pointer 'last' is kept.
   // Note that merging the previous part with the last part works fine, even
   // if the last part is in the same buffer.
-  uInt* last = inx + index[np-1];
+  INX* last = inx + index[np-1];
   while (np > 1) {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic)
@@ -694,17 +694,17 @@ uInt* GenSortIndirect<T>::merge (const T* data, uInt* inx, uInt* tmp, uInt nr,
     for (int i=0; i<np; i+=2) {
       if (i < np-1) {
         // Merge 2 subsequent parts of the array.
-	uInt* f1 = a+index[i];
-	uInt* f2 = a+index[i+1];
-	uInt* to = b+index[i];
-	uInt na = index[i+1]-index[i];
-	uInt nb = index[i+2]-index[i+1];
+	INX* f1 = a+index[i];
+	INX* f2 = a+index[i+1];
+	INX* to = b+index[i];
+	INX na = index[i+1]-index[i];
+	INX nb = index[i+2]-index[i+1];
         if (i == np-2) {
           //cout<<"swap last np=" <<np<<endl;
           f2 = last;
           last = to;
         }
-	uInt ia=0, ib=0, k=0;
+	INX ia=0, ib=0, k=0;
 	while (ia < na && ib < nb) {
 	  if (data[f1[ia]] <= data[f2[ib]]) {
 	    to[k] = f1[ia++];
@@ -714,9 +714,9 @@ uInt* GenSortIndirect<T>::merge (const T* data, uInt* inx, uInt* tmp, uInt nr,
 	  k++;
 	}
 	if (ia < na) {
-	  for (uInt p=ia; p<na; p++,k++) to[k] = f1[p];
+	  for (INX p=ia; p<na; p++,k++) to[k] = f1[p];
 	} else {
-	  for (uInt p=ib; p<nb; p++,k++) to[k] = f2[p];
+	  for (INX p=ib; p<nb; p++,k++) to[k] = f2[p];
 	}
       }
     }
@@ -726,7 +726,7 @@ uInt* GenSortIndirect<T>::merge (const T* data, uInt* inx, uInt* tmp, uInt nr,
     index[k] = nr;
     np = k;
     // Swap the index target and destination.
-    uInt* c = a;
+    INX* c = a;
     a = b;
     b = c;
   }
@@ -735,8 +735,8 @@ uInt* GenSortIndirect<T>::merge (const T* data, uInt* inx, uInt* tmp, uInt nr,
 
 
 
-template<class T>
-void GenSortIndirect<T>::quickSortAsc (uInt* inx, const T* data, Int nr,
+template<class T, class INX>
+void GenSortIndirect<T,INX>::quickSortAsc (INX* inx, const T* data, Int64 nr,
                                        Bool multiThread, Int rec_lim)
 {
     if (nr <= 32) {
@@ -747,9 +747,9 @@ void GenSortIndirect<T>::quickSortAsc (uInt* inx, const T* data, Int nr,
       heapSortAsc(inx, data, nr);
       return;
     }
-    uInt* mid= inx + (nr-1)/2;
-    uInt* sf = inx;
-    uInt* sl = inx+nr-1;
+    INX* mid= inx + (nr-1)/2;
+    INX* sf = inx;
+    INX* sl = inx+nr-1;
     if (isAscending (data, *sf, *mid))
 	swapInx (*sf, *mid);
     if (isAscending (data, *sf, *sl))
@@ -757,7 +757,7 @@ void GenSortIndirect<T>::quickSortAsc (uInt* inx, const T* data, Int nr,
     if (isAscending (data, *sl, *mid))
 	swapInx (*sl, *mid);
     T partVal = data[*sl];
-    uInt partInx = *sl;
+    INX partInx = *sl;
     // Compare indices in case the keys are equal.
     // This ensures that the sort is stable.
     sf++;
@@ -775,7 +775,7 @@ void GenSortIndirect<T>::quickSortAsc (uInt* inx, const T* data, Int nr,
 	swapInx (*sf, *sl);
     }
     swapInx (*sf, inx[nr-1]);
-    Int n = sf-inx;
+    Int64 n = sf-inx;
     if (multiThread) {
         /* limit threads to what the code can do to not span unnecessary
          * workers */
@@ -797,18 +797,18 @@ void GenSortIndirect<T>::quickSortAsc (uInt* inx, const T* data, Int nr,
 }
 
 // Find the k-th largest element using a partial quicksort.
-template<class T>
-uInt GenSortIndirect<T>::kthLargest (T* data, uInt nr, uInt k)
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::kthLargest (T* data, INX nr, INX k)
 {
     if (k >= nr) {
 	throw (AipsError ("kthLargest(data, nr, k): k must be < nr"));
     }
     // Create and fill an index vector.
-    Vector<uInt> indexVector(nr);
+    Vector<INX> indexVector(nr);
     indgen(indexVector);
-    uInt* inx = indexVector.data();
-    Int st = 0;
-    Int end = Int(nr) - 1;
+    INX* inx = indexVector.data();
+    Int64 st = 0;
+    Int64 end = Int64(nr) - 1;
     // Partition until a set of 1 or 2 elements is left.
     while (end > st+1) {
 	// Choose a partition element by taking the median of the
@@ -816,9 +816,9 @@ uInt GenSortIndirect<T>::kthLargest (T* data, uInt nr, uInt k)
 	// Store the partition element at the end.
 	// Do not use Sedgewick\'s advise to store the partition element in
 	// data[nr-2]. This has dramatic results for reversed ordered arrays.
-	Int i = (st+end)/2;                      // middle element
-	uInt* sf = inx+st;                       // first element
-	uInt* sl = inx+end;                      // last element
+	Int64 i = (st+end)/2;                      // middle element
+	INX* sf = inx+st;                       // first element
+	INX* sl = inx+end;                      // last element
 	if (data[inx[i]] < data[*sf])
 	    swapInx (inx[i], *sf);
 	if (data[*sl] < data[*sf])
@@ -837,8 +837,8 @@ uInt GenSortIndirect<T>::kthLargest (T* data, uInt nr, uInt k)
 	// Determine index of partitioning and update the start and end
 	// to take left or right part.
 	i = sf-inx;
-	if (i <= Int(k)) st = i;
-	if (i >= Int(k)) end = i;
+	if (i <= Int64(k)) st = i;
+	if (i >= Int64(k)) end = i;
     }
     if (end == st+1) {
       if (data[inx[st]] > data[inx[end]]) {
@@ -849,9 +849,9 @@ uInt GenSortIndirect<T>::kthLargest (T* data, uInt nr, uInt k)
 }
 
 // Do an insertion sort in ascending order.
-template<class T>
-uInt GenSortIndirect<T>::insSortAsc (uInt* inx, const T* data,
-				     Int nr, int opt)
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::insSortAsc (INX* inx, const T* data,
+				     Int64 nr, int opt)
 {
     if ((opt & Sort::NoDuplicates) == 0) {
 	return insSortAscDup (inx, data, nr);
@@ -862,12 +862,12 @@ uInt GenSortIndirect<T>::insSortAsc (uInt* inx, const T* data,
 
 // Do an insertion sort in ascending order.
 // Keep duplicate elements.
-template<class T>
-uInt GenSortIndirect<T>::insSortAscDup (uInt* inx, const T* data, Int nr)
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::insSortAscDup (INX* inx, const T* data, Int64 nr)
 {
-    Int  j;
-    uInt cur;
-    for (Int i=1; i<nr; i++) {
+    Int64  j;
+    INX cur;
+    for (Int64 i=1; i<nr; i++) {
 	j   = i;
 	cur = inx[i];
 	while (j>0  &&  isAscending (data, inx[j-1], cur)) {
@@ -881,16 +881,16 @@ uInt GenSortIndirect<T>::insSortAscDup (uInt* inx, const T* data, Int nr)
 
 // Do an insertion sort in ascending order.
 // Skip duplicate elements.
-template<class T>
-uInt GenSortIndirect<T>::insSortAscNoDup (uInt* inx, const T* data, Int nr)
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::insSortAscNoDup (INX* inx, const T* data, Int64 nr)
 {
     if (nr < 2) {
 	return nr;                                // nothing to sort
     }
-    Int  j, k;
-    uInt cur;
-    Int n = 1;
-    for (Int i=1; i<nr; i++) {
+    Int64  j, k;
+    INX cur;
+    Int64 n = 1;
+    for (Int64 i=1; i<nr; i++) {
 	j   = n;
 	cur = inx[i];
 	while (j>0  &&  data[inx[j-1]] > data[cur]) {
@@ -908,13 +908,13 @@ uInt GenSortIndirect<T>::insSortAscNoDup (uInt* inx, const T* data, Int nr)
 }
 
 // Do a heapsort in ascending order.
-template<class T>
-void GenSortIndirect<T>::heapSortAsc (uInt* inx, const T* data, Int nr)
+template<class T, class INX>
+void GenSortIndirect<T,INX>::heapSortAsc (INX* inx, const T* data, Int64 nr)
 {
     // Use the heapsort algorithm described by Jon Bentley in
     // UNIX Review, August 1992.
     inx--;
-    Int j;
+    Int64 j;
     for (j=nr/2; j>=1; j--) {
 	heapAscSiftDown (inx, j, nr, data);
     }
@@ -924,13 +924,13 @@ void GenSortIndirect<T>::heapSortAsc (uInt* inx, const T* data, Int nr)
     }
 }
 
-template<class T>
-void GenSortIndirect<T>::heapAscSiftDown (uInt* inx, Int low, Int up,
+template<class T, class INX>
+void GenSortIndirect<T,INX>::heapAscSiftDown (INX* inx, Int64 low, Int64 up,
 					  const T* data)
 {
-    uInt sav = inx[low];
-    Int c;
-    Int i;
+    INX sav = inx[low];
+    Int64 c;
+    Int64 i;
     for (i=low; (c=2*i)<=up; i=c) {
 	if (c < up  &&  isAscending (data, inx[c+1], inx[c])) {
 	    c++;
@@ -79,38 +79,39 @@ SortKey& SortKey::operator= (const SortKey& that)
     return *this;
 }
 
-uInt SortKey::tryGenSort (Vector<uInt>& indexVector, uInt nrrec, int opt) const
+template<typename T>
+T SortKey::tryGenSort (Vector<T>& indexVector, T nrrec, int opt) const
 {
     Sort::Order ord = (order_p < 0  ?  Sort::Ascending : Sort::Descending);
     DataType dtype = cmpObj_p->dataType();
     if (dtype == TpDouble) {
 	if (incr_p == sizeof(Double)) {
-	    return GenSortIndirect<Double>::sort (indexVector, (Double*)data_p,
+	    return GenSortIndirect<Double,T>::sort (indexVector, (Double*)data_p,
 						  nrrec, ord, opt);
 	}
     } else if (dtype == TpFloat) {
 	if (incr_p == sizeof(Float)) {
-	    return GenSortIndirect<Float>::sort (indexVector, (Float*)data_p,
+	    return GenSortIndirect<Float,T>::sort (indexVector, (Float*)data_p,
 						 nrrec, ord, opt);
 	}
     } else if (dtype == TpUInt) {
 	if (incr_p == sizeof(uInt)) {
-	    return GenSortIndirect<uInt>::sort (indexVector, (uInt*)data_p,
+	    return GenSortIndirect<uInt,T>::sort (indexVector, (uInt*)data_p,
 						nrrec, ord, opt);
 	}
     } else if (dtype == TpInt) {
 	if (incr_p == sizeof(Int)) {
-	    return GenSortIndirect<Int>::sort (indexVector, (Int*)data_p,
+	    return GenSortIndirect<Int,T>::sort (indexVector, (Int*)data_p,
 					       nrrec, ord, opt);
 	}
     } else if (dtype == TpInt64) {
 	if (incr_p == sizeof(Int64)) {
-	    return GenSortIndirect<Int64>::sort (indexVector, (Int64*)data_p,
+	    return GenSortIndirect<Int64,T>::sort (indexVector, (Int64*)data_p,
                                                  nrrec, ord, opt);
 	}
     } else if (dtype == TpString) {
 	if (incr_p == sizeof(String)) {
-	    return GenSortIndirect<String>::sort (indexVector, (String*)data_p,
+	    return GenSortIndirect<String,T>::sort (indexVector, (String*)data_p,
 						  nrrec, ord, opt);
 	}
     }
@@ -228,15 +229,39 @@ void Sort::addKey (SortKey* key)
 
 uInt Sort::unique (Vector<uInt>& uniqueVector, uInt nrrec) const
 {
-    Vector<uInt> indexVector(nrrec);
-    indgen (indexVector);
-    return unique (uniqueVector, indexVector);
+    return doUnique (uniqueVector, nrrec);
+}
+
+uInt64 Sort::unique (Vector<uInt64>& uniqueVector, uInt64 nrrec) const
+{
+    return doUnique (uniqueVector, nrrec);
 }
 
 uInt Sort::unique (Vector<uInt>& uniqueVector,
 		   const Vector<uInt>& indexVector) const
 {
-    uInt nrrec = indexVector.nelements();
+    return doUnique (uniqueVector, indexVector);
+}
+
+uInt64 Sort::unique (Vector<uInt64>& uniqueVector,
+                     const Vector<uInt64>& indexVector) const
+{
+    return doUnique (uniqueVector, indexVector);
+}
+
+template<typename T>
+T Sort::doUnique (Vector<T>& uniqueVector, T nrrec) const
+{
+    Vector<T> indexVector(nrrec);
+    indgen (indexVector);
+    return doUnique (uniqueVector, indexVector);
+}
+
+template<typename T>
+T Sort::doUnique (Vector<T>& uniqueVector,
+                  const Vector<T>& indexVector) const
+{
+    T nrrec = indexVector.nelements();
     uniqueVector.resize (nrrec);
     if (nrrec == 0) {
         return 0;
@@ -244,11 +269,11 @@ uInt Sort::unique (Vector<uInt>& uniqueVector,
     // Pass the sort function a C-array of indices, because indexing
     // in there is (much) faster than in a vector.
     Bool delInx, delUniq;
-    const uInt* inx = indexVector.getStorage (delInx);
-    uInt* uniq = uniqueVector.getStorage (delUniq);
+    const T* inx = indexVector.getStorage (delInx);
+    T* uniq = uniqueVector.getStorage (delUniq);
     uniq[0] = 0;
-    uInt nruniq = 1;
-    for (uInt i=1; i<nrrec; i++) {
+    T nruniq = 1;
+    for (T i=1; i<nrrec; i++) {
         Int cmp = compare (inx[i-1], inx[i]);
 	if (cmp != 1  &&  cmp != -1) {
 	    uniq[nruniq++] = i;
@@ -265,13 +290,26 @@ uInt Sort::unique (Vector<uInt>& uniqueVector,
 
 uInt Sort::sort (Vector<uInt>& indexVector, uInt nrrec, int opt,
                  Bool doTryGenSort) const
+{
+    return doSort (indexVector, nrrec, opt, doTryGenSort);
+}
+
+uInt64 Sort::sort (Vector<uInt64>& indexVector, uInt64 nrrec, int opt,
+                   Bool doTryGenSort) const
+{
+    return doSort (indexVector, nrrec, opt, doTryGenSort);
+}
+
+template<typename T>
+T Sort::doSort (Vector<T>& indexVector, T nrrec, int opt,
+                Bool doTryGenSort) const
 {
     if (nrrec == 0) {
         return nrrec;
     }
     //# Try if we can use the faster GenSort when we have one key only.
     if (doTryGenSort  &&  nrkey_p == 1) {
-	uInt n = keys_p[0]->tryGenSort (indexVector, nrrec, opt);
+	T n = keys_p[0]->tryGenSort (indexVector, nrrec, opt);
 	if (n > 0) {
 	    return n;
 	}
@@ -281,7 +319,7 @@ uInt Sort::sort (Vector<uInt>& indexVector, uInt nrrec, int opt,
     // Pass the sort function a C-array of indices, because indexing
     // in there is (much) faster than in a vector.
     Bool del;
-    uInt* inx = indexVector.getStorage (del);
+    T* inx = indexVector.getStorage (del);
     // Choose the sort required.
     int nodup = opt & NoDuplicates;
     int type  = opt - nodup;
@@ -290,12 +328,12 @@ uInt Sort::sort (Vector<uInt>& indexVector, uInt nrrec, int opt,
 #ifdef _OPENMP
     nthr = omp_get_max_threads();
     // Do not use more threads than there are values.
-    if (uInt(nthr) > nrrec) nthr = nrrec;
+    if (T(nthr) > nrrec) nthr = nrrec;
 #endif
     if (type == DefaultSort) {
       type = (nrrec<1000 || nthr==1  ?  QuickSort : ParSort);
     }
-    uInt n = 0;
+    T n = 0;
     switch (type) {
     case QuickSort:
 	if (nodup) {
@@ -336,14 +374,64 @@ uInt Sort::sort (Vector<uInt>& indexVector, uInt nrrec, int opt,
     return n;
 }
 
-uInt Sort::parSort (int nthr, uInt nrrec, uInt* inx) const
+uInt Sort::partialSort (Vector<uInt>& indexVector, uInt nrrec,
+                        uInt nrtop) const
+{
+    return doPartialSort (indexVector, nrrec, nrtop);
+}
+
+uInt64 Sort::partialSort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                          uInt64 nrtop) const
+{
+    return doPartialSort (indexVector, nrrec, nrtop);
+}
+
+template<typename T>
+T Sort::doPartialSort (Vector<T>& indexVector, T nrrec, T nrtop) const
+{
+    if (nrtop >= nrrec) {
+        return doSort (indexVector, nrrec, DefaultSort, True);
+    }
+    indexVector.resize (nrtop);
+    if (nrtop == 0) {
+        return 0;
+    }
+    indgen (indexVector);
+    Bool del;
+    T* inx = indexVector.getStorage (del);
+    // Make a heap of the first nrtop records, where the top (inx[1])
+    // is the last one in the sort order (siftDown works 1-relative).
+    inx--;
+    Int64 j;
+    for (j=nrtop/2; j>=1; j--) {
+        siftDown (j, nrtop, inx);
+    }
+    // A record that comes before the top replaces it.
+    for (T i=nrtop; i<nrrec; ++i) {
+        if (compare (i, inx[1]) > 0) {
+            inx[1] = i;
+            siftDown (1, nrtop, inx);
+        }
+    }
+    // Sort the heap.
+    for (j=nrtop; j>=2; j--) {
+        swap (1, j, inx);
+        siftDown (1, j-1, inx);
+    }
+    inx++;
+    indexVector.putStorage (inx, del);
+    return nrtop;
+}
+
+template<typename T>
+T Sort::parSort (int nthr, T nrrec, T* inx) const
 {
-  Block<uInt> index(nrrec+1);
-  Block<uInt> tinx(nthr+1);
-  Block<uInt> np(nthr);
+  Block<T> index(nrrec+1);
+  Block<T> tinx(nthr+1);
+  Block<T> np(nthr);
   // Determine ordered parts in the array.
   // It is done in parallel, whereafter the parts are combined.
-  int step = nrrec/nthr;
+  T step = nrrec/nthr;
   for (int i=0; i<nthr; ++i) tinx[i] = i*step;
   tinx[nthr] = nrrec;
 #ifdef _OPENMP
@@ -352,7 +440,7 @@ uInt Sort::parSort (int nthr, uInt nrrec, uInt* inx) const
   for (int i=0; i<nthr; ++i) {
     int nparts = 1;
     index[tinx[i]] = tinx[i];
-    for (uInt j=tinx[i]+1; j<tinx[i+1]; ++j) {
+    for (T j=tinx[i]+1; j<tinx[i+1]; ++j) {
       if (compare (inx[j-1], inx[j]) <= 0) {
         index[tinx[i]+nparts] = j;    // out of order, thus new part
         nparts++;
@@ -362,7 +450,7 @@ uInt Sort::parSort (int nthr, uInt nrrec, uInt* inx) const
   }
   // Make index parts consecutive by shifting to the left.
   // See if last and next part can be combined.
-  uInt nparts = np[0];
+  T nparts = np[0];
   for (int i=1; i<nthr; ++i) {
     if (compare (tinx[i]-1, tinx[i]) <= 0) {
       index[nparts++] = index[tinx[i]];
@@ -370,7 +458,7 @@ uInt Sort::parSort (int nthr, uInt nrrec, uInt* inx) const
     if (nparts == tinx[i]+1) {
       nparts += np[i]-1;
     } else {
-      for (uInt j=1; j<np[i]; ++j) {
+      for (T j=1; j<np[i]; ++j) {
 	index[nparts++] = index[tinx[i]+j];
       }
     }
@@ -379,26 +467,27 @@ uInt Sort::parSort (int nthr, uInt nrrec, uInt* inx) const
   //cout<<"nparts="<<nparts<<endl;
   // Merge the array parts. Each part is ordered.
   if (nparts < nrrec) {
-    Block<uInt> inxtmp(nrrec);
+    Block<T> inxtmp(nrrec);
     merge (inx, inxtmp.storage(), nrrec, index.storage(), nparts);
   } else {
     // Each part has length 1, so the array is in reversed order.
-    for (uInt i=0; i<nrrec; ++i) inx[i] = nrrec-1-i;
+    for (T i=0; i<nrrec; ++i) inx[i] = nrrec-1-i;
   }
   return nrrec;
 }  
 
-void Sort::merge (uInt* inx, uInt* tmp, uInt nrrec, uInt* index,
-                  uInt nparts) const
+template<typename T>
+void Sort::merge (T* inx, T* tmp, T nrrec, T* index,
+                  T nparts) const
 {
-  uInt* a = inx;
-  uInt* b = tmp;
+  T* a = inx;
+  T* b = tmp;
   int np = nparts;
   // If the nr of parts is odd, the last part is not merged. To avoid having
   // to copy it to the other array, a pointer 'last' is kept.
   // Note that merging the previous part with the last part works fine, even
   // if the last part is in the same buffer.
-  uInt* last = inx + index[np-1];
+  T* last = inx + index[np-1];
   while (np > 1) {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic)
@@ -406,17 +495,17 @@ void Sort::merge (uInt* inx, uInt* tmp, uInt nrrec, uInt* index,
     for (int i=0; i<np; i+=2) {
       if (i < np-1) {
         // Merge 2 subsequent parts of the array.
-	uInt* f1 = a+index[i];
-	uInt* f2 = a+index[i+1];
-	uInt* to = b+index[i];
-	uInt na = index[i+1]-index[i];
-	uInt nb = index[i+2]-index[i+1];
+	T* f1 = a+index[i];
+	T* f2 = a+index[i+1];
+	T* to = b+index[i];
+	T na = index[i+1]-index[i];
+	T nb = index[i+2]-index[i+1];
         if (i == np-2) {
           //cout<<"swap last np=" <<np<<endl;
           f2 = last;
           last = to;
         }
-	uInt ia=0, ib=0, k=0;
+	T ia=0, ib=0, k=0;
 	while (ia < na && ib < nb) {
 	  if (compare(f1[ia], f2[ib]) > 0) {
 	    to[k] = f1[ia++];
@@ -426,9 +515,9 @@ void Sort::merge (uInt* inx, uInt* tmp, uInt nrrec, uInt* index,
 	  k++;
 	}
 	if (ia < na) {
-	  for (uInt p=ia; p<na; p++,k++) to[k] = f1[p];
+	  for (T p=ia; p<na; p++,k++) to[k] = f1[p];
 	} else {
-	  for (uInt p=ib; p<nb; p++,k++) to[k] = f2[p];
+	  for (T p=ib; p<nb; p++,k++) to[k] = f2[p];
 	}
       }
     }
@@ -438,7 +527,7 @@ void Sort::merge (uInt* inx, uInt* tmp, uInt nrrec, uInt* index,
     index[k] = nrrec;
     np = k;
     // Swap the index target and destination.
-    uInt* c = a;
+    T* c = a;
     a = b;
     b = c;
   }
@@ -448,11 +537,12 @@ void Sort::merge (uInt* inx, uInt* tmp, uInt nrrec, uInt* index,
   }
 }
 
-uInt Sort::insSort (uInt nrrec, uInt* inx) const
+template<typename T>
+T Sort::insSort (T nrrec, T* inx) const
 {
-    Int  j;
-    uInt cur;
-    for (uInt i=1; i<nrrec; i++) {
+    Int64  j;
+    T cur;
+    for (T i=1; i<nrrec; i++) {
 	j   = i;
 	cur = inx[i];
 	while (--j>=0  &&  compare(inx[j], cur) <= 0) {
@@ -463,16 +553,17 @@ uInt Sort::insSort (uInt nrrec, uInt* inx) const
     return nrrec;
 }
 
-uInt Sort::insSortNoDup (uInt nrrec, uInt* inx) const
+template<typename T>
+T Sort::insSortNoDup (T nrrec, T* inx) const
 {
     if (nrrec < 2) {
 	return nrrec;                             // nothing to sort
     }
-    Int  j, k;
-    uInt cur;
-    uInt nr = 1;
+    Int64  j, k;
+    T cur;
+    T nr = 1;
     int  cmp = 0;
-    for (uInt i=1; i<nrrec; i++) {
+    for (T i=1; i<nrrec; i++) {
 	j   = nr;
 	cur = inx[i];
 	// Continue as long as key is out of order.
@@ -490,7 +581,8 @@ uInt Sort::insSortNoDup (uInt nrrec, uInt* inx) const
 }
 
 
-uInt Sort::quickSort (uInt nrrec, uInt* inx) const
+template<typename T>
+T Sort::quickSort (T nrrec, T* inx) const
 {
     // Use the quicksort algorithm and improvements as described
     // in "Algorithms in C" by R. Sedgewick.
@@ -500,14 +592,16 @@ uInt Sort::quickSort (uInt nrrec, uInt* inx) const
     return insSort (nrrec, inx);
 }
 
-uInt Sort::quickSortNoDup (uInt nrrec, uInt* inx) const
+template<typename T>
+T Sort::quickSortNoDup (T nrrec, T* inx) const
 {
     qkSort (nrrec, inx);
     return insSortNoDup (nrrec, inx);
 }
 
 
-void Sort::qkSort (Int nr, uInt* inx) const
+template<typename T>
+void Sort::qkSort (Int64 nr, T* inx) const
 {
     // If the nr of elements to be sorted is less than N, it is
     // better not to use quicksort anymore (according to Sedgewick).
@@ -521,7 +615,7 @@ void Sort::qkSort (Int nr, uInt* inx) const
     // rand is not a particularly good random number generator, but good
     // enough for this purpose.
     // Put this element at the beginning of the array.
-    Int p = rand() % nr;
+    Int64 p = rand() % nr;
     swap (0, p, inx);
     // Now shift all elements < partition-element to the left.
     // If an element is equal, shift every other element to avoid
@@ -529,8 +623,8 @@ void Sort::qkSort (Int nr, uInt* inx) const
     // UNIX Review, October 1992.
     // We do not have equal elements anymore (because of the stability
     // property introduced on 13-Feb-1995).
-    Int j = 0;
-    for (Int i=1; i<nr; i++) {
+    Int64 j = 0;
+    for (Int64 i=1; i<nr; i++) {
 	if (compare (inx[0], inx[i]) <= 0) {
 	    swap (i, ++j, inx);
 	}
@@ -541,11 +635,12 @@ void Sort::qkSort (Int nr, uInt* inx) const
 }
 
 
-uInt Sort::heapSort (uInt nrrec, uInt* inx) const
+template<typename T>
+T Sort::heapSort (T nrrec, T* inx) const
 {
     // Use the heapsort algorithm described by Jon Bentley in
     // UNIX Review, August 1992.
-    Int j;
+    Int64 j;
     inx--;
     for (j=nrrec/2; j>=1; j--) {
 	siftDown (j, nrrec, inx);
@@ -557,17 +652,19 @@ uInt Sort::heapSort (uInt nrrec, uInt* inx) const
     return nrrec;
 }
 
-uInt Sort::heapSortNoDup (uInt nrrec, uInt* inx) const
+template<typename T>
+T Sort::heapSortNoDup (T nrrec, T* inx) const
 {
     heapSort (nrrec, inx);
     return insSortNoDup (nrrec, inx);
 }
 
-void Sort::siftDown (Int low, Int up, uInt* inx) const
+template<typename T>
+void Sort::siftDown (Int64 low, Int64 up, T* inx) const
 {
-    uInt sav = inx[low];
-    Int c;
-    Int i;
+    T sav = inx[low];
+    Int64 c;
+    Int64 i;
     for (i=low; (c=2*i)<=up; i=c) {
 	if (c < up  &&  compare(inx[c+1], inx[c]) <= 0) {
 	    c++;
@@ -597,7 +694,7 @@ void Sort::siftDown (Int low, Int up, uInt* inx) const
 //    1   when data is equal and indices are in order
 //    0   when data is out of order
 //   -1   when data is equal and indices are out of order
-int Sort::compare (uInt i1, uInt i2) const
+int Sort::compare (uInt64 i1, uInt64 i2) const
 {
     int seq;
     SortKey* skp;
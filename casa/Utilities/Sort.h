@@ -80,7 +80,8 @@ public:
     // Try if GenSort can be used for this single key.
     // If it succeeds, it returns the resulting number of elements.
     // Otherwise it returns 0.
-    uInt tryGenSort (Vector<uInt>& indexVector, uInt nrrec, int opt) const;
+    template <typename T>
+    T tryGenSort (Vector<T>& indexVector, T nrrec, int opt) const;
 
     // Get the sort order.
     int order() const
@@ -327,8 +328,32 @@ public:
     // is resized to that number.
     // <br> By default it'll try if the faster GenSortIndirect can be used
     // if a sort on a single key is used.
+    // <br>The function taking a <src>Vector<uInt64></src> can be used to
+    // sort more than 4 billion records.
+    // <group>
     uInt sort (Vector<uInt>& indexVector, uInt nrrec,
 	       int options = DefaultSort, Bool tryGenSort = True) const;
+    uInt64 sort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                 int options = DefaultSort, Bool tryGenSort = True) const;
+    // </group>
+
+    // Sort the data array of <src>nrrec</src> records, but only determine
+    // the first <src>nrtop</src> records in the sort order.
+    // It gives the same order as the <src>sort</src> function, but it uses
+    // a heap of <src>nrtop</src> elements, so it is O(n*log(nrtop)) and
+    // much faster than a full sort if only a few records are needed
+    // (as in a query with an ORDERBY and LIMIT).
+    // It returns the number of resulting records (the minimum of
+    // <src>nrtop</src> and <src>nrrec</src>). The indices array is resized
+    // to that number.
+    // <br>Duplicates cannot be skipped, because it is unknown how many
+    // records are needed in that case.
+    // <group>
+    uInt partialSort (Vector<uInt>& indexVector, uInt nrrec,
+                      uInt nrtop) const;
+    uInt64 partialSort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                        uInt64 nrtop) const;
+    // </group>
 
     // Get all unique records in a sorted array. The array order is
     // given in the indexVector (as possibly returned by the sort function).
@@ -346,6 +371,9 @@ public:
     uInt unique (Vector<uInt>& uniqueVector, uInt nrrec) const;
     uInt unique (Vector<uInt>& uniqueVector,
 		 const Vector<uInt>& indexVector) const;
+    uInt64 unique (Vector<uInt64>& uniqueVector, uInt64 nrrec) const;
+    uInt64 unique (Vector<uInt64>& uniqueVector,
+                   const Vector<uInt64>& indexVector) const;
     // </group>
 
 private:
@@ -358,41 +386,66 @@ private:
     void addKey (SortKey*);
     // </group>
 
+    // The implementations of the sort and unique functions.
+    // They are templated on the index type (uInt or uInt64).
+    // <group>
+    template<typename T>
+    T doSort (Vector<T>& indexVector, T nrrec,
+              int options = DefaultSort, Bool tryGenSort = True) const;
+    template<typename T>
+    T doPartialSort (Vector<T>& indexVector, T nrrec, T nrtop) const;
+    template<typename T>
+    T doUnique (Vector<T>& uniqueVector, T nrrec) const;
+    template<typename T>
+    T doUnique (Vector<T>& uniqueVector, const Vector<T>& indexVector) const;
+    // </group>
+
     // Do an insertion sort, optionally skipping duplicates.
     // <group>
-    uInt insSort (uInt nr, uInt* indices) const;
-    uInt insSortNoDup (uInt nr, uInt* indices) const;
+    template<typename T>
+    T insSort (T nr, T* indices) const;
+    template<typename T>
+    T insSortNoDup (T nr, T* indices) const;
     // </group>
 
     // Do a merge sort, if possible in parallel using OpenMP.
     // Note that the env.var. OMP_NUM_TRHEADS sets the maximum nr of threads
     // to use. It defaults to the number of cores.
-    uInt parSort (int nthr, uInt nrrec, uInt* inx) const;
-    void merge (uInt* inx, uInt* tmp, uInt size, uInt* index,
-                uInt nparts) const;
+    template<typename T>
+    T parSort (int nthr, T nrrec, T* inx) const;
+    template<typename T>
+    void merge (T* inx, T* tmp, T size, T* index,
+                T nparts) const;
 
     // Do a quicksort, optionally skipping duplicates
     // (qkSort is the actual quicksort function).
     // <group>
-    uInt quickSort (uInt nr, uInt* indices) const;
-    uInt quickSortNoDup (uInt nr, uInt* indices) const;
-    void qkSort (Int nr, uInt* indices) const;
+    template<typename T>
+    T quickSort (T nr, T* indices) const;
+    template<typename T>
+    T quickSortNoDup (T nr, T* indices) const;
+    template<typename T>
+    void qkSort (Int64 nr, T* indices) const;
     // </group>
 
     // Do a heapsort, optionally skipping duplicates.
     // <group>
-    uInt heapSort (uInt nr, uInt* indices) const;
-    uInt heapSortNoDup (uInt nr, uInt* indices) const;
+    template<typename T>
+    T heapSort (T nr, T* indices) const;
+    template<typename T>
+    T heapSortNoDup (T nr, T* indices) const;
     // </group>
 
     // Siftdown algorithm for heapsort.
-    void siftDown (Int low, Int up, uInt* indices) const;
+    template<typename T>
+    void siftDown (Int64 low, Int64 up, T* indices) const;
 
     // Compare the keys of 2 records.
-    int compare (uInt index1, uInt index2) const;
+    int compare (uInt64 index1, uInt64 index2) const;
 
     // Swap 2 indices.
-    inline void swap (Int index1, Int index2, uInt* indices) const;
+    template<typename T>
+    inline void swap (Int64 index1, Int64 index2, T* indices) const;
 
 
     PtrBlock<SortKey*> keys_p;                    //# keys to sort on
@@ -404,9 +457,10 @@ private:
 
 
 
-inline void Sort::swap (Int i, Int j, uInt* inx) const
+template<typename T>
+inline void Sort::swap (Int64 i, Int64 j, T* inx) const
 {
-    uInt t = inx[i];
+    T t = inx[i];
     inx[i] = inx[j];
     inx[j] = t;
 }
@@ -32,6 +32,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/stdlib.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 #include <casacore/casa/namespace.h>
 // This program test the class Sort.
@@ -233,6 +234,48 @@ void sortall (int options, Sort::Order order)
     sortdo (options, sort2, order, data, nrdata);
 }
 
+// Check that a partial sort gives the first part of a full sort.
+void partialdo (const Sort& sort, uInt nrdata, uInt nrtop)
+{
+    Vector<uInt> inxvec;
+    sort.sort (inxvec, nrdata, Sort::HeapSort, False);
+    Vector<uInt> topvec;
+    uInt nr = sort.partialSort (topvec, nrdata, nrtop);
+    AlwaysAssertExit (nr == std::min(nrtop, nrdata));
+    AlwaysAssertExit (nr == topvec.nelements());
+    for (uInt i=0; i<nr; i++) {
+        AlwaysAssertExit (topvec(i) == inxvec(i));
+    }
+    Vector<uInt64> topvec64;
+    AlwaysAssertExit (sort.partialSort (topvec64, uInt64(nrdata),
+                                        uInt64(nrtop)) == nr);
+    for (uInt i=0; i<nr; i++) {
+        AlwaysAssertExit (topvec64(i) == inxvec(i));
+    }
+}
+
+// Test a partial sort with 1 and 2 keys and many equal keys.
+void partialall (Sort::Order order)
+{
+    const uInt nrdata = 1000;
+    Int data[nrdata];
+    Int data2[nrdata];
+    for (uInt i=0; i<nrdata; i++) {
+      data[i] = rand()%50;
+      data2[i] = rand()%10;
+    }
+    Sort sort;
+    sort.sortKey (data, TpInt, 0, order);
+    Sort sort2;
+    sort2.sortKey (data, TpInt, 0, order);
+    sort2.sortKey (data2, TpInt, 0, Sort::Ascending);
+    uInt nrtop[] = {0, 1, 2, 10, 100, 999, 1000, 2000};
+    for (uInt i=0; i<sizeof(nrtop)/sizeof(uInt); i++) {
+      partialdo (sort, nrdata, nrtop[i]);
+      partialdo (sort2, nrdata, nrtop[i]);
+    }
+}
+
 
 int main()
 {
@@ -259,5 +302,9 @@ int main()
     sortall (Sort::QuickSort | Sort::NoDuplicates, Sort::Descending);
     sortall (Sort::HeapSort | Sort::NoDuplicates, Sort::Descending);
 
+    // Partially sort an array.
+    partialall (Sort::Ascending);
+    partialall (Sort::Descending);
+
     return 0;                              // exit with success status
 }
@@ -38,6 +38,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 typedef long long Int64;
 typedef unsigned long long uInt64;
 
+// The type used for table row numbers and the number of rows in a table.
+// It is 64 bits to support tables with more than 4 billion rows.
+typedef uInt64 rownr_t;
+
 //# All FITS code seems to assume longs are 4 bytes. Currently
 //# this corresponds to an "int" on all useful platforms.
 typedef int FitsLong;
@@ -673,7 +673,7 @@ namespace casacore {
   }
 
 
-  void UDFMSCal::recreateColumnObjects (const Vector<uInt>& rownrs)
+  void UDFMSCal::recreateColumnObjects (const Vector<rownr_t>& rownrs)
   {
     if (! itsIdColName.empty()) {
       TableExprNodeRep* col = const_cast<TableExprNodeRep*>(itsIdNode.getNodeRep());
@@ -723,7 +723,8 @@ namespace casacore {
     case GETVALUE:
       {
         Int64 rownr = getRowNr(id);
-        if (itsArg < 0  &&  rownr >= itsDataNode.nrow()) {
+        if (itsArg < 0  &&  (rownr < 0  ||
+                             rownr_t(rownr) >= itsDataNode.nrow())) {
           return False;
         }
         return itsDataNode.getBool (rownr);
@@ -739,7 +740,8 @@ namespace casacore {
     case GETVALUE:
       {
         Int64 rownr = getRowNr(id);
-        if (itsArg < 0  &&  rownr >= itsDataNode.nrow()) {
+        if (itsArg < 0  &&  (rownr < 0  ||
+                             rownr_t(rownr) >= itsDataNode.nrow())) {
           return 0;
         }
         return itsDataNode.getInt (rownr);
@@ -764,7 +766,8 @@ namespace casacore {
     case GETVALUE:
       {
         Int64 rownr = getRowNr(id);
-        if (itsArg < 0  &&  rownr >= itsDataNode.nrow()) {
+        if (itsArg < 0  &&  (rownr < 0  ||
+                             rownr_t(rownr) >= itsDataNode.nrow())) {
           return 0.;
         }
         return itsDataNode.getDouble (rownr);
@@ -781,7 +784,8 @@ namespace casacore {
     case GETVALUE:
       {
         Int64 rownr = getRowNr(id);
-        if (itsArg < 0  &&  rownr >= itsDataNode.nrow()) {
+        if (itsArg < 0  &&  (rownr < 0  ||
+                             rownr_t(rownr) >= itsDataNode.nrow())) {
           return DComplex();
         }
         return itsDataNode.getDComplex (rownr);
@@ -798,7 +802,8 @@ namespace casacore {
     case GETVALUE:
       {
         Int64 rownr = getRowNr(id);
-        if (itsArg < 0  &&  rownr >= itsDataNode.nrow()) {
+        if (itsArg < 0  &&  (rownr < 0  ||
+                             rownr_t(rownr) >= itsDataNode.nrow())) {
           return String();
         }
         return itsDataNode.getString (rownr);
@@ -31,6 +31,7 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/ms/MSSel/MSTableIndex.h>
+#include <casacore/tables/Tables/RowNumbers.h>
 #include <casacore/ms/MeasurementSets/MSSourceColumns.h>
 
 #include <casacore/casa/Containers/RecordField.h>
@@ -104,7 +105,7 @@ public:
   Vector<Int> matchSourceCode(const String& code);
 
   //Return rows matching a SourceID
-  Vector<uInt> getRowNumbersOfSourceID(const Int sid);
+  RowNumbers getRowNumbersOfSourceID(const Int sid);
 
 
 protected:
@@ -114,7 +115,7 @@ protected:
   static Int compare (const Block<void*>& fieldPtrs,
                       const Block<void*>& dataPtrs,
                       const Block<Int>& dataTypes,
-                      Int index);
+                      rownr_t index);
   
 private:
   // Pointer to local MSSourceColumns object
@@ -74,17 +74,17 @@ String Adios2StMan::dataManagerName() const
 	return pimpl->dataManagerName();
 }
 
-void Adios2StMan::create(uInt aNrRows)
+void Adios2StMan::create(rownr_t aNrRows)
 {
 	pimpl->create(aNrRows);
 }
 
-void Adios2StMan::open(uInt aRowNr, AipsIO &ios)
+void Adios2StMan::open(rownr_t aRowNr, AipsIO &ios)
 {
 	pimpl->open(aRowNr, ios);
 }
 
-void Adios2StMan::resync(uInt aRowNr)
+void Adios2StMan::resync(rownr_t aRowNr)
 {
 	pimpl->resync(aRowNr);
 }
@@ -117,7 +117,7 @@ void Adios2StMan::deleteManager()
 	pimpl->deleteManager();
 }
 
-void Adios2StMan::addRow(uInt aNrRows)
+void Adios2StMan::addRow(rownr_t aNrRows)
 {
 	return pimpl->addRow(aNrRows);
 }
@@ -128,7 +128,7 @@ DataManager *Adios2StMan::makeObject(
 	return impl::makeObject(aDataManType, spec);
 }
 
-uInt Adios2StMan::getNrRows()
+rownr_t Adios2StMan::getNrRows()
 {
 	return pimpl->getNrRows();
 }
@@ -237,12 +237,12 @@ DataManager *Adios2StMan::impl::clone() const
 
 String Adios2StMan::impl::dataManagerType() const { return itsDataManName; }
 
-void Adios2StMan::impl::addRow(uInt aNrRows)
+void Adios2StMan::impl::addRow(rownr_t aNrRows)
 {
     itsRows += aNrRows;
 }
 
-void Adios2StMan::impl::create(uInt aNrRows)
+void Adios2StMan::impl::create(rownr_t aNrRows)
 {
     itsOpenMode = 'w';
     itsRows = aNrRows;
@@ -255,7 +255,7 @@ void Adios2StMan::impl::create(uInt aNrRows)
     itsAdiosEngine->BeginStep();
 }
 
-void Adios2StMan::impl::open(uInt aNrRows, AipsIO &ios)
+void Adios2StMan::impl::open(rownr_t aNrRows, AipsIO &ios)
 {
     itsOpenMode = 'r';
     itsRows = aNrRows;
@@ -367,9 +367,9 @@ DataManagerColumn *Adios2StMan::impl::makeColumnCommon(const String &name,
     return aColumn;
 }
 
-uInt Adios2StMan::impl::getNrRows() { return itsRows; }
+rownr_t Adios2StMan::impl::getNrRows() { return itsRows; }
 
-void Adios2StMan::impl::resync(uInt /*aNrRows*/) {}
+void Adios2StMan::impl::resync(rownr_t /*aNrRows*/) {}
 
 Bool Adios2StMan::impl::flush(AipsIO &ios, Bool /*doFsync*/)
 {
@@ -62,7 +62,7 @@ void Adios2StManColumn::setShapeColumn(const IPosition &aShape)
     }
 }
 
-IPosition Adios2StManColumn::shape(uInt aRowNr)
+IPosition Adios2StManColumn::shape(rownr_t aRowNr)
 {
     if(isShapeFixed)
     {
@@ -87,18 +87,18 @@ Bool Adios2StManColumn::canChangeShape() const
     return !isShapeFixed;
 }
 
-void Adios2StManColumn::setShape (uInt aRowNr, const IPosition& aShape)
+void Adios2StManColumn::setShape (rownr_t aRowNr, const IPosition& aShape)
 {
     itsCasaShapes[aRowNr] = aShape;
 }
 
-void Adios2StManColumn::scalarVToSelection(uInt rownr)
+void Adios2StManColumn::scalarVToSelection(rownr_t rownr)
 {
     itsAdiosStart[0] = rownr;
     itsAdiosCount[0] = 1;
 }
 
-void Adios2StManColumn::arrayVToSelection(uInt rownr)
+void Adios2StManColumn::arrayVToSelection(rownr_t rownr)
 {
     itsAdiosStart[0] = rownr;
     itsAdiosCount[0] = 1;
@@ -109,7 +109,7 @@ void Adios2StManColumn::arrayVToSelection(uInt rownr)
     }
 }
 
-void Adios2StManColumn::sliceVToSelection(uInt rownr, const Slicer &ns)
+void Adios2StManColumn::sliceVToSelection(rownr_t rownr, const Slicer &ns)
 {
     itsAdiosStart[0] = rownr;
     itsAdiosCount[0] = 1;
@@ -120,58 +120,58 @@ void Adios2StManColumn::sliceVToSelection(uInt rownr, const Slicer &ns)
     }
 }
 
-void Adios2StManColumn::putBoolV(uInt rownr, const Bool *dataPtr)
+void Adios2StManColumn::putBoolV(rownr_t rownr, const Bool *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putuCharV(uInt rownr, const uChar *dataPtr)
+void Adios2StManColumn::putuCharV(rownr_t rownr, const uChar *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putShortV(uInt rownr, const Short *dataPtr)
+void Adios2StManColumn::putShortV(rownr_t rownr, const Short *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putuShortV(uInt rownr, const uShort *dataPtr)
+void Adios2StManColumn::putuShortV(rownr_t rownr, const uShort *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putIntV(uInt rownr, const Int *dataPtr)
+void Adios2StManColumn::putIntV(rownr_t rownr, const Int *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putuIntV(uInt rownr, const uInt *dataPtr)
+void Adios2StManColumn::putuIntV(rownr_t rownr, const uInt *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putInt64V(uInt rownr, const Int64 *dataPtr)
+void Adios2StManColumn::putInt64V(rownr_t rownr, const Int64 *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putfloatV(uInt rownr, const Float *dataPtr)
+void Adios2StManColumn::putfloatV(rownr_t rownr, const Float *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putdoubleV(uInt rownr, const Double *dataPtr)
+void Adios2StManColumn::putdoubleV(rownr_t rownr, const Double *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putComplexV(uInt rownr, const Complex *dataPtr)
+void Adios2StManColumn::putComplexV(rownr_t rownr, const Complex *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::putDComplexV(uInt rownr, const DComplex *dataPtr)
+void Adios2StManColumn::putDComplexV(rownr_t rownr, const DComplex *dataPtr)
 {
     putScalarV(rownr, dataPtr);
 }
 
 #define DEFINE_GETPUTSLICE(T) \
-void Adios2StManColumn::putSlice ## T ## V(uInt rownr, const Slicer& ns, const Array<T>* dataPtr) \
+void Adios2StManColumn::putSlice ## T ## V(rownr_t rownr, const Slicer& ns, const Array<T>* dataPtr) \
 { \
     putSliceV(rownr, ns, dataPtr); \
 }\
 \
-void Adios2StManColumn::getSlice ## T ## V(uInt rownr, const Slicer& ns, Array<T>* dataPtr) \
+void Adios2StManColumn::getSlice ## T ## V(rownr_t rownr, const Slicer& ns, Array<T>* dataPtr) \
 { \
     getSliceV(rownr, ns, dataPtr); \
 }
@@ -189,47 +189,47 @@ DEFINE_GETPUTSLICE(DComplex)
 DEFINE_GETPUTSLICE(String)
 #undef DEFINE_PUTSLICE
 
-void Adios2StManColumn::getBoolV(uInt rownr, Bool *dataPtr)
+void Adios2StManColumn::getBoolV(rownr_t rownr, Bool *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getuCharV(uInt rownr, uChar *dataPtr)
+void Adios2StManColumn::getuCharV(rownr_t rownr, uChar *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getShortV(uInt rownr, Short *dataPtr)
+void Adios2StManColumn::getShortV(rownr_t rownr, Short *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getuShortV(uInt rownr, uShort *dataPtr)
+void Adios2StManColumn::getuShortV(rownr_t rownr, uShort *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getIntV(uInt rownr, Int *dataPtr)
+void Adios2StManColumn::getIntV(rownr_t rownr, Int *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getuIntV(uInt rownr, uInt *dataPtr)
+void Adios2StManColumn::getuIntV(rownr_t rownr, uInt *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getInt64V(uInt rownr, Int64 *dataPtr)
+void Adios2StManColumn::getInt64V(rownr_t rownr, Int64 *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getfloatV(uInt rownr, Float *dataPtr)
+void Adios2StManColumn::getfloatV(rownr_t rownr, Float *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getdoubleV(uInt rownr, Double *dataPtr)
+void Adios2StManColumn::getdoubleV(rownr_t rownr, Double *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getComplexV(uInt rownr, Complex *dataPtr)
+void Adios2StManColumn::getComplexV(rownr_t rownr, Complex *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
-void Adios2StManColumn::getDComplexV(uInt rownr, DComplex *dataPtr)
+void Adios2StManColumn::getDComplexV(rownr_t rownr, DComplex *dataPtr)
 {
     getScalarV(rownr, dataPtr);
 }
@@ -243,7 +243,7 @@ void Adios2StManColumnT<std::string>::create(std::shared_ptr<adios2::Engine> aAd
     itsAdiosOpenMode = aOpenMode;
 }
 
-void Adios2StManColumn::putStringV(uInt rownr, const String *dataPtr)
+void Adios2StManColumn::putStringV(rownr_t rownr, const String *dataPtr)
 {
     std::string variableName = static_cast<std::string>(itsColumnName) + std::to_string(rownr);
     adios2::Variable<std::string> v = itsAdiosIO->InquireVariable<std::string>(variableName);
@@ -254,7 +254,7 @@ void Adios2StManColumn::putStringV(uInt rownr, const String *dataPtr)
     itsAdiosEngine->Put(v, reinterpret_cast<const std::string *>(dataPtr), adios2::Mode::Sync);
 }
 
-void Adios2StManColumn::getStringV(uInt rownr, String *dataPtr)
+void Adios2StManColumn::getStringV(rownr_t rownr, String *dataPtr)
 {
     std::string variableName = static_cast<std::string>(itsColumnName) + std::to_string(rownr);
     adios2::Variable<std::string> v = itsAdiosIO->InquireVariable<std::string>(variableName);
@@ -265,7 +265,7 @@ void Adios2StManColumn::getStringV(uInt rownr, String *dataPtr)
 }
 
 template<>
-void Adios2StManColumnT<std::string>::putArrayV(uInt rownr, const void *dataPtr)
+void Adios2StManColumnT<std::string>::putArrayV(rownr_t rownr, const void *dataPtr)
 {
     String combined;
     Bool deleteIt;
@@ -279,7 +279,7 @@ void Adios2StManColumnT<std::string>::putArrayV(uInt rownr, const void *dataPtr)
 }
 
 template<>
-void Adios2StManColumnT<std::string>::getArrayV(uInt rownr, void *dataPtr)
+void Adios2StManColumnT<std::string>::getArrayV(rownr_t rownr, void *dataPtr)
 {
     String combined;
     getStringV(rownr, &combined);
@@ -299,13 +299,13 @@ void Adios2StManColumnT<std::string>::getArrayV(uInt rownr, void *dataPtr)
 }
 
 template<>
-void Adios2StManColumnT<std::string>::getSliceV(uInt /*aRowNr*/, const Slicer &/*ns*/, void */*dataPtr*/)
+void Adios2StManColumnT<std::string>::getSliceV(rownr_t /*aRowNr*/, const Slicer &/*ns*/, void */*dataPtr*/)
 {
     throw std::runtime_error("Not implemented yet");
 }
 
 template<>
-void Adios2StManColumnT<std::string>::putSliceV(uInt /*aRowNr*/, const Slicer &/*ns*/, const void */*dataPtr*/)
+void Adios2StManColumnT<std::string>::putSliceV(rownr_t /*aRowNr*/, const Slicer &/*ns*/, const void */*dataPtr*/)
 {
     throw std::runtime_error("Not implemented yet");
 }
@@ -50,78 +50,78 @@ public:
     virtual void create(std::shared_ptr<adios2::Engine> aAdiosEngine,
                         char aOpenMode) = 0;
     virtual void setShapeColumn(const IPosition &aShape);
-    virtual IPosition shape(uInt aRowNr);
+    virtual IPosition shape(rownr_t aRowNr);
     Bool canChangeShape() const;
-    void setShape (uInt aRowNr, const IPosition& aShape);
+    void setShape (rownr_t aRowNr, const IPosition& aShape);
 
     int getDataTypeSize();
     int getDataType();
     String getColumnName();
 
-    virtual void putScalarV(uInt aRowNr, const void *aDataPtr) = 0;
-    virtual void getScalarV(uInt aRowNr, void *aDataPtr) = 0;
-
-    virtual void putBoolV(uInt aRowNr, const Bool *aDataPtr);
-    virtual void putuCharV(uInt aRowNr, const uChar *aDataPtr);
-    virtual void putShortV(uInt aRowNr, const Short *aDataPtr);
-    virtual void putuShortV(uInt aRowNr, const uShort *aDataPtr);
-    virtual void putIntV(uInt aRowNr, const Int *aDataPtr);
-    virtual void putuIntV(uInt aRowNr, const uInt *aDataPtr);
-    virtual void putInt64V(uInt aRowNr, const Int64 *aDataPtr);
-    virtual void putfloatV(uInt aRowNr, const Float *aDataPtr);
-    virtual void putdoubleV(uInt aRowNr, const Double *aDataPtr);
-    virtual void putComplexV(uInt aRowNr, const Complex *aDataPtr);
-    virtual void putDComplexV(uInt aRowNr, const DComplex *aDataPtr);
-    virtual void putStringV(uInt aRowNr, const String *aDataPtr);
-
-    virtual void getBoolV(uInt aRowNr, Bool *aDataPtr);
-    virtual void getuCharV(uInt aRowNr, uChar *aDataPtr);
-    virtual void getShortV(uInt aRowNr, Short *aDataPtr);
-    virtual void getuShortV(uInt aRowNr, uShort *aDataPtr);
-    virtual void getIntV(uInt aRowNr, Int *aDataPtr);
-    virtual void getuIntV(uInt aRowNr, uInt *aDataPtr);
-    virtual void getInt64V(uInt aRowNr, Int64 *aDataPtr);
-    virtual void getfloatV(uInt aRowNr, Float *aDataPtr);
-    virtual void getdoubleV(uInt aRowNr, Double *aDataPtr);
-    virtual void getComplexV(uInt aRowNr, Complex *aDataPtr);
-    virtual void getDComplexV(uInt aRowNr, DComplex *aDataPtr);
-    virtual void getStringV(uInt aRowNr, String *aDataPtr);
-
-    virtual void putSliceBoolV(uInt rownr, const Slicer& ns, const Array<Bool>* dataPtr);
-    virtual void putSliceuCharV(uInt rownr, const Slicer& ns, const Array<uChar>* dataPtr);
-    virtual void putSliceShortV(uInt rownr, const Slicer& ns, const Array<Short>* dataPtr);
-    virtual void putSliceuShortV(uInt rownr, const Slicer& ns, const Array<uShort>* dataPtr);
-    virtual void putSliceIntV(uInt rownr, const Slicer& ns, const Array<Int>* dataPtr);
-    virtual void putSliceuIntV(uInt rownr, const Slicer& ns, const Array<uInt>* dataPtr);
-    virtual void putSlicefloatV(uInt rownr, const Slicer& ns, const Array<float>* dataPtr);
-    virtual void putSlicedoubleV(uInt rownr, const Slicer& ns, const Array<double>* dataPtr);
-    virtual void putSliceComplexV(uInt rownr, const Slicer& ns, const Array<Complex>* dataPtr);
-    virtual void putSliceDComplexV(uInt rownr, const Slicer& ns, const Array<DComplex>* dataPtr);
-    virtual void putSliceStringV(uInt rownr, const Slicer& ns, const Array<String>* dataPtr);
-
-    virtual void getSliceBoolV(uInt rownr, const Slicer& ns, Array<Bool>* dataPtr);
-    virtual void getSliceuCharV(uInt rownr, const Slicer& ns, Array<uChar>* dataPtr);
-    virtual void getSliceShortV(uInt rownr, const Slicer& ns, Array<Short>* dataPtr);
-    virtual void getSliceuShortV(uInt rownr, const Slicer& ns, Array<uShort>* dataPtr);
-    virtual void getSliceIntV(uInt rownr, const Slicer& ns, Array<Int>* dataPtr);
-    virtual void getSliceuIntV(uInt rownr, const Slicer& ns, Array<uInt>* dataPtr);
-    virtual void getSlicefloatV(uInt rownr, const Slicer& ns, Array<float>* dataPtr);
-    virtual void getSlicedoubleV(uInt rownr, const Slicer& ns, Array<double>* dataPtr);
-    virtual void getSliceComplexV(uInt rownr, const Slicer& ns, Array<Complex>* dataPtr);
-    virtual void getSliceDComplexV(uInt rownr, const Slicer& ns, Array<DComplex>* dataPtr);
-    virtual void getSliceStringV(uInt rownr, const Slicer& ns, Array<String>* dataPtr);
+    virtual void putScalarV(rownr_t aRowNr, const void *aDataPtr) = 0;
+    virtual void getScalarV(rownr_t aRowNr, void *aDataPtr) = 0;
+
+    virtual void putBoolV(rownr_t aRowNr, const Bool *aDataPtr);
+    virtual void putuCharV(rownr_t aRowNr, const uChar *aDataPtr);
+    virtual void putShortV(rownr_t aRowNr, const Short *aDataPtr);
+    virtual void putuShortV(rownr_t aRowNr, const uShort *aDataPtr);
+    virtual void putIntV(rownr_t aRowNr, const Int *aDataPtr);
+    virtual void putuIntV(rownr_t aRowNr, const uInt *aDataPtr);
+    virtual void putInt64V(rownr_t aRowNr, const Int64 *aDataPtr);
+    virtual void putfloatV(rownr_t aRowNr, const Float *aDataPtr);
+    virtual void putdoubleV(rownr_t aRowNr, const Double *aDataPtr);
+    virtual void putComplexV(rownr_t aRowNr, const Complex *aDataPtr);
+    virtual void putDComplexV(rownr_t aRowNr, const DComplex *aDataPtr);
+    virtual void putStringV(rownr_t aRowNr, const String *aDataPtr);
+
+    virtual void getBoolV(rownr_t aRowNr, Bool *aDataPtr);
+    virtual void getuCharV(rownr_t aRowNr, uChar *aDataPtr);
+    virtual void getShortV(rownr_t aRowNr, Short *aDataPtr);
+    virtual void getuShortV(rownr_t aRowNr, uShort *aDataPtr);
+    virtual void getIntV(rownr_t aRowNr, Int *aDataPtr);
+    virtual void getuIntV(rownr_t aRowNr, uInt *aDataPtr);
+    virtual void getInt64V(rownr_t aRowNr, Int64 *aDataPtr);
+    virtual void getfloatV(rownr_t aRowNr, Float *aDataPtr);
+    virtual void getdoubleV(rownr_t aRowNr, Double *aDataPtr);
+    virtual void getComplexV(rownr_t aRowNr, Complex *aDataPtr);
+    virtual void getDComplexV(rownr_t aRowNr, DComplex *aDataPtr);
+    virtual void getStringV(rownr_t aRowNr, String *aDataPtr);
+
+    virtual void putSliceBoolV(rownr_t rownr, const Slicer& ns, const Array<Bool>* dataPtr);
+    virtual void putSliceuCharV(rownr_t rownr, const Slicer& ns, const Array<uChar>* dataPtr);
+    virtual void putSliceShortV(rownr_t rownr, const Slicer& ns, const Array<Short>* dataPtr);
+    virtual void putSliceuShortV(rownr_t rownr, const Slicer& ns, const Array<uShort>* dataPtr);
+    virtual void putSliceIntV(rownr_t rownr, const Slicer& ns, const Array<Int>* dataPtr);
+    virtual void putSliceuIntV(rownr_t rownr, const Slicer& ns, const Array<uInt>* dataPtr);
+    virtual void putSlicefloatV(rownr_t rownr, const Slicer& ns, const Array<float>* dataPtr);
+    virtual void putSlicedoubleV(rownr_t rownr, const Slicer& ns, const Array<double>* dataPtr);
+    virtual void putSliceComplexV(rownr_t rownr, const Slicer& ns, const Array<Complex>* dataPtr);
+    virtual void putSliceDComplexV(rownr_t rownr, const Slicer& ns, const Array<DComplex>* dataPtr);
+    virtual void putSliceStringV(rownr_t rownr, const Slicer& ns, const Array<String>* dataPtr);
+
+    virtual void getSliceBoolV(rownr_t rownr, const Slicer& ns, Array<Bool>* dataPtr);
+    virtual void getSliceuCharV(rownr_t rownr, const Slicer& ns, Array<uChar>* dataPtr);
+    virtual void getSliceShortV(rownr_t rownr, const Slicer& ns, Array<Short>* dataPtr);
+    virtual void getSliceuShortV(rownr_t rownr, const Slicer& ns, Array<uShort>* dataPtr);
+    virtual void getSliceIntV(rownr_t rownr, const Slicer& ns, Array<Int>* dataPtr);
+    virtual void getSliceuIntV(rownr_t rownr, const Slicer& ns, Array<uInt>* dataPtr);
+    virtual void getSlicefloatV(rownr_t rownr, const Slicer& ns, Array<float>* dataPtr);
+    virtual void getSlicedoubleV(rownr_t rownr, const Slicer& ns, Array<double>* dataPtr);
+    virtual void getSliceComplexV(rownr_t rownr, const Slicer& ns, Array<Complex>* dataPtr);
+    virtual void getSliceDComplexV(rownr_t rownr, const Slicer& ns, Array<DComplex>* dataPtr);
+    virtual void getSliceStringV(rownr_t rownr, const Slicer& ns, Array<String>* dataPtr);
 
 
 protected:
-    void scalarVToSelection(uInt rownr);
-    void arrayVToSelection(uInt rownr);
-    void sliceVToSelection(uInt rownr, const Slicer &ns);
+    void scalarVToSelection(rownr_t rownr);
+    void arrayVToSelection(rownr_t rownr);
+    void sliceVToSelection(rownr_t rownr, const Slicer &ns);
 
     Adios2StMan::impl *itsStManPtr;
 
     String itsColumnName;
     IPosition itsCasaShape;
-    std::unordered_map<uInt, IPosition> itsCasaShapes;
+    std::unordered_map<rownr_t, IPosition> itsCasaShapes;
     Bool isShapeFixed = false;
 
     std::shared_ptr<adios2::IO> itsAdiosIO;
@@ -180,13 +180,13 @@ public:
                 std::multiplies<size_t>());
     }
 
-    virtual void putArrayV(uInt rownr, const void *dataPtr)
+    virtual void putArrayV(rownr_t rownr, const void *dataPtr)
     {
         arrayVToSelection(rownr);
         toAdios(dataPtr);
     }
 
-    virtual void getArrayV(uInt rownr, void *dataPtr)
+    virtual void getArrayV(rownr_t rownr, void *dataPtr)
     {
         arrayVToSelection(rownr);
         if(itsReadCacheMaxRows > 0)
@@ -211,13 +211,13 @@ public:
         }
     }
 
-    virtual void putScalarV(uInt rownr, const void *dataPtr)
+    virtual void putScalarV(rownr_t rownr, const void *dataPtr)
     {
         scalarVToSelection(rownr);
         toAdios(reinterpret_cast<const T *>(dataPtr));
     }
 
-    virtual void getScalarV(uInt aRowNr, void *data)
+    virtual void getScalarV(rownr_t aRowNr, void *data)
     {
         scalarVToSelection(aRowNr);
         fromAdios(reinterpret_cast<T *>(data));
@@ -238,7 +238,7 @@ public:
             itsAdiosStart[i] = 0;
             itsAdiosCount[i] = itsAdiosShape[i];
         }
-        for(uInt i = 0; i < rownrs.rowVector().size(); ++i)
+        for(rownr_t i = 0; i < rownrs.rowVector().size(); ++i)
         {
             itsAdiosStart[0] = rownrs.rowVector()[i];
             toAdios(data + i * itsCasaShape.nelements());
@@ -261,7 +261,7 @@ public:
             itsAdiosStart[i] = 0;
             itsAdiosCount[i] = itsAdiosShape[i];
         }
-        for(uInt i = 0; i < rownrs.rowVector().size(); ++i)
+        for(rownr_t i = 0; i < rownrs.rowVector().size(); ++i)
         {
             itsAdiosStart[0] = rownrs.rowVector()[i];
             fromAdios(data + i * itsCasaShape.nelements());
@@ -269,13 +269,13 @@ public:
         arrayPtr->putStorage(data, deleteIt);
     }
 
-    virtual void getSliceV(uInt aRowNr, const Slicer &ns, void *dataPtr)
+    virtual void getSliceV(rownr_t aRowNr, const Slicer &ns, void *dataPtr)
     {
         sliceVToSelection(aRowNr, ns);
         fromAdios(dataPtr);
     }
 
-    virtual void putSliceV(uInt aRowNr, const Slicer &ns, const void *dataPtr)
+    virtual void putSliceV(rownr_t aRowNr, const Slicer &ns, const void *dataPtr)
     {
         sliceVToSelection(aRowNr, ns);
         toAdios(dataPtr);
@@ -203,7 +203,7 @@ private:
 
   // Initialize the object for a new table.
   // It defines the keywords containing the engine parameters.
-  virtual void create (uInt initialNrrow);
+  virtual void create (rownr_t initialNrrow);
 
   // Preparing consists of setting the writable switch and
   // adding the initial number of rows in case of create.
@@ -217,24 +217,24 @@ private:
   // Add rows to the table.
   // If auto-scaling, it initializes the scale column with 0
   // to indicate that no data has been processed yet.
-  virtual void addRowInit (uInt startRow, uInt nrrow);
+  virtual void addRowInit (rownr_t startRow, rownr_t nrrow);
 
   // Get an array in the given row.
   // This will scale and offset from the underlying array.
-  virtual void getArray (uInt rownr, Array<Float>& array);
+  virtual void getArray (rownr_t rownr, Array<Float>& array);
 
   // Put an array in the given row.
   // This will scale and offset to the underlying array.
-  virtual void putArray (uInt rownr, const Array<Float>& array);
+  virtual void putArray (rownr_t rownr, const Array<Float>& array);
 
   // Get a section of the array in the given row.
   // This will scale and offset from the underlying array.
-  virtual void getSlice (uInt rownr, const Slicer& slicer,
+  virtual void getSlice (rownr_t rownr, const Slicer& slicer,
 			 Array<Float>& array);
 
   // Put into a section of the array in the given row.
   // This will scale and offset to the underlying array.
-  virtual void putSlice (uInt rownr, const Slicer& slicer,
+  virtual void putSlice (rownr_t rownr, const Slicer& slicer,
 			 const Array<Float>& array);
 
   // Get an entire column.
@@ -317,10 +317,10 @@ private:
   Array<Short>   buffer_p;             //# buffer to avoid Array constructions
 
   // Get the scale value for this row.
-  Float getScale (uInt rownr);
+  Float getScale (rownr_t rownr);
 
   // Get the offset value for this row.
-  Float getOffset (uInt rownr);
+  Float getOffset (rownr_t rownr);
 
   // Find minimum and maximum from the array data.
   // NaN and infinite values are ignored. If no values are finite,
@@ -334,13 +334,13 @@ private:
 			Float minVal, Float maxVal) const;
 
   // Put a part of an array in a row using given scale/offset values.
-  void putPart (uInt rownr, const Slicer& slicer,
+  void putPart (rownr_t rownr, const Slicer& slicer,
 		const Array<Float>& array,
 		Float scale, Float offset);
 
   // Fill the array part into the full array and put it using the
   // given min/max values.
-  void putFullPart (uInt rownr, const Slicer& slicer,
+  void putFullPart (rownr_t rownr, const Slicer& slicer,
 		    Array<Float>& fullArray,
 		    const Array<Float>& partArray,
 		    Float minVal, Float maxVal);
@@ -357,11 +357,11 @@ public:
 };
 
 
-inline Float CompressFloat::getScale (uInt rownr)
+inline Float CompressFloat::getScale (rownr_t rownr)
 {
   return (fixed_p  ?  scale_p : (*scaleColumn_p)(rownr));
 }
-inline Float CompressFloat::getOffset (uInt rownr)
+inline Float CompressFloat::getOffset (rownr_t rownr)
 {
   return (fixed_p  ?  offset_p : (*offsetColumn_p)(rownr));
 }
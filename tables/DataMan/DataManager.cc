@@ -36,6 +36,7 @@
 #include <casacore/tables/DataMan/TiledColumnStMan.h>
 #include <casacore/tables/DataMan/TiledShapeStMan.h>
 #include <casacore/tables/DataMan/MemoryStMan.h>
+#include <casacore/tables/DataMan/PackedStMan.h>
 #include <casacore/tables/DataMan/CompressFloat.h>
 #include <casacore/tables/DataMan/CompressComplex.h>
 #include <casacore/tables/DataMan/MappedArrayEngine.h>
@@ -48,6 +49,8 @@
 #include <casacore/casa/Arrays/ArrayBase.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/OS/DynLib.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/stdio.h>                     // for sprintf
@@ -97,13 +100,13 @@ Bool DataManager::isStorageManager() const
     { return True; }
 
 
-uInt DataManager::open1 (uInt nrrow, AipsIO& ios)
+uInt DataManager::open1 (rownr_t nrrow, AipsIO& ios)
 {
     open (nrrow, ios);
     return nrrow;
 }
 
-uInt DataManager::resync1 (uInt nrrow)
+uInt DataManager::resync1 (rownr_t nrrow)
 {
     resync (nrrow);
     return nrrow;
@@ -263,11 +266,11 @@ Bool DataManager::canRemoveColumn() const
 Bool DataManager::canRenameColumn() const
     { return True; }
 
-void DataManager::addRow (uInt)
+void DataManager::addRow (rownr_t)
     { throw DataManInvOper ("DataManager::addRow not allowed for "
                             "data manager type " + dataManagerType()); }
 
-void DataManager::removeRow (uInt)
+void DataManager::removeRow (rownr_t)
     { throw DataManInvOper ("DataManager::removeRow not allowed for "
                             "data manager type " + dataManagerType()); }
 
@@ -363,38 +366,38 @@ void DataManagerColumn::setShapeColumn (const IPosition&)
                           " in column " + columnName());
 }
 
-void DataManagerColumn::setShape (uInt, const IPosition&)
+void DataManagerColumn::setShape (rownr_t, const IPosition&)
 {
     throw DataManInvOper("setShape only allowed for non-FixedShape arrays"
                          " in column " + columnName());
 }
 
-void DataManagerColumn::setShapeTiled (uInt rownr, const IPosition& shape,
+void DataManagerColumn::setShapeTiled (rownr_t rownr, const IPosition& shape,
 				       const IPosition&)
 {
     setShape (rownr, shape);
 }
 
 // By default the shape is defined (for scalars).
-Bool DataManagerColumn::isShapeDefined (uInt)
+Bool DataManagerColumn::isShapeDefined (rownr_t)
 {
     return True;
 }
 
 // The default implementation of ndim is to use the shape.
-uInt DataManagerColumn::ndim (uInt rownr)
+uInt DataManagerColumn::ndim (rownr_t rownr)
 {
     return shape(rownr).nelements();
 }
 
 // The shape of the array in the given row.
-IPosition DataManagerColumn::shape (uInt)
+IPosition DataManagerColumn::shape (rownr_t)
 {
     return IPosition(0);
 }
 
 // The tile shape of the array in the given row.
-IPosition DataManagerColumn::tileShape (uInt)
+IPosition DataManagerColumn::tileShape (rownr_t)
 {
     return IPosition(0);
 }
@@ -451,9 +454,9 @@ void DataManagerColumn::throwPut() const
 
 
 #define DATAMANAGER_GETPUT(T,NM) \
-void DataManagerColumn::aips_name2(get,NM) (uInt, T*) \
+void DataManagerColumn::aips_name2(get,NM) (rownr_t, T*) \
     { throwGet(); } \
-void DataManagerColumn::aips_name2(put,NM) (uInt, const T*) \
+void DataManagerColumn::aips_name2(put,NM) (rownr_t, const T*) \
     { throwPut(); }
 
 DATAMANAGER_GETPUT(Bool,BoolV)
@@ -470,12 +473,12 @@ DATAMANAGER_GETPUT(DComplex,DComplexV)
 DATAMANAGER_GETPUT(String,StringV)
 
 
-void DataManagerColumn::getOtherV (uInt, void*)
+void DataManagerColumn::getOtherV (rownr_t, void*)
 {
   throw (DataManInvOper ("DataManagerColumn::getOtherV not allowed"
                          " in column " + columnName()));
 }
-void DataManagerColumn::putOtherV (uInt, const void*)
+void DataManagerColumn::putOtherV (rownr_t, const void*)
 {
   throw (DataManInvOper ("DataManagerColumn::putOtherV not allowed"
                          " in column " + columnName()));
@@ -499,23 +502,80 @@ void DataManagerColumn::putScalarColumnCellsV (const RefRows& rows, const void*
 {
   putScalarColumnCellsBase (rows, *static_cast<const ArrayBase*>(dataPtr));
 }
-uInt DataManagerColumn::getBlockV (uInt, uInt, void*)
+uInt DataManagerColumn::getBlockV (rownr_t, uInt, void*)
 {
   throw (DataManInvOper("DataManagerColumn::getBlock not allowed"
                         " in column " + columnName()));
   return 0;
 }
-void DataManagerColumn::putBlockV (uInt, uInt, const void*)
+void DataManagerColumn::putBlockV (rownr_t, uInt, const void*)
 {
   throw (DataManInvOper("DataManagerColumn::putBlock not allowed"
                         " in column " + columnName()));
 }
-void DataManagerColumn::getArrayV (uInt, void*)
+Bool DataManagerColumn::getValueRange (rownr_t, rownr_t&, Double&, Double&)
+{
+  return False;
+}
+Bool DataManagerColumn::getDictionary (uInt, Vector<String>&)
+{
+  return False;
+}
+void DataManagerColumn::getDictCodes (rownr_t, uInt, uInt*)
+{
+  throw (DataManInvOper("DataManagerColumn::getDictCodes not allowed"
+                        " in column " + columnName()));
+}
+Bool DataManagerColumn::valueToDouble (int dataType, const void* value,
+                                       Double& result)
+{
+  switch (dataType) {
+  case TpChar:
+    result = *static_cast<const Char*>(value);
+    return True;
+  case TpUChar:
+    result = *static_cast<const uChar*>(value);
+    return True;
+  case TpShort:
+    result = *static_cast<const Short*>(value);
+    return True;
+  case TpUShort:
+    result = *static_cast<const uShort*>(value);
+    return True;
+  case TpInt:
+    result = *static_cast<const Int*>(value);
+    return True;
+  case TpUInt:
+    result = *static_cast<const uInt*>(value);
+    return True;
+  case TpInt64:
+    {
+      Int64 val = *static_cast<const Int64*>(value);
+      const Int64 maxExact = Int64(1) << 53;
+      result = Double(val);
+      return (val <= maxExact  &&  val >= -maxExact);
+    }
+  case TpFloat:
+    result = *static_cast<const Float*>(value);
+    return !isNaN(result);
+  case TpDouble:
+    result = *static_cast<const Double*>(value);
+    return !isNaN(result);
+  default:
+    break;
+  }
+  return False;
+}
+void DataManagerColumn::getArrayV (rownr_t, void*)
 {
   throw (DataManInvOper("DataManagerColumn::getArray not allowed"
                         " in column " + columnName()));
 }
-void DataManagerColumn::putArrayV (uInt, const void*)
+Bool DataManagerColumn::getArrayMappedV (rownr_t, void*)
+{
+  return False;
+}
+void DataManagerColumn::putArrayV (rownr_t, const void*)
 {
   throw (DataManInvOper("DataManagerColumn::putArray not allowed"
                         " in column " + columnName()));
@@ -536,11 +596,11 @@ void DataManagerColumn::putArrayColumnCellsV (const RefRows& rows, const void* d
 {
   putArrayColumnCellsBase (rows, *static_cast<const ArrayBase*>(dataPtr));
 }
-void DataManagerColumn::getSliceV (uInt rownr, const Slicer& slicer, void* dataPtr)
+void DataManagerColumn::getSliceV (rownr_t rownr, const Slicer& slicer, void* dataPtr)
 {
   getSliceBase (rownr, slicer, *static_cast<ArrayBase*>(dataPtr));
 }
-void DataManagerColumn::putSliceV (uInt rownr, const Slicer& slicer, const void* dataPtr)
+void DataManagerColumn::putSliceV (rownr_t rownr, const Slicer& slicer, const void* dataPtr)
 {
   putSliceBase (rownr, slicer, *static_cast<const ArrayBase*>(dataPtr));
 }
@@ -570,9 +630,9 @@ void DataManagerColumn::putColumnSliceCellsV (const RefRows& rows,
   RefRowsSliceIter iter(rownrs);                 \
   uInt i=0;                                      \
   while (! iter.pastEnd()) {                     \
-    uInt rownr = iter.sliceStart();              \
-    uInt end   = iter.sliceEnd();                \
-    uInt incr  = iter.sliceIncr();               \
+    rownr_t rownr = iter.sliceStart();              \
+    rownr_t end   = iter.sliceEnd();                \
+    rownr_t incr  = iter.sliceIncr();               \
     while (rownr <= end) {                       \
       aips_name2(get,TV) (rownr, &(vec[i]));     \
       i++;                                       \
@@ -587,9 +647,9 @@ void DataManagerColumn::putColumnSliceCellsV (const RefRows& rows,
   RefRowsSliceIter iter(rownrs);                 \
   uInt i=0;                                      \
   while (! iter.pastEnd()) {                     \
-    uInt rownr = iter.sliceStart();              \
-    uInt end   = iter.sliceEnd();                \
-    uInt incr  = iter.sliceIncr();               \
+    rownr_t rownr = iter.sliceStart();              \
+    rownr_t end   = iter.sliceEnd();                \
+    rownr_t incr  = iter.sliceIncr();               \
     while (rownr <= end) {                       \
       aips_name2(put,TV) (rownr, &(vec[i]));     \
       i++;                                       \
@@ -697,7 +757,7 @@ void DataManagerColumn::getArrayColumnBase (ArrayBase& arr)
   uInt nr = shp[shp.size() - 1];
   DebugAssert (nr == nrow(), AipsError);
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (shp.size()-1);
-  for (uInt row=0; row<nr; ++row) {
+  for (rownr_t row=0; row<nr; ++row) {
     getArrayV (row, &(iter->getArray()));
     iter->next();
   }
@@ -708,7 +768,7 @@ void DataManagerColumn::putArrayColumnBase (const ArrayBase& arr)
   uInt nr = shp[shp.size() - 1];
   DebugAssert (nr == nrow(), AipsError);
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (shp.size()-1);
-  for (uInt row=0; row<nr; ++row) {
+  for (rownr_t row=0; row<nr; ++row) {
     putArrayV (row, &(iter->getArray()));
     iter->next();
   }
@@ -718,7 +778,7 @@ void DataManagerColumn::getArrayColumnCellsBase (const RefRows& rows, ArrayBase&
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (arr.ndim()-1);
   RefRowsSliceIter rowsIter(rows);
   while (! rowsIter.pastEnd()) {
-    for (uInt row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
+    for (rownr_t row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
          row+=rowsIter.sliceIncr()) {
       DebugAssert (! iter->pastEnd(), AipsError);
       getArrayV (row, &(iter->getArray()));
@@ -734,7 +794,7 @@ void DataManagerColumn::putArrayColumnCellsBase (const RefRows& rows,
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (arr.ndim()-1);
   RefRowsSliceIter rowsIter(rows);
   while (! rowsIter.pastEnd()) {
-    for (uInt row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
+    for (rownr_t row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
          row+=rowsIter.sliceIncr()) {
       DebugAssert (! iter->pastEnd(), AipsError);
       putArrayV (row, &(iter->getArray()));
@@ -744,7 +804,7 @@ void DataManagerColumn::putArrayColumnCellsBase (const RefRows& rows,
   }
   DebugAssert (iter->pastEnd(), AipsError);
 }
-void DataManagerColumn::getSliceArr (uInt row, const Slicer& section,
+void DataManagerColumn::getSliceArr (rownr_t row, const Slicer& section,
                                      CountedPtr<ArrayBase>& fullArr,
                                      ArrayBase& arr)
 {
@@ -759,7 +819,7 @@ void DataManagerColumn::getSliceArr (uInt row, const Slicer& section,
     arr.assignBase (*(fullArr->getSection (section)));
   }
 }
-void DataManagerColumn::putSliceArr (uInt row, const Slicer& section,
+void DataManagerColumn::putSliceArr (rownr_t row, const Slicer& section,
                                      CountedPtr<ArrayBase>& fullArr,
                                      const ArrayBase& arr)
 {
@@ -775,13 +835,13 @@ void DataManagerColumn::putSliceArr (uInt row, const Slicer& section,
     putArrayV (row, fullArr.get());
   }
 }
-void DataManagerColumn::getSliceBase (uInt row, const Slicer& section,
+void DataManagerColumn::getSliceBase (rownr_t row, const Slicer& section,
                                       ArrayBase& arr)
 {
   CountedPtr<ArrayBase> fullArr = arr.makeArray();
   getSliceArr (row, section, fullArr, arr);
 }
-void DataManagerColumn::putSliceBase (uInt row, const Slicer& section,
+void DataManagerColumn::putSliceBase (rownr_t row, const Slicer& section,
                                       const ArrayBase& arr)
 {
   CountedPtr<ArrayBase> fullArr = arr.makeArray();
@@ -794,7 +854,7 @@ void DataManagerColumn::getColumnSliceBase (const Slicer& section, ArrayBase& ar
   DebugAssert (nr == nrow(), AipsError);
   CountedPtr<ArrayBase> fullArr = arr.makeArray();
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (shp.size()-1);
-  for (uInt row=0; row<nr; ++row) {
+  for (rownr_t row=0; row<nr; ++row) {
     getSliceArr (row, section, fullArr, iter->getArray());
     iter->next();
   }
@@ -807,7 +867,7 @@ void DataManagerColumn::putColumnSliceBase (const Slicer& section,
   DebugAssert (nr == nrow(), AipsError);
   CountedPtr<ArrayBase> fullArr = arr.makeArray();
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (shp.size()-1);
-  for (uInt row=0; row<nr; ++row) {
+  for (rownr_t row=0; row<nr; ++row) {
     putSliceArr (row, section, fullArr, iter->getArray());
     iter->next();
   }
@@ -820,7 +880,7 @@ void DataManagerColumn::getColumnSliceCellsBase (const RefRows& rows,
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (arr.ndim()-1);
   RefRowsSliceIter rowsIter(rows);
   while (! rowsIter.pastEnd()) {
-    for (uInt row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
+    for (rownr_t row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
          row+=rowsIter.sliceIncr()) {
       DebugAssert (! iter->pastEnd(), AipsError);
       getSliceArr (row, section, fullArr, iter->getArray());
@@ -838,7 +898,7 @@ void DataManagerColumn::putColumnSliceCellsBase (const RefRows& rows,
   CountedPtr<ArrayPositionIterator> iter = arr.makeIterator (arr.ndim()-1);
   RefRowsSliceIter rowsIter(rows);
   while (! rowsIter.pastEnd()) {
-    for (uInt row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
+    for (rownr_t row=rowsIter.sliceStart(); row<=rowsIter.sliceEnd();
          row+=rowsIter.sliceIncr()) {
       DebugAssert (! iter->pastEnd(), AipsError);
       putSliceArr (row, section, fullArr, iter->getArray());
@@ -866,6 +926,7 @@ std::map<String,DataManagerCtor> DataManager::initRegisterMap()
   theirRegisterMap.insert (std::make_pair("TiledColumnStMan", TiledColumnStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("TiledShapeStMan",  TiledShapeStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("MemoryStMan",      MemoryStMan::makeObject));
+  theirRegisterMap.insert (std::make_pair("PackedStMan",      PackedStMan::makeObject));
 #ifdef HAVE_MPI
 #ifdef HAVE_ADIOS2
   theirRegisterMap.insert (std::make_pair("Adios2StMan",      Adios2StMan::makeObject));
@@ -101,9 +101,9 @@ Bool ForwardColumnEngine::canAddRow() const
 { return True; }
 Bool ForwardColumnEngine::canRemoveRow() const
 { return True; }
-void ForwardColumnEngine::addRow (uInt)
+void ForwardColumnEngine::addRow (rownr_t)
 {}
-void ForwardColumnEngine::removeRow (uInt)
+void ForwardColumnEngine::removeRow (rownr_t)
 {}
 
 
@@ -170,7 +170,7 @@ DataManagerColumn* ForwardColumnEngine::makeIndArrColumn (const String& name,
 }
 
 
-void ForwardColumnEngine::create (uInt)
+void ForwardColumnEngine::create (rownr_t)
 {
     baseCreate();
 }
@@ -372,16 +372,16 @@ void ForwardColumn::setShapeColumn (const IPosition& shape)
 	}
     }
 }
-void ForwardColumn::setShape (uInt rownr, const IPosition& shape)
+void ForwardColumn::setShape (rownr_t rownr, const IPosition& shape)
     { colPtr_p->setShape (rownr, shape); }
 
-uInt ForwardColumn::ndim (uInt rownr)
+uInt ForwardColumn::ndim (rownr_t rownr)
     { return colPtr_p->ndim (rownr); }
 
-IPosition ForwardColumn::shape(uInt rownr)
+IPosition ForwardColumn::shape(rownr_t rownr)
     { return colPtr_p->shape (rownr); }
 
-Bool ForwardColumn::isShapeDefined (uInt rownr)
+Bool ForwardColumn::isShapeDefined (rownr_t rownr)
     { return colPtr_p->isDefined (rownr); }
 
 Bool ForwardColumn::canChangeShape() const
@@ -405,10 +405,10 @@ Bool ForwardColumn::canAccessColumnSlice (Bool& reask) const
     return colPtr_p->canAccessColumnSlice (reask);
 }
 
-void ForwardColumn::getArrayV (uInt rownr, void* dataPtr)
+void ForwardColumn::getArrayV (rownr_t rownr, void* dataPtr)
     { colPtr_p->get (rownr, dataPtr); }
 
-void ForwardColumn::getSliceV (uInt rownr, const Slicer& ns, void* dataPtr)
+void ForwardColumn::getSliceV (rownr_t rownr, const Slicer& ns, void* dataPtr)
     { colPtr_p->getSlice (rownr, ns, dataPtr); }
 
 void ForwardColumn::getScalarColumnV (void* dataPtr)
@@ -430,10 +430,10 @@ void ForwardColumn::getColumnSliceCellsV (const RefRows& rownrs,
                                           const Slicer& ns, void* dataPtr)
     { colPtr_p->getColumnSliceCells (rownrs, ns, dataPtr); }
 
-void ForwardColumn::putArrayV (uInt rownr, const void* dataPtr)
+void ForwardColumn::putArrayV (rownr_t rownr, const void* dataPtr)
     { colPtr_p->put (rownr, dataPtr); }
 
-void ForwardColumn::putSliceV (uInt rownr, const Slicer& ns,
+void ForwardColumn::putSliceV (rownr_t rownr, const Slicer& ns,
 			       const void* dataPtr)
     { colPtr_p->putSlice (rownr, ns, dataPtr); }
 
@@ -461,9 +461,9 @@ void ForwardColumn::putColumnSliceCellsV (const RefRows& rownrs,
 
 
 #define FORWARDCOLUMN_GETPUT(T,NM) \
-void ForwardColumn::aips_name2(get,NM) (uInt rownr, T* dataPtr) \
+void ForwardColumn::aips_name2(get,NM) (rownr_t rownr, T* dataPtr) \
     { colPtr_p->get (rownr, dataPtr); } \
-void ForwardColumn::aips_name2(put,NM) (uInt rownr, const T* dataPtr) \
+void ForwardColumn::aips_name2(put,NM) (rownr_t rownr, const T* dataPtr) \
     { colPtr_p->put (rownr, dataPtr); }
 
 FORWARDCOLUMN_GETPUT(Bool,BoolV)
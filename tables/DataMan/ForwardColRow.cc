@@ -106,7 +106,7 @@ DataManagerColumn* ForwardColumnIndexedRowEngine::makeIndArrColumn
 }
 
 
-void ForwardColumnIndexedRowEngine::create (uInt)
+void ForwardColumnIndexedRowEngine::create (rownr_t)
 {
     // The table is new.
     baseCreate();
@@ -182,19 +182,19 @@ void ForwardColumnIndexedRow::prepare (const Table& thisTable)
 }
 
 
-void ForwardColumnIndexedRow::setShape (uInt, const IPosition&)
+void ForwardColumnIndexedRow::setShape (rownr_t, const IPosition&)
 {
     throw (DataManInvOper
            ("setShape not supported by data manager ForwardColumnIndexedRow"));
 }
 
-uInt ForwardColumnIndexedRow::ndim (uInt rownr)
+uInt ForwardColumnIndexedRow::ndim (rownr_t rownr)
     { return colPtr()->ndim (convertRownr(rownr)); }
 
-IPosition ForwardColumnIndexedRow::shape(uInt rownr)
+IPosition ForwardColumnIndexedRow::shape(rownr_t rownr)
     { return colPtr()->shape (convertRownr(rownr)); }
 
-Bool ForwardColumnIndexedRow::isShapeDefined (uInt rownr)
+Bool ForwardColumnIndexedRow::isShapeDefined (rownr_t rownr)
     { return colPtr()->isDefined (convertRownr(rownr)); }
 
 Bool ForwardColumnIndexedRow::canChangeShape() const
@@ -217,20 +217,20 @@ Bool ForwardColumnIndexedRow::canAccessColumnSlice (Bool& reask) const
     return False;
 }
 
-void ForwardColumnIndexedRow::getArrayV (uInt rownr, void* dataPtr)
+void ForwardColumnIndexedRow::getArrayV (rownr_t rownr, void* dataPtr)
     { colPtr()->get (convertRownr(rownr), dataPtr); }
 
-void ForwardColumnIndexedRow::getSliceV (uInt rownr, const Slicer& ns,
+void ForwardColumnIndexedRow::getSliceV (rownr_t rownr, const Slicer& ns,
 					 void* dataPtr)
     { colPtr()->getSlice (convertRownr(rownr), ns, dataPtr); }
 
-void ForwardColumnIndexedRow::putArrayV (uInt, const void*)
+void ForwardColumnIndexedRow::putArrayV (rownr_t, const void*)
 {
     throw (DataManInvOper
            ("putArray not supported by data manager ForwardColumnIndexedRow"));
 }
 
-void ForwardColumnIndexedRow::putSliceV (uInt, const Slicer&, const void*)
+void ForwardColumnIndexedRow::putSliceV (rownr_t, const Slicer&, const void*)
 {
     throw (DataManInvOper
            ("putSlice not supported by data manager ForwardColumnIndexedRow"));
@@ -238,9 +238,9 @@ void ForwardColumnIndexedRow::putSliceV (uInt, const Slicer&, const void*)
 
 
 #define FORWARDCOLUMNINDEXEDROW_GETPUT(T,NM) \
-void ForwardColumnIndexedRow::aips_name2(get,NM) (uInt rownr, T* dataPtr) \
+void ForwardColumnIndexedRow::aips_name2(get,NM) (rownr_t rownr, T* dataPtr) \
     { colPtr()->get (convertRownr(rownr), dataPtr); } \
-void ForwardColumnIndexedRow::aips_name2(put,NM) (uInt, const T*) \
+void ForwardColumnIndexedRow::aips_name2(put,NM) (rownr_t, const T*) \
 { \
     throw (DataManInvOper \
            ("put not supported by data manager ForwardColumnIndexedRow")); \
@@ -35,9 +35,12 @@
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/iostream.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -98,7 +101,7 @@ void ISMBucket::copy (const ISMBucket& that)
 }
 
 
-uInt& ISMBucket::getOffset (uInt colnr, uInt rownr)
+uInt& ISMBucket::getOffset (uInt colnr, rownr_t rownr)
 {
     Bool found;
     uInt inx = binarySearchBrackets (found, *(rowIndex_p[colnr]),
@@ -110,8 +113,8 @@ uInt& ISMBucket::getOffset (uInt colnr, uInt rownr)
     return (*(offIndex_p[colnr]))[inx];
 }
 
-uInt ISMBucket::getInterval (uInt colnr, uInt rownr, uInt bucketNrrow,
-			     uInt& start, uInt& end, uInt& offset) const
+uInt ISMBucket::getInterval (uInt colnr, rownr_t rownr, rownr_t bucketNrrow,
+			     rownr_t& start, rownr_t& end, uInt& offset) const
 {
     Block<uInt>& rowIndex = *(rowIndex_p[colnr]);
     Bool found;
@@ -174,12 +177,19 @@ Bool ISMBucket::canAddData (uInt leng) const
     return False;
 }
 
-void ISMBucket::addData (uInt colnr, uInt rownr, uInt index,
+void ISMBucket::addData (uInt colnr, rownr_t rownr, uInt index,
 			 const char* data, uInt leng)
 {
 #ifdef AIPS_TRACE
     cout << "  add at index "<< index<<endl;
 #endif
+    // Row numbers in a bucket are relative to its start row and are
+    // stored as 32-bit values.
+    if (rownr > std::numeric_limits<uInt>::max()) {
+        throw DataManError ("IncrementalStMan: relative row number " +
+                            String::toString(rownr) +
+                            " in a bucket exceeds 32 bits");
+    }
     Block<uInt>& rowIndex = *(rowIndex_p[colnr]);
     Block<uInt>& offIndex = *(offIndex_p[colnr]);
     uInt nrused = indexUsed_p[colnr];
@@ -203,7 +213,7 @@ void ISMBucket::addData (uInt colnr, uInt rownr, uInt index,
     // Insert the new row number.
     indexLeng_p += 2*uIntSize_p;
     indexUsed_p[colnr]++;
-    rowIndex[index] = rownr;
+    rowIndex[index] = uInt(rownr);
     offIndex[index] = insertData (data, leng);
 }
 
@@ -355,11 +365,11 @@ void ISMBucket::read (const char* bucketStorage)
 
 Bool ISMBucket::simpleSplit (ISMBucket* left, ISMBucket* right,
 			     Block<Bool>& duplicated,
-			     uInt& splitRownr, uInt rownr)
+			     rownr_t& splitRownr, rownr_t rownr)
 {
     // Determine the last rownr in the bucket.
     uInt i, row;
-    uInt lastRow = 0;
+    rownr_t lastRow = 0;
     uInt nrcol = stmanPtr_p->ncolumn();
     for (i=0; i<nrcol; i++) {
 	row = (*(rowIndex_p[i]))[indexUsed_p[i]-1];
@@ -402,17 +412,17 @@ Bool ISMBucket::simpleSplit (ISMBucket* left, ISMBucket* right,
     return True;
 }
 
-uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
-		       Block<Bool>& duplicated,
-		       uInt bucketStartRow, uInt bucketNrrow,
-		       uInt colnr, uInt rownr, uInt lengToAdd)
+rownr_t ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
+			  Block<Bool>& duplicated,
+			  rownr_t bucketStartRow, rownr_t bucketNrrow,
+			  uInt colnr, rownr_t rownr, uInt lengToAdd)
 {
     AlwaysAssert (bucketNrrow > 1, AipsError);
     uInt nrcol = stmanPtr_p->ncolumn();
     duplicated.resize (nrcol);
     left  = new ISMBucket (stmanPtr_p, 0);
     right = new ISMBucket (stmanPtr_p, 0);
-    uInt splitRownr;
+    rownr_t splitRownr;
     // Try a simple split if the current bucket is the last one.
     // (Then we usually add to the end of the file).
     if (bucketStartRow + bucketNrrow >= stmanPtr_p->nrow()) {
@@ -429,7 +439,7 @@ uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
     // Create a block containing the row numbers of all
     // values in all columns. Include the new item.
     Block<uInt> rows(nr + 1);
-    rows[0] = rownr;               // new item
+    rows[0] = uInt(rownr);         // new item
     nr = 1;
     for (i=0; i<nrcol; i++) {
 	for (j=0; j<indexUsed_p[i]; j++) {
@@ -498,7 +508,7 @@ uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
     // each column. A row has to be copied completely, because a row
     // cannot be split over multiple buckets.
     cursor = 0;
-    uInt row;
+    rownr_t row;
     for (j=0; j<index; j++) {
 	row = rows[j];
 	for (i=0; i<nrcol; i++) {
@@ -588,7 +598,7 @@ uInt ISMBucket::getSplit (uInt totLeng, const Block<uInt>& rowLeng,
 }
 
 
-uInt ISMBucket::copyData (ISMBucket& other, uInt colnr, uInt toRownr,
+uInt ISMBucket::copyData (ISMBucket& other, uInt colnr, rownr_t toRownr,
 			  uInt fromIndex, uInt toIndex) const
 {
     // Determine the length of the data item.
@@ -146,8 +146,8 @@ public:
     // and the offset of its current value.
     // It returns the index where the row number can be put in the
     // bucket index.
-    uInt getInterval (uInt colnr, uInt rownr, uInt bucketNrrow,
-		      uInt& start, uInt& end, uInt& offset) const;
+    uInt getInterval (uInt colnr, rownr_t rownr, rownr_t bucketNrrow,
+		      rownr_t& start, rownr_t& end, uInt& offset) const;
 
     // Is the bucket large enough to add a value?
     Bool canAddData (uInt leng) const;
@@ -155,7 +155,7 @@ public:
     // Add the data to the data part.
     // It updates the bucket index at the given index.
     // An exception is thrown if the bucket is too small.
-    void addData (uInt colnr, uInt rownr, uInt index,
+    void addData (uInt colnr, rownr_t rownr, uInt index,
 		  const char* data, uInt leng);
 
     // Is the bucket large enough to replace a value?
@@ -178,7 +178,7 @@ public:
 
     // Get access to the offset of the data for given column and row.
     // It allows to change it (used for example by replaceData).
-    uInt& getOffset (uInt colnr, uInt rownr);
+    uInt& getOffset (uInt colnr, rownr_t rownr);
 
     // Get access to the index information for the given column.
     // This is used by ISMColumn when putting the data.
@@ -200,9 +200,9 @@ public:
     // The starting values in the right bucket may be copies of the
     // values in the left bucket. The duplicated Block contains a switch
     // per column indicating if the value is copied.
-    uInt split (ISMBucket*& left, ISMBucket*& right, Block<Bool>& duplicated,
-		uInt bucketStartRow, uInt bucketNrrow,
-		uInt colnr, uInt rownr, uInt lengToAdd);
+    rownr_t split (ISMBucket*& left, ISMBucket*& right, Block<Bool>& duplicated,
+		   rownr_t bucketStartRow, rownr_t bucketNrrow,
+		   uInt colnr, rownr_t rownr, uInt lengToAdd);
 
     // Determine whether a simple split is possible. If so, do it.
     // This is possible if the new row is at the end of the last bucket,
@@ -214,7 +214,7 @@ public:
     // left and right bucket.
     Bool simpleSplit (ISMBucket* left, ISMBucket* right,
 		      Block<Bool>& duplicated,
-		      uInt& splitRownr, uInt rownr);
+		      rownr_t& splitRownr, rownr_t rownr);
 
     // Return the index where the bucket should be split to get
     // two parts with almost identical length.
@@ -278,7 +278,7 @@ private:
     uInt insertData (const char* data, uInt leng);
 
     // Copy a data item from this bucket to the other bucket.
-    uInt copyData (ISMBucket& other, uInt colnr, uInt toRownr,
+    uInt copyData (ISMBucket& other, uInt colnr, rownr_t toRownr,
 		   uInt fromIndex, uInt toIndex) const;
 
     // Read the data from the storage into this bucket.
@@ -32,11 +32,13 @@
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Utilities/ValType.h>
+#include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -50,7 +52,9 @@ ISMColumn::ISMColumn (ISMBase* parent, int dataType, uInt colnr)
   startRow_p    (-1),
   endRow_p      (-1),
   lastValue_p   (0),
-  lastRowPut_p  (0)
+  lastRowPut_p  (0),
+  hasRunMap_p   (False),
+  nrLookup_p    (0)
 {
     //# The increment in the column cache is always 0,
     //# because multiple rows refer to the same value.
@@ -111,25 +115,26 @@ void ISMColumn::setShapeColumn (const IPosition& shape)
     shape_p  = shape;
 }
 
-uInt ISMColumn::ndim (uInt)
+uInt ISMColumn::ndim (rownr_t)
 {
     return shape_p.nelements();
 }
-IPosition ISMColumn::shape (uInt)
+IPosition ISMColumn::shape (rownr_t)
 {
     return shape_p;
 }
 
 
-void ISMColumn::addRow (uInt, uInt)
+void ISMColumn::addRow (rownr_t, rownr_t)
 {
-    //# Nothing to do.
+    clearRunMap();
 }
 
-void ISMColumn::remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
-			uInt newNrrow)
+void ISMColumn::remove (rownr_t bucketRownr, ISMBucket* bucket, rownr_t bucketNrrow,
+			rownr_t newNrrow)
 {
-    uInt inx, stint, endint, offset;
+    uInt inx, offset;
+    rownr_t stint, endint;
     // Get the index where to remove the value.
     // If the rownr is not the start of the interval, index is one further.
     inx = bucket->getInterval (colnr_p, bucketRownr, bucketNrrow,
@@ -148,6 +153,7 @@ void ISMColumn::remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
     columnCache().invalidate();
     startRow_p = -1;
     endRow_p   = -1;
+    clearRunMap();
     // We have to change the bucket, so let the cache set the dirty flag
     // for this bucket.
     stmanPtr_p->setBucketDirty();
@@ -175,84 +181,84 @@ void ISMColumn::remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
 }
 
 
-void ISMColumn::getBoolV (uInt rownr, Bool* value)
+void ISMColumn::getBoolV (rownr_t rownr, Bool* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Bool*)lastValue_p;
 }
-void ISMColumn::getuCharV (uInt rownr, uChar* value)
+void ISMColumn::getuCharV (rownr_t rownr, uChar* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(uChar*)lastValue_p;
 }
-void ISMColumn::getShortV (uInt rownr, Short* value)
+void ISMColumn::getShortV (rownr_t rownr, Short* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Short*)lastValue_p;
 }
-void ISMColumn::getuShortV (uInt rownr, uShort* value)
+void ISMColumn::getuShortV (rownr_t rownr, uShort* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(uShort*)lastValue_p;
 }
-void ISMColumn::getIntV (uInt rownr, Int* value)
+void ISMColumn::getIntV (rownr_t rownr, Int* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Int*)lastValue_p;
 }
-void ISMColumn::getuIntV (uInt rownr, uInt* value)
+void ISMColumn::getuIntV (rownr_t rownr, uInt* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(uInt*)lastValue_p;
 }
-void ISMColumn::getInt64V (uInt rownr, Int64* value)
+void ISMColumn::getInt64V (rownr_t rownr, Int64* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Int64*)lastValue_p;
 }
-void ISMColumn::getfloatV (uInt rownr, float* value)
+void ISMColumn::getfloatV (rownr_t rownr, float* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(float*)lastValue_p;
 }
-void ISMColumn::getdoubleV (uInt rownr, double* value)
+void ISMColumn::getdoubleV (rownr_t rownr, double* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(double*)lastValue_p;
 }
-void ISMColumn::getComplexV (uInt rownr, Complex* value)
+void ISMColumn::getComplexV (rownr_t rownr, Complex* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Complex*)lastValue_p;
 }
-void ISMColumn::getDComplexV (uInt rownr, DComplex* value)
+void ISMColumn::getDComplexV (rownr_t rownr, DComplex* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(DComplex*)lastValue_p;
 }
-void ISMColumn::getStringV (uInt rownr, String* value)
+void ISMColumn::getStringV (rownr_t rownr, String* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
@@ -260,139 +266,97 @@ void ISMColumn::getStringV (uInt rownr, String* value)
     *value = *(String*)lastValue_p;
 }
 
-void ISMColumn::getScalarColumnBoolV (Vector<Bool>* dataPtr)
+template<typename T>
+void ISMColumn::getColumnRuns (Vector<T>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getBoolV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(Bool*)lastValue_p;
+    rownr_t nrrow = dataPtr->nelements();
+    if (nrrow == 0) {
+	return;
+    }
+    Bool deleteIt;
+    T* data = dataPtr->getStorage (deleteIt);
+    if (hasRunMap_p) {
+	rownr_t rownr = 0;
+	for (size_t i=0; rownr<nrrow; i++) {
+	    rownr_t endrow = std::min (runStart_p[i+1], nrrow);
+	    std::fill (data+rownr, data+endrow, *(const T*)(runValue(i)));
+	    rownr = endrow;
+	}
+    } else {
+	// Expand the intervals in the buckets without building the map.
+	T value;
+	uInt cursor = 0;
+	rownr_t bucketStartRow = 0;
+	rownr_t bucketNrrow;
+	ISMBucket* bucket;
+	while (bucketStartRow < nrrow  &&
+	       (bucket = stmanPtr_p->nextBucket (cursor, bucketStartRow,
+						 bucketNrrow)) != 0) {
+	    const Block<uInt>& rowIndex = bucket->rowIndex (colnr_p);
+	    const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+	    uInt nused = bucket->indexUsed (colnr_p);
+	    for (uInt i=0; i<nused  &&  rowIndex[i]<bucketNrrow; i++) {
+		readFunc_p (&value, bucket->get (offIndex[i]), nrcopy_p);
+		rownr_t endrow = bucketNrrow;
+		if (i+1 < nused  &&  rowIndex[i+1] < bucketNrrow) {
+		    endrow = rowIndex[i+1];
+		}
+		rownr_t strow = std::min (bucketStartRow + rowIndex[i], nrrow);
+		endrow = std::min (bucketStartRow + endrow, nrrow);
+		std::fill (data+strow, data+endrow, value);
+	    }
 	}
     }
+    dataPtr->putStorage (data, deleteIt);
+}
+
+void ISMColumn::getScalarColumnBoolV (Vector<Bool>* dataPtr)
+{
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnuCharV (Vector<uChar>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getuCharV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(uChar*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnShortV (Vector<Short>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getShortV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(Short*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnuShortV (Vector<uShort>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getuShortV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(uShort*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnIntV (Vector<Int>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getIntV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(Int*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnuIntV (Vector<uInt>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getuIntV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(uInt*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnInt64V (Vector<Int64>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getInt64V (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(Int64*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnfloatV (Vector<float>* dataPtr)
 {
-    //# Note: using getStorage/putStorage is about 3 times faster
-    //# if the vector is consecutive, but it is slower if not.
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getfloatV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(float*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumndoubleV (Vector<double>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getdoubleV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(double*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnComplexV (Vector<Complex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getComplexV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(Complex*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnDComplexV (Vector<DComplex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getDComplexV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(DComplex*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 void ISMColumn::getScalarColumnStringV (Vector<String>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
-    while (rownr < nrrow) {
-	getStringV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
-	    (*dataPtr)(rownr) = *(String*)lastValue_p;
-	}
-    }
+    getColumnRuns (dataPtr);
 }
 
 #define ISMCOLUMN_GET(T,NM) \
@@ -407,16 +371,16 @@ void ISMColumn::aips_name2(getScalarColumnCells,NM) \
     if (rownrs.isSliced()) { \
         RefRowsSliceIter iter(rownrs); \
         while (! iter.pastEnd()) { \
-            uInt rownr = iter.sliceStart(); \
-            uInt end = iter.sliceEnd(); \
-            uInt incr = iter.sliceIncr(); \
+            rownr_t rownr = iter.sliceStart(); \
+            rownr_t end = iter.sliceEnd(); \
+            rownr_t incr = iter.sliceIncr(); \
             while (rownr <= end) { \
                 if (rownr < cache.start()  ||  rownr > cache.end()) { \
                     aips_name2(get,NM) (rownr, valptr); \
                     DebugAssert (cache.incr() == 0, AipsError); \
                 } \
                 const T* cacheValue = (const T*)(cache.dataPtr()); \
-                uInt endrow = min (end, cache.end()); \
+                rownr_t endrow = min (end, cache.end()); \
                 while (rownr <= endrow) { \
 	            *valptr++ = *cacheValue; \
                     rownr += incr; \
@@ -425,20 +389,20 @@ void ISMColumn::aips_name2(getScalarColumnCells,NM) \
 	    iter++; \
         } \
     } else { \
-        const Vector<uInt>& rowvec = rownrs.rowVector(); \
-        uInt nr = rowvec.nelements(); \
+        const Vector<rownr_t>& rowvec = rownrs.rowVector(); \
+        rownr_t nr = rowvec.nelements(); \
         if (nr > 0) { \
             Bool delR; \
-            const uInt* rows = rowvec.getStorage (delR); \
+            const rownr_t* rows = rowvec.getStorage (delR); \
             if (rows[0] < cache.start()  ||  rows[0] > cache.end()) { \
                 aips_name2(get,NM) (0, &(value[0])); \
             } \
             const T* cacheValue = (const T*)(cache.dataPtr()); \
-            uInt strow = cache.start(); \
-            uInt endrow = cache.end(); \
+            rownr_t strow = cache.start(); \
+            rownr_t endrow = cache.end(); \
             AlwaysAssert (cache.incr() == 0, AipsError); \
-            for (uInt i=0; i<nr; i++) { \
-	        uInt rownr = rows[i]; \
+            for (rownr_t i=0; i<nr; i++) { \
+	        rownr_t rownr = rows[i]; \
                 if (rownr >= strow  &&  rownr <= endrow) { \
 	            value[i] = *cacheValue; \
 	        } else { \
@@ -466,15 +430,62 @@ ISMCOLUMN_GET(Complex,ComplexV)
 ISMCOLUMN_GET(DComplex,DComplexV)
 ISMCOLUMN_GET(String,StringV)
 
-void ISMColumn::getValue (uInt rownr, void* value, Bool setCache)
+Bool ISMColumn::getValueRange (rownr_t rownr, rownr_t& endRow,
+                               Double& minVal, Double& maxVal)
 {
+    DataType dt = (DataType)dataType();
+    if (shape_p.nelements() != 0  ||  !(isReal(dt)  ||  dt == TpInt64)) {
+	return False;
+    }
+    rownr_t bucketStartRow, bucketNrrow;
+    ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
+					       bucketNrrow);
+    if (endRow >= bucketStartRow + bucketNrrow) {
+	endRow = bucketStartRow + bucketNrrow - 1;
+    }
+    // Use the values of the intervals overlapping the rows.
+    rownr_t strow  = rownr - bucketStartRow;
+    rownr_t endrow = endRow - bucketStartRow;
+    const Block<uInt>& rowIndex = bucket->rowIndex (colnr_p);
+    const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+    uInt nused = bucket->indexUsed (colnr_p);
+    Bool found = False;
+    for (uInt i=0; i<nused  &&  rowIndex[i]<=endrow; i++) {
+	if (i+1 < nused  &&  rowIndex[i+1] <= strow) {
+	    continue;
+	}
+	// Use a buffer large enough and aligned for all numeric types.
+	Double buf;
+	Double value;
+	readFunc_p (&buf, bucket->get (offIndex[i]), nrcopy_p);
+	if (! valueToDouble (dt, &buf, value)) {
+	    return False;
+	}
+	if (!found) {
+	    minVal = maxVal = value;
+	    found = True;
+	} else {
+	    minVal = min (minVal, value);
+	    maxVal = max (maxVal, value);
+	}
+    }
+    return found;
+}
+
+void ISMColumn::getValue (rownr_t rownr, void* value, Bool setCache)
+{
+    // A scalar value can be found in the interval map (if used).
+    if (setCache  &&  getRunValue (rownr)) {
+	return;
+    }
     // Get the bucket with its row number boundaries.
-    uInt bucketStartRow, bucketNrrow;
+    rownr_t bucketStartRow, bucketNrrow;
     ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
 					       bucketNrrow);
     // Get the interval in the bucket with its rownr boundaries.
     rownr -= bucketStartRow;
-    uInt offset, stint, endint;
+    uInt offset;
+    rownr_t stint, endint;
     bucket->getInterval (colnr_p, rownr, bucketNrrow, stint, endint, offset);
     // Get the value.
     // Set the start and end rownr for which this value is valid.
@@ -486,141 +497,223 @@ void ISMColumn::getValue (uInt rownr, void* value, Bool setCache)
     }
 }
 
-void ISMColumn::putBoolV (uInt rownr, const Bool* value)
+Bool ISMColumn::getRunValue (rownr_t rownr)
+{
+    if (! hasRunMap_p) {
+	// Only count lookups not following the previous interval.
+	// Build the map if about all buckets would have been read.
+	if (rownr == rownr_t(endRow_p + 1)  ||
+	    ++nrLookup_p <= stmanPtr_p->nbuckets()) {
+	    return False;
+	}
+	buildRunMap();
+    }
+    if (rownr >= runStart_p.back()) {
+	return False;
+    }
+    size_t inx = std::upper_bound (runStart_p.begin(), runStart_p.end(),
+				   rownr) - runStart_p.begin() - 1;
+    if (dataType() == TpString) {
+	*(String*)lastValue_p = runStrings_p[inx];
+    } else {
+	memcpy (lastValue_p, runValue(inx), typeSize_p);
+    }
+    startRow_p = runStart_p[inx];
+    endRow_p   = runStart_p[inx+1] - 1;
+    columnCache().set (startRow_p, endRow_p, lastValue_p);
+    return True;
+}
+
+const void* ISMColumn::runValue (size_t inx) const
+{
+    if (dataType() == TpString) {
+	return &(runStrings_p[inx]);
+    }
+    return &(runValues_p[inx*typeSize_p]);
+}
+
+void ISMColumn::buildRunMap()
+{
+    clearRunMap();
+    Bool isString = (dataType() == TpString);
+    // Use a buffer large enough and aligned for all scalar types.
+    DComplex buf;
+    String str;
+    void* value = (isString  ?  (void*)&str : (void*)&buf);
+    uInt cursor = 0;
+    rownr_t bucketStartRow = 0;
+    rownr_t bucketNrrow;
+    ISMBucket* bucket;
+    while ((bucket = stmanPtr_p->nextBucket (cursor, bucketStartRow,
+					     bucketNrrow)) != 0) {
+	const Block<uInt>& rowIndex = bucket->rowIndex (colnr_p);
+	const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+	uInt nused = bucket->indexUsed (colnr_p);
+	for (uInt i=0; i<nused  &&  rowIndex[i]<bucketNrrow; i++) {
+	    readFunc_p (value, bucket->get (offIndex[i]), nrcopy_p);
+	    // Combine with the previous interval if the value is equal
+	    // (which is the case at the start of each bucket).
+	    if (!runStart_p.empty()  &&
+		compareValue (value, runValue (runStart_p.size() - 1))) {
+		continue;
+	    }
+	    runStart_p.push_back (bucketStartRow + rowIndex[i]);
+	    if (isString) {
+		runStrings_p.push_back (str);
+	    } else {
+		runValues_p.insert (runValues_p.end(), (const char*)value,
+				    (const char*)value + typeSize_p);
+	    }
+	}
+    }
+    runStart_p.push_back (stmanPtr_p->nrow());
+    hasRunMap_p = True;
+}
+
+void ISMColumn::clearRunMap()
+{
+    runStart_p.clear();
+    runValues_p.clear();
+    runStrings_p.clear();
+    hasRunMap_p = False;
+    nrLookup_p  = 0;
+}
+
+void ISMColumn::putBoolV (rownr_t rownr, const Bool* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putuCharV (uInt rownr, const uChar* value)
+void ISMColumn::putuCharV (rownr_t rownr, const uChar* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putShortV (uInt rownr, const Short* value)
+void ISMColumn::putShortV (rownr_t rownr, const Short* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putuShortV (uInt rownr, const uShort* value)
+void ISMColumn::putuShortV (rownr_t rownr, const uShort* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putIntV (uInt rownr, const Int* value)
+void ISMColumn::putIntV (rownr_t rownr, const Int* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putInt64V (uInt rownr, const Int64* value)
+void ISMColumn::putInt64V (rownr_t rownr, const Int64* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putuIntV (uInt rownr, const uInt* value)
+void ISMColumn::putuIntV (rownr_t rownr, const uInt* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putfloatV (uInt rownr, const float* value)
+void ISMColumn::putfloatV (rownr_t rownr, const float* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putdoubleV (uInt rownr, const double* value)
+void ISMColumn::putdoubleV (rownr_t rownr, const double* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putComplexV (uInt rownr, const Complex* value)
+void ISMColumn::putComplexV (rownr_t rownr, const Complex* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putDComplexV (uInt rownr, const DComplex* value)
+void ISMColumn::putDComplexV (rownr_t rownr, const DComplex* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putStringV (uInt rownr, const String* value)
+void ISMColumn::putStringV (rownr_t rownr, const String* value)
 {
     putValue (rownr, value);
 }
 
 void ISMColumn::putScalarColumnBoolV (const Vector<Bool>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnuCharV (const Vector<uChar>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnShortV (const Vector<Short>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnuShortV (const Vector<uShort>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnIntV (const Vector<Int>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnuIntV (const Vector<uInt>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnInt64V (const Vector<Int64>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnfloatV (const Vector<float>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumndoubleV (const Vector<double>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnComplexV (const Vector<Complex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnDComplexV (const Vector<DComplex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnStringV (const Vector<String>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 
-void ISMColumn::getArrayBoolV (uInt rownr, Array<Bool>* value)
+void ISMColumn::getArrayBoolV (rownr_t rownr, Array<Bool>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -628,14 +721,14 @@ void ISMColumn::getArrayBoolV (uInt rownr, Array<Bool>* value)
     *value = Array<Bool> (shape_p, (Bool*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayBoolV (uInt rownr, const Array<Bool>* value)
+void ISMColumn::putArrayBoolV (rownr_t rownr, const Array<Bool>* value)
 {
     Bool deleteIt;
     const Bool* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayuCharV (uInt rownr, Array<uChar>* value)
+void ISMColumn::getArrayuCharV (rownr_t rownr, Array<uChar>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -643,14 +736,14 @@ void ISMColumn::getArrayuCharV (uInt rownr, Array<uChar>* value)
     *value = Array<uChar> (shape_p, (uChar*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayuCharV (uInt rownr, const Array<uChar>* value)
+void ISMColumn::putArrayuCharV (rownr_t rownr, const Array<uChar>* value)
 {
     Bool deleteIt;
     const uChar* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayShortV (uInt rownr, Array<Short>* value)
+void ISMColumn::getArrayShortV (rownr_t rownr, Array<Short>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -658,14 +751,14 @@ void ISMColumn::getArrayShortV (uInt rownr, Array<Short>* value)
     *value = Array<Short> (shape_p, (Short*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayShortV (uInt rownr, const Array<Short>* value)
+void ISMColumn::putArrayShortV (rownr_t rownr, const Array<Short>* value)
 {
     Bool deleteIt;
     const Short* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayuShortV (uInt rownr, Array<uShort>* value)
+void ISMColumn::getArrayuShortV (rownr_t rownr, Array<uShort>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -673,14 +766,14 @@ void ISMColumn::getArrayuShortV (uInt rownr, Array<uShort>* value)
     *value = Array<uShort> (shape_p, (uShort*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayuShortV (uInt rownr, const Array<uShort>* value)
+void ISMColumn::putArrayuShortV (rownr_t rownr, const Array<uShort>* value)
 {
     Bool deleteIt;
     const uShort* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayIntV (uInt rownr, Array<Int>* value)
+void ISMColumn::getArrayIntV (rownr_t rownr, Array<Int>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -688,14 +781,14 @@ void ISMColumn::getArrayIntV (uInt rownr, Array<Int>* value)
     *value = Array<Int> (shape_p, (Int*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayIntV (uInt rownr, const Array<Int>* value)
+void ISMColumn::putArrayIntV (rownr_t rownr, const Array<Int>* value)
 {
     Bool deleteIt;
     const Int* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayuIntV (uInt rownr, Array<uInt>* value)
+void ISMColumn::getArrayuIntV (rownr_t rownr, Array<uInt>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -703,14 +796,14 @@ void ISMColumn::getArrayuIntV (uInt rownr, Array<uInt>* value)
     *value = Array<uInt> (shape_p, (uInt*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayuIntV (uInt rownr, const Array<uInt>* value)
+void ISMColumn::putArrayuIntV (rownr_t rownr, const Array<uInt>* value)
 {
     Bool deleteIt;
     const uInt* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayInt64V (uInt rownr, Array<Int64>* value)
+void ISMColumn::getArrayInt64V (rownr_t rownr, Array<Int64>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -718,14 +811,14 @@ void ISMColumn::getArrayInt64V (uInt rownr, Array<Int64>* value)
     *value = Array<Int64> (shape_p, (Int64*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayInt64V (uInt rownr, const Array<Int64>* value)
+void ISMColumn::putArrayInt64V (rownr_t rownr, const Array<Int64>* value)
 {
     Bool deleteIt;
     const Int64* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayfloatV (uInt rownr, Array<float>* value)
+void ISMColumn::getArrayfloatV (rownr_t rownr, Array<float>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -733,14 +826,14 @@ void ISMColumn::getArrayfloatV (uInt rownr, Array<float>* value)
     *value = Array<float> (shape_p, (float*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayfloatV (uInt rownr, const Array<float>* value)
+void ISMColumn::putArrayfloatV (rownr_t rownr, const Array<float>* value)
 {
     Bool deleteIt;
     const float* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArraydoubleV (uInt rownr, Array<double>* value)
+void ISMColumn::getArraydoubleV (rownr_t rownr, Array<double>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -748,14 +841,14 @@ void ISMColumn::getArraydoubleV (uInt rownr, Array<double>* value)
     *value = Array<double> (shape_p, (double*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArraydoubleV (uInt rownr, const Array<double>* value)
+void ISMColumn::putArraydoubleV (rownr_t rownr, const Array<double>* value)
 {
     Bool deleteIt;
     const double* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayComplexV (uInt rownr, Array<Complex>* value)
+void ISMColumn::getArrayComplexV (rownr_t rownr, Array<Complex>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -763,14 +856,14 @@ void ISMColumn::getArrayComplexV (uInt rownr, Array<Complex>* value)
     *value = Array<Complex> (shape_p, (Complex*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayComplexV (uInt rownr, const Array<Complex>* value)
+void ISMColumn::putArrayComplexV (rownr_t rownr, const Array<Complex>* value)
 {
     Bool deleteIt;
     const Complex* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayDComplexV (uInt rownr, Array<DComplex>* value)
+void ISMColumn::getArrayDComplexV (rownr_t rownr, Array<DComplex>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -778,14 +871,14 @@ void ISMColumn::getArrayDComplexV (uInt rownr, Array<DComplex>* value)
     *value = Array<DComplex> (shape_p, (DComplex*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayDComplexV (uInt rownr, const Array<DComplex>* value)
+void ISMColumn::putArrayDComplexV (rownr_t rownr, const Array<DComplex>* value)
 {
     Bool deleteIt;
     const DComplex* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayStringV (uInt rownr, Array<String>* value)
+void ISMColumn::getArrayStringV (rownr_t rownr, Array<String>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -793,7 +886,7 @@ void ISMColumn::getArrayStringV (uInt rownr, Array<String>* value)
     *value = Array<String> (shape_p, (String*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayStringV (uInt rownr, const Array<String>* value)
+void ISMColumn::putArrayStringV (rownr_t rownr, const Array<String>* value)
 {
     Bool deleteIt;
     const String* data = value->getStorage (deleteIt);
@@ -802,14 +895,15 @@ void ISMColumn::putArrayStringV (uInt rownr, const Array<String>* value)
 }
 
 
-void ISMColumn::putValue (uInt rownr, const void* value)
+void ISMColumn::putValue (rownr_t rownr, const void* value)
 {
     // Get the bucket and interval to which the row belongs.
-    uInt bucketStartRow, bucketNrrow;
+    rownr_t bucketStartRow, bucketNrrow;
     ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
 					       bucketNrrow);
-    uInt bucketRownr = rownr - bucketStartRow;
-    uInt inx, stint, endint, offset;
+    rownr_t bucketRownr = rownr - bucketStartRow;
+    uInt inx, offset;
+    rownr_t stint, endint;
     // Get the index where to add/replace the new value.
     // Note: offset gives the offset of the current value, which is often NOT
     //       the same as offIndex[inx] (usually it is offIndex[inx-1]).
@@ -841,6 +935,7 @@ void ISMColumn::putValue (uInt rownr, const void* value)
     columnCache().invalidate();
     startRow_p = -1;
     endRow_p   = -1;
+    clearRunMap();
     // Exit if new value equals current value.
     readFunc_p (lastValue_p, bucket->get (offset), nrcopy_p);
     if (compareValue (value, lastValue_p)) {
@@ -1011,7 +1106,7 @@ void ISMColumn::putValue (uInt rownr, const void* value)
     }
 }
 
-void ISMColumn::putFromRow (uInt rownr, const char* data, uInt lenData)
+void ISMColumn::putFromRow (rownr_t rownr, const char* data, uInt lenData)
 {
     // Skip the first bucket, because that is the one containing the
     // row just written.
@@ -1023,7 +1118,7 @@ void ISMColumn::putFromRow (uInt rownr, const char* data, uInt lenData)
 #endif
 
     ISMBucket* bucket;
-    uInt bucketNrrow;
+    rownr_t bucketNrrow;
     uInt cursor = 0;
     bucket = stmanPtr_p->nextBucket (cursor, rownr, bucketNrrow);
     // Loop through all buckets from the given row on.
@@ -1048,13 +1143,14 @@ void ISMColumn::putFromRow (uInt rownr, const char* data, uInt lenData)
 #endif
 }
 
-void ISMColumn::putData (ISMBucket* bucket, uInt bucketStartRow,
-			 uInt bucketNrrow, uInt bucketRownr,
+void ISMColumn::putData (ISMBucket* bucket, rownr_t bucketStartRow,
+			 rownr_t bucketNrrow, rownr_t bucketRownr,
 			 const char* data, uInt lenData,
 			 Bool afterLastRow, Bool canSplit)
 {
     // Determine the index.
-    uInt inx, start, end, dum3;
+    uInt inx, dum3;
+    rownr_t start, end;
     inx = bucket->getInterval (colnr_p, bucketRownr, 0, start, end, dum3);
     if ((afterLastRow  &&  bucketRownr == 0)  ||  start == end) {
 	Block<uInt>& offIndex = bucket->offIndex (colnr_p);
@@ -1066,8 +1162,8 @@ void ISMColumn::putData (ISMBucket* bucket, uInt bucketStartRow,
     }
 }
 
-void ISMColumn::replaceData (ISMBucket* bucket, uInt bucketStartRow,
-			     uInt bucketNrrow, uInt bucketRownr, uInt& offset,
+void ISMColumn::replaceData (ISMBucket* bucket, rownr_t bucketStartRow,
+			     rownr_t bucketNrrow, rownr_t bucketRownr, uInt& offset,
 			     const char* data, uInt lenData, Bool canSplit)
 {
     // Replacing a value means removing the old value.
@@ -1085,7 +1181,7 @@ void ISMColumn::replaceData (ISMBucket* bucket, uInt bucketStartRow,
     ISMBucket* left;
     ISMBucket* right;
     Block<Bool> duplicated;
-    uInt splitRownr = bucket->split (left, right, duplicated,
+    rownr_t splitRownr = bucket->split (left, right, duplicated,
 				     bucketStartRow, bucketNrrow,
 				     colnr_p, bucketRownr, lenData - oldLeng);
 
@@ -1109,8 +1205,8 @@ void ISMColumn::replaceData (ISMBucket* bucket, uInt bucketStartRow,
     stmanPtr_p->addBucket (splitRownr + bucketStartRow, right);
 }
 
-Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
-			 uInt bucketNrrow, uInt bucketRownr, uInt inx,
+Bool ISMColumn::addData (ISMBucket* bucket, rownr_t bucketStartRow,
+			 rownr_t bucketNrrow, rownr_t bucketRownr, uInt inx,
 			 const char* data, uInt lenData,
 			 Bool afterLastRow, Bool canSplit)
 {
@@ -1124,7 +1220,7 @@ Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
     ISMBucket* left;
     ISMBucket* right;
     Block<Bool> duplicated;
-    uInt splitRownr = bucket->split (left, right, duplicated,
+    rownr_t splitRownr = bucket->split (left, right, duplicated,
 				     bucketStartRow, bucketNrrow,
 				     colnr_p, bucketRownr, lenData);
 
@@ -1137,8 +1233,8 @@ Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
     bucket->copy (*left);
     delete left;
     // Add the data to the correct part.
-    uInt startRow = bucketStartRow;
-    uInt nrrow    = splitRownr;
+    rownr_t startRow = bucketStartRow;
+    rownr_t nrrow    = splitRownr;
     if (bucketRownr >= splitRownr) {
 	bucket = right;
 	bucketRownr -= splitRownr;
@@ -1154,23 +1250,23 @@ Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
 }
 
 #ifdef AIPS_TRACE
-void ISMColumn::handleCopy (uInt rownr, const char*)
+void ISMColumn::handleCopy (rownr_t rownr, const char*)
 {
     cout << "   handleCopy for row " << rownr
 	 << ", column " << colnr_p << endl;
 #else
-void ISMColumn::handleCopy (uInt, const char*)
+void ISMColumn::handleCopy (rownr_t, const char*)
 {
 #endif
 }
 
 #ifdef AIPS_TRACE
-void ISMColumn::handleRemove (uInt rownr, const char*)
+void ISMColumn::handleRemove (rownr_t rownr, const char*)
 {
     cout << "   handleRemove for row " << rownr
 	 << ", column " << colnr_p << endl;
 #else
-void ISMColumn::handleRemove (uInt, const char*)
+void ISMColumn::handleRemove (rownr_t, const char*)
 {
 #endif
 }
@@ -1207,6 +1303,7 @@ Bool ISMColumn::compareValue (const void* val1, const void* val2) const
 void ISMColumn::init()
 {
     clear();
+    clearRunMap();
     DataType dt = (DataType)dataType();
     typeSize_p = ValType::getTypeSize (dt);
     Bool asBigEndian = stmanPtr_p->asBigEndian();
@@ -1343,22 +1440,23 @@ void ISMColumn::doCreate (ISMBucket* bucket)
     bucket->addData (colnr_p, 0, 0, buffer, leng);
 }
 
-void ISMColumn::getFile (uInt nrrow)
+void ISMColumn::getFile (rownr_t nrrow)
 {
     init();
     lastRowPut_p = nrrow;
 }
-Bool ISMColumn::flush (uInt, Bool)
+Bool ISMColumn::flush (rownr_t, Bool)
 {
     return False;
 }
-void ISMColumn::resync (uInt nrrow)
+void ISMColumn::resync (rownr_t nrrow)
 {
     // Invalidate the last value read.
     columnCache().invalidate();
     startRow_p   = -1;
     endRow_p     = -1;
     lastRowPut_p = nrrow;
+    clearRunMap();
 }
 void ISMColumn::reopenRW()
 {}
@@ -37,6 +37,7 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Utilities/Compare.h>
 #include <casacore/casa/OS/Conversion.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -81,6 +82,21 @@ class ISMBucket;
 // To optimize (especially sequential) access to the column, ISMColumn
 // maintains the last value gotten and the rows for which it is valid.
 // In this way a get does not need to access the data in the bucket.
+// <br>Random access (e.g. when iterating in another order than the
+// storage order) would need a bucket lookup and interval search for
+// almost every row. Therefore a scalar column builds an interval map
+// holding the start row and value of each interval in the entire column
+// once the number of non-sequential lookups exceeds the number of buckets.
+// Thereafter the interval of a row is found by a binary search in the map.
+// Note that building the map reads all buckets of the column at once,
+// so the get causing it takes much longer than the other ones. The map
+// holds a copy of the value of each interval (also of a String), thus
+// its size is about the size of the column data.
+// <br>Getting the entire column expands the intervals in the map directly
+// into the result if the map exists. Otherwise the intervals are expanded
+// while walking through the buckets, so no map is built (and kept) for a
+// single read of the entire column.
+// The map is discarded when the column changes.
 // <p>
 // ISMColumn use the static conversion functions in the
 // <linkto class=Conversion>Conversion</linkto> framework to
@@ -127,60 +143,68 @@ public:
 
     // Get the dimensionality of the item in the given row.
     // This is the same for all rows.
-    virtual uInt ndim (uInt rownr);
+    virtual uInt ndim (rownr_t rownr);
 
     // Get the shape of the array in the given row.
     // This is the same for all rows.
-    virtual IPosition shape (uInt rownr);
+    virtual IPosition shape (rownr_t rownr);
 
     // Let the column object initialize itself for a newly created table.
     // This is meant for a derived class.
     virtual void doCreate (ISMBucket*);
 
     // Let the column object initialize itself for an existing table.
-    virtual void getFile (uInt nrrow);
+    virtual void getFile (rownr_t nrrow);
 
     // Flush and optionally fsync the data.
     // This is meant for a derived class.
-    virtual Bool flush (uInt nrrow, Bool fsync);
+    virtual Bool flush (rownr_t nrrow, Bool fsync);
+
+    // Get the range of the values in the rows from rownr till endRow
+    // for a numeric scalar column.
+    // Because a bucket holds each value only once for the interval of rows
+    // it applies to, the range is derived from the values stored in the
+    // bucket containing the row, thus endRow is limited to its last row.
+    virtual Bool getValueRange (rownr_t rownr, rownr_t& endRow,
+                                Double& minVal, Double& maxVal);
 
     // Resync the storage manager with the new file contents.
     // It resets the last rownr put.
-    void resync (uInt nrrow);
+    void resync (rownr_t nrrow);
 
     // Let the column reopen its data files for read/write access.
     virtual void reopenRW();
 
     // Get a scalar value in the given row.
     // <group>
-    virtual void getBoolV     (uInt rownr, Bool* dataPtr);
-    virtual void getuCharV    (uInt rownr, uChar* dataPtr);
-    virtual void getShortV    (uInt rownr, Short* dataPtr);
-    virtual void getuShortV   (uInt rownr, uShort* dataPtr);
-    virtual void getIntV      (uInt rownr, Int* dataPtr);
-    virtual void getuIntV     (uInt rownr, uInt* dataPtr);
-    virtual void getInt64V    (uInt rownr, Int64* dataPtr);
-    virtual void getfloatV    (uInt rownr, float* dataPtr);
-    virtual void getdoubleV   (uInt rownr, double* dataPtr);
-    virtual void getComplexV  (uInt rownr, Complex* dataPtr);
-    virtual void getDComplexV (uInt rownr, DComplex* dataPtr);
-    virtual void getStringV   (uInt rownr, String* dataPtr);
+    virtual void getBoolV     (rownr_t rownr, Bool* dataPtr);
+    virtual void getuCharV    (rownr_t rownr, uChar* dataPtr);
+    virtual void getShortV    (rownr_t rownr, Short* dataPtr);
+    virtual void getuShortV   (rownr_t rownr, uShort* dataPtr);
+    virtual void getIntV      (rownr_t rownr, Int* dataPtr);
+    virtual void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    virtual void getInt64V    (rownr_t rownr, Int64* dataPtr);
+    virtual void getfloatV    (rownr_t rownr, float* dataPtr);
+    virtual void getdoubleV   (rownr_t rownr, double* dataPtr);
+    virtual void getComplexV  (rownr_t rownr, Complex* dataPtr);
+    virtual void getDComplexV (rownr_t rownr, DComplex* dataPtr);
+    virtual void getStringV   (rownr_t rownr, String* dataPtr);
     // </group>
 
     // Put a scalar value in the given row.
     // <group>
-    virtual void putBoolV     (uInt rownr, const Bool* dataPtr);
-    virtual void putuCharV    (uInt rownr, const uChar* dataPtr);
-    virtual void putShortV    (uInt rownr, const Short* dataPtr);
-    virtual void putuShortV   (uInt rownr, const uShort* dataPtr);
-    virtual void putIntV      (uInt rownr, const Int* dataPtr);
-    virtual void putuIntV     (uInt rownr, const uInt* dataPtr);
-    virtual void putInt64V    (uInt rownr, const Int64* dataPtr);
-    virtual void putfloatV    (uInt rownr, const float* dataPtr);
-    virtual void putdoubleV   (uInt rownr, const double* dataPtr);
-    virtual void putComplexV  (uInt rownr, const Complex* dataPtr);
-    virtual void putDComplexV (uInt rownr, const DComplex* dataPtr);
-    virtual void putStringV   (uInt rownr, const String* dataPtr);
+    virtual void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+    virtual void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+    virtual void putShortV    (rownr_t rownr, const Short* dataPtr);
+    virtual void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+    virtual void putIntV      (rownr_t rownr, const Int* dataPtr);
+    virtual void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    virtual void putInt64V    (rownr_t rownr, const Int64* dataPtr);
+    virtual void putfloatV    (rownr_t rownr, const float* dataPtr);
+    virtual void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    virtual void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+    virtual void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
+    virtual void putStringV   (rownr_t rownr, const String* dataPtr);
     // </group>
 
     // Get the scalar values in the entire column.
@@ -252,43 +276,43 @@ public:
 
     // Get an array value in the given row.
     // <group>
-    virtual void getArrayBoolV     (uInt rownr, Array<Bool>* dataPtr);
-    virtual void getArrayuCharV    (uInt rownr, Array<uChar>* dataPtr);
-    virtual void getArrayShortV    (uInt rownr, Array<Short>* dataPtr);
-    virtual void getArrayuShortV   (uInt rownr, Array<uShort>* dataPtr);
-    virtual void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-    virtual void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-    virtual void getArrayInt64V    (uInt rownr, Array<Int64>* dataPtr);
-    virtual void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-    virtual void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-    virtual void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-    virtual void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
-    virtual void getArrayStringV   (uInt rownr, Array<String>* dataPtr);
+    virtual void getArrayBoolV     (rownr_t rownr, Array<Bool>* dataPtr);
+    virtual void getArrayuCharV    (rownr_t rownr, Array<uChar>* dataPtr);
+    virtual void getArrayShortV    (rownr_t rownr, Array<Short>* dataPtr);
+    virtual void getArrayuShortV   (rownr_t rownr, Array<uShort>* dataPtr);
+    virtual void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+    virtual void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+    virtual void getArrayInt64V    (rownr_t rownr, Array<Int64>* dataPtr);
+    virtual void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+    virtual void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+    virtual void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+    virtual void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
+    virtual void getArrayStringV   (rownr_t rownr, Array<String>* dataPtr);
     // </group>
 
     // Put an array value in the given row.
     // <group>
-    virtual void putArrayBoolV     (uInt rownr, const Array<Bool>* dataPtr);
-    virtual void putArrayuCharV    (uInt rownr, const Array<uChar>* dataPtr);
-    virtual void putArrayShortV    (uInt rownr, const Array<Short>* dataPtr);
-    virtual void putArrayuShortV   (uInt rownr, const Array<uShort>* dataPtr);
-    virtual void putArrayIntV      (uInt rownr, const Array<Int>* dataPtr);
-    virtual void putArrayuIntV     (uInt rownr, const Array<uInt>* dataPtr);
-    virtual void putArrayInt64V    (uInt rownr, const Array<Int64>* dataPtr);
-    virtual void putArrayfloatV    (uInt rownr, const Array<float>* dataPtr);
-    virtual void putArraydoubleV   (uInt rownr, const Array<double>* dataPtr);
-    virtual void putArrayComplexV  (uInt rownr, const Array<Complex>* dataPtr);
-    virtual void putArrayDComplexV (uInt rownr, const Array<DComplex>* dataPtr);
-    virtual void putArrayStringV   (uInt rownr, const Array<String>* dataPtr);
+    virtual void putArrayBoolV     (rownr_t rownr, const Array<Bool>* dataPtr);
+    virtual void putArrayuCharV    (rownr_t rownr, const Array<uChar>* dataPtr);
+    virtual void putArrayShortV    (rownr_t rownr, const Array<Short>* dataPtr);
+    virtual void putArrayuShortV   (rownr_t rownr, const Array<uShort>* dataPtr);
+    virtual void putArrayIntV      (rownr_t rownr, const Array<Int>* dataPtr);
+    virtual void putArrayuIntV     (rownr_t rownr, const Array<uInt>* dataPtr);
+    virtual void putArrayInt64V    (rownr_t rownr, const Array<Int64>* dataPtr);
+    virtual void putArrayfloatV    (rownr_t rownr, const Array<float>* dataPtr);
+    virtual void putArraydoubleV   (rownr_t rownr, const Array<double>* dataPtr);
+    virtual void putArrayComplexV  (rownr_t rownr, const Array<Complex>* dataPtr);
+    virtual void putArrayDComplexV (rownr_t rownr, const Array<DComplex>* dataPtr);
+    virtual void putArrayStringV   (rownr_t rownr, const Array<String>* dataPtr);
     // </group>
 
     // Add (newNrrow-oldNrrow) rows to the column and initialize
     // the new rows when needed.
-    virtual void addRow (uInt newNrrow, uInt oldNrrow);
+    virtual void addRow (rownr_t newNrrow, rownr_t oldNrrow);
 
     // Remove the given row in the bucket from the column.
-    void remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
-		 uInt newNrrow);
+    void remove (rownr_t bucketRownr, ISMBucket* bucket, rownr_t bucketNrrow,
+		 rownr_t newNrrow);
 
     // Get the function needed to read/write a uInt from/to external format.
     // This is used by other classes to read the length of a variable
@@ -300,11 +324,11 @@ public:
 
     // Give a derived class the opportunity to react on the duplication
     // of a value. It is used by ISMIndColumn.
-    virtual void handleCopy (uInt rownr, const char* value);
+    virtual void handleCopy (rownr_t rownr, const char* value);
 
     // Give a derived class the opportunity to react on the removal
     // of a value. It is used by ISMIndColumn.
-    virtual void handleRemove (uInt rownr, const char* value);
+    virtual void handleRemove (rownr_t rownr, const char* value);
 
     // Get the fixed length of the data value in a cell of this column
     // (0 = variable length).
@@ -320,10 +344,10 @@ protected:
 
     // Get the value for this row.
     // Set the cache if the flag is set.
-    void getValue (uInt rownr, void* value, Bool setCache);
+    void getValue (rownr_t rownr, void* value, Bool setCache);
 
     // Put the value for this row.
-    void putValue (uInt rownr, const void* value);
+    void putValue (rownr_t rownr, const void* value);
 
     //# Declare member variables.
     // Pointer to the parent storage manager.
@@ -347,7 +371,7 @@ protected:
     Int               endRow_p;
     void*             lastValue_p;
     // The last row for which a value has been put.
-    uInt              lastRowPut_p;
+    rownr_t           lastRowPut_p;
     // The size of the data type in local format.
     uInt              typeSize_p;
     // Pointer to a convert function for writing.
@@ -373,26 +397,26 @@ private:
     void clear();
 
     // Put the value in all buckets from the given row on.
-    void putFromRow (uInt rownr, const char* data, uInt lenData);
+    void putFromRow (rownr_t rownr, const char* data, uInt lenData);
 
     // Put a data value into the bucket.
     // When it is at the first row of the bucket, it replaces the value.
     // Otherwise it is added.
-    void putData (ISMBucket* bucket, uInt bucketStartRow,
-		  uInt bucketNrrow, uInt bucketRownr,
+    void putData (ISMBucket* bucket, rownr_t bucketStartRow,
+		  rownr_t bucketNrrow, rownr_t bucketRownr,
 		  const char* data, uInt lenData,
 		  Bool afterLastRow, Bool canSplit);
 
     // Replace a value at the given offset in the bucket.
     // If the bucket is too small, it will be split (if allowed).
-    void replaceData (ISMBucket* bucket, uInt bucketStartRow,
-		      uInt bucketNrrow, uInt bucketRownr, uInt& offset,
+    void replaceData (ISMBucket* bucket, rownr_t bucketStartRow,
+		      rownr_t bucketNrrow, rownr_t bucketRownr, uInt& offset,
 		      const char* data, uInt lenData, Bool canSplit = True);
 
     // Add a value at the given index in the bucket.
     // If the bucket is too small, it will be split (if allowed).
-    Bool addData (ISMBucket* bucket, uInt bucketStartRow,
-		  uInt bucketNrrow, uInt bucketRownr, uInt inx,
+    Bool addData (ISMBucket* bucket, rownr_t bucketStartRow,
+		  rownr_t bucketNrrow, rownr_t bucketRownr, uInt inx,
 		  const char* data, uInt lenData,
 		  Bool afterLastRow = False, Bool canSplit = True);
 
@@ -413,6 +437,38 @@ private:
     static size_t writeStringLE (void* out, const void* in, size_t n);
     static size_t readStringLE (void* out, const void* in, size_t n);
     // </group>
+
+    // Build the interval map of a scalar column from the intervals
+    // in all buckets. Adjacent intervals with equal values are combined.
+    void buildRunMap();
+
+    // Discard the interval map (after the column has changed).
+    void clearRunMap();
+
+    // Get the value of the given row from the interval map and set the
+    // last value and its interval. The map is built if the number of
+    // lookups exceeds the number of buckets, which means that that lookup
+    // reads all buckets.
+    // False is returned if no map is used.
+    Bool getRunValue (rownr_t rownr);
+
+    // Get a pointer to the value of the i-th interval in the map.
+    const void* runValue (size_t inx) const;
+
+    // Get the entire column by expanding the intervals in the map or,
+    // if there is no map, in the buckets.
+    template<typename T>
+    void getColumnRuns (Vector<T>* dataPtr);
+
+    //# The interval map. runStart_p holds the first row of each interval
+    //# followed by the number of rows. The values are held in local
+    //# format in runValues_p or, for a String column, in runStrings_p.
+    std::vector<rownr_t> runStart_p;
+    std::vector<char>    runValues_p;
+    std::vector<String>  runStrings_p;
+    Bool                 hasRunMap_p;
+    //# Number of bucket lookups since the map has been discarded.
+    uInt                 nrLookup_p;
 };
 
 
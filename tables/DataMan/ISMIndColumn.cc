@@ -80,17 +80,17 @@ void ISMIndColumn::doCreate (ISMBucket* bucket)
     uInt leng = writeFunc_p (buffer, lastValue_p, 1);
     bucket->addData (colnr_p, 0, 0, buffer, leng);
 }
-void ISMIndColumn::getFile (uInt nrrow)
+void ISMIndColumn::getFile (rownr_t nrrow)
 {
     // Initialize and open existing file.
     init (stmanPtr_p->fileOption());
     lastRowPut_p = nrrow;
 }
-Bool ISMIndColumn::flush (uInt, Bool fsync)
+Bool ISMIndColumn::flush (rownr_t, Bool fsync)
 {
     return iosfile_p->flush (fsync);
 }
-void ISMIndColumn::resync (uInt nrrow)
+void ISMIndColumn::resync (rownr_t nrrow)
 {
     ISMColumn::resync (nrrow);
     if (stmanPtr_p->version() < 3) {
@@ -102,7 +102,12 @@ void ISMIndColumn::reopenRW()
     iosfile_p->reopenRW();
 }
 
-void ISMIndColumn::addRow (uInt, uInt oldNrrow)
+Bool ISMIndColumn::getValueRange (rownr_t, rownr_t&, Double&, Double&)
+{
+    return False;
+}
+
+void ISMIndColumn::addRow (rownr_t, rownr_t oldNrrow)
 {
     // If the shape is fixed and if the first row is added, define
     // an array to have an array for all rows.
@@ -119,7 +124,7 @@ void ISMIndColumn::setShapeColumn (const IPosition& shape)
     shapeIsFixed_p = True;
 }
 
-void ISMIndColumn::setShape (uInt rownr, const IPosition& shape)
+void ISMIndColumn::setShape (rownr_t rownr, const IPosition& shape)
 {
     StIndArray* ptr = getArrayPtr (rownr);
     if (ptr != 0) {
@@ -132,7 +137,7 @@ void ISMIndColumn::setShape (uInt rownr, const IPosition& shape)
 
 //# Get the shape for the array (if any) in the given row.
 //# Read shape if not read yet.
-StIndArray* ISMIndColumn::getArrayPtr (uInt rownr)
+StIndArray* ISMIndColumn::getArrayPtr (rownr_t rownr)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -152,7 +157,7 @@ StIndArray* ISMIndColumn::getArrayPtr (uInt rownr)
 
 //# Get the shape for the array (if any) in the given row.
 //# Read shape if not read yet.
-StIndArray* ISMIndColumn::getShape (uInt rownr)
+StIndArray* ISMIndColumn::getShape (rownr_t rownr)
 {
     StIndArray* ptr = getArrayPtr (rownr);
     if (ptr == 0) {
@@ -166,7 +171,7 @@ StIndArray* ISMIndColumn::getShape (uInt rownr)
 }
 
 //# Set the shape for the array in the given row for a put operation.
-StIndArray* ISMIndColumn::putShape (uInt rownr, const IPosition& shape)
+StIndArray* ISMIndColumn::putShape (rownr_t rownr, const IPosition& shape)
 {
     //# Insert an entry for this row and set its shape.
     //# Nothing will be done if it is already defined.
@@ -178,7 +183,7 @@ StIndArray* ISMIndColumn::putShape (uInt rownr, const IPosition& shape)
 
 //# Set the shape for the array (if any) in the given row for a sliced
 //# put operation.
-StIndArray* ISMIndColumn::putShapeSliced (uInt rownr)
+StIndArray* ISMIndColumn::putShapeSliced (rownr_t rownr)
 {
     //# Get the shape of this row and define it again.
     //# Defining is necessary, because the shape gotten may be valid for
@@ -188,13 +193,13 @@ StIndArray* ISMIndColumn::putShapeSliced (uInt rownr)
     return putArrayPtr (rownr, ptr->shape(), True);
 }
 
-Bool ISMIndColumn::isShapeDefined (uInt rownr)
+Bool ISMIndColumn::isShapeDefined (rownr_t rownr)
     { return (getArrayPtr(rownr) == 0  ?  False : True); }
 
-uInt ISMIndColumn::ndim (uInt rownr)
+uInt ISMIndColumn::ndim (rownr_t rownr)
     { return getShape(rownr)->shape().nelements(); }
 
-IPosition ISMIndColumn::shape (uInt rownr)
+IPosition ISMIndColumn::shape (rownr_t rownr)
     { return getShape(rownr)->shape(); }
 
 Bool ISMIndColumn::canChangeShape() const
@@ -208,7 +213,7 @@ Bool ISMIndColumn::canAccessSlice (Bool& reask) const
 }
 
 
-StIndArray* ISMIndColumn::putArrayPtr (uInt rownr, const IPosition& shape,
+StIndArray* ISMIndColumn::putArrayPtr (rownr_t rownr, const IPosition& shape,
 				       Bool copyData)
 {
     // Start with getting the array pointer. This gives the range
@@ -248,32 +253,32 @@ StIndArray* ISMIndColumn::putArrayPtr (uInt rownr, const IPosition& shape,
 }
 
 
-void ISMIndColumn::getArrayfloatV (uInt rownr, Array<float>* arr)
+void ISMIndColumn::getArrayfloatV (rownr_t rownr, Array<float>* arr)
     { getShape(rownr)->getArrayfloatV (*iosfile_p, arr); }
 
-void ISMIndColumn::putArrayfloatV (uInt rownr, const Array<float>* arr)
+void ISMIndColumn::putArrayfloatV (rownr_t rownr, const Array<float>* arr)
     { putShape(rownr, arr->shape())->putArrayfloatV (*iosfile_p, arr); }
 
-void ISMIndColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
+void ISMIndColumn::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 				   Array<float>* arr)
     { getShape(rownr)->getSlicefloatV (*iosfile_p, ns, arr); }
 
-void ISMIndColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
+void ISMIndColumn::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 				   const Array<float>* arr)
     { putShapeSliced(rownr)->putSlicefloatV (*iosfile_p, ns, arr); }
     
 
 #define ISMIndColumn_GETPUT(T,NM) \
-void ISMIndColumn::aips_name2(getArray,NM) (uInt rownr, Array<T>* arr) \
+void ISMIndColumn::aips_name2(getArray,NM) (rownr_t rownr, Array<T>* arr) \
     { getShape(rownr)->aips_name2(getArray,NM) (*iosfile_p, arr); } \
-void ISMIndColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* arr) \
+void ISMIndColumn::aips_name2(putArray,NM) (rownr_t rownr, const Array<T>* arr) \
     { putShape(rownr, arr->shape())->aips_name2(putArray,NM) \
 	                                                (*iosfile_p, arr); } \
 void ISMIndColumn::aips_name2(getSlice,NM) \
-                             (uInt rownr, const Slicer& ns, Array<T>* arr) \
+                             (rownr_t rownr, const Slicer& ns, Array<T>* arr) \
     { getShape(rownr)->aips_name2(getSlice,NM) (*iosfile_p, ns, arr); } \
 void ISMIndColumn::aips_name2(putSlice,NM) \
-                        (uInt rownr, const Slicer& ns, const Array<T>* arr) \
+                        (rownr_t rownr, const Slicer& ns, const Array<T>* arr) \
     { putShapeSliced(rownr)->aips_name2(putSlice,NM) (*iosfile_p, ns, arr); }
 
 ISMIndColumn_GETPUT(Bool,BoolV)
@@ -326,7 +331,7 @@ void ISMIndColumn::init (ByteIO::OpenOption fileOption)
 }
 
 
-void ISMIndColumn::handleCopy (uInt, const char* value)
+void ISMIndColumn::handleCopy (rownr_t, const char* value)
 {
     Int64 offset;
     readFunc_p (&offset, value, nrcopy_p);
@@ -336,7 +341,7 @@ void ISMIndColumn::handleCopy (uInt, const char* value)
     }
 }
 
-void ISMIndColumn::handleRemove (uInt, const char* value)
+void ISMIndColumn::handleRemove (rownr_t, const char* value)
 {
     Int64 offset;
     readFunc_p (&offset, value, nrcopy_p);
@@ -33,6 +33,7 @@
 #include <casacore/casa/Containers/BlockIO.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -40,7 +41,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 ISMIndex::ISMIndex (ISMBase* parent)
 : stmanPtr_p (parent),
   nused_p    (1),
-  rows_p     (2, (uInt)0),
+  rows_p     (2, (rownr_t)0),
   bucketNr_p (1, (uInt)0)
 {}
 
@@ -49,23 +50,44 @@ ISMIndex::~ISMIndex()
 
 void ISMIndex::get (AipsIO& os)
 {
-    os.getstart ("ISMIndex");
+    uInt version = os.getstart ("ISMIndex");
     os >> nused_p;
-    getBlock (os, rows_p);
+    // As of version 2 the row numbers are stored as 64-bit values.
+    if (version > 1) {
+        getBlock (os, rows_p);
+    } else {
+        Block<uInt> rows;
+        getBlock (os, rows);
+        rows_p.resize (rows.size(), True, False);
+        for (uInt i=0; i<rows.size(); ++i) {
+            rows_p[i] = rows[i];
+        }
+    }
     getBlock (os, bucketNr_p);
     os.getend();
 }
 
 void ISMIndex::put (AipsIO& os)
 {
-    os.putstart ("ISMIndex", 1);
+    // Use version 2 (64-bit row numbers) only if needed, so older software
+    // can still read the index of smaller tables.
+    Bool use64 = (rows_p[nused_p] > std::numeric_limits<uInt>::max());
+    os.putstart ("ISMIndex", (use64 ? 2 : 1));
     os << nused_p;
-    putBlock (os, rows_p, nused_p + 1);
+    if (use64) {
+        putBlock (os, rows_p, nused_p + 1);
+    } else {
+        Block<uInt> rows(nused_p + 1);
+        for (uInt i=0; i<=nused_p; ++i) {
+            rows[i] = uInt(rows_p[i]);
+        }
+        putBlock (os, rows, nused_p + 1);
+    }
     putBlock (os, bucketNr_p, nused_p);
     os.putend();
 }
 
-void ISMIndex::addBucketNr (uInt rownr, uInt bucketNr)
+void ISMIndex::addBucketNr (rownr_t rownr, uInt bucketNr)
 {
     if (nused_p >= bucketNr_p.nelements()) {
 	rows_p.resize (nused_p + 64 + 1);
@@ -83,12 +105,12 @@ void ISMIndex::addBucketNr (uInt rownr, uInt bucketNr)
     nused_p++;
 }
 
-void ISMIndex::addRow (uInt nrrow)
+void ISMIndex::addRow (rownr_t nrrow)
 {
     rows_p[nused_p] += nrrow;
 }
 
-Int ISMIndex::removeRow (uInt rownr)
+Int ISMIndex::removeRow (rownr_t rownr)
 {
     // Decrement the row number for all intervals after the row
     // to be removed.
@@ -114,7 +136,7 @@ Int ISMIndex::removeRow (uInt rownr)
     return emptyBucket;
 }
 
-uInt ISMIndex::getIndex (uInt rownr) const
+uInt ISMIndex::getIndex (rownr_t rownr) const
 {
     // If no exact match, the interval starts at the previous index.
     Bool found;
@@ -126,8 +148,8 @@ uInt ISMIndex::getIndex (uInt rownr) const
     return index;
 }
 
-uInt ISMIndex::getBucketNr (uInt rownr, uInt& bucketStartRow,
-			    uInt& bucketNrrow) const
+uInt ISMIndex::getBucketNr (rownr_t rownr, rownr_t& bucketStartRow,
+			    rownr_t& bucketNrrow) const
 {
     uInt index = getIndex (rownr);
     bucketStartRow = rows_p[index];
@@ -135,8 +157,8 @@ uInt ISMIndex::getBucketNr (uInt rownr, uInt& bucketStartRow,
     return bucketNr_p[index];
 }
 
-Bool ISMIndex::nextBucketNr (uInt& cursor, uInt& bucketStartRow,
-			     uInt& bucketNrrow, uInt& bucketNr) const
+Bool ISMIndex::nextBucketNr (uInt& cursor, rownr_t& bucketStartRow,
+			     rownr_t& bucketNrrow, uInt& bucketNr) const
 {
     // When first time, get the index of the bucket containing the row.
     // End the iteration when the first row is past the end.
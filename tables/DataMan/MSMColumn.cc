@@ -34,6 +34,7 @@
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/tables/DataMan/DataManError.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -57,19 +58,24 @@ MSMColumn::~MSMColumn()
 }
 
 
-void MSMColumn::doCreate (uInt nrrow)
+void MSMColumn::doCreate (rownr_t nrrow)
 {
   addRow (nrrow, 0);
   initData (data_p[1], nrrow);
 }
 
-void MSMColumn::addRow (uInt nrnew, uInt)
+void MSMColumn::addRow (rownr_t nrnew, rownr_t)
 {
+  //# The column data are held in memory in blocks indexed by a uInt.
+  if (nrnew > std::numeric_limits<uInt>::max()) {
+    throw DataManError ("MemoryStMan: column " + columnName() +
+                        " cannot hold more than 2^32-1 rows");
+  }
   //# Extend the column sizes if needed.
   if (nrnew > nralloc_p) {
     uInt n = nralloc_p + 4096;
     if (n < nrnew) {
-      n = nrnew;
+      n = uInt(nrnew);
     }
     resize (n);
   }
@@ -93,7 +99,7 @@ void MSMColumn::resize (uInt nr)
 }
 
 
-uInt MSMColumn::findExt (uInt index, Bool setCache)
+uInt MSMColumn::findExt (rownr_t index, Bool setCache)
 {
   //# Use a binary search to get the block containing the index.
   Int st = 0;
@@ -114,7 +120,7 @@ uInt MSMColumn::findExt (uInt index, Bool setCache)
     }
   }
   if (i > Int(nrext_p)) {
-    throw indexError<uInt>(index, "MSMColumn::findExt - "
+    throw indexError<rownr_t>(index, "MSMColumn::findExt - "
                            "rownr " + String::toString(index) +
                            " in column " + columnName() +
                            " out of range");
@@ -143,24 +149,24 @@ uInt MSMColumn::nextExt (void*& ext, uInt& extnr, uInt nrmax) const
 
 
 #define MSMCOLUMN_GETPUT(T,NM) \
-void MSMColumn::aips_name2(get,NM) (uInt rownr, T* value) \
+void MSMColumn::aips_name2(get,NM) (rownr_t rownr, T* value) \
 { \
   uInt extnr = findExt(rownr, True); \
   *value = ((T*)(data_p[extnr])) [rownr-ncum_p[extnr-1]]; \
 } \
-void MSMColumn::aips_name2(put,NM) (uInt rownr, const T* value) \
+void MSMColumn::aips_name2(put,NM) (rownr_t rownr, const T* value) \
 { \
   uInt extnr = findExt(rownr, True); \
   ((T*)(data_p[extnr])) [rownr-ncum_p[extnr-1]] = *value; \
 } \
-uInt MSMColumn::aips_name2(getBlock,NM) (uInt rownr, uInt nrmax, T* value) \
+uInt MSMColumn::aips_name2(getBlock,NM) (rownr_t rownr, uInt nrmax, T* value) \
 { \
   uInt nr; \
   uInt extnr = findExt(rownr, True); \
-  nrmax = min (nrmax, nralloc_p-rownr); \
+  nrmax = min (nrmax, uInt(nralloc_p-rownr)); \
   uInt nrm = nrmax; \
   while (nrmax > 0) { \
-    nr = min (nrmax, ncum_p[extnr]-rownr); \
+    nr = min (nrmax, uInt(ncum_p[extnr]-rownr)); \
     objcopy (value, ((T*)(data_p[extnr])) +rownr-ncum_p[extnr-1], nr); \
     nrmax -= nr; \
     value += nr; \
@@ -169,13 +175,13 @@ uInt MSMColumn::aips_name2(getBlock,NM) (uInt rownr, uInt nrmax, T* value) \
   } \
   return nrm; \
 } \
-void MSMColumn::aips_name2(putBlock,NM) (uInt rownr, uInt nrmax, const T* value) \
+void MSMColumn::aips_name2(putBlock,NM) (rownr_t rownr, uInt nrmax, const T* value) \
 { \
   uInt nr; \
   uInt extnr = findExt(rownr, True); \
-  nrmax = min (nrmax, nralloc_p-rownr); \
+  nrmax = min (nrmax, uInt(nralloc_p-rownr)); \
   while (nrmax > 0) { \
-    nr = min (nrmax, ncum_p[extnr]-rownr); \
+    nr = min (nrmax, uInt(ncum_p[extnr]-rownr)); \
     objcopy (((T*)(data_p[extnr])) +rownr-ncum_p[extnr-1], value, nr); \
     nrmax -= nr; \
     value += nr; \
@@ -194,16 +200,16 @@ void MSMColumn::aips_name2(getScalarColumnCells,NM) \
   if (rownrs.isSliced()) { \
     RefRowsSliceIter iter(rownrs); \
     while (! iter.pastEnd()) { \
-      uInt rownr = iter.sliceStart(); \
-      uInt end = iter.sliceEnd(); \
-      uInt incr = iter.sliceIncr(); \
+      rownr_t rownr = iter.sliceStart(); \
+      rownr_t end = iter.sliceEnd(); \
+      rownr_t incr = iter.sliceIncr(); \
       while (rownr <= end) { \
         if (rownr < cache.start()  ||  rownr > cache.end()) { \
           aips_name2(get,NM) (rownr, valptr); \
         } \
-	uInt inx = rownr - cache.start(); \
+	rownr_t inx = rownr - cache.start(); \
         const T* cacheValue = (const T*)(cache.dataPtr()) + inx; \
-        uInt endrow = min (end, cache.end()); \
+        rownr_t endrow = min (end, cache.end()); \
         while (rownr <= endrow) { \
 	  *valptr++ = *cacheValue; \
           rownr += incr; \
@@ -213,19 +219,19 @@ void MSMColumn::aips_name2(getScalarColumnCells,NM) \
       iter++; \
     } \
   } else { \
-    const Vector<uInt>& rowvec = rownrs.rowVector(); \
+    const Vector<rownr_t>& rowvec = rownrs.rowVector(); \
     uInt nr = rowvec.nelements(); \
     if (nr > 0) { \
       Bool delR; \
-      const uInt* rows = rowvec.getStorage (delR); \
+      const rownr_t* rows = rowvec.getStorage (delR); \
       if (rows[0] < cache.start()  ||  rows[0] > cache.end()) { \
         findExt(rows[0], True); \
       } \
       const T* cacheValue = (const T*)(cache.dataPtr()); \
-      uInt strow = cache.start(); \
-      uInt endrow = cache.end(); \
+      rownr_t strow = cache.start(); \
+      rownr_t endrow = cache.end(); \
       for (uInt i=0; i<nr; i++) { \
-	uInt rownr = rows[i]; \
+	rownr_t rownr = rows[i]; \
         if (rownr >= strow  &&  rownr <= endrow) { \
 	  value[i] = cacheValue[rownr-strow]; \
 	} else { \
@@ -255,7 +261,7 @@ MSMCOLUMN_GETPUT(DComplex,DComplexV)
 MSMCOLUMN_GETPUT(String,StringV)
 
 
-void MSMColumn::remove (uInt index)
+void MSMColumn::remove (rownr_t index)
 {
   //# Find the extension.
   uInt extnr  = findExt(index, False);
@@ -521,12 +527,12 @@ void MSMColumn::initData (void* datap, uInt nrval)
 }
 
 
-void* MSMColumn::getArrayPtr (uInt rownr)
+void* MSMColumn::getArrayPtr (rownr_t rownr)
 {
   uInt extnr = findExt(rownr, False);
   return ((void**)(data_p[extnr])) [rownr-ncum_p[extnr-1]];
 }
-void MSMColumn::putArrayPtr (uInt rownr, void* ptr)
+void MSMColumn::putArrayPtr (rownr_t rownr, void* ptr)
 {
   uInt extnr = findExt(rownr, False);
   ((void**)(data_p[extnr])) [rownr-ncum_p[extnr-1]] = ptr;
@@ -46,8 +46,8 @@ MSMDirColumn::MSMDirColumn (MSMBase* smptr, int dataType)
 
 MSMDirColumn::~MSMDirColumn()
 {
-  uInt nr = stmanPtr_p->nrow();
-  for (uInt i=0; i<nr; i++) {
+  rownr_t nr = stmanPtr_p->nrow();
+  for (rownr_t i=0; i<nr; i++) {
     deleteArray (i);
   }
 }
@@ -60,7 +60,7 @@ void MSMDirColumn::setShapeColumn (const IPosition& shape)
 }
 
 
-void MSMDirColumn::addRow (uInt nrnew, uInt nrold)
+void MSMDirColumn::addRow (rownr_t nrnew, rownr_t nrold)
 {
   //# Extend data blocks if needed.
   MSMColumn::addRow (nrnew, nrold);
@@ -72,7 +72,7 @@ void MSMDirColumn::addRow (uInt nrnew, uInt nrold)
   }
 }
 
-void MSMDirColumn::doCreate (uInt nrrow)
+void MSMDirColumn::doCreate (rownr_t nrrow)
 {
   addRow (nrrow, 0);
   for (uInt i=0; i<nrrow; i++) {
@@ -80,10 +80,10 @@ void MSMDirColumn::doCreate (uInt nrrow)
   } 
 }
 
-uInt MSMDirColumn::ndim (uInt)
+uInt MSMDirColumn::ndim (rownr_t)
   { return shape_p.nelements(); }
 
-IPosition MSMDirColumn::shape (uInt)
+IPosition MSMDirColumn::shape (rownr_t)
   { return shape_p; }
 
 
@@ -98,21 +98,21 @@ Bool MSMDirColumn::canAccessArrayColumn (Bool& reask) const
   return True;
 }
 
-void MSMDirColumn::getArrayfloatV (uInt rownr, Array<float>* arr)
+void MSMDirColumn::getArrayfloatV (rownr_t rownr, Array<float>* arr)
 {
   Bool deleteIt;
   float* data = arr->getStorage (deleteIt);
   objcopy (data, (const float*)(getArrayPtr (rownr)), nrelem_p);
   arr->putStorage (data, deleteIt);
 }
-void MSMDirColumn::putArrayfloatV (uInt rownr, const Array<float>* arr)
+void MSMDirColumn::putArrayfloatV (rownr_t rownr, const Array<float>* arr)
 {
   Bool deleteIt;
   const float* data = arr->getStorage (deleteIt);
   objcopy ((float*)(getArrayPtr (rownr)), data, nrelem_p);
   arr->freeStorage (data, deleteIt);
 }
-void MSMDirColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
+void MSMDirColumn::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 				   Array<float>* arr)
 {
   Array<float> tabarr (shape_p, (float*) (getArrayPtr (rownr)), SHARE);
@@ -120,7 +120,7 @@ void MSMDirColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
   ns.inferShapeFromSource (shape_p, blc, trc, inc);
   *arr = tabarr(blc, trc, inc);
 }
-void MSMDirColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
+void MSMDirColumn::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 				   const Array<float>* arr)
 {
   Array<float> tabarr (shape_p, (float*) (getArrayPtr (rownr)), SHARE);
@@ -130,14 +130,14 @@ void MSMDirColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
 }
 
 #define MSMARRCOLUMN_GETPUT(T,NM) \
-void MSMDirColumn::aips_name2(getArray,NM) (uInt rownr, Array<T>* arr) \
+void MSMDirColumn::aips_name2(getArray,NM) (rownr_t rownr, Array<T>* arr) \
 { \
   Bool deleteIt; \
   T* data = arr->getStorage (deleteIt); \
   objcopy (data, (const T*)(getArrayPtr (rownr)), nrelem_p); \
   arr->putStorage (data, deleteIt); \
 } \
-void MSMDirColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* arr) \
+void MSMDirColumn::aips_name2(putArray,NM) (rownr_t rownr, const Array<T>* arr) \
 { \
   Bool deleteIt; \
   const T* data = arr->getStorage (deleteIt); \
@@ -145,7 +145,7 @@ void MSMDirColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* arr) \
   arr->freeStorage (data, deleteIt); \
 } \
 void MSMDirColumn::aips_name2(getSlice,NM) \
-                          (uInt rownr, const Slicer& ns, Array<T>* arr) \
+                          (rownr_t rownr, const Slicer& ns, Array<T>* arr) \
 { \
   Array<T> tabarr (shape_p, (T*) (getArrayPtr (rownr)), SHARE); \
   IPosition blc, trc, inc; \
@@ -153,7 +153,7 @@ void MSMDirColumn::aips_name2(getSlice,NM) \
   *arr = tabarr(blc, trc, inc); \
 } \
 void MSMDirColumn::aips_name2(putSlice,NM) \
-                          (uInt rownr, const Slicer& ns, const Array<T>* arr) \
+                          (rownr_t rownr, const Slicer& ns, const Array<T>* arr) \
 { \
   Array<T> tabarr (shape_p, (T*) (getArrayPtr (rownr)), SHARE); \
   IPosition blc, trc, inc; \
@@ -264,7 +264,7 @@ MSMARRCOLUMN_GETPUTCOLUMN(String,StringV)
 
 
 
-void MSMDirColumn::remove (uInt rownr)
+void MSMDirColumn::remove (rownr_t rownr)
 {
   deleteArray (rownr);
   MSMColumn::remove (rownr);
@@ -277,7 +277,7 @@ Bool MSMDirColumn::ok() const
 }
 
 
-void MSMDirColumn::deleteArray (uInt rownr)
+void MSMDirColumn::deleteArray (rownr_t rownr)
 {
   void* datap = getArrayPtr (rownr);
   deleteData (datap, False);
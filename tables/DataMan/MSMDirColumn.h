@@ -82,97 +82,97 @@ public:
 
   // Add (newNrrow-oldNrrow) rows to the column.
   // Allocate the data arrays in these rows if the shape is fixed.
-  void addRow (uInt newNrrow, uInt oldNrrow);
+  void addRow (rownr_t newNrrow, rownr_t oldNrrow);
 
   // Get the dimensionality of the item in the given row.
   // 0 is returned if there is no array.
-  uInt ndim (uInt rownr);
+  uInt ndim (rownr_t rownr);
 
   // Get the shape of the array in the given row.
   // An zero-length IPosition is returned if there is no array.
-  IPosition shape (uInt rownr);
+  IPosition shape (rownr_t rownr);
 
   // Get an array value in the given row.
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn get function).
   // <group>
-  void getArrayBoolV     (uInt rownr, Array<Bool>* dataPtr);
-  void getArrayuCharV    (uInt rownr, Array<uChar>* dataPtr);
-  void getArrayShortV    (uInt rownr, Array<Short>* dataPtr);
-  void getArrayuShortV   (uInt rownr, Array<uShort>* dataPtr);
-  void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-  void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-  void getArrayInt64V    (uInt rownr, Array<Int64>* dataPtr);
-  void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-  void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-  void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-  void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
-  void getArrayStringV   (uInt rownr, Array<String>* dataPtr);
+  void getArrayBoolV     (rownr_t rownr, Array<Bool>* dataPtr);
+  void getArrayuCharV    (rownr_t rownr, Array<uChar>* dataPtr);
+  void getArrayShortV    (rownr_t rownr, Array<Short>* dataPtr);
+  void getArrayuShortV   (rownr_t rownr, Array<uShort>* dataPtr);
+  void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+  void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+  void getArrayInt64V    (rownr_t rownr, Array<Int64>* dataPtr);
+  void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+  void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+  void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+  void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
+  void getArrayStringV   (rownr_t rownr, Array<String>* dataPtr);
   // </group>
 
   // Put an array value into the given row.
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn put function).
   // <group>
-  void putArrayBoolV     (uInt rownr, const Array<Bool>* dataPtr);
-  void putArrayuCharV    (uInt rownr, const Array<uChar>* dataPtr);
-  void putArrayShortV    (uInt rownr, const Array<Short>* dataPtr);
-  void putArrayuShortV   (uInt rownr, const Array<uShort>* dataPtr);
-  void putArrayIntV      (uInt rownr, const Array<Int>* dataPtr);
-  void putArrayuIntV     (uInt rownr, const Array<uInt>* dataPtr);
-  void putArrayInt64V    (uInt rownr, const Array<Int64>* dataPtr);
-  void putArrayfloatV    (uInt rownr, const Array<float>* dataPtr);
-  void putArraydoubleV   (uInt rownr, const Array<double>* dataPtr);
-  void putArrayComplexV  (uInt rownr, const Array<Complex>* dataPtr);
-  void putArrayDComplexV (uInt rownr, const Array<DComplex>* dataPtr);
-  void putArrayStringV   (uInt rownr, const Array<String>* dataPtr);
+  void putArrayBoolV     (rownr_t rownr, const Array<Bool>* dataPtr);
+  void putArrayuCharV    (rownr_t rownr, const Array<uChar>* dataPtr);
+  void putArrayShortV    (rownr_t rownr, const Array<Short>* dataPtr);
+  void putArrayuShortV   (rownr_t rownr, const Array<uShort>* dataPtr);
+  void putArrayIntV      (rownr_t rownr, const Array<Int>* dataPtr);
+  void putArrayuIntV     (rownr_t rownr, const Array<uInt>* dataPtr);
+  void putArrayInt64V    (rownr_t rownr, const Array<Int64>* dataPtr);
+  void putArrayfloatV    (rownr_t rownr, const Array<float>* dataPtr);
+  void putArraydoubleV   (rownr_t rownr, const Array<double>* dataPtr);
+  void putArrayComplexV  (rownr_t rownr, const Array<Complex>* dataPtr);
+  void putArrayDComplexV (rownr_t rownr, const Array<DComplex>* dataPtr);
+  void putArrayStringV   (rownr_t rownr, const Array<String>* dataPtr);
   // </group>
 
   // Get a section of the array in the given row.
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn getSlice function).
   // <group>
-  void getSliceBoolV     (uInt rownr, const Slicer&, Array<Bool>* dataPtr);
-  void getSliceuCharV    (uInt rownr, const Slicer&, Array<uChar>* dataPtr);
-  void getSliceShortV    (uInt rownr, const Slicer&, Array<Short>* dataPtr);
-  void getSliceuShortV   (uInt rownr, const Slicer&, Array<uShort>* dataPtr);
-  void getSliceIntV      (uInt rownr, const Slicer&, Array<Int>* dataPtr);
-  void getSliceuIntV     (uInt rownr, const Slicer&, Array<uInt>* dataPtr);
-  void getSliceInt64V    (uInt rownr, const Slicer&, Array<Int64>* dataPtr);
-  void getSlicefloatV    (uInt rownr, const Slicer&, Array<float>* dataPtr);
-  void getSlicedoubleV   (uInt rownr, const Slicer&, Array<double>* dataPtr);
-  void getSliceComplexV  (uInt rownr, const Slicer&, Array<Complex>* dataPtr);
-  void getSliceDComplexV (uInt rownr, const Slicer&, Array<DComplex>* dataPtr);
-  void getSliceStringV   (uInt rownr, const Slicer&, Array<String>* dataPtr);
+  void getSliceBoolV     (rownr_t rownr, const Slicer&, Array<Bool>* dataPtr);
+  void getSliceuCharV    (rownr_t rownr, const Slicer&, Array<uChar>* dataPtr);
+  void getSliceShortV    (rownr_t rownr, const Slicer&, Array<Short>* dataPtr);
+  void getSliceuShortV   (rownr_t rownr, const Slicer&, Array<uShort>* dataPtr);
+  void getSliceIntV      (rownr_t rownr, const Slicer&, Array<Int>* dataPtr);
+  void getSliceuIntV     (rownr_t rownr, const Slicer&, Array<uInt>* dataPtr);
+  void getSliceInt64V    (rownr_t rownr, const Slicer&, Array<Int64>* dataPtr);
+  void getSlicefloatV    (rownr_t rownr, const Slicer&, Array<float>* dataPtr);
+  void getSlicedoubleV   (rownr_t rownr, const Slicer&, Array<double>* dataPtr);
+  void getSliceComplexV  (rownr_t rownr, const Slicer&, Array<Complex>* dataPtr);
+  void getSliceDComplexV (rownr_t rownr, const Slicer&, Array<DComplex>* dataPtr);
+  void getSliceStringV   (rownr_t rownr, const Slicer&, Array<String>* dataPtr);
   // </group>
 
   // Put into a section of the array in the given row.
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn putSlice function).
   // <group>
-  void putSliceBoolV     (uInt rownr, const Slicer&,
+  void putSliceBoolV     (rownr_t rownr, const Slicer&,
 			  const Array<Bool>* dataPtr);
-  void putSliceuCharV    (uInt rownr, const Slicer&,
+  void putSliceuCharV    (rownr_t rownr, const Slicer&,
 			  const Array<uChar>* dataPtr);
-  void putSliceShortV    (uInt rownr, const Slicer&,
+  void putSliceShortV    (rownr_t rownr, const Slicer&,
 			  const Array<Short>* dataPtr);
-  void putSliceuShortV   (uInt rownr, const Slicer&,
+  void putSliceuShortV   (rownr_t rownr, const Slicer&,
 			  const Array<uShort>* dataPtr);
-  void putSliceIntV      (uInt rownr, const Slicer&,
+  void putSliceIntV      (rownr_t rownr, const Slicer&,
 			  const Array<Int>* dataPtr);
-  void putSliceuIntV     (uInt rownr, const Slicer&,
+  void putSliceuIntV     (rownr_t rownr, const Slicer&,
 			  const Array<uInt>* dataPtr);
-  void putSliceInt64V    (uInt rownr, const Slicer&,
+  void putSliceInt64V    (rownr_t rownr, const Slicer&,
 			  const Array<Int64>* dataPtr);
-  void putSlicefloatV    (uInt rownr, const Slicer&,
+  void putSlicefloatV    (rownr_t rownr, const Slicer&,
 			  const Array<float>* dataPtr);
-  void putSlicedoubleV   (uInt rownr, const Slicer&,
+  void putSlicedoubleV   (rownr_t rownr, const Slicer&,
 			  const Array<double>* dataPtr);
-  void putSliceComplexV  (uInt rownr, const Slicer&,
+  void putSliceComplexV  (rownr_t rownr, const Slicer&,
 			  const Array<Complex>* dataPtr);
-  void putSliceDComplexV (uInt rownr, const Slicer&,
+  void putSliceDComplexV (rownr_t rownr, const Slicer&,
 			  const Array<DComplex>* dataPtr);
-  void putSliceStringV   (uInt rownr, const Slicer&,
+  void putSliceStringV   (rownr_t rownr, const Slicer&,
 			  const Array<String>* dataPtr);
   // </group>
 
@@ -213,10 +213,10 @@ public:
   // </group>
 
   // Remove the value in the given row.
-  void remove (uInt rownr);
+  void remove (rownr_t rownr);
 
   // Let the column create its arrays.
-  void doCreate (uInt nrrow);
+  void doCreate (rownr_t nrrow);
 
   // Check if the class invariants still hold.
   Bool ok() const;
@@ -231,7 +231,7 @@ private:
 
 
   // Delete the array in the given row.
-  void deleteArray (uInt rownr);
+  void deleteArray (rownr_t rownr);
 
   // Forbid copy constructor.
   MSMDirColumn (const MSMDirColumn&);
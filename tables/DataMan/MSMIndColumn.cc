@@ -50,8 +50,8 @@ MSMIndColumn::MSMIndColumn (MSMBase* smptr, int dataType)
 //# Delete all objects created.
 MSMIndColumn::~MSMIndColumn()
 {
-  uInt nr = stmanPtr_p->nrow();
-  for (uInt i=0; i<nr; i++) {
+  rownr_t nr = stmanPtr_p->nrow();
+  for (rownr_t i=0; i<nr; i++) {
     deleteArray (i);
   }
 }
@@ -61,7 +61,7 @@ void MSMIndColumn::setShapeColumn (const IPosition& shape)
   fixedShape_p = shape;
 }
 
-void MSMIndColumn::setShape (uInt rownr, const IPosition& shape)
+void MSMIndColumn::setShape (rownr_t rownr, const IPosition& shape)
 {
   // See if there is already a shape and if it matches.
   Data* ptr = MSMINDCOLUMN_GETDATA(rownr);
@@ -80,7 +80,7 @@ void MSMIndColumn::setShape (uInt rownr, const IPosition& shape)
 
 //# Get the shape for the array (if any) in the given row.
 //# Read shape if not read yet.
-MSMIndColumn::Data* MSMIndColumn::getShape (uInt rownr)
+MSMIndColumn::Data* MSMIndColumn::getShape (rownr_t rownr)
 {
   void* ptr = getArrayPtr(rownr);
   if (ptr == 0) {
@@ -92,13 +92,13 @@ MSMIndColumn::Data* MSMIndColumn::getShape (uInt rownr)
   return static_cast<Data*>(ptr);
 }
 
-Bool MSMIndColumn::isShapeDefined (uInt rownr)
+Bool MSMIndColumn::isShapeDefined (rownr_t rownr)
   { return (getArrayPtr(rownr) == 0  ?  False : True); }
 
-uInt MSMIndColumn::ndim (uInt rownr)
+uInt MSMIndColumn::ndim (rownr_t rownr)
   { return getShape(rownr)->shape().nelements(); }
 
-IPosition MSMIndColumn::shape (uInt rownr)
+IPosition MSMIndColumn::shape (rownr_t rownr)
   { return getShape(rownr)->shape(); }
 
 Bool MSMIndColumn::canChangeShape() const
@@ -112,7 +112,7 @@ Bool MSMIndColumn::canAccessSlice (Bool& reask) const
 }
 
 
-void MSMIndColumn::getArrayfloatV (uInt rownr, Array<float>* arr)
+void MSMIndColumn::getArrayfloatV (rownr_t rownr, Array<float>* arr)
 {
   float* ptr = static_cast<float*>(MSMINDCOLUMN_GETDATA(rownr)->data());
   Bool deleteIt;
@@ -121,7 +121,7 @@ void MSMIndColumn::getArrayfloatV (uInt rownr, Array<float>* arr)
   arr->putStorage (data, deleteIt);
 }
 
-void MSMIndColumn::putArrayfloatV (uInt rownr, const Array<float>* arr)
+void MSMIndColumn::putArrayfloatV (rownr_t rownr, const Array<float>* arr)
 {
   float* ptr = static_cast<float*>(MSMINDCOLUMN_GETDATA(rownr)->data());
   Bool deleteIt;
@@ -130,7 +130,7 @@ void MSMIndColumn::putArrayfloatV (uInt rownr, const Array<float>* arr)
   arr->freeStorage (data, deleteIt);
 }
 
-void MSMIndColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
+void MSMIndColumn::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 				   Array<float>* arr)
 {
   Data* ptr = MSMINDCOLUMN_GETDATA(rownr);
@@ -141,7 +141,7 @@ void MSMIndColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
   *arr = tabarr(blc, trc, inc);
 }
 
-void MSMIndColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
+void MSMIndColumn::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 				   const Array<float>* arr)
 {
   Data* ptr = MSMINDCOLUMN_GETDATA(rownr);
@@ -154,7 +154,7 @@ void MSMIndColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
     
 
 #define MSMINDCOLUMN_GETPUT(T,NM) \
-void MSMIndColumn::aips_name2(getArray,NM) (uInt rownr, Array<T>* arr) \
+void MSMIndColumn::aips_name2(getArray,NM) (rownr_t rownr, Array<T>* arr) \
 { \
   T* ptr = static_cast<T*>(MSMINDCOLUMN_GETDATA(rownr)->data()); \
   Bool deleteIt; \
@@ -162,7 +162,7 @@ void MSMIndColumn::aips_name2(getArray,NM) (uInt rownr, Array<T>* arr) \
   objcopy (data, ptr, arr->nelements()); \
   arr->putStorage (data, deleteIt); \
 } \
-void MSMIndColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* arr) \
+void MSMIndColumn::aips_name2(putArray,NM) (rownr_t rownr, const Array<T>* arr) \
 { \
   T* ptr = static_cast<T*>(MSMINDCOLUMN_GETDATA(rownr)->data()); \
   Bool deleteIt; \
@@ -171,7 +171,7 @@ void MSMIndColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* arr) \
   arr->freeStorage (data, deleteIt); \
 } \
 void MSMIndColumn::aips_name2(getSlice,NM) \
-                             (uInt rownr, const Slicer& ns, Array<T>* arr) \
+                             (rownr_t rownr, const Slicer& ns, Array<T>* arr) \
 { \
   Data* ptr = MSMINDCOLUMN_GETDATA(rownr); \
   const IPosition& shape = ptr->shape(); \
@@ -181,7 +181,7 @@ void MSMIndColumn::aips_name2(getSlice,NM) \
   *arr = tabarr(blc, trc, inc); \
 } \
 void MSMIndColumn::aips_name2(putSlice,NM) \
-                        (uInt rownr, const Slicer& ns, const Array<T>* arr) \
+                        (rownr_t rownr, const Slicer& ns, const Array<T>* arr) \
 { \
   Data* ptr = MSMINDCOLUMN_GETDATA(rownr); \
   const IPosition& shape = ptr->shape(); \
@@ -205,14 +205,14 @@ MSMINDCOLUMN_GETPUT(DComplex,DComplexV)
 MSMINDCOLUMN_GETPUT(String,StringV)
 
 
-void MSMIndColumn::remove (uInt rownr)
+void MSMIndColumn::remove (rownr_t rownr)
 {
   deleteArray (rownr);
   MSMColumn::remove (rownr);
 }
 
 
-void MSMIndColumn::deleteArray (uInt rownr)
+void MSMIndColumn::deleteArray (rownr_t rownr)
 {
   Data* ptr = MSMINDCOLUMN_GETDATA(rownr);
   // Make sure possible IPosition storage is removed.
@@ -0,0 +1,481 @@
+//# PSMCodec.cc: Encoding of buckets in the Packed Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/DataMan/PSMCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/Utilities/DataType.h>
+#include <casacore/casa/string.h>
+#include <algorithm>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Bit-packed values are read as 64-bit words starting at the byte holding
+//# the first bit of a value. So at most 57 bits can be used for a value
+//# and 8 bytes of padding are needed after the packed values.
+static const uInt theirMaxBits = 56;
+static const uInt64 theirSignBit = uInt64(1) << 63;
+
+
+//# Read or write an unsigned value of nbytes bytes in little endian format.
+inline uInt64 psmGet (const uChar* buf, uInt nbytes)
+{
+  switch (nbytes) {
+  case 1:
+    return buf[0];
+  case 2:
+    {
+      uShort v;
+      LECanonicalConversion::toLocal (v, buf);
+      return v;
+    }
+  case 4:
+    {
+      uInt v;
+      LECanonicalConversion::toLocal (v, buf);
+      return v;
+    }
+  }
+  uInt64 v;
+  LECanonicalConversion::toLocal (v, buf);
+  return v;
+}
+
+inline void psmPut (uChar* buf, uInt64 value, uInt nbytes)
+{
+  switch (nbytes) {
+  case 1:
+    buf[0] = uChar(value);
+    break;
+  case 2:
+    {
+      uShort v = value;
+      LECanonicalConversion::fromLocal (buf, v);
+    }
+    break;
+  case 4:
+    {
+      uInt v = value;
+      LECanonicalConversion::fromLocal (buf, v);
+    }
+    break;
+  default:
+    LECanonicalConversion::fromLocal (buf, value);
+  }
+}
+
+//# Get the number of bits needed for a value.
+inline uInt psmNrBits (uInt64 value)
+{
+  uInt nbits = 0;
+  while (value != 0) {
+    nbits++;
+    value >>= 1;
+  }
+  return nbits;
+}
+
+//# Get the number of bytes needed to pack values (including padding).
+inline uInt64 psmPackedSize (uInt64 nrval, uInt nbits)
+{
+  return (nbits == 0  ?  0 : (nrval*nbits + 7) / 8 + 8);
+}
+
+//# Pack the values (which must fit in nbits) into a zeroed buffer.
+static void psmPack (uChar* buf, const uInt64* values, uInt nrval,
+                     uInt nbits)
+{
+  if (nbits > 0) {
+    for (uInt i=0; i<nrval; ++i) {
+      uInt64 bitpos = uInt64(i) * nbits;
+      uChar* ptr = buf + bitpos/8;
+      uInt64 word = psmGet (ptr, 8);
+      word |= values[i] << (bitpos%8);
+      psmPut (ptr, word, 8);
+    }
+  }
+}
+
+//# Get the i-th packed value.
+inline uInt64 psmUnpack (const uChar* buf, uInt64 i, uInt nbits, uInt64 mask)
+{
+  uInt64 bitpos = i * nbits;
+  return (psmGet (buf + bitpos/8, 8) >> (bitpos%8)) & mask;
+}
+
+
+//# The conversion of values to and from unsigned 64-bit keys on which the
+//# encoding operates. The key of a signed integer is biased, so negative
+//# values get small keys as well. A floating point key is its bit pattern.
+//# In Raw and Dictionary encoding the lowest bytes of the key are stored;
+//# function extend recovers the full key from them.
+template<typename T> struct PSMUnsignedKey
+{
+  static uInt64 toKey (T value)
+    { return value; }
+  static T fromKey (uInt64 key)
+    { return T(key); }
+  static uInt64 extend (uInt64 key)
+    { return key; }
+};
+template<typename T> struct PSMSignedKey
+{
+  static uInt64 toKey (T value)
+    { return uInt64(Int64(value)) ^ theirSignBit; }
+  static T fromKey (uInt64 key)
+    { return T(Int64(key ^ theirSignBit)); }
+  static uInt64 extend (uInt64 key)
+  {
+    uInt shift = 64 - 8*sizeof(T);
+    return uInt64((Int64(key << shift)) >> shift) ^ theirSignBit;
+  }
+};
+struct PSMFloatKey
+{
+  static uInt64 toKey (float value)
+    { uInt v; memcpy (&v, &value, sizeof(v)); return v; }
+  static float fromKey (uInt64 key)
+    { uInt v = key; float f; memcpy (&f, &v, sizeof(f)); return f; }
+  static uInt64 extend (uInt64 key)
+    { return key; }
+};
+struct PSMDoubleKey
+{
+  static uInt64 toKey (double value)
+    { uInt64 v; memcpy (&v, &value, sizeof(v)); return v; }
+  static double fromKey (uInt64 key)
+    { double d; memcpy (&d, &key, sizeof(d)); return d; }
+  static uInt64 extend (uInt64 key)
+    { return key; }
+};
+
+
+template<typename T, typename KEY>
+static void psmEncode (std::vector<uChar>& out, const T* values, uInt nrval)
+{
+  const uInt valsize = sizeof(T);
+  // Convert the values to keys and determine their range.
+  std::vector<uInt64> keys(nrval);
+  uInt64 minKey = 0;
+  uInt64 maxKey = 0;
+  for (uInt i=0; i<nrval; ++i) {
+    keys[i] = KEY::toKey (values[i]);
+  }
+  if (nrval > 0) {
+    minKey = maxKey = keys[0];
+    for (uInt i=1; i<nrval; ++i) {
+      minKey = std::min (minKey, keys[i]);
+      maxKey = std::max (maxKey, keys[i]);
+    }
+  }
+  // Determine the (biased) differences and their range.
+  std::vector<uInt64> deltas(nrval > 0  ?  nrval-1 : 0);
+  uInt64 minDelta = 0;
+  uInt64 maxDelta = 0;
+  for (uInt i=1; i<nrval; ++i) {
+    deltas[i-1] = (keys[i] - keys[i-1]) ^ theirSignBit;
+  }
+  if (deltas.size() > 0) {
+    minDelta = maxDelta = deltas[0];
+    for (uInt i=1; i<deltas.size(); ++i) {
+      minDelta = std::min (minDelta, deltas[i]);
+      maxDelta = std::max (maxDelta, deltas[i]);
+    }
+  }
+  // Determine the distinct values.
+  std::vector<uInt64> dict(keys);
+  std::sort (dict.begin(), dict.end());
+  dict.erase (std::unique (dict.begin(), dict.end()), dict.end());
+  // Determine the size of each encoding and use the smallest one.
+  uInt forBits   = psmNrBits (maxKey - minKey);
+  uInt deltaBits = psmNrBits (maxDelta - minDelta);
+  uInt dictBits  = psmNrBits (dict.empty()  ?  0 : dict.size() - 1);
+  uInt64 size = uInt64(nrval) * valsize;
+  PSMCodec::Method method = PSMCodec::Raw;
+  uInt nbits = 0;
+  if (forBits <= theirMaxBits) {
+    uInt64 sz = 8 + psmPackedSize (nrval, forBits);
+    if (sz < size) {
+      size   = sz;
+      method = PSMCodec::FrameOfRef;
+      nbits  = forBits;
+    }
+  }
+  if (deltaBits <= theirMaxBits) {
+    uInt64 sz = 16 + psmPackedSize (deltas.size(), deltaBits);
+    if (sz < size) {
+      size   = sz;
+      method = PSMCodec::Delta;
+      nbits  = deltaBits;
+    }
+  }
+  uInt64 sz = 4 + dict.size()*valsize + psmPackedSize (nrval, dictBits);
+  if (sz < size) {
+    size   = sz;
+    method = PSMCodec::Dictionary;
+    nbits  = dictBits;
+  }
+  // Store the header and the encoded values.
+  out.assign (PSMCodec::headerSize() + size, 0);
+  uChar* buf = out.data();
+  buf[0] = method;
+  buf[1] = nbits;
+  psmPut (buf+2, nrval, 4);
+  buf += PSMCodec::headerSize();
+  switch (method) {
+  case PSMCodec::Raw:
+    for (uInt i=0; i<nrval; ++i) {
+      psmPut (buf + i*valsize, keys[i], valsize);
+    }
+    break;
+  case PSMCodec::FrameOfRef:
+    psmPut (buf, minKey, 8);
+    for (uInt i=0; i<nrval; ++i) {
+      keys[i] -= minKey;
+    }
+    psmPack (buf+8, keys.data(), nrval, nbits);
+    break;
+  case PSMCodec::Delta:
+    psmPut (buf, keys[0], 8);
+    psmPut (buf+8, minDelta, 8);
+    for (uInt i=0; i<deltas.size(); ++i) {
+      deltas[i] -= minDelta;
+    }
+    psmPack (buf+16, deltas.data(), deltas.size(), nbits);
+    break;
+  case PSMCodec::Dictionary:
+    psmPut (buf, dict.size(), 4);
+    buf += 4;
+    for (uInt i=0; i<dict.size(); ++i) {
+      psmPut (buf, dict[i], valsize);
+      buf += valsize;
+    }
+    // Replace each key by its index in the dictionary.
+    for (uInt i=0; i<nrval; ++i) {
+      keys[i] = std::lower_bound (dict.begin(), dict.end(), keys[i]) -
+                dict.begin();
+    }
+    psmPack (buf, keys.data(), nrval, nbits);
+    break;
+  }
+}
+
+template<typename T, typename KEY>
+static void psmDecode (T* values, const std::vector<uChar>& in, uInt nrval)
+{
+  const uInt valsize = sizeof(T);
+  uInt nr = 0;
+  if (! in.empty()) {
+    const uChar* buf = in.data();
+    uInt method = buf[0];
+    uInt nbits  = buf[1];
+    uInt64 mask = (uInt64(1) << nbits) - 1;
+    nr = std::min (nrval, uInt(psmGet (buf+2, 4)));
+    buf += PSMCodec::headerSize();
+    switch (method) {
+    case PSMCodec::Raw:
+      for (uInt i=0; i<nr; ++i) {
+        values[i] = KEY::fromKey (KEY::extend (psmGet (buf + i*valsize,
+                                                       valsize)));
+      }
+      break;
+    case PSMCodec::FrameOfRef:
+      {
+        uInt64 minKey = psmGet (buf, 8);
+        if (nbits == 0) {
+          std::fill (values, values+nr, KEY::fromKey(minKey));
+        } else {
+          buf += 8;
+          for (uInt i=0; i<nr; ++i) {
+            values[i] = KEY::fromKey (minKey + psmUnpack (buf, i, nbits,
+                                                          mask));
+          }
+        }
+      }
+      break;
+    case PSMCodec::Delta:
+      if (nr > 0) {
+        uInt64 key      = psmGet (buf, 8);
+        uInt64 minDelta = psmGet (buf+8, 8);
+        buf += 16;
+        values[0] = KEY::fromKey (key);
+        for (uInt i=1; i<nr; ++i) {
+          uInt64 delta = nbits==0 ? 0 : psmUnpack (buf, i-1, nbits, mask);
+          key += (delta + minDelta) ^ theirSignBit;
+          values[i] = KEY::fromKey (key);
+        }
+      }
+      break;
+    case PSMCodec::Dictionary:
+      {
+        uInt ndict = psmGet (buf, 4);
+        buf += 4;
+        std::vector<T> dict(ndict);
+        for (uInt i=0; i<ndict; ++i) {
+          dict[i] = KEY::fromKey (KEY::extend (psmGet (buf, valsize)));
+          buf += valsize;
+        }
+        if (nbits == 0) {
+          std::fill (values, values+nr, dict[0]);
+        } else {
+          for (uInt i=0; i<nr; ++i) {
+            values[i] = dict[psmUnpack (buf, i, nbits, mask)];
+          }
+        }
+      }
+      break;
+    default:
+      throw DataManError ("PSMCodec: unknown encoding method " +
+                          String::toString(method));
+    }
+  }
+  // Missing values are zero.
+  std::fill (values+nr, values+nrval, T());
+}
+
+
+Bool PSMCodec::isSupported (int dataType)
+{
+  switch (dataType) {
+  case TpBool:
+  case TpUChar:
+  case TpShort:
+  case TpUShort:
+  case TpInt:
+  case TpUInt:
+  case TpInt64:
+  case TpFloat:
+  case TpDouble:
+    return True;
+  default:
+    break;
+  }
+  return False;
+}
+
+void PSMCodec::encode (std::vector<uChar>& out, int dataType,
+                       const void* values, uInt nrval)
+{
+  switch (dataType) {
+  case TpBool:
+    psmEncode<Bool,PSMUnsignedKey<Bool> >
+      (out, static_cast<const Bool*>(values), nrval);
+    break;
+  case TpUChar:
+    psmEncode<uChar,PSMUnsignedKey<uChar> >
+      (out, static_cast<const uChar*>(values), nrval);
+    break;
+  case TpShort:
+    psmEncode<Short,PSMSignedKey<Short> >
+      (out, static_cast<const Short*>(values), nrval);
+    break;
+  case TpUShort:
+    psmEncode<uShort,PSMUnsignedKey<uShort> >
+      (out, static_cast<const uShort*>(values), nrval);
+    break;
+  case TpInt:
+    psmEncode<Int,PSMSignedKey<Int> >
+      (out, static_cast<const Int*>(values), nrval);
+    break;
+  case TpUInt:
+    psmEncode<uInt,PSMUnsignedKey<uInt> >
+      (out, static_cast<const uInt*>(values), nrval);
+    break;
+  case TpInt64:
+    psmEncode<Int64,PSMSignedKey<Int64> >
+      (out, static_cast<const Int64*>(values), nrval);
+    break;
+  case TpFloat:
+    psmEncode<float,PSMFloatKey>
+      (out, static_cast<const float*>(values), nrval);
+    break;
+  case TpDouble:
+    psmEncode<double,PSMDoubleKey>
+      (out, static_cast<const double*>(values), nrval);
+    break;
+  default:
+    throw DataManInvDT ("PSMCodec::encode");
+  }
+}
+
+void PSMCodec::decode (void* values, int dataType,
+                       const std::vector<uChar>& in, uInt nrval)
+{
+  switch (dataType) {
+  case TpBool:
+    psmDecode<Bool,PSMUnsignedKey<Bool> >
+      (static_cast<Bool*>(values), in, nrval);
+    break;
+  case TpUChar:
+    psmDecode<uChar,PSMUnsignedKey<uChar> >
+      (static_cast<uChar*>(values), in, nrval);
+    break;
+  case TpShort:
+    psmDecode<Short,PSMSignedKey<Short> >
+      (static_cast<Short*>(values), in, nrval);
+    break;
+  case TpUShort:
+    psmDecode<uShort,PSMUnsignedKey<uShort> >
+      (static_cast<uShort*>(values), in, nrval);
+    break;
+  case TpInt:
+    psmDecode<Int,PSMSignedKey<Int> >
+      (static_cast<Int*>(values), in, nrval);
+    break;
+  case TpUInt:
+    psmDecode<uInt,PSMUnsignedKey<uInt> >
+      (static_cast<uInt*>(values), in, nrval);
+    break;
+  case TpInt64:
+    psmDecode<Int64,PSMSignedKey<Int64> >
+      (static_cast<Int64*>(values), in, nrval);
+    break;
+  case TpFloat:
+    psmDecode<float,PSMFloatKey>
+      (static_cast<float*>(values), in, nrval);
+    break;
+  case TpDouble:
+    psmDecode<double,PSMDoubleKey>
+      (static_cast<double*>(values), in, nrval);
+    break;
+  default:
+    throw DataManInvDT ("PSMCodec::decode");
+  }
+}
+
+uInt PSMCodec::nrValues (const std::vector<uChar>& in)
+{
+  return (in.empty()  ?  0 : psmGet (in.data()+2, 4));
+}
+
+PSMCodec::Method PSMCodec::method (const std::vector<uChar>& in)
+{
+  return (in.empty()  ?  FrameOfRef : Method(in[0]));
+}
+
+} //# NAMESPACE CASACORE - END
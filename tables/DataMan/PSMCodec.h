@@ -0,0 +1,122 @@
+//# PSMCodec.h: Encoding of buckets in the Packed Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_PSMCODEC_H
+#define TABLES_PSMCODEC_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Encoding of buckets in the Packed Storage Manager
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tPackedStMan.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=PackedStMan>PackedStMan</linkto>
+// </prerequisite>
+
+// <synopsis>
+// PSMCodec encodes and decodes a bucket of scalar values of a column in
+// the Packed Storage Manager. For each bucket the encoding resulting in
+// the smallest size is chosen from:
+// <ul>
+//  <li> <src>Raw</src> stores the values as such.
+//  <li> <src>FrameOfRef</src> stores the minimum value and the
+//       difference of each value with it using as few bits as needed.
+//       A constant bucket takes no bits per value at all.
+//  <li> <src>Delta</src> stores the first value and the differences of
+//       successive values (minus their minimum) using as few bits as needed.
+//       It suits monotonically varying values like row numbers.
+//  <li> <src>Dictionary</src> stores the distinct values and the index
+//       in it of each value using as few bits as needed.
+//       It suits values like TIME having few distinct values in a bucket.
+// </ul>
+// Integer values are encoded as such. Floating point values are encoded
+// using their bit patterns, so the encoding is always lossless.
+// <br>An encoded bucket starts with a header telling the method, number
+// of bits per value, and number of values. All values are stored in little
+// endian format, thus independent of the endian format of the table.
+// <p>
+// The bit-packed values are decoded with a loop without branches, which
+// the compiler can vectorize. A bucket can be decoded directly into the
+// buffer of the caller, which makes getting an entire column fast.
+// </synopsis>
+
+// <motivation>
+// The metadata columns of a MeasurementSet (like ANTENNA1, TIME,
+// and DATA_DESC_ID) have few distinct values or change in a regular way.
+// Encoding them takes much less space than storing the values as such,
+// which speeds up IO bound scans of such columns considerably.
+// </motivation>
+
+class PSMCodec
+{
+public:
+    // The encoding methods.
+    enum Method {Raw=0, FrameOfRef=1, Delta=2, Dictionary=3};
+
+    // Can values of the given data type be encoded?
+    // All integer and real scalar types (and Bool) are supported.
+    static Bool isSupported (int dataType);
+
+    // Encode the given values of the given data type.
+    // The encoded bucket is stored in <src>out</src> (replacing its
+    // contents).
+    static void encode (std::vector<uChar>& out, int dataType,
+                        const void* values, uInt nrval);
+
+    // Decode a bucket into the given values of the given data type.
+    // If the bucket contains fewer than <src>nrval</src> values, the
+    // remaining values are set to zero. An empty bucket decodes as zeros.
+    static void decode (void* values, int dataType,
+                        const std::vector<uChar>& in, uInt nrval);
+
+    // Get the number of values in an encoded bucket.
+    static uInt nrValues (const std::vector<uChar>& in);
+
+    // Get the method of an encoded bucket.
+    static Method method (const std::vector<uChar>& in);
+
+    // Get the size of the header of an encoded bucket.
+    static uInt headerSize()
+      { return 6; }
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
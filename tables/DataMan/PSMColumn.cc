@@ -0,0 +1,255 @@
+//# PSMColumn.cc: A column in the Packed Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/DataMan/PSMColumn.h>
+#include <casacore/tables/DataMan/PackedStMan.h>
+#include <casacore/tables/DataMan/PSMCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/Utilities/ValType.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/string.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+PSMColumn::PSMColumn (PackedStMan* stman, int dataType)
+: StManColumn  (dataType),
+  itsStMan     (stman),
+  itsValueSize (ValType::getTypeSize (DataType(dataType))),
+  itsNrrow     (0),
+  itsBucketNr  (-1),
+  itsChanged   (False)
+{}
+
+PSMColumn::~PSMColumn()
+{}
+
+uInt PSMColumn::bucketNrow (rownr_t bucketNr) const
+{
+  rownr_t strow = bucketNr * itsStMan->bucketRows();
+  return std::min (rownr_t(itsStMan->bucketRows()), itsNrrow - strow);
+}
+
+void PSMColumn::flush()
+{
+  if (itsChanged) {
+    PSMCodec::encode (itsBuckets[itsBucketNr], dataType(), itsData.storage(),
+                      bucketNrow (itsBucketNr));
+    itsChanged = False;
+  }
+}
+
+char* PSMColumn::getBucket (rownr_t bucketNr)
+{
+  if (Int64(bucketNr) != itsBucketNr) {
+    flush();
+    if (itsData.empty()) {
+      itsData.resize (itsStMan->bucketRows() * itsValueSize);
+    }
+    // Decode all values, so values beyond the last row are zero.
+    PSMCodec::decode (itsData.storage(), dataType(), itsBuckets[bucketNr],
+                      itsStMan->bucketRows());
+    itsBucketNr = bucketNr;
+  }
+  rownr_t strow = bucketNr * itsStMan->bucketRows();
+  columnCache().set (strow, strow + bucketNrow(bucketNr) - 1,
+                     itsData.storage());
+  return itsData.storage();
+}
+
+uInt PSMColumn::getBlock (rownr_t rownr, uInt nrmax, char* dataPtr)
+{
+  uInt bucketRows = itsStMan->bucketRows();
+  nrmax = std::min (rownr_t(nrmax), itsNrrow - rownr);
+  uInt nrdone = 0;
+  while (nrdone < nrmax) {
+    rownr_t bucketNr = rownr / bucketRows;
+    uInt inx = rownr - bucketNr*bucketRows;
+    uInt nr  = std::min (nrmax - nrdone, bucketNrow(bucketNr) - inx);
+    if (inx == 0  &&  nr == bucketNrow(bucketNr)  &&
+        Int64(bucketNr) != itsBucketNr) {
+      // An entire bucket can be decoded directly.
+      PSMCodec::decode (dataPtr, dataType(), itsBuckets[bucketNr], nr);
+    } else {
+      memcpy (dataPtr, getBucket(bucketNr) + inx*itsValueSize,
+              nr*itsValueSize);
+    }
+    dataPtr += nr*itsValueSize;
+    rownr   += nr;
+    nrdone  += nr;
+  }
+  return nrmax;
+}
+
+void PSMColumn::putBlock (rownr_t rownr, uInt nrmax, const char* dataPtr)
+{
+  uInt bucketRows = itsStMan->bucketRows();
+  nrmax = std::min (rownr_t(nrmax), itsNrrow - rownr);
+  uInt nrdone = 0;
+  while (nrdone < nrmax) {
+    rownr_t bucketNr = rownr / bucketRows;
+    uInt inx = rownr - bucketNr*bucketRows;
+    uInt nr  = std::min (nrmax - nrdone, bucketNrow(bucketNr) - inx);
+    if (inx == 0  &&  nr == bucketNrow(bucketNr)) {
+      // An entire bucket can be encoded directly.
+      if (Int64(bucketNr) == itsBucketNr) {
+        itsBucketNr = -1;
+        itsChanged  = False;
+        columnCache().invalidate();
+      }
+      PSMCodec::encode (itsBuckets[bucketNr], dataType(), dataPtr, nr);
+    } else {
+      memcpy (getBucket(bucketNr) + inx*itsValueSize, dataPtr,
+              nr*itsValueSize);
+      itsChanged = True;
+    }
+    dataPtr += nr*itsValueSize;
+    rownr   += nr;
+    nrdone  += nr;
+  }
+  itsStMan->setHasPut();
+}
+
+uInt64 PSMColumn::encodedSize()
+{
+  flush();
+  uInt64 size = 0;
+  for (size_t i=0; i<itsBuckets.size(); ++i) {
+    size += itsBuckets[i].size();
+  }
+  return size;
+}
+
+
+#define PSMCOLUMN_GETPUT(T,NM) \
+void PSMColumn::aips_name2(get,NM) (rownr_t rownr, T* value) \
+{ \
+  rownr_t bucketNr = rownr / itsStMan->bucketRows(); \
+  *value = ((T*)(getBucket(bucketNr))) \
+                        [rownr - bucketNr*itsStMan->bucketRows()]; \
+} \
+void PSMColumn::aips_name2(put,NM) (rownr_t rownr, const T* value) \
+{ \
+  rownr_t bucketNr = rownr / itsStMan->bucketRows(); \
+  ((T*)(getBucket(bucketNr))) \
+                 [rownr - bucketNr*itsStMan->bucketRows()] = *value; \
+  itsChanged = True; \
+  itsStMan->setHasPut(); \
+} \
+uInt PSMColumn::aips_name2(getBlock,NM) (rownr_t rownr, uInt nrmax, \
+                                         T* value) \
+{ \
+  return getBlock (rownr, nrmax, (char*)value); \
+} \
+void PSMColumn::aips_name2(putBlock,NM) (rownr_t rownr, uInt nrmax, \
+                                         const T* value) \
+{ \
+  putBlock (rownr, nrmax, (const char*)value); \
+}
+
+PSMCOLUMN_GETPUT(Bool,BoolV)
+PSMCOLUMN_GETPUT(uChar,uCharV)
+PSMCOLUMN_GETPUT(Short,ShortV)
+PSMCOLUMN_GETPUT(uShort,uShortV)
+PSMCOLUMN_GETPUT(Int,IntV)
+PSMCOLUMN_GETPUT(uInt,uIntV)
+PSMCOLUMN_GETPUT(Int64,Int64V)
+PSMCOLUMN_GETPUT(float,floatV)
+PSMCOLUMN_GETPUT(double,doubleV)
+
+
+void PSMColumn::doCreate (rownr_t nrrow)
+{
+  addRow (nrrow, 0);
+}
+
+void PSMColumn::addRow (rownr_t newNrrow, rownr_t)
+{
+  // The new buckets are empty, thus zero. The last bucket is partially
+  // filled, so its missing values are zero as well.
+  itsNrrow = newNrrow;
+  uInt bucketRows = itsStMan->bucketRows();
+  itsBuckets.resize ((itsNrrow + bucketRows - 1) / bucketRows);
+  columnCache().invalidate();
+}
+
+void PSMColumn::remove (rownr_t rownr)
+{
+  // Decode the values from the bucket containing the row till the end,
+  // remove the value, and encode them again.
+  flush();
+  itsBucketNr = -1;
+  columnCache().invalidate();
+  uInt bucketRows = itsStMan->bucketRows();
+  rownr_t stbucket = rownr / bucketRows;
+  rownr_t strow = stbucket * bucketRows;
+  rownr_t nrval = itsNrrow - strow;
+  Block<char> data(nrval * itsValueSize);
+  getBlock (strow, nrval, data.storage());
+  uInt inx = rownr - strow;
+  memmove (data.storage() + inx*itsValueSize,
+           data.storage() + (inx+1)*itsValueSize,
+           (nrval-inx-1) * itsValueSize);
+  itsNrrow--;
+  itsBuckets.resize ((itsNrrow + bucketRows - 1) / bucketRows);
+  for (rownr_t i=stbucket; i<itsBuckets.size(); ++i) {
+    PSMCodec::encode (itsBuckets[i], dataType(),
+                      data.storage() + (i-stbucket)*bucketRows*itsValueSize,
+                      bucketNrow(i));
+  }
+}
+
+void PSMColumn::putFile (AipsIO& ios)
+{
+  flush();
+  ios << uInt64(itsBuckets.size());
+  for (size_t i=0; i<itsBuckets.size(); ++i) {
+    ios.put (itsBuckets[i].size(), itsBuckets[i].data());
+  }
+}
+
+void PSMColumn::getFile (AipsIO& ios, rownr_t nrrow)
+{
+  itsBucketNr = -1;
+  itsChanged  = False;
+  columnCache().invalidate();
+  uInt64 nbucket;
+  ios >> nbucket;
+  itsBuckets.resize (nbucket);
+  for (size_t i=0; i<nbucket; ++i) {
+    uInt nr;
+    ios >> nr;
+    itsBuckets[i].resize (nr);
+    ios.get (nr, itsBuckets[i].data());
+  }
+  itsNrrow = 0;
+  addRow (nrrow, 0);
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,223 @@
+//# PSMColumn.h: A column in the Packed Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_PSMCOLUMN_H
+#define TABLES_PSMCOLUMN_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/StManColumn.h>
+#include <casacore/casa/Containers/Block.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward declarations
+class PackedStMan;
+class AipsIO;
+
+
+// <summary>
+// A column in the Packed Storage Manager
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tPackedStMan.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=PackedStMan>PackedStMan</linkto>
+//   <li> <linkto class=PSMCodec>PSMCodec</linkto>
+// </prerequisite>
+
+// <etymology>
+// PSMColumn handles a column for the Packed Storage Manager.
+// </etymology>
+
+// <synopsis>
+// PSMColumn holds the encoded buckets of a scalar column in memory.
+// Bucket <src>i</src> contains the rows <src>i*bucketRows</src> till
+// <src>(i+1)*bucketRows</src>, so the bucket of a row is known directly.
+// <br>The bucket of the last accessed row is kept decoded in a buffer,
+// which is also used as the column cache. A put changes the value in the
+// buffer; the bucket is encoded again when another bucket is needed or
+// when the column is flushed.
+// <br>Getting or putting a block of values (e.g. an entire column)
+// decodes or encodes whole buckets directly from or into the caller's
+// buffer.
+// <p>
+// Rows added to a column get the value zero. Removing a row requires that
+// the values in the subsequent buckets are shifted, which is slow.
+// </synopsis>
+
+// <motivation>
+// Holding the encoded buckets in memory makes it possible to use
+// fixed-size row ranges, while the encoded buckets vary in size.
+// </motivation>
+
+class PSMColumn : public StManColumn
+{
+public:
+    // Create a column of the given data type.
+    PSMColumn (PackedStMan* stman, int dataType);
+
+    ~PSMColumn();
+
+    // Get a scalar value in the given row.
+    // <group>
+    virtual void getBoolV     (rownr_t rownr, Bool* dataPtr);
+    virtual void getuCharV    (rownr_t rownr, uChar* dataPtr);
+    virtual void getShortV    (rownr_t rownr, Short* dataPtr);
+    virtual void getuShortV   (rownr_t rownr, uShort* dataPtr);
+    virtual void getIntV      (rownr_t rownr, Int* dataPtr);
+    virtual void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    virtual void getInt64V    (rownr_t rownr, Int64* dataPtr);
+    virtual void getfloatV    (rownr_t rownr, float* dataPtr);
+    virtual void getdoubleV   (rownr_t rownr, double* dataPtr);
+    // </group>
+
+    // Put a scalar value into the given row.
+    // <group>
+    virtual void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+    virtual void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+    virtual void putShortV    (rownr_t rownr, const Short* dataPtr);
+    virtual void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+    virtual void putIntV      (rownr_t rownr, const Int* dataPtr);
+    virtual void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    virtual void putInt64V    (rownr_t rownr, const Int64* dataPtr);
+    virtual void putfloatV    (rownr_t rownr, const float* dataPtr);
+    virtual void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    // </group>
+
+    // Get scalars from the given row on with a maximum of nrmax values.
+    // Whole buckets are decoded directly into the buffer.
+    // It is used by getScalarColumn.
+    // <group>
+    virtual uInt getBlockBoolV     (rownr_t rownr, uInt nrmax,
+                                    Bool* dataPtr);
+    virtual uInt getBlockuCharV    (rownr_t rownr, uInt nrmax,
+                                    uChar* dataPtr);
+    virtual uInt getBlockShortV    (rownr_t rownr, uInt nrmax,
+                                    Short* dataPtr);
+    virtual uInt getBlockuShortV   (rownr_t rownr, uInt nrmax,
+                                    uShort* dataPtr);
+    virtual uInt getBlockIntV      (rownr_t rownr, uInt nrmax,
+                                    Int* dataPtr);
+    virtual uInt getBlockuIntV     (rownr_t rownr, uInt nrmax,
+                                    uInt* dataPtr);
+    virtual uInt getBlockInt64V    (rownr_t rownr, uInt nrmax,
+                                    Int64* dataPtr);
+    virtual uInt getBlockfloatV    (rownr_t rownr, uInt nrmax,
+                                    float* dataPtr);
+    virtual uInt getBlockdoubleV   (rownr_t rownr, uInt nrmax,
+                                    double* dataPtr);
+    // </group>
+
+    // Put nrmax scalars from the given row on.
+    // Whole buckets are encoded directly from the buffer.
+    // It is used by putScalarColumn.
+    // <group>
+    virtual void putBlockBoolV     (rownr_t rownr, uInt nrmax,
+                                    const Bool* dataPtr);
+    virtual void putBlockuCharV    (rownr_t rownr, uInt nrmax,
+                                    const uChar* dataPtr);
+    virtual void putBlockShortV    (rownr_t rownr, uInt nrmax,
+                                    const Short* dataPtr);
+    virtual void putBlockuShortV   (rownr_t rownr, uInt nrmax,
+                                    const uShort* dataPtr);
+    virtual void putBlockIntV      (rownr_t rownr, uInt nrmax,
+                                    const Int* dataPtr);
+    virtual void putBlockuIntV     (rownr_t rownr, uInt nrmax,
+                                    const uInt* dataPtr);
+    virtual void putBlockInt64V    (rownr_t rownr, uInt nrmax,
+                                    const Int64* dataPtr);
+    virtual void putBlockfloatV    (rownr_t rownr, uInt nrmax,
+                                    const float* dataPtr);
+    virtual void putBlockdoubleV   (rownr_t rownr, uInt nrmax,
+                                    const double* dataPtr);
+    // </group>
+
+    // Add (newNrrow-oldNrrow) rows to the column.
+    // They get the value zero.
+    virtual void addRow (rownr_t newNrrow, rownr_t oldNrrow);
+
+    // Remove the given row.
+    void remove (rownr_t rownr);
+
+    // Create the number of rows in a new table.
+    void doCreate (rownr_t nrrow);
+
+    // Encode the decoded bucket if changed.
+    void flush();
+
+    // Write the encoded buckets.
+    void putFile (AipsIO& ios);
+
+    // Read the encoded buckets of the given number of rows.
+    void getFile (AipsIO& ios, rownr_t nrrow);
+
+    // Get the total size of the encoded buckets.
+    uInt64 encodedSize();
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    PSMColumn (const PSMColumn&);
+    PSMColumn& operator= (const PSMColumn&);
+    // </group>
+
+    // Get the number of rows in the given bucket.
+    uInt bucketNrow (rownr_t bucketNr) const;
+
+    // Make the given bucket the decoded one and set the column cache.
+    // It returns a pointer to the decoded values.
+    char* getBucket (rownr_t bucketNr);
+
+    // Get or put a block of values.
+    // <group>
+    uInt getBlock (rownr_t rownr, uInt nrmax, char* dataPtr);
+    void putBlock (rownr_t rownr, uInt nrmax, const char* dataPtr);
+    // </group>
+
+    //# Data members.
+    PackedStMan* itsStMan;
+    uInt         itsValueSize;
+    rownr_t      itsNrrow;
+    std::vector<std::vector<uChar> > itsBuckets;
+    //# The decoded bucket.
+    Block<char>  itsData;
+    Int64        itsBucketNr;
+    Bool         itsChanged;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,327 @@
+//# PackedStMan.cc: Storage manager encoding scalar values compactly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/DataMan/PackedStMan.h>
+#include <casacore/tables/DataMan/PSMColumn.h>
+#include <casacore/tables/DataMan/PSMCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/CanonicalIO.h>
+#include <casacore/casa/IO/LECanonicalIO.h>
+#include <casacore/casa/Utilities/Assert.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+PackedStMan::PackedStMan (const String& dataManagerName, uInt bucketRows)
+: DataManager (),
+  stmanName_p (dataManagerName),
+  nrrow_p     (0),
+  colSet_p    (0),
+  hasPut_p    (False),
+  file_p      (0)
+{
+  setBucketRows (bucketRows);
+}
+
+PackedStMan::PackedStMan (const String& dataManagerName, const Record& spec)
+: DataManager (),
+  stmanName_p (dataManagerName),
+  nrrow_p     (0),
+  colSet_p    (0),
+  hasPut_p    (False),
+  file_p      (0)
+{
+  uInt bucketRows = 0;
+  if (spec.isDefined ("BUCKETROWS")) {
+    bucketRows = spec.asInt ("BUCKETROWS");
+  }
+  setBucketRows (bucketRows);
+}
+
+PackedStMan::~PackedStMan()
+{
+  for (uInt i=0; i<ncolumn(); i++) {
+    delete colSet_p[i];
+  }
+  delete file_p;
+}
+
+void PackedStMan::setBucketRows (uInt bucketRows)
+{
+  bucketRows_p = (bucketRows == 0  ?  4096 : bucketRows);
+}
+
+DataManager* PackedStMan::clone() const
+{
+  return new PackedStMan (stmanName_p, bucketRows_p);
+}
+
+DataManager* PackedStMan::makeObject (const String& dataManagerName,
+                                      const Record& spec)
+{
+  return new PackedStMan (dataManagerName, spec);
+}
+
+String PackedStMan::dataManagerType() const
+  { return "PackedStMan"; }
+
+String PackedStMan::dataManagerName() const
+  { return stmanName_p; }
+
+Record PackedStMan::dataManagerSpec() const
+{
+  Record rec;
+  rec.define ("BUCKETROWS", Int(bucketRows_p));
+  return rec;
+}
+
+Bool PackedStMan::canAddRow() const
+  { return True; }
+Bool PackedStMan::canRemoveRow() const
+  { return True; }
+Bool PackedStMan::canAddColumn() const
+  { return True; }
+Bool PackedStMan::canRemoveColumn() const
+  { return True; }
+Bool PackedStMan::hasMultiFileSupport() const
+  { return True; }
+
+
+DataManagerColumn* PackedStMan::makeScalarColumn (const String& columnName,
+                                                  int dataType,
+                                                  const String&)
+{
+  if (! PSMCodec::isSupported (dataType)) {
+    throw DataManInvDT ("PackedStMan cannot store column " + columnName +
+                        " (only integer, real and Bool scalars)");
+  }
+  //# Extend colSet_p block if needed.
+  if (ncolumn() >= colSet_p.nelements()) {
+    colSet_p.resize (colSet_p.nelements() + 32);
+  }
+  PSMColumn* colp = new PSMColumn (this, dataType);
+  colSet_p[ncolumn()] = colp;
+  return colp;
+}
+
+DataManagerColumn* PackedStMan::makeDirArrColumn (const String& columnName,
+                                                  int, const String&)
+{
+  throw DataManInvOper ("PackedStMan cannot store array column " +
+                        columnName);
+}
+
+DataManagerColumn* PackedStMan::makeIndArrColumn (const String& columnName,
+                                                  int, const String&)
+{
+  throw DataManInvOper ("PackedStMan cannot store array column " +
+                        columnName);
+}
+
+// Note that the column has already been added by makeXXColumn.
+// This function is merely for initializing the added column.
+void PackedStMan::addColumn (DataManagerColumn* colp)
+{
+  for (uInt i=0; i<ncolumn(); i++) {
+    if (colp == colSet_p[i]) {
+      colSet_p[i]->doCreate (nrrow_p);
+      setHasPut();
+      return;
+    }
+  }
+  throw DataManInternalError ("PackedStMan::addColumn");
+}
+
+void PackedStMan::removeColumn (DataManagerColumn* colp)
+{
+  for (uInt i=0; i<ncolumn(); i++) {
+    if (colSet_p[i] == colp) {
+      delete colSet_p[i];
+      decrementNcolumn();
+      for (uInt j=i; j<ncolumn(); j++) {
+        colSet_p[j] = colSet_p[j+1];
+      }
+      setHasPut();
+      return;
+    }
+  }
+  throw DataManInternalError ("PackedStMan::removeColumn: "
+                              " column " + colp->columnName() +
+                              " does not exist");
+}
+
+void PackedStMan::addRow (rownr_t nr)
+{
+  for (uInt i=0; i<ncolumn(); i++) {
+    colSet_p[i]->addRow (nrrow_p+nr, nrrow_p);
+  }
+  nrrow_p += nr;
+  setHasPut();
+}
+
+void PackedStMan::removeRow (rownr_t rownr)
+{
+  for (uInt i=0; i<ncolumn(); i++) {
+    colSet_p[i]->remove (rownr);
+  }
+  nrrow_p--;
+  setHasPut();
+}
+
+
+Bool PackedStMan::flush (AipsIO& ios, Bool fsync)
+{
+  ios.putstart ("PackedStMan", 1);
+  ios << stmanName_p;
+  ios.putend();
+  //# Do not write if nothing has been put.
+  if (! hasPut_p) {
+    return False;
+  }
+  writeFile (fsync);
+  hasPut_p = False;
+  return True;
+}
+
+void PackedStMan::create (rownr_t nrrow)
+{
+  file_p = new BucketFile (fileName(), 0, False, multiFile());
+  nrrow_p = nrrow;
+  for (uInt i=0; i<ncolumn(); i++) {
+    colSet_p[i]->doCreate (nrrow);
+  }
+  setHasPut();
+}
+
+void PackedStMan::open (rownr_t nrrow, AipsIO& ios)
+{
+  ios.getstart ("PackedStMan");
+  ios >> stmanName_p;
+  ios.getend();
+  file_p = new BucketFile (fileName(), table().isWritable(),
+                           0, False, multiFile());
+  file_p->open();
+  nrrow_p = nrrow;
+  readFile();
+}
+
+void PackedStMan::resync (rownr_t nrrow)
+{
+  nrrow_p = nrrow;
+  readFile();
+}
+
+void PackedStMan::reopenRW()
+{
+  file_p->setRW();
+}
+
+void PackedStMan::deleteManager()
+{
+  if (file_p != 0) {
+    file_p->remove();
+    delete file_p;
+    file_p = 0;
+  }
+}
+
+void PackedStMan::writeFile (Bool fsync)
+{
+  file_p->seek (0);
+  // Use the file given by the BucketFile object.
+  CountedPtr<ByteIO> fio = file_p->makeFilebufIO (65536);
+  CountedPtr<TypeIO> tio;
+  // Store it in canonical or local format.
+  if (asBigEndian()) {
+    tio = new CanonicalIO (fio.get());
+  } else {
+    tio = new LECanonicalIO (fio.get());
+  }
+  AipsIO os (tio.get());
+  os.putstart ("PackedStMan", 1);
+  os << bucketRows_p;
+  os << uInt64(nrrow_p);
+  os << ncolumn();
+  for (uInt i=0; i<ncolumn(); i++) {
+    os << colSet_p[i]->dataType();
+  }
+  for (uInt i=0; i<ncolumn(); i++) {
+    colSet_p[i]->putFile (os);
+  }
+  os.putend();
+  os.close();
+  if (fsync) {
+    file_p->fsync();
+  }
+}
+
+void PackedStMan::readFile()
+{
+  file_p->seek (0);
+  CountedPtr<ByteIO> fio = file_p->makeFilebufIO (65536);
+  CountedPtr<TypeIO> tio;
+  if (asBigEndian()) {
+    tio = new CanonicalIO (fio.get());
+  } else {
+    tio = new LECanonicalIO (fio.get());
+  }
+  AipsIO os (tio.get());
+  os.getstart ("PackedStMan");
+  uInt64 nrrow;
+  uInt nrcol;
+  os >> bucketRows_p;
+  os >> nrrow;
+  os >> nrcol;
+  if (nrcol != ncolumn()) {
+    throw DataManInternalError ("PackedStMan::open: mismatch in #col");
+  }
+  if (nrrow != nrrow_p) {
+    throw DataManInternalError
+      ("PackedStMan::open: mismatch in #row; expected " +
+       String::toString(nrrow_p) + ", found " + String::toString(nrrow));
+  }
+  for (uInt i=0; i<ncolumn(); i++) {
+    int dt;
+    os >> dt;
+    if (dt != colSet_p[i]->dataType()) {
+        throw DataManInternalError
+        ("PackedStMan::open: mismatch in data type");
+    }
+  }
+  for (uInt i=0; i<ncolumn(); i++) {
+    colSet_p[i]->getFile (os, nrrow_p);
+  }
+  os.getend();
+  os.close();
+}
+
+} //# NAMESPACE CASACORE - END
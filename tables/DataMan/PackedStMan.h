@@ -0,0 +1,250 @@
+//# PackedStMan.h: Storage manager encoding scalar values compactly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_PACKEDSTMAN_H
+#define TABLES_PACKEDSTMAN_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/BasicSL/String.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward declarations
+class PSMColumn;
+class BucketFile;
+
+
+// <summary>
+// Storage manager encoding scalar values compactly
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tPackedStMan.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=DataManager>DataManager</linkto>
+//   <li> <linkto class=PSMCodec>PSMCodec</linkto>
+// </prerequisite>
+
+// <etymology>
+// PackedStMan is the storage manager packing the values of a column.
+// </etymology>
+
+// <synopsis>
+// PackedStMan stores scalar columns of integer, real or Bool values.
+// A column is divided in buckets of a fixed number of rows (default 4096).
+// Each bucket is encoded using frame-of-reference, delta or dictionary
+// encoding with bit-packing (see <linkto class=PSMCodec>PSMCodec</linkto>).
+// The encoding resulting in the smallest size is chosen per bucket.
+// Columns with few distinct values (like ANTENNA1 or DATA_DESC_ID in
+// a MeasurementSet) or with regularly changing values (like TIME)
+// take much less space than in the StandardStMan.
+// <br>Unlike the IncrementalStMan, the values do not need to be constant
+// over long row ranges to be stored efficiently.
+// <p>
+// Like StManAipsIO, the storage manager holds the data in memory.
+// However, it keeps the encoded buckets, thus needs little memory.
+// The data are written to the file when the table is flushed and
+// read back when the table is opened. The file is always written
+// entirely, so this storage manager is meant for columns that are
+// written once or only occasionally.
+// <br>Getting an entire column (or a block of rows) decodes the buckets
+// directly into the result, so scanning a column is fast.
+// <p>
+// The number of rows per bucket can be given in the constructor or in
+// field BUCKETROWS of the specification record.
+// Rows and columns can be added and removed, but removing a row is slow.
+// Arrays, complex values and strings cannot be stored.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// // Store the ID columns of a table in the PackedStMan.
+// PackedStMan stman("PackedData");
+// SetupNewTable newtab("name.data", tableDesc, Table::New);
+// newtab.bindColumn ("ANTENNA1", stman);
+// newtab.bindColumn ("ANTENNA2", stman);
+// Table tab(newtab, nrrow);
+// </srcblock>
+// </example>
+
+// <motivation>
+// Metadata columns of a MeasurementSet take a lot of space (thus IO)
+// while they hold little information.
+// </motivation>
+
+class PackedStMan : public DataManager
+{
+public:
+    // Create a Packed storage manager with the given name.
+    // If no name is used, it is set to "PackedStMan".
+    // The number of rows per bucket defaults to 4096.
+    explicit PackedStMan (const String& dataManagerName = "PackedStMan",
+                          uInt bucketRows = 0);
+
+    // Create a Packed storage manager with the given name.
+    // The specifications are in the record (as created by dataManagerSpec).
+    PackedStMan (const String& dataManagerName, const Record& spec);
+
+    ~PackedStMan();
+
+    // Clone this object.
+    // It does not clone PSMColumn objects possibly used.
+    virtual DataManager* clone() const;
+
+    // Get the type name of the data manager (i.e. PackedStMan).
+    virtual String dataManagerType() const;
+
+    // Get the name given to this storage manager.
+    virtual String dataManagerName() const;
+
+    // Return a record containing data manager specifications.
+    virtual Record dataManagerSpec() const;
+
+    // Get the number of rows per bucket.
+    uInt bucketRows() const
+      { return bucketRows_p; }
+
+    // Get the nr of rows in this storage manager.
+    rownr_t nrow() const
+      { return nrrow_p; }
+
+    // Tell that data have been put.
+    void setHasPut()
+      { hasPut_p = True; }
+
+    // Does the storage manager allow to add rows? (yes)
+    virtual Bool canAddRow() const;
+
+    // Does the storage manager allow to delete rows? (yes)
+    virtual Bool canRemoveRow() const;
+
+    // Does the storage manager allow to add columns? (yes)
+    virtual Bool canAddColumn() const;
+
+    // Does the storage manager allow to delete columns? (yes)
+    virtual Bool canRemoveColumn() const;
+
+    // Make the object from the type name string.
+    // This function gets registered in the DataManager "constructor" map.
+    static DataManager* makeObject (const String& dataManagerType,
+                                    const Record& spec);
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    PackedStMan (const PackedStMan&);
+    PackedStMan& operator= (const PackedStMan&);
+    // </group>
+
+    // Set the number of rows per bucket (0 means default).
+    void setBucketRows (uInt bucketRows);
+
+    // The storage manager can use a MultiFile.
+    virtual Bool hasMultiFileSupport() const;
+
+    // Flush and optionally fsync the data.
+    // It returns a True status if it had to flush (i.e. if data have changed).
+    virtual Bool flush (AipsIO&, Bool fsync);
+
+    // Let the storage manager create the file for a new table.
+    virtual void create (rownr_t nrrow);
+
+    // Open the storage manager file for an existing table and let the
+    // PSMColumn objects read their data.
+    virtual void open (rownr_t nrrow, AipsIO&);
+
+    // Resync the storage manager with the new file contents.
+    // This is done by reading the file again.
+    virtual void resync (rownr_t nrrow);
+
+    // Reopen the storage manager file for read/write.
+    virtual void reopenRW();
+
+    // The data manager will be deleted (because all its columns are
+    // requested to be deleted).
+    // So clean up the things needed (e.g. delete files).
+    virtual void deleteManager();
+
+    // Add rows to all columns.
+    virtual void addRow (rownr_t nrrow);
+
+    // Delete a row from all columns.
+    virtual void removeRow (rownr_t rownr);
+
+    // Create a column in the storage manager on behalf of a table column.
+    // Only scalar columns with a supported data type can be created.
+    // <group>
+    virtual DataManagerColumn* makeScalarColumn (const String& name,
+                                                 int dataType,
+                                                 const String& dataTypeID);
+    virtual DataManagerColumn* makeDirArrColumn (const String& name,
+                                                 int dataType,
+                                                 const String& dataTypeID);
+    virtual DataManagerColumn* makeIndArrColumn (const String& name,
+                                                 int dataType,
+                                                 const String& dataTypeID);
+    // </group>
+
+    // Add a column.
+    virtual void addColumn (DataManagerColumn*);
+
+    // Delete a column.
+    virtual void removeColumn (DataManagerColumn*);
+
+    // Write or read the file.
+    // <group>
+    void writeFile (Bool fsync);
+    void readFile();
+    // </group>
+
+
+    // Name given by user to this storage manager.
+    String stmanName_p;
+    // The number of rows per bucket.
+    uInt   bucketRows_p;
+    // The number of rows in the columns.
+    rownr_t nrrow_p;
+    // The assembly of all columns.
+    PtrBlock<PSMColumn*> colSet_p;
+    // Has anything been put since the last flush?
+    Bool   hasPut_p;
+    // The file containing the data.
+    BucketFile* file_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
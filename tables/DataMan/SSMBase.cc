@@ -36,6 +36,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/casa/Containers/BlockIO.h>
 #include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/IO/BucketCache.h>
@@ -157,6 +158,16 @@ SSMBase::SSMBase (const String& aDataManName,
   if (spec.isDefined ("PERSCACHESIZE")) {
     itsPersCacheSize = max(2, spec.asInt ("PERSCACHESIZE"));
   }
+  // Get the names of the string columns to be dictionary encoded.
+  if (spec.isDefined ("DICTIONARYCOLUMNS")) {
+    Array<String> aNames = spec.asArrayString ("DICTIONARYCOLUMNS");
+    itsDictColumns.insert (aNames.begin(), aNames.end());
+  }
+  // Get the names of the columns to keep a zone map for.
+  if (spec.isDefined ("ZONEMAPCOLUMNS")) {
+    Array<String> aNames = spec.asArrayString ("ZONEMAPCOLUMNS");
+    itsZoneMapColumns.insert (aNames.begin(), aNames.end());
+  }
 }
 
 SSMBase::SSMBase (const SSMBase& that)
@@ -179,7 +190,9 @@ SSMBase::SSMBase (const SSMBase& that)
   itsFirstFreeBucket   (-1),
   itsBucketSize        (that.itsBucketSize),
   itsBucketRows        (that.itsBucketRows),
-  isDataChanged        (False)
+  isDataChanged        (False),
+  itsDictColumns       (that.itsDictColumns),
+  itsZoneMapColumns    (that.itsZoneMapColumns)
 {}
 
 SSMBase::~SSMBase()
@@ -217,6 +230,30 @@ Record SSMBase::dataManagerSpec() const
   rec.define ("BUCKETSIZE", Int(itsBucketSize));
   rec.define ("PERSCACHESIZE", Int(itsPersCacheSize));
   rec.define ("IndexLength", Int(itsIndexLength));
+  // Only define the dictionary columns if used.
+  std::set<String> aNames(itsDictColumns);
+  for (uInt i=0; i<ncolumn(); i++) {
+    if (itsPtrColumn[i]->hasDictionary()) {
+      aNames.insert (itsPtrColumn[i]->columnName());
+    }
+  }
+  if (! aNames.empty()) {
+    rec.define ("DICTIONARYCOLUMNS",
+                Vector<String>(std::vector<String>(aNames.begin(),
+                                                   aNames.end())));
+  }
+  // Idem for the zone map columns.
+  std::set<String> aZoneNames(itsZoneMapColumns);
+  for (uInt i=0; i<ncolumn(); i++) {
+    if (itsPtrColumn[i]->hasZoneMap()) {
+      aZoneNames.insert (itsPtrColumn[i]->columnName());
+    }
+  }
+  if (! aZoneNames.empty()) {
+    rec.define ("ZONEMAPCOLUMNS",
+                Vector<String>(std::vector<String>(aZoneNames.begin(),
+                                                   aZoneNames.end())));
+  }
   return rec;
 }
 
@@ -285,7 +322,7 @@ void SSMBase::showIndexStatistics (ostream & anOs) const
   }
 }
 
-DataManagerColumn* SSMBase::makeScalarColumn (const String&,
+DataManagerColumn* SSMBase::makeScalarColumn (const String& aName,
 					      int aDataType,
 					      const String&)
 {
@@ -295,6 +332,12 @@ DataManagerColumn* SSMBase::makeScalarColumn (const String&,
     itsPtrColumn.resize (itsPtrColumn.nelements() + 32);
   }
   SSMColumn* aColumn = new SSMColumn (this, aDataType, ncolumn());
+  if (itsZoneMapColumns.find(aName) != itsZoneMapColumns.end()) {
+    aColumn->enableZoneMap();
+  }
+  if (itsDictColumns.find(aName) != itsDictColumns.end()) {
+    aColumn->setDictionary();
+  }
   itsPtrColumn[ncolumn()] = aColumn;
   return aColumn;
 }
@@ -504,11 +547,53 @@ void SSMBase::readIndexBuckets()
     itsPtrIndex[i] = new SSMIndex(this);
     itsPtrIndex[i]->get(anMOs);
   }
+  // The columns having a zone map in their index keep it up to date.
+  // Note that a column being added is not part of the index yet.
+  uInt aNrCol = std::min (ncolumn(), uInt(itsColIndexMap.nelements()));
+  for (uInt i=0; i<aNrCol; i++) {
+    if (itsPtrIndex[itsColIndexMap[i]]->hasZoneMap (itsColumnOffset[i])) {
+      itsPtrColumn[i]->enableZoneMap();
+    }
+  }
+  // The dictionaries of the dictionary encoded columns follow the indices.
+  Block<uInt> aDictCols = dictColumns();
+  if (aDictCols.nelements() > 0) {
+    anMOs.getstart ("SSMDictionaries");
+    uInt aNrDict;
+    anMOs >> aNrDict;
+    if (aNrDict != aDictCols.nelements()) {
+      throw DataManInternalError ("SSMBase::readIndexBuckets: "
+                                  "mismatch in #dictionaries");
+    }
+    for (uInt i=0; i<aNrDict; i++) {
+      uInt aColNr;
+      anMOs >> aColNr;
+      if (aColNr >= ncolumn()  ||  !itsPtrColumn[aColNr]->hasDictionary()) {
+        throw DataManInternalError ("SSMBase::readIndexBuckets: "
+                                    "column has no dictionary");
+      }
+      itsPtrColumn[aColNr]->readDictionary (anMOs);
+    }
+    anMOs.getend();
+  }
   
   anMOs.close();
   delete aMio;
 }
 
+Block<uInt> SSMBase::dictColumns() const
+{
+  Block<uInt> aCols(ncolumn());
+  uInt aNr = 0;
+  for (uInt i=0; i<ncolumn(); i++) {
+    if (itsPtrColumn[i]->hasDictionary()) {
+      aCols[aNr++] = i;
+    }
+  }
+  aCols.resize (aNr, True);
+  return aCols;
+}
+
 void SSMBase::writeIndex()
 {
   TypeIO*   aTio;
@@ -533,8 +618,20 @@ void SSMBase::writeIndex()
 
   uInt aNrIdx = itsPtrIndex.nelements();
   for (uInt i=0;i<aNrIdx; i++ ){
+    itsPtrIndex[i]->resolveZones();
     itsPtrIndex[i]->put(anMOs);
   }
+  // The dictionaries of the dictionary encoded columns follow the indices.
+  Block<uInt> aDictCols = dictColumns();
+  if (aDictCols.nelements() > 0) {
+    anMOs.putstart ("SSMDictionaries", 1);
+    anMOs << uInt(aDictCols.nelements());
+    for (uInt i=0; i<aDictCols.nelements(); i++) {
+      anMOs << aDictCols[i];
+      itsPtrColumn[aDictCols[i]]->writeDictionary (anMOs);
+    }
+    anMOs.putend();
+  }
   anMOs.close();
 
   // Write total Mio in buckets.
@@ -673,7 +770,7 @@ Bool SSMBase::canRemoveColumn() const
 }
 
 
-void SSMBase::addRow (uInt aNrRows)
+void SSMBase::addRow (rownr_t aNrRows)
 {
   //make sure cache is available and filled (I need itsPtrIndex)
   getCache();
@@ -693,7 +790,7 @@ void SSMBase::addRow (uInt aNrRows)
   isDataChanged = True;
 }
 
-void SSMBase::removeRow (uInt aRowNr)
+void SSMBase::removeRow (rownr_t aRowNr)
 {
   uInt aNrCol = ncolumn();
   for (uInt j=0; j< aNrCol; j++) {
@@ -796,6 +893,10 @@ void SSMBase::addColumn (DataManagerColumn* aColumn)
     itsPtrIndex[nrIdx] = new SSMIndex(this,rowsPerBucket);
     uInt aSize =(rowsPerBucket*aSSMC->getExternalSizeBits() + 7) / 8;
     itsPtrIndex[nrIdx]->setNrColumns(1,aSize);
+    // The new buckets are zeroed, so the column values are known.
+    if (aSSMC->hasZoneMap()) {
+      itsPtrIndex[nrIdx]->addZoneMap(0);
+    }
     itsPtrIndex[nrIdx]->addRow(itsNrRows);
 
     itsColIndexMap[nCol]=nrIdx;
@@ -903,8 +1004,8 @@ char* SSMBase::initCallBack (void* anOwner)
   return aBucket;
 }
 
-char* SSMBase::find(uInt aRowNr,     uInt aColNr, 
-		    uInt& aStartRow, uInt& anEndRow,
+char* SSMBase::find(rownr_t aRowNr,     uInt aColNr, 
+		    rownr_t& aStartRow, rownr_t& anEndRow,
                     const String& colName)
 {
  
@@ -917,6 +1018,24 @@ char* SSMBase::find(uInt aRowNr,     uInt aColNr,
   return aPtr + itsColumnOffset[aColNr];
 }
 
+void SSMBase::updateZone (uInt aColNr, rownr_t aStartRow, rownr_t anEndRow,
+                          Double aMin, Double aMax)
+{
+  itsPtrIndex[itsColIndexMap[aColNr]]->updateZone (itsColumnOffset[aColNr],
+                                                   aStartRow, anEndRow,
+                                                   aMin, aMax);
+}
+
+Bool SSMBase::getZone (uInt aColNr, rownr_t aRowNr, rownr_t& anEndRow,
+                       Double& aMin, Double& aMax)
+{
+  // Make sure that cache is available and filled.
+  getCache();
+  return itsPtrIndex[itsColIndexMap[aColNr]]->getZone (itsColumnOffset[aColNr],
+                                                       aRowNr, anEndRow,
+                                                       aMin, aMax);
+}
+
 
 
 void SSMBase::recreate()
@@ -981,15 +1100,21 @@ Bool SSMBase::flush (AipsIO& ios, Bool doFsync)
     itsIosFile->flush(doFsync);
   }
   
-  ios.putstart ("SSM", 2);
+  // Only use version 3 if there are dictionary encoded columns,
+  // so older software can still read tables without them.
+  Block<uInt> aDictCols = dictColumns();
+  ios.putstart ("SSM", aDictCols.nelements() > 0  ?  3 : 2);
   ios << itsDataManName;
   putBlock (ios, itsColumnOffset, itsColumnOffset.nelements());
   putBlock (ios, itsColIndexMap,  itsColIndexMap.nelements());
+  if (aDictCols.nelements() > 0) {
+    putBlock (ios, aDictCols, aDictCols.nelements());
+  }
   ios.putend();
   return changed;
 }
 
-void SSMBase::resync (uInt aNrRows)
+void SSMBase::resync (rownr_t aNrRows)
 {
   itsNrRows = aNrRows;
   if (itsPtrIndex.nelements() != 0) {
@@ -1015,7 +1140,7 @@ void SSMBase::resync (uInt aNrRows)
   }
 }
 
-void SSMBase::create (uInt aNrRows)
+void SSMBase::create (rownr_t aNrRows)
 {
   init();
   recreate();
@@ -1023,13 +1148,21 @@ void SSMBase::create (uInt aNrRows)
   addRow (aNrRows);
 }
 
-void SSMBase::open (uInt aRowNr, AipsIO& ios)
+void SSMBase::open (rownr_t aRowNr, AipsIO& ios)
 {
   itsNrRows = aRowNr;
-  ios.getstart ("SSM");
+  uInt aVersion = ios.getstart ("SSM");
   ios >> itsDataManName;
   getBlock (ios,itsColumnOffset);
   getBlock (ios,itsColIndexMap);
+  // Mark the dictionary encoded columns before they are used.
+  if (aVersion >= 3) {
+    Block<uInt> aDictCols;
+    getBlock (ios, aDictCols);
+    for (uInt i=0; i<aDictCols.nelements(); i++) {
+      itsPtrColumn[aDictCols[i]]->setDictionary();
+    }
+  }
   ios.getend();
   
   itsFile = new BucketFile (fileName(), table().isWritable(),
@@ -1107,6 +1240,11 @@ void SSMBase::init()
   itsPtrIndex.resize (1, True);
   itsPtrIndex[0] = new SSMIndex(this, rowsPerBucket);
   itsPtrIndex[0]->setNrColumns (nrCol, aTotalSize);
+  for (uInt i=0; i<nrCol; i++) {
+    if (itsPtrColumn[i]->hasZoneMap()) {
+      itsPtrIndex[0]->addZoneMap (itsColumnOffset[i]);
+    }
+  }
 }
 
 
@@ -33,6 +33,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Containers/Block.h>
+#include <set>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -130,6 +131,8 @@ class SSMStringHandler;
 // which uses an extra file to store the arrays.
 // <p>
 // Index buckets are used by SSMBase to make the SSMIndex data persistent.
+// The dictionaries of dictionary encoded string columns are stored
+// after the SSMIndex data.
 // It uses alternately 2 sets of index buckets. In that way there is
 // always an index availanle in case the system crashes.
 // If possible 2 halfs of a single bucket are used alternately, otherwise 
@@ -229,7 +232,7 @@ public:
   uInt getBucketSize() const;
   
   // Get the number of rows in this storage manager.
-  uInt getNRow() const;
+  rownr_t getNRow() const;
   
   // The storage manager can add rows.
   virtual Bool canAddRow() const;
@@ -251,6 +254,10 @@ public:
   
   // Get access to the given column.
   SSMColumn& getColumn (uInt aColNr);
+
+  // Make sure the header and index (including the dictionaries of
+  // dictionary encoded columns) have been read.
+  void readIndex();
   
   // Get access to the given Index.
   SSMIndex& getIndex (uInt anIdxNr);
@@ -267,10 +274,20 @@ public:
   // Find the bucket containing the column and row and return the pointer
   // to the beginning of the column data in that bucket.
   // It also fills in the start and end row for the column data.
-  char* find (uInt aRowNr,     uInt aColNr, 
-	      uInt& aStartRow, uInt& anEndRow,
+  char* find (rownr_t aRowNr,     uInt aColNr, 
+	      rownr_t& aStartRow, rownr_t& anEndRow,
               const String& colName);
 
+  // Extend the value range in the zone map of the given column for the
+  // given rows, which must be in a single bucket (as returned by find).
+  void updateZone (uInt aColNr, rownr_t aStartRow, rownr_t anEndRow,
+                   Double aMin, Double aMax);
+
+  // Get the value range of the given column in the bucket containing
+  // the given row (see <linkto class=SSMIndex>SSMIndex</linkto>).
+  Bool getZone (uInt aColNr, rownr_t aRowNr, rownr_t& anEndRow,
+                Double& aMin, Double& aMax);
+
   // Add a new bucket and get its bucket number.
   uInt getNewBucket();
 
@@ -315,15 +332,15 @@ private:
   
   // Let the storage manager create files as needed for a new table.
   // This allows a column with an indirect array to create its file.
-  virtual void create (uInt aNrRows);
+  virtual void create (rownr_t aNrRows);
   
   // Open the storage manager file for an existing table, read in
   // the data, and let the SSMColumn objects read their data.
-  virtual void open (uInt aRowNr, AipsIO&);
+  virtual void open (rownr_t aRowNr, AipsIO&);
   
   // Resync the storage manager with the new file contents.
   // This is done by clearing the cache.
-  virtual void resync (uInt aRowNr);
+  virtual void resync (rownr_t aRowNr);
   
   // Reopen the storage manager files for read/write.
   virtual void reopenRW();
@@ -346,10 +363,10 @@ private:
   
   // Add rows to the storage manager.
   // Per column it extends number of rows.
-  virtual void addRow (uInt aNrRows);
+  virtual void addRow (rownr_t aNrRows);
   
   // Delete a row from all columns.
-  virtual void removeRow (uInt aRowNr);
+  virtual void removeRow (rownr_t aRowNr);
   
   // Do the final addition of a column.
   virtual void addColumn (DataManagerColumn*);
@@ -391,6 +408,9 @@ private:
   // Write the header and the indices.
   void writeIndex();
 
+  // Get the numbers of the dictionary encoded columns.
+  Block<uInt> dictColumns() const;
+
 
   //# Declare member variables.
   // Name of data manager.
@@ -400,7 +420,7 @@ private:
   StManArrayFile* itsIosFile;
   
   // The number of rows in the columns.
-  uInt         itsNrRows;
+  rownr_t      itsNrRows;
   
   // Column offset
   Block<uInt> itsColumnOffset;
@@ -460,6 +480,14 @@ private:
   
   // Has the data changed since the last flush?
   Bool isDataChanged;
+
+  // The names of the string columns to be dictionary encoded
+  // (as given in the specification record).
+  std::set<String> itsDictColumns;
+
+  // The names of the numeric scalar columns to keep a zone map for
+  // (as given in the specification record).
+  std::set<String> itsZoneMapColumns;
 };
 
 
@@ -473,7 +501,7 @@ inline uInt SSMBase::getCacheSize() const
   return itsCacheSize;
 }
 
-inline uInt SSMBase::getNRow() const
+inline rownr_t SSMBase::getNRow() const
 {
   return itsNrRows;
 }
@@ -483,6 +511,11 @@ inline uInt SSMBase::getBucketSize() const
   return itsBucketSize;
 }
 
+inline void SSMBase::readIndex()
+{
+  getCache();
+}
+
 inline BucketCache& SSMBase::getCache()
 {
   if (itsCache == 0) {
@@ -28,15 +28,20 @@
 #include <casacore/tables/DataMan/SSMColumn.h>
 #include <casacore/tables/DataMan/SSMBase.h>
 #include <casacore/tables/DataMan/SSMStringHandler.h>
+#include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Utilities/ValType.h>
+#include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <limits>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -50,7 +55,9 @@ SSMColumn::SSMColumn (SSMBase* aParent, int aDataType, uInt aColNr)
   itsMaxLen      (0),
   itsNrElem      (1),
   itsNrCopy      (0),
-  itsData        (0)
+  itsData        (0),
+  itsUseZoneMap  (False),
+  itsUseDict     (False)
 {
   init();
 }
@@ -73,33 +80,33 @@ void SSMColumn::setMaxLength (uInt maxLength)
     init();
 }
 
-uInt SSMColumn::ndim (uInt)
+uInt SSMColumn::ndim (rownr_t)
 {
     return itsShape.nelements();
 }
 
-IPosition SSMColumn::shape (uInt)
+IPosition SSMColumn::shape (rownr_t)
 {
     return itsShape;
 }
 
-void SSMColumn::doCreate(uInt)
+void SSMColumn::doCreate(rownr_t)
 {
 }
 
-void SSMColumn::getFile(uInt)
+void SSMColumn::getFile(rownr_t)
 {
 }
 
-void SSMColumn::addRow (uInt aNewNrRows, uInt, Bool doInit)
+void SSMColumn::addRow (rownr_t aNewNrRows, rownr_t, Bool doInit)
 {
   if (doInit  &&  dataType() == TpString) {
-    uInt aRowNr=0;
-    uInt aNrRows=aNewNrRows;
+    rownr_t aRowNr=0;
+    rownr_t aNrRows=aNewNrRows;
     
     while (aNrRows > 0) {
-      uInt  aStartRow;
-      uInt  anEndRow;
+      rownr_t  aStartRow;
+      rownr_t  anEndRow;
       char* aValPtr;
       aValPtr = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                                  columnName());
@@ -112,14 +119,14 @@ void SSMColumn::addRow (uInt aNewNrRows, uInt, Bool doInit)
   }
 }
 
-void SSMColumn::deleteRow(uInt aRowNr)
+void SSMColumn::deleteRow(rownr_t aRowNr)
 {
   char* aValue;
-  uInt  aSRow;
-  uInt  anERow;
+  rownr_t  aSRow;
+  rownr_t  anERow;
   int aDT = dataType();
 
-  if (aDT == TpString  &&  itsMaxLen == 0) {
+  if (aDT == TpString  &&  itsMaxLen == 0  &&  !itsUseDict) {
     Int buf[3];
     getRowValue(buf, aRowNr);
     if (buf[2] > 8 ) {
@@ -144,8 +151,8 @@ void SSMColumn::deleteRow(uInt aRowNr)
 
   // first check if aRowNr is in cache, if not, fill cache
   // In both cases remove row from cache
-  uInt  aStartRow = columnCache().start();
-  uInt  anEndRow  = columnCache().end();
+  rownr_t  aStartRow = columnCache().start();
+  rownr_t  anEndRow  = columnCache().end();
 
   // Remove from cache if needed
   if (aRowNr >= aStartRow  &&  aRowNr <= anEndRow) {
@@ -181,7 +188,7 @@ void SSMColumn::deleteRow(uInt aRowNr)
   }
 }
 
-void SSMColumn::shiftRows(char* aValue, uInt aRowNr, uInt aSRow, uInt anERow)
+void SSMColumn::shiftRows(char* aValue, rownr_t aRowNr, rownr_t aSRow, rownr_t anERow)
 {
   // Shift from aRrowNr on 1 to the left.
   char* aToPtr = aValue + (aRowNr-aSRow) * itsExternalSizeBytes;
@@ -193,73 +200,77 @@ void SSMColumn::shiftRows(char* aValue, uInt aRowNr, uInt aSRow, uInt anERow)
 }
 
 
-void SSMColumn::getBoolV (uInt aRowNr, Bool* aValue)
+void SSMColumn::getBoolV (rownr_t aRowNr, Bool* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<Bool*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getuCharV (uInt aRowNr, uChar* aValue)
+void SSMColumn::getuCharV (rownr_t aRowNr, uChar* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<uChar*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getShortV (uInt aRowNr, Short* aValue)
+void SSMColumn::getShortV (rownr_t aRowNr, Short* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<Short*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getuShortV (uInt aRowNr, uShort* aValue)
+void SSMColumn::getuShortV (rownr_t aRowNr, uShort* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<uShort*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getIntV (uInt aRowNr, Int* aValue)
+void SSMColumn::getIntV (rownr_t aRowNr, Int* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<Int*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getuIntV (uInt aRowNr, uInt* aValue)
+void SSMColumn::getuIntV (rownr_t aRowNr, uInt* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<uInt*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getInt64V (uInt aRowNr, Int64* aValue)
+void SSMColumn::getInt64V (rownr_t aRowNr, Int64* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<Int64*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getfloatV (uInt aRowNr, float* aValue)
+void SSMColumn::getfloatV (rownr_t aRowNr, float* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<float*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getdoubleV (uInt aRowNr, double* aValue)
+void SSMColumn::getdoubleV (rownr_t aRowNr, double* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<double*>(itsData)[aRowNr-columnCache().start()];
 }
-void SSMColumn::getComplexV (uInt aRowNr, Complex* aValue)
+void SSMColumn::getComplexV (rownr_t aRowNr, Complex* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<Complex*>(itsData)[aRowNr-columnCache().start()];
 }
 
-void SSMColumn::getDComplexV (uInt aRowNr,DComplex* aValue)
+void SSMColumn::getDComplexV (rownr_t aRowNr,DComplex* aValue)
 {
   getValue(aRowNr);
   *aValue = static_cast<DComplex*>(itsData)[aRowNr-columnCache().start()];
 }
 
-void SSMColumn::getStringV (uInt aRowNr, String* aValue)
+void SSMColumn::getStringV (rownr_t aRowNr, String* aValue)
 {
-  if (itsMaxLen > 0) {
+  if (itsUseDict) {
+    uInt aCode;
+    getDictCodes (aRowNr, 1, &aCode);
+    *aValue = getDictValue (aCode);
+  } else if (itsMaxLen > 0) {
     // Allocate the maximum number of characters needed
     // The +1 is to correct for the incorrect use of the chars() function
     // Should be changed to use real Char*
     aValue->alloc(itsMaxLen+1);
     char* sp = const_cast<char*>(aValue->chars());
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* buf = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                                  columnName());
     itsReadFunc (sp, buf+(aRowNr-aStartRow)*itsExternalSizeBytes,
@@ -296,10 +307,10 @@ void SSMColumn::getStringV (uInt aRowNr, String* aValue)
   }
 }
 
-Char* SSMColumn::getRowValue(Int* data, uInt aRowNr)
+Char* SSMColumn::getRowValue(Int* data, rownr_t aRowNr)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aValue;
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                             columnName());
@@ -308,11 +319,11 @@ Char* SSMColumn::getRowValue(Int* data, uInt aRowNr)
   return aValue+(aRowNr-aStartRow)*itsExternalSizeBytes;
 }
 
-void SSMColumn::getValue(uInt aRowNr)
+void SSMColumn::getValue(rownr_t aRowNr)
 {
   if (aRowNr < columnCache().start()  ||  aRowNr > columnCache().end()) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aValue;
     aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                               columnName());
@@ -321,10 +332,10 @@ void SSMColumn::getValue(uInt aRowNr)
   }
 }
 
-void SSMColumn::putBoolV (uInt aRowNr, const Bool* aValue)
+void SSMColumn::putBoolV (rownr_t aRowNr, const Bool* aValue)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aDummy;
 
   aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
@@ -341,7 +352,7 @@ void SSMColumn::putBoolV (uInt aRowNr, const Bool* aValue)
       *aValue;
   }
 }
-void SSMColumn::putuCharV (uInt aRowNr, const uChar* aValue)
+void SSMColumn::putuCharV (rownr_t aRowNr, const uChar* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -349,7 +360,7 @@ void SSMColumn::putuCharV (uInt aRowNr, const uChar* aValue)
       *aValue;
   }
 }
-void SSMColumn::putShortV (uInt aRowNr, const Short* aValue)
+void SSMColumn::putShortV (rownr_t aRowNr, const Short* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -357,7 +368,7 @@ void SSMColumn::putShortV (uInt aRowNr, const Short* aValue)
       *aValue;
   }
 }
-void SSMColumn::putuShortV (uInt aRowNr, const uShort* aValue)
+void SSMColumn::putuShortV (rownr_t aRowNr, const uShort* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -365,7 +376,7 @@ void SSMColumn::putuShortV (uInt aRowNr, const uShort* aValue)
       *aValue;
   }
 }
-void SSMColumn::putIntV (uInt aRowNr, const Int* aValue)
+void SSMColumn::putIntV (rownr_t aRowNr, const Int* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -373,7 +384,7 @@ void SSMColumn::putIntV (uInt aRowNr, const Int* aValue)
       *aValue;
   }
 }
-void SSMColumn::putuIntV (uInt aRowNr, const uInt* aValue)
+void SSMColumn::putuIntV (rownr_t aRowNr, const uInt* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -381,7 +392,7 @@ void SSMColumn::putuIntV (uInt aRowNr, const uInt* aValue)
       *aValue;
   }
 }
-void SSMColumn::putInt64V (uInt aRowNr, const Int64* aValue)
+void SSMColumn::putInt64V (rownr_t aRowNr, const Int64* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -389,7 +400,7 @@ void SSMColumn::putInt64V (uInt aRowNr, const Int64* aValue)
       *aValue;
   }
 }
-void SSMColumn::putfloatV (uInt aRowNr, const float* aValue)
+void SSMColumn::putfloatV (rownr_t aRowNr, const float* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -397,7 +408,7 @@ void SSMColumn::putfloatV (uInt aRowNr, const float* aValue)
       *aValue;
   }
 }
-void SSMColumn::putdoubleV (uInt aRowNr, const double* aValue)
+void SSMColumn::putdoubleV (rownr_t aRowNr, const double* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -405,7 +416,7 @@ void SSMColumn::putdoubleV (uInt aRowNr, const double* aValue)
       *aValue;
   }
 }
-void SSMColumn::putComplexV (uInt aRowNr, const Complex* aValue)
+void SSMColumn::putComplexV (rownr_t aRowNr, const Complex* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -414,7 +425,7 @@ void SSMColumn::putComplexV (uInt aRowNr, const Complex* aValue)
   }
 }
 
-void SSMColumn::putDComplexV (uInt aRowNr, const DComplex* aValue)
+void SSMColumn::putDComplexV (rownr_t aRowNr, const DComplex* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -423,12 +434,22 @@ void SSMColumn::putDComplexV (uInt aRowNr, const DComplex* aValue)
   }
 }
 
-void SSMColumn::putStringV (uInt aRowNr, const String* aValue)
+void SSMColumn::putStringV (rownr_t aRowNr, const String* aValue)
 {
-  // Fixed length strings are written directly.
-  if (itsMaxLen > 0) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+  if (itsUseDict) {
+    // Find the bucket first, so the dictionary has been read.
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
+    char* aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                    columnName());
+    uInt aCode = getDictCode (*aValue);
+    itsWriteFunc (aDummy+(aRowNr-aStartRow)*itsExternalSizeBytes,
+		  &aCode, itsNrCopy);
+    itsSSMPtr->setBucketDirty();
+  } else if (itsMaxLen > 0) {
+    // Fixed length strings are written directly.
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                                     columnName());
     itsWriteFunc (aDummy+(aRowNr-aStartRow)*itsExternalSizeBytes,
@@ -464,22 +485,25 @@ void SSMColumn::putStringV (uInt aRowNr, const String* aValue)
   }
 }
 
-void SSMColumn::putValue(uInt aRowNr, const void* aValue)
+void SSMColumn::putValue(rownr_t aRowNr, const void* aValue)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                                   columnName());
   itsWriteFunc (aDummy+(aRowNr-aStartRow)*itsExternalSizeBytes,
   		aValue, itsNrCopy);
   itsSSMPtr->setBucketDirty();
+  if (itsUseZoneMap) {
+    updateZone (aRowNr, aRowNr, aValue);
+  }
 }
 
-void SSMColumn::putValueShortString(uInt aRowNr, const void* aValue,
+void SSMColumn::putValueShortString(rownr_t aRowNr, const void* aValue,
 				    const String& string)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aDummy;
 
   aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
@@ -583,20 +607,29 @@ void SSMColumn::getScalarColumnDComplexV (Vector<DComplex>* aDataPtr)
 
 void SSMColumn::getScalarColumnStringV (Vector<String>* aDataPtr)
 {
-  for (uInt i=0;i<aDataPtr->nelements(); i++) {
-    getStringV(i,&(*aDataPtr)(i));
+  if (itsUseDict) {
+    // Get all codes and look them up in the dictionary.
+    Block<uInt> aCodes(aDataPtr->nelements());
+    getColumnValue (aCodes.storage(), aCodes.nelements());
+    for (uInt i=0;i<aDataPtr->nelements(); i++) {
+      (*aDataPtr)(i) = getDictValue (aCodes[i]);
+    }
+  } else {
+    for (uInt i=0;i<aDataPtr->nelements(); i++) {
+      getStringV(i,&(*aDataPtr)(i));
+    }
   }
 }
 
-void SSMColumn::getColumnValue(void* anArray,uInt aNrRows)
+void SSMColumn::getColumnValue(void* anArray,rownr_t aNrRows)
 {
   char* aDataPtr = static_cast<char*>(anArray);
-  uInt aRowNr=0;
+  rownr_t aRowNr=0;
   Int rowsToDo = aNrRows;
   
   while (rowsToDo > 0) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aValue;
     aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                               columnName());
@@ -698,20 +731,34 @@ void SSMColumn::putScalarColumnDComplexV (const Vector<DComplex>* aDataPtr)
 
 void SSMColumn::putScalarColumnStringV (const Vector<String>* aDataPtr)
 {
-  for (uInt i=0;i<aDataPtr->nelements(); i++) {
-    putStringV(i,&(*aDataPtr)(i));
+  if (itsUseDict) {
+    // Make sure the dictionary has been read before adding to it.
+    if (aDataPtr->nelements() > 0) {
+      rownr_t  aStartRow;
+      rownr_t  anEndRow;
+      itsSSMPtr->find (0, itsColNr, aStartRow, anEndRow, columnName());
+    }
+    Block<uInt> aCodes(aDataPtr->nelements());
+    for (uInt i=0;i<aDataPtr->nelements(); i++) {
+      aCodes[i] = getDictCode ((*aDataPtr)(i));
+    }
+    putColumnValue (aCodes.storage(), aCodes.nelements());
+  } else {
+    for (uInt i=0;i<aDataPtr->nelements(); i++) {
+      putStringV(i,&(*aDataPtr)(i));
+    }
   }
 }
 
-void SSMColumn::putColumnValue(const void* anArray,uInt aNrRows)
+void SSMColumn::putColumnValue(const void* anArray,rownr_t aNrRows)
 {
   const char* aDataPtr = static_cast<const char*>(anArray);
-  uInt aRowNr=0;
+  rownr_t aRowNr=0;
   Int rowsToDo=aNrRows;
 
   while (rowsToDo > 0) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aValPtr;
     aValPtr = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                                columnName());
@@ -719,6 +766,9 @@ void SSMColumn::putColumnValue(const void* anArray,uInt aNrRows)
     uInt aNr = anEndRow-aStartRow+1;
     rowsToDo -= aNr;
     itsWriteFunc (aValPtr, aDataPtr, aNr * itsNrCopy);
+    if (itsUseZoneMap) {
+      updateZone (aStartRow, anEndRow, aDataPtr);
+    }
     aDataPtr += aNr * itsLocalSize;
     itsSSMPtr->setBucketDirty();
   }
@@ -727,9 +777,143 @@ void SSMColumn::putColumnValue(const void* anArray,uInt aNrRows)
   columnCache().invalidate();
 }
 
+void SSMColumn::updateZone (rownr_t aStartRow, rownr_t anEndRow,
+                            const void* aValues)
+{
+  const char* aValPtr = static_cast<const char*>(aValues);
+  Double aMin = 0;
+  Double aMax = 0;
+  for (rownr_t i=aStartRow; i<=anEndRow; ++i) {
+    Double aVal;
+    if (! valueToDouble (dataType(), aValPtr, aVal)) {
+      // Make the range unknown.
+      aMin = std::numeric_limits<Double>::quiet_NaN();
+      break;
+    }
+    if (i == aStartRow) {
+      aMin = aMax = aVal;
+    } else {
+      aMin = min(aMin, aVal);
+      aMax = max(aMax, aVal);
+    }
+    aValPtr += itsLocalSize;
+  }
+  itsSSMPtr->updateZone (itsColNr, aStartRow, anEndRow, aMin, aMax);
+}
+
+void SSMColumn::enableZoneMap()
+{
+  DataType aDT = static_cast<DataType>(dataType());
+  itsUseZoneMap = (isReal(aDT)  ||  aDT == TpInt64);
+}
+
+Bool SSMColumn::getValueRange (rownr_t aRowNr, rownr_t& anEndRow,
+                               Double& aMinVal, Double& aMaxVal)
+{
+  // The index tells if there is a zone map (it might not be read yet).
+  rownr_t aLastRow = anEndRow;
+  Bool fnd = itsSSMPtr->getZone (itsColNr, aRowNr, aLastRow,
+                                 aMinVal, aMaxVal);
+  if (aLastRow < anEndRow) {
+    anEndRow = aLastRow;
+  }
+  return fnd;
+}
+
+void SSMColumn::setDictionary()
+{
+  if (dataType() == TpString  &&  itsShape.nelements() == 0) {
+    itsUseDict = True;
+    itsDict.assign (1, String());
+    itsDictMap.clear();
+    itsDictMap[String()] = 0;
+    init();
+  }
+}
+
+void SSMColumn::writeDictionary (AipsIO& anOs) const
+{
+  anOs.putstart ("SSMDictionary", 1);
+  anOs << uInt(itsDict.size());
+  for (uInt i=0; i<itsDict.size(); ++i) {
+    anOs << itsDict[i];
+  }
+  anOs.putend();
+}
+
+void SSMColumn::readDictionary (AipsIO& anOs)
+{
+  anOs.getstart ("SSMDictionary");
+  uInt aNrEntries;
+  anOs >> aNrEntries;
+  itsDict.resize (aNrEntries);
+  itsDictMap.clear();
+  for (uInt i=0; i<aNrEntries; ++i) {
+    anOs >> itsDict[i];
+    itsDictMap[itsDict[i]] = i;
+  }
+  anOs.getend();
+}
+
+uInt SSMColumn::getDictCode (const String& aValue)
+{
+  std::pair<std::unordered_map<String,uInt,std::hash<std::string> >::iterator,
+            bool> aRes = itsDictMap.insert (std::make_pair (aValue,
+                                                            uInt(itsDict.size())));
+  if (aRes.second) {
+    itsDict.push_back (aValue);
+  }
+  return aRes.first->second;
+}
+
+const String& SSMColumn::getDictValue (uInt aCode) const
+{
+  if (aCode >= itsDict.size()) {
+    throw DataManError ("SSMColumn: invalid dictionary code " +
+                        String::toString(aCode) + " in column " +
+                        columnName());
+  }
+  return itsDict[aCode];
+}
+
+Bool SSMColumn::getDictionary (uInt aStartIndex, Vector<String>& anEntries)
+{
+  if (! itsUseDict) {
+    return False;
+  }
+  // Make sure the index (thus the dictionary) has been read.
+  itsSSMPtr->readIndex();
+  uInt aNr = (aStartIndex < itsDict.size()  ?  itsDict.size()-aStartIndex : 0);
+  anEntries.resize (aNr);
+  for (uInt i=0; i<aNr; ++i) {
+    anEntries[i] = itsDict[aStartIndex+i];
+  }
+  return True;
+}
+
+void SSMColumn::getDictCodes (rownr_t aRowNr, uInt aNrRows, uInt* aCodes)
+{
+  if (! itsUseDict) {
+    DataManagerColumn::getDictCodes (aRowNr, aNrRows, aCodes);
+    return;
+  }
+  while (aNrRows > 0) {
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
+    char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                    columnName());
+    uInt aNr = std::min (anEndRow-aRowNr+1, rownr_t(aNrRows));
+    itsReadFunc (aCodes, aValue+(aRowNr-aStartRow)*itsExternalSizeBytes,
+                 aNr * itsNrCopy);
+    aCodes  += aNr;
+    aRowNr  += aNr;
+    aNrRows -= aNr;
+  }
+}
+
 void SSMColumn::removeColumn()
 {
-  if (dataType() == TpString  &&  itsMaxLen == 0) {
+  if (dataType() == TpString  &&  itsMaxLen == 0  &&  !itsUseDict) {
     Int buf[3];
     for (uInt i=0;i<itsSSMPtr->getNRow();i++) {
       getRowValue(buf, i);
@@ -747,8 +931,16 @@ void SSMColumn::init()
   Bool asBigEndian = itsSSMPtr->asBigEndian();
   itsNrCopy = itsNrElem;
   if (aDT == TpString) {
-    // Fixed length strings are written directly.
-    if (itsMaxLen > 0) {
+    if (itsUseDict) {
+      // Dictionary encoded strings are written as a uInt code.
+      itsLocalSize = ValType::getTypeSize(TpUInt);
+      itsExternalSizeBytes = ValType::getCanonicalSize (TpUInt, asBigEndian);
+      uInt aNRel;
+      ValType::getCanonicalFunc (TpUInt, itsReadFunc, itsWriteFunc, aNRel,
+				 asBigEndian);
+      itsNrCopy = aNRel;
+    } else if (itsMaxLen > 0) {
+      // Fixed length strings are written directly.
       itsNrCopy = itsMaxLen;
       itsLocalSize = itsNrCopy;
       itsExternalSizeBytes = itsNrCopy;
@@ -786,7 +978,7 @@ void SSMColumn::init()
   }
 }
 
-void SSMColumn::resync (uInt)
+void SSMColumn::resync (rownr_t)
 {
     // Invalidate the last value read.
     columnCache().invalidate();
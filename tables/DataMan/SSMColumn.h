@@ -36,10 +36,14 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/Conversion.h>
+#include <unordered_map>
+#include <vector>
+#include <string>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward declarations
+class AipsIO;
 
 
 // <summary>
@@ -85,6 +89,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // 8 characters), the string is stored directly in data bucket using
 // the space for bucketnr and offset.
 // <p>
+// <br>Scalar string columns can be dictionary encoded (see
+// <linkto class=StandardStMan>StandardStMan</linkto>). In that case the
+// data bucket contains the index (code) of the value in a dictionary
+// of the distinct values in the column. Code 0 is the empty string, so
+// a new row has an empty value. The dictionary is kept in memory and is
+// stored with the index (see <linkto class=SSMBase>SSMBase</linkto>).
+// Entries are never removed from the dictionary.
+// <p>
 // The class maintains a cache of the data in the bucket last read.
 // This cache is used by the higher level table classes to get faster
 // read access to the data.
@@ -117,53 +129,53 @@ public:
   virtual void setMaxLength (uInt maxLength);
 
   // Get the dimensionality of the item in the given row.
-  virtual uInt ndim (uInt aRowNr);
+  virtual uInt ndim (rownr_t aRowNr);
   
   // Get the shape of the array in the given row.
-  virtual IPosition shape (uInt aRowNr);
+  virtual IPosition shape (rownr_t aRowNr);
   
   // Let the object initialize itself for a newly created table.
   // It is meant for a derived class.
-  virtual void doCreate (uInt aNrRows);
+  virtual void doCreate (rownr_t aNrRows);
 
   // Let the column object initialize itself for an existing table
-  virtual void getFile (uInt aNrRows);
+  virtual void getFile (rownr_t aNrRows);
 
   // Resync the storage manager with the new file contents.
   // It resets the last rownr put.
-  void resync (uInt aNrRow);
+  void resync (rownr_t aNrRow);
   
   // Get the scalar value in the given row.
   // <group>
-  virtual void getBoolV     (uInt aRowNr, Bool* aDataPtr);
-  virtual void getuCharV    (uInt aRowNr, uChar* aDataPtr);
-  virtual void getShortV    (uInt aRowNr, Short* aDataPtr);
-  virtual void getuShortV   (uInt aRowNr, uShort* aDataPtr);
-  virtual void getIntV      (uInt aRowNr, Int* aDataPtr);
-  virtual void getuIntV     (uInt aRowNr, uInt* aDataPtr);
-  virtual void getInt64V    (uInt aRowNr, Int64* aDataPtr);
-  virtual void getfloatV    (uInt aRowNr, float* aDataPtr);
-  virtual void getdoubleV   (uInt aRowNr, double* aDataPtr);
-  virtual void getComplexV  (uInt aRowNr, Complex* aDataPtr);
-  virtual void getDComplexV (uInt aRowNr, DComplex* aDataPtr);
-  virtual void getStringV   (uInt aRowNr, String* aDataPtr);
+  virtual void getBoolV     (rownr_t aRowNr, Bool* aDataPtr);
+  virtual void getuCharV    (rownr_t aRowNr, uChar* aDataPtr);
+  virtual void getShortV    (rownr_t aRowNr, Short* aDataPtr);
+  virtual void getuShortV   (rownr_t aRowNr, uShort* aDataPtr);
+  virtual void getIntV      (rownr_t aRowNr, Int* aDataPtr);
+  virtual void getuIntV     (rownr_t aRowNr, uInt* aDataPtr);
+  virtual void getInt64V    (rownr_t aRowNr, Int64* aDataPtr);
+  virtual void getfloatV    (rownr_t aRowNr, float* aDataPtr);
+  virtual void getdoubleV   (rownr_t aRowNr, double* aDataPtr);
+  virtual void getComplexV  (rownr_t aRowNr, Complex* aDataPtr);
+  virtual void getDComplexV (rownr_t aRowNr, DComplex* aDataPtr);
+  virtual void getStringV   (rownr_t aRowNr, String* aDataPtr);
   // </group>
   
   // Put the scalar value in the given row.
   // It updates the cache if the row is contained in the cache.
   // <group>
-  virtual void putBoolV     (uInt aRowNr, const Bool* aDataPtr);
-  virtual void putuCharV    (uInt aRowNr, const uChar* aDataPtr);
-  virtual void putShortV    (uInt aRowNr, const Short* aDataPtr);
-  virtual void putuShortV   (uInt aRowNr, const uShort* aDataPtr);
-  virtual void putIntV      (uInt aRowNr, const Int* aDataPtr);
-  virtual void putuIntV     (uInt aRowNr, const uInt* aDataPtr);
-  virtual void putInt64V    (uInt aRowNr, const Int64* aDataPtr);
-  virtual void putfloatV    (uInt aRowNr, const float* aDataPtr);
-  virtual void putdoubleV   (uInt aRowNr, const double* aDataPtr);
-  virtual void putComplexV  (uInt aRowNr, const Complex* aDataPtr);
-  virtual void putDComplexV (uInt aRowNr, const DComplex* aDataPtr);
-  virtual void putStringV   (uInt aRowNr, const String* aDataPtr);
+  virtual void putBoolV     (rownr_t aRowNr, const Bool* aDataPtr);
+  virtual void putuCharV    (rownr_t aRowNr, const uChar* aDataPtr);
+  virtual void putShortV    (rownr_t aRowNr, const Short* aDataPtr);
+  virtual void putuShortV   (rownr_t aRowNr, const uShort* aDataPtr);
+  virtual void putIntV      (rownr_t aRowNr, const Int* aDataPtr);
+  virtual void putuIntV     (rownr_t aRowNr, const uInt* aDataPtr);
+  virtual void putInt64V    (rownr_t aRowNr, const Int64* aDataPtr);
+  virtual void putfloatV    (rownr_t aRowNr, const float* aDataPtr);
+  virtual void putdoubleV   (rownr_t aRowNr, const double* aDataPtr);
+  virtual void putComplexV  (rownr_t aRowNr, const Complex* aDataPtr);
+  virtual void putDComplexV (rownr_t aRowNr, const DComplex* aDataPtr);
+  virtual void putStringV   (rownr_t aRowNr, const String* aDataPtr);
   // </group>
   
   // Get the scalar values of the entire column.
@@ -201,11 +213,11 @@ public:
   
   // Add (NewNrRows-OldNrRows) rows to the Column and initialize
   // the new rows when needed.
-  virtual void addRow (uInt aNewNrRows, uInt anOldNrRows, Bool doInit);
+  virtual void addRow (rownr_t aNewNrRows, rownr_t anOldNrRows, Bool doInit);
 
   // Remove the given row from the data bucket and possibly string bucket.
   // If needed, it also removes it from the cache.
-  virtual void deleteRow (uInt aRowNr);
+  virtual void deleteRow (rownr_t aRowNr);
 
   // Get the size of the dataType in bytes!!
   uInt getExternalSizeBytes() const;
@@ -223,35 +235,81 @@ public:
   // as is the case with Strings, it can be done here.
   void removeColumn();
 
+  // Keep a zone map (the value range per bucket) for the column.
+  // It is only done for scalar columns with a real numeric data type.
+  // It is called for the columns given in ZONEMAPCOLUMNS and, when the
+  // index is read, for the columns having a zone map in the index.
+  void enableZoneMap();
+
+  // Does the column keep a zone map?
+  Bool hasZoneMap() const;
+
+  // Get the range of the values in the bucket containing the given row
+  // using the zone map (see <linkto class=SSMIndex>SSMIndex</linkto>).
+  virtual Bool getValueRange (rownr_t aRowNr, rownr_t& anEndRow,
+                              Double& aMinVal, Double& aMaxVal);
+
+  // Store the column as a dictionary encoded string column.
+  // It is only done for a scalar String column. It must be done before
+  // the column is used, thus right after the constructor.
+  void setDictionary();
+
+  // Is the column dictionary encoded?
+  Bool hasDictionary() const;
+
+  // Write or read the dictionary.
+  // <group>
+  void writeDictionary (AipsIO& anOs) const;
+  void readDictionary (AipsIO& anOs);
+  // </group>
+
+  // Get the dictionary entries from the given entry on.
+  // False is returned if the column is not dictionary encoded.
+  virtual Bool getDictionary (uInt aStartIndex, Vector<String>& anEntries);
+
+  // Get the dictionary codes of the given rows.
+  virtual void getDictCodes (rownr_t aRowNr, uInt aNrRows, uInt* aCodes);
+
 protected:
   // Shift the rows in the bucket one to the left when removing the given row.
-  void shiftRows (char* aValue, uInt rowNr, uInt startRow, uInt endRow);
+  void shiftRows (char* aValue, rownr_t rowNr, rownr_t startRow, rownr_t endRow);
 
   // Fill the cache with data of the bucket containing the given row.
-  void getValue (uInt aRowNr);
+  void getValue (rownr_t aRowNr);
   
   // Get the bucketnr, offset, and length of a variable length string.
   // <src>data</src> must have 3 Ints to hold the values.
   // It returns a pointer to the data in the bucket, which can be used
   // for the case that the data bucket contains the (short) string.
-  Char* getRowValue (Int* data, uInt aRowNr);
+  Char* getRowValue (Int* data, rownr_t aRowNr);
     
   // Put the given value for the row into the correct data bucket.
-  void putValue (uInt aRowNr, const void* aValue);
+  void putValue (rownr_t aRowNr, const void* aValue);
 
   // Put the given string for the row into the correct data bucket.
   // The argument <src>aValue></src> must be 3 Ints (for bucketnr, offset,
   // and length). Only the length is actually used.
-  void putValueShortString (uInt aRowNr, const void* aValue,
+  void putValueShortString (rownr_t aRowNr, const void* aValue,
 			    const String& string);
   
   // Get the values for the entire column.
   // The data from all buckets is copied to the array.
-  void getColumnValue (void* anArray, uInt aNrRows);
+  void getColumnValue (void* anArray, rownr_t aNrRows);
   
   // Put the values from the array in the entire column.
   // Each data bucket is filled with the the appropriate part of the array.
-  void putColumnValue (const void* anArray, uInt aNrRows);
+  void putColumnValue (const void* anArray, rownr_t aNrRows);
+
+  // Extend the zone map with the given values put in rows aStartRow
+  // till anEndRow, which must be in a single bucket.
+  void updateZone (rownr_t aStartRow, rownr_t anEndRow, const void* aValues);
+
+  // Get the code of a string in the dictionary.
+  // The string is added to the dictionary if not present yet.
+  uInt getDictCode (const String& aValue);
+
+  // Get the string with the given code in the dictionary.
+  const String& getDictValue (uInt aCode) const;
 
 
   // Pointer to the parent storage manager.
@@ -279,6 +337,13 @@ protected:
   Conversion::ValueFunction* itsWriteFunc;
   // Pointer to a convert function for reading.
   Conversion::ValueFunction* itsReadFunc;
+  // Is a zone map kept?
+  Bool              itsUseZoneMap;
+  // Is the column dictionary encoded?
+  Bool              itsUseDict;
+  // The dictionary and the map of value to code.
+  std::vector<String> itsDict;
+  std::unordered_map<String,uInt,std::hash<std::string> > itsDictMap;
   
 private:
   // Forbid copy constructor.
@@ -315,6 +380,16 @@ inline char* SSMColumn::getDataPtr()
   return static_cast<char*>(itsData);
 }
 
+inline Bool SSMColumn::hasZoneMap() const
+{
+  return itsUseZoneMap;
+}
+
+inline Bool SSMColumn::hasDictionary() const
+{
+  return itsUseDict;
+}
+
 inline uInt SSMColumn::getColNr()
 {
   return itsColNr;
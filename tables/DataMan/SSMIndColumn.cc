@@ -56,29 +56,29 @@ SSMIndColumn::~SSMIndColumn()
 void SSMIndColumn::setMaxLength (uInt)
 {}
 
-void SSMIndColumn::doCreate (uInt aNrRows)
+void SSMIndColumn::doCreate (rownr_t aNrRows)
 {
     // Initialize and create new file.
     itsIosFile = itsSSMPtr->openArrayFile (ByteIO::New);
     addRow(aNrRows,0,False);
 }
 
-void SSMIndColumn::getFile (uInt)
+void SSMIndColumn::getFile (rownr_t)
 {
     // Initialize and open existing file.
     itsIosFile = itsSSMPtr->openArrayFile (itsSSMPtr->fileOption());
 }
 
-void SSMIndColumn::addRow (uInt aNewNrRows, uInt anOldNrRows, Bool doInit)
+void SSMIndColumn::addRow (rownr_t aNewNrRows, rownr_t anOldNrRows, Bool doInit)
 {
   // init the buckets to zero of needed
   if (doInit) {
-    uInt aRowNr=0;
-    uInt aNrRows=aNewNrRows;
+    rownr_t aRowNr=0;
+    rownr_t aNrRows=aNewNrRows;
 
     while (aNrRows > 0) {
-      uInt  aStartRow;
-      uInt  anEndRow;
+      rownr_t  aStartRow;
+      rownr_t  anEndRow;
       char* aValPtr;
       aValPtr = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                                  columnName());
@@ -106,7 +106,7 @@ void SSMIndColumn::setShapeColumn (const IPosition& aShape)
     isShapeFixed   = True;
 }
 
-void SSMIndColumn::setShape (uInt aRowNr, const IPosition& aShape)
+void SSMIndColumn::setShape (rownr_t aRowNr, const IPosition& aShape)
 {
   // Get the current entry. If none, make empty one.
   StIndArray* aPtr = getArrayPtr (aRowNr);
@@ -124,11 +124,11 @@ void SSMIndColumn::setShape (uInt aRowNr, const IPosition& aShape)
   }
 }
 
-StIndArray* SSMIndColumn::getArrayPtr (uInt aRowNr)
+StIndArray* SSMIndColumn::getArrayPtr (rownr_t aRowNr)
 {
   Int64 anOffset;
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aValue;
 
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
@@ -147,7 +147,7 @@ StIndArray* SSMIndColumn::getArrayPtr (uInt aRowNr)
 
 //# Get the shape for the array (if any) in the given row.
 //# Read shape if not read yet.
-StIndArray* SSMIndColumn::getShape (uInt aRowNr)
+StIndArray* SSMIndColumn::getShape (rownr_t aRowNr)
 {
     StIndArray* aPtr = getArrayPtr (aRowNr);
     if (aPtr == 0) {
@@ -160,13 +160,13 @@ StIndArray* SSMIndColumn::getShape (uInt aRowNr)
     return aPtr;
 }
 
-Bool SSMIndColumn::isShapeDefined (uInt aRowNr)
+Bool SSMIndColumn::isShapeDefined (rownr_t aRowNr)
     { return (getArrayPtr(aRowNr) == 0  ?  False : True); }
 
-uInt SSMIndColumn::ndim (uInt aRowNr)
+uInt SSMIndColumn::ndim (rownr_t aRowNr)
     { return getShape(aRowNr)->shape().nelements(); }
 
-IPosition SSMIndColumn::shape (uInt aRowNr)
+IPosition SSMIndColumn::shape (rownr_t aRowNr)
     { return getShape(aRowNr)->shape(); }
 
 Bool SSMIndColumn::canChangeShape() const
@@ -180,11 +180,11 @@ Bool SSMIndColumn::canAccessSlice (Bool& reask) const
 }
 
 
-void SSMIndColumn::deleteRow(uInt aRowNr)
+void SSMIndColumn::deleteRow(rownr_t aRowNr)
 {
   char* aValue;
-  uInt  aSRow;
-  uInt  anERow;
+  rownr_t  aSRow;
+  rownr_t  anERow;
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aSRow, anERow, columnName());
   
   if (aRowNr < anERow) {
@@ -194,32 +194,32 @@ void SSMIndColumn::deleteRow(uInt aRowNr)
   }
 }
 
-void SSMIndColumn::getArrayStringV (uInt aRowNr, Array<String>* arr)
+void SSMIndColumn::getArrayStringV (rownr_t aRowNr, Array<String>* arr)
     { getShape(aRowNr)->getArrayStringV (*itsIosFile, arr); }
 
-void SSMIndColumn::putArrayStringV (uInt aRowNr, const Array<String>* arr)
+void SSMIndColumn::putArrayStringV (rownr_t aRowNr, const Array<String>* arr)
     { getShape(aRowNr)->putArrayStringV (*itsIosFile, arr); }
 
-void SSMIndColumn::getSliceStringV (uInt aRowNr, const Slicer& ns,
+void SSMIndColumn::getSliceStringV (rownr_t aRowNr, const Slicer& ns,
 				   Array<String>* arr)
     { getShape(aRowNr)->getSliceStringV (*itsIosFile, ns, arr); }
 
-void SSMIndColumn::putSliceStringV (uInt aRowNr, const Slicer& ns,
+void SSMIndColumn::putSliceStringV (rownr_t aRowNr, const Slicer& ns,
 				   const Array<String>* arr)
     { getShape(aRowNr)->putSliceStringV (*itsIosFile, ns, arr); }
     
 
 #define SSMIndColumn_GETPUT(T,NM) \
-void SSMIndColumn::aips_name2(getArray,NM) (uInt aRowNr, Array<T>* arr) \
+void SSMIndColumn::aips_name2(getArray,NM) (rownr_t aRowNr, Array<T>* arr) \
     { getShape(aRowNr)->aips_name2(getArray,NM) (*itsIosFile, arr); } \
-void SSMIndColumn::aips_name2(putArray,NM) (uInt aRowNr, const Array<T>* arr) \
+void SSMIndColumn::aips_name2(putArray,NM) (rownr_t aRowNr, const Array<T>* arr) \
     { getShape(aRowNr)->aips_name2(putArray,NM) \
 	                                                (*itsIosFile, arr); } \
 void SSMIndColumn::aips_name2(getSlice,NM) \
-                             (uInt aRowNr, const Slicer& ns, Array<T>* arr) \
+                             (rownr_t aRowNr, const Slicer& ns, Array<T>* arr) \
     { getShape(aRowNr)->aips_name2(getSlice,NM) (*itsIosFile, ns, arr); } \
 void SSMIndColumn::aips_name2(putSlice,NM) \
-                        (uInt aRowNr, const Slicer& ns, const Array<T>* arr) \
+                        (rownr_t aRowNr, const Slicer& ns, const Array<T>* arr) \
     { getShape(aRowNr)->aips_name2(putSlice,NM) (*itsIosFile, ns, arr); }
 
 SSMIndColumn_GETPUT(Bool,BoolV)
@@ -109,23 +109,23 @@ public:
   virtual Bool canAccessSlice (Bool& reask) const;
   
   // Add (newNrrow-oldNrrow) rows to the column.
-  virtual void addRow (uInt aNewNrRows, uInt anOldNrRows, Bool doInit);
+  virtual void addRow (rownr_t aNewNrRows, rownr_t anOldNrRows, Bool doInit);
   
   // Set the (fixed) shape of the arrays in the entire column.
   virtual void setShapeColumn (const IPosition& aShape);
   
   // Get the dimensionality of the item in the given row.
-  virtual uInt ndim (uInt aRowNr);
+  virtual uInt ndim (rownr_t aRowNr);
   
   // Set the shape of the array in the given row and allocate the array
   // in the file.
-  void setShape (uInt aRowNr, const IPosition& aShape);
+  void setShape (rownr_t aRowNr, const IPosition& aShape);
   
   // Is the shape defined (i.e. is there an array) in this row?
-  virtual Bool isShapeDefined (uInt aRowNr);
+  virtual Bool isShapeDefined (rownr_t aRowNr);
   
   // Get the shape of the array in the given row.
-  virtual IPosition shape (uInt aRowNr);
+  virtual IPosition shape (rownr_t aRowNr);
   
   // This storage manager can handle changing array shapes.
   Bool canChangeShape() const;
@@ -134,47 +134,47 @@ public:
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn get function).
   // <group>
-  virtual void getArrayBoolV     (uInt aRowNr, Array<Bool>* aDataPtr);
-  virtual void getArrayuCharV    (uInt aRowNr, Array<uChar>* aDataPtr);
-  virtual void getArrayShortV    (uInt aRowNr, Array<Short>* aDataPtr);
-  virtual void getArrayuShortV   (uInt aRowNr, Array<uShort>* aDataPtr);
-  virtual void getArrayIntV      (uInt aRowNr, Array<Int>* aDataPtr);
-  virtual void getArrayuIntV     (uInt aRowNr, Array<uInt>* aDataPtr);
-  virtual void getArrayInt64V    (uInt aRowNr, Array<Int64>* aDataPtr);
-  virtual void getArrayfloatV    (uInt aRowNr, Array<float>* aDataPtr);
-  virtual void getArraydoubleV   (uInt aRowNr, Array<double>* aDataPtr);
-  virtual void getArrayComplexV  (uInt aRowNr, Array<Complex>* aDataPtr);
-  virtual void getArrayDComplexV (uInt aRowNr, Array<DComplex>* aDataPtr);
-  virtual void getArrayStringV   (uInt aRowNr, Array<String>* aDataPtr);
+  virtual void getArrayBoolV     (rownr_t aRowNr, Array<Bool>* aDataPtr);
+  virtual void getArrayuCharV    (rownr_t aRowNr, Array<uChar>* aDataPtr);
+  virtual void getArrayShortV    (rownr_t aRowNr, Array<Short>* aDataPtr);
+  virtual void getArrayuShortV   (rownr_t aRowNr, Array<uShort>* aDataPtr);
+  virtual void getArrayIntV      (rownr_t aRowNr, Array<Int>* aDataPtr);
+  virtual void getArrayuIntV     (rownr_t aRowNr, Array<uInt>* aDataPtr);
+  virtual void getArrayInt64V    (rownr_t aRowNr, Array<Int64>* aDataPtr);
+  virtual void getArrayfloatV    (rownr_t aRowNr, Array<float>* aDataPtr);
+  virtual void getArraydoubleV   (rownr_t aRowNr, Array<double>* aDataPtr);
+  virtual void getArrayComplexV  (rownr_t aRowNr, Array<Complex>* aDataPtr);
+  virtual void getArrayDComplexV (rownr_t aRowNr, Array<DComplex>* aDataPtr);
+  virtual void getArrayStringV   (rownr_t aRowNr, Array<String>* aDataPtr);
   // </group>
   
   // Put an array value into the given row.
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn put function).
   // <group>
-  virtual void putArrayBoolV     (uInt aRowNr,
+  virtual void putArrayBoolV     (rownr_t aRowNr,
 				  const Array<Bool>* aDataPtr);
-  virtual void putArrayuCharV    (uInt aRowNr,
+  virtual void putArrayuCharV    (rownr_t aRowNr,
 				  const Array<uChar>* aDataPtr);
-  virtual void putArrayShortV    (uInt aRowNr,
+  virtual void putArrayShortV    (rownr_t aRowNr,
 				  const Array<Short>* aDataPtr);
-  virtual void putArrayuShortV   (uInt aRowNr,
+  virtual void putArrayuShortV   (rownr_t aRowNr,
 				  const Array<uShort>* aDataPtr);
-  virtual void putArrayIntV      (uInt aRowNr,
+  virtual void putArrayIntV      (rownr_t aRowNr,
 				  const Array<Int>* aDataPtr);
-  virtual void putArrayuIntV     (uInt aRowNr,
+  virtual void putArrayuIntV     (rownr_t aRowNr,
 				  const Array<uInt>* aDataPtr);
-  virtual void putArrayInt64V    (uInt aRowNr,
+  virtual void putArrayInt64V    (rownr_t aRowNr,
 				  const Array<Int64>* aDataPtr);
-  virtual void putArrayfloatV    (uInt aRowNr,
+  virtual void putArrayfloatV    (rownr_t aRowNr,
 				  const Array<float>* aDataPtr);
-  virtual void putArraydoubleV   (uInt aRowNr,
+  virtual void putArraydoubleV   (rownr_t aRowNr,
 				  const Array<double>* aDataPtr);
-  virtual void putArrayComplexV  (uInt aRowNr,
+  virtual void putArrayComplexV  (rownr_t aRowNr,
 				  const Array<Complex>* aDataPtr);
-  virtual void putArrayDComplexV (uInt aRowNr,
+  virtual void putArrayDComplexV (rownr_t aRowNr,
 				  const Array<DComplex>* aDataPtr);
-  virtual void putArrayStringV   (uInt aRowNr,
+  virtual void putArrayStringV   (rownr_t aRowNr,
 				  const Array<String>* aDataPtr);
   // </group>
   
@@ -182,29 +182,29 @@ public:
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn getSlice function).
   // <group>
-  virtual void getSliceBoolV     (uInt aRowNr, const Slicer&,
+  virtual void getSliceBoolV     (rownr_t aRowNr, const Slicer&,
 				  Array<Bool>* aDataPtr);
-  virtual void getSliceuCharV    (uInt aRowNr, const Slicer&,
+  virtual void getSliceuCharV    (rownr_t aRowNr, const Slicer&,
 				  Array<uChar>* aDataPtr);
-  virtual void getSliceShortV    (uInt aRowNr, const Slicer&,
+  virtual void getSliceShortV    (rownr_t aRowNr, const Slicer&,
 				  Array<Short>* aDataPtr);
-  virtual void getSliceuShortV   (uInt aRowNr, const Slicer&,
+  virtual void getSliceuShortV   (rownr_t aRowNr, const Slicer&,
 				  Array<uShort>* aDataPtr);
-  virtual void getSliceIntV      (uInt aRowNr, const Slicer&,
+  virtual void getSliceIntV      (rownr_t aRowNr, const Slicer&,
 				  Array<Int>* aDataPtr);
-  virtual void getSliceuIntV     (uInt aRowNr, const Slicer&,
+  virtual void getSliceuIntV     (rownr_t aRowNr, const Slicer&,
 				  Array<uInt>* aDataPtr);
-  virtual void getSliceInt64V    (uInt aRowNr, const Slicer&,
+  virtual void getSliceInt64V    (rownr_t aRowNr, const Slicer&,
 				  Array<Int64>* aDataPtr);
-  virtual void getSlicefloatV    (uInt aRowNr, const Slicer&,
+  virtual void getSlicefloatV    (rownr_t aRowNr, const Slicer&,
 				  Array<float>* aDataPtr);
-  virtual void getSlicedoubleV   (uInt aRowNr, const Slicer&,
+  virtual void getSlicedoubleV   (rownr_t aRowNr, const Slicer&,
 				  Array<double>* aDataPtr);
-  virtual void getSliceComplexV  (uInt aRowNr, const Slicer&,
+  virtual void getSliceComplexV  (rownr_t aRowNr, const Slicer&,
 				  Array<Complex>* aDataPtr);
-  virtual void getSliceDComplexV (uInt aRowNr, const Slicer&,
+  virtual void getSliceDComplexV (rownr_t aRowNr, const Slicer&,
 				  Array<DComplex>* aDataPtr);
-  virtual void getSliceStringV   (uInt aRowNr, const Slicer&,
+  virtual void getSliceStringV   (rownr_t aRowNr, const Slicer&,
 				  Array<String>* aDataPtr);
   // </group>
   
@@ -212,40 +212,40 @@ public:
   // The buffer pointed to by aDataPtr has to have the correct length
   // (which is guaranteed by the ArrayColumn putSlice function).
   // <group>
-  virtual void putSliceBoolV     (uInt aRowNr, const Slicer&,
+  virtual void putSliceBoolV     (rownr_t aRowNr, const Slicer&,
 				  const Array<Bool>* aDataPtr);
-  virtual void putSliceuCharV    (uInt aRowNr, const Slicer&,
+  virtual void putSliceuCharV    (rownr_t aRowNr, const Slicer&,
 				  const Array<uChar>* aDataPtr);
-  virtual void putSliceShortV    (uInt aRowNr, const Slicer&,
+  virtual void putSliceShortV    (rownr_t aRowNr, const Slicer&,
 				  const Array<Short>* aDataPtr);
-  virtual void putSliceuShortV   (uInt aRowNr, const Slicer&,
+  virtual void putSliceuShortV   (rownr_t aRowNr, const Slicer&,
 				  const Array<uShort>* aDataPtr);
-  virtual void putSliceIntV      (uInt aRowNr, const Slicer&,
+  virtual void putSliceIntV      (rownr_t aRowNr, const Slicer&,
 				  const Array<Int>* aDataPtr);
-  virtual void putSliceuIntV     (uInt aRowNr, const Slicer&,
+  virtual void putSliceuIntV     (rownr_t aRowNr, const Slicer&,
 				  const Array<uInt>* aDataPtr);
-  virtual void putSliceInt64V    (uInt aRowNr, const Slicer&,
+  virtual void putSliceInt64V    (rownr_t aRowNr, const Slicer&,
 				  const Array<Int64>* aDataPtr);
-  virtual void putSlicefloatV    (uInt aRowNr, const Slicer&,
+  virtual void putSlicefloatV    (rownr_t aRowNr, const Slicer&,
 				  const Array<float>* aDataPtr);
-  virtual void putSlicedoubleV   (uInt aRowNr, const Slicer&,
+  virtual void putSlicedoubleV   (rownr_t aRowNr, const Slicer&,
 				  const Array<double>* aDataPtr);
-  virtual void putSliceComplexV  (uInt aRowNr, const Slicer&,
+  virtual void putSliceComplexV  (rownr_t aRowNr, const Slicer&,
 				  const Array<Complex>* aDataPtr);
-  virtual void putSliceDComplexV (uInt aRowNr, const Slicer&,
+  virtual void putSliceDComplexV (rownr_t aRowNr, const Slicer&,
 				  const Array<DComplex>* aDataPtr);
-  virtual void putSliceStringV   (uInt aRowNr, const Slicer&,
+  virtual void putSliceStringV   (rownr_t aRowNr, const Slicer&,
 				  const Array<String>* aDataPtr);
   // </group>
   
   // Let the column object create its array file.
-  virtual void doCreate (uInt aNrRows);
+  virtual void doCreate (rownr_t aNrRows);
 
   // Open an existing file.
-  virtual void getFile (uInt aNrRows);
+  virtual void getFile (rownr_t aNrRows);
 
   // Remove the given row from the data bucket and possibly string bucket.
-  virtual void deleteRow(uInt aRowNr);
+  virtual void deleteRow(rownr_t aRowNr);
 
 
 private:
@@ -262,10 +262,10 @@ private:
   // Read the shape at the given row.
   // This will cache the information in the StIndArray
   // object for that row.
-  StIndArray* getShape (uInt aRowNr);
+  StIndArray* getShape (rownr_t aRowNr);
   
   // Return a pointer to the array in the given row (for a get).
-  StIndArray* getArrayPtr (uInt aRowNr);
+  StIndArray* getArrayPtr (rownr_t aRowNr);
 
   
   //# The shape off all arrays in case it is fixed
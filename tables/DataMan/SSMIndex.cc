@@ -35,6 +35,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/iostream.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -43,7 +44,8 @@ SSMIndex::SSMIndex (SSMBase* aSSMPtr, uInt rowsPerBucket)
 : itsSSMPtr           (aSSMPtr),
   itsNUsed            (0),
   itsRowsPerBucket    (rowsPerBucket),
-  itsNrColumns        (0)
+  itsNrColumns        (0),
+  itsFirstNewRow      (0)
 {  
 }
 
@@ -54,25 +56,76 @@ SSMIndex::~SSMIndex()
 
 void SSMIndex::get (AipsIO& anOs)
 {
-  anOs.getstart("SSMIndex");
+  uInt version = anOs.getstart("SSMIndex");
   anOs >> itsNUsed;
   anOs >> itsRowsPerBucket;
   anOs >> itsNrColumns;
   anOs >> itsFreeSpace;
-  getBlock (anOs, itsLastRow);
+  // As of version 2 the row numbers are stored as 64-bit values.
+  if (version > 1) {
+    getBlock (anOs, itsLastRow);
+  } else {
+    Block<uInt> lastRow;
+    getBlock (anOs, lastRow);
+    itsLastRow.resize (lastRow.size(), True, False);
+    for (uInt i=0; i<lastRow.size(); ++i) {
+      itsLastRow[i] = lastRow[i];
+    }
+  }
   getBlock (anOs, itsBucketNumber);
+  // As of version 3 the zone maps are stored.
+  itsZones.clear();
+  if (version > 2) {
+    uInt nzone;
+    anOs >> nzone;
+    for (uInt i=0; i<nzone; ++i) {
+      Int anOffset;
+      anOs >> anOffset;
+      ZoneMap& zone = itsZones[anOffset];
+      getBlock (anOs, zone.itsMin);
+      getBlock (anOs, zone.itsMax);
+    }
+  }
+  itsFirstNewRow = (itsNUsed == 0  ?  0 : itsLastRow[itsNUsed-1] + 1);
   anOs.getend();
 }
 
 void SSMIndex::put (AipsIO& anOs) const
 {
-  anOs.putstart("SSMIndex", 1);
+  // Use version 2 (64-bit row numbers) only if needed, so older software
+  // can still read the index of smaller tables.
+  // Version 3 (also 64-bit row numbers) is needed to store zone maps,
+  // which are only kept for the columns given in ZONEMAPCOLUMNS.
+  Bool use64 = (itsNUsed > 0  &&
+                itsLastRow[itsNUsed-1] > std::numeric_limits<uInt>::max());
+  uInt version = (use64 ? 2 : 1);
+  if (! itsZones.empty()) {
+    use64 = True;
+    version = 3;
+  }
+  anOs.putstart("SSMIndex", version);
   anOs << itsNUsed;
   anOs << itsRowsPerBucket;
   anOs << itsNrColumns;
   anOs << itsFreeSpace;
-  putBlock (anOs, itsLastRow, itsNUsed);
+  if (use64) {
+    putBlock (anOs, itsLastRow, itsNUsed);
+  } else {
+    Block<uInt> lastRow(itsNUsed);
+    for (uInt i=0; i<itsNUsed; ++i) {
+      lastRow[i] = uInt(itsLastRow[i]);
+    }
+    putBlock (anOs, lastRow, itsNUsed);
+  }
   putBlock (anOs, itsBucketNumber, itsNUsed);
+  if (version > 2) {
+    anOs << uInt(itsZones.size());
+    for (const auto& x : itsZones) {
+      anOs << x.first;
+      putBlock (anOs, x.second.itsMin, itsNUsed);
+      putBlock (anOs, x.second.itsMax, itsNUsed);
+    }
+  }
   anOs.putend();
 }
 
@@ -109,21 +162,22 @@ void SSMIndex::setNrColumns (Int aNrColumns, uInt aSizeUsed)
   }
 }
 
-void SSMIndex::addRow (uInt aNrRows)
+void SSMIndex::addRow (rownr_t aNrRows)
 {
-  uInt lastRow=0;
+  rownr_t lastRow=0;
   if (aNrRows == 0 ) {
     return;
   }
+  uInt anOldNUsed = itsNUsed;
 
   if (itsNUsed > 0 ) {
     lastRow = itsLastRow[itsNUsed-1]+1;
-    uInt usedLast = lastRow;
+    rownr_t usedLast = lastRow;
     if (itsNUsed > 1) {
       usedLast -= itsLastRow[itsNUsed-2]+1;
     }
-    uInt fitLast = itsRowsPerBucket-usedLast;
-    uInt toAdd = min(fitLast, aNrRows);
+    rownr_t fitLast = itsRowsPerBucket-usedLast;
+    rownr_t toAdd = min(fitLast, aNrRows);
     
     itsLastRow[itsNUsed-1] += toAdd;
     aNrRows -= toAdd;
@@ -131,6 +185,7 @@ void SSMIndex::addRow (uInt aNrRows)
   }
  
   if (aNrRows == 0) {
+    addZoneRows (anOldNUsed);
     return;
   }
    
@@ -138,7 +193,7 @@ void SSMIndex::addRow (uInt aNrRows)
   // which is cheaper.
   // Take in account that NrRows can be bigger then itsRowsPerBucket !
   
-  uInt aNr = (aNrRows+itsRowsPerBucket-1) / itsRowsPerBucket;
+  uInt aNr = uInt((aNrRows+itsRowsPerBucket-1) / itsRowsPerBucket);
   
   uInt aNewNr = itsNUsed+aNr;
   uInt aOldNr = itsLastRow.nelements();
@@ -156,20 +211,51 @@ void SSMIndex::addRow (uInt aNrRows)
   
   while (aNrRows > 0) {
     itsBucketNumber[itsNUsed] =itsSSMPtr->getNewBucket();
-    uInt toAdd = min (aNrRows, itsRowsPerBucket);
+    rownr_t toAdd = min (aNrRows, rownr_t(itsRowsPerBucket));
     lastRow += toAdd;
     aNrRows -= toAdd;
     itsLastRow[itsNUsed] = lastRow-1;
     itsNUsed += 1;
   }
+  addZoneRows (anOldNUsed);
 }
 
-Int SSMIndex::deleteRow (uInt aRowNr)
+void SSMIndex::addZoneRows (uInt anOldNUsed)
+{
+  rownr_t aNrRows = (itsNUsed == 0  ?  0 : itsLastRow[itsNUsed-1] + 1);
+  for (auto& x : itsZones) {
+    ZoneMap& zone = x.second;
+    if (zone.itsMin.nelements() < itsLastRow.nelements()) {
+      zone.itsMin.resize (itsLastRow.nelements());
+      zone.itsMax.resize (itsLastRow.nelements());
+    }
+    // New buckets have an empty range.
+    for (uInt i=anOldNUsed; i<itsNUsed; ++i) {
+      zone.itsMin[i] = std::numeric_limits<Double>::infinity();
+      zone.itsMax[i] = -std::numeric_limits<Double>::infinity();
+    }
+    zone.itsWritten.resize (aNrRows - itsFirstNewRow, false);
+  }
+}
+
+Int SSMIndex::deleteRow (rownr_t aRowNr)
 {
   // Decrement the rowNrs of all the intervals after the row to be removed
   uInt anIndex = getIndex(aRowNr, String());
   Bool isEmpty=False;
 
+  // Remove the row from the administration of unwritten new rows.
+  if (aRowNr < itsFirstNewRow) {
+    itsFirstNewRow--;
+  } else {
+    for (auto& x : itsZones) {
+      std::vector<bool>& written = x.second.itsWritten;
+      if (aRowNr - itsFirstNewRow < written.size()) {
+        written.erase (written.begin() + (aRowNr - itsFirstNewRow));
+      }
+    }
+  }
+
   for (uInt i = anIndex ; i< itsNUsed; i++) {
     if (itsLastRow[i] > 0) {
       itsLastRow[i]--;
@@ -183,11 +269,11 @@ Int SSMIndex::deleteRow (uInt aRowNr)
 
   Int anEmptyBucket = -1;
 
-  Int last = -1;
+  Int64 last = -1;
   if (anIndex > 0) {
     last = itsLastRow[anIndex-1];
   }
-  if (static_cast<Int>(itsLastRow[anIndex]) == last || isEmpty) {
+  if (static_cast<Int64>(itsLastRow[anIndex]) == last || isEmpty) {
     anEmptyBucket = itsBucketNumber[anIndex];
     if (anIndex+1 < itsNUsed) {
       objmove (&itsLastRow[anIndex],
@@ -196,6 +282,12 @@ Int SSMIndex::deleteRow (uInt aRowNr)
       objmove (&itsBucketNumber[anIndex],
 	       &itsBucketNumber[anIndex+1],
 	       itsNUsed-anIndex-1);
+      for (auto& x : itsZones) {
+        objmove (&x.second.itsMin[anIndex], &x.second.itsMin[anIndex+1],
+                 itsNUsed-anIndex-1);
+        objmove (&x.second.itsMax[anIndex], &x.second.itsMax[anIndex+1],
+                 itsNUsed-anIndex-1);
+      }
     }
     itsNUsed--;
     itsLastRow[itsNUsed]=0;
@@ -208,10 +300,14 @@ Int SSMIndex::deleteRow (uInt aRowNr)
 void SSMIndex::recreate()
 {
   itsNUsed=0;
+  itsFirstNewRow=0;
+  for (auto& x : itsZones) {
+    x.second.itsWritten.clear();
+  }
 }
 
 
-uInt SSMIndex::getIndex (uInt aRowNumber, const String& colName) const
+uInt SSMIndex::getIndex (rownr_t aRowNumber, const String& colName) const
 {
   Bool isFound;
   uInt anIndex = binarySearchBrackets( isFound, itsLastRow, aRowNumber, 
@@ -233,6 +329,7 @@ Int SSMIndex::removeColumn (Int anOffset, uInt nbits)
  
   itsNrColumns--;
   AlwaysAssert (itsNrColumns > -1, AipsError);
+  itsZones.erase (anOffset);
   
   // See if space can be combined
   // That is possible if two or more entries are adjacent.
@@ -311,8 +408,8 @@ void SSMIndex::addColumn (Int anOffset, uInt nbits)
   }
 }
 
-void SSMIndex::find (uInt aRowNumber, uInt& aBucketNr, 
-		     uInt& aStartRow, uInt& anEndRow,
+void SSMIndex::find (rownr_t aRowNumber, uInt& aBucketNr, 
+		     rownr_t& aStartRow, rownr_t& anEndRow,
                      const String& colName) const
 {
   uInt anIndex = getIndex(aRowNumber, colName);
@@ -324,5 +421,95 @@ void SSMIndex::find (uInt aRowNumber, uInt& aBucketNr,
   }
 }
 
-} //# NAMESPACE CASACORE - END
+void SSMIndex::addZoneMap (Int anOffset)
+{
+  ZoneMap& zone = itsZones[anOffset];
+  zone.itsMin.resize (itsLastRow.nelements(), True, False);
+  zone.itsMax.resize (itsLastRow.nelements(), True, False);
+  for (uInt i=0; i<itsNUsed; ++i) {
+    zone.itsMin[i] = std::numeric_limits<Double>::quiet_NaN();
+    zone.itsMax[i] = std::numeric_limits<Double>::quiet_NaN();
+  }
+  rownr_t aNrRows = (itsNUsed == 0  ?  0 : itsLastRow[itsNUsed-1] + 1);
+  zone.itsWritten.assign (aNrRows - itsFirstNewRow, false);
+}
 
+void SSMIndex::updateZone (Int anOffset, rownr_t aStartRow, rownr_t anEndRow,
+                           Double aMin, Double aMax)
+{
+  std::map<Int,ZoneMap>::iterator iter = itsZones.find (anOffset);
+  if (iter == itsZones.end()) {
+    return;
+  }
+  ZoneMap& zone = iter->second;
+  uInt anIndex = getIndex (aStartRow, String());
+  Double& zmin = zone.itsMin[anIndex];
+  Double& zmax = zone.itsMax[anIndex];
+  if (! isNaN(zmin)) {
+    if (isNaN(aMin)) {
+      zmin = zmax = aMin;
+    } else {
+      zmin = min(zmin, aMin);
+      zmax = max(zmax, aMax);
+    }
+  }
+  for (rownr_t aRow=max(aStartRow, itsFirstNewRow); aRow<=anEndRow; ++aRow) {
+    if (aRow - itsFirstNewRow < zone.itsWritten.size()) {
+      zone.itsWritten[aRow - itsFirstNewRow] = true;
+    }
+  }
+}
+
+Bool SSMIndex::getZone (Int anOffset, rownr_t aRowNr, rownr_t& anEndRow,
+                        Double& aMin, Double& aMax) const
+{
+  std::map<Int,ZoneMap>::const_iterator iter = itsZones.find (anOffset);
+  if (iter == itsZones.end()) {
+    return False;
+  }
+  const ZoneMap& zone = iter->second;
+  uInt anIndex = getIndex (aRowNr, String());
+  anEndRow = itsLastRow[anIndex];
+  aMin = zone.itsMin[anIndex];
+  aMax = zone.itsMax[anIndex];
+  if (isNaN(aMin)) {
+    return False;
+  }
+  // New rows not written yet contain 0.
+  rownr_t aStartRow = (anIndex == 0  ?  0 : itsLastRow[anIndex-1] + 1);
+  for (rownr_t aRow=max(aStartRow, itsFirstNewRow); aRow<=anEndRow; ++aRow) {
+    if (aRow - itsFirstNewRow < zone.itsWritten.size()
+    &&  !zone.itsWritten[aRow - itsFirstNewRow]) {
+      aMin = min(aMin, 0.);
+      aMax = max(aMax, 0.);
+      break;
+    }
+  }
+  return aMin <= aMax;
+}
+
+void SSMIndex::resolveZones()
+{
+  rownr_t aNrRows = (itsNUsed == 0  ?  0 : itsLastRow[itsNUsed-1] + 1);
+  for (auto& x : itsZones) {
+    ZoneMap& zone = x.second;
+    uInt anIndex = 0;
+    for (rownr_t aRow=itsFirstNewRow; aRow<aNrRows; ++aRow) {
+      if (aRow - itsFirstNewRow < zone.itsWritten.size()
+      &&  zone.itsWritten[aRow - itsFirstNewRow]) {
+        continue;
+      }
+      while (itsLastRow[anIndex] < aRow) {
+        anIndex++;
+      }
+      if (! isNaN(zone.itsMin[anIndex])) {
+        zone.itsMin[anIndex] = min(zone.itsMin[anIndex], 0.);
+        zone.itsMax[anIndex] = max(zone.itsMax[anIndex], 0.);
+      }
+    }
+    zone.itsWritten.clear();
+  }
+  itsFirstNewRow = aNrRows;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -32,6 +32,7 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <map>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -74,6 +75,15 @@ class SSMBase;
 //       When a new column is added <linkto class=SSMBase>SSMBase</linkto>
 //       will scan the SSMIndex objects to find the hole fitting best.
 // </ol>
+// Furthermore it can keep a zone map for numeric scalar columns given in
+// the ZONEMAPCOLUMNS field of the StandardStMan specification, which
+// is a block giving the minimum and maximum value in each data bucket.
+// It is used to skip buckets when evaluating a selection.
+// The ranges are conservative; they are extended when a value is put,
+// but not narrowed when a value is overwritten or a row is deleted.
+// New rows contain zeroes until a value is put. The zone map keeps track
+// of the new rows that have not been written yet, and adds the value 0
+// to their range when the index is written.
 // </synopsis>
   
 // <todo asof="$DATE:$">
@@ -112,7 +122,7 @@ public:
   void setNrColumns (Int aNrColumns, uInt aSizeUsed);
 
   // Add some rows.
-  void addRow (uInt aNrRows);
+  void addRow (rownr_t aNrRows);
 
   // Show Statistics of index.
   void showStatistics (ostream& anOs) const;
@@ -132,7 +142,7 @@ public:
   void addColumn (Int anOffset, uInt nbits);
 
   // Delete the given row.
-  Int deleteRow (uInt aRowNumber);
+  Int deleteRow (rownr_t aRowNumber);
 
   // Get the number of rows that fits in ach bucket.
   uInt getRowsPerBucket() const;
@@ -140,12 +150,49 @@ public:
   // Find the bucket containing the given row.
   // An exception is thrown if not found.
   // It also sets the first and last row number fitting in that bucket.
-  void find (uInt aRowNumber, uInt& aBucketNr, uInt& aStartRow,
-	     uInt& anEndRow, const String& colName) const;
+  void find (rownr_t aRowNumber, uInt& aBucketNr, rownr_t& aStartRow,
+	     rownr_t& anEndRow, const String& colName) const;
+
+  // Add a zone map for the column at the given offset.
+  // The ranges of the existing buckets are unknown.
+  void addZoneMap (Int anOffset);
+
+  // Does the column at the given offset have a zone map?
+  Bool hasZoneMap (Int anOffset) const
+    { return itsZones.find (anOffset) != itsZones.end(); }
+
+  // Extend the ranges in the zone map of the column at the given offset
+  // for rows aStartRow till anEndRow, which must be in a single bucket.
+  // The range is made unknown if aMin is NaN.
+  // Nothing is done if the column has no zone map.
+  void updateZone (Int anOffset, rownr_t aStartRow, rownr_t anEndRow,
+                   Double aMin, Double aMax);
+
+  // Get the value range of the bucket containing the given row for the
+  // column at the given offset. anEndRow is set to the last row in the bucket.
+  // False is returned if there is no zone map or if the range is unknown.
+  Bool getZone (Int anOffset, rownr_t aRowNr, rownr_t& anEndRow,
+                Double& aMin, Double& aMax) const;
+
+  // Add the value 0 to the ranges of new rows that have not been written.
+  // It is done before writing the index.
+  void resolveZones();
 
 private:
+  // The zone map of a column.
+  struct ZoneMap {
+    // Minimum and maximum value per bucket (NaN means unknown).
+    Block<Double> itsMin;
+    Block<Double> itsMax;
+    // Flags telling which new rows (from itsFirstNewRow on) are written.
+    std::vector<bool> itsWritten;
+  };
+
+  // Resize the zone maps after rows have been added.
+  void addZoneRows (uInt anOldNUsed);
+
   // Get the index of the bucket containing the given row.
-  uInt getIndex (uInt aRowNr, const String& colName) const;
+  uInt getIndex (rownr_t aRowNr, const String& colName) const;
 
 
   //# Pointer to specific Storage Manager.    
@@ -155,7 +202,7 @@ private:
   uInt itsNUsed;
 
   //# Last row nr indexed together with itsBucketNumber
-  Block<uInt> itsLastRow;
+  Block<rownr_t> itsLastRow;
 
   //# Bucketnumbers indexed together with itsLastRow.
   //# So itsLastRow[0] contains the last rownumber of the bucket
@@ -170,6 +217,12 @@ private:
 
   //# Nr of columns using this index.
   Int itsNrColumns;
+
+  //# First row added after the index was read or written.
+  rownr_t itsFirstNewRow;
+
+  //# Zone maps of the columns using this index (key is column offset).
+  std::map<Int,ZoneMap> itsZones;
 };
 
 
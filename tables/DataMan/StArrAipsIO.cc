@@ -46,8 +46,8 @@ StManColumnArrayAipsIO::StManColumnArrayAipsIO (StManAipsIO* smptr,
 
 StManColumnArrayAipsIO::~StManColumnArrayAipsIO()
 {
-    uInt nr = stmanPtr_p->nrow();
-    for (uInt i=0; i<nr; i++) {
+    rownr_t nr = stmanPtr_p->nrow();
+    for (rownr_t i=0; i<nr; i++) {
 	deleteArray (i);
     }
 }
@@ -60,7 +60,7 @@ void StManColumnArrayAipsIO::setShapeColumn (const IPosition& shape)
 }
 
 
-void StManColumnArrayAipsIO::addRow (uInt nrnew, uInt nrold)
+void StManColumnArrayAipsIO::addRow (rownr_t nrnew, rownr_t nrold)
 {
     //# Extend data blocks if needed.
     StManColumnAipsIO::addRow (nrnew, nrold);
@@ -72,10 +72,10 @@ void StManColumnArrayAipsIO::addRow (uInt nrnew, uInt nrold)
     }
 }
 
-uInt StManColumnArrayAipsIO::ndim (uInt)
+uInt StManColumnArrayAipsIO::ndim (rownr_t)
     { return shape_p.nelements(); }
 
-IPosition StManColumnArrayAipsIO::shape (uInt)
+IPosition StManColumnArrayAipsIO::shape (rownr_t)
     { return shape_p; }
 
 
@@ -90,14 +90,14 @@ Bool StManColumnArrayAipsIO::canAccessArrayColumn (Bool& reask) const
     return True;
 }
 
-void StManColumnArrayAipsIO::getArrayfloatV (uInt rownr, Array<float>* arr)
+void StManColumnArrayAipsIO::getArrayfloatV (rownr_t rownr, Array<float>* arr)
 {
     Bool deleteIt;
     float* data = arr->getStorage (deleteIt);
     objcopy (data, (const float*)(getArrayPtr (rownr)), nrelem_p);
     arr->putStorage (data, deleteIt);
 }
-void StManColumnArrayAipsIO::putArrayfloatV (uInt rownr,
+void StManColumnArrayAipsIO::putArrayfloatV (rownr_t rownr,
 					     const Array<float>* arr)
 {
     Bool deleteIt;
@@ -106,7 +106,7 @@ void StManColumnArrayAipsIO::putArrayfloatV (uInt rownr,
     arr->freeStorage (data, deleteIt);
     stmanPtr_p->setHasPut();
 }
-void StManColumnArrayAipsIO::getSlicefloatV (uInt rownr, const Slicer& ns,
+void StManColumnArrayAipsIO::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 					     Array<float>* arr)
 {
     Array<float> tabarr (shape_p, (float*) (getArrayPtr (rownr)), SHARE);
@@ -114,7 +114,7 @@ void StManColumnArrayAipsIO::getSlicefloatV (uInt rownr, const Slicer& ns,
     ns.inferShapeFromSource (shape_p, blc, trc, inc);
     *arr = tabarr(blc, trc, inc);
 }
-void StManColumnArrayAipsIO::putSlicefloatV (uInt rownr, const Slicer& ns,
+void StManColumnArrayAipsIO::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 					     const Array<float>* arr)
 {
     Array<float> tabarr (shape_p, (float*) (getArrayPtr (rownr)), SHARE);
@@ -125,7 +125,7 @@ void StManColumnArrayAipsIO::putSlicefloatV (uInt rownr, const Slicer& ns,
 }
 
 #define STMANCOLUMNARRAYAIPSIO_GETPUT(T,NM) \
-void StManColumnArrayAipsIO::aips_name2(getArray,NM) (uInt rownr, \
+void StManColumnArrayAipsIO::aips_name2(getArray,NM) (rownr_t rownr, \
 						      Array<T>* arr) \
 { \
     Bool deleteIt; \
@@ -133,7 +133,7 @@ void StManColumnArrayAipsIO::aips_name2(getArray,NM) (uInt rownr, \
     objcopy (data, (const T*)(getArrayPtr (rownr)), nrelem_p); \
     arr->putStorage (data, deleteIt); \
 } \
-void StManColumnArrayAipsIO::aips_name2(putArray,NM) (uInt rownr, \
+void StManColumnArrayAipsIO::aips_name2(putArray,NM) (rownr_t rownr, \
 						      const Array<T>* arr) \
 { \
     Bool deleteIt; \
@@ -143,7 +143,7 @@ void StManColumnArrayAipsIO::aips_name2(putArray,NM) (uInt rownr, \
     stmanPtr_p->setHasPut(); \
 } \
 void StManColumnArrayAipsIO::aips_name2(getSlice,NM) \
-                          (uInt rownr, const Slicer& ns, Array<T>* arr) \
+                          (rownr_t rownr, const Slicer& ns, Array<T>* arr) \
 { \
     Array<T> tabarr (shape_p, (T*) (getArrayPtr (rownr)), SHARE); \
     IPosition blc, trc, inc; \
@@ -151,7 +151,7 @@ void StManColumnArrayAipsIO::aips_name2(getSlice,NM) \
     *arr = tabarr(blc, trc, inc); \
 } \
 void StManColumnArrayAipsIO::aips_name2(putSlice,NM) \
-                          (uInt rownr, const Slicer& ns, const Array<T>* arr) \
+                          (rownr_t rownr, const Slicer& ns, const Array<T>* arr) \
 { \
     Array<T> tabarr (shape_p, (T*) (getArrayPtr (rownr)), SHARE); \
     IPosition blc, trc, inc; \
@@ -267,7 +267,7 @@ STMANCOLUMNARRAYAIPSIO_GETPUTCOLUMN(String,StringV)
 
 
 
-void StManColumnArrayAipsIO::remove (uInt rownr)
+void StManColumnArrayAipsIO::remove (rownr_t rownr)
 {
     deleteArray (rownr);
     StManColumnAipsIO::remove (rownr);
@@ -280,7 +280,7 @@ Bool StManColumnArrayAipsIO::ok() const
 }
 
 
-void StManColumnArrayAipsIO::deleteArray (uInt rownr)
+void StManColumnArrayAipsIO::deleteArray (rownr_t rownr)
 {
     void* datap = getArrayPtr (rownr);
     deleteData (datap, False);
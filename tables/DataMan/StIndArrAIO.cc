@@ -57,8 +57,8 @@ StManColumnIndArrayAipsIO::StManColumnIndArrayAipsIO (StManAipsIO* smptr,
 //# Delete all objects created.
 StManColumnIndArrayAipsIO::~StManColumnIndArrayAipsIO()
 {
-    uInt nr = stmanPtr_p->nrow();
-    for (uInt i=0; i<nr; i++) {
+    rownr_t nr = stmanPtr_p->nrow();
+    for (rownr_t i=0; i<nr; i++) {
 	deleteArray (i);
     }
     if (version_p <= 1) {
@@ -71,7 +71,7 @@ StManColumnIndArrayAipsIO::~StManColumnIndArrayAipsIO()
 //# Compose the file name from the mother file name extended with
 //# the unique column sequence nr.
 //# Create the given nr of rows in it.
-void StManColumnIndArrayAipsIO::doCreate (uInt nrrow)
+void StManColumnIndArrayAipsIO::doCreate (rownr_t nrrow)
 {
     //# Create the file.
     openFile (ByteIO::New);
@@ -110,7 +110,7 @@ void StManColumnIndArrayAipsIO::setShapeColumn (const IPosition& shape)
 }
 
 
-void StManColumnIndArrayAipsIO::addRow (uInt nrnew, uInt nrold)
+void StManColumnIndArrayAipsIO::addRow (rownr_t nrnew, rownr_t nrold)
 {
     //# Extend data blocks if needed.
     StManColumnAipsIO::addRow (nrnew, nrold);
@@ -123,7 +123,7 @@ void StManColumnIndArrayAipsIO::addRow (uInt nrnew, uInt nrold)
 }
 
 
-void StManColumnIndArrayAipsIO::setShape (uInt rownr, const IPosition& shape)
+void StManColumnIndArrayAipsIO::setShape (rownr_t rownr, const IPosition& shape)
 {
     StIndArray* ptr = STMANINDGETBLOCK(rownr);
     if (ptr == 0) {
@@ -138,7 +138,7 @@ void StManColumnIndArrayAipsIO::setShape (uInt rownr, const IPosition& shape)
 
 //# Get the shape for the array (if any) in the given row.
 //# Read shape if not read yet.
-StIndArray* StManColumnIndArrayAipsIO::getShape (uInt rownr)
+StIndArray* StManColumnIndArrayAipsIO::getShape (rownr_t rownr)
 {
     StIndArray* ptr = STMANINDGETBLOCK(rownr);
     if (ptr == 0) {
@@ -150,13 +150,13 @@ StIndArray* StManColumnIndArrayAipsIO::getShape (uInt rownr)
     return ptr;
 }
 
-Bool StManColumnIndArrayAipsIO::isShapeDefined (uInt rownr)
+Bool StManColumnIndArrayAipsIO::isShapeDefined (rownr_t rownr)
     { return (STMANINDGETBLOCK(rownr) == 0  ?  False : True); }
 
-uInt StManColumnIndArrayAipsIO::ndim (uInt rownr)
+uInt StManColumnIndArrayAipsIO::ndim (rownr_t rownr)
     { return getShape(rownr)->shape().nelements(); }
 
-IPosition StManColumnIndArrayAipsIO::shape (uInt rownr)
+IPosition StManColumnIndArrayAipsIO::shape (rownr_t rownr)
     { return getShape(rownr)->shape(); }
 
 Bool StManColumnIndArrayAipsIO::canChangeShape() const
@@ -170,25 +170,25 @@ Bool StManColumnIndArrayAipsIO::canAccessSlice (Bool& reask) const
 }
 
 
-void StManColumnIndArrayAipsIO::getArrayfloatV (uInt rownr, Array<float>* arr)
+void StManColumnIndArrayAipsIO::getArrayfloatV (rownr_t rownr, Array<float>* arr)
 {
     getShape(rownr)->getArrayfloatV (*iosfile_p, arr);
 }
 
-void StManColumnIndArrayAipsIO::putArrayfloatV (uInt rownr,
+void StManColumnIndArrayAipsIO::putArrayfloatV (rownr_t rownr,
 						const Array<float>* arr)
 {
     getShape(rownr)->putArrayfloatV (*iosfile_p, arr);
     stmanPtr_p->setHasPut();
 }
 
-void StManColumnIndArrayAipsIO::getSlicefloatV (uInt rownr, const Slicer& ns,
+void StManColumnIndArrayAipsIO::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 						Array<float>* arr)
 {
     getShape(rownr)->getSlicefloatV (*iosfile_p, ns, arr);
 }
 
-void StManColumnIndArrayAipsIO::putSlicefloatV (uInt rownr, const Slicer& ns,
+void StManColumnIndArrayAipsIO::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 						const Array<float>* arr)
 {
     getShape(rownr)->putSlicefloatV (*iosfile_p, ns, arr);
@@ -197,24 +197,24 @@ void StManColumnIndArrayAipsIO::putSlicefloatV (uInt rownr, const Slicer& ns,
     
 
 #define STMANCOLUMNINDARRAYAIPSIO_GETPUT(T,NM) \
-void StManColumnIndArrayAipsIO::aips_name2(getArray,NM) (uInt rownr, \
+void StManColumnIndArrayAipsIO::aips_name2(getArray,NM) (rownr_t rownr, \
 							 Array<T>* arr) \
 { \
     getShape(rownr)->aips_name2(getArray,NM) (*iosfile_p, arr); \
 } \
-void StManColumnIndArrayAipsIO::aips_name2(putArray,NM) (uInt rownr, \
+void StManColumnIndArrayAipsIO::aips_name2(putArray,NM) (rownr_t rownr, \
 						         const Array<T>* arr) \
 { \
     getShape(rownr)->aips_name2(putArray,NM) (*iosfile_p, arr); \
     stmanPtr_p->setHasPut(); \
 } \
 void StManColumnIndArrayAipsIO::aips_name2(getSlice,NM) \
-                             (uInt rownr, const Slicer& ns, Array<T>* arr) \
+                             (rownr_t rownr, const Slicer& ns, Array<T>* arr) \
 { \
     getShape(rownr)->aips_name2(getSlice,NM) (*iosfile_p, ns, arr); \
 } \
 void StManColumnIndArrayAipsIO::aips_name2(putSlice,NM) \
-                        (uInt rownr, const Slicer& ns, const Array<T>* arr) \
+                        (rownr_t rownr, const Slicer& ns, const Array<T>* arr) \
 { \
     getShape(rownr)->aips_name2(putSlice,NM) (*iosfile_p, ns, arr); \
     stmanPtr_p->setHasPut(); \
@@ -234,7 +234,7 @@ STMANCOLUMNINDARRAYAIPSIO_GETPUT(DComplex,DComplexV)
 STMANCOLUMNINDARRAYAIPSIO_GETPUT(String,StringV)
 
 
-void StManColumnIndArrayAipsIO::remove (uInt rownr)
+void StManColumnIndArrayAipsIO::remove (rownr_t rownr)
 {
     deleteArray (rownr);
     StManColumnAipsIO::remove (rownr);
@@ -247,7 +247,7 @@ Bool StManColumnIndArrayAipsIO::ok() const
 }
 
 
-void StManColumnIndArrayAipsIO::deleteArray (uInt rownr)
+void StManColumnIndArrayAipsIO::deleteArray (rownr_t rownr)
 {
     delete STMANINDGETBLOCK(rownr);
 }
@@ -39,6 +39,7 @@
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/DOos.h>
 #include <casacore/tables/DataMan/DataManError.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -61,19 +62,24 @@ StManColumnAipsIO::~StManColumnAipsIO()
     { deleteAll(); }
 
 
-void StManColumnAipsIO::doCreate (uInt nrrow)
+void StManColumnAipsIO::doCreate (rownr_t nrrow)
     { addRow (nrrow, 0); }
 
 void StManColumnAipsIO::reopenRW()
 {}
 
-void StManColumnAipsIO::addRow (uInt nrnew, uInt)
+void StManColumnAipsIO::addRow (rownr_t nrnew, rownr_t)
 {
+    //# The column data are held in memory in blocks indexed by a uInt.
+    if (nrnew > std::numeric_limits<uInt>::max()) {
+        throw DataManError ("StManAipsIO: column " + columnName() +
+                            " cannot hold more than 2^32-1 rows");
+    }
     //# Extend the column sizes if needed.
     if (nrnew > nralloc_p) {
 	uInt n = nralloc_p + 4096;
 	if (n < nrnew) {
-	    n = nrnew;
+	    n = uInt(nrnew);
 	}
 	resize (n);
     }
@@ -97,7 +103,7 @@ void StManColumnAipsIO::resize (uInt nr)
 }
 
 
-uInt StManColumnAipsIO::findExt (uInt index, Bool setCache)
+uInt StManColumnAipsIO::findExt (rownr_t index, Bool setCache)
 {
     //# Use a binary search to get the block containing the index.
     Int st = 0;
@@ -118,7 +124,7 @@ uInt StManColumnAipsIO::findExt (uInt index, Bool setCache)
         }
     }
     if (i > Int(nrext_p)) {
-	throw indexError<uInt>(index, "StManColumnAipsIO::findExt - "
+	throw indexError<rownr_t>(index, "StManColumnAipsIO::findExt - "
                                "rownr " + String::toString(index) +
                                " in column " + columnName() +
                                " out of range");
@@ -147,25 +153,25 @@ uInt StManColumnAipsIO::nextExt (void*& ext, uInt& extnr, uInt nrmax) const
 
 
 #define STMANCOLUMNAIPSIO_GETPUT(T,NM) \
-void StManColumnAipsIO::aips_name2(get,NM) (uInt rownr, T* value) \
+void StManColumnAipsIO::aips_name2(get,NM) (rownr_t rownr, T* value) \
 { \
     uInt extnr = findExt(rownr, True); \
     *value = ((T*)(data_p[extnr])) [rownr-ncum_p[extnr-1]]; \
 } \
-void StManColumnAipsIO::aips_name2(put,NM) (uInt rownr, const T* value) \
+void StManColumnAipsIO::aips_name2(put,NM) (rownr_t rownr, const T* value) \
 { \
     uInt extnr = findExt(rownr, True); \
     ((T*)(data_p[extnr])) [rownr-ncum_p[extnr-1]] = *value; \
     stmanPtr_p->setHasPut(); \
 } \
-uInt StManColumnAipsIO::aips_name2(getBlock,NM) (uInt rownr, uInt nrmax, T* value) \
+uInt StManColumnAipsIO::aips_name2(getBlock,NM) (rownr_t rownr, uInt nrmax, T* value) \
 { \
     uInt nr; \
     uInt extnr = findExt(rownr, True); \
-    nrmax = min (nrmax, nralloc_p-rownr); \
+    nrmax = min (nrmax, uInt(nralloc_p-rownr)); \
     uInt nrm = nrmax; \
     while (nrmax > 0) { \
-        nr = min (nrmax, ncum_p[extnr]-rownr); \
+        nr = min (nrmax, uInt(ncum_p[extnr]-rownr)); \
 	objcopy (value, ((T*)(data_p[extnr])) +rownr-ncum_p[extnr-1], nr); \
 	nrmax -= nr; \
 	value += nr; \
@@ -174,13 +180,13 @@ uInt StManColumnAipsIO::aips_name2(getBlock,NM) (uInt rownr, uInt nrmax, T* valu
     } \
     return nrm; \
 } \
-void StManColumnAipsIO::aips_name2(putBlock,NM) (uInt rownr, uInt nrmax, const T* value) \
+void StManColumnAipsIO::aips_name2(putBlock,NM) (rownr_t rownr, uInt nrmax, const T* value) \
 { \
     uInt nr; \
     uInt extnr = findExt(rownr, True); \
-    nrmax = min (nrmax, nralloc_p-rownr); \
+    nrmax = min (nrmax, uInt(nralloc_p-rownr)); \
     while (nrmax > 0) { \
-        nr = min (nrmax, ncum_p[extnr]-rownr); \
+        nr = min (nrmax, uInt(ncum_p[extnr]-rownr)); \
 	objcopy (((T*)(data_p[extnr])) +rownr-ncum_p[extnr-1], value, nr); \
 	nrmax -= nr; \
 	value += nr; \
@@ -200,16 +206,16 @@ void StManColumnAipsIO::aips_name2(getScalarColumnCells,NM) \
     if (rownrs.isSliced()) { \
         RefRowsSliceIter iter(rownrs); \
         while (! iter.pastEnd()) { \
-            uInt rownr = iter.sliceStart(); \
-            uInt end = iter.sliceEnd(); \
-            uInt incr = iter.sliceIncr(); \
+            rownr_t rownr = iter.sliceStart(); \
+            rownr_t end = iter.sliceEnd(); \
+            rownr_t incr = iter.sliceIncr(); \
             while (rownr <= end) { \
                 if (rownr < cache.start()  ||  rownr > cache.end()) { \
                     aips_name2(get,NM) (rownr, valptr); \
                 } \
-	        uInt inx = rownr - cache.start(); \
+	        rownr_t inx = rownr - cache.start(); \
                 const T* cacheValue = (const T*)(cache.dataPtr()) + inx; \
-                uInt endrow = min (end, cache.end()); \
+                rownr_t endrow = min (end, cache.end()); \
                 while (rownr <= endrow) { \
 	            *valptr++ = *cacheValue; \
                     rownr += incr; \
@@ -219,19 +225,19 @@ void StManColumnAipsIO::aips_name2(getScalarColumnCells,NM) \
 	    iter++; \
         } \
     } else { \
-        const Vector<uInt>& rowvec = rownrs.rowVector(); \
+        const Vector<rownr_t>& rowvec = rownrs.rowVector(); \
         uInt nr = rowvec.nelements(); \
         if (nr > 0) { \
             Bool delR; \
-            const uInt* rows = rowvec.getStorage (delR); \
+            const rownr_t* rows = rowvec.getStorage (delR); \
             if (rows[0] < cache.start()  ||  rows[0] > cache.end()) { \
                 findExt(rows[0], True); \
             } \
             const T* cacheValue = (const T*)(cache.dataPtr()); \
-            uInt strow = cache.start(); \
-            uInt endrow = cache.end(); \
+            rownr_t strow = cache.start(); \
+            rownr_t endrow = cache.end(); \
             for (uInt i=0; i<nr; i++) { \
-	        uInt rownr = rows[i]; \
+	        rownr_t rownr = rows[i]; \
                 if (rownr >= strow  &&  rownr <= endrow) { \
 	            value[i] = cacheValue[rownr-strow]; \
 	        } else { \
@@ -261,7 +267,7 @@ STMANCOLUMNAIPSIO_GETPUT(DComplex,DComplexV)
 STMANCOLUMNAIPSIO_GETPUT(String,StringV)
 
 
-void StManColumnAipsIO::remove (uInt index)
+void StManColumnAipsIO::remove (rownr_t index)
 {
     //# Find the extension.
     uInt extnr  = findExt(index, False);
@@ -630,12 +636,12 @@ void StManColumnAipsIO::getData (void* datap, uInt inx, uInt nrval,
 }
 
 
-void* StManColumnAipsIO::getArrayPtr (uInt rownr)
+void* StManColumnAipsIO::getArrayPtr (rownr_t rownr)
 {
     uInt extnr = findExt(rownr, False);
     return ((void**)(data_p[extnr])) [rownr-ncum_p[extnr-1]];
 }
-void StManColumnAipsIO::putArrayPtr (uInt rownr, void* ptr)
+void StManColumnAipsIO::putArrayPtr (rownr_t rownr, void* ptr)
 {
     uInt extnr = findExt(rownr, False);
     ((void**)(data_p[extnr])) [rownr-ncum_p[extnr-1]] = ptr;
@@ -791,7 +797,7 @@ void StManAipsIO::removeColumn (DataManagerColumn* colp)
                                 " does not exist");
 }
 
-void StManAipsIO::addRow (uInt nr)
+void StManAipsIO::addRow (rownr_t nr)
 {
     //# Add the number of rows to each column.
     for (uInt i=0; i<ncolumn(); i++) {
@@ -802,7 +808,7 @@ void StManAipsIO::addRow (uInt nr)
 }
 
 
-void StManAipsIO::removeRow (uInt rownr)
+void StManAipsIO::removeRow (rownr_t rownr)
 {
     for (uInt i=0; i<ncolumn(); i++) {
 	colSet_p[i]->remove (rownr);
@@ -826,7 +832,7 @@ Bool StManAipsIO::flush (AipsIO&, Bool)
     ios << stmanName_p;                        // this is added in version 2
     ios << sequenceNr();
     ios << uniqnr_p;
-    ios << nrrow_p;
+    ios << uInt(nrrow_p);                      // columns check the limit
     ios << ncolumn();
     for (i=0; i<ncolumn(); i++) {
 	ios << colSet_p[i]->dataType();
@@ -839,7 +845,7 @@ Bool StManAipsIO::flush (AipsIO&, Bool)
     return True;
 }
 
-void StManAipsIO::create (uInt nrrow)
+void StManAipsIO::create (rownr_t nrrow)
 {
     nrrow_p = nrrow;
     //# Let the column create something if needed.
@@ -849,11 +855,11 @@ void StManAipsIO::create (uInt nrrow)
     setHasPut();
 }
 
-void StManAipsIO::open (uInt tabNrrow, AipsIO&)
+void StManAipsIO::open (rownr_t tabNrrow, AipsIO&)
 {
     resync (tabNrrow);
 }
-void StManAipsIO::resync (uInt nrrow)
+void StManAipsIO::resync (rownr_t nrrow)
 {
     if (iosfile_p != 0) {
         iosfile_p->resync();
@@ -861,14 +867,15 @@ void StManAipsIO::resync (uInt nrrow)
     AipsIO ios(fileName());
     uInt version = ios.getstart ("StManAipsIO");
     //# Get and check the number of rows and columns and the column types.
-    uInt i, nrc, snr;
+    uInt i, nrc, snr, nrr;
     int  dt;
     if (version > 1) {
 	ios >> stmanName_p;
     }
     ios >> snr;
     ios >> uniqnr_p;
-    ios >> nrrow_p;
+    ios >> nrr;
+    nrrow_p = nrr;
     ios >> nrc;
     if (snr != sequenceNr()  ||  nrc != ncolumn()) {
 	throw DataManInternalError
@@ -902,7 +909,7 @@ void StManAipsIO::resync (uInt nrrow)
 	if (nrrow > nrrow_p) {
 	    colSet_p[i]->addRow (nrrow, nrrow_p);
 	} else if (nrrow < nrrow_p) {
-	    for (uInt r=nrrow; r<nrrow_p; r++) {
+	    for (rownr_t r=nrrow; r<nrrow_p; r++) {
 	        colSet_p[i]->remove (nrrow);
 	    }
 	}
@@ -287,7 +287,7 @@ void StManColumn::putScalarColumnCellsV (const RefRows& rownrs,
 }
 
 //# Call the correct getBlockX function depending on the data type.
-uInt StManColumn::getBlockV (uInt rownr, uInt nrmax, void* dataPtr)
+uInt StManColumn::getBlockV (rownr_t rownr, uInt nrmax, void* dataPtr)
 {
     switch (dtype_p) {
     case TpBool:
@@ -322,7 +322,7 @@ uInt StManColumn::getBlockV (uInt rownr, uInt nrmax, void* dataPtr)
 }
 
 //# Call the correct putBlockX function depending on the data type.
-void StManColumn::putBlockV (uInt rownr, uInt nrmax, const void* dataPtr)
+void StManColumn::putBlockV (rownr_t rownr, uInt nrmax, const void* dataPtr)
 {
     switch (dtype_p) {
     case TpBool:
@@ -367,7 +367,7 @@ void StManColumn::putBlockV (uInt rownr, uInt nrmax, const void* dataPtr)
 }
 
 //# Call the correct getArrayX function depending on the data type.
-void StManColumn::getArrayV (uInt rownr, void* dataPtr)
+void StManColumn::getArrayV (rownr_t rownr, void* dataPtr)
 {
     switch (dtype_p) {
     case TpBool:
@@ -412,7 +412,7 @@ void StManColumn::getArrayV (uInt rownr, void* dataPtr)
 }
 
 //# Call the correct putArrayX function depending on the data type.
-void StManColumn::putArrayV (uInt rownr, const void* dataPtr)
+void StManColumn::putArrayV (rownr_t rownr, const void* dataPtr)
 {
     switch (dtype_p) {
     case TpBool:
@@ -457,7 +457,7 @@ void StManColumn::putArrayV (uInt rownr, const void* dataPtr)
 }
 
 //# Call the correct getColumnSliceX function depending on the data type.
-void StManColumn::getSliceV (uInt rownr, const Slicer& ns, void* dataPtr)
+void StManColumn::getSliceV (rownr_t rownr, const Slicer& ns, void* dataPtr)
 {
     switch (dtype_p) {
     case TpBool:
@@ -502,7 +502,7 @@ void StManColumn::getSliceV (uInt rownr, const Slicer& ns, void* dataPtr)
 }
 
 //# Call the correct putSliceX function depending on the data type.
-void StManColumn::putSliceV (uInt rownr, const Slicer& ns, const void* dataPtr)
+void StManColumn::putSliceV (rownr_t rownr, const Slicer& ns, const void* dataPtr)
 {
     switch (dtype_p) {
     case TpBool:
@@ -945,7 +945,7 @@ void StManColumn::aips_name2(putScalarColumn,NM) (const Vector<T>* dataPtr) \
     dataPtr->freeStorage (data, deleteIt); \
 } \
 uInt StManColumn::aips_name2(getBlock,NM) \
-                                 (uInt rownr, uInt nrmax, T* dataPtr) \
+                                 (rownr_t rownr, uInt nrmax, T* dataPtr) \
 { \
     if (nrmax > 0) { \
 	aips_name2(get,NM) (rownr, dataPtr); \
@@ -954,20 +954,20 @@ uInt StManColumn::aips_name2(getBlock,NM) \
     return 0; \
 } \
 void StManColumn::aips_name2(putBlock,NM) \
-                                 (uInt rownr, uInt nrmax, const T* dataPtr) \
+                                 (rownr_t rownr, uInt nrmax, const T* dataPtr) \
 { \
     while (nrmax > 0) { \
 	aips_name2(put,NM) (rownr++, dataPtr++); \
 	nrmax--; \
     } \
 } \
-void StManColumn::aips_name2(getArray,NM) (uInt, Array<T>*) \
+void StManColumn::aips_name2(getArray,NM) (rownr_t, Array<T>*) \
     { throwInvalidOp("getArray" #NM); } \
-void StManColumn::aips_name2(putArray,NM) (uInt, const Array<T>*) \
+void StManColumn::aips_name2(putArray,NM) (rownr_t, const Array<T>*) \
     { throwInvalidOp("putArray" #NM); } \
-void StManColumn::aips_name2(getSlice,NM) (uInt, const Slicer&, Array<T>*) \
+void StManColumn::aips_name2(getSlice,NM) (rownr_t, const Slicer&, Array<T>*) \
     { throwInvalidOp("getSlice" #NM); } \
-void StManColumn::aips_name2(putSlice,NM) (uInt, const Slicer&, const Array<T>*) \
+void StManColumn::aips_name2(putSlice,NM) (rownr_t, const Slicer&, const Array<T>*) \
     { throwInvalidOp("putSlice" #NM); } \
 void StManColumn::aips_name2(getArrayColumn,NM) (Array<T>*) \
     { throwInvalidOp("getArrayColumn" #NM); } \
@@ -985,9 +985,9 @@ void StManColumn::aips_name2(getScalarColumnCells,NM) \
     uInt i=0; \
     RefRowsSliceIter rowiter(rownrs); \
     while (! rowiter.pastEnd()) { \
-        uInt rownr = rowiter.sliceStart(); \
-        uInt end = rowiter.sliceEnd(); \
-        uInt incr = rowiter.sliceIncr(); \
+        rownr_t rownr = rowiter.sliceStart(); \
+        rownr_t end = rowiter.sliceEnd(); \
+        rownr_t incr = rowiter.sliceIncr(); \
         while (rownr <= end) { \
 	    aips_name2(get,NM) (rownr, &(value(i++))); \
             rownr += incr; \
@@ -1003,9 +1003,9 @@ void StManColumn::aips_name2(putScalarColumnCells,NM) \
     uInt i=0; \
     RefRowsSliceIter rowiter(rownrs); \
     while (! rowiter.pastEnd()) { \
-        uInt rownr = rowiter.sliceStart(); \
-        uInt end = rowiter.sliceEnd(); \
-        uInt incr = rowiter.sliceIncr(); \
+        rownr_t rownr = rowiter.sliceStart(); \
+        rownr_t end = rowiter.sliceEnd(); \
+        rownr_t incr = rowiter.sliceIncr(); \
         while (rownr <= end) { \
 	    aips_name2(put,NM) (rownr, &(value(i++))); \
             rownr += incr; \
@@ -1021,9 +1021,9 @@ void StManColumn::aips_name2(getArrayColumnCells,NM) \
     ArrayIterator<T> iter(value, value.ndim()-1); \
     RefRowsSliceIter rowiter(rownrs); \
     while (! rowiter.pastEnd()) { \
-        uInt rownr = rowiter.sliceStart(); \
-        uInt end = rowiter.sliceEnd(); \
-        uInt incr = rowiter.sliceIncr(); \
+        rownr_t rownr = rowiter.sliceStart(); \
+        rownr_t end = rowiter.sliceEnd(); \
+        rownr_t incr = rowiter.sliceIncr(); \
         while (rownr <= end) { \
             if (! isFixedShape()) { \
                 if (! iter.array().shape().isEqual (shape(rownr))) { \
@@ -1046,9 +1046,9 @@ void StManColumn::aips_name2(putArrayColumnCells,NM) \
     ReadOnlyArrayIterator<T> iter(value, value.ndim()-1); \
     RefRowsSliceIter rowiter(rownrs); \
     while (! rowiter.pastEnd()) { \
-        uInt rownr = rowiter.sliceStart(); \
-        uInt end = rowiter.sliceEnd(); \
-        uInt incr = rowiter.sliceIncr(); \
+        rownr_t rownr = rowiter.sliceStart(); \
+        rownr_t end = rowiter.sliceEnd(); \
+        rownr_t incr = rowiter.sliceIncr(); \
         while (rownr <= end) { \
   	    aips_name2(putArray,NM) (rownr, &(iter.array())); \
             rownr += incr; \
@@ -1066,9 +1066,9 @@ void StManColumn::aips_name2(getColumnSliceCells,NM) \
     ArrayIterator<T> iter(value, value.ndim()-1); \
     RefRowsSliceIter rowiter(rownrs); \
     while (! rowiter.pastEnd()) { \
-        uInt rownr = rowiter.sliceStart(); \
-        uInt end = rowiter.sliceEnd(); \
-        uInt incr = rowiter.sliceIncr(); \
+        rownr_t rownr = rowiter.sliceStart(); \
+        rownr_t end = rowiter.sliceEnd(); \
+        rownr_t incr = rowiter.sliceIncr(); \
         while (rownr <= end) { \
 	    aips_name2(getSlice,NM) (rownr, ns, &(iter.array())); \
             rownr += incr; \
@@ -1086,9 +1086,9 @@ void StManColumn::aips_name2(putColumnSliceCells,NM) \
     ReadOnlyArrayIterator<T> iter(value, value.ndim()-1); \
     RefRowsSliceIter rowiter(rownrs); \
     while (! rowiter.pastEnd()) { \
-        uInt rownr = rowiter.sliceStart(); \
-        uInt end = rowiter.sliceEnd(); \
-        uInt incr = rowiter.sliceIncr(); \
+        rownr_t rownr = rowiter.sliceStart(); \
+        rownr_t end = rowiter.sliceEnd(); \
+        rownr_t incr = rowiter.sliceIncr(); \
         while (rownr <= end) { \
 	    aips_name2(putSlice,NM) (rownr, ns, &(iter.array())); \
             rownr += incr; \
@@ -1117,7 +1117,7 @@ STMANCOLUMN_GETPUT(String,StringV)
     uInt nr = rownrs.nelements(); \
 Timer timer; \
     for (uInt i=0; i<nr; i++) { \
-	uInt rownr = rownrs(i); \
+	rownr_t rownr = rownrs(i); \
 	Int off = cachePtr->offset(rownr); \
 	if (off >= 0) { \
 	    value(i) = ((T*)(cachePtr->dataPtr()))[off]; \
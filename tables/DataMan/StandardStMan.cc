@@ -42,6 +42,11 @@ StandardStMan::StandardStMan (const String& dataManagerName,
 : SSMBase (dataManagerName, bucketSize, cacheSize)
 {}
 
+StandardStMan::StandardStMan (const String& dataManagerName,
+			      const Record& spec)
+: SSMBase (dataManagerName, spec)
+{}
+
 StandardStMan::~StandardStMan()
 {}
 
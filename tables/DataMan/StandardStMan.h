@@ -106,6 +106,27 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // <p>
 // As said above all string arrays and variable length scalar strings
 // are stored in separate string buckets. 
+// <p>
+// Scalar string columns containing few distinct values (e.g. the
+// names of polarizations, observing modes, or sources) can be
+// dictionary encoded. Each distinct value is stored once in a dictionary
+// and a row contains the index (code) of its value in the dictionary,
+// taking 4 bytes per row. The columns to encode have to be given in
+// field DICTIONARYCOLUMNS of the specification record.
+// The dictionary is kept in memory and written with the index, so it
+// should not be used for columns with many distinct values.
+// <br>The dictionary and codes are available through
+// <src>TableColumn::getDictionary</src> and
+// <src>TableColumn::getDictCodes</src>. TaQL uses them to evaluate
+// string comparisons and regular expression matches on such a column
+// once per dictionary entry instead of once per row.
+// <p>
+// For numeric scalar columns a zone map can be kept, which holds the
+// minimum and maximum value in each data bucket. It is used by a
+// selection to skip the buckets where the predicate cannot be true.
+// The columns have to be given in field ZONEMAPCOLUMNS of the
+// specification record. Note that a table containing zone maps cannot
+// be read by casacore versions older than the one introducing them.
 // </synopsis>
 
 // <motivation>
@@ -139,6 +160,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //   newtab.bindAll ("column1", stman);       // bind all columns to st.man.
 //   Table tab(newtab);                       // actually create table
 // </srcblock>
+//
+// The following example shows how to dictionary encode a string column.
+// <srcblock>
+//   Record spec;
+//   spec.define ("DICTIONARYCOLUMNS", Vector<String>(1, "OBS_MODE"));
+//   StandardStMan stman("SSM", spec);
+//   SetupNewTable newtab("name.data", tableDesc, Table::New);
+//   newtab.bindAll (stman);
+//   Table tab(newtab);
+// </srcblock>
 // </example>
 
 //# <todo asof="$DATE:$">
@@ -176,6 +207,12 @@ public:
 			    uInt cacheSize = 1);
     // </group>
 
+    // Create a Standard storage manager with the given name.
+    // The specifications are given in the record (as created by
+    // dataManagerSpec), e.g. BUCKETSIZE, DICTIONARYCOLUMNS and
+    // ZONEMAPCOLUMNS.
+    StandardStMan (const String& dataManagerName, const Record& spec);
+
     ~StandardStMan();
 
 private:
@@ -0,0 +1,259 @@
+//# TSMCodec.cc: Lossless compression of tiles in the Tiled Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/DataMan/TSMCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/OS/CanonicalConversion.h>
+#include <casacore/casa/string.h>
+#include <vector>
+#include <algorithm>
+#ifdef HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The methods stored in the header of a tile.
+enum TSMCodecMethod {TSMCodecRaw=0, TSMCodecShuffleZlib=1,
+                     TSMCodecConstant=2};
+
+
+String TSMCodec::checkName (const String& name)
+{
+  String codec (name);
+  codec.downcase();
+  if (codec.empty()  ||  codec == "none") {
+    return String();
+  }
+  if (codec == "sparse") {
+    return codec;
+  }
+  if (codec == "shuffle-zlib") {
+#ifdef HAVE_ZLIB
+    return codec;
+#else
+    throw TSMError ("TSM compression codec " + name +
+                    " is not available (casacore built without zlib)");
+#endif
+  }
+  throw TSMError ("Unknown TSM compression codec " + name);
+}
+
+uInt TSMCodec::compress (const String& codec, char* out,
+                         const char* in, uInt length,
+                         const Block<uInt>& blockOffset,
+                         const Block<uInt>& valueSize)
+{
+  // A tile with constant values is stored in a few bytes for any codec.
+  uInt clen = compressConstant (out, in, length, blockOffset, valueSize);
+  if (clen > 0) {
+    return clen;
+  }
+  char* data = out + headerSize();
+#ifdef HAVE_ZLIB
+  if (codec == "shuffle-zlib") {
+    std::vector<char> buf(length);
+    shuffle (buf.data(), in, length, blockOffset, valueSize);
+    // Only use the result if it is smaller than the original.
+    // Use the fastest level, because IO speed is what matters.
+    uLongf destLen = length;
+    if (compress2 ((Bytef*)data, &destLen, (const Bytef*)(buf.data()),
+                   length, Z_BEST_SPEED) == Z_OK
+        &&  destLen < length) {
+      putHeader (out, destLen + headerSize(), TSMCodecShuffleZlib);
+      return destLen + headerSize();
+    }
+  }
+#else
+  (void)codec;
+  (void)blockOffset;
+  (void)valueSize;
+#endif
+  memcpy (data, in, length);
+  putHeader (out, length + headerSize(), TSMCodecRaw);
+  return length + headerSize();
+}
+
+void TSMCodec::decompress (char* out, uInt length, const char* in,
+                           const Block<uInt>& blockOffset,
+                           const Block<uInt>& valueSize)
+{
+  uInt inLength = compressedLength(in) - headerSize();
+  const char* data = in + headerSize();
+  switch (uChar(in[4])) {
+  case TSMCodecRaw:
+    if (inLength != length) {
+      throw TSMError ("TSMCodec::decompress: mismatching tile length");
+    }
+    memcpy (out, data, length);
+    break;
+  case TSMCodecShuffleZlib:
+    {
+#ifdef HAVE_ZLIB
+      std::vector<char> buf(length);
+      uLongf destLen = length;
+      if (uncompress ((Bytef*)(buf.data()), &destLen,
+                      (const Bytef*)data, inLength) != Z_OK
+          ||  destLen != length) {
+        throw TSMError ("TSMCodec::decompress: corrupt compressed tile");
+      }
+      unshuffle (out, buf.data(), length, blockOffset, valueSize);
+#else
+      (void)blockOffset;
+      (void)valueSize;
+      throw TSMError ("TSM tile is compressed with zlib, but casacore "
+                      "is built without zlib");
+#endif
+    }
+    break;
+  case TSMCodecConstant:
+    decompressConstant (out, length, data, inLength, blockOffset);
+    break;
+  default:
+    throw TSMError ("TSMCodec::decompress: unknown compression method");
+  }
+}
+
+uInt TSMCodec::compressConstant (char* out, const char* in, uInt length,
+                                 const Block<uInt>& blockOffset,
+                                 const Block<uInt>& valueSize)
+{
+  // Each block is stored as its period (1 byte) followed by the bytes
+  // of one period. Complex values have a period of twice the shuffle size.
+  uInt outLength = headerSize();
+  for (uInt b=0; b<blockOffset.nelements(); ++b) {
+    uInt start = blockOffset[b];
+    uInt end   = (b+1 < blockOffset.nelements()  ?  blockOffset[b+1] : length);
+    uInt len   = end - start;
+    uInt size  = std::max (valueSize[b], 1u);
+    const char* inb = in + start;
+    uInt period = 0;
+    for (uInt p=size; p<=2*size; p+=size) {
+      if (p >= len) {
+        period = len;
+        break;
+      }
+      if (memcmp (inb, inb+p, len-p) == 0) {
+        period = p;
+        break;
+      }
+    }
+    // Only use it if it takes (much) less space than the tile.
+    if ((period == 0  &&  len > 0)  ||  period > 255
+        ||  outLength + 1 + period >= length / 2) {
+      return 0;
+    }
+    out[outLength++] = period;
+    memcpy (out+outLength, inb, period);
+    outLength += period;
+  }
+  putHeader (out, outLength, TSMCodecConstant);
+  return outLength;
+}
+
+void TSMCodec::decompressConstant (char* out, uInt length,
+                                   const char* in, uInt inLength,
+                                   const Block<uInt>& blockOffset)
+{
+  uInt inx = 0;
+  for (uInt b=0; b<blockOffset.nelements(); ++b) {
+    uInt start = blockOffset[b];
+    uInt end   = (b+1 < blockOffset.nelements()  ?  blockOffset[b+1] : length);
+    uInt period = (inx < inLength  ?  uChar(in[inx++]) : 0);
+    if (inx + period > inLength  ||  (period == 0  &&  end > start)) {
+      throw TSMError ("TSMCodec::decompress: corrupt constant tile");
+    }
+    for (uInt i=start; i<end; i+=period) {
+      memcpy (out+i, in+inx, std::min (period, end-i));
+    }
+    inx += period;
+  }
+}
+
+uInt TSMCodec::compressedLength (const char* in)
+{
+  uInt length;
+  CanonicalConversion::toLocal (length, in);
+  return length;
+}
+
+void TSMCodec::putHeader (char* out, uInt length, uInt method)
+{
+  CanonicalConversion::fromLocal (out, length);
+  out[4] = method;
+  out[5] = out[6] = out[7] = 0;
+}
+
+void TSMCodec::shuffle (char* out, const char* in, uInt length,
+                        const Block<uInt>& blockOffset,
+                        const Block<uInt>& valueSize)
+{
+  for (uInt b=0; b<blockOffset.nelements(); ++b) {
+    uInt start = blockOffset[b];
+    uInt end   = (b+1 < blockOffset.nelements()  ?  blockOffset[b+1] : length);
+    uInt size  = valueSize[b];
+    uInt nval  = (size > 1  ?  (end-start) / size : 0);
+    if (nval == 0  ||  nval*size != end-start) {
+      memcpy (out+start, in+start, end-start);
+    } else {
+      // Byte j of value i goes to j*nval+i.
+      const char* inb = in + start;
+      for (uInt j=0; j<size; ++j) {
+        char* outb = out + start + j*nval;
+        for (uInt i=0; i<nval; ++i) {
+          outb[i] = inb[i*size + j];
+        }
+      }
+    }
+  }
+}
+
+void TSMCodec::unshuffle (char* out, const char* in, uInt length,
+                          const Block<uInt>& blockOffset,
+                          const Block<uInt>& valueSize)
+{
+  for (uInt b=0; b<blockOffset.nelements(); ++b) {
+    uInt start = blockOffset[b];
+    uInt end   = (b+1 < blockOffset.nelements()  ?  blockOffset[b+1] : length);
+    uInt size  = valueSize[b];
+    uInt nval  = (size > 1  ?  (end-start) / size : 0);
+    if (nval == 0  ||  nval*size != end-start) {
+      memcpy (out+start, in+start, end-start);
+    } else {
+      char* outb = out + start;
+      for (uInt j=0; j<size; ++j) {
+        const char* inb = in + start + j*nval;
+        for (uInt i=0; i<nval; ++i) {
+          outb[i*size + j] = inb[i];
+        }
+      }
+    }
+  }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,158 @@
+//# TSMCodec.h: Lossless compression of tiles in the Tiled Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TSMCODEC_H
+#define TABLES_TSMCODEC_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/BasicSL/String.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Lossless compression of tiles in the Tiled Storage Manager
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTSMCodec.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TSMCube>TSMCube</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TSMCodec compresses and decompresses the tiles of a hypercube in the
+// Tiled Storage Manager. It operates on a tile in external (canonical)
+// format, which consists of a consecutive block of data for each data
+// column in the hypercube.
+// <p>
+// The following codecs are supported:
+// <ul>
+//  <li> <src>none</src> (or an empty string) does not compress the tiles.
+//  <li> <src>shuffle-zlib</src> first shuffles the bytes of the data
+//       values in a column block, thus stores the first bytes of all values,
+//       thereafter the second bytes, etc. Because nearby values usually
+//       have the same high order bytes, this makes the data much better
+//       compressible. Thereafter the data are compressed with zlib (deflate).
+//       It is only available if casacore was built with zlib.
+//  <li> <src>sparse</src> does not compress the tiles, but only stores
+//       the tiles that have been written and elides constant tiles
+//       (see below). It is meant for columns like MODEL_DATA, which are
+//       often added to a table, but hardly used.
+// </ul>
+// A compressed tile starts with a header of <src>headerSize()</src> bytes
+// holding the total length and the method used. If compression does not
+// reduce the size of a tile, it is stored uncompressed.
+// <br>For all codecs a tile in which the values of each column block are
+// the same (e.g. all zeroes or all flags set) is stored as a constant tile,
+// thus only the header and a single value per block.
+// Furthermore, a tile that has never been written is not stored at all
+// (see <linkto class=BucketCache>BucketCache</linkto>), which makes
+// adding a large column to a table effectively instantaneous.
+// Thus the length of a compressed tile never exceeds the tile size plus
+// the header size.
+// </synopsis>
+
+// <motivation>
+// Columns like FLAG and WEIGHT_SPECTRUM in a MeasurementSet compress very
+// well, so compression reduces disk usage and IO considerably.
+// </motivation>
+
+class TSMCodec
+{
+public:
+    // Check if the codec name is valid and available.
+    // It returns the name in standard (lowercase) form, where
+    // <src>none</src> is returned as an empty string.
+    // An exception is thrown if invalid or not available.
+    static String checkName (const String& name);
+
+    // Get the size of the header of a compressed tile.
+    static uInt headerSize()
+      { return 8; }
+
+    // Compress a tile (in canonical format) of the given length.
+    // The tile consists of blocks starting at the given offsets, where
+    // the values in each block have the given size (shuffle size).
+    // No shuffling is done for a size <= 1.
+    // <br>The output buffer must have a length of at least
+    // <src>length + headerSize()</src>.
+    // The length of the compressed tile (including header) is returned.
+    static uInt compress (const String& codec, char* out,
+                          const char* in, uInt length,
+                          const Block<uInt>& blockOffset,
+                          const Block<uInt>& valueSize);
+
+    // Decompress a tile into the output buffer of the given length.
+    // The block offsets and value sizes must match the ones used
+    // in compression.
+    static void decompress (char* out, uInt length, const char* in,
+                            const Block<uInt>& blockOffset,
+                            const Block<uInt>& valueSize);
+
+    // Get the length (including header) of a compressed tile.
+    static uInt compressedLength (const char* in);
+
+    // Store a tile as a constant tile if the bytes of each column block
+    // repeat with a period of the value size (or twice the value size
+    // for complex values).
+    // It returns the length of the result, which is 0 if the tile
+    // is not constant.
+    static uInt compressConstant (char* out, const char* in, uInt length,
+                                  const Block<uInt>& blockOffset,
+                                  const Block<uInt>& valueSize);
+
+private:
+    // Shuffle or unshuffle the blocks in a tile.
+    // <group>
+    static void shuffle (char* out, const char* in, uInt length,
+                         const Block<uInt>& blockOffset,
+                         const Block<uInt>& valueSize);
+    static void unshuffle (char* out, const char* in, uInt length,
+                           const Block<uInt>& blockOffset,
+                           const Block<uInt>& valueSize);
+    // </group>
+
+    // Expand a constant tile (without header).
+    static void decompressConstant (char* out, uInt length,
+                                    const char* in, uInt inLength,
+                                    const Block<uInt>& blockOffset);
+
+    // Store the header.
+    static void putHeader (char* out, uInt length, uInt method);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -32,8 +32,12 @@
 #include <casacore/tables/DataMan/TiledStMan.h>
 #include <casacore/tables/DataMan/TSMFile.h>
 #include <casacore/tables/DataMan/TSMColumn.h>
+#include <casacore/tables/DataMan/TSMDataColumn.h>
+#include <casacore/tables/DataMan/TSMCodec.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Containers/RecordField.h>
 #include <casacore/casa/Containers/Block.h>
@@ -44,6 +48,8 @@
 #include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/string.h>                           // for memcpy
 #include <casacore/casa/iostream.h>
+#include <vector>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -96,6 +102,8 @@ TSMCube::TSMCube (TiledStMan* stman, TSMFile* file,
   lastColAccess_p(NoAccess)
 {
     if (fileOffset < 0) {
+        // A new hypercube uses the compression set in the storage manager.
+        compress_p = stman->compression();
         // TiledCellStMan uses an empty shape; setShape is called later. 
         if (! cubeShape.empty()) {
             // A shape is given, so set it.
@@ -258,6 +266,8 @@ void TSMCube::setShape (const IPosition& cubeShape, const IPosition& tileShape)
     // So delete it first.
     deleteCache();
     fileOffset_p = filePtr_p->length();
+    tileOffsets_p.resize (0);
+    tileLengths_p.resize (0);
     nrdim_p      = cubeShape.nelements();
     // Resize the tile section member variables used in accessSection()
     resizeTileSections();
@@ -272,7 +282,10 @@ void TSMCube::setShape (const IPosition& cubeShape, const IPosition& tileShape)
       makeCache();
     }
     // Tell TSMFile that the file gets extended.
-    filePtr_p->extend (nrTiles_p * bucketSize_p);
+    // Compressed tiles are allocated when written.
+    if (compress_p.empty()) {
+        filePtr_p->extend (nrTiles_p * bucketSize_p);
+    }
     // Initialize the coordinate columns (as far as needed).
     stmanPtr_p->initCoordinates (this);
     // Set flag if writing.
@@ -285,8 +298,12 @@ void TSMCube::putObject (AipsIO& ios)
     flushCache();
     // If the offset is small enough, write it as an old style file,
     // so older software can still read it.
+    // Compressed tiles need version 3.
     Bool vers1 = (fileOffset_p <= 2u*1024u*1024u*1024u);
-    if (vers1) {
+    if (! compress_p.empty()) {
+        vers1 = False;
+        ios << 3;                          // version 3
+    } else if (vers1) {
         ios << 1;                          // version 1
     } else {
         ios << 2;                          // version 2
@@ -306,6 +323,18 @@ void TSMCube::putObject (AipsIO& ios)
     } else {
 	ios << fileOffset_p;
     }
+    if (! compress_p.empty()) {
+        // Write the index of the compressed tiles.
+        if (cache_p != 0) {
+            tileOffsets_p = cache_p->bucketOffsets();
+            tileLengths_p = cache_p->bucketLengths();
+        }
+        uInt nrTiles = std::min (nrTiles_p, uInt(tileOffsets_p.nelements()));
+        ios << compress_p;
+        ios << nrTiles;
+        ios.put (nrTiles, tileOffsets_p.storage(), False);
+        ios.put (nrTiles, tileLengths_p.storage(), False);
+    }
 }
 Int TSMCube::getObject (AipsIO& ios)
 {
@@ -325,6 +354,16 @@ Int TSMCube::getObject (AipsIO& ios)
     } else {
         ios >> fileOffset_p;
     }
+    compress_p = String();
+    if (version >= 3) {
+        uInt nrTiles;
+        ios >> compress_p;
+        ios >> nrTiles;
+        tileOffsets_p.resize (nrTiles, True, False);
+        tileLengths_p.resize (nrTiles, True, False);
+        ios.get (nrTiles, tileOffsets_p.storage());
+        ios.get (nrTiles, tileLengths_p.storage());
+    }
     return fileSeqnr;
 }
 
@@ -350,6 +389,26 @@ void TSMCube::setup()
     bucketSize_p = stmanPtr_p->getLengthOffset (tileSize_p, externalOffset_p,
 						localOffset_p,
 						localTileLength_p);
+    if (! compress_p.empty()) {
+        // Check if the codec can be used and determine the value size
+        // of each data column. Complex values are shuffled as 2 reals.
+        TSMCodec::checkName (compress_p);
+        uInt nrcol = externalOffset_p.nelements();
+        shuffleSize_p.resize (nrcol);
+        for (uInt i=0; i<nrcol; i++) {
+            uInt end = (i+1 < nrcol  ?  externalOffset_p[i+1] : bucketSize_p);
+            uInt len = end - externalOffset_p[i];
+            uInt size = 0;
+            if (tileSize_p > 0  &&  len % tileSize_p == 0) {
+                size = len / tileSize_p;
+                int dtype = stmanPtr_p->getDataColumn(i)->dataType();
+                if (dtype == TpComplex  ||  dtype == TpDComplex) {
+                    size /= 2;
+                }
+            }
+            shuffleSize_p[i] = size;
+        }
+    }
 
     // Resize IPosition member variables used in accessSection()
     resizeTileSections();
@@ -374,10 +433,21 @@ void TSMCube::makeCache()
 {
     // If there is no cache, make one with initially 1 slot.
     if (cache_p == 0) {
-        cache_p = new BucketCache (filePtr_p->bucketFile(), fileOffset_p,
-                                   bucketSize_p, nrTiles_p, 1, this,
-                                   readCallBack, writeCallBack,
-                                   initCallBack, deleteCallBack);
+        if (compress_p.empty()) {
+            cache_p = new BucketCache (filePtr_p->bucketFile(), fileOffset_p,
+                                       bucketSize_p, nrTiles_p, 1, this,
+                                       readCallBack, writeCallBack,
+                                       initCallBack, deleteCallBack);
+        } else {
+            // A compressed tile can be somewhat larger than the tile.
+            cache_p = new BucketCache (filePtr_p->bucketFile(), fileOffset_p,
+                                       bucketSize_p + TSMCodec::headerSize(),
+                                       nrTiles_p, 1, this,
+                                       readCallBack, writeCallBack,
+                                       initCallBack, deleteCallBack);
+            cache_p->setVariableLength (tileOffsets_p, tileLengths_p,
+                                        lengthCallBack, allocateCallBack);
+        }
     }
 }
 
@@ -392,6 +462,10 @@ void TSMCube::resyncCache()
 {
     if (cache_p != 0) {
       cache_p->resync (nrTiles_p, 0, -1);
+      if (! compress_p.empty()) {
+        cache_p->setVariableLength (tileOffsets_p, tileLengths_p,
+                                    lengthCallBack, allocateCallBack);
+      }
     }
 }
 
@@ -424,7 +498,9 @@ void TSMCube::extend (uInt nr, const Record& coordValues,
                              / tileShape_p(lastDim);
     nrTiles_p = nrTilesSubCube_p * tilesPerDim_p(lastDim);
     getCache()->extend (nrTiles_p - nrold);
-    filePtr_p->extend ((nrTiles_p - nrold) * bucketSize_p);
+    if (compress_p.empty()) {
+        filePtr_p->extend ((nrTiles_p - nrold) * bucketSize_p);
+    }
     // Update the last coordinate (if there).
     if (lastCoordColumn != 0) {
         extendCoordinates (coordValues, lastCoordColumn->columnName(),
@@ -669,15 +745,28 @@ char* TSMCube::readTile (const char* external)
 {
     char* local = 0;
 
-    if (cachedTile_p != 0){
+    // Tiles can be read in parallel (see BucketCache::readBuckets).
+#ifdef _OPENMP
+#pragma omp critical(TSMCube_cachedTile)
+#endif
+    {
         local = cachedTile_p;
         cachedTile_p = 0;
-    } else {
+    }
+    if (local == 0) {
         local = new char[localTileLength_p];
     }
 
-    stmanPtr_p->readTile (local, localOffset_p, external, externalOffset_p,
-			  tileSize_p);
+    if (compress_p.empty()) {
+        stmanPtr_p->readTile (local, localOffset_p, external,
+                              externalOffset_p, tileSize_p);
+    } else {
+        std::vector<char> buf(bucketSize_p);
+        TSMCodec::decompress (buf.data(), bucketSize_p, external,
+                              externalOffset_p, shuffleSize_p);
+        stmanPtr_p->readTile (local, localOffset_p, buf.data(),
+                              externalOffset_p, tileSize_p);
+    }
     return local;
 }
 void TSMCube::writeCallBack (void* owner, char* external, const char* local)
@@ -686,8 +775,28 @@ void TSMCube::writeCallBack (void* owner, char* external, const char* local)
 }
 void TSMCube::writeTile (char* external, const char* local)
 {
-    stmanPtr_p->writeTile (external, externalOffset_p, local, localOffset_p,
-			   tileSize_p);
+    if (compress_p.empty()) {
+        stmanPtr_p->writeTile (external, externalOffset_p, local,
+                               localOffset_p, tileSize_p);
+    } else {
+        std::vector<char> buf(bucketSize_p);
+        stmanPtr_p->writeTile (buf.data(), externalOffset_p, local,
+                               localOffset_p, tileSize_p);
+        TSMCodec::compress (compress_p, external, buf.data(), bucketSize_p,
+                            externalOffset_p, shuffleSize_p);
+    }
+}
+uInt TSMCube::lengthCallBack (void*, const char* external)
+{
+    return TSMCodec::compressedLength (external);
+}
+Int64 TSMCube::allocateCallBack (void* owner, uInt length)
+{
+    // Compressed tiles are appended to the file.
+    TSMFile* file = ((TSMCube*)owner)->filePtr_p;
+    Int64 offset = file->length();
+    file->extend (length);
+    return offset;
 }
 void TSMCube::deleteCallBack (void* owner, char* buffer)
 {
@@ -706,6 +815,42 @@ char* TSMCube::initCallBack (void* owner)
     return buffer;
 }
 
+void TSMCube::recordAccess (const IPosition& start, const IPosition& end)
+{
+    if (! stmanPtr_p->recordAccess()) {
+        return;
+    }
+    IPosition shape = end - start + 1;
+    for (size_t i=0; i<accessPatterns_p.size(); ++i) {
+        if (accessPatterns_p[i].first.isEqual (shape)) {
+            accessPatterns_p[i].second++;
+            return;
+        }
+    }
+    if (accessPatterns_p.size() < 256) {
+        accessPatterns_p.push_back (std::make_pair (shape, uInt64(1)));
+    }
+}
+
+Record TSMCube::accessPatterns() const
+{
+    Matrix<Int> shapes(nrdim_p, accessPatterns_p.size());
+    Vector<Int64> counts(accessPatterns_p.size());
+    for (size_t i=0; i<accessPatterns_p.size(); ++i) {
+        shapes.column(i) = accessPatterns_p[i].first.asVector();
+        counts[i] = accessPatterns_p[i].second;
+    }
+    Record rec;
+    rec.define ("SHAPES", shapes);
+    rec.define ("COUNTS", counts);
+    return rec;
+}
+
+void TSMCube::clearAccessPatterns()
+{
+    accessPatterns_p.clear();
+}
+
 uInt TSMCube::cacheSize() const
 {
     if (cache_p == 0) {
@@ -912,7 +1057,7 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
 	stmanPtr_p->setDataChanged();
     }
     // Prepare for the iteration through the necessary tiles.
-    uInt i, j;
+    uInt i;
 
     // Initialize the various variables and determine the number of
     // tiles needed (which will determine the cache size).
@@ -946,6 +1091,12 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     }
     // Get the cache.
     BucketCache* cachePtr = getCache();
+    // Read the tiles in parallel if possible.
+    uInt nthreads = 1;
+    if (!oneEntireTile  &&  !writeFlag) {
+        nthreads = readTilesParallel (cachePtr, start, end,
+                                      IPosition(nrdim_p, 1));
+    }
     
 //    cout << "nrTileSection_p=" << nrTileSection_p << endl;
 //    cout << "startTile_p=" << startTile_p << endl;
@@ -1000,12 +1151,9 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     IPosition tilePos    (startTile_p);
     IPosition tileIncr = 
       expandedTilesPerDim_p.offsetIncrement (nrTileSection_p);
-    IPosition dataLength(nrdim_p);
-    IPosition dataPos   (nrdim_p);
-    IPosition sectionPos(nrdim_p);
-    uInt dataOffset;
-    size_t sectionOffset;
     uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
+    // If the tiles are copied in parallel, first collect the tile parts.
+    std::vector<TilePart> tileParts;
 
     while (True) {
 //      cout << "tilePos=" << tilePos << endl;
@@ -1018,59 +1166,17 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
         if (writeFlag) {
             cachePtr->setDirty();
         }
-
-        // At this point we start looping through all pixels in the tile.
-        // We do a vector at a time.
-        // Calculate the start and end pixel in the tile.
-        // Initialize the pixel position in the data and section.
-        for (i=0; i<nrdim_p; i++) {
-            dataLength(i) = 1 + endPixel(i) - startPixel(i);
-            dataPos(i)    = startPixel(i);
-            sectionPos(i) = tilePos(i) * tileShape_p(i)
-                            + startPixel(i) - startSection(i);
-        }
-        dataOffset = pixelOffset + localPixelSize *
-                            expandedTileShape_p.offset (startPixel);
-        sectionOffset = localPixelSize *
-                            expandedSectionShape.offset (sectionPos);
-        IPosition dataIncr    = localPixelSize *
-                            expandedTileShape_p.offsetIncrement (dataLength);
-        IPosition sectionIncr = localPixelSize *
-                            expandedSectionShape.offsetIncrement (dataLength);
-
-        while (True) {
-            uInt localSize = dataLength(0) * localPixelSize;
-            /* merge zero increments into one copy */
-            for (j = 1; j < nrdim_p; j++) {
-                if (dataIncr(j) == 0 && sectionIncr(j) == 0) {
-                    localSize *= dataLength(j);
-                    dataPos(j) = endPixel(j);
-                }
-                else {
-                    break;
-                }
-            }
-
-            if (writeFlag) {
-                TSMCube_MoveData(dataArray + dataOffset,
-                                 section + sectionOffset, localSize);
-            } else {
-                TSMCube_MoveData(section + sectionOffset,
-                                 dataArray + dataOffset, localSize);
-            }
-            dataOffset += localSize;
-            sectionOffset += localSize;
-            for (j = 1; j < nrdim_p; j++) {
-                dataOffset += dataIncr(j);
-                sectionOffset += sectionIncr(j);
-                if (++dataPos(j) <= endPixel(j)) {
-                    break;
-                }
-                dataPos(j) = startPixel(j);
-            }
-            if (j == nrdim_p) {
-                break;
-            }
+        if (nthreads > 1) {
+            TilePart part;
+            part.dataArray  = dataArray;
+            part.tilePos    = tilePos;
+            part.startPixel = startPixel;
+            part.endPixel   = endPixel;
+            tileParts.push_back (part);
+        } else {
+            copyTilePart (section, dataArray, expandedSectionShape,
+                          startSection, tilePos, startPixel, endPixel,
+                          pixelOffset, localPixelSize, writeFlag);
         }
 
         // Determine the next tile to access and the starting and
@@ -1096,6 +1202,136 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
             break;                                     // ready
         }
     }
+    // Copy the tile parts in parallel. All tiles are in the cache,
+    // so their data pointers are valid.
+    if (nthreads > 1) {
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+        for (Int k=0; k<Int(tileParts.size()); ++k) {
+            const TilePart& part = tileParts[k];
+            copyTilePart (section, part.dataArray, expandedSectionShape,
+                          startSection, part.tilePos, part.startPixel,
+                          part.endPixel, pixelOffset, localPixelSize,
+                          writeFlag);
+        }
+    }
+}
+
+void TSMCube::copyTilePart (char* section, char* dataArray,
+                            const TSMShape& expandedSectionShape,
+                            const IPosition& startSection,
+                            const IPosition& tilePos,
+                            const IPosition& startPixel,
+                            const IPosition& endPixel,
+                            uInt pixelOffset, uInt localPixelSize,
+                            Bool writeFlag) const
+{
+    // At this point we start looping through all pixels in the tile.
+    // We do a vector at a time.
+    // Calculate the start and end pixel in the tile.
+    // Initialize the pixel position in the data and section.
+    uInt j;
+    IPosition dataLength(nrdim_p);
+    IPosition dataPos   (nrdim_p);
+    IPosition sectionPos(nrdim_p);
+    for (j=0; j<nrdim_p; j++) {
+        dataLength(j) = 1 + endPixel(j) - startPixel(j);
+        dataPos(j)    = startPixel(j);
+        sectionPos(j) = tilePos(j) * tileShape_p(j)
+                        + startPixel(j) - startSection(j);
+    }
+    uInt dataOffset = pixelOffset + localPixelSize *
+                        expandedTileShape_p.offset (startPixel);
+    size_t sectionOffset = localPixelSize *
+                        expandedSectionShape.offset (sectionPos);
+    IPosition dataIncr    = localPixelSize *
+                        expandedTileShape_p.offsetIncrement (dataLength);
+    IPosition sectionIncr = localPixelSize *
+                        expandedSectionShape.offsetIncrement (dataLength);
+
+    while (True) {
+        uInt localSize = dataLength(0) * localPixelSize;
+        /* merge zero increments into one copy */
+        for (j = 1; j < nrdim_p; j++) {
+            if (dataIncr(j) == 0 && sectionIncr(j) == 0) {
+                localSize *= dataLength(j);
+                dataPos(j) = endPixel(j);
+            }
+            else {
+                break;
+            }
+        }
+
+        if (writeFlag) {
+            TSMCube_MoveData(dataArray + dataOffset,
+                             section + sectionOffset, localSize);
+        } else {
+            TSMCube_MoveData(section + sectionOffset,
+                             dataArray + dataOffset, localSize);
+        }
+        dataOffset += localSize;
+        sectionOffset += localSize;
+        for (j = 1; j < nrdim_p; j++) {
+            dataOffset += dataIncr(j);
+            sectionOffset += sectionIncr(j);
+            if (++dataPos(j) <= endPixel(j)) {
+                break;
+            }
+            dataPos(j) = startPixel(j);
+        }
+        if (j == nrdim_p) {
+            break;
+        }
+    }
+}
+
+uInt TSMCube::readTilesParallel (BucketCache* cachePtr,
+                                 const IPosition& start,
+                                 const IPosition& end,
+                                 const IPosition& stride)
+{
+    uInt nthreads = stmanPtr_p->tsmOption().nthreads();
+    if (nthreads <= 1) {
+        return 1;
+    }
+    // Determine per axis the tiles containing pixels to access.
+    // Stop if more tiles than fit in the cache are needed.
+    std::vector<std::vector<uInt> > tilesPerAxis(nrdim_p);
+    size_t ntiles = 1;
+    for (uInt i=0; i<nrdim_p; i++) {
+        std::vector<uInt>& tiles = tilesPerAxis[i];
+        for (Int pix=start(i); pix<=end(i); pix+=stride(i)) {
+            uInt tile = pix / tileShape_p(i);
+            if (tiles.empty()  ||  tiles.back() != tile) {
+                tiles.push_back (tile);
+            }
+        }
+        ntiles *= tiles.size();
+    }
+    if (ntiles <= 1  ||  ntiles > cachePtr->cacheSize()) {
+        return 1;
+    }
+    // Form the tile numbers of all combinations of the tiles per axis.
+    Block<uInt> tileNrs(ntiles);
+    IPosition tilePos(nrdim_p);
+    std::vector<uInt> index(nrdim_p, 0);
+    for (size_t nr=0; nr<ntiles; ++nr) {
+        for (uInt i=0; i<nrdim_p; i++) {
+            tilePos(i) = tilesPerAxis[i][index[i]];
+        }
+        tileNrs[nr] = expandedTilesPerDim_p.offset (tilePos);
+        for (uInt i=0; i<nrdim_p; i++) {
+            if (++index[i] < tilesPerAxis[i].size()) {
+                break;
+            }
+            index[i] = 0;
+        }
+    }
+    if (! cachePtr->readBuckets (tileNrs, nthreads)) {
+        return 1;
+    }
+    return nthreads;
 }
 
 void TSMCube::accessLine (char* section, uInt pixelOffset,
@@ -1296,6 +1532,12 @@ void TSMCube::accessLine (char* section, uInt pixelOffset,
 }
 
 
+char* TSMCube::mapSection (const IPosition&, const IPosition&,
+                           uInt, uInt, uInt)
+{
+    return 0;
+}
+
 void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
                              const IPosition& stride,
                              char* section, uInt colnr,
@@ -1315,6 +1557,11 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
     uInt i, j;
     // Get the cache (if needed).
     BucketCache* cachePtr = getCache();
+    // Read the tiles in parallel if possible.
+    // Note that the strided copying is not done in parallel.
+    if (!writeFlag) {
+        readTilesParallel (cachePtr, start, end, stride);
+    }
 
     // A tile can contain more than one data array.
     // Each array is contiguous, so the first pixel of an array
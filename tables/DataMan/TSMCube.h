@@ -36,6 +36,8 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/iosfwd.h>
+#include <vector>
+#include <utility>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -169,9 +171,26 @@ public:
     // It is the length of a tile in external format.
     uInt bucketSize() const;
 
+    // Get the compression codec of the tiles (empty = no compression).
+    const String& compression() const;
+
     // Get the length of a tile (in bytes) in local format.
     uInt localTileLength() const;
 
+    // Record the shape of the section (given by its first and last pixel)
+    // accessed by a column if recording is switched on in the storage
+    // manager (see <src>TiledStMan::setRecordAccess</src>).
+    // At most 256 different shapes are recorded.
+    void recordAccess (const IPosition& start, const IPosition& end);
+
+    // Get the recorded section shapes and how often they were accessed.
+    // Field SHAPES is a Matrix<Int> containing a shape in each column;
+    // field COUNTS is a Vector<Int64> with the number of accesses.
+    Record accessPatterns() const;
+
+    // Clear the recorded section shapes.
+    void clearAccessPatterns();
+
     // Set the hypercube shape.
     // This is only possible if the shape was not defined yet.
     virtual void setShape (const IPosition& cubeShape,
@@ -228,6 +247,17 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Map the data of the given column in a section of the cube directly
+    // into memory, so it can be used without copying.
+    // It returns a pointer to the data which must be unmapped using
+    // <src>MMapfdIO::unmapRegion</src>.
+    // The external pixel size and required alignment of the data are given.
+    // A null pointer is returned if not possible, which is always the case
+    // for this base class.
+    virtual char* mapSection (const IPosition& start, const IPosition& end,
+                              uInt colnr, uInt externalPixelSize,
+                              uInt alignment);
+
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
@@ -333,6 +363,24 @@ private:
 		     uInt endPixelInLastTile,
 		     uInt lineIndex);
 
+    // Read the tiles needed for a (strided) section into the cache in
+    // parallel if multiple threads are to be used (see TSMOption) and if
+    // all tiles fit in the cache. It returns the number of threads to use
+    // to copy the data of the tiles (1 means sequentially).
+    uInt readTilesParallel (BucketCache* cachePtr, const IPosition& start,
+                            const IPosition& end, const IPosition& stride);
+
+    // Copy the data of the given part of a tile from or to the section.
+    // It can be used by multiple threads in parallel.
+    void copyTilePart (char* section, char* dataArray,
+                       const TSMShape& expandedSectionShape,
+                       const IPosition& startSection,
+                       const IPosition& tilePos,
+                       const IPosition& startPixel,
+                       const IPosition& endPixel,
+                       uInt pixelOffset, uInt localPixelSize,
+                       Bool writeFlag) const;
+
     // Define the callback functions for the BucketCache.
     // <group>
     static char* readCallBack (void* owner, const char* external);
@@ -342,6 +390,12 @@ private:
     static void deleteCallBack (void* owner, char* buffer);
     // </group>
 
+    // Define the callback functions for compressed (variable-length) tiles.
+    // <group>
+    static uInt lengthCallBack (void* owner, const char* external);
+    static Int64 allocateCallBack (void* owner, uInt length);
+    // </group>
+
     // Define the functions doing the actual read and write of the 
     // data in the tile and converting it to/from local format.
     // <group>
@@ -350,6 +404,14 @@ private:
     // </group>
 
 protected:
+    // The part of a tile to copy in accessSection.
+    struct TilePart {
+        char*     dataArray;
+        IPosition tilePos;
+        IPosition startPixel;
+        IPosition endPixel;
+    };
+
     //# Declare member variables.
 
     char * cachedTile_p; // optimization to hold one tile chunk
@@ -390,6 +452,13 @@ protected:
     Block<uInt>     localOffset_p;
     // The bucket size in bytes (is equal to tile size in bytes).
     uInt            bucketSize_p;
+    // The compression codec of the tiles (empty = no compression).
+    String          compress_p;
+    // The size of the values in each data column (used for shuffling).
+    Block<uInt>     shuffleSize_p;
+    // The file offset and length of each compressed tile.
+    Block<Int64>    tileOffsets_p;
+    Block<uInt>     tileLengths_p;
     // The tile size in bytes in local format.
     uInt            localTileLength_p;
     // The bucket cache.
@@ -400,6 +469,8 @@ protected:
     AccessType      lastColAccess_p;
     // The slice shape of the last column access to a slice.
     IPosition       lastColSlice_p;
+    // The section shapes accessed and their number of accesses.
+    std::vector<std::pair<IPosition,uInt64> > accessPatterns_p;
 
     // IPosition variables used in accessSection(); declared here
     // as member variables to avoid significant construction and
@@ -431,6 +502,10 @@ inline uInt TSMCube::bucketSize() const
 { 
     return bucketSize_p;
 }
+inline const String& TSMCube::compression() const
+{
+    return compress_p;
+}
 inline uInt TSMCube::localTileLength() const
 { 
     return localTileLength_p;
@@ -404,6 +404,37 @@ void TSMCubeMMap::accessSection (const IPosition& start, const IPosition& end,
   }
 }
 
+char* TSMCubeMMap::mapSection (const IPosition& start, const IPosition& end,
+                               uInt colnr, uInt externalPixelSize,
+                               uInt alignment)
+{
+  // Writable files are never mapped, because the data could change.
+  // Bool data are stored as bits, so cannot be used directly.
+  filePtr_p->open();
+  BucketFile* file = filePtr_p->bucketFile();
+  if (file->isWritable()  ||  !file->canReadParallel()
+  ||  externalPixelSize == 0) {
+    return 0;
+  }
+  // The section must be exactly one tile.
+  for (uInt i=0; i<nrdim_p; i++) {
+    if (start(i) % tileShape_p(i) != 0
+    ||  end(i) - start(i) + 1 != tileShape_p(i)
+    ||  end(i) >= cubeShape_p(i)) {
+      return 0;
+    }
+    startTile_p(i) = start(i) / tileShape_p(i);
+  }
+  uInt tileNr = expandedTilesPerDim_p.offset (startTile_p);
+  Int64 offset = fileOffset_p + Int64(tileNr) * bucketSize_p +
+                 externalOffset_p[colnr];
+  if (alignment > 1  &&  offset % alignment != 0) {
+    return 0;
+  }
+  return file->mapRegion (offset,
+                          Int64(tileShape_p.product()) * externalPixelSize);
+}
+
 void TSMCubeMMap::accessStrided (const IPosition& start, const IPosition& end,
                                  const IPosition& stride,
                                  char* section, uInt colnr,
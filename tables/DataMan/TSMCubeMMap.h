@@ -146,6 +146,13 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Map the data of the given column in a section of the cube directly
+    // into memory. It is only done if the file is readonly and the section
+    // is exactly one tile. Otherwise a null pointer is returned.
+    virtual char* mapSection (const IPosition& start, const IPosition& end,
+                              uInt colnr, uInt externalPixelSize,
+                              uInt alignment);
+
     // Set the cache size for the given slice and access path.
     virtual void setCacheSize (const IPosition& sliceShape,
                                const IPosition& windowStart,
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/IO/MMapfdIO.h>
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/BasicSL/String.h>
@@ -105,12 +106,12 @@ Bool TSMDataColumn::canChangeShape() const
     return stmanPtr_p->canChangeShape();
 }
 
-void TSMDataColumn::setShape (uInt rownr, const IPosition& shape)
+void TSMDataColumn::setShape (rownr_t rownr, const IPosition& shape)
 {
     setShapeTiled (rownr, shape, stmanPtr_p->defaultTileShape());
 }
 
-void TSMDataColumn::setShapeTiled (uInt rownr, const IPosition& shape,
+void TSMDataColumn::setShapeTiled (rownr_t rownr, const IPosition& shape,
 				   const IPosition& tileShape)
 {
     TSMCube* hypercube = stmanPtr_p->getHypercube (rownr);
@@ -137,7 +138,7 @@ void TSMDataColumn::setShapeTiled (uInt rownr, const IPosition& shape,
     }
 }
 
-Bool TSMDataColumn::isShapeDefined (uInt rownr)
+Bool TSMDataColumn::isShapeDefined (rownr_t rownr)
 {
     //# The shape is defined when the shape is fixed or when
     //# a hypercube has been defined for this row.
@@ -148,7 +149,7 @@ Bool TSMDataColumn::isShapeDefined (uInt rownr)
     return (hypercube->cubeShape().nelements() != 0);
 }
 
-IPosition TSMDataColumn::shape (uInt rownr)
+IPosition TSMDataColumn::shape (rownr_t rownr)
 {
     //# Return the shape when it is fixed.
     if (shapeColumn().nelements() != 0) {
@@ -170,7 +171,7 @@ IPosition TSMDataColumn::shape (uInt rownr)
     return shape;
 }
 
-IPosition TSMDataColumn::tileShape (uInt rownr)
+IPosition TSMDataColumn::tileShape (rownr_t rownr)
 {
     //# If no shape is defined, throw exception.
     TSMCube* hypercube = stmanPtr_p->getHypercube (rownr);
@@ -178,7 +179,7 @@ IPosition TSMDataColumn::tileShape (uInt rownr)
 }
 
 
-void TSMDataColumn::accessCell (uInt rownr, const void* dataPtr, 
+void TSMDataColumn::accessCell (rownr_t rownr, const void* dataPtr, 
 				Bool writeFlag)
 {
     // Get the hypercube the row is in.
@@ -199,11 +200,71 @@ void TSMDataColumn::accessCell (uInt rownr, const void* dataPtr,
 	    hypercube->setLastColAccess (TSMCube::CellAccess);
 	}
     }
+    hypercube->recordAccess (start, end);
     hypercube->accessSection (start, end, (char*)dataPtr, colnr_p,
 			      localPixelSize_p, tilePixelSize_p, writeFlag);
 }
 
-void TSMDataColumn::accessCellSlice (uInt rownr, const Slicer& ns,
+char* TSMDataColumn::mapCell (rownr_t rownr, uInt alignment)
+{
+    // The data can only be used directly if stored in local format.
+    if (mustConvert_p  ||  localPixelSize_p != tilePixelSize_p) {
+	return 0;
+    }
+    IPosition end;
+    TSMCube* hypercube = stmanPtr_p->getHypercube (rownr, end);
+    IPosition start (end);
+    for (uInt i=0; i<stmanPtr_p->nrCoordVector(); i++) {
+	start(i) = 0;
+	end(i)--;
+    }
+    return hypercube->mapSection (start, end, colnr_p, tilePixelSize_p,
+                                  alignment);
+}
+
+template<typename T>
+Bool TSMDataColumn::getArrayMapped (rownr_t rownr, Array<T>* arr)
+{
+    char* data = mapCell (rownr, alignof(T));
+    if (data == 0) {
+	return False;
+    }
+    // The region is unmapped when the array storage is released.
+    arr->takeStorage (shape(rownr), reinterpret_cast<T*>(data), TAKE_OVER,
+                      MappedAllocator<T>::value);
+    return True;
+}
+
+Bool TSMDataColumn::getArrayMappedV (rownr_t rownr, void* dataPtr)
+{
+    switch (dataType()) {
+    case TpUChar:
+	return getArrayMapped (rownr, static_cast<Array<uChar>*>(dataPtr));
+    case TpShort:
+	return getArrayMapped (rownr, static_cast<Array<Short>*>(dataPtr));
+    case TpUShort:
+	return getArrayMapped (rownr, static_cast<Array<uShort>*>(dataPtr));
+    case TpInt:
+	return getArrayMapped (rownr, static_cast<Array<Int>*>(dataPtr));
+    case TpUInt:
+	return getArrayMapped (rownr, static_cast<Array<uInt>*>(dataPtr));
+    case TpInt64:
+	return getArrayMapped (rownr, static_cast<Array<Int64>*>(dataPtr));
+    case TpFloat:
+	return getArrayMapped (rownr, static_cast<Array<float>*>(dataPtr));
+    case TpDouble:
+	return getArrayMapped (rownr, static_cast<Array<double>*>(dataPtr));
+    case TpComplex:
+	return getArrayMapped (rownr, static_cast<Array<Complex>*>(dataPtr));
+    case TpDComplex:
+	return getArrayMapped (rownr, static_cast<Array<DComplex>*>(dataPtr));
+    default:
+	break;
+    }
+    return False;
+}
+
+void TSMDataColumn::accessCellSlice (rownr_t rownr, const Slicer& ns,
 				     const void* dataPtr, Bool writeFlag)
 {
     IPosition end;
@@ -242,6 +303,7 @@ void TSMDataColumn::accessCellSlice (uInt rownr, const Slicer& ns,
 	    hypercube->setLastColSlice (slice);
 	}
     }
+    hypercube->recordAccess (start, end);
     hypercube->accessStrided (start, end, stride,
 			      (char*)dataPtr, colnr_p,
 			      localPixelSize_p, tilePixelSize_p, writeFlag);
@@ -260,6 +322,7 @@ void TSMDataColumn::accessColumn (const void* dataPtr, Bool writeFlag)
 				 IPosition(), IPosition(), True, False);
 	hypercube->setLastColAccess (TSMCube::ColumnAccess);
     }
+    hypercube->recordAccess (start, end);
     hypercube->accessSection (start, end, (char*)dataPtr, colnr_p,
 			      localPixelSize_p, tilePixelSize_p, writeFlag);
 }
@@ -311,6 +374,7 @@ void TSMDataColumn::accessColumnSlice (const Slicer& ns,
 	    hypercube->setLastColSlice (slice);
 	}
     }
+    hypercube->recordAccess (start, end);
     hypercube->accessStrided (start, end, stride,
 			      (char*)dataPtr, colnr_p,
 			      localPixelSize_p, tilePixelSize_p, writeFlag);
@@ -335,9 +399,9 @@ void TSMDataColumn::accessColumnCells (const RefRows& rownrs,
   // Step through all rownr intervals and all rownrs in each interval.
   RefRowsSliceIter iter(rownrs);
   while (! iter.pastEnd()) {
-    uInt rownr = iter.sliceStart();
-    uInt erow = iter.sliceEnd();
-    uInt irow = iter.sliceIncr();
+    rownr_t rownr = iter.sliceStart();
+    rownr_t erow = iter.sliceEnd();
+    rownr_t irow = iter.sliceIncr();
     while (rownr <= erow) {
       // Get the hypercube and the position of the row in it.
       // A read has to be done if we have another hypercube
@@ -418,9 +482,9 @@ void TSMDataColumn::accessColumnSliceCells (const RefRows& rownrs,
   // Step through all rownr intervals and all rownrs in each interval.
   RefRowsSliceIter iter(rownrs);
   while (! iter.pastEnd()) {
-    uInt rownr = iter.sliceStart();
-    uInt erow = iter.sliceEnd();
-    uInt irow = iter.sliceIncr();
+    rownr_t rownr = iter.sliceStart();
+    rownr_t erow = iter.sliceEnd();
+    rownr_t irow = iter.sliceIncr();
     while (rownr <= erow) {
       // Get the hypercube and the position of the row in it.
       // A read has to be done if we have another hypercube
@@ -488,6 +552,7 @@ void TSMDataColumn::accessFullCells (TSMCube* hypercube,
       hypercube->setLastColAccess (TSMCube::ColumnAccess);
     }
   }
+  hypercube->recordAccess (start, end);
   hypercube->accessStrided (start, end, incr, dataPtr, colnr_p,
 			    localPixelSize_p, tilePixelSize_p, writeFlag);
 }
@@ -526,22 +591,23 @@ void TSMDataColumn::accessSlicedCells (TSMCube* hypercube,
       hypercube->setLastColSlice (sliceShp);
     }
   }
+  hypercube->recordAccess (start, end);
   hypercube->accessStrided (start, end, incr, dataPtr, colnr_p,
 			    localPixelSize_p, tilePixelSize_p, writeFlag);
 }
 
 
-void TSMDataColumn::getfloatV (uInt rownr, float* dataPtr)
+void TSMDataColumn::getfloatV (rownr_t rownr, float* dataPtr)
 {
     accessCell (rownr, dataPtr, False);
 }
-void TSMDataColumn::putfloatV (uInt rownr, const float* dataPtr)
+void TSMDataColumn::putfloatV (rownr_t rownr, const float* dataPtr)
 {
     accessCell (rownr, dataPtr, True);
 }
 
 
-void TSMDataColumn::getArrayfloatV (uInt rownr, Array<float>* dataPtr)
+void TSMDataColumn::getArrayfloatV (rownr_t rownr, Array<float>* dataPtr)
 {
     Bool deleteIt;
     float* data = dataPtr->getStorage (deleteIt);
@@ -549,7 +615,7 @@ void TSMDataColumn::getArrayfloatV (uInt rownr, Array<float>* dataPtr)
     dataPtr->putStorage (data, deleteIt);
 }
 
-void TSMDataColumn::putArrayfloatV (uInt rownr, const Array<float>* dataPtr)
+void TSMDataColumn::putArrayfloatV (rownr_t rownr, const Array<float>* dataPtr)
 {
     Bool deleteIt;
     const float* data = dataPtr->getStorage (deleteIt);
@@ -557,7 +623,7 @@ void TSMDataColumn::putArrayfloatV (uInt rownr, const Array<float>* dataPtr)
     dataPtr->freeStorage (data, deleteIt);
 }
 
-void TSMDataColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
+void TSMDataColumn::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 				    Array<float>* dataPtr)
 {
     Bool deleteIt;
@@ -565,7 +631,7 @@ void TSMDataColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
     accessCellSlice (rownr, ns, data, False);
     dataPtr->putStorage (data, deleteIt);
 }
-void TSMDataColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
+void TSMDataColumn::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 				    const Array<float>* dataPtr)
 {
     Bool deleteIt;
@@ -704,29 +770,29 @@ void TSMDataColumn::putColumnSliceCellsfloatV (const RefRows& rownrs,
 
 
 #define TSMDATACOLUMN_GETPUT(T,NM) \
-void TSMDataColumn::aips_name2(get,NM) (uInt rownr, T* dataPtr) \
+void TSMDataColumn::aips_name2(get,NM) (rownr_t rownr, T* dataPtr) \
 { \
     accessCell (rownr, dataPtr, False); \
 } \
-void TSMDataColumn::aips_name2(put,NM) (uInt rownr, const T* dataPtr) \
+void TSMDataColumn::aips_name2(put,NM) (rownr_t rownr, const T* dataPtr) \
 { \
     accessCell (rownr, dataPtr, True); \
 } \
-void TSMDataColumn::aips_name2(getArray,NM) (uInt rownr, Array<T>* dataPtr) \
+void TSMDataColumn::aips_name2(getArray,NM) (rownr_t rownr, Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
     T* data = dataPtr->getStorage (deleteIt); \
     accessCell (rownr, data, False); \
     dataPtr->putStorage (data, deleteIt); \
 } \
-void TSMDataColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* dataPtr) \
+void TSMDataColumn::aips_name2(putArray,NM) (rownr_t rownr, const Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
     const T* data = dataPtr->getStorage (deleteIt); \
     accessCell (rownr, data, True); \
     dataPtr->freeStorage (data, deleteIt); \
 } \
-void TSMDataColumn::aips_name2(getSlice,NM) (uInt rownr, const Slicer& ns, \
+void TSMDataColumn::aips_name2(getSlice,NM) (rownr_t rownr, const Slicer& ns, \
 					     Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
@@ -734,7 +800,7 @@ void TSMDataColumn::aips_name2(getSlice,NM) (uInt rownr, const Slicer& ns, \
     accessCellSlice (rownr, ns, data, False); \
     dataPtr->putStorage (data, deleteIt); \
 } \
-void TSMDataColumn::aips_name2(putSlice,NM) (uInt rownr, const Slicer& ns, \
+void TSMDataColumn::aips_name2(putSlice,NM) (rownr_t rownr, const Slicer& ns, \
 					     const Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
@@ -45,13 +45,13 @@ TSMIdColumn::TSMIdColumn (const TSMColumn& column)
 TSMIdColumn::~TSMIdColumn()
 {}
 
-void TSMIdColumn::getfloatV (uInt rownr, float* dataPtr)
+void TSMIdColumn::getfloatV (rownr_t rownr, float* dataPtr)
 {
     // Get the hypercube the row is in.
     TSMCube* hypercube = stmanPtr_p->getHypercube (rownr);
     hypercube->valueRecord().get (columnName(), *dataPtr);
 }
-void TSMIdColumn::putfloatV (uInt rownr, const float* dataPtr)
+void TSMIdColumn::putfloatV (rownr_t rownr, const float* dataPtr)
 {
     float value;
     TSMIdColumn::getfloatV (rownr, &value);
@@ -64,12 +64,12 @@ void TSMIdColumn::putfloatV (uInt rownr, const float* dataPtr)
 
 
 #define TSMIDCOLUMN_GETPUT(T,NM) \
-void TSMIdColumn::aips_name2(get,NM) (uInt rownr, T* dataPtr) \
+void TSMIdColumn::aips_name2(get,NM) (rownr_t rownr, T* dataPtr) \
 { \
     TSMCube* hypercube = stmanPtr_p->getHypercube (rownr); \
     hypercube->valueRecord().get (columnName(), *dataPtr); \
 } \
-void TSMIdColumn::aips_name2(put,NM) (uInt rownr, const T* dataPtr) \
+void TSMIdColumn::aips_name2(put,NM) (rownr_t rownr, const T* dataPtr) \
 { \
     T value; \
     TSMIdColumn::aips_name2(get,NM) (rownr, &value); \
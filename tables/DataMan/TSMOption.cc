@@ -27,14 +27,16 @@
 
 #include <casacore/tables/DataMan/TSMOption.h>
 #include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/OS/OMP.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TSMOption::TSMOption (TSMOption::Option option, Int bufferSize,
-                        Int maxCacheSizeMB)
+                        Int maxCacheSizeMB, Int nthreads)
     : itsOption       (option),
       itsBufferSize   (bufferSize),
-      itsMaxCacheSize (maxCacheSizeMB)
+      itsMaxCacheSize (maxCacheSizeMB),
+      itsNThreads     (nthreads)
   {}
 
   void TSMOption::fillOption (Bool newTable)
@@ -67,6 +69,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsMaxCacheSize <= -2) {
       AipsrcValue<Int>::find (itsMaxCacheSize, "table.tsm.maxcachesizemb", -1);
     }
+    // Default is 1 thread; 0 means all available threads.
+    if (itsNThreads <= -2) {
+      AipsrcValue<Int>::find (itsNThreads, "table.tsm.nthreads", 1);
+    }
+    if (itsNThreads <= 0) {
+      itsNThreads = OMP::maxThreads();
+    }
     // Default is to use the old caching behaviour
     // Abandoned default to use mmap for existing files on 64 bit systems.
     if (itsOption == TSMOption::Default) {
@@ -109,6 +109,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>table.tsm.buffersize</src> gives the buffer size for option
 //       <src>TSMOption::Buffer</src>. A value <=0 means use the default 4096.
 //       It defaults to 0.
+//  <li> <src>table.tsm.nthreads</src> gives the number of threads to use
+//       for option <src>TSMOption::Cache</src> to read the tiles needed
+//       for a slice in parallel and to copy their data in parallel.
+//       A value 0 means the maximum number of OpenMP threads.
+//       It defaults to 1 (thus no parallel reading).
 // </ul>
 // </synopsis>
 
@@ -136,7 +141,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // The buffer size has to be given in bytes.
     // The maximum cache size has to be given in MibiBytes (1024*1024 bytes).
     TSMOption (Option option=Aipsrc, Int bufferSize=-2,
-               Int maxCacheSizeMB=-2);
+               Int maxCacheSizeMB=-2, Int nthreads=-2);
 
     // Fill the option in case Aipsrc or Default was given.
     // It is done as explained in the synopsis.
@@ -154,10 +159,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int maxCacheSizeMB() const
       { return itsMaxCacheSize; }
 
+    // Get the number of threads to use for reading tiles in parallel.
+    // It is at least 1.
+    uInt nthreads() const
+      { return itsNThreads > 1  ?  itsNThreads : 1; }
+
   private:
     Option itsOption;
     Int    itsBufferSize;
     Int    itsMaxCacheSize;
+    Int    itsNThreads;
   };
 
 } //# NAMESPACE CASACORE - END
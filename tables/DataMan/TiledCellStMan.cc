@@ -65,6 +65,9 @@ TiledCellStMan::TiledCellStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    if (spec.isDefined ("COMPRESSION")) {
+        setCompression (spec.asString ("COMPRESSION"));
+    }
 }
 
 TiledCellStMan::~TiledCellStMan()
@@ -75,6 +78,7 @@ DataManager* TiledCellStMan::clone() const
     TiledCellStMan* smp = new TiledCellStMan (hypercolumnName_p,
 					      defaultTileShape_p,
 					      maximumCacheSize());
+    smp->setCompression (compression());
     return smp;
 }
 
@@ -99,7 +103,7 @@ Bool TiledCellStMan::canChangeShape() const
     return True;
 }
 
-void TiledCellStMan::setShape (uInt, TSMCube* hypercube,
+void TiledCellStMan::setShape (rownr_t, TSMCube* hypercube,
 			       const IPosition& shape,
 			       const IPosition& tileShape)
 {
@@ -131,7 +135,7 @@ void TiledCellStMan::setupCheck (const TableDesc& tableDesc,
 }
 
 
-void TiledCellStMan::create (uInt nrrow)
+void TiledCellStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(0);
@@ -165,7 +169,7 @@ Bool TiledCellStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledCellStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledCellStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
@@ -178,7 +182,7 @@ void TiledCellStMan::readHeader (uInt tabNrrow, Bool firstTime)
 }
 
 
-void TiledCellStMan::addRow (uInt nrow)
+void TiledCellStMan::addRow (rownr_t nrow)
 {
     // Resize block when needed.
     uInt size = cubeSet_p.nelements();
@@ -205,7 +209,7 @@ void TiledCellStMan::addRow (uInt nrow)
 }
 
 
-TSMCube* TiledCellStMan::getHypercube (uInt rownr)
+TSMCube* TiledCellStMan::getHypercube (rownr_t rownr)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
@@ -213,7 +217,7 @@ TSMCube* TiledCellStMan::getHypercube (uInt rownr)
     }
     return cubeSet_p[rownr];
 }
-TSMCube* TiledCellStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledCellStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
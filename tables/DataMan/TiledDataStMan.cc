@@ -34,6 +34,7 @@
 #include <casacore/casa/Containers/BlockIO.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/tables/DataMan/DataManError.h>
+#include <limits>
 
 
 
@@ -61,6 +62,9 @@ TiledDataStMan::TiledDataStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    if (spec.isDefined ("COMPRESSION")) {
+        setCompression (spec.asString ("COMPRESSION"));
+    }
 }
 
 TiledDataStMan::~TiledDataStMan()
@@ -70,6 +74,7 @@ DataManager* TiledDataStMan::clone() const
 {
     TiledDataStMan* smp = new TiledDataStMan (hypercolumnName_p,
 					      maximumCacheSize());
+    smp->setCompression (compression());
     return smp;
 }
 
@@ -84,7 +89,7 @@ String TiledDataStMan::dataManagerType() const
     { return "TiledDataStMan"; }
 
 
-void TiledDataStMan::create (uInt nrrow)
+void TiledDataStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(-1);
@@ -101,14 +106,29 @@ Bool TiledDataStMan::flush (AipsIO&, Bool fsync)
 	return False;
     }
     // Create the header file and write data in it.
+    // Version 2 is only used if row numbers exceed 32 bits, so older
+    // software can still read the header if possible.
+    Bool bigRows = (nrrowLast_p > std::numeric_limits<uInt>::max()  ||
+                    (nrUsedRowMap_p > 0  &&
+                     rowMap_p[nrUsedRowMap_p-1] > std::numeric_limits<uInt>::max()));
     AipsIO* headerFile = headerFileCreate();
-    headerFile->putstart ("TiledDataStMan", 1);
+    headerFile->putstart ("TiledDataStMan", bigRows ? 2 : 1);
     // Let the base class write its data.
     headerFilePut (*headerFile, cubeSet_p.nelements());
     // Write the data from this object.
-    *headerFile << nrrowLast_p;
-    *headerFile << nrUsedRowMap_p;
-    putBlock (*headerFile, rowMap_p,  Int(nrUsedRowMap_p));
+    if (bigRows) {
+        *headerFile << nrrowLast_p;
+        *headerFile << nrUsedRowMap_p;
+        putBlock (*headerFile, rowMap_p,  Int(nrUsedRowMap_p));
+    } else {
+        *headerFile << uInt(nrrowLast_p);
+        *headerFile << nrUsedRowMap_p;
+        Block<uInt> rowMap(nrUsedRowMap_p);
+        for (uInt i=0; i<nrUsedRowMap_p; ++i) {
+            rowMap[i] = uInt(rowMap_p[i]);
+        }
+        putBlock (*headerFile, rowMap,  Int(nrUsedRowMap_p));
+    }
     putBlock (*headerFile, cubeMap_p, Int(nrUsedRowMap_p));
     putBlock (*headerFile, posMap_p,  Int(nrUsedRowMap_p));
     headerFile->putend();
@@ -116,17 +136,30 @@ Bool TiledDataStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledDataStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledDataStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
-    headerFile->getstart ("TiledDataStMan");
+    uInt version = headerFile->getstart ("TiledDataStMan");
     // Let the base class read and initialize its data.
     headerFileGet (*headerFile, tabNrrow, firstTime, -1);
     // Read the data for this object.
-    *headerFile >> nrrowLast_p;
-    *headerFile >> nrUsedRowMap_p;
-    getBlock (*headerFile, rowMap_p);
+    if (version > 1) {
+        *headerFile >> nrrowLast_p;
+        *headerFile >> nrUsedRowMap_p;
+        getBlock (*headerFile, rowMap_p);
+    } else {
+        uInt nrrowLast;
+        *headerFile >> nrrowLast;
+        nrrowLast_p = nrrowLast;
+        *headerFile >> nrUsedRowMap_p;
+        Block<uInt> rowMap;
+        getBlock (*headerFile, rowMap);
+        rowMap_p.resize (rowMap.nelements(), True, False);
+        for (uInt i=0; i<rowMap.nelements(); ++i) {
+            rowMap_p[i] = rowMap[i];
+        }
+    }
     getBlock (*headerFile, cubeMap_p);
     getBlock (*headerFile, posMap_p);
     headerFile->getend();
@@ -134,7 +167,7 @@ void TiledDataStMan::readHeader (uInt tabNrrow, Bool firstTime)
 }
 
 
-void TiledDataStMan::addRow (uInt nrow)
+void TiledDataStMan::addRow (rownr_t nrow)
 {
     nrrow_p += nrow;
     setDataChanged();
@@ -144,7 +177,7 @@ void TiledDataStMan::addRow (uInt nrow)
 void TiledDataStMan::checkNrrow (const IPosition& cubeShape,
 				 uInt incrInLastDim) const
 {
-    uInt nrrow = addedNrrow (cubeShape, incrInLastDim);
+    rownr_t nrrow = addedNrrow (cubeShape, incrInLastDim);
     if (nrrowLast_p + nrrow > nrrow_p) {
 	throw (TSMError
 	             ("Insufficient #rows in table for add/extendHypercube"));
@@ -213,12 +246,12 @@ void TiledDataStMan::updateRowMap (uInt cubeNr, uInt incrInLastDim)
     nrrowLast_p += nr;
 }
 
-TSMCube* TiledDataStMan::getHypercube (uInt rownr)
+TSMCube* TiledDataStMan::getHypercube (rownr_t rownr)
 {
     IPosition pos;
     return TiledDataStMan::getHypercube (rownr, pos);
 }
-TSMCube* TiledDataStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledDataStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     // Check if the row number is correct.
     if (rownr >= nrrowLast_p ) {
@@ -309,7 +309,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  // Each hypercube requires 30 rows to be added (i.e. nr of baselines).
 //  // The last dimension of each hypercube is extended with 1.
 //  uInt i, j;
-//  uInt rownr = 0;
+//  rownr_t rownr = 0;
 //  for (i=0; i<42; i++) {
 //      if (i%2 == 0) {
 //          table.addRow (30);
@@ -398,7 +398,7 @@ private:
     // This will only increase the number of rows. When a hypercube is
     // added or extended, it will be checked whether the number of rows
     // is sufficient.
-    void addRow (uInt nrrow);
+    void addRow (rownr_t nrrow);
 
     // Add a hypercube.
     // The number of rows in the table must be large enough to
@@ -419,11 +419,11 @@ private:
     void extendHypercube (uInt incrInLastDim, const Record& values);
 
     // Get the hypercube in which the given row is stored.
-    virtual TSMCube* getHypercube (uInt rownr);
+    virtual TSMCube* getHypercube (rownr_t rownr);
 
     // Get the hypercube in which the given row is stored.
     // It also returns the position of the row in that hypercube.
-    virtual TSMCube* getHypercube (uInt rownr, IPosition& position);
+    virtual TSMCube* getHypercube (rownr_t rownr, IPosition& position);
 
     // Flush and optionally fsync the data.
     // It returns a True status if it had to flush (i.e. if data have changed).
@@ -431,10 +431,10 @@ private:
 
     // Let the storage manager create files as needed for a new table.
     // This allows a column with an indirect array to create its file.
-    virtual void create (uInt nrrow);
+    virtual void create (rownr_t nrrow);
 
     // Read the header info.
-    virtual void readHeader (uInt nrrow, Bool firstTime);
+    virtual void readHeader (rownr_t nrrow, Bool firstTime);
 
     // Update the map of row numbers to cube number plus offset.
     void updateRowMap (uInt cubeNr, uInt incrInLastDim);
@@ -447,13 +447,13 @@ private:
 
     //# Declare the data members.
     // The map of row number to cube and position in cube.
-    Block<uInt> rowMap_p;
+    Block<rownr_t> rowMap_p;
     Block<uInt> cubeMap_p;
     Block<uInt> posMap_p;
     // The nr of elements used in the map blocks.
     uInt nrUsedRowMap_p;
     // The row number since the last hypercube extension.
-    uInt nrrowLast_p;
+    rownr_t nrrowLast_p;
 };
 
 
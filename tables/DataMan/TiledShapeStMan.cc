@@ -38,6 +38,7 @@
 #include <casacore/casa/Containers/BlockIO.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/tables/DataMan/DataManError.h>
+#include <limits>
 
 
 
@@ -76,6 +77,9 @@ TiledShapeStMan::TiledShapeStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    if (spec.isDefined ("COMPRESSION")) {
+        setCompression (spec.asString ("COMPRESSION"));
+    }
 }
 
 TiledShapeStMan::~TiledShapeStMan()
@@ -86,6 +90,7 @@ DataManager* TiledShapeStMan::clone() const
     TiledShapeStMan* smp = new TiledShapeStMan (hypercolumnName_p,
 						defaultTileShape_p,
 						maximumCacheSize());
+    smp->setCompression (compression());
     return smp;
 }
 
@@ -131,7 +136,7 @@ TSMCube* TiledShapeStMan::singleHypercube()
     return cubeSet_p[1];
 }
 
-void TiledShapeStMan::setShape (uInt rownr, TSMCube*,
+void TiledShapeStMan::setShape (rownr_t rownr, TSMCube*,
 				const IPosition& shape,
 				const IPosition& tileShape)
 {
@@ -192,7 +197,7 @@ void TiledShapeStMan::setupCheck (const TableDesc& tableDesc,
 }
 
 
-void TiledShapeStMan::create (uInt nrrow)
+void TiledShapeStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(1);
@@ -213,14 +218,26 @@ Bool TiledShapeStMan::flush (AipsIO&, Bool fsync)
 	return False;
     }
     // Create the header file and write data in it.
+    // Version 2 is only used if row numbers exceed 32 bits, so older
+    // software can still read the header if possible.
+    Bool bigRows = (nrUsedRowMap_p > 0  &&
+                    rowMap_p[nrUsedRowMap_p-1] > std::numeric_limits<uInt>::max());
     AipsIO* headerFile = headerFileCreate();
-    headerFile->putstart ("TiledShapeStMan", 1);
+    headerFile->putstart ("TiledShapeStMan", bigRows ? 2 : 1);
     // Let the base class write its data.
     headerFilePut (*headerFile, cubeSet_p.nelements());
     // Write the data from this object.
     *headerFile << defaultTileShape_p;
     *headerFile << nrUsedRowMap_p;
-    putBlock (*headerFile, rowMap_p, Int(nrUsedRowMap_p));
+    if (bigRows) {
+        putBlock (*headerFile, rowMap_p, Int(nrUsedRowMap_p));
+    } else {
+        Block<uInt> rowMap(nrUsedRowMap_p);
+        for (uInt i=0; i<nrUsedRowMap_p; ++i) {
+            rowMap[i] = uInt(rowMap_p[i]);
+        }
+        putBlock (*headerFile, rowMap, Int(nrUsedRowMap_p));
+    }
     putBlock (*headerFile, cubeMap_p, Int(nrUsedRowMap_p));
     putBlock (*headerFile, posMap_p,  Int(nrUsedRowMap_p));
     headerFile->putend();
@@ -228,17 +245,26 @@ Bool TiledShapeStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledShapeStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledShapeStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
-    headerFile->getstart ("TiledShapeStMan");
+    uInt version = headerFile->getstart ("TiledShapeStMan");
     // Let the base class read and initialize its data.
     headerFileGet (*headerFile, tabNrrow, firstTime, 1);
     // Read the data for this object.
     *headerFile >> defaultTileShape_p;
     *headerFile >> nrUsedRowMap_p;
-    getBlock (*headerFile, rowMap_p);
+    if (version > 1) {
+        getBlock (*headerFile, rowMap_p);
+    } else {
+        Block<uInt> rowMap;
+        getBlock (*headerFile, rowMap);
+        rowMap_p.resize (rowMap.nelements(), True, False);
+        for (uInt i=0; i<rowMap.nelements(); ++i) {
+            rowMap_p[i] = rowMap[i];
+        }
+    }
     getBlock (*headerFile, cubeMap_p);
     getBlock (*headerFile, posMap_p);
     headerFile->getend();
@@ -246,12 +272,12 @@ void TiledShapeStMan::readHeader (uInt tabNrrow, Bool firstTime)
 }
 
 
-void TiledShapeStMan::addRow (uInt nrow)
+void TiledShapeStMan::addRow (rownr_t nrow)
 {
-    uInt oldnrrow = nrrow_p;
+    rownr_t oldnrrow = nrrow_p;
     nrrow_p += nrow;
     if (fixedCellShape_p.nelements() > 0) {
-	for (uInt i=oldnrrow; i<oldnrrow+nrow; i++) {
+	for (rownr_t i=oldnrrow; i<oldnrrow+nrow; i++) {
 	    setShape (i, 0, fixedCellShape_p, defaultTileShape_p);
 	}
     }
@@ -259,7 +285,7 @@ void TiledShapeStMan::addRow (uInt nrow)
 }
 
 
-void TiledShapeStMan::addHypercube (uInt rownr,
+void TiledShapeStMan::addHypercube (rownr_t rownr,
 				    const IPosition& cubeShape,
 				    const IPosition& tileShape)
 {
@@ -277,7 +303,7 @@ void TiledShapeStMan::addHypercube (uInt rownr,
     extendHypercube (rownr, ncube);
 }
 
-void TiledShapeStMan::extendHypercube (uInt rownr, uInt cubeNr)
+void TiledShapeStMan::extendHypercube (rownr_t rownr, uInt cubeNr)
 {
     TSMCube* hypercube = cubeSet_p[cubeNr];
     uInt pos = hypercube->cubeShape()(nrdim_p-1);
@@ -287,14 +313,14 @@ void TiledShapeStMan::extendHypercube (uInt rownr, uInt cubeNr)
 }
 
 
-void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, uInt rownr)
+void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, rownr_t rownr)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
 	throw (TSMError ("TiledShapeStMan::updateRowMap: rownr is too high"));
     }
     // Determine the next row used and check (in debug mode) if it is right.
-    uInt nextRow = 0;
+    rownr_t nextRow = 0;
     if (nrUsedRowMap_p > 0) {
         nextRow = 1 + rowMap_p[nrUsedRowMap_p-1];
     }
@@ -451,7 +477,7 @@ void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, uInt rownr)
     posMap_p[index]  = pos;
 }
 
-TSMCube* TiledShapeStMan::getHypercube (uInt rownr)
+TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr)
 {
     if (rownr >= nrrow_p) {
 	throw (TSMError ("getHypercube: rownr is too high"));
@@ -472,7 +498,7 @@ TSMCube* TiledShapeStMan::getHypercube (uInt rownr)
     return cubeSet_p[cubeMap_p[lastHC_p]];
 }
 
-TSMCube* TiledShapeStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     if (rownr >= nrrow_p) {
 	throw (TSMError ("getHypercube: rownr is too high"));
@@ -227,7 +227,7 @@ public:
     // It is used when the first row in a new hypercube is written.
     // If needed it adds a dimension to the shape, which reflects the
     // row dimension. The tile shape in that dimension is by default 1.
-    virtual void setShape (uInt rownr, TSMCube* hypercube,
+    virtual void setShape (rownr_t rownr, TSMCube* hypercube,
 			   const IPosition& shape,
 			   const IPosition& tileShape);
 
@@ -252,7 +252,7 @@ private:
     virtual IPosition defaultTileShape() const;
 
     // Add rows to the storage manager.
-    void addRow (uInt nrrow);
+    void addRow (rownr_t nrrow);
 
     // Find the hypercube for the given shape.
     // It returns -1 when not found.
@@ -266,7 +266,7 @@ private:
     // should match the coordinate and id column names.
     // The last dimension in the cube shape can be zero, indicating that
     // the hypercube is extensible.
-    void addHypercube (uInt rownr,
+    void addHypercube (rownr_t rownr,
 		       const IPosition& cubeShape,
 		       const IPosition& tileShape);
 
@@ -274,14 +274,14 @@ private:
     // the last dimension.
     // The record should contain the id values (to get the correct
     // hypercube) and optionally coordinate values for the elements added.
-    void extendHypercube (uInt rownr, uInt cubeNr);
+    void extendHypercube (rownr_t rownr, uInt cubeNr);
 
     // Get the hypercube in which the given row is stored.
-    virtual TSMCube* getHypercube (uInt rownr);
+    virtual TSMCube* getHypercube (rownr_t rownr);
 
     // Get the hypercube in which the given row is stored.
     // It also returns the position of the row in that hypercube.
-    virtual TSMCube* getHypercube (uInt rownr, IPosition& position);
+    virtual TSMCube* getHypercube (rownr_t rownr, IPosition& position);
 
     // Check if the hypercolumn definition fits this storage manager.
     virtual void setupCheck (const TableDesc& tableDesc,
@@ -293,24 +293,24 @@ private:
 
     // Let the storage manager create files as needed for a new table.
     // This allows a column with an indirect array to create its file.
-    virtual void create (uInt nrrow);
+    virtual void create (rownr_t nrrow);
 
     // Read the header info.
-    virtual void readHeader (uInt nrrow, Bool firstTime);
+    virtual void readHeader (rownr_t nrrow, Bool firstTime);
 
     // Update the map of row numbers to cube number plus offset.
-    void updateRowMap (uInt cubeNr, uInt pos, uInt rownr);
+    void updateRowMap (uInt cubeNr, uInt pos, rownr_t rownr);
 
     // Extend the map of row numbers to cube number plus offset
     // will new empty entries.
-    void extendRowMap (uInt nrow);
+    void extendRowMap (rownr_t nrow);
 
 
     //# Declare the data members.
     // The default tile shape.
     IPosition defaultTileShape_p;
     // The map of row number to cube and position in cube.
-    Block<uInt> rowMap_p;
+    Block<rownr_t> rowMap_p;
     Block<uInt> cubeMap_p;
     Block<uInt> posMap_p;
     // The nr of elements used in the map blocks.
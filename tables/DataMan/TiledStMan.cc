@@ -31,6 +31,7 @@
 #include <casacore/tables/DataMan/TSMCoordColumn.h>
 #include <casacore/tables/DataMan/TSMIdColumn.h>
 #include <casacore/tables/DataMan/TSMCube.h>
+#include <casacore/tables/DataMan/TSMCodec.h>
 #include <casacore/tables/DataMan/TSMCubeMMap.h>
 #include <casacore/tables/DataMan/TSMCubeBuff.h>
 #include <casacore/tables/DataMan/TSMFile.h>
@@ -38,6 +39,7 @@
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/BasicSL/String.h>
@@ -47,6 +49,9 @@
 #include <casacore/casa/OS/DOos.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/DataMan/DataManError.h>
+#include <limits>
+#include <vector>
+#include <algorithm>
 
 
 
@@ -58,6 +63,7 @@ TiledStMan::TiledStMan ()
   fileSet_p         (1, static_cast<TSMFile*>(0)),
   persMaxCacheSize_p(0),
   maxCacheSize_p    (0),
+  recordAccess_p    (False),
   nrdim_p           (0),
   nrCoordVector_p   (0),
   dataChanged_p     (False)
@@ -70,6 +76,7 @@ TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
   fileSet_p         (1, static_cast<TSMFile*>(0)),
   persMaxCacheSize_p(maximumCacheSize),
   maxCacheSize_p    (maximumCacheSize),
+  recordAccess_p    (False),
   nrdim_p           (0),
   nrCoordVector_p   (0),
   dataChanged_p     (False)
@@ -289,6 +296,9 @@ Record TiledStMan::dataManagerSpec() const
     Record rec = getProperties();
     rec.define ("DEFAULTTILESHAPE", defaultTileShape().asVector());
     rec.define ("MAXIMUMCACHESIZE", Int(persMaxCacheSize_p));
+    if (! compress_p.empty()) {
+        rec.define ("COMPRESSION", compress_p);
+    }
     Record subrec;
     Int nrrec=0;
     for (uInt i=0; i<cubeSet_p.nelements(); i++) {
@@ -298,6 +308,9 @@ Record TiledStMan::dataManagerSpec() const
 	    srec.define ("TileShape", cubeSet_p[i]->tileShape().asVector());
 	    srec.define ("CellShape", cubeSet_p[i]->cellShape().asVector());
 	    srec.define ("BucketSize", Int(cubeSet_p[i]->bucketSize()));
+            if (! cubeSet_p[i]->compression().empty()) {
+                srec.define ("Compression", cubeSet_p[i]->compression());
+            }
 	    srec.defineRecord ("ID", cubeSet_p[i]->valueRecord());
 	    subrec.defineRecord (nrrec++, srec);
 	}
@@ -322,7 +335,7 @@ void TiledStMan::setProperties (const Record& rec)
 }
 
 
-void TiledStMan::setShape (uInt, TSMCube*, const IPosition&, const IPosition&)
+void TiledStMan::setShape (rownr_t, TSMCube*, const IPosition&, const IPosition&)
 {
     throw (TSMError ("setShape is not possible for TSM " + hypercolumnName_p));
 }
@@ -356,6 +369,113 @@ void TiledStMan::deleteManager()
 void TiledStMan::setMaximumCacheSize (uInt nMiB)
     { maxCacheSize_p = nMiB; }
 
+void TiledStMan::setCompression (const String& codec)
+    { compress_p = TSMCodec::checkName (codec); }
+
+void TiledStMan::setRecordAccess (Bool recordAccess)
+{
+    recordAccess_p = recordAccess;
+    if (! recordAccess) {
+        for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+            if (cubeSet_p[i] != 0) {
+                cubeSet_p[i]->clearAccessPatterns();
+            }
+        }
+    }
+}
+
+Double TiledStMan::accessCost (const IPosition& hypercubeShape,
+                               const IPosition& tileShape,
+                               const Record& accessPatterns,
+                               uInt maxNrPixelsPerTile)
+{
+    uInt nrdim = hypercubeShape.nelements();
+    if (tileShape.nelements() != nrdim) {
+        throw TSMError ("accessCost: tile shape has a wrong length");
+    }
+    Matrix<Int> shapes (accessPatterns.asArrayInt ("SHAPES"));
+    Vector<Int64> counts (accessPatterns.asArrayInt64 ("COUNTS"));
+    if (shapes.ncolumn() > 0  &&  shapes.nrow() != nrdim) {
+        throw TSMError ("accessCost: access shapes have a wrong length");
+    }
+    // Each tile read has a fixed overhead (e.g. a seek).
+    Double tileCost = tileShape.product() + maxNrPixelsPerTile / 8.;
+    Double cost = 0;
+    for (uInt i=0; i<shapes.ncolumn(); i++) {
+        // The average number of tiles touched by a section of this length
+        // (at a random position), but not more than the number of tiles.
+        Double ntile = 1;
+        for (uInt j=0; j<nrdim; j++) {
+            Double ntiles = (hypercubeShape[j] + tileShape[j] - 1) /
+                            tileShape[j];
+            ntile *= std::min (ntiles,
+                               Double(shapes(j,i) - 1) / tileShape[j] + 1);
+        }
+        cost += counts[i] * ntile * tileCost;
+    }
+    return cost;
+}
+
+IPosition TiledStMan::adviseTileShape (const IPosition& hypercubeShape,
+                                       const Record& accessPatterns,
+                                       uInt maxNrPixelsPerTile)
+{
+    // Determine the tile lengths to try for each axis.
+    uInt nrdim = hypercubeShape.nelements();
+    std::vector<std::vector<Int> > lengths(nrdim);
+    for (uInt j=0; j<nrdim; j++) {
+        Int len = std::max (hypercubeShape[j], ssize_t(1));
+        for (Int64 n=1; n<len; n*=2) {
+            lengths[j].push_back (n);
+            lengths[j].push_back ((len + n - 1) / n);
+        }
+        lengths[j].push_back (len);
+        std::sort (lengths[j].begin(), lengths[j].end());
+        lengths[j].erase (std::unique (lengths[j].begin(), lengths[j].end()),
+                          lengths[j].end());
+    }
+    // Try all combinations not exceeding the maximum tile size.
+    // Take the first axis varying fastest.
+    IPosition tileShape(nrdim, 1);
+    IPosition bestShape(tileShape);
+    Double bestCost = accessCost (hypercubeShape, tileShape,
+                                  accessPatterns, maxNrPixelsPerTile);
+    std::vector<uInt> inx(nrdim, 0);
+    uInt axis = 0;
+    while (axis < nrdim) {
+        if (inx[axis] + 1 < lengths[axis].size()) {
+            inx[axis]++;
+            tileShape[axis] = lengths[axis][inx[axis]];
+            if (Double(tileShape.product()) <= maxNrPixelsPerTile) {
+                Double cost = accessCost (hypercubeShape, tileShape,
+                                          accessPatterns, maxNrPixelsPerTile);
+                if (cost < bestCost) {
+                    bestCost  = cost;
+                    bestShape = tileShape;
+                }
+                axis = 0;
+                continue;
+            }
+        }
+        // Too large or all lengths done, so reset this axis and go to the
+        // next one.
+        inx[axis] = 0;
+        tileShape[axis] = lengths[axis][0];
+        axis++;
+    }
+    return bestShape;
+}
+
+TSMOption TiledStMan::tsmFileOption() const
+{
+    // Compressed tiles have a variable length, so only a cache can be used.
+    if (compress_p.empty()) {
+        return tsmOption();
+    }
+    return TSMOption (TSMOption::Cache, 0, tsmOption().maxCacheSizeMB(),
+                      tsmOption().nthreads());
+}
+
 
 Bool TiledStMan::canChangeShape() const
 {
@@ -385,17 +505,18 @@ TSMCube* TiledStMan::makeTSMCube (TSMFile* file, const IPosition& cubeShape,
                                   Int64 fileOffset)
 {
     TSMCube* hypercube;
-    if (tsmOption().option() == TSMOption::MMap) {
+    TSMOption tsmOpt = tsmFileOption();
+    if (tsmOpt.option() == TSMOption::MMap) {
         //cout << "mmapping TSM1" << endl;
         AlwaysAssert (file->bucketFile()->isMapped(), AipsError);
         hypercube = new TSMCubeMMap (this, file, cubeShape, tileShape,
                                      values, fileOffset);
-    } else if (tsmOption().option() == TSMOption::Buffer) {
+    } else if (tsmOpt.option() == TSMOption::Buffer) {
         //cout << "buffered TSM1" << endl;
         AlwaysAssert (file->bucketFile()->isBuffered(), AipsError);
         hypercube = new TSMCubeBuff (this, file, cubeShape, tileShape,
                                      values, fileOffset,
-                                     tsmOption().bufferSize());
+                                     tsmOpt.bufferSize());
     } else {
         //cout << "caching TSM1" << endl;
         AlwaysAssert (file->bucketFile()->isCached(), AipsError);
@@ -416,27 +537,27 @@ TSMCube* TiledStMan::getTSMCube (uInt hypercube)
 }
 
 
-const IPosition& TiledStMan::hypercubeShape (uInt rownr) const
+const IPosition& TiledStMan::hypercubeShape (rownr_t rownr) const
 {
     return getHypercube(rownr)->cubeShape();
 }
 
-const IPosition& TiledStMan::tileShape (uInt rownr) const
+const IPosition& TiledStMan::tileShape (rownr_t rownr) const
 {
     return getHypercube(rownr)->tileShape();
 }
 
-uInt TiledStMan::bucketSize (uInt rownr) const
+uInt TiledStMan::bucketSize (rownr_t rownr) const
 {
     return getHypercube(rownr)->bucketSize();
 }
 
-uInt TiledStMan::cacheSize (uInt rownr) const
+uInt TiledStMan::cacheSize (rownr_t rownr) const
 {
     return getHypercube(rownr)->cacheSize();
 }
 
-uInt TiledStMan::calcCacheSize (uInt rownr,
+uInt TiledStMan::calcCacheSize (rownr_t rownr,
 				const IPosition& sliceShape,
 				const IPosition& windowStart,
 				const IPosition& windowLength,
@@ -447,7 +568,7 @@ uInt TiledStMan::calcCacheSize (uInt rownr,
 					       windowLength, axisPath);
 }
 
-void TiledStMan::setCacheSize (uInt rownr,
+void TiledStMan::setCacheSize (rownr_t rownr,
 			       const IPosition& sliceShape,
 			       const IPosition& windowStart,
 			       const IPosition& windowLength,
@@ -460,7 +581,7 @@ void TiledStMan::setCacheSize (uInt rownr,
 				       forceSmaller, True);
 }
 
-void TiledStMan::setCacheSize (uInt rownr, uInt nbuckets, Bool forceSmaller)
+void TiledStMan::setCacheSize (rownr_t rownr, uInt nbuckets, Bool forceSmaller)
 {
     // Set the cache size (in buckets) for the given hypercube.
     TSMCube* hypercube = getHypercube(rownr);
@@ -475,7 +596,7 @@ void TiledStMan::setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forc
 }
 
 
-Bool TiledStMan::userSetCache (uInt rownr) const
+Bool TiledStMan::userSetCache (rownr_t rownr) const
 {
     return getHypercube(rownr)->userSetCache();
 }
@@ -916,7 +1037,7 @@ TSMCube* TiledStMan::makeHypercube (const IPosition& cubeShape,
 
 void TiledStMan::createFile (uInt index)
 {
-    TSMFile* file = new TSMFile (this, index, tsmOption(), multiFile());
+    TSMFile* file = new TSMFile (this, index, tsmFileOption(), multiFile());
     fileSet_p[index] = file;
 }
 
@@ -989,9 +1110,9 @@ void TiledStMan::checkCoordinates (const PtrBlock<TSMColumn*>& coordColSet,
 }
 
 
-uInt TiledStMan::addedNrrow (const IPosition& shape, uInt incrInLastDim) const
+rownr_t TiledStMan::addedNrrow (const IPosition& shape, uInt incrInLastDim) const
 {
-    uInt nrrowAdded = 1;
+    rownr_t nrrowAdded = 1;
     for (uInt i=nrCoordVector_p; i<nrdim_p-1; i++) {
 	nrrowAdded *= shape(i);
     }
@@ -999,12 +1120,12 @@ uInt TiledStMan::addedNrrow (const IPosition& shape, uInt incrInLastDim) const
 }
 
 
-void TiledStMan::open (uInt nrrow, AipsIO&)
+void TiledStMan::open (rownr_t nrrow, AipsIO&)
 {
     // Read the header info (for the first time).
     readHeader (nrrow, True);
 }
-void TiledStMan::resync (uInt nrrow)
+void TiledStMan::resync (rownr_t nrrow)
 {
     // Reread the header info.
     readHeader (nrrow, False);
@@ -1049,7 +1170,18 @@ void TiledStMan::headerFilePut (AipsIO& headerFile, uInt nrCube)
     uInt i;
     // The endian switch is a new feature. So only put it if little endian
     // is used. In that way older software can read newer tables.
-    if (asBigEndian()) {
+    //# Similarly, a 64-bit row number is only written (in version 3) if
+    //# the number of rows does not fit in 32 bits.
+    //# Version 4 is only written if compression is used.
+    Bool bigRows = nrrow_p > std::numeric_limits<uInt>::max();
+    if (! compress_p.empty()) {
+        bigRows = True;
+        headerFile.putstart ("TiledStMan", 4);
+	headerFile << asBigEndian();
+    } else if (bigRows) {
+        headerFile.putstart ("TiledStMan", 3);
+	headerFile << asBigEndian();
+    } else if (asBigEndian()) {
         headerFile.putstart ("TiledStMan", 1);
     } else {
         headerFile.putstart ("TiledStMan", 2);
@@ -1059,13 +1191,20 @@ void TiledStMan::headerFilePut (AipsIO& headerFile, uInt nrCube)
     //# and the column data types.
     //# This is only done to check it when reading back.
     headerFile << sequenceNr();
-    headerFile << nrrow_p;
+    if (bigRows) {
+        headerFile << nrrow_p;
+    } else {
+        headerFile << uInt(nrrow_p);
+    }
     headerFile << ncolumn();
     for (i=0; i<ncolumn(); i++) {
 	headerFile << colSet_p[i]->dataType();
     }
     headerFile << hypercolumnName_p;
     headerFile << persMaxCacheSize_p;
+    if (! compress_p.empty()) {
+        headerFile << compress_p;
+    }
     headerFile << nrdim_p;
     headerFile << uInt(fileSet_p.nelements());
     for (i=0; i<fileSet_p.nelements(); i++) {
@@ -1083,7 +1222,7 @@ void TiledStMan::headerFilePut (AipsIO& headerFile, uInt nrCube)
     headerFile.putend();
 }
 
-void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
+void TiledStMan::headerFileGet (AipsIO& headerFile, rownr_t tabNrrow,
 				Bool firstTime, Int extraNdim)
 {
     nrrow_p = tabNrrow;
@@ -1097,10 +1236,17 @@ void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
         throw DataManError("Endian flag in TSM mismatches the table flag");
     }
     //# Get and check the number of rows and columns and the column types.
-    uInt nrrow, nrcol, seqnr;
+    rownr_t nrrow;
+    uInt nrcol, seqnr;
     int  dtype;
     headerFile >> seqnr;
-    headerFile >> nrrow;
+    if (version >= 3) {
+        headerFile >> nrrow;
+    } else {
+        uInt nrr;
+        headerFile >> nrr;
+        nrrow = nrr;
+    }
     headerFile >> nrcol;
     if (seqnr != sequenceNr()  ||  nrcol != ncolumn()) {
       //# Temporary hack to fix a corrupted table.
@@ -1131,6 +1277,10 @@ void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
     headerFile >> hypercolumnName_p;
     headerFile >> persMaxCacheSize_p;
     maxCacheSize_p = persMaxCacheSize_p;
+    compress_p = String();
+    if (version >= 4) {
+        headerFile >> compress_p;
+    }
     if (firstTime) {
 	// Setup the various things (i.e. initialize other variables).
 	setup (extraNdim);
@@ -1154,7 +1304,8 @@ void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
 	headerFile >> flag;
 	if (flag) {
 	    if (fileSet_p[i] == 0) {
-              fileSet_p[i] = new TSMFile (this, headerFile, i, tsmOption(),
+              fileSet_p[i] = new TSMFile (this, headerFile, i,
+                                          tsmFileOption(),
                                           multiFile());
 	    }else{
 		fileSet_p[i]->getObject (headerFile);
@@ -1173,13 +1324,14 @@ void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
     }
     for (i=0; i<nrCube; i++) {
 	if (cubeSet_p[i] == 0) {
-            if (tsmOption().option() == TSMOption::MMap) {
+            TSMOption tsmOpt = tsmFileOption();
+            if (tsmOpt.option() == TSMOption::MMap) {
                 //cout << "mmapping TSM" << endl;
                 cubeSet_p[i] = new TSMCubeMMap (this, headerFile);
-            } else if (tsmOption().option() == TSMOption::Buffer) {
+            } else if (tsmOpt.option() == TSMOption::Buffer) {
                 //cout << "buffered TSM" << endl;
                 cubeSet_p[i] = new TSMCubeBuff (this, headerFile,
-                                                tsmOption().bufferSize());
+                                                tsmOpt.bufferSize());
             }else{
                 //cout << "caching TSM" << endl;
 	        cubeSet_p[i] = new TSMCube (this, headerFile);
@@ -87,6 +87,16 @@ template<class T> class Vector;
 // data cells are consistent.
 // It also contains various data members and functions to make them
 // persistent by writing them into an AipsIO stream.
+// <p>
+// The tiles of new hypercubes can be compressed losslessly by giving
+// the codec name (see <linkto class=TSMCodec>TSMCodec</linkto>) in the
+// <src>COMPRESSION</src> field of the data manager specification record.
+// Compressed tiles have a variable length, so they are always accessed
+// using a cache (thus TSMOption MMap and Buffer are ignored).
+// Codec <src>sparse</src> does not compress, but does not store tiles
+// that have never been written and stores constant tiles in a few bytes.
+// It makes it possible to add a large column (e.g. MODEL_DATA) to a table
+// without writing all its (zero) data.
 // </synopsis> 
 
 // <motivation>
@@ -173,18 +183,54 @@ public:
     // Get the current maximum cache size (in MiB (MibiByte)).
     uInt maximumCacheSize() const;
 
+    // Set the compression codec for new hypercubes.
+    // An exception is thrown if the codec is unknown or not available.
+    void setCompression (const String& codec);
+
+    // Get the compression codec for new hypercubes (empty = none).
+    const String& compression() const;
+
+    // Switch recording of the section shapes accessed in the hypercubes
+    // on or off in a non-persistent way (see
+    // <src>TSMCube::accessPatterns</src>). Switching it off clears
+    // the shapes recorded.
+    void setRecordAccess (Bool recordAccess);
+
+    // Are the section shapes accessed recorded?
+    Bool recordAccess() const;
+
+    // Advise a tile shape for a hypercube with the given shape minimizing
+    // the number of bytes read for the given access patterns (in the
+    // format returned by <src>TSMCube::accessPatterns</src>).
+    // The number of pixels in the tile does not exceed the given maximum.
+    // <br>The cost of an access is the number of tiles touched (averaged
+    // over the possible positions of the section) times the number of pixels
+    // in a tile plus an overhead per tile (representing a seek), which is
+    // 1/8 of the maximum tile size.
+    // <br>The tile lengths tried for an axis are the powers of 2 and
+    // the lengths dividing the axis in a power of 2 parts.
+    // <group>
+    static IPosition adviseTileShape (const IPosition& hypercubeShape,
+                                      const Record& accessPatterns,
+                                      uInt maxNrPixelsPerTile = 32768);
+    static Double accessCost (const IPosition& hypercubeShape,
+                              const IPosition& tileShape,
+                              const Record& accessPatterns,
+                              uInt maxNrPixelsPerTile = 32768);
+    // </group>
+
     // Get the current cache size (in buckets) for the hypercube in
     // the given row.
-    uInt cacheSize (uInt rownr) const;
+    uInt cacheSize (rownr_t rownr) const;
 
     // Get the hypercube shape of the data in the given row.
-    const IPosition& hypercubeShape (uInt rownr) const;
+    const IPosition& hypercubeShape (rownr_t rownr) const;
 
     // Get the tile shape of the data in the given row.
-    const IPosition& tileShape (uInt rownr) const;
+    const IPosition& tileShape (rownr_t rownr) const;
 
     // Get the bucket size (in bytes) of the hypercube in the given row.
-    uInt bucketSize (uInt rownr) const;
+    uInt bucketSize (rownr_t rownr) const;
 
     // Can the tiled storage manager handle changing array shapes?
     // The default is no (but TiledCellStMan can).
@@ -222,14 +268,14 @@ public:
     // new size is smaller.
     // <br>A flag is set indicating that the TSMDataColumn
     // access functions do not need to size the cache.
-    uInt calcCacheSize (uInt rownr, const IPosition& sliceShape,
+    uInt calcCacheSize (rownr_t rownr, const IPosition& sliceShape,
 			const IPosition& windowStart,
 			const IPosition& windowLength,
 			const IPosition& axisPath) const;
 
     // Set the cache size using the <src>calcCacheSize</src>
     // function mentioned above.
-    void setCacheSize (uInt rownr, const IPosition& sliceShape,
+    void setCacheSize (rownr_t rownr, const IPosition& sliceShape,
 		       const IPosition& windowStart,
 		       const IPosition& windowLength,
 		       const IPosition& axisPath,
@@ -242,14 +288,14 @@ public:
     // new size is smaller.
     // <br>A flag is set indicating that the TSMDataColumn
     // access functions do not need to size the cache.
-    void setCacheSize (uInt rownr, uInt nbuckets, Bool forceSmaller);
+    void setCacheSize (rownr_t rownr, uInt nbuckets, Bool forceSmaller);
 
     // Sets the cache size using the hypercube instead of the row number.
     // Useful for iterating over all hypercubes.
     void setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forceSmaller);
 
     // Determine if the user set the cache size (using setCacheSize).
-    Bool userSetCache (uInt rownr) const;
+    Bool userSetCache (rownr_t rownr) const;
 
     // Empty the caches used by the hypercubes in this storage manager.
     // It will flush the caches as needed and remove all buckets from them
@@ -270,7 +316,7 @@ public:
     uInt nrCoordVector() const;
 
     // Get the nr of rows in this storage manager.
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Does the storage manager allow to add rows? (yes)
     Bool canAddRow() const;
@@ -294,15 +340,19 @@ public:
     
     // Get the hypercube in which the given row is stored.
     // <group>
-    const TSMCube* getHypercube (uInt rownr) const;
-    virtual TSMCube* getHypercube (uInt rownr) = 0;
+    const TSMCube* getHypercube (rownr_t rownr) const;
+    virtual TSMCube* getHypercube (rownr_t rownr) = 0;
     // </group>
 
     // Get the hypercube in which the given row is stored.
     // It also returns the position of the row in that hypercube.
-    virtual TSMCube* getHypercube (uInt rownr, IPosition& position) = 0;
+    virtual TSMCube* getHypercube (rownr_t rownr, IPosition& position) = 0;
 
-    // Make the correct TSMCube type (depending on tsmOption()).
+    // Get the TSMOption to use for the files and hypercubes.
+    // It is tsmOption(), but the Cache option if compression is used.
+    TSMOption tsmFileOption() const;
+
+    // Make the correct TSMCube type (depending on tsmFileOption()).
     TSMCube* makeTSMCube (TSMFile* file, const IPosition& cubeShape,
                           const IPosition& tileShape,
                           const Record& values, Int64 fileOffset=-1);
@@ -321,10 +371,10 @@ public:
     TSMFile* getFile (uInt sequenceNumber);
 
     // Open the storage manager for an existing table.
-    virtual void open (uInt nrrow, AipsIO&);
+    virtual void open (rownr_t nrrow, AipsIO&);
 
     // Resync the storage manager with the new file contents.
-    virtual void resync (uInt nrrow);
+    virtual void resync (rownr_t nrrow);
 
     // Reopen all files used in this storage manager for read/write access.
     virtual void reopenRW();
@@ -358,7 +408,7 @@ public:
 
     // Set the shape and tile shape of a hypercube.
     // By default it throws an "impossible" exception.
-    virtual void setShape (uInt rownr, TSMCube* hypercube,
+    virtual void setShape (rownr_t rownr, TSMCube* hypercube,
 			   const IPosition& shape,
 			   const IPosition& tileShape);
 
@@ -439,7 +489,7 @@ protected:
     
     // Determine how many rows need to be added for an extension
     // (in the last dimension) of a hypercube with the given shape.
-    uInt addedNrrow (const IPosition& shape, uInt incrInLastDim) const;
+    rownr_t addedNrrow (const IPosition& shape, uInt incrInLastDim) const;
 
     // Flush the caches of all hypercubes.
     // If data have put and fsync is set, fsync all files.
@@ -447,7 +497,7 @@ protected:
 
     // Let a derived class read the header info.
     // This is used by the open and resync function.
-    virtual void readHeader (uInt nrrow, Bool firstTime) = 0;
+    virtual void readHeader (rownr_t nrrow, Bool firstTime) = 0;
 
     // Create the TSM header file.
     // It creates an AipsIO object for it.
@@ -464,7 +514,7 @@ protected:
     // Read the data from the header file.
     // When done for the first time, setup() is called to initialize
     // the various variables (using the extraNdim variable).
-    void headerFileGet (AipsIO& headerFile, uInt tabNrrow, Bool firstTime,
+    void headerFileGet (AipsIO& headerFile, rownr_t tabNrrow, Bool firstTime,
 			Int extraNdim);
 
     // Close the header file.
@@ -492,7 +542,7 @@ protected:
     // The name of the hypercolumn.
     String hypercolumnName_p;
     // The number of rows in the columns.
-    uInt  nrrow_p;
+    rownr_t  nrrow_p;
     // The assembly of all columns.
     PtrBlock<TSMColumn*>  colSet_p;
     // The assembly of all data columns.
@@ -512,6 +562,10 @@ protected:
     uInt      persMaxCacheSize_p;
     // The actual maximum cache size for a hypercube (in MiB).
     uInt      maxCacheSize_p;
+    // The compression codec for new hypercubes (empty = none).
+    String    compress_p;
+    // Are the section shapes accessed recorded?
+    Bool      recordAccess_p;
     // The dimensionality of the hypercolumn.
     uInt      nrdim_p;
     // The number of vector coordinates.
@@ -533,10 +587,16 @@ private:
 inline uInt TiledStMan::maximumCacheSize() const
     { return maxCacheSize_p; }
 
+inline const String& TiledStMan::compression() const
+    { return compress_p; }
+
+inline Bool TiledStMan::recordAccess() const
+    { return recordAccess_p; }
+
 inline uInt TiledStMan::nrCoordVector() const
     { return nrCoordVector_p; }
 
-inline uInt TiledStMan::nrow() const
+inline rownr_t TiledStMan::nrow() const
     { return nrrow_p; }
 
 inline uInt TiledStMan::nhypercubes() const
@@ -548,7 +608,7 @@ inline void TiledStMan::setDataChanged()
 inline const TSMCube* TiledStMan::getTSMCube (uInt hypercube) const
     { return const_cast<TiledStMan*>(this)->getTSMCube (hypercube); }
 
-inline const TSMCube* TiledStMan::getHypercube (uInt rownr) const
+inline const TSMCube* TiledStMan::getHypercube (rownr_t rownr) const
     { return const_cast<TiledStMan*>(this)->getHypercube (rownr); }
 
 inline void TiledStMan::setPersMaxCacheSize (uInt nMiB)
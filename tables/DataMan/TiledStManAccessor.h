@@ -125,6 +125,15 @@ class Record;
 // The 'get' functions get the information for the given hypercube,
 // while similar functions without the 'get' prefix do the same for the
 // given row.
+// <p>
+// A wrong tile shape can make access to the data very slow. To find
+// a better one, the shapes of the sections accessed in the hypercubes
+// can be recorded while running a typical workload. Thereafter
+// <src>adviseTileShape</src> gives the tile shape minimizing the number
+// of bytes read for that workload. The recorded patterns (a Record) can
+// be kept, e.g. as a column keyword, to advise at a later stage.
+// The data can be rewritten with the new tile shape using
+// <linkto class=TableCopy>TableCopy::retileColumns</linkto>.
 // </synopsis> 
 
 // <motivation>
@@ -190,19 +199,19 @@ public:
 
     // Get the current cache size (in buckets) for the hypercube in
     // the given row.
-    uInt cacheSize (uInt rownr) const;
+    uInt cacheSize (rownr_t rownr) const;
 
     // Get the hypercube shape of the data in the given row.
-    const IPosition& hypercubeShape (uInt rownr) const;
+    const IPosition& hypercubeShape (rownr_t rownr) const;
 
     // Get the tile shape of the data in the given row.
-    const IPosition& tileShape (uInt rownr) const;
+    const IPosition& tileShape (rownr_t rownr) const;
 
     // Get the bucket size (in bytes) of the hypercube in the given row.
-    uInt bucketSize (uInt rownr) const;
+    uInt bucketSize (rownr_t rownr) const;
 
     // Get coordinate and id values of the hypercube in the given row.
-    const Record& valueRecord (uInt rownr) const;
+    const Record& valueRecord (rownr_t rownr) const;
 
     // Return the number of hypercubes.
     uInt nhypercubes() const;
@@ -242,9 +251,9 @@ public:
     // The non-specified <src>axisPath</src> parts get the natural order.
     // E.g. in the previous example axisPath=[2] defines the same path.
     // <group>
-    uInt calcCacheSize (uInt rownr, const IPosition& sliceShape,
+    uInt calcCacheSize (rownr_t rownr, const IPosition& sliceShape,
 			const IPosition& axisPath) const;
-    uInt calcCacheSize (uInt rownr, const IPosition& sliceShape,
+    uInt calcCacheSize (rownr_t rownr, const IPosition& sliceShape,
 			const IPosition& windowStart,
 			const IPosition& windowLength,
 			const IPosition& axisPath) const;
@@ -255,10 +264,10 @@ public:
     // <br>When forceSmaller is False, the cache is not resized when the
     // new size is smaller.
     // <group>
-    void setCacheSize (uInt rownr, const IPosition& sliceShape,
+    void setCacheSize (rownr_t rownr, const IPosition& sliceShape,
 		       const IPosition& axisPath,
 		       Bool forceSmaller = True);
-    void setCacheSize (uInt rownr, const IPosition& sliceShape,
+    void setCacheSize (rownr_t rownr, const IPosition& sliceShape,
 		       const IPosition& windowStart,
 		       const IPosition& windowLength,
 		       const IPosition& axisPath,
@@ -270,12 +279,34 @@ public:
     // than 10%, the maximum cache size is used instead.
     // <br>When forceSmaller is False, the cache is not resized when the
     // new size is smaller.
-    void setCacheSize (uInt rownr, uInt nbuckets, Bool forceSmaller = True);
+    void setCacheSize (rownr_t rownr, uInt nbuckets, Bool forceSmaller = True);
 
     // This version allows setting the tile cache for a particular hypercube.  This
     // is useful when iterating over the hypercubes in an StMan.
     void setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forceSmaller = True);
 
+    // Switch recording of the section shapes accessed on or off.
+    // Switching it off clears the recorded shapes.
+    void setRecordAccess (Bool recordAccess);
+
+    // Get the recorded section shapes accessed in the hypercube containing
+    // the given row (or in the given hypercube) and how often they were
+    // accessed (as fields SHAPES and COUNTS).
+    // <group>
+    Record accessPatterns (rownr_t rownr) const;
+    Record getAccessPatterns (uInt hypercube) const;
+    // </group>
+
+    // Advise a tile shape for the hypercube containing the given row
+    // (or for the given hypercube) using the recorded section shapes
+    // (see <src>TiledStMan::adviseTileShape</src>).
+    // <group>
+    IPosition adviseTileShape (rownr_t rownr,
+                               uInt maxNrPixelsPerTile = 32768) const;
+    IPosition getAdvisedTileShape (uInt hypercube,
+                                   uInt maxNrPixelsPerTile = 32768) const;
+    // </group>
+
     // Clear the caches used by the hypercubes in this storage manager.
     // It will flush the caches as needed and remove all buckets from them
     // resulting in a possibly large drop in memory used.
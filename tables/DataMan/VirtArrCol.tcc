@@ -81,17 +81,17 @@ Bool VirtualArrayColumn<T>::canAccessColumnSlice (Bool& reask) const
 
 
 template<class T>
-void VirtualArrayColumn<T>::getArrayV (uInt rownr, void* dataPtr)
+void VirtualArrayColumn<T>::getArrayV (rownr_t rownr, void* dataPtr)
     { getArray (rownr, *static_cast<Array<T>*>(dataPtr)); }
 template<class T>
-void VirtualArrayColumn<T>::putArrayV (uInt rownr, const void* dataPtr)
+void VirtualArrayColumn<T>::putArrayV (rownr_t rownr, const void* dataPtr)
     { putArray (rownr, *static_cast<const Array<T>*>(dataPtr)); }
 template<class T>
-void VirtualArrayColumn<T>::getSliceV (uInt rownr, const Slicer& slicer,
+void VirtualArrayColumn<T>::getSliceV (rownr_t rownr, const Slicer& slicer,
 				       void* dataPtr)
     { getSlice (rownr, slicer, *static_cast<Array<T>*>(dataPtr)); }
 template<class T>
-void VirtualArrayColumn<T>::putSliceV (uInt rownr, const Slicer& slicer,
+void VirtualArrayColumn<T>::putSliceV (rownr_t rownr, const Slicer& slicer,
 				       const void* dataPtr)
     { putSlice (rownr, slicer, *static_cast<const Array<T>*>(dataPtr)); }
 template<class T>
@@ -132,7 +132,7 @@ void VirtualArrayColumn<T>::putColumnSliceCellsV (const RefRows& rownrs,
 //# The default implementations of get/putSlice get the entire array
 //# and access the required slice.
 template<class T>
-void VirtualArrayColumn<T>::getSlice (uInt rownr, const Slicer& slicer,
+void VirtualArrayColumn<T>::getSlice (rownr_t rownr, const Slicer& slicer,
 				      Array<T>& arraySlice)
 {
     //# Get the entire array and take the slice required.
@@ -145,7 +145,7 @@ void VirtualArrayColumn<T>::getSlice (uInt rownr, const Slicer& slicer,
     arraySlice = arr(start, end, stride);
 }
 template<class T>
-void VirtualArrayColumn<T>::putSlice (uInt rownr, const Slicer& slicer,
+void VirtualArrayColumn<T>::putSlice (rownr_t rownr, const Slicer& slicer,
 				      const Array<T>& arraySlice)
 {
     //# Get the entire array, store the slice required and put
@@ -166,7 +166,7 @@ template<class T>
 void VirtualArrayColumn<T>::getArrayColumn (Array<T>& array)
 {
     ArrayIterator<T> iter(array, array.ndim()-1);
-    uInt rownr = 0;
+    rownr_t rownr = 0;
     while (! iter.pastEnd()) {
 	getArray (rownr, iter.array());
 	rownr++;
@@ -177,7 +177,7 @@ template<class T>
 void VirtualArrayColumn<T>::putArrayColumn (const Array<T>& array)
 {
     ReadOnlyArrayIterator<T> iter(array, array.ndim()-1);
-    uInt rownr = 0;
+    rownr_t rownr = 0;
     while (! iter.pastEnd()) {
 	putArray (rownr, iter.array());
 	rownr++;
@@ -192,7 +192,7 @@ void VirtualArrayColumn<T>::getColumnSlice (const Slicer& slicer,
 					    Array<T>& array)
 {
     ArrayIterator<T> iter(array, array.ndim()-1);
-    uInt rownr = 0;
+    rownr_t rownr = 0;
     while (! iter.pastEnd()) {
 	getSlice (rownr, slicer, iter.array());
 	rownr++;
@@ -204,7 +204,7 @@ void VirtualArrayColumn<T>::putColumnSlice (const Slicer& slicer,
 					    const Array<T>& array)
 {
     ReadOnlyArrayIterator<T> iter(array, array.ndim()-1);
-    uInt rownr = 0;
+    rownr_t rownr = 0;
     while (! iter.pastEnd()) {
 	putSlice (rownr, slicer, iter.array());
 	rownr++;
@@ -220,9 +220,9 @@ void VirtualArrayColumn<T>::getArrayColumnCells (const RefRows& rownrs,
     ArrayIterator<T> iter(value, value.ndim()-1);
     RefRowsSliceIter rowiter(rownrs);
     while (! rowiter.pastEnd()) {
-        uInt rownr = rowiter.sliceStart();
-        uInt end = rowiter.sliceEnd();
-        uInt incr = rowiter.sliceIncr();
+        rownr_t rownr = rowiter.sliceStart();
+        rownr_t end = rowiter.sliceEnd();
+        rownr_t incr = rowiter.sliceIncr();
         while (rownr <= end) {
             if (! isFixedShape()) {
                 if (! iter.array().shape().isEqual (shape(rownr))) {
@@ -244,9 +244,9 @@ void VirtualArrayColumn<T>::putArrayColumnCells (const RefRows& rownrs,
     ReadOnlyArrayIterator<T> iter(value, value.ndim()-1);
     RefRowsSliceIter rowiter(rownrs);
     while (! rowiter.pastEnd()) {
-        uInt rownr = rowiter.sliceStart();
-        uInt end = rowiter.sliceEnd();
-        uInt incr = rowiter.sliceIncr();
+        rownr_t rownr = rowiter.sliceStart();
+        rownr_t end = rowiter.sliceEnd();
+        rownr_t incr = rowiter.sliceIncr();
         while (rownr <= end) {
   	    putArray (rownr, iter.array());
             rownr += incr;
@@ -263,9 +263,9 @@ void VirtualArrayColumn<T>::getColumnSliceCells (const RefRows& rownrs,
     ArrayIterator<T> iter(value, value.ndim()-1);
     RefRowsSliceIter rowiter(rownrs);
     while (! rowiter.pastEnd()) {
-        uInt rownr = rowiter.sliceStart();
-        uInt end = rowiter.sliceEnd();
-        uInt incr = rowiter.sliceIncr();
+        rownr_t rownr = rowiter.sliceStart();
+        rownr_t end = rowiter.sliceEnd();
+        rownr_t incr = rowiter.sliceIncr();
         while (rownr <= end) {
 	    getSlice (rownr, ns, iter.array());
             rownr += incr;
@@ -282,9 +282,9 @@ void VirtualArrayColumn<T>::putColumnSliceCells (const RefRows& rownrs,
     ReadOnlyArrayIterator<T> iter(value, value.ndim()-1);
     RefRowsSliceIter rowiter(rownrs);
     while (! rowiter.pastEnd()) {
-        uInt rownr = rowiter.sliceStart();
-        uInt end = rowiter.sliceEnd();
-        uInt incr = rowiter.sliceIncr();
+        rownr_t rownr = rowiter.sliceStart();
+        rownr_t end = rowiter.sliceEnd();
+        rownr_t incr = rowiter.sliceIncr();
         while (rownr <= end) {
 	    putSlice (rownr, ns, iter.array());
             rownr += incr;
@@ -297,7 +297,7 @@ void VirtualArrayColumn<T>::putColumnSliceCells (const RefRows& rownrs,
 //# The default implementation of the put function throws
 //# an exception.
 template<class T>
-void VirtualArrayColumn<T>::putArray (uInt, const Array<T>&)
+void VirtualArrayColumn<T>::putArray (rownr_t, const Array<T>&)
 { 
     throw DataManInvOper ("VirtualArrayColumn::putArray not possible"
                           " for column " + columnName());
@@ -312,24 +312,24 @@ void VirtualArrayColumn<T>::setShapeColumn (const IPosition&)
                           " for column " + columnName());
 }
 template<class T>
-void VirtualArrayColumn<T>::setShape (uInt, const IPosition&)
+void VirtualArrayColumn<T>::setShape (rownr_t, const IPosition&)
 {
     throw DataManInvOper ("VirtualArrayColumn::setShape not possible"
                           " for column " + columnName());
 }
 template<class T>
-Bool VirtualArrayColumn<T>::isShapeDefined (uInt)
+Bool VirtualArrayColumn<T>::isShapeDefined (rownr_t)
 {
     throw DataManInvOper ("VirtualArrayColumn::isShapeDefined not possible"
                           " for column " + columnName());
 }
 template<class T>
-uInt VirtualArrayColumn<T>::ndim (uInt rownr)
+uInt VirtualArrayColumn<T>::ndim (rownr_t rownr)
 {
     return shape(rownr).size();
 }
 template<class T>
-IPosition VirtualArrayColumn<T>::shape (uInt)
+IPosition VirtualArrayColumn<T>::shape (rownr_t)
 {
     throw DataManInvOper ("VirtualArrayColumn::shape not possible"
                           " for column " + columnName());
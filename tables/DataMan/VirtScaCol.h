@@ -144,11 +144,11 @@ public:
     virtual Bool isWritable() const;
 
     // Get the scalar value in the given row.
-    virtual void get (uInt rownr, T& data) = 0;
+    virtual void get (rownr_t rownr, T& data) = 0;
 
     // Put the scalar value into the given row.
     // The default implementation throws an exception.
-    virtual void put (uInt rownr, const T& data);
+    virtual void put (rownr_t rownr, const T& data);
 
 protected:
     // The class can handle a get/putScalarColumn.
@@ -174,7 +174,7 @@ protected:
     // a part of a column (for a cache for example).
     // The argument dataPtr is in fact a T*, but a void*
     // is needed to be generic. It must have length nrmax.
-    virtual uInt getBlock (uInt rownr, uInt nrmax, T* dataPtr);
+    virtual uInt getBlock (rownr_t rownr, uInt nrmax, T* dataPtr);
 
     // Put nrmax scalars from the given row on.
     // It returns the actual number of values put.
@@ -182,46 +182,46 @@ protected:
     // a part of a column (for a cache for example).
     // The argument dataPtr is in fact a const T*, but a const void*
     // is needed to be generic. It must have length nrmax.
-    virtual void putBlock (uInt rownr, uInt nrmax, const T* dataPtr);
+    virtual void putBlock (rownr_t rownr, uInt nrmax, const T* dataPtr);
 
 
 private:
     // Implement the virtual functions defined in DataManagerColumn.
     // Get the scalar value in the given row.
     // <group>
-    void getBoolV     (uInt rownr, Bool* dataPtr);
-    void getuCharV    (uInt rownr, uChar* dataPtr);
-    void getShortV    (uInt rownr, Short* dataPtr);
-    void getuShortV   (uInt rownr, uShort* dataPtr);
-    void getIntV      (uInt rownr, Int* dataPtr);
-    void getuIntV     (uInt rownr, uInt* dataPtr);
-    void getInt64V    (uInt rownr, Int64* dataPtr);
-    void getfloatV    (uInt rownr, float* dataPtr);
-    void getdoubleV   (uInt rownr, double* dataPtr);
-    void getComplexV  (uInt rownr, Complex* dataPtr);
-    void getDComplexV (uInt rownr, DComplex* dataPtr);
-    void getStringV   (uInt rownr, String* dataPtr);
+    void getBoolV     (rownr_t rownr, Bool* dataPtr);
+    void getuCharV    (rownr_t rownr, uChar* dataPtr);
+    void getShortV    (rownr_t rownr, Short* dataPtr);
+    void getuShortV   (rownr_t rownr, uShort* dataPtr);
+    void getIntV      (rownr_t rownr, Int* dataPtr);
+    void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    void getInt64V    (rownr_t rownr, Int64* dataPtr);
+    void getfloatV    (rownr_t rownr, float* dataPtr);
+    void getdoubleV   (rownr_t rownr, double* dataPtr);
+    void getComplexV  (rownr_t rownr, Complex* dataPtr);
+    void getDComplexV (rownr_t rownr, DComplex* dataPtr);
+    void getStringV   (rownr_t rownr, String* dataPtr);
     // This function is the get for all non-standard data types.
-    void getOtherV    (uInt rownr, void* dataPtr);
+    void getOtherV    (rownr_t rownr, void* dataPtr);
     // </group>
 
     // Implement the virtual functions defined in DataManagerColumn.
     // Put the scalar value into the given row.
     // <group>
-    void putBoolV     (uInt rownr, const Bool* dataPtr);
-    void putuCharV    (uInt rownr, const uChar* dataPtr);
-    void putShortV    (uInt rownr, const Short* dataPtr);
-    void putuShortV   (uInt rownr, const uShort* dataPtr);
-    void putIntV      (uInt rownr, const Int* dataPtr);
-    void putuIntV     (uInt rownr, const uInt* dataPtr);
-    void putInt64V    (uInt rownr, const Int64* dataPtr);
-    void putfloatV    (uInt rownr, const float* dataPtr);
-    void putdoubleV   (uInt rownr, const double* dataPtr);
-    void putComplexV  (uInt rownr, const Complex* dataPtr);
-    void putDComplexV (uInt rownr, const DComplex* dataPtr);
-    void putStringV   (uInt rownr, const String* dataPtr);
+    void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+    void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+    void putShortV    (rownr_t rownr, const Short* dataPtr);
+    void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+    void putIntV      (rownr_t rownr, const Int* dataPtr);
+    void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    void putInt64V    (rownr_t rownr, const Int64* dataPtr);
+    void putfloatV    (rownr_t rownr, const float* dataPtr);
+    void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+    void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
+    void putStringV   (rownr_t rownr, const String* dataPtr);
     // This function is the put for all non-standard data types.
-    void putOtherV    (uInt rownr, const void* dataPtr);
+    void putOtherV    (rownr_t rownr, const void* dataPtr);
     // </group>
 
     // Implement the virtual functions defined in DataManagerColumn.
@@ -234,11 +234,11 @@ private:
 
     // Implement the virtual functions defined in DataManagerColumn.
     // Get scalars from the given row on with a maximum of nrmax values.
-    uInt getBlockV (uInt rownr, uInt nrmax, void* dataPtr);
+    uInt getBlockV (rownr_t rownr, uInt nrmax, void* dataPtr);
 
     // Implement the virtual functions defined in DataManagerColumn.
     // Put nrmax scalars from the given row on.
-    void putBlockV (uInt rownr, uInt nrmax, const void* dataPtr);
+    void putBlockV (rownr_t rownr, uInt nrmax, const void* dataPtr);
 
 private:
     // The object cannot be copied.
@@ -258,7 +258,7 @@ private:
 // <group name=getVirtualScalarColumn>
 template<class T>
 inline void getVirtualScalarColumn (VirtualScalarColumn<T>* col,
-                                    uInt rownr, T* dataPtr)
+                                    rownr_t rownr, T* dataPtr)
     { col->get (rownr, *dataPtr); }
 inline void getVirtualScalarColumn (DataManagerColumn* col,
 				    uInt, void*)
@@ -266,7 +266,7 @@ inline void getVirtualScalarColumn (DataManagerColumn* col,
 
 template<class T>
 inline void putVirtualScalarColumn (VirtualScalarColumn<T>* col,
-                                    uInt rownr, const T* dataPtr)
+                                    rownr_t rownr, const T* dataPtr)
     { col->put (rownr, *dataPtr); }
 inline void putVirtualScalarColumn (DataManagerColumn* col,
 				    uInt, const void*)
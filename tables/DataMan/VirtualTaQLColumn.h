@@ -133,9 +133,9 @@ public:
   // <group>
   virtual int dataType() const;
   virtual Bool isWritable() const;
-  virtual uInt ndim (uInt rownr);
-  virtual IPosition shape (uInt rownr);
-  virtual Bool isShapeDefined (uInt rownr);
+  virtual uInt ndim (rownr_t rownr);
+  virtual IPosition shape (rownr_t rownr);
+  virtual Bool isShapeDefined (rownr_t rownr);
   // </group>
 
 private:
@@ -156,7 +156,7 @@ private:
 
   // Let the engine initialize the object for a new table.
   // It defines a column keyword holding the expression.
-  virtual void create (uInt);
+  virtual void create (rownr_t);
 
   // Prepare compiles the expression.
   virtual void prepare();
@@ -170,18 +170,18 @@ private:
   // Get the scalar value in the given row.
   // The default implementation throws an "invalid operation" exception.
   // <group>
-  virtual void getBoolV     (uInt rownr, Bool* dataPtr);
-  virtual void getuCharV    (uInt rownr, uChar* dataPtr);
-  virtual void getShortV    (uInt rownr, Short* dataPtr);
-  virtual void getuShortV   (uInt rownr, uShort* dataPtr);
-  virtual void getIntV      (uInt rownr, Int* dataPtr);
-  virtual void getuIntV     (uInt rownr, uInt* dataPtr);
-  virtual void getInt64V    (uInt rownr, Int64* dataPtr);
-  virtual void getfloatV    (uInt rownr, float* dataPtr);
-  virtual void getdoubleV   (uInt rownr, double* dataPtr);
-  virtual void getComplexV  (uInt rownr, Complex* dataPtr);
-  virtual void getDComplexV (uInt rownr, DComplex* dataPtr);
-  virtual void getStringV   (uInt rownr, String* dataPtr);
+  virtual void getBoolV     (rownr_t rownr, Bool* dataPtr);
+  virtual void getuCharV    (rownr_t rownr, uChar* dataPtr);
+  virtual void getShortV    (rownr_t rownr, Short* dataPtr);
+  virtual void getuShortV   (rownr_t rownr, uShort* dataPtr);
+  virtual void getIntV      (rownr_t rownr, Int* dataPtr);
+  virtual void getuIntV     (rownr_t rownr, uInt* dataPtr);
+  virtual void getInt64V    (rownr_t rownr, Int64* dataPtr);
+  virtual void getfloatV    (rownr_t rownr, float* dataPtr);
+  virtual void getdoubleV   (rownr_t rownr, double* dataPtr);
+  virtual void getComplexV  (rownr_t rownr, Complex* dataPtr);
+  virtual void getDComplexV (rownr_t rownr, DComplex* dataPtr);
+  virtual void getStringV   (rownr_t rownr, String* dataPtr);
   // </group>
 
   // Get the array value in the given row.
@@ -190,10 +190,10 @@ private:
   // The array pointed to by dataPtr has to have the correct shape
   // (which is guaranteed by the ArrayColumn get function).
   // The default implementation throws an "invalid operation" exception.
-  virtual void getArrayV (uInt rownr, void* dataPtr);
+  virtual void getArrayV (rownr_t rownr, void* dataPtr);
 
   // Get the array result into itsCurResult.
-  IPosition getResult (uInt rownr);
+  IPosition getResult (rownr_t rownr);
 
   // Make the result cache.
   void makeCurResult();
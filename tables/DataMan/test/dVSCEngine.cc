@@ -73,7 +73,7 @@ DataManager* VSCExampleVSCEngine::clone() const
 
 
 // Store the target column names in the keywords of this column.
-void VSCExampleVSCEngine::create (uInt)
+void VSCExampleVSCEngine::create (rownr_t)
 {
     TableColumn src (table(), sourceColumnName());
     src.rwKeywordSet().define ("_xTargetName", xTargetName_p);
@@ -92,12 +92,12 @@ void VSCExampleVSCEngine::prepare()
     coly.attach (table(), yTargetName_p);
 }
 
-void VSCExampleVSCEngine::get (uInt rownr, VSCExample& value)
+void VSCExampleVSCEngine::get (rownr_t rownr, VSCExample& value)
 {
     colx.get (rownr, value.x());
     coly.get (rownr, value.y());
 }
-void VSCExampleVSCEngine::put (uInt rownr, const VSCExample& value)
+void VSCExampleVSCEngine::put (rownr_t rownr, const VSCExample& value)
 {
     colx.put (rownr, value.x());
     coly.put (rownr, value.y());
@@ -0,0 +1,200 @@
+//# tISMRandomAccess.cc: Test program for random access in the IncrementalStMan
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for random access of scalar columns in the IncrementalStMan,
+// which uses an interval map once many rows are accessed out of order.
+// It checks that the map is discarded when the column changes.
+// </summary>
+
+// The expected values. Row 5000 in column TIME is a single changed value.
+Int intValue (rownr_t row)
+  { return row/7; }
+Double timeValue (rownr_t row)
+  { return (row == 5000  ?  -1. : 4.5e9 + (row/50)*10.); }
+String strValue (rownr_t row)
+  { return "scan_" + String::toString(row/300); }
+Bool boolValue (rownr_t row)
+  { return (row/1000) % 2 == 0; }
+
+void makeTable (const String& name, uInt nrow)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ID"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<String> ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Bool> ("FLAG"));
+  // Use small buckets, so there are many.
+  IncrementalStMan stman ("ISM", 1000);
+  SetupNewTable newtab(name, td, Table::New);
+  newtab.bindAll (stman);
+  Table table(newtab, nrow);
+  ScalarColumn<Int> idcol (table, "ID");
+  ScalarColumn<Double> timecol (table, "TIME");
+  ScalarColumn<String> scancol (table, "SCAN");
+  ScalarColumn<Bool> flagcol (table, "FLAG");
+  for (uInt i=0; i<nrow; ++i) {
+    idcol.put (i, intValue(i));
+    timecol.put (i, i==5000 ? timeValue(i+1) : timeValue(i));
+    scancol.put (i, strValue(i));
+    flagcol.put (i, boolValue(i));
+  }
+  // Change a single row.
+  timecol.put (5000, timeValue(5000));
+}
+
+// Get a pseudo-random permutation of the rows.
+Vector<rownr_t> randomRows (rownr_t nrow)
+{
+  Vector<rownr_t> rows(nrow);
+  for (rownr_t i=0; i<nrow; ++i) {
+    rows[i] = i;
+  }
+  uInt seed = 12345;
+  for (rownr_t i=nrow-1; i>0; --i) {
+    seed = seed * 1103515245 + 12345;
+    std::swap (rows[i], rows[(seed/65536) % (i+1)]);
+  }
+  return rows;
+}
+
+void checkRandom (const Table& table, rownr_t offset)
+{
+  ScalarColumn<Int> idcol (table, "ID");
+  ScalarColumn<Double> timecol (table, "TIME");
+  ScalarColumn<String> scancol (table, "SCAN");
+  ScalarColumn<Bool> flagcol (table, "FLAG");
+  Vector<rownr_t> rows = randomRows (table.nrow());
+  for (rownr_t i=0; i<rows.size(); ++i) {
+    rownr_t row = rows[i];
+    AlwaysAssertExit (idcol(row) == intValue(row+offset));
+    AlwaysAssertExit (timecol(row) == timeValue(row+offset));
+    AlwaysAssertExit (scancol(row) == strValue(row+offset));
+    AlwaysAssertExit (flagcol(row) == boolValue(row+offset));
+  }
+  // Get the cells in random order.
+  Vector<Double> times = timecol.getColumnCells (RefRows(rows));
+  Vector<String> scans = scancol.getColumnCells (RefRows(rows));
+  for (rownr_t i=0; i<rows.size(); ++i) {
+    AlwaysAssertExit (times[i] == timeValue(rows[i]+offset));
+    AlwaysAssertExit (scans[i] == strValue(rows[i]+offset));
+  }
+  // Get the cells with a stride.
+  Vector<Int> ids = idcol.getColumnCells (RefRows(3, table.nrow()-1, 5));
+  for (rownr_t i=0; i<ids.size(); ++i) {
+    AlwaysAssertExit (ids[i] == intValue(3+5*i+offset));
+  }
+  // Get the entire column.
+  Vector<Int> allIds = idcol.getColumn();
+  Vector<Double> allTimes = timecol.getColumn();
+  Vector<String> allScans = scancol.getColumn();
+  Vector<Bool> allFlags = flagcol.getColumn();
+  for (rownr_t i=0; i<table.nrow(); ++i) {
+    AlwaysAssertExit (allIds[i] == intValue(i+offset));
+    AlwaysAssertExit (allTimes[i] == timeValue(i+offset));
+    AlwaysAssertExit (allScans[i] == strValue(i+offset));
+    AlwaysAssertExit (allFlags[i] == boolValue(i+offset));
+  }
+  // A part of the column.
+  Vector<Double> part = timecol.getColumnRange (Slicer(IPosition(1,4990),
+                                                       IPosition(1,20)));
+  AlwaysAssertExit (allEQ (part, allTimes(Slice(4990,20))));
+  cout << "checked " << table.nrow() << " rows in random order" << endl;
+}
+
+// Get the entire columns before any random access, so without a map.
+void checkColumn (const Table& table)
+{
+  Vector<Int> allIds = ScalarColumn<Int>(table, "ID").getColumn();
+  Vector<Double> allTimes = ScalarColumn<Double>(table, "TIME").getColumn();
+  Vector<String> allScans = ScalarColumn<String>(table, "SCAN").getColumn();
+  Vector<Bool> allFlags = ScalarColumn<Bool>(table, "FLAG").getColumn();
+  for (rownr_t i=0; i<table.nrow(); ++i) {
+    AlwaysAssertExit (allIds[i] == intValue(i));
+    AlwaysAssertExit (allTimes[i] == timeValue(i));
+    AlwaysAssertExit (allScans[i] == strValue(i));
+    AlwaysAssertExit (allFlags[i] == boolValue(i));
+  }
+  cout << "checked " << table.nrow() << " rows of the entire columns" << endl;
+}
+
+void testUpdate (const String& name)
+{
+  Table table(name, Table::Update);
+  checkRandom (table, 0);
+  ScalarColumn<Double> timecol (table, "TIME");
+  ScalarColumn<String> scancol (table, "SCAN");
+  // Changing a value must be seen after the map has been built.
+  AlwaysAssertExit (timecol(7001) == timeValue(7001));
+  timecol.put (7001, 1.);
+  AlwaysAssertExit (timecol(7001) == 1.);
+  AlwaysAssertExit (timecol(7000) == timeValue(7000));
+  AlwaysAssertExit (timecol(7002) == timeValue(7002));
+  AlwaysAssertExit (timecol.getColumn()[7001] == 1.);
+  timecol.put (7001, timeValue(7001));
+  // Added rows get the last value.
+  rownr_t nrow = table.nrow();
+  table.addRow (10);
+  AlwaysAssertExit (scancol(nrow+5) == strValue(nrow-1));
+  AlwaysAssertExit (scancol.getColumn()[nrow+9] == strValue(nrow-1));
+  table.removeRow (Vector<rownr_t>(1, nrow+5));
+  AlwaysAssertExit (table.nrow() == nrow+9);
+  for (uInt i=0; i<9; ++i) {
+    table.removeRow (nrow);
+  }
+  // Removing the first row shifts all values.
+  table.removeRow (0);
+  checkRandom (table, 1);
+}
+
+int main()
+{
+  try {
+    makeTable ("tISMRandomAccess_tmp.data", 20000);
+    checkColumn (Table("tISMRandomAccess_tmp.data"));
+    checkRandom (Table("tISMRandomAccess_tmp.data"), 0);
+    testUpdate ("tISMRandomAccess_tmp.data");
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
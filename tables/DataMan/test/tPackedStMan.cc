@@ -0,0 +1,326 @@
+//# tPackedStMan.cc: Test program for the PackedStMan storage manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/DataMan/PackedStMan.h>
+#include <casacore/tables/DataMan/PSMCodec.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/Utilities/DataType.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <limits>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the PackedStMan storage manager
+// </summary>
+
+// This program tests the encoding of the PackedStMan storage manager
+// and the get and put functions of its columns.
+// The results are written to stdout. The script executing this program,
+// compares the results with the reference output file.
+
+
+const char* methodName (PSMCodec::Method method)
+{
+  switch (method) {
+  case PSMCodec::Raw:
+    return "Raw";
+  case PSMCodec::FrameOfRef:
+    return "FrameOfRef";
+  case PSMCodec::Delta:
+    return "Delta";
+  case PSMCodec::Dictionary:
+    return "Dictionary";
+  }
+  return "?";
+}
+
+// Encode and decode the values and check if they are the same.
+// The decode is done for more values to check they are set to zero.
+template<typename T>
+void checkCodec (const String& name, const T* values, uInt nrval)
+{
+  int dt = whatType ((T*)0);
+  std::vector<uChar> buf;
+  PSMCodec::encode (buf, dt, values, nrval);
+  AlwaysAssertExit (PSMCodec::nrValues(buf) == nrval);
+  Block<T> result(nrval + 5, T(1));
+  PSMCodec::decode (result.storage(), dt, buf, result.size());
+  for (uInt i=0; i<nrval; ++i) {
+    AlwaysAssertExit (memcmp (&result[i], &values[i], sizeof(T)) == 0);
+  }
+  for (uInt i=nrval; i<result.size(); ++i) {
+    AlwaysAssertExit (result[i] == T(0));
+  }
+  cout << name << ": " << methodName(PSMCodec::method(buf))
+       << ' ' << nrval << " values in " << buf.size()
+       << " bytes" << endl;
+}
+template<typename T>
+void checkCodec (const String& name, const std::vector<T>& values)
+{
+  checkCodec (name, &(values[0]), values.size());
+}
+
+void testCodec()
+{
+  std::vector<Int> constant(1000, -17);
+  checkCodec ("constant Int", constant);
+  std::vector<Int> antenna(1000);
+  for (size_t i=0; i<antenna.size(); ++i) {
+    antenna[i] = i%27;
+  }
+  checkCodec ("antenna Int", antenna);
+  std::vector<Int64> rownr(1000);
+  for (size_t i=0; i<rownr.size(); ++i) {
+    rownr[i] = (Int64(1)<<40) + i*3;
+  }
+  checkCodec ("rownr Int64", rownr);
+  std::vector<Short> negative(1000);
+  for (size_t i=0; i<negative.size(); ++i) {
+    negative[i] = Short(i%7) - 3;
+  }
+  checkCodec ("negative Short", negative);
+  std::vector<uShort> bigus(300);
+  for (size_t i=0; i<bigus.size(); ++i) {
+    bigus[i] = (i%2 == 0  ?  0 : 65535);
+  }
+  checkCodec ("extreme uShort", bigus);
+  Block<Bool> flags(999);
+  for (size_t i=0; i<flags.size(); ++i) {
+    flags[i] = (i%10 == 0);
+  }
+  checkCodec ("flags Bool", flags.storage(), flags.size());
+  std::vector<uChar> uchars(77);
+  for (size_t i=0; i<uchars.size(); ++i) {
+    uchars[i] = 200 + i%5;
+  }
+  checkCodec ("uChar", uchars);
+  std::vector<uInt> uints(513);
+  for (size_t i=0; i<uints.size(); ++i) {
+    uints[i] = 4000000000u - i*1000;
+  }
+  checkCodec ("decreasing uInt", uints);
+  std::vector<double> times(1000);
+  for (size_t i=0; i<times.size(); ++i) {
+    times[i] = 4.8e9 + 10.*(i/50);
+  }
+  checkCodec ("time double", times);
+  std::vector<double> random(1000);
+  uInt64 seed = 12345;
+  for (size_t i=0; i<random.size(); ++i) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    random[i] = double(seed>>11) / double(uInt64(1)<<53);
+  }
+  checkCodec ("random double", random);
+  std::vector<float> floats(100);
+  for (size_t i=0; i<floats.size(); ++i) {
+    floats[i] = (i%3 == 0  ?  -0.f : float(i%3) * 1.5f);
+  }
+  floats[50] = std::numeric_limits<float>::quiet_NaN();
+  floats[51] = std::numeric_limits<float>::infinity();
+  checkCodec ("special float", floats);
+  std::vector<double> single(1, 3.14);
+  checkCodec ("single double", single);
+  // An empty bucket decodes to zeros.
+  std::vector<uChar> empty;
+  Int zeros[4] = {1,2,3,4};
+  PSMCodec::decode (zeros, TpInt, empty, 4);
+  AlwaysAssertExit (zeros[0]==0 && zeros[1]==0 && zeros[2]==0 && zeros[3]==0);
+}
+
+
+void fillColumns (Table& tab, rownr_t strow, rownr_t nrow)
+{
+  ScalarColumn<Int> ant(tab, "ANT");
+  ScalarColumn<double> time(tab, "TIME");
+  ScalarColumn<Bool> flag(tab, "FLAG");
+  ScalarColumn<Short> sh(tab, "SHORT");
+  for (rownr_t i=strow; i<strow+nrow; ++i) {
+    ant.put (i, i%27);
+    time.put (i, 4.8e9 + 10.*(i/50));
+    flag.put (i, i%10 == 0);
+    sh.put (i, Short(i%7) - 3);
+  }
+}
+
+// Check the column values of the given rows, where values from the
+// given row on are shifted by the given number of rows.
+void checkColumns (const Table& tab, rownr_t nrow, rownr_t skipRow=0,
+                   rownr_t nrskip=0)
+{
+  AlwaysAssertExit (tab.nrow() == nrow);
+  ScalarColumn<Int> ant(tab, "ANT");
+  ScalarColumn<double> time(tab, "TIME");
+  ScalarColumn<Bool> flag(tab, "FLAG");
+  ScalarColumn<Short> sh(tab, "SHORT");
+  Vector<Int> antv = ant.getColumn();
+  Vector<double> timev = time.getColumn();
+  Vector<Bool> flagv = flag.getColumn();
+  Vector<Short> shv = sh.getColumn();
+  for (rownr_t i=0; i<nrow; ++i) {
+    rownr_t j = (i < skipRow  ?  i : i+nrskip);
+    AlwaysAssertExit (ant(i) == Int(j%27)  &&  antv(i) == Int(j%27));
+    AlwaysAssertExit (time(i) == 4.8e9 + 10.*(j/50)  &&
+                      timev(i) == time(i));
+    AlwaysAssertExit (flag(i) == (j%10 == 0)  &&  flagv(i) == flag(i));
+    AlwaysAssertExit (sh(i) == Short(j%7) - 3  &&  shv(i) == sh(i));
+  }
+  // Get a part of the column crossing bucket boundaries.
+  if (nrow > 2200) {
+    Vector<Int> part = ant.getColumnRange (Slicer(IPosition(1,990),
+                                                  IPosition(1,1200)));
+    for (uInt i=0; i<part.size(); ++i) {
+      AlwaysAssertExit (part(i) == antv(990+i));
+    }
+  }
+}
+
+void createTable (const String& name, const DataManager& stman,
+                  rownr_t nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int> ("ANT"));
+  td.addColumn (ScalarColumnDesc<double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Bool> ("FLAG"));
+  td.addColumn (ScalarColumnDesc<Short> ("SHORT"));
+  SetupNewTable newtab(name, td, Table::New);
+  newtab.bindAll (stman);
+  Table tab(newtab, nrow);
+  fillColumns (tab, 0, nrow);
+}
+
+void testTable()
+{
+  createTable ("tPackedStMan_tmp.data", PackedStMan("PSM", 1000), 10000);
+  createTable ("tPackedStMan_tmp.ssm", StandardStMan("SSM"), 10000);
+  {
+    Table tab("tPackedStMan_tmp.data");
+    checkColumns (tab, 10000);
+    Record dminfo = tab.dataManagerInfo().subRecord(0);
+    cout << dminfo.asString("TYPE") << ' ' << dminfo.asString("NAME")
+         << " BUCKETROWS=" << dminfo.subRecord("SPEC").asInt("BUCKETROWS")
+         << endl;
+    // Compare the size with the StandardStMan.
+    Int64 psmSize = Directory("tPackedStMan_tmp.data").size();
+    Int64 ssmSize = Directory("tPackedStMan_tmp.ssm").size();
+    cout << "PackedStMan is smaller than StandardStMan: "
+         << (psmSize < ssmSize) << endl;
+  }
+  {
+    // Put entire columns and check them after reopen.
+    Table tab("tPackedStMan_tmp.data", Table::Update);
+    ScalarColumn<Int> ant(tab, "ANT");
+    Vector<Int> antv = ant.getColumn();
+    ant.putColumn (Vector<Int>(tab.nrow(), 5));
+    AlwaysAssertExit (allEQ (ant.getColumn(), 5));
+    ant.put (1500, 6);
+    AlwaysAssertExit (ant(1500) == 6  &&  ant(1499) == 5);
+    ant.putColumn (antv);
+  }
+  {
+    Table tab("tPackedStMan_tmp.data", Table::Update);
+    checkColumns (tab, 10000);
+    // Added rows get value zero.
+    tab.addRow (1500);
+    ScalarColumn<Int> ant(tab, "ANT");
+    ScalarColumn<double> time(tab, "TIME");
+    for (rownr_t i=10000; i<11500; ++i) {
+      AlwaysAssertExit (ant(i) == 0  &&  time(i) == 0.);
+    }
+    fillColumns (tab, 10000, 1500);
+  }
+  {
+    Table tab("tPackedStMan_tmp.data", Table::Update);
+    checkColumns (tab, 11500);
+    // Remove rows; the values of later rows shift.
+    tab.removeRow (999);
+    tab.removeRow (999);
+    checkColumns (tab, 11498, 999, 2);
+  }
+  {
+    Table tab("tPackedStMan_tmp.data", Table::Update);
+    checkColumns (tab, 11498, 999, 2);
+    // Add and remove a column.
+    tab.addColumn (ScalarColumnDesc<uInt> ("UINT"), "PSM2");
+    ScalarColumn<uInt> ucol(tab, "UINT");
+    Vector<uInt> uv(tab.nrow());
+    indgen (uv);
+    ucol.putColumn (uv);
+    tab.removeColumn ("SHORT");
+    cout << "ncolumn=" << tab.tableDesc().ncolumn() << endl;
+  }
+  {
+    Table tab("tPackedStMan_tmp.data");
+    ScalarColumn<uInt> ucol(tab, "UINT");
+    for (rownr_t i=0; i<tab.nrow(); ++i) {
+      AlwaysAssertExit (ucol(i) == i);
+    }
+    cout << "nrow=" << tab.nrow() << endl;
+  }
+  // Strings and arrays cannot be stored.
+  {
+    TableDesc td;
+    td.addColumn (ScalarColumnDesc<String> ("STR"));
+    SetupNewTable newtab("tPackedStMan_tmp.str", td, Table::New);
+    PackedStMan stman;
+    try {
+      newtab.bindAll (stman);
+      Table tab(newtab, 10);
+      cout << "String column incorrectly accepted" << endl;
+    } catch (const DataManInvDT& x) {
+      cout << "String column not accepted" << endl;
+    }
+  }
+}
+
+int main()
+{
+  try {
+    testCodec();
+    testTable();
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,183 @@
+//# tTSMAdvise.cc: Test program for the tile shape advisor and retiling
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableCopy.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for recording the access patterns of a tiled column,
+// advising a tile shape, and rewriting the column with that tile shape.
+// </summary>
+
+Matrix<Float> makeData (uInt row)
+{
+  Matrix<Float> data(16,64);
+  indgen (data, Float(row*1000));
+  return data;
+}
+
+void makeTable (const String& name, uInt nrow)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Float> ("Data", IPosition(2,16,64),
+                                        ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Float> ("Weight", IPosition(2,16,64),
+                                        ColumnDesc::FixedShape));
+  td.defineHypercolumn ("TSMData", 3, stringToVector("Data,Weight"));
+  // A tile per row, which is bad for accessing a channel in all rows.
+  TiledShapeStMan sm1 ("TSMData", IPosition(3,16,64,1));
+  SetupNewTable newtab(name, td, Table::New);
+  newtab.bindAll (sm1);
+  Table table(newtab, nrow);
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Float> weight (table, "Weight");
+  for (uInt i=0; i<nrow; ++i) {
+    data.put (i, makeData(i));
+    weight.put (i, makeData(i) + Float(0.5));
+  }
+  data.rwKeywordSet().define ("UNIT", "Jy");
+}
+
+// Read a few channels in all rows and a few cells.
+void doWorkload (const Table& table)
+{
+  ArrayColumn<Float> data (table, "Data");
+  for (uInt i=0; i<10; ++i) {
+    Array<Float> chan = data.getColumn (Slicer(IPosition(2,0,i),
+                                               IPosition(2,16,1)));
+    AlwaysAssertExit (chan.shape() == IPosition(3,16,1,table.nrow()));
+  }
+  for (uInt i=0; i<4; ++i) {
+    AlwaysAssertExit (allEQ (data(i*10), makeData(i*10)));
+  }
+}
+
+void testAdvise (const String& name)
+{
+  Table table(name);
+  ROTiledStManAccessor accessor (table, "TSMData");
+  accessor.setRecordAccess (True);
+  doWorkload (table);
+  Record patterns = accessor.accessPatterns (0);
+  AlwaysAssertExit (allEQ (patterns.asArrayInt("SHAPES"),
+                    accessor.getAccessPatterns(1).asArrayInt("SHAPES")));
+  cout << "shapes " << patterns.asArrayInt("SHAPES") << endl;
+  cout << "counts " << patterns.asArrayInt64("COUNTS") << endl;
+  IPosition cubeShape = accessor.hypercubeShape (0);
+  IPosition advised = accessor.adviseTileShape (0);
+  cout << "advised tile shape " << advised << endl;
+  AlwaysAssertExit (advised.isEqual (TiledStMan::adviseTileShape
+                                     (cubeShape, patterns)));
+  AlwaysAssertExit (advised.isEqual (accessor.getAdvisedTileShape (1)));
+  AlwaysAssertExit (advised.product() <= 32768);
+  Double oldCost = TiledStMan::accessCost (cubeShape,
+                                           accessor.tileShape(0), patterns);
+  Double newCost = TiledStMan::accessCost (cubeShape, advised, patterns);
+  cout << "cost reduced by factor >10: " << (newCost*10 < oldCost) << endl;
+  // A smaller maximum tile size.
+  cout << "advised tile shape " << accessor.adviseTileShape (0, 1024)
+       << " for max 1024 pixels" << endl;
+  // No patterns gives the same cost for every shape, thus the first one.
+  Record empty;
+  empty.define ("SHAPES", Matrix<Int>(3,0));
+  empty.define ("COUNTS", Vector<Int64>());
+  AlwaysAssertExit (TiledStMan::accessCost (cubeShape, advised, empty) == 0);
+  // Switching off clears the patterns.
+  accessor.setRecordAccess (False);
+  doWorkload (table);
+  AlwaysAssertExit (accessor.accessPatterns(0).asArrayInt64("COUNTS").empty());
+}
+
+void testRetile (const String& name)
+{
+  Table table(name, Table::Update);
+  IPosition advised;
+  {
+    ROTiledStManAccessor accessor (table, "TSMData");
+    accessor.setRecordAccess (True);
+    doWorkload (table);
+    advised = accessor.adviseTileShape (0);
+  }
+  // All columns of the storage manager have to be given.
+  try {
+    TableCopy::retileColumns (table, Vector<String>(1, "Data"), "TSMNew",
+                              advised);
+    AlwaysAssertExit (False);
+  } catch (const TableError& x) {
+    cout << "Expected exception: " << x.getMesg() << endl;
+  }
+  TableCopy::retileColumns (table, stringToVector("Data,Weight"), "TSMNew",
+                            advised, 16);
+  ROTiledStManAccessor accessor (table, "TSMNew");
+  cout << "new tile shape " << accessor.tileShape(0) << endl;
+  AlwaysAssertExit (accessor.tileShape(0).isEqual (advised));
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Float> weight (table, "Weight");
+  cout << "Data keyword UNIT " << data.keywordSet().asString("UNIT") << endl;
+  for (uInt i=0; i<table.nrow(); ++i) {
+    AlwaysAssertExit (allEQ (data(i), makeData(i)));
+    AlwaysAssertExit (allEQ (weight(i), makeData(i) + Float(0.5)));
+  }
+}
+
+int main()
+{
+  try {
+    makeTable ("tTSMAdvise_tmp.data", 200);
+    testAdvise ("tTSMAdvise_tmp.data");
+    testRetile ("tTSMAdvise_tmp.data");
+    // Check the table after reopening.
+    Table table("tTSMAdvise_tmp.data");
+    ArrayColumn<Float> data (table, "Data");
+    AlwaysAssertExit (allEQ (data(199), makeData(199)));
+    cout << table.dataManagerInfo().nfields() << " data manager" << endl;
+    cout << "Data in " << table.findDataManager("Data", True)
+                            ->dataManagerName() << endl;
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,312 @@
+//# tTSMCodec.cc: Test program for compression of tiles in the TSM
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/DataMan/TSMCodec.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for compression of tiles in the Tiled Storage Manager
+// </summary>
+
+// Compress and decompress a buffer with a float and an int block.
+void testCodec()
+{
+  uInt nval = 1000;
+  uInt length = nval*sizeof(Float) + nval*sizeof(Int);
+  Block<uInt> offsets(2);
+  Block<uInt> sizes(2);
+  offsets[0] = 0;
+  offsets[1] = nval*sizeof(Float);
+  sizes[0] = sizeof(Float);
+  sizes[1] = sizeof(Int);
+  std::vector<char> in(length);
+  Float* fdata = (Float*)(in.data());
+  Int*   idata = (Int*)(in.data() + offsets[1]);
+  for (uInt i=0; i<nval; ++i) {
+    fdata[i] = 1 + i/1000.;
+    idata[i] = i;
+  }
+  std::vector<char> comp(length + TSMCodec::headerSize());
+  std::vector<char> out(length);
+  uInt clen = TSMCodec::compress ("shuffle-zlib", comp.data(), in.data(),
+                                  length, offsets, sizes);
+  AlwaysAssertExit (clen == TSMCodec::compressedLength (comp.data()));
+  cout << "smooth data compressed: " << (clen < length/2) << endl;
+  TSMCodec::decompress (out.data(), length, comp.data(), offsets, sizes);
+  AlwaysAssertExit (memcmp (in.data(), out.data(), length) == 0);
+  // Pseudo-random data do not compress, so they are stored as such.
+  uInt seed = 1;
+  for (uInt i=0; i<length; ++i) {
+    seed = seed*1103515245 + 12345;
+    in[i] = char(seed >> 16);
+  }
+  clen = TSMCodec::compress ("shuffle-zlib", comp.data(), in.data(),
+                             length, offsets, sizes);
+  cout << "random data stored uncompressed: "
+       << (clen == length + TSMCodec::headerSize()) << endl;
+  TSMCodec::decompress (out.data(), length, comp.data(), offsets, sizes);
+  AlwaysAssertExit (memcmp (in.data(), out.data(), length) == 0);
+  // Constant blocks are stored as a single value for each codec.
+  for (uInt i=0; i<nval; ++i) {
+    fdata[i] = -2.5;
+    idata[i] = 7;
+  }
+  clen = TSMCodec::compress ("sparse", comp.data(), in.data(),
+                             length, offsets, sizes);
+  cout << "constant tile length: " << clen << endl;
+  TSMCodec::decompress (out.data(), length, comp.data(), offsets, sizes);
+  AlwaysAssertExit (memcmp (in.data(), out.data(), length) == 0);
+  // A block with complex values has a period of twice the shuffle size.
+  for (uInt i=0; i<nval; ++i) {
+    fdata[i] = (i%2 == 0  ?  1 : 0);
+  }
+  clen = TSMCodec::compress ("shuffle-zlib", comp.data(), in.data(),
+                             length, offsets, sizes);
+  cout << "constant complex tile length: " << clen << endl;
+  TSMCodec::decompress (out.data(), length, comp.data(), offsets, sizes);
+  AlwaysAssertExit (memcmp (in.data(), out.data(), length) == 0);
+  // A single other value makes the tile non-constant.
+  idata[nval-1] = 8;
+  clen = TSMCodec::compress ("sparse", comp.data(), in.data(),
+                             length, offsets, sizes);
+  cout << "sparse non-constant tile stored as such: "
+       << (clen == length + TSMCodec::headerSize()) << endl;
+  TSMCodec::decompress (out.data(), length, comp.data(), offsets, sizes);
+  AlwaysAssertExit (memcmp (in.data(), out.data(), length) == 0);
+}
+
+void testNames()
+{
+  cout << "'" << TSMCodec::checkName ("Shuffle-Zlib") << "' '"
+       << TSMCodec::checkName ("SPARSE") << "' '"
+       << TSMCodec::checkName ("none") << "'" << endl;
+  try {
+    TSMCodec::checkName ("lzma");
+  } catch (const TSMError& x) {
+    cout << x.getMesg() << endl;
+  }
+}
+
+// Get the value of a data cell.
+Matrix<Float> makeData (uInt row, uInt version)
+{
+  Matrix<Float> data(16,64);
+  indgen (data, Float(row + version*1000), Float(0.25));
+  return data;
+}
+
+// Get the total size of the files of a table.
+Int64 tableSize (const String& name)
+{
+  return Directory(name).size();
+}
+
+void writeTable (const String& name, const String& codec)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Float> ("Data", IPosition(2,16,64),
+                                        ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Complex> ("CData", IPosition(2,16,64),
+                                          ColumnDesc::FixedShape));
+  td.defineHypercolumn ("TSMExample", 3, stringToVector("Data,CData"));
+  SetupNewTable newtab(name, td, Table::New);
+  TiledShapeStMan sm1 ("TSMExample", IPosition(3,16,64,4));
+  sm1.setCompression (codec);
+  newtab.bindAll (sm1);
+  Table table(newtab, 0);
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Complex> cdata (table, "CData");
+  for (uInt i=0; i<50; ++i) {
+    table.addRow();
+    data.put (i, makeData(i, 0));
+    cdata.put (i, Matrix<Complex>(16, 64, Complex(i, -1.)));
+  }
+}
+
+void checkTable (const String& name, uInt nrow, uInt version,
+                 const TSMOption& tsmOpt = TSMOption())
+{
+  Table table(name, Table::Old, tsmOpt);
+  AlwaysAssertExit (table.nrow() == nrow);
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Complex> cdata (table, "CData");
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (allEQ (data(i), makeData(i, i<10 ? version : 0)));
+    AlwaysAssertExit (allEQ (cdata(i),
+                             Array<Complex>(IPosition(2,16,64),
+                                            Complex(i, -1.))));
+  }
+  cout << "checked " << nrow << " rows" << endl;
+}
+
+void testTable()
+{
+  writeTable ("tTSMCodec_tmp.plain", "none");
+  writeTable ("tTSMCodec_tmp.data", "shuffle-zlib");
+  checkTable ("tTSMCodec_tmp.data", 50, 0);
+  {
+    Table table("tTSMCodec_tmp.data");
+    Record spec = table.dataManagerInfo().subRecord(0).subRecord("SPEC");
+    cout << "COMPRESSION: " << spec.asString("COMPRESSION") << endl;
+  }
+  cout << "compressed table is smaller: "
+       << (tableSize("tTSMCodec_tmp.data") <
+           tableSize("tTSMCodec_tmp.plain")) << endl;
+  // Rewrite some tiles with data compressing less well (thus needing
+  // a new file area) and add rows (thus extending the hypercube).
+  {
+    Table table("tTSMCodec_tmp.data", Table::Update);
+    ArrayColumn<Float> data (table, "Data");
+    ArrayColumn<Complex> cdata (table, "CData");
+    for (uInt i=0; i<10; ++i) {
+      data.put (i, makeData(i, 1) + Float(0.001*i));
+    }
+    for (uInt i=50; i<75; ++i) {
+      table.addRow();
+      data.put (i, makeData(i, 0));
+      cdata.put (i, Matrix<Complex>(16, 64, Complex(i, -1.)));
+    }
+  }
+  {
+    Table table("tTSMCodec_tmp.data", Table::Update);
+    ArrayColumn<Float> data (table, "Data");
+    for (uInt i=0; i<10; ++i) {
+      data.put (i, makeData(i, 1));
+    }
+  }
+  checkTable ("tTSMCodec_tmp.data", 75, 1);
+  // A copy of the table keeps the compression.
+  {
+    Table table("tTSMCodec_tmp.data");
+    table.deepCopy ("tTSMCodec_tmp.copy", Table::New);
+  }
+  checkTable ("tTSMCodec_tmp.copy", 75, 1);
+  // Compressed tiles are always read using a cache.
+  checkTable ("tTSMCodec_tmp.copy", 75, 1, TSMOption::MMap);
+  checkTable ("tTSMCodec_tmp.copy", 75, 1, TSMOption::Buffer);
+  {
+    Table table("tTSMCodec_tmp.copy");
+    Record spec = table.dataManagerInfo().subRecord(0).subRecord("SPEC");
+    cout << "COMPRESSION: " << spec.asString("COMPRESSION") << endl;
+  }
+}
+
+// Add a column using the sparse codec to a table with the given nr of rows.
+void addSparseColumn (const String& name)
+{
+  Table table(name, Table::Update);
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Complex> ("ModelData", IPosition(2,16,64),
+                                          ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool> ("Flag", IPosition(2,16,64),
+                                       ColumnDesc::FixedShape));
+  td.defineHypercolumn ("TSMModel", 3, stringToVector("ModelData,Flag"));
+  TiledShapeStMan sm1 ("TSMModel", IPosition(3,16,64,4));
+  sm1.setCompression ("sparse");
+  table.addColumn (td, sm1);
+}
+
+void testSparse()
+{
+  // Adding a column does not write its tiles.
+  Int64 oldSize = tableSize("tTSMCodec_tmp.plain");
+  addSparseColumn ("tTSMCodec_tmp.plain");
+  Int64 newSize = tableSize("tTSMCodec_tmp.plain");
+  cout << "column added without writing tiles: "
+       << (newSize - oldSize < 16*64*4*8) << endl;
+  {
+    Table table("tTSMCodec_tmp.plain", Table::Update);
+    Record spec = table.dataManagerInfo().subRecord(1).subRecord("SPEC");
+    cout << "COMPRESSION: " << spec.asString("COMPRESSION") << endl;
+    ArrayColumn<Complex> mdata (table, "ModelData");
+    ArrayColumn<Bool> flag (table, "Flag");
+    AlwaysAssertExit (allEQ (mdata.getColumn(), Complex()));
+    AlwaysAssertExit (allEQ (flag.getColumn(), False));
+    // Constant tiles take hardly any space.
+    for (uInt i=0; i<20; ++i) {
+      mdata.put (i, Matrix<Complex>(16, 64, Complex(1, 0)));
+      flag.put (i, Matrix<Bool>(16, 64, True));
+    }
+    // Writing other data materialises a tile.
+    Matrix<Complex> model(16, 64, Complex(1, 0));
+    model(3,5) = Complex(2, -1);
+    mdata.put (21, model);
+    flag.put (21, Matrix<Bool>(16, 64, True));
+  }
+  Int64 size = tableSize("tTSMCodec_tmp.plain");
+  cout << "constant tiles are not written: "
+       << (size - newSize < 2 * 16*64*4*9) << endl;
+  Table table("tTSMCodec_tmp.plain");
+  ArrayColumn<Complex> mdata (table, "ModelData");
+  ArrayColumn<Bool> flag (table, "Flag");
+  for (uInt i=0; i<table.nrow(); ++i) {
+    Matrix<Complex> exp(16, 64, Complex(i<22 && i!=20 ? 1 : 0, 0));
+    if (i == 21) {
+      exp(3,5) = Complex(2, -1);
+    }
+    AlwaysAssertExit (allEQ (mdata(i), exp));
+    AlwaysAssertExit (allEQ (flag(i), i<22 && i!=20));
+  }
+  // The data in the other column did not change.
+  checkTable ("tTSMCodec_tmp.plain", 50, 0);
+  cout << "checked sparse column" << endl;
+}
+
+int main()
+{
+#ifndef HAVE_ZLIB
+  // Exit with untested if no zlib support.
+  return 3;
+#endif
+  try {
+    testCodec();
+    testNames();
+    testTable();
+    testSparse();
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,145 @@
+//# tTSMMapped.cc: Test program for zero-copy reads of memory-mapped TSM tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TSMOption.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/IO/MMapfdIO.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for zero-copy reads of memory-mapped TSM tiles
+// </summary>
+
+// Get the value of a data cell.
+Matrix<Float> makeData (uInt row)
+{
+  Matrix<Float> data(16,64);
+  indgen (data, Float(row), Float(0.5));
+  return data;
+}
+
+// Create a table where a tile contains a single cell or half a cell.
+void writeTable (const String& name, uInt tileLength)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Float> ("Data", IPosition(2,16,64),
+                                        ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Int> ("IData", IPosition(2,16,64),
+                                      ColumnDesc::FixedShape));
+  td.defineHypercolumn ("TSMExample", 3, stringToVector("Data,IData"));
+  SetupNewTable newtab(name, td, Table::New);
+  TiledShapeStMan sm1 ("TSMExample", IPosition(3,16,tileLength,1));
+  newtab.bindAll (sm1);
+  Table table(newtab, 0);
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Int> idata (table, "IData");
+  for (uInt i=0; i<10; ++i) {
+    table.addRow();
+    data.put (i, makeData(i));
+    idata.put (i, Matrix<Int>(16, 64, i));
+  }
+}
+
+// Read the cells and tell how many are mapped.
+void readTable (const Table& table, const String& title)
+{
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Int> idata (table, "IData");
+  uInt nmapped = 0;
+  for (uInt i=0; i<table.nrow(); ++i) {
+    uInt rownr = table.rowNumbers()[i];
+    Array<Float> arr = data.getMapped (i);
+    Array<Int> iarr = idata.getMapped (i);
+    nmapped += MMapfdIO::nrMappedRegions();
+    AlwaysAssertExit (allEQ (arr, makeData(rownr)));
+    AlwaysAssertExit (allEQ (iarr, Int(rownr)));
+  }
+  cout << title << ": " << nmapped << " mapped" << endl;
+  AlwaysAssertExit (MMapfdIO::nrMappedRegions() == 0);
+}
+
+void testMapped()
+{
+  writeTable ("tTSMMapped_tmp.data1", 64);
+  writeTable ("tTSMMapped_tmp.data2", 32);
+  readTable (Table("tTSMMapped_tmp.data1", Table::Old, TSMOption::MMap),
+             "mmap");
+  readTable (Table("tTSMMapped_tmp.data1", Table::Old, TSMOption::Cache),
+             "cache");
+  readTable (Table("tTSMMapped_tmp.data1", Table::Update, TSMOption::MMap),
+             "mmap update");
+  readTable (Table("tTSMMapped_tmp.data2", Table::Old, TSMOption::MMap),
+             "mmap half tile");
+  {
+    Table table("tTSMMapped_tmp.data1", Table::Old, TSMOption::MMap);
+    Vector<rownr_t> rows(3);
+    rows[0] = 7; rows[1] = 2; rows[2] = 5;
+    readTable (table(rows), "mmap reftable");
+  }
+  {
+    // The mapping lives as long as the array data are referenced.
+    // Changing the data does not change the file.
+    Table table("tTSMMapped_tmp.data1", Table::Old, TSMOption::MMap);
+    ArrayColumn<Float> data (table, "Data");
+    Array<Float> arr2;
+    {
+      Array<Float> arr = data.getMapped (3);
+      arr2.reference (arr);
+    }
+    AlwaysAssertExit (MMapfdIO::nrMappedRegions() == 1);
+    arr2 = Float(-1);
+    AlwaysAssertExit (allEQ (data(3), makeData(3)));
+    AlwaysAssertExit (allEQ (data.getMapped(3), makeData(3)));
+    Array<Float> copy = arr2.copy();
+    arr2.resize();
+    AlwaysAssertExit (MMapfdIO::nrMappedRegions() == 0);
+    AlwaysAssertExit (allEQ (copy, Float(-1)));
+  }
+}
+
+int main()
+{
+  try {
+    testMapped();
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
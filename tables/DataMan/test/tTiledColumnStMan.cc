@@ -68,6 +68,8 @@ int main () {
 	readTable(TSMOption::Buffer, False);
         writeFixed(TSMOption::Buffer);
 	readTable(TSMOption::Cache, False);
+        // Read the tiles using multiple threads.
+	readTable(TSMOption(TSMOption::Cache, 0, 0, 4), False);
     } catch (AipsError& x) {
 	cout << "Caught an exception: " << x.getMesg() << endl;
 	return 1;
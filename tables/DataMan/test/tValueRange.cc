@@ -0,0 +1,233 @@
+//# tValueRange.cc: Test program for the value ranges of storage managers
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprNodeSet.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the value ranges (zone maps) of storage managers
+// and their use in a selection.
+// </summary>
+
+// Check that the values in all rows are inside the value ranges.
+// It returns the number of ranges.
+uInt checkRanges (const Table& table, const String& colName)
+{
+  TableColumn col (table, colName);
+  uInt nrange = 0;
+  rownr_t nrow = table.nrow();
+  rownr_t row = 0;
+  while (row < nrow) {
+    rownr_t endRow = nrow - 1;
+    Double minVal, maxVal;
+    AlwaysAssertExit (col.getValueRange (row, endRow, minVal, maxVal));
+    AlwaysAssertExit (endRow >= row  &&  endRow < nrow);
+    for (; row<=endRow; ++row) {
+      Double val = col.asdouble(row);
+      AlwaysAssertExit (val >= minVal  &&  val <= maxVal);
+    }
+    nrange++;
+  }
+  return nrange;
+}
+
+// Count the rows skipped by the selection expression.
+rownr_t nskipped (const TableExprNode& expr, rownr_t nrow)
+{
+  rownr_t nskip = 0;
+  rownr_t row = 0;
+  while (row < nrow) {
+    rownr_t endRow = nrow - 1;
+    if (! expr.getRep()->mayBeTrue (row, endRow)) {
+      nskip += endRow - row + 1;
+    }
+    row = endRow + 1;
+  }
+  return nskip;
+}
+
+void writeTable (const String& name)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ival"));
+  td.addColumn (ScalarColumnDesc<Double> ("dval"));
+  td.addColumn (ScalarColumnDesc<String> ("sval"));
+  td.addColumn (ScalarColumnDesc<Double> ("time"));
+  SetupNewTable newtab(name, td, Table::New);
+  // Only keep a zone map for the numeric columns given.
+  Record spec;
+  spec.define ("BUCKETSIZE", 400);
+  Vector<String> zoneCols(2);
+  zoneCols[0] = "ival";
+  zoneCols[1] = "dval";
+  spec.define ("ZONEMAPCOLUMNS", zoneCols);
+  StandardStMan ssm ("SSM", spec);
+  IncrementalStMan ism ("ISM", 1024);
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("time", ism);
+  Table table(newtab, 1000);
+  ScalarColumn<Int> icol (table, "ival");
+  ScalarColumn<Double> dcol (table, "dval");
+  ScalarColumn<String> scol (table, "sval");
+  ScalarColumn<Double> tcol (table, "time");
+  Vector<Double> dvals(1000);
+  for (uInt i=0; i<1000; ++i) {
+    icol.put (i, i);
+    scol.put (i, "s" + String::toString(i));
+    tcol.put (i, 10 * (i/10));
+    dvals[i] = 1000 - 0.5*i;
+  }
+  dcol.putColumn (dvals);
+}
+
+void checkTable (const String& name)
+{
+  Table table(name);
+  cout << "ival: " << checkRanges (table, "ival") << " ranges" << endl;
+  cout << "dval: " << checkRanges (table, "dval") << " ranges" << endl;
+  cout << "time: " << checkRanges (table, "time") << " ranges" << endl;
+  // No ranges are kept for strings.
+  TableColumn scol (table, "sval");
+  rownr_t endRow = table.nrow() - 1;
+  Double minVal, maxVal;
+  AlwaysAssertExit (! scol.getValueRange (0, endRow, minVal, maxVal));
+  // The zone map columns are part of the specification.
+  Record spec = table.dataManagerInfo().subRecord(0).subRecord("SPEC");
+  cout << "ZONEMAPCOLUMNS: " << spec.asArrayString("ZONEMAPCOLUMNS") << endl;
+}
+
+void testNoZoneMap (const String& name)
+{
+  // By default no zone maps are kept.
+  {
+    TableDesc td ("", "1", TableDesc::Scratch);
+    td.addColumn (ScalarColumnDesc<Int> ("ival"));
+    SetupNewTable newtab(name, td, Table::New);
+    StandardStMan ssm ("SSM", 400);
+    newtab.bindAll (ssm);
+    Table table(newtab, 100);
+    ScalarColumn<Int> icol (table, "ival");
+    for (uInt i=0; i<100; ++i) {
+      icol.put (i, i);
+    }
+  }
+  Table table(name);
+  TableColumn col (table, "ival");
+  rownr_t endRow = table.nrow() - 1;
+  Double minVal, maxVal;
+  AlwaysAssertExit (! col.getValueRange (0, endRow, minVal, maxVal));
+  Record spec = table.dataManagerInfo().subRecord(0).subRecord("SPEC");
+  AlwaysAssertExit (! spec.isDefined ("ZONEMAPCOLUMNS"));
+}
+
+void testSelect (const String& name)
+{
+  Table table(name);
+  TableExprNode expr (table.col("ival") >= 900  &&  table.col("ival") < 950);
+  Table sel = table(expr);
+  cout << "selected " << sel.nrow() << " rows, skipped "
+       << nskipped (expr, table.nrow()) << " rows" << endl;
+  Vector<Int> vals = ScalarColumn<Int>(sel, "ival").getColumn();
+  for (uInt i=0; i<vals.size(); ++i) {
+    AlwaysAssertExit (vals[i] == Int(900+i));
+  }
+  TableExprNode expr2 (table.col("time") == 500.  ||  table.col("ival") < 5);
+  sel = table(expr2);
+  cout << "selected " << sel.nrow() << " rows, skipped "
+       << nskipped (expr2, table.nrow()) << " rows" << endl;
+  // No rows can be skipped using a string column.
+  TableExprNode expr3 (table.col("sval") == "s10"  &&  table.col("ival") > 10);
+  sel = table(expr3);
+  cout << "selected " << sel.nrow() << " rows, skipped "
+       << nskipped (expr3, table.nrow()) << " rows" << endl;
+  // BETWEEN is an IN with a closed interval, so it can skip rows as well.
+  TableExprNodeSet interval;
+  interval.add (TableExprNodeSetElem (True, TableExprNode(900),
+                                      TableExprNode(949), True));
+  TableExprNode expr4 (table.col("ival").in (interval));
+  sel = table(expr4);
+  cout << "selected " << sel.nrow() << " rows, skipped "
+       << nskipped (expr4, table.nrow()) << " rows" << endl;
+  TableExprNode expr5 = tableCommand
+    ("calc from " + name + " calc time BETWEEN 100 AND 300").node();
+  cout << "BETWEEN skipped " << nskipped (expr5, table.nrow())
+       << " rows" << endl;
+  // IN with a constant set uses the bounds of the set.
+  TableExprNode expr6 = tableCommand
+    ("calc from " + name + " calc dval IN [600,650,700.5]").node();
+  cout << "IN skipped " << nskipped (expr6, table.nrow()) << " rows" << endl;
+}
+
+void updateTable (const String& name)
+{
+  Table table(name, Table::Update);
+  // Add rows of which only some are written; the others contain 0.
+  table.addRow (20);
+  ScalarColumn<Int> icol (table, "ival");
+  ScalarColumn<Double> dcol (table, "dval");
+  for (uInt i=1000; i<1020; i+=2) {
+    icol.put (i, i);
+    dcol.put (i, 2*i);
+  }
+  cout << "ival: " << checkRanges (table, "ival") << " ranges" << endl;
+  // Overwrite values and remove rows; the ranges stay valid.
+  icol.put (500, -1);
+  for (uInt i=0; i<100; ++i) {
+    table.removeRow (0);
+  }
+  cout << "ival: " << checkRanges (table, "ival") << " ranges" << endl;
+}
+
+int main()
+{
+  try {
+    writeTable ("tValueRange_tmp.data");
+    checkTable ("tValueRange_tmp.data");
+    testSelect ("tValueRange_tmp.data");
+    updateTable ("tValueRange_tmp.data");
+    checkTable ("tValueRange_tmp.data");
+    testNoZoneMap ("tValueRange_tmp.data2");
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -275,7 +275,7 @@ void TableLogSink::writeLocally (Double mtime,
 				 const String& mlocation,
 				 const String& mobjectID)
 {
-  uInt offset = table().nrow();
+  rownr_t offset = table().nrow();
   // cout << "writing " << mmessage << " at row " << offset << endl;
   table().addRow(1);
   time().put     (offset, mtime);
@@ -31,10 +31,117 @@
 #include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/BasicSL/Constants.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// The margin (in radians) added to the cone radius when determining the
+// zones of a cone. It has to cover the rounding errors in the distance
+// calculation, which can be about sqrt(1e-16) radians for small distances.
+static const Double theirConeMargin = 1e-6;
+
+TableExprConeIndex::TableExprConeIndex (const Array<Double>& cones,
+                                        const Array<Double>& radii)
+{
+  itsCones.reference (cones.copy());
+  itsRadii.reference (radii.copy());
+  const Double* cone = itsCones.data();
+  uInt step = (itsRadii.empty() ? 3 : 2);
+  uInt ncone = itsCones.nelements() / step;
+  // If radii are given, a cone is added using the largest radius.
+  // A NaN radius never matches, so it is ignored.
+  Double maxRadius = -1;
+  for (uInt k=0; k<itsRadii.nelements(); ++k) {
+    Double r = std::abs(itsRadii.data()[k]);
+    if (! isNaN(r)  &&  r > maxRadius) {
+      maxRadius = r;
+    }
+  }
+  // Determine the zone height from the average radius, so a cone
+  // overlaps only a few zones.
+  std::vector<Double> decs(ncone);
+  std::vector<Double> rads(ncone);
+  Double sumRadius = 0;
+  uInt nrad = 0;
+  for (uInt i=0; i<ncone; ++i) {
+    decs[i] = asin (sin (cone[i*step + 1]));
+    rads[i] = (step == 3  ?  std::abs(cone[i*step + 2]) : maxRadius);
+    if (rads[i] >= 0  &&  rads[i] < C::pi) {
+      sumRadius += rads[i];
+      nrad++;
+    }
+  }
+  Int nzone = 1;
+  if (nrad > 0) {
+    Double height = 2 * (sumRadius/nrad + theirConeMargin);
+    nzone = std::max (1, std::min (Int(ncone), Int(C::pi / height)));
+  }
+  itsZoneHeight = C::pi / nzone;
+  itsZones.resize (nzone);
+  for (uInt i=0; i<ncone; ++i) {
+    // A cone with an undefined position or radius never matches.
+    if (isNaN(decs[i])  ||  isNaN(rads[i])  ||  rads[i] < 0) {
+      continue;
+    }
+    Int stzone = 0;
+    Int endzone = nzone-1;
+    if (rads[i] < C::pi) {
+      stzone  = zone (decs[i] - rads[i] - theirConeMargin);
+      endzone = zone (decs[i] + rads[i] + theirConeMargin);
+    }
+    for (Int z=stzone; z<=endzone; ++z) {
+      itsZones[z].push_back (i);
+    }
+  }
+}
+
+CountedPtr<TableExprConeIndex> TableExprConeIndex::makeIndex
+                                 (const std::vector<TENShPtr>& operands,
+                                  Bool hasRadii)
+{
+  CountedPtr<TableExprConeIndex> index;
+  if (! operands[1]->isConstant()  ||
+      (hasRadii  &&  ! operands[2]->isConstant())) {
+    return index;
+  }
+  Array<Double> cones = operands[1]->getArrayDouble(0).array();
+  Array<Double> radii;
+  uInt step = 3;
+  if (hasRadii) {
+    step = 2;
+    if (operands[2]->valueType() == TableExprNodeRep::VTArray) {
+      radii.reference (operands[2]->getArrayDouble(0).array());
+    } else {
+      radii.resize (IPosition(1,1));
+      radii.data()[0] = operands[2]->getDouble(0);
+    }
+  }
+  // Leave errors and trivial cases to the functions testing all cones.
+  if (cones.nelements() % step == 0  &&  cones.nelements() / step >= 16  &&
+      (!hasRadii  ||  radii.nelements() > 0)) {
+    index = new TableExprConeIndex (cones, radii);
+  }
+  return index;
+}
+
+Int TableExprConeIndex::zone (Double dec) const
+{
+  Int z = Int (floor ((dec + C::pi_2) / itsZoneHeight));
+  return std::max (0, std::min (Int(itsZones.size()) - 1, z));
+}
+
+const std::vector<uInt>& TableExprConeIndex::candidates (Double dec) const
+{
+  Double d = asin (sin (dec));
+  if (isNaN(d)) {
+    return itsEmpty;
+  }
+  return itsZones[zone(d)];
+}
+
+
 TableExprConeNode::TableExprConeNode (FunctionType ftype, NodeDataType dtype,
                                       const TableExprNodeSet& source,
                                       const vector<TENShPtr>& nodes,
@@ -42,12 +149,24 @@ TableExprConeNode::TableExprConeNode (FunctionType ftype, NodeDataType dtype,
                                       uInt origin)
   : TableExprFuncNode (ftype, dtype, VTScalar, source,
                        nodes, dtypeOper, Table()),
-    origin_p          (origin)
+    origin_p          (origin),
+    indexDone_p       (False)
 {}
 
 TableExprConeNode::~TableExprConeNode()
 {}
 
+const TableExprConeIndex* TableExprConeNode::getIndex()
+{
+  if (! indexDone_p) {
+    Bool hasRadii = (funcType() == anycone3FUNC  ||
+                     funcType() == findcone3FUNC);
+    index_p = TableExprConeIndex::makeIndex (operands(), hasRadii);
+    indexDone_p = True;
+  }
+  return index_p.get();
+}
+
 Bool TableExprConeNode::getBool (const TableExprId& id)
 {
   switch (funcType()) {
@@ -57,7 +176,13 @@ Bool TableExprConeNode::getBool (const TableExprId& id)
       if (srcArr.nelements() != 2) {
         throw TableInvExpr("First ANYCONE argument must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 3 != 0) {
         throw TableInvExpr("Second ANYCONE argument "
                            "must have multiple of 3 values");
@@ -67,8 +192,12 @@ Bool TableExprConeNode::getBool (const TableExprId& id)
       const double* cone = coneArr.getStorage (deleteCone);
       const double ra  = src[0];
       const double dec = src[1];
+      // Only test the nearby cones if an index is used.
+      const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+      uInt ncone = cand ? cand->size() : coneArr.nelements() / 3;
       Bool res = False;
-      for (uInt i=0; i<coneArr.nelements(); i+=3) {
+      for (uInt j=0; j<ncone; ++j) {
+        uInt i = 3 * (cand ? (*cand)[j] : j);
         const double raCone  = cone[i];
         const double decCone = cone[i+1];
         const double radius  = cone[i+2];
@@ -113,33 +242,39 @@ Bool TableExprConeNode::getBool (const TableExprId& id)
       if (srcArr.nelements() != 2) {
         throw TableInvExpr("First ANYCONE argument must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 2 != 0) {
         throw TableInvExpr("Second ANYCONE3 argument "
                            "must have multiple of 2 values");
       }
       // Radius can be a single value or an array.
-      int nrrad = 1;
-      double radval;
-      const double* rad = 0;
       Array<double> radArr;
-      if ( operands()[2]->valueType() == VTArray) {
-        radArr = operands()[2]->getArrayDouble(id).array();
-        nrrad = radArr.nelements();
+      if (index) {
+        radArr.reference (index->radii());
+      } else if ( operands()[2]->valueType() == VTArray) {
+        radArr.reference (operands()[2]->getArrayDouble(id).array());
       } else {
-        radval = operands()[2]->getDouble(id);
-        rad = &radval;
+        radArr.resize (IPosition(1,1));
+        radArr.data()[0] = operands()[2]->getDouble(id);
       }
+      int nrrad = radArr.nelements();
       Bool deleteSrc, deleteCone, deleteRad;
       const double* src  = srcArr.getStorage (deleteSrc);
       const double* cone = coneArr.getStorage (deleteCone);
-      if (rad != &radval) {
-        rad = radArr.getStorage (deleteRad);
-      }
+      const double* rad  = radArr.getStorage (deleteRad);
       const double ra  = src[0];
       const double dec = src[1];
+      const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+      uInt ncone = cand ? cand->size() : coneArr.nelements() / 2;
       Bool res = False;
-      for (uInt i=0; i<coneArr.nelements(); i+=2) {
+      for (uInt j=0; j<ncone; ++j) {
+        uInt i = 2 * (cand ? (*cand)[j] : j);
         const double raCone  = cone[i];
         const double decCone = cone[i+1];
         double dist = (sin(decCone) * sin(dec) +
@@ -155,9 +290,7 @@ Bool TableExprConeNode::getBool (const TableExprId& id)
       }
       srcArr.freeStorage (src, deleteSrc);
       coneArr.freeStorage (cone, deleteCone);
-      if (rad != &radval) {
-        radArr.freeStorage (rad, deleteRad);
-      }
+      radArr.freeStorage (rad, deleteRad);
       return res;
     }
   case TableExprFuncNode::cones3FUNC:
@@ -203,7 +336,13 @@ Int64 TableExprConeNode::getInt (const TableExprId& id)
         throw TableInvExpr("First FINDCONE argument "
                            "must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 3 != 0) {
         throw TableInvExpr("Second FINDCONE argument "
                            "must have multiple of 3 values");
@@ -213,8 +352,13 @@ Int64 TableExprConeNode::getInt (const TableExprId& id)
       const double* cone = coneArr.getStorage (deleteCone);
       const double ra  = src[0];
       const double dec = src[1];
+      // The candidates are in increasing order, so the first match is
+      // the same cone as found by testing all cones.
+      const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+      uInt ncone = cand ? cand->size() : coneArr.nelements() / 3;
       Int res = -1;
-      for (uInt i=0; i<coneArr.nelements(); i+=3) {
+      for (uInt j=0; j<ncone; ++j) {
+        uInt i = 3 * (cand ? (*cand)[j] : j);
         const double raCone  = cone[i];
         const double decCone = cone[i+1];
         const double radius  = cone[i+2];
@@ -235,33 +379,39 @@ Int64 TableExprConeNode::getInt (const TableExprId& id)
         throw TableInvExpr("First FINDCONE argument "
                            "must have multiple 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 2 != 0) {
         throw TableInvExpr("Second FINDCONE3 argument "
                            "must have multiple of 2 values");
       }
       // Radius can be a single value or an array.
-      int nrrad = 1;
-      double radval;
-      const double* rad = 0;
       Array<double> radArr;
-      if ( operands()[2]->valueType() == VTArray) {
-        radArr = operands()[2]->getArrayDouble(id).array();
-        nrrad = radArr.nelements();
+      if (index) {
+        radArr.reference (index->radii());
+      } else if ( operands()[2]->valueType() == VTArray) {
+        radArr.reference (operands()[2]->getArrayDouble(id).array());
       } else {
-        radval = operands()[2]->getDouble(id);
-        rad = &radval;
+        radArr.resize (IPosition(1,1));
+        radArr.data()[0] = operands()[2]->getDouble(id);
       }
+      int nrrad = radArr.nelements();
       Bool deleteSrc, deleteCone, deleteRad;
       const double* src  = srcArr.getStorage (deleteSrc);
       const double* cone = coneArr.getStorage (deleteCone);
-      if (rad != &radval) {
-        rad = radArr.getStorage (deleteRad);
-      }
+      const double* rad  = radArr.getStorage (deleteRad);
       const double ra  = src[0];
       const double dec = src[1];
+      const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+      uInt ncone = cand ? cand->size() : coneArr.nelements() / 2;
       Int res = -1;
-      for (uInt i=0; i<coneArr.nelements(); i+=2) {
+      for (uInt j=0; j<ncone; ++j) {
+        uInt i = 2 * (cand ? (*cand)[j] : j);
         const double raCone  = cone[i];
         const double decCone = cone[i+1];
         double dist = (sin(decCone) * sin(dec) +
@@ -277,9 +427,7 @@ Int64 TableExprConeNode::getInt (const TableExprId& id)
       }
       srcArr.freeStorage (src, deleteSrc);
       coneArr.freeStorage (cone, deleteCone);
-      if (rad != &radval) {
-        radArr.freeStorage (rad, deleteRad);
-      }
+      radArr.freeStorage (rad, deleteRad);
       return res;
     }
   default:
@@ -376,7 +524,8 @@ TableExprConeNodeArray::TableExprConeNodeArray (TableExprFuncNode::FunctionType
                                                 uInt origin)
   : TableExprFuncNodeArray (ftype, dtype, VTArray, source,
                             nodes, dtypeOper, TaQLStyle()),
-    origin_p               (origin)
+    origin_p               (origin),
+    indexDone_p            (False)
 {
   ndim_p = -1;
 }
@@ -384,6 +533,17 @@ TableExprConeNodeArray::TableExprConeNodeArray (TableExprFuncNode::FunctionType
 TableExprConeNodeArray::~TableExprConeNodeArray()
 {}
 
+const TableExprConeIndex* TableExprConeNodeArray::getIndex()
+{
+  if (! indexDone_p) {
+    Bool hasRadii = (funcType() == TableExprFuncNode::cones3FUNC  ||
+                     funcType() == TableExprFuncNode::findcone3FUNC);
+    index_p = TableExprConeIndex::makeIndex (operands(), hasRadii);
+    indexDone_p = True;
+  }
+  return index_p.get();
+}
+
 MArray<Bool> TableExprConeNodeArray::getArrayBool (const TableExprId& id)
 {
   switch (funcType()) {
@@ -394,7 +554,13 @@ MArray<Bool> TableExprConeNodeArray::getArrayBool (const TableExprId& id)
         throw TableInvExpr("First CONES argument "
                            "must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 3 != 0) {
         throw TableInvExpr("Second CONES argument "
                            "must have multiple of 3 values");
@@ -403,6 +569,10 @@ MArray<Bool> TableExprConeNodeArray::getArrayBool (const TableExprId& id)
       Int nsrc  = srcArr.nelements() / 2;
       Int ncone = coneArr.nelements() / 3;
       Array<Bool> resArr(IPosition(2,ncone,nsrc));
+      if (index) {
+        // Only the nearby cones are tested.
+        resArr = False;
+      }
       Bool deleteSrc, deleteCone;
       const double* src  = srcArr.getStorage (deleteSrc);
       const double* cone = coneArr.getStorage (deleteCone);
@@ -411,13 +581,18 @@ MArray<Bool> TableExprConeNodeArray::getArrayBool (const TableExprId& id)
         const double ra  = src[j];
         const double sindec = sin(src[j+1]);
         const double cosdec = cos(src[j+1]);
-        for (uInt i=0; i<coneArr.nelements(); i+=3) {
-          const double raCone  = cone[i];
-          const double decCone = cone[i+1];
-          const double radius  = cone[i+2];
-          *res++ = cos(radius) <= (sin(decCone) * sindec +
+        const std::vector<uInt>* cand =
+          index ? &(index->candidates(src[j+1])) : 0;
+        uInt nc = cand ? cand->size() : ncone;
+        for (uInt m=0; m<nc; ++m) {
+          uInt c = cand ? (*cand)[m] : m;
+          const double raCone  = cone[3*c];
+          const double decCone = cone[3*c+1];
+          const double radius  = cone[3*c+2];
+          res[c] = cos(radius) <= (sin(decCone) * sindec +
                                    cos(decCone) * cosdec * cos(raCone-ra));
         }
+        res += ncone;
       }
       srcArr.freeStorage (src, deleteSrc);
       coneArr.freeStorage (cone, deleteCone);
@@ -430,54 +605,61 @@ MArray<Bool> TableExprConeNodeArray::getArrayBool (const TableExprId& id)
         throw TableInvExpr("First CONES3 argument "
                            "must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 2 != 0) {
         throw TableInvExpr("Second CONES3 argument "
                            "must have multiple of 2 values");
       }
       // Radius can be a single value or an array.
-      int nrrad = 1;
-      double radval;
-      const double* rad = 0;
       Array<double> radArr;
-      if ( operands()[2]->valueType() == VTArray) {
-        radArr = operands()[2]->getArrayDouble(id).array();
-        nrrad = radArr.nelements();
+      if (index) {
+        radArr.reference (index->radii());
+      } else if ( operands()[2]->valueType() == VTArray) {
+        radArr.reference (operands()[2]->getArrayDouble(id).array());
       } else {
-        radval = operands()[2]->getDouble(id);
-        rad = &radval;
+        radArr.resize (IPosition(1,1));
+        radArr.data()[0] = operands()[2]->getDouble(id);
       }
+      int nrrad = radArr.nelements();
       // The result shape is a cube (#radii, #cones, #sources).
       Int nsrc  = srcArr.nelements() / 2;
       Int ncone = coneArr.nelements() / 2;
       Bool deleteSrc, deleteCone, deleteRad;
       const double* src  = srcArr.getStorage (deleteSrc);
       const double* cone = coneArr.getStorage (deleteCone);
-      if (rad != &radval) {
-        rad = radArr.getStorage (deleteRad);
-      }
+      const double* rad  = radArr.getStorage (deleteRad);
       Array<Bool> resArr(IPosition(3,nrrad,ncone,nsrc));
+      if (index) {
+        resArr = False;
+      }
       Bool* res = resArr.data();
       for (uInt j=0; j<srcArr.nelements(); j+=2) {
         const double ra  = src[j];
         const double dec = src[j+1];
-        for (uInt i=0; i<coneArr.nelements(); i+=2) {
-          const double raCone  = cone[i];
-          const double decCone = cone[i+1];
+        const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+        uInt nc = cand ? cand->size() : ncone;
+        for (uInt m=0; m<nc; ++m) {
+          uInt c = cand ? (*cand)[m] : m;
+          const double raCone  = cone[2*c];
+          const double decCone = cone[2*c+1];
           double dist = (sin(decCone) * sin(dec) +
                          cos(decCone) * cos(dec) * cos(raCone-ra));
-
           for (Int k=0; k<nrrad; k++) {
             const double radius = rad[k];
-            *res++ = cos(radius) <= dist;
+            res[k + nrrad*c] = cos(radius) <= dist;
           }
         }
+        res += nrrad*ncone;
       }
       srcArr.freeStorage (src, deleteSrc);
       coneArr.freeStorage (cone, deleteCone);
-      if (rad != &radval) {
-        radArr.freeStorage (rad, deleteRad);
-      }
+      radArr.freeStorage (rad, deleteRad);
       return MArray<Bool>(resArr);
     }
   default:
@@ -496,7 +678,13 @@ MArray<Int64> TableExprConeNodeArray::getArrayInt (const TableExprId& id)
         throw TableInvExpr("First FINDCONE argument "
                            "must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 3 != 0) {
         throw TableInvExpr("Second FINDCONE argument "
                            "must have multiple of 3 values");
@@ -518,8 +706,11 @@ MArray<Int64> TableExprConeNodeArray::getArrayInt (const TableExprId& id)
       for (uInt j=0; j<srcArr.nelements(); j+=2) {
         const double ra  = src[j];
         const double dec = src[j+1];
+        const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+        uInt nc = cand ? cand->size() : coneArr.nelements() / 3;
         *res = -1;
-        for (uInt i=0; i<coneArr.nelements(); i+=3) {
+        for (uInt m=0; m<nc; ++m) {
+          uInt i = 3 * (cand ? (*cand)[m] : m);
           const double raCone  = cone[i];
           const double decCone = cone[i+1];
           const double radius  = cone[i+2];
@@ -542,22 +733,28 @@ MArray<Int64> TableExprConeNodeArray::getArrayInt (const TableExprId& id)
         throw TableInvExpr("First FINDCONE argument "
                            "must have multiple of 2 values");
       }
-      Array<double> coneArr = operands()[1]->getArrayDouble(id).array();
+      const TableExprConeIndex* index = getIndex();
+      Array<double> coneArr;
+      if (index) {
+        coneArr.reference (index->cones());
+      } else {
+        coneArr.reference (operands()[1]->getArrayDouble(id).array());
+      }
       if (coneArr.nelements() % 2 != 0) {
         throw TableInvExpr("Second FINDCONE3 argument "
                            "must have multiple of 2 values");
       }
       // Radius can be a single value or an array.
-      int nrrad = 1;
       Array<double> radArr;
-      if ( operands()[2]->valueType() == VTArray) {
-        radArr = operands()[2]->getArrayDouble(id).array();
-        nrrad = radArr.nelements();
+      if (index) {
+        radArr.reference (index->radii());
+      } else if ( operands()[2]->valueType() == VTArray) {
+        radArr.reference (operands()[2]->getArrayDouble(id).array());
       } else {
         radArr.resize(IPosition(1,1));
         radArr.data()[0] = operands()[2]->getDouble(id);
-        nrrad = 1;
       }
+      int nrrad = radArr.nelements();
       // The result shape is the source array shape.
       IPosition shpc = srcArr.shape();
       IPosition shp;
@@ -576,8 +773,11 @@ MArray<Int64> TableExprConeNodeArray::getArrayInt (const TableExprId& id)
       for (uInt j=0; j<srcArr.nelements(); j+=2) {
         const double ra  = src[j];
         const double dec = src[j+1];
+        const std::vector<uInt>* cand = index ? &(index->candidates(dec)) : 0;
+        uInt nc = cand ? cand->size() : coneArr.nelements() / 2;
         *res = -1;
-        for (uInt i=0; i<coneArr.nelements(); i+=2) {
+        for (uInt m=0; m<nc; ++m) {
+          uInt i = 2 * (cand ? (*cand)[m] : m);
           const double raCone  = cone[i];
           const double decCone = cone[i+1];
           double dist = (sin(decCone) * sin(dec) +
@@ -32,10 +32,77 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprFuncNode.h>
 #include <casacore/tables/TaQL/ExprFuncNodeArray.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 
+// <summary>
+// Index of declination zones to find the cones a position can be in
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tExprConeIndex.cc">
+// </reviewed>
+
+// <synopsis>
+// A cone search function has to test each cone for each source position,
+// which is slow if many positions are matched against many cones
+// (e.g. when cross-matching a catalogue against a sky model).
+// If the cones are constant, this class is used to find the cones
+// a position might be in, so only those cones have to be tested.
+// <br>The sky is divided in zones of declination. Each cone is added to
+// the zones it overlaps (taking a small margin into account to cater for
+// rounding errors). The candidate cones of a position are the cones in
+// its zone. They are given in increasing order, so the first matching
+// cone found is the same as the one found by testing all cones.
+// <br>The declinations are normalized (using asin(sin(dec))), so
+// values outside [-90,90] degrees are handled correctly. A cone with a
+// radius of 180 degrees or more is added to all zones.
+// </synopsis>
+
+class TableExprConeIndex
+{
+public:
+  // Create the index for the given cones.
+  // If the radii array is empty, the cones array contains triplets of
+  // ra, dec, and radius. Otherwise the cones array contains pairs of
+  // ra and dec and each cone is used with each radius.
+  TableExprConeIndex (const Array<Double>& cones, const Array<Double>& radii);
+
+  // Create an index if the cones (and radii) of the cone function are
+  // constant and if there are sufficient cones to make it worthwhile.
+  // Otherwise a null pointer is returned.
+  static CountedPtr<TableExprConeIndex> makeIndex
+    (const std::vector<TENShPtr>& operands, Bool hasRadii);
+
+  // Get the cones.
+  const Array<Double>& cones() const
+    { return itsCones; }
+
+  // Get the radii (empty if part of the cones).
+  const Array<Double>& radii() const
+    { return itsRadii; }
+
+  // Get the numbers of the cones (0-relative) the position might be in.
+  const std::vector<uInt>& candidates (Double dec) const;
+
+private:
+  // Get the zone number of a declination.
+  Int zone (Double dec) const;
+
+  //# Data members.
+  Array<Double>                   itsCones;
+  Array<Double>                   itsRadii;
+  Double                          itsZoneHeight;
+  std::vector<std::vector<uInt> > itsZones;
+  std::vector<uInt>               itsEmpty;
+};
+
+
 // <summary>
 // Class representing a cone search in table select expression
 // </summary>
@@ -52,16 +119,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // <synopsis> 
 // The class represents a cone search.
 // It is a specialization of the TableExprFuncNode class.
-// Currently the implementation is straightforward, but in the future
-// it can do smarter things.
-// For instance:
-// <ul>
-//  <li> If the cone positions and radii are constant, one can use
-//       an integer zone number (e.g. floor(dec)) to avoid the much
-//       more expensive sine/cosine calculations. Each cone will get a
-//       minzone and maxzone value (derived from cone position and radius).
-//  <li> Multiple cones can be ordered on minzone and maxzone.
-// </ul>
+// If the cone positions and radii are constant, a TableExprConeIndex
+// is used to test only the cones near a position.
 // </synopsis> 
 
 
@@ -99,8 +158,12 @@ private:
   // It returns -1 if unknown.
   static Int findNelem (const TENShPtr& node);
 
+  // Get the cone index (a null pointer if not possible).
+  const TableExprConeIndex* getIndex();
 
   uInt origin_p;
+  Bool indexDone_p;
+  CountedPtr<TableExprConeIndex> index_p;
 };
 
 
@@ -126,7 +189,12 @@ public:
   // </group>
 
 private:
+  // Get the cone index (a null pointer if not possible).
+  const TableExprConeIndex* getIndex();
+
   uInt origin_p;
+  Bool indexDone_p;
+  CountedPtr<TableExprConeIndex> index_p;
 };
 
 
@@ -32,13 +32,16 @@
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Utilities/DataType.h>
+#include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Quanta/MVTime.h>
 #include <casacore/casa/OS/Time.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
 
 
 
@@ -54,6 +57,9 @@ TableExprNodeConstBool::~TableExprNodeConstBool()
 {}
 Bool TableExprNodeConstBool::getBool (const TableExprId&)
     { return value_p; }
+void TableExprNodeConstBool::getBoolBatchV (rownr_t, uInt nrow,
+                                            Bool* values, const Bool*)
+    { std::fill (values, values+nrow, value_p); }
 
 TableExprNodeConstInt::TableExprNodeConstInt (const Int64& val)
 : TableExprNodeBinary (NTInt, VTScalar, OtLiteral, Table()),
@@ -67,6 +73,12 @@ Double TableExprNodeConstInt::getDouble (const TableExprId&)
     { return value_p; }
 DComplex TableExprNodeConstInt::getDComplex (const TableExprId&)
     { return double(value_p); }
+void TableExprNodeConstInt::getIntBatchV (rownr_t, uInt nrow,
+                                          Int64* values, const Bool*)
+    { std::fill (values, values+nrow, value_p); }
+void TableExprNodeConstInt::getDoubleBatchV (rownr_t, uInt nrow,
+                                             Double* values, const Bool*)
+    { std::fill (values, values+nrow, Double(value_p)); }
 
 TableExprNodeConstDouble::TableExprNodeConstDouble (const Double& val)
 : TableExprNodeBinary (NTDouble, VTScalar, OtLiteral, Table()),
@@ -78,6 +90,9 @@ Double TableExprNodeConstDouble::getDouble (const TableExprId&)
     { return value_p; }
 DComplex TableExprNodeConstDouble::getDComplex (const TableExprId&)
     { return value_p; }
+void TableExprNodeConstDouble::getDoubleBatchV (rownr_t, uInt nrow,
+                                                Double* values, const Bool*)
+    { std::fill (values, values+nrow, value_p); }
 
 TableExprNodeConstDComplex::TableExprNodeConstDComplex (const DComplex& val)
 : TableExprNodeBinary (NTComplex, VTScalar, OtLiteral, Table()),
@@ -186,7 +201,7 @@ void TableExprNodeColumn::disableApplySelection()
     applySelection_p = False;
 }
   
-void TableExprNodeColumn::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeColumn::applySelection (const Vector<rownr_t>& rownrs)
 {
     if (applySelection_p) {
         // Attach the column to the selection of the table.
@@ -204,34 +219,178 @@ void TableExprNodeColumn::applySelection (const Vector<uInt>& rownrs)
 const TableColumn& TableExprNodeColumn::getColumn() const
     { return tabCol_p; }
 
+String TableExprNodeColumn::description() const
+{
+    return TableExprNodeRep::description() + ' ' +
+           tabCol_p.columnDesc().name();
+}
+
+void TableExprNodeColumn::profileRead (uInt nrow)
+{
+    if (! profile_p.null()) {
+        profile_p->addBytes
+          (uInt64(nrow) * ValType::getTypeSize(tabCol_p.columnDesc().dataType()));
+    }
+}
+
+Bool TableExprNodeColumn::getValueRange (rownr_t rownr, rownr_t& endRow,
+                                         Double& minVal, Double& maxVal)
+{
+    if (valueType() != VTScalar
+    ||  (dataType() != NTInt  &&  dataType() != NTDouble)) {
+        return False;
+    }
+    return tabCol_p.getValueRange (rownr, endRow, minVal, maxVal);
+}
+
+// Read the values of a scalar column in a range of rows directly
+// into the output buffer.
+template<typename T>
+void getScalarColumnBatch (const TableColumn& col, rownr_t startRow,
+                           uInt nrow, T* values)
+{
+    Vector<T> vec (IPosition(1,nrow), values, SHARE);
+    ScalarColumn<T>(col).getColumnRange
+                         (Slicer(IPosition(1,startRow), IPosition(1,nrow)),
+                          vec);
+}
+
+// Read the values of a scalar column in a range of rows and convert
+// them to the type of the output buffer.
+template<typename T, typename U>
+void getScalarColumnBatch (const TableColumn& col, rownr_t startRow,
+                           uInt nrow, U* values)
+{
+    Vector<T> vec = ScalarColumn<T>(col).getColumnRange
+                    (Slicer(IPosition(1,startRow), IPosition(1,nrow)));
+    const T* data = vec.data();
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = data[i];
+    }
+}
+
+void TableExprNodeColumn::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                         Bool* values, const Bool* mask)
+{
+    // The table access is serialized if batches are evaluated in parallel.
+    BatchLock lock(*this);
+    if (tabCol_p.columnDesc().dataType() == TpBool) {
+        getScalarColumnBatch (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+    } else {
+        TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+    }
+}
+void TableExprNodeColumn::getIntBatchV (rownr_t startRow, uInt nrow,
+                                        Int64* values, const Bool* mask)
+{
+    BatchLock lock(*this);
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getScalarColumnBatch<uChar> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpShort:
+        getScalarColumnBatch<Short> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpUShort:
+        getScalarColumnBatch<uShort> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpInt:
+        getScalarColumnBatch<Int> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpUInt:
+        getScalarColumnBatch<uInt> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpInt64:
+        getScalarColumnBatch (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    default:
+        TableExprNodeRep::getIntBatchV (startRow, nrow, values, mask);
+    }
+}
+void TableExprNodeColumn::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                           Double* values, const Bool* mask)
+{
+    BatchLock lock(*this);
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getScalarColumnBatch<uChar> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpShort:
+        getScalarColumnBatch<Short> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpUShort:
+        getScalarColumnBatch<uShort> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpInt:
+        getScalarColumnBatch<Int> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpUInt:
+        getScalarColumnBatch<uInt> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpInt64:
+        getScalarColumnBatch<Int64> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpFloat:
+        getScalarColumnBatch<Float> (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    case TpDouble:
+        getScalarColumnBatch (tabCol_p, startRow, nrow, values);
+        profileRead (nrow);
+        break;
+    default:
+        TableExprNodeRep::getDoubleBatchV (startRow, nrow, values, mask);
+    }
+}
+
 Bool TableExprNodeColumn::getBool (const TableExprId& id)
 {
     Bool val;
     tabCol_p.getScalar (id.rownr(), val);
+    profileRead (1);
     return val;
 }
 Int64 TableExprNodeColumn::getInt (const TableExprId& id)
 {
     Int64 val;
     tabCol_p.getScalar (id.rownr(), val);
+    profileRead (1);
     return val;
 }
 Double TableExprNodeColumn::getDouble (const TableExprId& id)
 {
     Double val;
     tabCol_p.getScalar (id.rownr(), val);
+    profileRead (1);
     return val;
 }
 DComplex TableExprNodeColumn::getDComplex (const TableExprId& id)
 {
     DComplex val;
     tabCol_p.getScalar (id.rownr(), val);
+    profileRead (1);
     return val;
 }
 String TableExprNodeColumn::getString (const TableExprId& id)
 {
     String val;
     tabCol_p.getScalar (id.rownr(), val);
+    if (! profile_p.null()) {
+        profile_p->addBytes (val.size());
+    }
     return val;
 }
 
@@ -241,62 +400,62 @@ Bool TableExprNodeColumn::getColumnDataType (DataType& dt) const
     return True;
 }
 
-Array<Bool>     TableExprNodeColumn::getColumnBool (const Vector<uInt>& rownrs)
+Array<Bool>     TableExprNodeColumn::getColumnBool (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Bool> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<uChar>    TableExprNodeColumn::getColumnuChar (const Vector<uInt>& rownrs)
+Array<uChar>    TableExprNodeColumn::getColumnuChar (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<uChar> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Short>    TableExprNodeColumn::getColumnShort (const Vector<uInt>& rownrs)
+Array<Short>    TableExprNodeColumn::getColumnShort (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Short> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<uShort>   TableExprNodeColumn::getColumnuShort (const Vector<uInt>& rownrs)
+Array<uShort>   TableExprNodeColumn::getColumnuShort (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<uShort> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Int>      TableExprNodeColumn::getColumnInt (const Vector<uInt>& rownrs)
+Array<Int>      TableExprNodeColumn::getColumnInt (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Int> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<uInt>     TableExprNodeColumn::getColumnuInt (const Vector<uInt>& rownrs)
+Array<uInt>     TableExprNodeColumn::getColumnuInt (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<uInt> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Int64>    TableExprNodeColumn::getColumnInt64 (const Vector<uInt>& rownrs)
+Array<Int64>    TableExprNodeColumn::getColumnInt64 (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Int64> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Float>    TableExprNodeColumn::getColumnFloat (const Vector<uInt>& rownrs)
+Array<Float>    TableExprNodeColumn::getColumnFloat (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Float> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Double>   TableExprNodeColumn::getColumnDouble (const Vector<uInt>& rownrs)
+Array<Double>   TableExprNodeColumn::getColumnDouble (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Double> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Complex>  TableExprNodeColumn::getColumnComplex (const Vector<uInt>& rownrs)
+Array<Complex>  TableExprNodeColumn::getColumnComplex (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Complex> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<DComplex> TableExprNodeColumn::getColumnDComplex (const Vector<uInt>& rownrs)
+Array<DComplex> TableExprNodeColumn::getColumnDComplex (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<DComplex> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<String>   TableExprNodeColumn::getColumnString (const Vector<uInt>& rownrs)
+Array<String>   TableExprNodeColumn::getColumnString (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<String> col (tabCol_p);
     return col.getColumnCells (rownrs);
@@ -326,7 +485,7 @@ TableExprNodeRowid::TableExprNodeRowid (const Table& table)
 }
 TableExprNodeRowid::~TableExprNodeRowid ()
 {}
-void TableExprNodeRowid::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeRowid::applySelection (const Vector<rownr_t>& rownrs)
 {
     // Append rows for an insert.
     if (rownrs.size() == 1  &&  rownrs[0] >= rownrs_p.size()) {
@@ -337,7 +496,7 @@ void TableExprNodeRowid::applySelection (const Vector<uInt>& rownrs)
         }
     } else {
         // Select the rowid-s of the given rows.
-        Vector<uInt> newRows(rownrs.size());
+        Vector<rownr_t> newRows(rownrs.size());
         for (uInt i=0; i<rownrs.size(); ++i) {
             newRows[i] = rownrs_p[rownrs[i]];
         }
@@ -78,6 +78,8 @@ public:
     TableExprNodeConstBool (const Bool& value);
     ~TableExprNodeConstBool();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 private:
     Bool value_p;
 };
@@ -111,6 +113,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatchV    (rownr_t startRow, uInt nrow,
+                          Int64* values, const Bool* mask);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 private:
     Int64 value_p;
 };
@@ -143,6 +149,8 @@ public:
     ~TableExprNodeConstDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 private:
     Double value_p;
 };
@@ -309,7 +317,7 @@ public:
     virtual void disableApplySelection();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     // Get the data type of this scalar column.
     Bool getColumnDataType (DataType&) const;
@@ -322,24 +330,46 @@ public:
     String   getString   (const TableExprId& id);
     const TableColumn& getColumn() const;
 
+    // Get the description (including the column name).
+    virtual String description() const;
+
+    // Get the data for a batch of rows. The values are read at once
+    // for all rows in the batch, thus the mask is not used.
+    // <group>
+    void getBoolBatchV   (rownr_t startRow, uInt nrow,
+                          Bool* values, const Bool* mask);
+    void getIntBatchV    (rownr_t startRow, uInt nrow,
+                          Int64* values, const Bool* mask);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
+    // </group>
+
+    // Get the range of the values in a numeric scalar column
+    // as kept by the storage manager.
+    virtual Bool getValueRange (rownr_t rownr, rownr_t& endRow,
+                                Double& minVal, Double& maxVal);
+
     // Get the data for the given rows.
-    Array<Bool>     getColumnBool (const Vector<uInt>& rownrs);
-    Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs);
-    Array<Short>    getColumnShort (const Vector<uInt>& rownrs);
-    Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs);
-    Array<Int>      getColumnInt (const Vector<uInt>& rownrs);
-    Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs);
-    Array<Int64>    getColumnInt64 (const Vector<uInt>& rownrs);
-    Array<Float>    getColumnFloat (const Vector<uInt>& rownrs);
-    Array<Double>   getColumnDouble (const Vector<uInt>& rownrs);
-    Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs);
-    Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs);
-    Array<String>   getColumnString (const Vector<uInt>& rownrs);
+    Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs);
+    Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs);
+    Array<Short>    getColumnShort (const Vector<rownr_t>& rownrs);
+    Array<uShort>   getColumnuShort (const Vector<rownr_t>& rownrs);
+    Array<Int>      getColumnInt (const Vector<rownr_t>& rownrs);
+    Array<uInt>     getColumnuInt (const Vector<rownr_t>& rownrs);
+    Array<Int64>    getColumnInt64 (const Vector<rownr_t>& rownrs);
+    Array<Float>    getColumnFloat (const Vector<rownr_t>& rownrs);
+    Array<Double>   getColumnDouble (const Vector<rownr_t>& rownrs);
+    Array<Complex>  getColumnComplex (const Vector<rownr_t>& rownrs);
+    Array<DComplex> getColumnDComplex (const Vector<rownr_t>& rownrs);
+    Array<String>   getColumnString (const Vector<rownr_t>& rownrs);
 
     // Get the column unit (can be empty).
     static Unit getColumnUnit (const TableColumn&);
 
 protected:
+    // Add the number of bytes read for <src>nrow</src> rows to the profile.
+    void profileRead (uInt nrow);
+
     Table       selTable_p;
     TableColumn tabCol_p;
     Bool        applySelection_p;
@@ -407,10 +437,10 @@ class TableExprNodeRowid : public TableExprNodeBinary
 public:
     TableExprNodeRowid (const Table&);
     ~TableExprNodeRowid();
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
     Int64 getInt (const TableExprId& id);
 private:
-    Vector<uInt> rownrs_p;
+    Vector<rownr_t> rownrs_p;
 };
 
 
@@ -625,6 +625,100 @@ Int64 TableExprFuncNode::getInt (const TableExprId& id)
     return 0;
 }
 
+void TableExprFuncNode::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                         Double* values, const Bool* mask)
+{
+    Bool batch = False;
+    if (dataType() == NTDouble  &&  operands_p.size() == 1
+    &&  operands_p[0]->valueType() == VTScalar
+    &&  (operands_p[0]->dataType() == NTDouble
+         ||  operands_p[0]->dataType() == NTInt)) {
+        switch (funcType_p) {
+        case sinFUNC:
+        case sinhFUNC:
+        case cosFUNC:
+        case coshFUNC:
+        case expFUNC:
+        case logFUNC:
+        case log10FUNC:
+        case squareFUNC:
+        case cubeFUNC:
+        case sqrtFUNC:
+            batch = True;
+            break;
+        case absFUNC:
+            batch = (argDataType_p == NTDouble);
+            break;
+        default:
+            break;
+        }
+    }
+    if (! batch) {
+        TableExprNodeRep::getDoubleBatchV (startRow, nrow, values, mask);
+        return;
+    }
+    operands_p[0]->getDoubleBatch (startRow, nrow, values, mask);
+    switch (funcType_p) {
+    case sinFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = sin (values[i]);
+        }
+        break;
+    case sinhFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = sinh (values[i]);
+        }
+        break;
+    case cosFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = cos (values[i]);
+        }
+        break;
+    case coshFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = cosh (values[i]);
+        }
+        break;
+    case expFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = exp (values[i]);
+        }
+        break;
+    case logFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = log (values[i]);
+        }
+        break;
+    case log10FUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = log10 (values[i]);
+        }
+        break;
+    case squareFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = values[i] * values[i];
+        }
+        break;
+    case cubeFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = values[i] * values[i] * values[i];
+        }
+        break;
+    case sqrtFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = sqrt (values[i]) * scale_p;
+        }
+        break;
+    case absFUNC:
+        for (uInt i=0; i<nrow; ++i) {
+            values[i] = abs (values[i]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
 Double TableExprFuncNode::getDouble (const TableExprId& id)
 {
     if (dataType() == NTInt) {
@@ -366,6 +366,12 @@ public:
     MVTime    getDate     (const TableExprId& id);
     // </group>
 
+    // Get the results of some elementary mathematical functions
+    // (like sin, sqrt, abs) for a batch of rows.
+    // Other functions are evaluated row by row.
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
+
     // Check the data and value types of the operands.
     // It sets the exptected data and value types of the operands.
     // Set the value type of the function result and returns
@@ -27,11 +27,16 @@
 
 #include <casacore/tables/TaQL/ExprLogicNode.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/casa/Quanta/MVTime.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Containers/Block.h>
 #include <float.h>                     // for DBL_MAX
 #include <limits.h>                     // for DBL_MAX
+#include <algorithm>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -57,6 +62,24 @@ Bool TableExprNodeEQInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) == rnode_p->getInt(id);
 }
+void TableExprNodeEQInt::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                        Bool* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] == rval[i];
+    }
+}
+Bool TableExprNodeEQInt::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The values can only be equal if the ranges overlap.
+        return lmin <= rmax  &&  rmin <= lmax;
+    }
+    return True;
+}
 
 TableExprNodeEQDouble::TableExprNodeEQDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -67,6 +90,24 @@ Bool TableExprNodeEQDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) == rnode_p->getDouble(id);
 }
+void TableExprNodeEQDouble::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] == rval[i];
+    }
+}
+Bool TableExprNodeEQDouble::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The values can only be equal if the ranges overlap.
+        return lmin <= rmax  &&  rmin <= lmax;
+    }
+    return True;
+}
 
 TableExprNodeEQDComplex::TableExprNodeEQDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -78,6 +119,56 @@ Bool TableExprNodeEQDComplex::getBool (const TableExprId& id)
     return lnode_p->getDComplex(id) == rnode_p->getDComplex(id);
 }
 
+TableExprDictMatch::TableExprDictMatch()
+: itsState    (-1),
+  itsColumn   (0),
+  itsConstant (0)
+{}
+Bool TableExprDictMatch::canUse (TableExprNodeRep* left,
+                                 TableExprNodeRep* right,
+                                 Bool symmetric)
+{
+    if (itsState < 0) {
+        itsState = 0;
+        for (int i=0; i<(symmetric ? 2:1); ++i) {
+            TableExprNodeRep* operand = (i==0 ? left : right);
+            TableExprNodeRep* other   = (i==0 ? right : left);
+            const TableExprNodeColumn* colNode =
+              dynamic_cast<const TableExprNodeColumn*>(operand);
+            Vector<String> entries;
+            if (colNode  &&  other->isConstant()  &&
+                colNode->getColumn().getDictionary (0, entries)) {
+                itsColumn   = colNode;
+                itsConstant = other;
+                itsState    = 1;
+                break;
+            }
+        }
+    }
+    return itsState > 0;
+}
+template<typename MATCH>
+Bool TableExprDictMatch::evaluate (rownr_t startRow, uInt nrow,
+                                   Bool* values, MATCH match)
+{
+    const TableColumn& col = itsColumn->getColumn();
+    // Get the dictionary entries not seen before and match them.
+    Vector<String> entries;
+    if (! col.getDictionary (itsMatch.size(), entries)) {
+        itsState = 0;
+        return False;
+    }
+    for (uInt i=0; i<entries.size(); ++i) {
+        itsMatch.push_back (match(entries[i]));
+    }
+    itsCodes.resize (nrow);
+    col.getDictCodes (startRow, nrow, itsCodes.data());
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = itsMatch[itsCodes[i]];
+    }
+    return True;
+}
+
 TableExprNodeEQString::TableExprNodeEQString (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
 {}
@@ -87,6 +178,23 @@ Bool TableExprNodeEQString::getBool (const TableExprId& id)
 {
     return lnode_p->getString(id) == rnode_p->getString(id);
 }
+void TableExprNodeEQString::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    {
+        BatchLock lock(*this);
+        // The column can be the left or right operand.
+        if (itsDict.canUse (lnode_p.get(), rnode_p.get(), True)) {
+            String val = itsDict.constant()->getString (0);
+            if (itsDict.evaluate (startRow, nrow, values,
+                                  [&val](const String& s)
+                                  {return s == val;})) {
+                return;
+            }
+        }
+    }
+    TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+}
 
 TableExprNodeEQRegex::TableExprNodeEQRegex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -97,6 +205,22 @@ Bool TableExprNodeEQRegex::getBool (const TableExprId& id)
 {
     return rnode_p->getRegex(id).match (lnode_p->getString(id));
 }
+void TableExprNodeEQRegex::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                          Bool* values, const Bool* mask)
+{
+    {
+        BatchLock lock(*this);
+        if (itsDict.canUse (lnode_p.get(), rnode_p.get(), False)) {
+            TaqlRegex regex = rnode_p->getRegex (0);
+            if (itsDict.evaluate (startRow, nrow, values,
+                                  [&regex](const String& s)
+                                  {return regex.match(s);})) {
+                return;
+            }
+        }
+    }
+    TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+}
 
 TableExprNodeEQDate::TableExprNodeEQDate (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -128,6 +252,24 @@ Bool TableExprNodeNEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) != rnode_p->getInt(id);
 }
+void TableExprNodeNEInt::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                        Bool* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] != rval[i];
+    }
+}
+Bool TableExprNodeNEInt::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The values can only differ if not all values are the same.
+        return !(lmin == lmax  &&  rmin == rmax  &&  lmin == rmin);
+    }
+    return True;
+}
 
 TableExprNodeNEDouble::TableExprNodeNEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -138,6 +280,24 @@ Bool TableExprNodeNEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) != rnode_p->getDouble(id);
 }
+void TableExprNodeNEDouble::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] != rval[i];
+    }
+}
+Bool TableExprNodeNEDouble::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The values can only differ if not all values are the same.
+        return !(lmin == lmax  &&  rmin == rmax  &&  lmin == rmin);
+    }
+    return True;
+}
 
 TableExprNodeNEDComplex::TableExprNodeNEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -158,6 +318,22 @@ Bool TableExprNodeNEString::getBool (const TableExprId& id)
 {
     return lnode_p->getString(id) != rnode_p->getString(id);
 }
+void TableExprNodeNEString::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    {
+        BatchLock lock(*this);
+        if (itsDict.canUse (lnode_p.get(), rnode_p.get(), True)) {
+            String val = itsDict.constant()->getString (0);
+            if (itsDict.evaluate (startRow, nrow, values,
+                                  [&val](const String& s)
+                                  {return s != val;})) {
+                return;
+            }
+        }
+    }
+    TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+}
 
 TableExprNodeNERegex::TableExprNodeNERegex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -168,6 +344,22 @@ Bool TableExprNodeNERegex::getBool (const TableExprId& id)
 {
     return ! rnode_p->getRegex(id).match (lnode_p->getString(id));
 }
+void TableExprNodeNERegex::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                          Bool* values, const Bool* mask)
+{
+    {
+        BatchLock lock(*this);
+        if (itsDict.canUse (lnode_p.get(), rnode_p.get(), False)) {
+            TaqlRegex regex = rnode_p->getRegex (0);
+            if (itsDict.evaluate (startRow, nrow, values,
+                                  [&regex](const String& s)
+                                  {return !regex.match(s);})) {
+                return;
+            }
+        }
+    }
+    TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+}
 
 TableExprNodeNEDate::TableExprNodeNEDate (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -189,6 +381,24 @@ Bool TableExprNodeGTInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) > rnode_p->getInt(id);
 }
+void TableExprNodeGTInt::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                        Bool* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] > rval[i];
+    }
+}
+Bool TableExprNodeGTInt::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The left value can only be greater if its maximum is.
+        return lmax > rmin;
+    }
+    return True;
+}
 
 TableExprNodeGTDouble::TableExprNodeGTDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -199,6 +409,24 @@ Bool TableExprNodeGTDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) > rnode_p->getDouble(id);
 }
+void TableExprNodeGTDouble::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] > rval[i];
+    }
+}
+Bool TableExprNodeGTDouble::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The left value can only be greater if its maximum is.
+        return lmax > rmin;
+    }
+    return True;
+}
 
 TableExprNodeGTDComplex::TableExprNodeGTDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -240,6 +468,24 @@ Bool TableExprNodeGEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) >= rnode_p->getInt(id);
 }
+void TableExprNodeGEInt::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                        Bool* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] >= rval[i];
+    }
+}
+Bool TableExprNodeGEInt::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The left value can only be greater or equal if its maximum is.
+        return lmax >= rmin;
+    }
+    return True;
+}
 
 TableExprNodeGEDouble::TableExprNodeGEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -250,6 +496,24 @@ Bool TableExprNodeGEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) >= rnode_p->getDouble(id);
 }
+void TableExprNodeGEDouble::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] >= rval[i];
+    }
+}
+Bool TableExprNodeGEDouble::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax, rmin, rmax;
+    if (getValueRanges (rownr, endRow, lmin, lmax, rmin, rmax)) {
+        // The left value can only be greater or equal if its maximum is.
+        return lmax >= rmin;
+    }
+    return True;
+}
 
 TableExprNodeGEDComplex::TableExprNodeGEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -282,12 +546,87 @@ Bool TableExprNodeGEDate::getBool (const TableExprId& id)
 }
 
 
+// Get the overall range of the values in the constant right operand of IN.
+// It can be an array or a set of values and (possibly unbounded) intervals.
+// False is returned if the range is unknown (e.g. for an empty array).
+static Bool getINRange (const TENShPtr& node, Double& minVal, Double& maxVal)
+{
+    if (!node->isConstant()) {
+        return False;
+    }
+    const Double inf = std::numeric_limits<Double>::infinity();
+    minVal = inf;
+    maxVal = -inf;
+    if (node->valueType() == TableExprNodeRep::VTArray) {
+        MArray<Double> values = node->getArrayDouble(0);
+        Array<Double> arr(values.array());
+        if (values.hasMask()) {
+            arr.reference (values.flatten());
+        }
+        for (Array<Double>::const_iterator iter=arr.begin();
+             iter!=arr.end(); ++iter) {
+            if (isNaN(*iter)) {
+                return False;
+            }
+            minVal = std::min (minVal, *iter);
+            maxVal = std::max (maxVal, *iter);
+        }
+        return minVal <= maxVal;
+    }
+    const TableExprNodeSet* set =
+      dynamic_cast<const TableExprNodeSet*>(node.get());
+    if (!set) {
+        return False;
+    }
+    for (uInt i=0; i<set->size(); ++i) {
+        const TableExprNodeSetElem& elem = (*set)[i];
+        // An undefined start or end means unbounded on that side.
+        Double stVal  = -inf;
+        Double endVal = inf;
+        Double dummy;
+        rownr_t endRow = 0;
+        if (elem.start()  &&
+            !elem.start()->getValueRange (0, endRow, stVal, dummy)) {
+            return False;
+        }
+        if (elem.isSingle()) {
+            endVal = stVal;
+        } else if (elem.end()  &&
+                   !elem.end()->getValueRange (0, endRow, endVal, dummy)) {
+            return False;
+        }
+        minVal = std::min (minVal, stVal);
+        maxVal = std::max (maxVal, endVal);
+    }
+    return minVal <= maxVal;
+}
+
+// Tell if a value of the left operand of IN in the given rows can be
+// contained in a right operand with the given overall range.
+static Bool mayBeIN (TableExprNodeRep* lnode, Bool hasRange,
+                     Double minVal, Double maxVal,
+                     rownr_t rownr, rownr_t& endRow)
+{
+    Double lmin, lmax;
+    if (hasRange  &&  lnode->valueType() == TableExprNodeRep::VTScalar  &&
+        lnode->getValueRange (rownr, endRow, lmin, lmax)) {
+        return lmin <= maxVal  &&  lmax >= minVal;
+    }
+    return True;
+}
+
+
 TableExprNodeINInt::TableExprNodeINInt (const TableExprNodeRep& node,
                                         Bool)
-: TableExprNodeBinary (NTBool, node, OtIN)
+: TableExprNodeBinary (NTBool, node, OtIN),
+  itsUseSet   (False),
+  itsHasRange (False),
+  itsMinVal   (0),
+  itsMaxVal   (0)
 {}
 void TableExprNodeINInt::convertConstChild()
 {
+  itsHasRange = getINRange (rnode_p, itsMinVal, itsMaxVal);
   if (rnode_p->isConstant()  &&  rnode_p->valueType() == VTArray) {
     // Convert array to a set for lookup
     MArray<Int64> values = rnode_p->getArrayInt(0);
@@ -296,10 +635,9 @@ void TableExprNodeINInt::convertConstChild()
       // Remove masked elements.
       arr.reference (values.flatten());
     }
-    if (! arr.empty()) {
-      itsIndexSet.clear();
-      itsIndexSet.insert(arr.begin(), arr.end());
-    }
+    itsIndexSet.clear();
+    itsIndexSet.insert(arr.begin(), arr.end());
+    itsUseSet = True;
   }
 }
 TableExprNodeINInt::~TableExprNodeINInt()
@@ -307,20 +645,78 @@ TableExprNodeINInt::~TableExprNodeINInt()
 Bool TableExprNodeINInt::getBool (const TableExprId& id)
 {
     Int64 val = lnode_p->getInt (id);
-    if (itsIndexSet.size() > 0) {
+    if (itsUseSet) {
       return itsIndexSet.find(val) != itsIndexSet.end();
     }
     return rnode_p->hasInt (id, val);
 }
+void TableExprNodeINInt::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                        Bool* values, const Bool* mask)
+{
+    if (! itsUseSet) {
+      TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+      return;
+    }
+    std::vector<Int64> lval(nrow, 0);
+    lnode_p->getIntBatch (startRow, nrow, lval.data(), mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = itsIndexSet.find(lval[i]) != itsIndexSet.end();
+    }
+}
+Bool TableExprNodeINInt::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    return mayBeIN (lnode_p.get(), itsHasRange, itsMinVal, itsMaxVal,
+                    rownr, endRow);
+}
 
 TableExprNodeINDouble::TableExprNodeINDouble (const TableExprNodeRep& node)
-: TableExprNodeBinary (NTBool, node, OtIN)
+: TableExprNodeBinary (NTBool, node, OtIN),
+  itsUseSet   (False),
+  itsHasRange (False),
+  itsMinVal   (0),
+  itsMaxVal   (0)
 {}
 TableExprNodeINDouble::~TableExprNodeINDouble()
 {}
+void TableExprNodeINDouble::convertConstChild()
+{
+  itsHasRange = getINRange (rnode_p, itsMinVal, itsMaxVal);
+  if (rnode_p->isConstant()  &&  rnode_p->valueType() == VTArray) {
+    MArray<Double> values = rnode_p->getArrayDouble(0);
+    Array<Double> arr(values.array());
+    if (values.hasMask()) {
+      arr.reference (values.flatten());
+    }
+    itsIndexSet.clear();
+    itsIndexSet.insert(arr.begin(), arr.end());
+    itsUseSet = True;
+  }
+}
 Bool TableExprNodeINDouble::getBool (const TableExprId& id)
 {
-    return rnode_p->hasDouble (id, lnode_p->getDouble (id));
+    Double val = lnode_p->getDouble (id);
+    if (itsUseSet) {
+      return itsIndexSet.find(val) != itsIndexSet.end();
+    }
+    return rnode_p->hasDouble (id, val);
+}
+void TableExprNodeINDouble::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    if (! itsUseSet) {
+      TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+      return;
+    }
+    std::vector<Double> lval(nrow, 0.);
+    lnode_p->getDoubleBatch (startRow, nrow, lval.data(), mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = itsIndexSet.find(lval[i]) != itsIndexSet.end();
+    }
+}
+Bool TableExprNodeINDouble::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    return mayBeIN (lnode_p.get(), itsHasRange, itsMinVal, itsMaxVal,
+                    rownr, endRow);
 }
 
 TableExprNodeINDComplex::TableExprNodeINDComplex (const TableExprNodeRep& node)
@@ -334,22 +730,78 @@ Bool TableExprNodeINDComplex::getBool (const TableExprId& id)
 }
 
 TableExprNodeINString::TableExprNodeINString (const TableExprNodeRep& node)
-: TableExprNodeBinary (NTBool, node, OtIN)
+: TableExprNodeBinary (NTBool, node, OtIN),
+  itsUseSet (False)
 {}
 TableExprNodeINString::~TableExprNodeINString()
 {}
+void TableExprNodeINString::convertConstChild()
+{
+  if (rnode_p->isConstant()  &&  rnode_p->valueType() == VTArray) {
+    MArray<String> values = rnode_p->getArrayString(0);
+    Array<String> arr(values.array());
+    if (values.hasMask()) {
+      arr.reference (values.flatten());
+    }
+    itsIndexSet.clear();
+    itsIndexSet.insert(arr.begin(), arr.end());
+    itsUseSet = True;
+  }
+}
 Bool TableExprNodeINString::getBool (const TableExprId& id)
 {
+    if (itsUseSet) {
+      return itsIndexSet.find(lnode_p->getString (id)) != itsIndexSet.end();
+    }
     return rnode_p->hasString (id, lnode_p->getString (id));
 }
+void TableExprNodeINString::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                           Bool* values, const Bool* mask)
+{
+    {
+        BatchLock lock(*this);
+        if (itsUseSet  &&
+            itsDict.canUse (lnode_p.get(), rnode_p.get(), False)) {
+            if (itsDict.evaluate (startRow, nrow, values,
+                                  [this](const String& s)
+                                  {return itsIndexSet.find(s) !=
+                                     itsIndexSet.end();})) {
+                return;
+            }
+        }
+    }
+    TableExprNodeRep::getBoolBatchV (startRow, nrow, values, mask);
+}
 
 TableExprNodeINDate::TableExprNodeINDate (const TableExprNodeRep& node)
-: TableExprNodeBinary (NTBool, node, OtIN)
+: TableExprNodeBinary (NTBool, node, OtIN),
+  itsUseSet (False)
 {}
 TableExprNodeINDate::~TableExprNodeINDate()
 {}
+void TableExprNodeINDate::convertConstChild()
+{
+  if (rnode_p->isConstant()  &&  rnode_p->valueType() == VTArray) {
+    // MVTime compares the day values, so a set of those can be used.
+    MArray<MVTime> values = rnode_p->getArrayDate(0);
+    Array<MVTime> arr(values.array());
+    if (values.hasMask()) {
+      arr.reference (values.flatten());
+    }
+    itsIndexSet.clear();
+    for (Array<MVTime>::const_iterator iter=arr.begin();
+         iter!=arr.end(); ++iter) {
+      itsIndexSet.insert (iter->day());
+    }
+    itsUseSet = True;
+  }
+}
 Bool TableExprNodeINDate::getBool (const TableExprId& id)
 {
+    if (itsUseSet) {
+      return itsIndexSet.find(lnode_p->getDate(id).day()) !=
+             itsIndexSet.end();
+    }
     return rnode_p->hasDate (id, lnode_p->getDate (id));
 }
 
@@ -363,6 +815,40 @@ Bool TableExprNodeOR::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) || rnode_p->getBool(id);
 }
+void TableExprNodeOR::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                     Bool* values, const Bool* mask)
+{
+    // The right operand is only evaluated for rows where the left one
+    // is false.
+    lnode_p->getBoolBatch (startRow, nrow, values, mask);
+    Block<Bool> rmask(nrow, False);
+    Bool found = False;
+    for (uInt i=0; i<nrow; ++i) {
+        if ((mask == 0  ||  mask[i])  &&  !values[i]) {
+            rmask[i] = found = True;
+        }
+    }
+    if (found) {
+        Block<Bool> rval(nrow, False);
+        rnode_p->getBoolBatch (startRow, nrow, rval.storage(),
+                               rmask.storage());
+        for (uInt i=0; i<nrow; ++i) {
+            if (rmask[i]) {
+                values[i] = rval[i];
+            }
+        }
+    }
+}
+Bool TableExprNodeOR::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    // It can only be false if both operands are false.
+    rownr_t lend = endRow;
+    rownr_t rend = endRow;
+    Bool lval = lnode_p->mayBeTrue (rownr, lend);
+    Bool rval = rnode_p->mayBeTrue (rownr, rend);
+    endRow = std::min (lend, rend);
+    return lval || rval;
+}
 
 
 TableExprNodeAND::TableExprNodeAND (const TableExprNodeRep& node)
@@ -374,6 +860,46 @@ Bool TableExprNodeAND::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) && rnode_p->getBool(id);
 }
+void TableExprNodeAND::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                      Bool* values, const Bool* mask)
+{
+    // The right operand is only evaluated for rows where the left one
+    // is true.
+    lnode_p->getBoolBatch (startRow, nrow, values, mask);
+    Block<Bool> rmask(nrow, False);
+    Bool found = False;
+    for (uInt i=0; i<nrow; ++i) {
+        if ((mask == 0  ||  mask[i])  &&  values[i]) {
+            rmask[i] = found = True;
+        }
+    }
+    if (found) {
+        Block<Bool> rval(nrow, False);
+        rnode_p->getBoolBatch (startRow, nrow, rval.storage(),
+                               rmask.storage());
+        for (uInt i=0; i<nrow; ++i) {
+            if (rmask[i]) {
+                values[i] = rval[i];
+            }
+        }
+    }
+}
+Bool TableExprNodeAND::mayBeTrue (rownr_t rownr, rownr_t& endRow)
+{
+    // It is false for all rows for which one of the operands is false.
+    rownr_t lend = endRow;
+    rownr_t rend = endRow;
+    Bool lval = lnode_p->mayBeTrue (rownr, lend);
+    Bool rval = rnode_p->mayBeTrue (rownr, rend);
+    if (lval && rval) {
+        endRow = std::min (lend, rend);
+    } else if (!lval && !rval) {
+        endRow = std::max (lend, rend);
+    } else {
+        endRow = (lval ? rend : lend);
+    }
+    return lval && rval;
+}
 
 
 TableExprNodeNOT::TableExprNodeNOT (const TableExprNodeRep& node)
@@ -385,91 +911,58 @@ Bool TableExprNodeNOT::getBool (const TableExprId& id)
 {
   return ! lnode_p->getBool(id);
 }
+void TableExprNodeNOT::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                      Bool* values, const Bool* mask)
+{
+  lnode_p->getBoolBatch (startRow, nrow, values, mask);
+  for (uInt i=0; i<nrow; ++i) {
+    if (mask == 0  ||  mask[i]) {
+      values[i] = !values[i];
+    }
+  }
+}
+
 
 
+void TableExprNodeEQInt::ranges (Block<TableExprRange>& blrange)
+{
+    createCompareRange (blrange, True);
+}
 
 void TableExprNodeEQDouble::ranges (Block<TableExprRange>& blrange)
 {
-    Double dval = 0;
-    TENShPtr tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-        tsncol = lnode_p;
-        dval = rnode_p->getDouble (0);
-    }else{
-        if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  rnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-            tsncol = rnode_p;
-            dval = lnode_p->getDouble (0);
-        }
-    }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
-    TableExprNodeRep::createRange (blrange,
-                                   dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
-                                   dval, dval);
+    createCompareRange (blrange, True);
+}
+
+void TableExprNodeGEInt::ranges (Block<TableExprRange>& blrange)
+{
+    createCompareRange (blrange, False);
 }
 
 void TableExprNodeGEDouble::ranges (Block<TableExprRange>& blrange)
 {
-    Double st = 0;
-    Double end = 0;
-    TENShPtr tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-        tsncol = lnode_p;
-        st = rnode_p->getDouble (0);
-        end = DBL_MAX;
-    }else{
-        if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  rnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-            tsncol = rnode_p;
-            end = lnode_p->getDouble (0);
-            st = -DBL_MAX;
-        }
-    }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
-    TableExprNodeRep::createRange (blrange,
-                                   dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
-                                   st, end);
+    createCompareRange (blrange, False);
+}
+
+//# The ranges are closed, so a > comparison gives the same range as >=.
+void TableExprNodeGTInt::ranges (Block<TableExprRange>& blrange)
+{
+    createCompareRange (blrange, False);
 }
 
 void TableExprNodeGTDouble::ranges (Block<TableExprRange>& blrange)
 {
-    Double st = 0;
-    Double end = 0;
-    TENShPtr tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-        tsncol = lnode_p;
-        st = rnode_p->getDouble (0);
-        end = DBL_MAX;
-    }else{
-        if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-            tsncol = rnode_p;
-            end = lnode_p->getDouble (0);
-            st = -DBL_MAX;
-        }
-    }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
-    TableExprNodeRep::createRange (blrange,
-                                   dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
-                                   st, end);
+    createCompareRange (blrange, False);
+}
+
+void TableExprNodeINInt::ranges (Block<TableExprRange>& blrange)
+{
+    createINRange (blrange);
+}
+
+void TableExprNodeINDouble::ranges (Block<TableExprRange>& blrange)
+{
+    createINRange (blrange);
 }
 
 
@@ -31,11 +31,16 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprNodeRep.h>
-#include <set>
+#include <unordered_set>
+#include <string>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# Forward Declarations
+class TableExprNodeColumn;
+
 //# This file defines classes derived from TableExprNode representing
 //# the data type and operator in a table expression.
 //#
@@ -104,6 +109,10 @@ public:
     TableExprNodeEQInt (const TableExprNodeRep&);
     ~TableExprNodeEQInt();
     Bool getBool (const TableExprId& id);
+    void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -135,6 +144,9 @@ public:
     ~TableExprNodeEQDouble();
     Bool getBool (const TableExprId& id);
     void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -168,6 +180,59 @@ public:
 };
 
 
+// <summary>
+// Evaluate a string comparison per dictionary entry
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tExprNodeDict">
+// </reviewed>
+
+// <synopsis>
+// A scalar String column can be dictionary encoded (see
+// <linkto class=StandardStMan>StandardStMan</linkto>), in which case
+// each row holds the index (code) of its value in a dictionary.
+// If such a column is compared with a constant, the comparison only needs
+// to be done once per dictionary entry. This class keeps the result per
+// entry and evaluates a batch of rows by looking up the codes of the rows.
+// <br>The dictionary can grow, so the results of new entries are added
+// when needed. The caller has to lock the node using
+// <src>TableExprNodeRep::BatchLock</src>, because the object is changed.
+// </synopsis>
+
+class TableExprDictMatch
+{
+public:
+    TableExprDictMatch();
+
+    // Test if the left operand is a dictionary encoded column and the
+    // right operand is constant. If <src>symmetric</src> is True, the
+    // other way around is tested as well. It is determined once.
+    Bool canUse (TableExprNodeRep* left, TableExprNodeRep* right,
+                 Bool symmetric);
+
+    // Get the constant operand (only valid if canUse returned True).
+    TableExprNodeRep* constant() const
+      { return itsConstant; }
+
+    // Evaluate the rows using the dictionary codes. The function object
+    // <src>match</src> is called once for each (new) dictionary entry.
+    // False is returned if the column is not dictionary encoded (anymore),
+    // in which case the rows have to be evaluated normally.
+    template<typename MATCH>
+    Bool evaluate (rownr_t startRow, uInt nrow, Bool* values, MATCH match);
+
+private:
+    // -1 = not determined yet; 0 = cannot be used; 1 = can be used
+    Int itsState;
+    const TableExprNodeColumn* itsColumn;
+    TableExprNodeRep* itsConstant;
+    std::vector<Bool> itsMatch;
+    std::vector<uInt> itsCodes;
+};
+
+
 // <summary>
 // String comparison == in table select expression tree
 // </summary>
@@ -187,6 +252,8 @@ public:
 // This is defined for all data types.
 // Only the Bool get function is defined, because the result of a
 // compare is always a Bool.
+// <br>If one operand is a dictionary encoded column and the other is a
+// constant, a batch of rows is evaluated using the dictionary.
 // </synopsis> 
 
 class TableExprNodeEQString : public TableExprNodeBinary
@@ -195,6 +262,10 @@ public:
     TableExprNodeEQString (const TableExprNodeRep&);
     ~TableExprNodeEQString();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
+private:
+    TableExprDictMatch itsDict;
 };
 
 
@@ -225,6 +296,10 @@ public:
     TableExprNodeEQRegex (const TableExprNodeRep&);
     ~TableExprNodeEQRegex();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
+private:
+    TableExprDictMatch itsDict;
 };
 
 
@@ -316,6 +391,9 @@ public:
     TableExprNodeNEInt (const TableExprNodeRep&);
     ~TableExprNodeNEInt();
     Bool getBool (const TableExprId& id);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -346,6 +424,9 @@ public:
     TableExprNodeNEDouble (const TableExprNodeRep&);
     ~TableExprNodeNEDouble();
     Bool getBool (const TableExprId& id);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -406,6 +487,10 @@ public:
     TableExprNodeNEString (const TableExprNodeRep&);
     ~TableExprNodeNEString();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
+private:
+    TableExprDictMatch itsDict;
 };
 
 
@@ -436,6 +521,10 @@ public:
     TableExprNodeNERegex (const TableExprNodeRep&);
     ~TableExprNodeNERegex();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
+private:
+    TableExprDictMatch itsDict;
 };
 
 
@@ -497,6 +586,10 @@ public:
     TableExprNodeGTInt (const TableExprNodeRep&);
     ~TableExprNodeGTInt();
     Bool getBool (const TableExprId& id);
+    void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -528,6 +621,9 @@ public:
     ~TableExprNodeGTDouble();
     Bool getBool (const TableExprId& id);
     void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -649,6 +745,10 @@ public:
     TableExprNodeGEInt (const TableExprNodeRep&);
     ~TableExprNodeGEInt();
     Bool getBool (const TableExprId& id);
+    void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -680,6 +780,9 @@ public:
     ~TableExprNodeGEDouble();
     Bool getBool (const TableExprId& id);
     void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -793,6 +896,13 @@ public:
 // This is defined for all data types.
 // Only the Bool get function is defined, because the result of a
 // compare is always a Bool.
+// <br>If the right operand is a constant array (e.g. a constant set or
+// the result of a subquery), it is converted once to a hash set, so a
+// lookup does not need to scan the array for each row.
+// <br>If the right operand is constant, its overall range is used by
+// <src>mayBeTrue</src> to skip rows whose value range (e.g. a zone map)
+// does not overlap. This also applies to BETWEEN, which is an IN with
+// a closed interval.
 // </synopsis> 
 
 class TableExprNodeINInt : public TableExprNodeBinary
@@ -803,9 +913,18 @@ public:
     virtual ~TableExprNodeINInt();
     virtual void convertConstChild();
     virtual Bool getBool (const TableExprId& id);
+    virtual void getBoolBatchV (rownr_t startRow, uInt nrow,
+                                Bool* values, const Bool* mask);
+    virtual void ranges (Block<TableExprRange>&);
+    virtual Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
 private:
     // If the right node is constant it is converted to a set
-    std::set<Int64> itsIndexSet;
+    std::unordered_set<Int64> itsIndexSet;
+    Bool itsUseSet;
+    // The overall range of a constant right node.
+    Bool   itsHasRange;
+    Double itsMinVal;
+    Double itsMaxVal;
 };
 
 
@@ -828,6 +947,13 @@ private:
 // This is defined for all data types.
 // Only the Bool get function is defined, because the result of a
 // compare is always a Bool.
+// <br>If the right operand is a constant array (e.g. a constant set or
+// the result of a subquery), it is converted once to a hash set, so a
+// lookup does not need to scan the array for each row.
+// <br>If the right operand is constant, its overall range is used by
+// <src>mayBeTrue</src> to skip rows whose value range (e.g. a zone map)
+// does not overlap. This also applies to BETWEEN, which is an IN with
+// a closed interval.
 // </synopsis> 
 
 class TableExprNodeINDouble : public TableExprNodeBinary
@@ -835,7 +961,20 @@ class TableExprNodeINDouble : public TableExprNodeBinary
 public:
     TableExprNodeINDouble (const TableExprNodeRep&);
     ~TableExprNodeINDouble();
+    void convertConstChild();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
+    void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+private:
+    // If the right node is constant it is converted to a set
+    std::unordered_set<Double> itsIndexSet;
+    Bool itsUseSet;
+    // The overall range of a constant right node.
+    Bool   itsHasRange;
+    Double itsMinVal;
+    Double itsMaxVal;
 };
 
 
@@ -888,6 +1027,11 @@ public:
 // This is defined for all data types.
 // Only the Bool get function is defined, because the result of a
 // compare is always a Bool.
+// <br>If the right operand is a constant array (e.g. a constant set or
+// the result of a subquery), it is converted once to a hash set, so a
+// lookup does not need to scan the array for each row.
+// <br>If the left operand is a dictionary encoded column, a batch of rows
+// is evaluated by looking up each dictionary entry only once.
 // </synopsis> 
 
 class TableExprNodeINString : public TableExprNodeBinary
@@ -895,7 +1039,15 @@ class TableExprNodeINString : public TableExprNodeBinary
 public:
     TableExprNodeINString (const TableExprNodeRep&);
     ~TableExprNodeINString();
+    void convertConstChild();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
+private:
+    // If the right node is constant it is converted to a set
+    std::unordered_set<String, std::hash<std::string> > itsIndexSet;
+    Bool itsUseSet;
+    TableExprDictMatch itsDict;
 };
 
 
@@ -918,6 +1070,9 @@ public:
 // This is defined for all data types.
 // Only the Bool get function is defined, because the result of a
 // compare is always a Bool.
+// <br>If the right operand is a constant array (e.g. a constant set or
+// the result of a subquery), it is converted once to a hash set, so a
+// lookup does not need to scan the array for each row.
 // </synopsis> 
 
 class TableExprNodeINDate : public TableExprNodeBinary
@@ -925,7 +1080,12 @@ class TableExprNodeINDate : public TableExprNodeBinary
 public:
     TableExprNodeINDate (const TableExprNodeRep&);
     ~TableExprNodeINDate();
+    void convertConstChild();
     Bool getBool (const TableExprId& id);
+private:
+    // If the right node is constant it is converted to a set of MJDs
+    std::unordered_set<Double> itsIndexSet;
+    Bool itsUseSet;
 };
 
 
@@ -956,6 +1116,9 @@ public:
     ~TableExprNodeOR();
     Bool getBool (const TableExprId& id);
     void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -985,6 +1148,9 @@ public:
     ~TableExprNodeAND();
     Bool getBool (const TableExprId& id);
     void ranges (Block<TableExprRange>&);
+    Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
@@ -1013,6 +1179,8 @@ public:
     TableExprNodeNOT (const TableExprNodeRep&);
     ~TableExprNodeNOT();
     Bool getBool (const TableExprId& id);
+    void getBoolBatchV (rownr_t startRow, uInt nrow,
+                        Bool* values, const Bool* mask);
 };
 
 
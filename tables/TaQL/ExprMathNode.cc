@@ -29,6 +29,7 @@
 #include <casacore/tables/TaQL/ExprUnitNode.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Quanta/MVTime.h>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -53,6 +54,24 @@ Double TableExprNodePlusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) + rnode_p->getInt(id); }
 DComplex TableExprNodePlusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) + rnode_p->getInt(id)); }
+void TableExprNodePlusInt::getIntBatchV (rownr_t startRow, uInt nrow,
+                                         Int64* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] + rval[i];
+    }
+}
+void TableExprNodePlusInt::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                            Double* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] + rval[i];
+    }
+}
 
 TableExprNodePlusDouble::TableExprNodePlusDouble (const TableExprNodeRep& node)
 : TableExprNodePlus (NTDouble, node)
@@ -63,6 +82,15 @@ Double TableExprNodePlusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
 DComplex TableExprNodePlusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
+void TableExprNodePlusDouble::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                               Double* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] + rval[i];
+    }
+}
 
 TableExprNodePlusDComplex::TableExprNodePlusDComplex (const TableExprNodeRep& node)
 : TableExprNodePlus (NTComplex, node)
@@ -125,6 +153,24 @@ Double TableExprNodeMinusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) - rnode_p->getInt(id); }
 DComplex TableExprNodeMinusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) - rnode_p->getInt(id)); }
+void TableExprNodeMinusInt::getIntBatchV (rownr_t startRow, uInt nrow,
+                                          Int64* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] - rval[i];
+    }
+}
+void TableExprNodeMinusInt::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                             Double* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] - rval[i];
+    }
+}
 
 TableExprNodeMinusDouble::TableExprNodeMinusDouble (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTDouble, node)
@@ -143,6 +189,15 @@ Double TableExprNodeMinusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
 DComplex TableExprNodeMinusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
+void TableExprNodeMinusDouble::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                                Double* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] - rval[i];
+    }
+}
 
 TableExprNodeMinusDComplex::TableExprNodeMinusDComplex (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTComplex, node)
@@ -198,6 +253,24 @@ Double TableExprNodeTimesInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) * rnode_p->getInt(id); }
 DComplex TableExprNodeTimesInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) * rnode_p->getInt(id)); }
+void TableExprNodeTimesInt::getIntBatchV (rownr_t startRow, uInt nrow,
+                                          Int64* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] * rval[i];
+    }
+}
+void TableExprNodeTimesInt::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                             Double* values, const Bool* mask)
+{
+    std::vector<Int64> lval, rval;
+    getIntBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] * rval[i];
+    }
+}
 
 TableExprNodeTimesDouble::TableExprNodeTimesDouble (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTDouble, node)
@@ -208,6 +281,15 @@ Double TableExprNodeTimesDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
 DComplex TableExprNodeTimesDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
+void TableExprNodeTimesDouble::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                                Double* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] * rval[i];
+    }
+}
 
 TableExprNodeTimesDComplex::TableExprNodeTimesDComplex (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTComplex, node)
@@ -264,6 +346,15 @@ Double TableExprNodeDivideDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
 DComplex TableExprNodeDivideDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
+void TableExprNodeDivideDouble::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                                 Double* values, const Bool* mask)
+{
+    std::vector<Double> lval, rval;
+    getDoubleBatches (startRow, nrow, lval, rval, mask);
+    for (uInt i=0; i<nrow; ++i) {
+        values[i] = lval[i] / rval[i];
+    }
+}
 
 TableExprNodeDivideDComplex::TableExprNodeDivideDComplex (const TableExprNodeRep& node)
 : TableExprNodeDivide (NTComplex, node)
@@ -103,6 +103,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatchV    (rownr_t startRow, uInt nrow,
+                          Int64* values, const Bool* mask);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -135,6 +139,8 @@ public:
     ~TableExprNodePlusDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -291,6 +297,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatchV    (rownr_t startRow, uInt nrow,
+                          Int64* values, const Bool* mask);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -323,6 +333,8 @@ public:
     virtual void handleUnits();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -446,6 +458,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatchV    (rownr_t startRow, uInt nrow,
+                          Int64* values, const Bool* mask);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -477,6 +493,8 @@ public:
     ~TableExprNodeTimesDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -567,6 +585,8 @@ public:
     ~TableExprNodeDivideDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                          Double* values, const Bool* mask);
 };
 
 
@@ -270,7 +270,7 @@ public:
 
     // Re-create the column object for a selection of rows.
     // Nothing is done if the node does not represent a column object.
-    void applySelection (const Vector<uInt>& rownrs)
+    void applySelection (const Vector<rownr_t>& rownrs)
       { node_p->applySelection (rownrs); }
 
     // Get the unit of the expression.
@@ -294,7 +294,7 @@ public:
     // Get the number of rows in the table associated with this expression.
     // One is returned if the expression is a constant.
     // Zero is returned if no table is associated with it.
-    uInt nrow() const
+    rownr_t nrow() const
       { return node_p->nrow(); }
 
     // Get a value for this node in the given row.
@@ -357,18 +357,18 @@ public:
     // The data of function called should match the data type as
     // returned by function <src>getColumnDataType</src>.
     // <group>
-    Array<Bool>     getColumnBool (const Vector<uInt>& rownrs) const;
-    Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs) const;
-    Array<Short>    getColumnShort (const Vector<uInt>& rownrs) const;
-    Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs) const;
-    Array<Int>      getColumnInt (const Vector<uInt>& rownrs) const;
-    Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs) const;
-    Array<Int64>    getColumnInt64 (const Vector<uInt>& rownrs) const;
-    Array<Float>    getColumnFloat (const Vector<uInt>& rownrs) const;
-    Array<Double>   getColumnDouble (const Vector<uInt>& rownrs) const;
-    Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs) const;
-    Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs) const;
-    Array<String>   getColumnString (const Vector<uInt>& rownrs) const;
+    Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs) const;
+    Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs) const;
+    Array<Short>    getColumnShort (const Vector<rownr_t>& rownrs) const;
+    Array<uShort>   getColumnuShort (const Vector<rownr_t>& rownrs) const;
+    Array<Int>      getColumnInt (const Vector<rownr_t>& rownrs) const;
+    Array<uInt>     getColumnuInt (const Vector<rownr_t>& rownrs) const;
+    Array<Int64>    getColumnInt64 (const Vector<rownr_t>& rownrs) const;
+    Array<Float>    getColumnFloat (const Vector<rownr_t>& rownrs) const;
+    Array<Double>   getColumnDouble (const Vector<rownr_t>& rownrs) const;
+    Array<Complex>  getColumnComplex (const Vector<rownr_t>& rownrs) const;
+    Array<DComplex> getColumnDComplex (const Vector<rownr_t>& rownrs) const;
+    Array<String>   getColumnString (const Vector<rownr_t>& rownrs) const;
     // </group>
 
     // Show the tree.
@@ -616,29 +616,29 @@ inline MArray<String> TableExprNode::getStringAS (const TableExprId& id) const
 inline MArray<MVTime> TableExprNode::getDateAS (const TableExprId& id) const
     { return node_p->getDateAS (id); }
 
-inline Array<Bool>      TableExprNode::getColumnBool (const Vector<uInt>& rownrs) const
+inline Array<Bool>      TableExprNode::getColumnBool (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnBool (rownrs); }
-inline Array<uChar>     TableExprNode::getColumnuChar (const Vector<uInt>& rownrs) const
+inline Array<uChar>     TableExprNode::getColumnuChar (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnuChar (rownrs); }
-inline Array<Short>     TableExprNode::getColumnShort (const Vector<uInt>& rownrs) const
+inline Array<Short>     TableExprNode::getColumnShort (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnShort (rownrs); }
-inline Array<uShort>    TableExprNode::getColumnuShort (const Vector<uInt>& rownrs) const
+inline Array<uShort>    TableExprNode::getColumnuShort (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnuShort (rownrs); }
-inline Array<Int>       TableExprNode::getColumnInt (const Vector<uInt>& rownrs) const
+inline Array<Int>       TableExprNode::getColumnInt (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnInt (rownrs); }
-inline Array<uInt>      TableExprNode::getColumnuInt (const Vector<uInt>& rownrs) const
+inline Array<uInt>      TableExprNode::getColumnuInt (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnuInt (rownrs); }
-inline Array<Int64>     TableExprNode::getColumnInt64 (const Vector<uInt>& rownrs) const
+inline Array<Int64>     TableExprNode::getColumnInt64 (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnInt64 (rownrs); }
-inline Array<Float>     TableExprNode::getColumnFloat (const Vector<uInt>& rownrs) const
+inline Array<Float>     TableExprNode::getColumnFloat (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnFloat (rownrs); }
-inline Array<Double>    TableExprNode::getColumnDouble (const Vector<uInt>& rownrs) const
+inline Array<Double>    TableExprNode::getColumnDouble (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnDouble (rownrs); }
-inline Array<Complex>   TableExprNode::getColumnComplex (const Vector<uInt>& rownrs) const
+inline Array<Complex>   TableExprNode::getColumnComplex (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnComplex (rownrs); }
-inline Array<DComplex>  TableExprNode::getColumnDComplex (const Vector<uInt>& rownrs) const
+inline Array<DComplex>  TableExprNode::getColumnDComplex (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnDComplex (rownrs); }
-inline Array<String>    TableExprNode::getColumnString (const Vector<uInt>& rownrs) const
+inline Array<String>    TableExprNode::getColumnString (const Vector<rownr_t>& rownrs) const
     { return node_p->getColumnString (rownrs); }
 
 inline void TableExprNode::show (ostream& os) const
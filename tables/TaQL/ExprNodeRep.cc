@@ -31,11 +31,17 @@
 #include <casacore/tables/TaQL/ExprDerNodeArray.h>
 #include <casacore/tables/TaQL/ExprUnitNode.h>
 #include <casacore/tables/TaQL/ExprRange.h>
+#include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/BaseTable.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/OS/PrecTimer.h>
 #include <casacore/tables/TaQL/MArray.h>
 #include <casacore/tables/TaQL/MArrayLogical.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <float.h>                     // for DBL_MAX
 
 
 
@@ -51,7 +57,8 @@ TableExprNodeRep::TableExprNodeRep (NodeDataType dtype, ValueType vtype,
   optype_p   (optype),
   argtype_p  (NoArr),
   exprtype_p (Variable),
-  ndim_p     (0)
+  ndim_p     (0),
+  batchMutex_p (Mutex::Recursive)
 {
     if (table.isNull()) {
         exprtype_p = Constant;
@@ -70,7 +77,8 @@ TableExprNodeRep::TableExprNodeRep (NodeDataType dtype, ValueType vtype,
   argtype_p  (argtype),
   exprtype_p (exprtype),
   ndim_p     (ndim),
-  shape_p    (shape)
+  shape_p    (shape),
+  batchMutex_p (Mutex::Recursive)
 {}
 
 TableExprNodeRep::TableExprNodeRep (const TableExprNodeRep& that)
@@ -82,7 +90,8 @@ TableExprNodeRep::TableExprNodeRep (const TableExprNodeRep& that)
   exprtype_p (that.exprtype_p),
   ndim_p     (that.ndim_p),
   shape_p    (that.shape_p),
-  unit_p     (that.unit_p)
+  unit_p     (that.unit_p),
+  batchMutex_p (Mutex::Recursive)
 {}
 
 TableExprNodeRep::~TableExprNodeRep ()
@@ -99,10 +108,63 @@ void TableExprNodeRep::show (ostream& os, uInt indent) const
        << ndim_p << ' ' << shape_p << ' ' << table_p.baseTablePtr() << endl;
 }
 
+void TableExprNodeRep::getChildren (vector<TableExprNodeRep*>&) const
+{}
+
+String TableExprNodeRep::description() const
+{
+    return typeString(dtype_p) + ' ' + typeString(optype_p);
+}
+
+void TableExprNodeRep::setProfiling (Bool profile)
+{
+    if (profile) {
+        profile_p = new TableExprNodeProfile();
+    } else {
+        profile_p = 0;
+    }
+    vector<TableExprNodeRep*> children;
+    getChildren (children);
+    for (size_t i=0; i<children.size(); ++i) {
+        children[i]->setProfiling (profile);
+    }
+}
+
+void TableExprNodeRep::showProfile (ostream& os, uInt indent) const
+{
+    for (uInt i=0; i<indent; i++) {
+        os << ' ';
+    }
+    os << description();
+    if (! profile_p.null()) {
+        const TableExprNodeProfile& prof = *profile_p;
+        if (prof.nbatch() > 0) {
+            os << ": " << prof.nbatch() << " batches, "
+               << prof.nrow() << " rows";
+            if (dtype_p == NTBool) {
+                os << " (" << prof.ntrue() << " true, "
+                   << prof.nfalse() << " false)";
+            }
+            if (prof.nbytes() > 0) {
+                os << ", " << prof.nbytes() << " bytes read";
+            }
+            os << ", " << prof.time() << " sec";
+        } else if (prof.nbytes() > 0) {
+            os << ": " << prof.nbytes() << " bytes read row by row";
+        }
+    }
+    os << endl;
+    vector<TableExprNodeRep*> children;
+    getChildren (children);
+    for (size_t i=0; i<children.size(); ++i) {
+        children[i]->showProfile (os, indent+2);
+    }
+}
+
 void TableExprNodeRep::disableApplySelection()
 {}
 
-void TableExprNodeRep::applySelection (const Vector<uInt>&)
+void TableExprNodeRep::applySelection (const Vector<rownr_t>&)
 {}
 
 void TableExprNodeRep::getAggrNodes (vector<TableExprNodeRep*>&)
@@ -138,7 +200,7 @@ void TableExprNodeRep::adaptSetUnits (const Unit&)
 {}
 
 //# Determine the number of rows in the table used in the expression.
-uInt TableExprNodeRep::nrow() const
+rownr_t TableExprNodeRep::nrow() const
 {
     if (exprtype_p == Constant) {
         return 1;
@@ -205,6 +267,28 @@ void TableExprNodeRep::createRange (Block<TableExprRange>& blrange,
     }
 }
 
+Bool TableExprNodeRep::getValueRange (rownr_t, rownr_t&,
+                                      Double& minVal, Double& maxVal)
+{
+    if (isConstant()  &&  valueType() == VTScalar
+    &&  (dataType() == NTInt  ||  dataType() == NTDouble)) {
+        minVal = maxVal = getDouble (0);
+        // A large integer might not be represented exactly.
+        if (dataType() == NTInt) {
+            Int64 val = getInt (0);
+            const Int64 maxExact = Int64(1) << 53;
+            return (val <= maxExact  &&  val >= -maxExact);
+        }
+        return !isNaN(minVal);
+    }
+    return False;
+}
+
+Bool TableExprNodeRep::mayBeTrue (rownr_t, rownr_t&)
+{
+    return True;
+}
+
 const IPosition& TableExprNodeRep::shape (const TableExprId& id)
 {
     if (ndim_p == 0  ||  shape_p.size() != 0) {
@@ -257,6 +341,139 @@ MVTime TableExprNodeRep::getDate (const TableExprId&)
     TableExprNode::throwInvDT ("(getDate not implemented)");
     return MVTime(0.);
 }
+
+void TableExprNodeRep::getBoolBatch (rownr_t startRow, uInt nrow,
+                                     Bool* values, const Bool* mask)
+{
+    if (profile_p.null()) {
+        getBoolBatchV (startRow, nrow, values, mask);
+    } else {
+        PrecTimer timer;
+        timer.start();
+        getBoolBatchV (startRow, nrow, values, mask);
+        timer.stop();
+        uInt64 nr = 0;
+        uInt64 ntrue = 0;
+        for (uInt i=0; i<nrow; ++i) {
+            if (mask == 0  ||  mask[i]) {
+                nr++;
+                if (values[i]) ntrue++;
+            }
+        }
+        profile_p->addBatch (nr, timer.getReal());
+        profile_p->addResult (ntrue, nr - ntrue);
+    }
+}
+void TableExprNodeRep::getIntBatch (rownr_t startRow, uInt nrow,
+                                    Int64* values, const Bool* mask)
+{
+    if (profile_p.null()) {
+        getIntBatchV (startRow, nrow, values, mask);
+    } else {
+        PrecTimer timer;
+        timer.start();
+        getIntBatchV (startRow, nrow, values, mask);
+        timer.stop();
+        profile_p->addBatch (countMask (nrow, mask), timer.getReal());
+    }
+}
+void TableExprNodeRep::getDoubleBatch (rownr_t startRow, uInt nrow,
+                                       Double* values, const Bool* mask)
+{
+    if (profile_p.null()) {
+        getDoubleBatchV (startRow, nrow, values, mask);
+    } else {
+        PrecTimer timer;
+        timer.start();
+        getDoubleBatchV (startRow, nrow, values, mask);
+        timer.stop();
+        profile_p->addBatch (countMask (nrow, mask), timer.getReal());
+    }
+}
+uInt64 TableExprNodeRep::countMask (uInt nrow, const Bool* mask)
+{
+    if (mask == 0) {
+        return nrow;
+    }
+    uInt64 nr = 0;
+    for (uInt i=0; i<nrow; ++i) {
+        if (mask[i]) nr++;
+    }
+    return nr;
+}
+
+void TableExprNodeRep::addTableMutexes (const TableExprNodeRep& node,
+                                        std::vector<Mutex*>& mutexes)
+{
+    if (! node.table().isNull()) {
+        mutexes.push_back (&(node.table().baseTablePtr()->root()->
+                             exprMutex()));
+    }
+    vector<TableExprNodeRep*> children;
+    node.getChildren (children);
+    for (size_t i=0; i<children.size(); ++i) {
+        addTableMutexes (*children[i], mutexes);
+    }
+}
+
+TableExprNodeRep::BatchLock::BatchLock (const TableExprNodeRep& node)
+{
+    // Lock the table mutexes in order of address to avoid deadlocks.
+    addTableMutexes (node, itsMutexes);
+    std::sort (itsMutexes.begin(), itsMutexes.end());
+    itsMutexes.erase (std::unique (itsMutexes.begin(), itsMutexes.end()),
+                      itsMutexes.end());
+    itsMutexes.push_back (&(node.batchMutex_p));
+    for (size_t i=0; i<itsMutexes.size(); ++i) {
+        itsMutexes[i]->lock();
+    }
+}
+
+TableExprNodeRep::BatchLock::~BatchLock()
+{
+    for (size_t i=itsMutexes.size(); i>0; --i) {
+        itsMutexes[i-1]->unlock();
+    }
+}
+
+void TableExprNodeRep::getBoolBatchV (rownr_t startRow, uInt nrow,
+                                      Bool* values, const Bool* mask)
+{
+    // Serialize, because the nodes might not be thread-safe if batches
+    // are evaluated in parallel.
+    BatchLock lock(*this);
+    TableExprId id;
+    for (uInt i=0; i<nrow; ++i) {
+        if (mask == 0  ||  mask[i]) {
+            id.setRownr (startRow + i);
+            values[i] = getBool (id);
+        }
+    }
+}
+void TableExprNodeRep::getIntBatchV (rownr_t startRow, uInt nrow,
+                                     Int64* values, const Bool* mask)
+{
+    BatchLock lock(*this);
+    TableExprId id;
+    for (uInt i=0; i<nrow; ++i) {
+        if (mask == 0  ||  mask[i]) {
+            id.setRownr (startRow + i);
+            values[i] = getInt (id);
+        }
+    }
+}
+void TableExprNodeRep::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                        Double* values, const Bool* mask)
+{
+    BatchLock lock(*this);
+    TableExprId id;
+    for (uInt i=0; i<nrow; ++i) {
+        if (mask == 0  ||  mask[i]) {
+            id.setRownr (startRow + i);
+            values[i] = getDouble (id);
+        }
+    }
+}
 MArray<Bool> TableExprNodeRep::getArrayBool (const TableExprId&)
 {
     TableExprNode::throwInvDT ("(getArrayBool not implemented)");
@@ -405,10 +622,10 @@ MArray<Bool> TableExprNodeRep::hasArrayDate (const TableExprId& id,
 
 
 Array<Bool>     TableExprNodeRep::getColumnBool
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Bool> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -417,28 +634,28 @@ Array<Bool>     TableExprNodeRep::getColumnBool
     return vec;
 }
 Array<uChar>    TableExprNodeRep::getColumnuChar
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnuChar not implemented)");
     return Array<uChar>();
 }
 Array<Short>    TableExprNodeRep::getColumnShort
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnShort not implemented)");
     return Array<Short>();
 }
 Array<uShort>   TableExprNodeRep::getColumnuShort
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnuShort not implemented)");
     return Array<uShort>();
 }
 Array<Int>      TableExprNodeRep::getColumnInt
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Int> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -447,16 +664,16 @@ Array<Int>      TableExprNodeRep::getColumnInt
     return vec;
 }
 Array<uInt>     TableExprNodeRep::getColumnuInt
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnuInt not implemented)");
     return Array<uInt>();
 }
 Array<Int64>    TableExprNodeRep::getColumnInt64
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Int64> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -465,16 +682,16 @@ Array<Int64>    TableExprNodeRep::getColumnInt64
     return vec;
 }
 Array<Float>    TableExprNodeRep::getColumnFloat
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnFloat not implemented)");
     return Array<Float>();
 }
 Array<Double>   TableExprNodeRep::getColumnDouble
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Double> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -483,16 +700,16 @@ Array<Double>   TableExprNodeRep::getColumnDouble
     return vec;
 }
 Array<Complex>  TableExprNodeRep::getColumnComplex
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnComplex not implemented)");
     return Array<Complex>();
 }
 Array<DComplex> TableExprNodeRep::getColumnDComplex
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<DComplex> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -501,10 +718,10 @@ Array<DComplex> TableExprNodeRep::getColumnDComplex
     return vec;
 }
 Array<String>   TableExprNodeRep::getColumnString
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<String> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -570,6 +787,7 @@ TENShPtr TableExprNodeRep::replaceConstNode (const TENShPtr& node)
   // If the expression is not constant, try to convert the type
   // of a constant child to the other child's type.
   if (! node->isConstant()) {
+    node->convertConstChild();
     return node;
   }
   // Evaluate the constant subexpression and replace the node.
@@ -669,6 +887,16 @@ void TableExprNodeBinary::show (ostream& os, uInt indent) const
     }
 }
 
+void TableExprNodeBinary::getChildren (vector<TableExprNodeRep*>& children) const
+{
+  if (lnode_p) {
+    children.push_back (lnode_p.get());
+  }
+  if (rnode_p) {
+    children.push_back (rnode_p.get());
+  }
+}
+
 void TableExprNodeBinary::getAggrNodes (vector<TableExprNodeRep*>& aggr)
 {
   if (lnode_p) {
@@ -981,6 +1209,146 @@ void TableExprNodeBinary::adaptDataTypes()
     *constNode = newNode;
 }
 
+Bool TableExprNodeBinary::getValueRanges (rownr_t rownr, rownr_t& endRow,
+                                          Double& lmin, Double& lmax,
+                                          Double& rmin, Double& rmax)
+{
+    if (!rnode_p  ||  lnode_p->valueType() != VTScalar
+    ||  rnode_p->valueType() != VTScalar) {
+        return False;
+    }
+    Bool lfnd = lnode_p->getValueRange (rownr, endRow, lmin, lmax);
+    Bool rfnd = rnode_p->getValueRange (rownr, endRow, rmin, rmax);
+    return lfnd && rfnd;
+}
+
+// Get the constant real value to be used in a range.
+// A large integer might not be represented exactly, so cannot be used.
+static Bool getRangeValue (const TENShPtr& node, Double& value)
+{
+    if (!node  ||  !node->isConstant()
+    ||  node->valueType() != TableExprNodeRep::VTScalar) {
+        return False;
+    }
+    rownr_t endRow = 0;
+    Double maxVal;
+    return node->getValueRange (0, endRow, value, maxVal);
+}
+
+// Get the scalar real column to be used in a range.
+static TableExprNodeColumn* getRangeColumn (const TENShPtr& node)
+{
+    if (node  &&  node->operType() == TableExprNodeRep::OtColumn
+    &&  node->valueType() == TableExprNodeRep::VTScalar
+    &&  (node->dataType() == TableExprNodeRep::NTInt  ||
+         node->dataType() == TableExprNodeRep::NTDouble)) {
+        return dynamic_cast<TableExprNodeColumn*>(node.get());
+    }
+    return 0;
+}
+
+void TableExprNodeBinary::createCompareRange (Block<TableExprRange>& blrange,
+                                              Bool isEqual)
+{
+    Double val;
+    TableExprNodeColumn* col = getRangeColumn (lnode_p);
+    if (col  &&  getRangeValue (rnode_p, val)) {
+        createRange (blrange, col, val, (isEqual ? val : DBL_MAX));
+    } else {
+        col = getRangeColumn (rnode_p);
+        if (col  &&  getRangeValue (lnode_p, val)) {
+            createRange (blrange, col, (isEqual ? val : -DBL_MAX), val);
+        } else {
+            createRange (blrange);
+        }
+    }
+}
+
+void TableExprNodeBinary::createINRange (Block<TableExprRange>& blrange)
+{
+    createRange (blrange);
+    TableExprNodeColumn* col = getRangeColumn (lnode_p);
+    if (col == 0  ||  !rnode_p->isConstant()) {
+        return;
+    }
+    std::vector<Double> stvals;
+    std::vector<Double> endvals;
+    const TableExprNodeSet* set =
+      dynamic_cast<const TableExprNodeSet*>(rnode_p.get());
+    if (set) {
+        // Each set element gives an interval; an open side is unbounded.
+        // The increment of a discrete interval is ignored, so the range is
+        // a superset.
+        for (uInt i=0; i<set->size(); ++i) {
+            const TableExprNodeSetElem& elem = (*set)[i];
+            Double st = -DBL_MAX;
+            Double end = DBL_MAX;
+            if (elem.start()) {
+                if (! getRangeValue (elem.start(), st)) {
+                    return;
+                }
+            } else if (elem.isDiscrete()) {
+                return;
+            }
+            if (elem.isSingle()) {
+                end = st;
+            } else if (elem.end()) {
+                if (! getRangeValue (elem.end(), end)) {
+                    return;
+                }
+            }
+            stvals.push_back (st);
+            endvals.push_back (end);
+        }
+    } else if (rnode_p->valueType() == VTArray) {
+        // Masked values are also used, which is harmless.
+        if (rnode_p->dataType() == NTInt) {
+            const Int64 maxExact = Int64(1) << 53;
+            Array<Int64> arr (rnode_p->getArrayInt(0).array());
+            for (Array<Int64>::const_iterator iter=arr.begin();
+                 iter!=arr.end(); ++iter) {
+                if (*iter > maxExact  ||  *iter < -maxExact) {
+                    return;
+                }
+                stvals.push_back (Double(*iter));
+            }
+        } else if (rnode_p->dataType() == NTDouble) {
+            Array<Double> arr (rnode_p->getArrayDouble(0).array());
+            stvals.assign (arr.begin(), arr.end());
+        } else {
+            return;
+        }
+        endvals = stvals;
+    } else {
+        return;
+    }
+    blrange.resize (1, True);
+    blrange[0] = TableExprRange (col->getColumn(), Vector<Double>(stvals),
+                                 Vector<Double>(endvals));
+}
+
+void TableExprNodeBinary::getIntBatches (rownr_t startRow, uInt nrow,
+                                         std::vector<Int64>& lval,
+                                         std::vector<Int64>& rval,
+                                         const Bool* mask)
+{
+    lval.assign (nrow, 0);
+    rval.assign (nrow, 0);
+    lnode_p->getIntBatch (startRow, nrow, lval.data(), mask);
+    rnode_p->getIntBatch (startRow, nrow, rval.data(), mask);
+}
+
+void TableExprNodeBinary::getDoubleBatches (rownr_t startRow, uInt nrow,
+                                            std::vector<Double>& lval,
+                                            std::vector<Double>& rval,
+                                            const Bool* mask)
+{
+    lval.assign (nrow, 0.);
+    rval.assign (nrow, 0.);
+    lnode_p->getDoubleBatch (startRow, nrow, lval.data(), mask);
+    rnode_p->getDoubleBatch (startRow, nrow, rval.data(), mask);
+}
+
 
 
 
@@ -1011,6 +1379,15 @@ void TableExprNodeMulti::show (ostream& os, uInt indent) const
     }
 }
 
+void TableExprNodeMulti::getChildren (vector<TableExprNodeRep*>& children) const
+{
+    for (uInt j=0; j<operands_p.size(); j++) {
+        if (operands_p[j] != 0) {
+            children.push_back (operands_p[j].get());
+        }
+    }
+}
+
 void TableExprNodeMulti::getAggrNodes (vector<TableExprNodeRep*>& aggr)
 {
     for (uInt j=0; j<operands_p.size(); j++) {
@@ -1187,4 +1564,63 @@ String TableExprNodeRep::typeString (ValueType type)
   throw AipsError("TableExprNodeRep::typeString ValueType");
 }
 
+String TableExprNodeRep::typeString (OperType type)
+{
+  switch (type) {
+  case OtPlus:
+    return "+";
+  case OtMinus:
+    return "-";
+  case OtTimes:
+    return "*";
+  case OtDivide:
+    return "/";
+  case OtModulo:
+    return "%";
+  case OtBitAnd:
+    return "&";
+  case OtBitOr:
+    return "|";
+  case OtBitXor:
+    return "^";
+  case OtBitNegate:
+    return "~";
+  case OtEQ:
+    return "==";
+  case OtGE:
+    return ">=";
+  case OtGT:
+    return ">";
+  case OtNE:
+    return "!=";
+  case OtIN:
+    return "IN";
+  case OtAND:
+    return "&&";
+  case OtOR:
+    return "||";
+  case OtNOT:
+    return "!";
+  case OtMIN:
+    return "unary -";
+  case OtColumn:
+    return "column";
+  case OtField:
+    return "field";
+  case OtLiteral:
+    return "literal";
+  case OtFunc:
+    return "function";
+  case OtSlice:
+    return "slice";
+  case OtUndef:
+    return "undefined";
+  case OtRownr:
+    return "rownr";
+  case OtRandom:
+    return "random";
+  }
+  throw AipsError("TableExprNodeRep::typeString OperType");
+}
+
 } //# NAMESPACE CASACORE - END
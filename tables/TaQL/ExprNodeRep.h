@@ -41,6 +41,7 @@
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Utilities/Regex.h>
 #include <casacore/casa/Utilities/StringDistance.h>
+#include <casacore/casa/OS/Mutex.h>
 #include <casacore/casa/iosfwd.h>
 #include <vector>
 
@@ -108,6 +109,71 @@ private:
 
 
 
+// <summary>
+// Class to hold the profile statistics of a node in an expression tree.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tExprNodeBatch">
+// </reviewed>
+
+// <synopsis>
+// If profiling is switched on for an expression (e.g. by TaQL's PROFILE
+// command), each node in the expression tree gets a TableExprNodeProfile
+// object collecting the statistics of the batch evaluations of that node.
+// It counts the number of batches and rows evaluated, the time spent
+// (including the time spent in the child nodes), the number of True and
+// False results of a Bool node, and the number of bytes read by a column node.
+// </synopsis>
+
+class TableExprNodeProfile
+{
+public:
+  TableExprNodeProfile()
+    : itsNBatch(0), itsNRow(0), itsNTrue(0), itsNFalse(0), itsNBytes(0),
+      itsTime(0)
+  {}
+
+  // Add the statistics of a batch evaluation of <src>nrow</src> rows.
+  void addBatch (uInt64 nrow, Double time)
+    { itsNBatch++; itsNRow += nrow; itsTime += time; }
+
+  // Add the number of True and False results.
+  void addResult (uInt64 ntrue, uInt64 nfalse)
+    { itsNTrue += ntrue; itsNFalse += nfalse; }
+
+  // Add the number of bytes read from a column.
+  void addBytes (uInt64 nbytes)
+    { itsNBytes += nbytes; }
+
+  // Get the statistics.
+  // <group>
+  uInt64 nbatch() const
+    { return itsNBatch; }
+  uInt64 nrow() const
+    { return itsNRow; }
+  uInt64 ntrue() const
+    { return itsNTrue; }
+  uInt64 nfalse() const
+    { return itsNFalse; }
+  uInt64 nbytes() const
+    { return itsNBytes; }
+  Double time() const
+    { return itsTime; }
+  // </group>
+
+private:
+  uInt64 itsNBatch;
+  uInt64 itsNRow;
+  uInt64 itsNTrue;
+  uInt64 itsNFalse;
+  uInt64 itsNBytes;
+  Double itsTime;
+};
+
+
+
 // <summary>
 // Abstract base class for a node in a table column expression tree
 // </summary>
@@ -228,7 +294,7 @@ public:
 
     // Re-create the column object for a selection of rows.
     // The default implementation does nothing.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     // Get the unit conversion factor.
     // Default 1 is returned.
@@ -268,6 +334,40 @@ public:
     virtual MVTime getDate       (const TableExprId& id);
     // </group>
 
+    // Get the scalar values for this node in a batch of <src>nrow</src>
+    // rows starting at <src>startRow</src> (batch evaluation).
+    // Only the rows for which <src>mask</src> is True need to be evaluated
+    // (a null pointer means all rows); the values of the other rows are
+    // undefined. In this way a logical operator like && does not
+    // evaluate its right operand for rows that are already decided.
+    // <br>These functions call the virtual functions below and collect
+    // the profile statistics if profiling is switched on.
+    // <group>
+    void getBoolBatch   (rownr_t startRow, uInt nrow,
+                         Bool* values, const Bool* mask);
+    void getIntBatch    (rownr_t startRow, uInt nrow,
+                         Int64* values, const Bool* mask);
+    void getDoubleBatch (rownr_t startRow, uInt nrow,
+                         Double* values, const Bool* mask);
+    // </group>
+
+    // Do the actual batch evaluation.
+    // <br>The default implementation evaluates the rows one by one using
+    // the scalar get functions above. Because the nodes are not thread-safe,
+    // it locks a mutex while doing so. Other implementations must be
+    // thread-safe (i.e. not change the node) or lock the mutex, because
+    // multiple threads can evaluate batches. It is overridden for columns,
+    // constants, comparisons, logical and arithmetic operators, and some
+    // mathematical functions, which evaluate a whole batch at a time.
+    // <group>
+    virtual void getBoolBatchV   (rownr_t startRow, uInt nrow,
+                                  Bool* values, const Bool* mask);
+    virtual void getIntBatchV    (rownr_t startRow, uInt nrow,
+                                  Int64* values, const Bool* mask);
+    virtual void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                  Double* values, const Bool* mask);
+    // </group>
+
     // Get an array value for this node in the given row.
     // The appropriate functions are implemented in the derived classes and
     // will usually invoke the get in their children and apply the
@@ -346,7 +446,7 @@ public:
     // Get the number of rows in the table associated with this expression.
     // One is returned if the expression is a constant.
     // Zero is returned if no table is associated with it.
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Get the data type of the column.
     // It returns True when it could set the data type (which it can
@@ -358,18 +458,18 @@ public:
     // The data of function called should match the data type as
     // returned by function <src>getColumnDataType</src>.
     // <group>
-    virtual Array<Bool>     getColumnBool (const Vector<uInt>& rownrs);
-    virtual Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs);
-    virtual Array<Short>    getColumnShort (const Vector<uInt>& rownrs);
-    virtual Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs);
-    virtual Array<Int>      getColumnInt (const Vector<uInt>& rownrs);
-    virtual Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs);
-    virtual Array<Int64>    getColumnInt64 (const Vector<uInt>& rownrs);
-    virtual Array<Float>    getColumnFloat (const Vector<uInt>& rownrs);
-    virtual Array<Double>   getColumnDouble (const Vector<uInt>& rownrs);
-    virtual Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs);
-    virtual Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs);
-    virtual Array<String>   getColumnString (const Vector<uInt>& rownrs);
+    virtual Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs);
+    virtual Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs);
+    virtual Array<Short>    getColumnShort (const Vector<rownr_t>& rownrs);
+    virtual Array<uShort>   getColumnuShort (const Vector<rownr_t>& rownrs);
+    virtual Array<Int>      getColumnInt (const Vector<rownr_t>& rownrs);
+    virtual Array<uInt>     getColumnuInt (const Vector<rownr_t>& rownrs);
+    virtual Array<Int64>    getColumnInt64 (const Vector<rownr_t>& rownrs);
+    virtual Array<Float>    getColumnFloat (const Vector<rownr_t>& rownrs);
+    virtual Array<Double>   getColumnDouble (const Vector<rownr_t>& rownrs);
+    virtual Array<Complex>  getColumnComplex (const Vector<rownr_t>& rownrs);
+    virtual Array<DComplex> getColumnDComplex (const Vector<rownr_t>& rownrs);
+    virtual Array<String>   getColumnString (const Vector<rownr_t>& rownrs);
     // </group>
 
     // Convert the tree to a number of range vectors which at least
@@ -383,6 +483,25 @@ public:
     // using && or ||.
     virtual void ranges (Block<TableExprRange>&);
 
+    // Get the range of the values of a real scalar expression for the
+    // rows from rownr till endRow. On return endRow can be reduced to
+    // the last row the range applies to.
+    // False is returned if the range is unknown.
+    // The default implementation handles a constant Int or Double;
+    // TableExprNodeColumn gets the range from the storage manager
+    // (e.g., the zone maps in the StandardStMan).
+    virtual Bool getValueRange (rownr_t rownr, rownr_t& endRow,
+                                Double& minVal, Double& maxVal);
+
+    // Tell if a Bool expression can be True for a row in the range
+    // from rownr till endRow. On return endRow can be reduced to the last
+    // row the answer applies to. It uses getValueRange, so it can be used
+    // to skip rows when doing a selection.
+    // The default implementation returns True, but it is implemented for
+    // comparisons of real values, IN (and BETWEEN) with a constant right
+    // operand, and their combinations using && or ||.
+    virtual Bool mayBeTrue (rownr_t rownr, rownr_t& endRow);
+
     // Get the data type of the derived TableExprNode object.
     // This is the data type of the resulting value. E.g. a compare
     // of 2 numeric values results in a Bool, thus the data type
@@ -439,6 +558,28 @@ public:
     // Show the expression tree.
     virtual void show (ostream&, uInt indent) const;
 
+    // Get the child nodes of this node.
+    // The default implementation does nothing.
+    virtual void getChildren (std::vector<TableExprNodeRep*>& children) const;
+
+    // Get a short description of the node (used in a profile).
+    // The default implementation gives the data and operator type.
+    virtual String description() const;
+
+    // Switch profiling of this node and its children on or off.
+    // Switching it on clears the statistics collected so far.
+    // Note that the statistics are collected for the batch evaluation
+    // only and that they are not thread-safe.
+    void setProfiling (Bool profile);
+
+    // Get the profile statistics (a null pointer if not profiling).
+    const TableExprNodeProfile* profile() const
+      { return profile_p.get(); }
+
+    // Show the expression tree with the profile statistics of each node.
+    // A child node evaluated row by row by its parent shows no statistics.
+    void showProfile (ostream&, uInt indent) const;
+
     // Get table. This gets the Table object to which a
     // TableExprNode belongs. A TableExprNode belongs to the Table to
     // which the first column used in an expression belongs.
@@ -448,6 +589,7 @@ public:
     // </group>
 
     // Replace a node with a constant expression by node with its value.
+    // If not constant, it calls the virtual function convertConstChild.
     static TENShPtr replaceConstNode (const TENShPtr& node);
 
     // Let a set node convert itself to the given unit.
@@ -467,6 +609,9 @@ public:
     // Convert a ValueType to a string.
     static String typeString (ValueType);
 
+    // Convert an OperType to a string.
+    static String typeString (OperType);
+
 protected:
     Table             table_p;       //# Table from which node is "derived"
     NodeDataType      dtype_p;       //# data type of the operation
@@ -479,6 +624,36 @@ protected:
     IPosition         shape_p;       //# Fixed shape of node values
     Unit              unit_p;        //# Unit of the values
     Record            attributes_p;  //# Possible attributes (for UDFs)
+    CountedPtr<TableExprNodeProfile> profile_p; //# Statistics if profiling
+
+    // Count the number of rows to evaluate in a batch.
+    static uInt64 countMask (uInt nrow, const Bool* mask);
+
+    // Lock serializing the row by row evaluation and the table access
+    // in the batch functions of a node, because batches can be evaluated
+    // by multiple threads (see BaseTable::select).
+    // It first locks the mutexes of the (root) tables used by the node and
+    // its children in a fixed order, because columns in the same table
+    // cannot be read in parallel (they share the data managers), but
+    // columns in different tables can. Thereafter it locks the mutex of
+    // the node itself, because a node can keep state (e.g. caches).
+    class BatchLock
+    {
+    public:
+        explicit BatchLock (const TableExprNodeRep& node);
+        ~BatchLock();
+    private:
+        BatchLock (const BatchLock&);
+        BatchLock& operator= (const BatchLock&);
+        std::vector<Mutex*> itsMutexes;
+    };
+
+    //# Recursive mutex used by BatchLock.
+    mutable Mutex     batchMutex_p;
+
+    // Add the mutexes of the tables used by the node and its children.
+    static void addTableMutexes (const TableExprNodeRep& node,
+                                 std::vector<Mutex*>& mutexes);
 
     // Get the shape for the given row.
     virtual const IPosition& getShape (const TableExprId& id);
@@ -486,6 +661,7 @@ protected:
     // If one of the children is a constant, convert its data type
     // to that of the other operand (if appropriate).
     // This avoids that conversions are done for each get.
+    // The IN nodes use it to turn a constant array into a set.
     // The default implementation does nothing.
     virtual void convertConstChild();
 
@@ -568,6 +744,9 @@ public:
     // Show the expression tree.
     virtual void show (ostream&, uInt indent) const;
 
+    // Get the child nodes.
+    virtual void getChildren (std::vector<TableExprNodeRep*>& children) const;
+
     // Get the nodes representing an aggregate function.
     virtual void getAggrNodes (std::vector<TableExprNodeRep*>& aggr);
   
@@ -599,6 +778,40 @@ public:
     // done for each get.
     void adaptDataTypes();
 
+    // Get the value ranges of both children (see getValueRange).
+    // endRow is reduced to the minimum of their end rows.
+    // False is returned if one of the ranges is unknown.
+    Bool getValueRanges (rownr_t rownr, rownr_t& endRow,
+                         Double& lmin, Double& lmax,
+                         Double& rmin, Double& rmax);
+
+    // Create the range (see ranges) for a comparison of a scalar column
+    // with a constant (in either order). If <src>isEqual</src>, the range
+    // is the constant value itself, otherwise it extends from the constant
+    // to the side of the column. Because the range is closed, the range for
+    // > is the same as for >=.
+    // An empty block is returned if the operands are not a column and
+    // a constant.
+    void createCompareRange (Block<TableExprRange>&, Bool isEqual);
+
+    // Create the ranges (see ranges) for a scalar column IN a constant
+    // set or array. An empty block is returned if the operands are not
+    // a column and a constant set or array of real values.
+    void createINRange (Block<TableExprRange>&);
+
+    // Get the values of both children for a batch of rows
+    // (see getIntBatch and getDoubleBatch).
+    // The vectors are resized as needed; values of rows not in the mask
+    // are zero.
+    // <group>
+    void getIntBatches    (rownr_t startRow, uInt nrow,
+                           std::vector<Int64>& lval,
+                           std::vector<Int64>& rval, const Bool* mask);
+    void getDoubleBatches (rownr_t startRow, uInt nrow,
+                           std::vector<Double>& lval,
+                           std::vector<Double>& rval, const Bool* mask);
+    // </group>
+
     // Get the child nodes.
     // <group>
     const TENShPtr& getLeftChild() const
@@ -670,6 +883,9 @@ public:
     // Show the expression tree.
     virtual void show (ostream&, uInt indent) const;
 
+    // Get the child nodes.
+    virtual void getChildren (std::vector<TableExprNodeRep*>& children) const;
+
     // Get the nodes representing an aggregate function.
     virtual void getAggrNodes (std::vector<TableExprNodeRep*>& aggr);
 
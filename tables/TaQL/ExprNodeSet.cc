@@ -242,6 +242,19 @@ void TableExprNodeSetElem::show (ostream& os, uInt indent) const
     }
 }
 
+void TableExprNodeSetElem::getChildren (vector<TableExprNodeRep*>& children) const
+{
+    if (itsStart) {
+        children.push_back (itsStart.get());
+    }
+    if (itsEnd) {
+        children.push_back (itsEnd.get());
+    }
+    if (itsIncr) {
+        children.push_back (itsIncr.get());
+    }
+}
+
 void TableExprNodeSetElem::getAggrNodes (vector<TableExprNodeRep*>& aggr)
 {
     if (itsStart) {
@@ -744,7 +757,7 @@ TableExprNodeSet::TableExprNodeSet (const Slicer& indices)
     }
 }
 
-TableExprNodeSet::TableExprNodeSet (const Vector<uInt>& rownrs,
+TableExprNodeSet::TableExprNodeSet (const Vector<rownr_t>& rownrs,
                                     const TableExprNodeSet& set)
 : TableExprNodeRep (set.dataType(), VTSet, OtUndef, Table()),
   itsElems         (rownrs.size() * set.size()),
@@ -1152,6 +1165,13 @@ void TableExprNodeSet::show (ostream& os, uInt indent) const
     }
 }
 
+void TableExprNodeSet::getChildren (vector<TableExprNodeRep*>& children) const
+{
+    for (uInt j=0; j<itsElems.size(); j++) {
+        children.push_back (itsElems[j].get());
+    }
+}
+
 void TableExprNodeSet::getAggrNodes (vector<TableExprNodeRep*>& aggr)
 {
     for (uInt j=0; j<itsElems.size(); j++) {
@@ -126,6 +126,9 @@ public:
     // Show the node.
     void show (ostream& os, uInt indent) const;
 
+    // Get the child nodes.
+    virtual void getChildren (std::vector<TableExprNodeRep*>& children) const;
+
     // Get the nodes representing an aggregate function.
     virtual void getAggrNodes (std::vector<TableExprNodeRep*>& aggr);
   
@@ -330,7 +333,7 @@ public:
     // of rows.
     // Element i is constructed by evaluating the input element
     // for row rownr[i].
-    TableExprNodeSet (const Vector<uInt>& rownrs, const TableExprNodeSet&);
+    TableExprNodeSet (const Vector<rownr_t>& rownrs, const TableExprNodeSet&);
 
     TableExprNodeSet(const TableExprNodeSet&);
 
@@ -345,6 +348,9 @@ public:
     // Show the node.
     void show (ostream& os, uInt indent) const;
 
+    // Get the child nodes.
+    virtual void getChildren (std::vector<TableExprNodeRep*>& children) const;
+
     // Get the nodes representing an aggregate function.
     virtual void getAggrNodes (std::vector<TableExprNodeRep*>& aggr);
   
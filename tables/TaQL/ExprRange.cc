@@ -28,6 +28,8 @@
 #include <casacore/tables/TaQL/ExprRange.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/casa/Arrays/Slice.h>
+#include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Exceptions/Error.h>
 
@@ -48,6 +50,45 @@ TableExprRange::TableExprRange(const TableColumn& col, double stval,
     eval_p(0) = endval;
 }
 
+TableExprRange::TableExprRange (const TableColumn& col,
+                                const Vector<double>& stvals,
+                                const Vector<double>& endvals)
+: tabColPtr_p(0)
+{
+    AlwaysAssert (stvals.nelements() == endvals.nelements(), AipsError);
+    tabColPtr_p = new TableColumn(col);
+    uInt nr = stvals.nelements();
+    if (nr == 0) {
+        return;
+    }
+    //# Sort the intervals on start value and combine overlapping ones.
+    Vector<uInt> inx;
+    GenSortIndirect<double,uInt>::sort (inx, stvals);
+    Vector<double> stmp(nr);
+    Vector<double> etmp(nr);
+    uInt j=0;
+    stmp(0) = stvals(inx(0));
+    etmp(0) = endvals(inx(0));
+    for (uInt i=1; i<nr; i++) {
+        double st = stvals(inx(i));
+        double end = endvals(inx(i));
+        if (st <= etmp(j)) {                        // overlap
+            if (end > etmp(j)) {
+                etmp(j) = end;                      // higher end-value
+            }
+        }else{
+            j++;                                    // no overlap,
+            stmp(j) = st;                           // so insert interval
+            etmp(j) = end;
+        }
+    }
+    nr = j+1;
+    sval_p.resize(nr);
+    eval_p.resize(nr);
+    sval_p = stmp(Slice(0,nr));
+    eval_p = etmp(Slice(0,nr));
+}
+
 TableExprRange::TableExprRange (const TableExprRange& that)
 : sval_p     (that.sval_p),
   eval_p     (that.eval_p),
@@ -93,6 +93,12 @@ public:
     // Construct from a column and a single constant range.
     TableExprRange (const TableColumn&, double stval, double endval);
 
+    // Construct from a column and multiple constant ranges, for instance
+    // for the values in an IN set. The ranges do not need to be in order
+    // and can overlap.
+    TableExprRange (const TableColumn&, const Vector<double>& stvals,
+                    const Vector<double>& endvals);
+
     // Copy constructor.
     TableExprRange (const TableExprRange&);
 
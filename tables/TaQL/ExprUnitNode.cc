@@ -140,6 +140,15 @@ Double TableExprNodeUnit::getDouble (const TableExprId& id)
 DComplex TableExprNodeUnit::getDComplex (const TableExprId& id)
   { return factor_p * lnode_p->getDComplex(id); }
 
+void TableExprNodeUnit::getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                         Double* values, const Bool* mask)
+{
+  lnode_p->getDoubleBatch (startRow, nrow, values, mask);
+  for (uInt i=0; i<nrow; ++i) {
+    values[i] *= factor_p;
+  }
+}
+
 
 
 
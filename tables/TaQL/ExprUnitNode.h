@@ -91,6 +91,8 @@ public:
 
   virtual Double   getDouble   (const TableExprId& id);
   virtual DComplex getDComplex (const TableExprId& id);
+  virtual void getDoubleBatchV (rownr_t startRow, uInt nrow,
+                                Double* values, const Bool* mask);
 private:
   Double factor_p;
 };
@@ -31,6 +31,7 @@
 #include <casacore/tables/TaQL/TableGram.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -44,6 +45,12 @@ Mutex TaQLNode::theirMutex;
 
 
 TaQLNode TaQLNode::parse (const String& command)
+{
+  uInt nparams;
+  return parse (command, nparams);
+}
+
+TaQLNode TaQLNode::parse (const String& command, uInt& nparams)
 {
   // Add a newline if not present.
   String str(command);
@@ -65,6 +72,16 @@ TaQLNode TaQLNode::parse (const String& command)
     throw TableParseError (str + "  " + x.what());
   }
   TaQLNode node = theirNode;
+  // All nodes created by the parser are part of the tree, so the
+  // parameters can be found in the list.
+  nparams = 0;
+  for (uInt i=0; i<theirNodesCreated.size(); ++i) {
+    const TaQLNode* pnode = theirNodesCreated[i];
+    if (pnode->isValid()  &&  pnode->nodeType() == TaQLNode_Param) {
+      Int nr = ((const TaQLParamNodeRep*)(pnode->getRep()))->itsNr;
+      nparams = std::max (nparams, uInt(nr));
+    }
+  }
   clearNodesCreated();
   return node;
 }
@@ -182,6 +199,8 @@ TaQLNode TaQLNode::restoreNode (AipsIO& aio)
     return TaQLConcTabNodeRep::restore (aio);
   case TaQLNode_Show:
     return TaQLShowNodeRep::restore (aio);
+  case TaQLNode_Param:
+    return TaQLParamNodeRep::restore (aio);
   default:
     throw AipsError ("TaQLNode::restoreNode - unknown node type");
   }
@@ -112,7 +112,12 @@ public:
 
   // Parse a TaQL command and return the result.
   // An exception is thrown in case of parse errors.
+  // The second version also returns the highest parameter number ($n)
+  // used in the expressions (0 if no parameters are used).
+  // <group>
   static TaQLNode parse (const String& command);
+  static TaQLNode parse (const String& command, uInt& nparams);
+  // </group>
 
   // Does the envelope contain a letter?
   Bool isValid() const
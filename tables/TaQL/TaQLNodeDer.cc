@@ -705,9 +705,10 @@ TaQLIndexNodeRep* TaQLIndexNodeRep::restore (AipsIO& aio)
   return new TaQLIndexNodeRep (start, end, incr);
 }
 
-TaQLJoinNodeRep::TaQLJoinNodeRep (const TaQLMultiNode& tables,
+TaQLJoinNodeRep::TaQLJoinNodeRep (Type type, const TaQLMultiNode& tables,
                                   const TaQLNode& condition)
   : TaQLNodeRep (TaQLNode_Join),
+    itsType      (type),
     itsTables    (tables),
     itsCondition (condition)
 {}
@@ -719,24 +720,56 @@ TaQLNodeResult TaQLJoinNodeRep::visit (TaQLNodeVisitor& visitor) const
 }
 void TaQLJoinNodeRep::show (std::ostream& os) const
 {
+  if (itsType == Left) {
+    os << " LEFT";
+  }
   os << " JOIN ";
   if (itsTables.isValid()) {
     itsTables.show (os);
     os << ' ';
   }
-  os << "ON CONDITION ";
+  os << "ON ";
   itsCondition.show (os);
 }
 void TaQLJoinNodeRep::save (AipsIO& aio) const
 {
+  aio << char(itsType);
   itsTables.saveNode (aio);
   itsCondition.saveNode (aio);
 }
 TaQLJoinNodeRep* TaQLJoinNodeRep::restore (AipsIO& aio)
 {
+  char ctype;
+  aio >> ctype;
+  TaQLJoinNodeRep::Type type = (TaQLJoinNodeRep::Type)ctype;
   TaQLMultiNode tables = TaQLNode::restoreMultiNode (aio);
   TaQLNode condition = TaQLNode::restoreNode (aio);
-  return new TaQLJoinNodeRep (tables, condition);
+  return new TaQLJoinNodeRep (type, tables, condition);
+}
+
+TaQLParamNodeRep::TaQLParamNodeRep (Int nr)
+: TaQLNodeRep (TaQLNode_Param),
+  itsNr       (nr)
+{}
+TaQLParamNodeRep::~TaQLParamNodeRep()
+{}
+TaQLNodeResult TaQLParamNodeRep::visit (TaQLNodeVisitor& visitor) const
+{
+  return visitor.visitParamNode (*this);
+}
+void TaQLParamNodeRep::show (std::ostream& os) const
+{
+  os << '$' << itsNr;
+}
+void TaQLParamNodeRep::save (AipsIO& aio) const
+{
+  aio << itsNr;
+}
+TaQLParamNodeRep* TaQLParamNodeRep::restore (AipsIO& aio)
+{
+  Int nr;
+  aio >> nr;
+  return new TaQLParamNodeRep (nr);
 }
 
 TaQLKeyColNodeRep::TaQLKeyColNodeRep (const String& name,
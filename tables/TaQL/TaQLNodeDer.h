@@ -390,25 +390,60 @@ public:
 //   <li> <linkto class=TaQLNodeRep>TaQLNodeRep</linkto>
 // </prerequisite>
 // <synopsis> 
-// This class is a TaQLNodeRep holding the expressions of a join operation.
-// This is, however, a placeholder and not implemented yet.
+// This class is a TaQLNodeRep holding the table and condition of a join
+// operation. It can be an inner join (JOIN) or a left join (LEFT JOIN).
 // </synopsis> 
 
 class TaQLJoinNodeRep: public TaQLNodeRep
 {
 public:
-  TaQLJoinNodeRep (const TaQLMultiNode& tables, const TaQLNode& condition);
+  // Do not change the values of this enum, as objects might be persistent.
+  enum Type {Inner=0,
+             Left=1};
+  TaQLJoinNodeRep (Type type, const TaQLMultiNode& tables,
+                   const TaQLNode& condition);
   virtual ~TaQLJoinNodeRep();
   virtual TaQLNodeResult visit (TaQLNodeVisitor&) const;
   virtual void show (std::ostream& os) const;
   virtual void save (AipsIO& aio) const;
   static TaQLJoinNodeRep* restore (AipsIO& aio);
 
+  Type          itsType;
   TaQLMultiNode itsTables;
   TaQLNode      itsCondition;
 };
 
 
+// <summary>
+// Raw TaQL parse tree node defining a parameter of a prepared command.
+// </summary>
+// <use visibility=local>
+// <reviewed reviewer="" date="" tests="tTaQLPrepared">
+// </reviewed>
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLNodeRep>TaQLNodeRep</linkto>
+// </prerequisite>
+// <synopsis> 
+// This class is a TaQLNodeRep holding the number of a parameter given as
+// $n in an expression. Its value has to be bound before the command is
+// executed (see <linkto class=TaQLPrepared>TaQLPrepared</linkto>).
+// </synopsis> 
+
+class TaQLParamNodeRep: public TaQLNodeRep
+{
+public:
+  explicit TaQLParamNodeRep (Int nr);
+  virtual ~TaQLParamNodeRep();
+  virtual TaQLNodeResult visit (TaQLNodeVisitor&) const;
+  virtual void show (std::ostream& os) const;
+  virtual void save (AipsIO& aio) const;
+  static TaQLParamNodeRep* restore (AipsIO& aio);
+
+  Int itsNr;
+};
+
+
 // <summary>
 // Raw TaQL parse tree node defining a keyword or column name.
 // </summary>
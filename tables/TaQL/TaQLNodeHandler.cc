@@ -53,9 +53,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TaQLNodeResult TaQLNodeHandler::handleTree (const TaQLNode& node,
                                   const std::vector<const Table*>& tempTables)
+  {
+    return handleTree (node, tempTables, std::vector<TableExprNode>());
+  }
+
+  TaQLNodeResult TaQLNodeHandler::handleTree (const TaQLNode& node,
+                                  const std::vector<const Table*>& tempTables,
+                                  const std::vector<TableExprNode>& params)
   {
     clearStack();
     itsTempTables = tempTables;
+    itsParams     = params;
+    itsUsedTables.clear();
     return node.visit (*this);
   }
     
@@ -115,6 +124,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return new TaQLNodeHRValue (expr);
   }
 
+  TaQLNodeResult TaQLNodeHandler::visitParamNode (const TaQLParamNodeRep& node)
+  {
+    if (node.itsNr < 1  ||  node.itsNr > Int(itsParams.size())  ||
+        itsParams[node.itsNr-1].isNull()) {
+      throw TableInvExpr ("No value bound to parameter $" +
+                          String::toString(node.itsNr));
+    }
+    return new TaQLNodeHRValue (itsParams[node.itsNr-1]);
+  }
+
   TaQLNodeResult TaQLNodeHandler::visitRegexNode (const TaQLRegexNodeRep& node)
   {
     // Remove delimiters.
@@ -377,9 +396,46 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return TaQLNodeResult();
   }
 
-  TaQLNodeResult TaQLNodeHandler::visitJoinNode (const TaQLJoinNodeRep&)
+  TaQLNodeResult TaQLNodeHandler::visitJoinNode (const TaQLJoinNodeRep& node)
   {
-    throw TableInvExpr ("join is not supported yet");
+    if (node.itsTables.getMultiRep()->itsNodes.size() != 1) {
+      throw TableInvExpr ("A single table must be given in a JOIN");
+    }
+    TableParseSelect* curSel = topStack();
+    handleTables (node.itsTables);
+    const String& shorthand = curSel->startJoin();
+    std::vector<TaQLNode> keyNodes;
+    splitJoinCondition (node.itsCondition, keyNodes);
+    std::vector<TableExprNode> mainKeys;
+    std::vector<TableExprNode> joinKeys;
+    for (uInt i=0; i<keyNodes.size(); i+=2) {
+      // Find out which side of the equality uses the joined table.
+      TableExprNode keys[2];
+      Int use[2];
+      for (uInt j=0; j<2; ++j) {
+        if (isJoinRowid (keyNodes[i+j], shorthand)) {
+          use[j] = 1;            // null key means row number
+        } else {
+          curSel->startJoinKey();
+          TaQLNodeResult result = visitNode (keyNodes[i+j]);
+          keys[j] = getHR(result).getExpr();
+          use[j] = curSel->endJoinKey();
+        }
+      }
+      if (use[0] == 1  &&  (use[1] & 1) == 0) {
+        joinKeys.push_back (keys[0]);
+        mainKeys.push_back (keys[1]);
+      } else if (use[1] == 1  &&  (use[0] & 1) == 0) {
+        joinKeys.push_back (keys[1]);
+        mainKeys.push_back (keys[0]);
+      } else {
+        throw TableInvExpr ("One side of each equality in the JOIN condition "
+                            "must only use joined table " + shorthand +
+                            " and the other side must not use it");
+      }
+    }
+    curSel->handleJoin (node.itsType == TaQLJoinNodeRep::Left,
+                        mainKeys, joinKeys);
     return TaQLNodeResult();
   }
 
@@ -520,7 +576,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Furthermore, handle GIVING first, because projection needs to know
     // the resulting table name.
     visitNode     (node.itsGiving);
-    visitNode     (node.itsJoin);
+    handleJoins   (node.itsJoin);
     handleWhere   (node.itsWhere);
     visitNode     (node.itsGroupby);
     visitNode     (node.itsColumns);
@@ -530,11 +586,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TaQLNodeResult res(hrval);
     if (! node.getNoExecute()) {
       if (outer) {
-        curSel->execute (node.style().doTiming(), False, False, 0,
-                         node.style().doTracing());
-        hrval->setTable (curSel->getTable());
-        hrval->setNames (new Vector<String>(curSel->getColumnNames()));
-        hrval->setString ("select");
+        if (executeCommand (*hrval, node.style(), False,
+                            node.style().doTracing())) {
+          hrval->setTable (curSel->getTable());
+          hrval->setNames (new Vector<String>(curSel->getColumnNames()));
+          hrval->setString ("select");
+        }
       } else {
         if (node.getFromExecute()) {
           hrval->setTable (curSel->doFromQuery(node.style().doTiming()));
@@ -560,12 +617,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     handleWhere   (node.itsWhere);
     visitNode     (node.itsSort);
     visitNode     (node.itsLimitOff);
-    curSel->execute (node.style().doTiming(), False, True, 0);
     TaQLNodeHRValue* hrval = new TaQLNodeHRValue();
     TaQLNodeResult res(hrval);
-    hrval->setTable (curSel->getTable());
-    hrval->setNames (new Vector<String>(curSel->getColumnNames()));
-    hrval->setString ("update");
+    if (executeCommand (*hrval, node.style(), True, False)) {
+      hrval->setTable (curSel->getTable());
+      hrval->setNames (new Vector<String>(curSel->getColumnNames()));
+      hrval->setString ("update");
+    }
     popStack();
     return res;
   }
@@ -613,11 +671,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     handleWhere   (node.itsWhere);
     visitNode     (node.itsSort);
     visitNode     (node.itsLimitOff);
-    curSel->execute (node.style().doTiming(), False, True, 0);
     TaQLNodeHRValue* hrval = new TaQLNodeHRValue();
     TaQLNodeResult res(hrval);
-    hrval->setTable (curSel->getTable());
-    hrval->setString ("delete");
+    if (executeCommand (*hrval, node.style(), True, False)) {
+      hrval->setTable (curSel->getTable());
+      hrval->setString ("delete");
+    }
     popStack();
     return res;
   }
@@ -635,10 +694,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TaQLNodeResult res(hrval);
     AlwaysAssert (! node.getNoExecute(), AipsError);
     if (outer) {
-      curSel->execute (node.style().doTiming(), False, True, 0);
-      hrval->setTable (curSel->getTable());
-      hrval->setNames (new Vector<String>(curSel->getColumnNames()));
-      hrval->setString ("count");
+      if (executeCommand (*hrval, node.style(), True, False)) {
+        hrval->setTable (curSel->getTable());
+        hrval->setNames (new Vector<String>(curSel->getColumnNames()));
+        hrval->setString ("count");
+      }
     } else {
       AlwaysAssert (node.getFromExecute(), AipsError);
       hrval->setTable (curSel->doFromQuery(node.style().doTiming()));
@@ -921,8 +981,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     for (uInt i=0; i<nodes.size(); ++i) {
       TaQLNodeResult result = visitNode (nodes[i]);
       const TaQLNodeHRValue& res = getHR(result);
-      topStack()->addTable (res.getInt(), res.getString(), res.getTable(),
-                            res.getAlias(), addToFromList, itsTempTables, itsStack);
+      itsUsedTables.push_back
+        (topStack()->addTable (res.getInt(), res.getString(), res.getTable(),
+                               res.getAlias(), addToFromList,
+                               itsTempTables, itsStack));
     }
   }
 
@@ -1025,6 +1087,71 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return hr;
   }
 
+  Bool TaQLNodeHandler::executeCommand (TaQLNodeHRValue& hrval,
+                                        const TaQLStyle& style,
+                                        Bool mustSelect, Bool doTracing)
+  {
+    TableParseSelect* curSel = topStack();
+    if (style.doExplain()) {
+      hrval.setString ("explain");
+      hrval.setExpr (TableExprNode(curSel->getPlan (style.nthreads())));
+      return False;
+    }
+    if (style.doProfile()) {
+      hrval.setString ("profile");
+      hrval.setExpr (TableExprNode(curSel->doProfile (mustSelect,
+                                                      doTracing)));
+      return False;
+    }
+    curSel->execute (style.doTiming(), False, mustSelect, 0, doTracing,
+                     style.nthreads());
+    return True;
+  }
+
+  void TaQLNodeHandler::handleJoins (const TaQLNode& node)
+  {
+    if (node.isValid()) {
+      const TaQLMultiNodeRep* joins = (TaQLMultiNodeRep*)(node.getRep());
+      for (uInt i=0; i<joins->itsNodes.size(); ++i) {
+        visitNode (joins->itsNodes[i]);
+      }
+    }
+  }
+
+  void TaQLNodeHandler::splitJoinCondition (const TaQLNode& node,
+                                            std::vector<TaQLNode>& keys)
+  {
+    if (node.nodeType() == TaQLNode_Binary) {
+      const TaQLBinaryNodeRep* binNode = (TaQLBinaryNodeRep*)(node.getRep());
+      if (binNode->itsType == TaQLBinaryNodeRep::B_AND) {
+        splitJoinCondition (binNode->itsLeft, keys);
+        splitJoinCondition (binNode->itsRight, keys);
+        return;
+      } else if (binNode->itsType == TaQLBinaryNodeRep::B_EQ) {
+        keys.push_back (binNode->itsLeft);
+        keys.push_back (binNode->itsRight);
+        return;
+      }
+    }
+    throw TableInvExpr ("A JOIN condition must consist of equalities "
+                        "combined with AND");
+  }
+
+  Bool TaQLNodeHandler::isJoinRowid (const TaQLNode& node,
+                                     const String& shorthand)
+  {
+    if (node.nodeType() == TaQLNode_Func) {
+      const TaQLFuncNodeRep* funcNode = (TaQLFuncNodeRep*)(node.getRep());
+      const String& name = funcNode->itsName;
+      uInt sz = shorthand.size() + 1;
+      return (name.size() == sz+5  &&  name.substr(0, sz) == shorthand + '.'
+              &&  downcase(name.substr(sz)) == "rowid"  &&
+              (!funcNode->itsArgs.isValid()  ||
+               funcNode->itsArgs.getMultiRep()->itsNodes.empty()));
+    }
+    return False;
+  }
+
   void TaQLNodeHandler::handleWhere (const TaQLNode& node)
   {
     if (node.isValid()) {
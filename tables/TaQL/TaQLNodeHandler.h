@@ -99,8 +99,20 @@ public:
 
   // Handle and process the raw parse tree.
   // The result contains a Table or TableExprNode object.
+  // The optional <src>params</src> give the values of the parameters
+  // $1, $2, etc. used in the expressions of a prepared command.
+  // <group>
   TaQLNodeResult handleTree (const TaQLNode& tree,
                              const std::vector<const Table*>&);
+  TaQLNodeResult handleTree (const TaQLNode& tree,
+                             const std::vector<const Table*>&,
+                             const std::vector<TableExprNode>& params);
+  // </group>
+
+  // Get the tables used in the FROM and WITH clauses of the last tree
+  // handled (also those of subqueries).
+  const std::vector<Table>& usedTables() const
+    { return itsUsedTables; }
 
   // Define the functions to visit each node type.
   // <group>
@@ -140,6 +152,7 @@ public:
   virtual TaQLNodeResult visitAddRowNode   (const TaQLAddRowNodeRep& node);
   virtual TaQLNodeResult visitConcTabNode  (const TaQLConcTabNodeRep& node);
   virtual TaQLNodeResult visitShowNode     (const TaQLShowNodeRep& node);
+  virtual TaQLNodeResult visitParamNode    (const TaQLParamNodeRep& node);
   // </group>
 
   // Get the actual result object from the result.
@@ -172,6 +185,18 @@ private:
   // Make a ConcatTable from a nested set of tables.
   Table makeConcatTable (const TaQLMultiNodeRep& node);
 
+  // Handle the JOIN clauses.
+  void handleJoins (const TaQLNode&);
+
+  // Split the condition of a JOIN into the pairs of key expressions
+  // (it must consist of equalities combined with AND).
+  static void splitJoinCondition (const TaQLNode& condition,
+                                  std::vector<TaQLNode>& keys);
+
+  // Test if a JOIN key is the rowid function of the joined table
+  // (given as <src>shorthand.rowid()</src>).
+  static Bool isJoinRowid (const TaQLNode& key, const String& shorthand);
+
   // Handle the WHERE clause.
   void handleWhere (const TaQLNode&);
 
@@ -193,12 +218,22 @@ private:
   // Handle a Multi RecFld representing a Record.
   Record handleMultiRecFld (const TaQLNode& node);
 
+  // Execute the command on top of the stack.
+  // If EXPLAIN or PROFILE is given, the plan or profile is returned
+  // as a string in the result value and False is returned.
+  Bool executeCommand (TaQLNodeHRValue& hrval, const TaQLStyle& style,
+                       Bool mustSelect, Bool doTracing);
+
 
   //# Use vector instead of stack because it has random access
   //# (which is used in TableParse.cc).
   std::vector<TableParseSelect*> itsStack;
   //# The temporary tables referred to by $i in the TaQL string.
   std::vector<const Table*> itsTempTables;
+  //# The values of the parameters $i in the expressions.
+  std::vector<TableExprNode> itsParams;
+  //# The tables used in the FROM and WITH clauses.
+  std::vector<Table> itsUsedTables;
 };
 
 
@@ -117,6 +117,7 @@ public:
   #define TaQLNode_AddRow   char(34)
   #define TaQLNode_ConcTab  char(35)
   #define TaQLNode_Show     char(36)
+  #define TaQLNode_Param    char(37)
   // </group>
 
   // Constructor for derived classes specifying the type.
@@ -113,6 +113,7 @@ public:
   virtual TaQLNodeResult visitAddRowNode   (const TaQLAddRowNodeRep& node) = 0;
   virtual TaQLNodeResult visitConcTabNode  (const TaQLConcTabNodeRep& node) = 0;
   virtual TaQLNodeResult visitShowNode     (const TaQLShowNodeRep& node) = 0;
+  virtual TaQLNodeResult visitParamNode    (const TaQLParamNodeRep& node) = 0;
   // </group>
 
 protected:
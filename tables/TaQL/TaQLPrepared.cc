@@ -0,0 +1,166 @@
+//# TaQLPrepared.cc: A parsed TaQL command that can be executed repeatedly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/TaQLPrepared.h>
+#include <casacore/tables/TaQL/TaQLNodeHandler.h>
+#include <casacore/tables/TaQL/TaQLStyle.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/OS/Timer.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TaQLPrepared::TaQLPrepared (const String& command)
+  : itsCommand (command)
+{
+  init();
+}
+
+TaQLPrepared::TaQLPrepared (const String& command,
+                            const std::vector<const Table*>& tempTables)
+  : itsCommand    (command),
+    itsTempTables (tempTables)
+{
+  init();
+}
+
+void TaQLPrepared::init()
+{
+  uInt nparams;
+  itsTree = TaQLNode::parse (itsCommand, nparams);
+  itsValues.resize (nparams);
+}
+
+void TaQLPrepared::bind (uInt nr, const ValueHolder& value)
+{
+  if (nr < 1  ||  nr > itsValues.size()) {
+    throw TableError ("TaQLPrepared::bind: parameter $" +
+                      String::toString(nr) + " does not exist in command " +
+                      itsCommand);
+  }
+  itsValues[nr-1] = makeNode (value);
+}
+
+void TaQLPrepared::clearBindings()
+{
+  for (uInt i=0; i<itsValues.size(); ++i) {
+    itsValues[i] = TableExprNode();
+  }
+}
+
+void TaQLPrepared::releaseTables()
+{
+  itsTables.clear();
+}
+
+TaQLResult TaQLPrepared::execute()
+{
+  Vector<String> cols;
+  String commandType;
+  return execute (cols, commandType);
+}
+
+TaQLResult TaQLPrepared::execute (Vector<String>& cols, String& commandType)
+{
+  commandType = "error";
+  Timer timer;
+  try {
+    TaQLNodeHandler treeHandler;
+    TaQLNodeResult res = treeHandler.handleTree (itsTree, itsTempTables,
+                                                 itsValues);
+    // Keep the tables open, so a next execution finds them in the cache.
+    itsTables = treeHandler.usedTables();
+    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
+    commandType = hrval.getString();
+    TableExprNode expr = hrval.getExpr();
+    if (itsTree.style().doTiming()) {
+      timer.show (" Total time   ");
+    }
+    if (! expr.isNull()) {
+      return TaQLResult(expr);                 // result of CALC command
+    }
+    //# Copy the possibly selected column names.
+    if (hrval.getNames()) {
+      Vector<String> tmp(*(hrval.getNames()));
+      cols.reference (tmp);
+    } else {
+      cols.resize (0);
+    }
+    return hrval.getTable();
+  } catch (std::exception& x) {
+    throw TableParseError ("'" + itsCommand + "'\n  " + x.what());
+  }
+}
+
+TableExprNode TaQLPrepared::makeNode (const ValueHolder& value)
+{
+  if (value.isNull()) {
+    return TableExprNode();
+  }
+  switch (value.dataType()) {
+  case TpBool:
+    return TableExprNode (value.asBool());
+  case TpUChar:
+  case TpShort:
+  case TpUShort:
+  case TpInt:
+  case TpUInt:
+  case TpInt64:
+    return TableExprNode (value.asInt64());
+  case TpFloat:
+  case TpDouble:
+    return TableExprNode (value.asDouble());
+  case TpComplex:
+  case TpDComplex:
+    return TableExprNode (value.asDComplex());
+  case TpString:
+    return TableExprNode (value.asString());
+  case TpArrayBool:
+    return TableExprNode (value.asArrayBool());
+  case TpArrayUChar:
+  case TpArrayShort:
+  case TpArrayUShort:
+  case TpArrayInt:
+  case TpArrayUInt:
+  case TpArrayInt64:
+    return TableExprNode (value.asArrayInt64());
+  case TpArrayFloat:
+  case TpArrayDouble:
+    return TableExprNode (value.asArrayDouble());
+  case TpArrayComplex:
+  case TpArrayDComplex:
+    return TableExprNode (value.asArrayDComplex());
+  case TpArrayString:
+    return TableExprNode (value.asArrayString());
+  default:
+    break;
+  }
+  throw TableError ("TaQLPrepared: a parameter value must be a scalar or "
+                    "array of a standard data type");
+}
+
+} //# NAMESPACE CASACORE - END
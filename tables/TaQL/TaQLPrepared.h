@@ -0,0 +1,167 @@
+//# TaQLPrepared.h: A parsed TaQL command that can be executed repeatedly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TAQLPREPARED_H
+#define TABLES_TAQLPREPARED_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Containers/ValueHolder.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// A parsed TaQL command that can be executed repeatedly
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLPrepared.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto group=TableParse.h#tableCommand>tableCommand</linkto>
+//   <li> <linkto class=TaQLNode>TaQLNode</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TaQLPrepared parses a TaQL command once and keeps the resulting parse
+// tree, so it can be executed many times without having to parse it again.
+// <br>Literal values in the expressions of the command can be replaced
+// by the parameters $1, $2, etc. A value has to be bound to each of them
+// before the command is executed. A value can be a scalar or an array
+// (which can be used as a set like in <src>ANTENNA1 IN $2</src>).
+// Note that $n in a table name (like <src>FROM $1</src>) still means a
+// temporary table given as a Table object.
+// <br>Only the parse tree is reused. The select tree, the column objects
+// and the expression nodes are created anew by each execution, because
+// the bound values are substituted as constants (so they can be used in
+// optimizations like the hashed IN set and skipping rows).
+// <p>
+// The tables used in the FROM and WITH clauses are kept open after an
+// execution, so the next execution finds them in the table cache and
+// does not need to open them again. Note that this also means that
+// the locks of these tables are kept (unless AutoLocking is used).
+// The tables are released by <src>releaseTables</src> or when the
+// object is destructed.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   TaQLPrepared cmd ("select from my.ms where ANTENNA1 == $1 && "
+//                     "TIME between $2 and $3");
+//   for (Int ant=0; ant<nant; ++ant) {
+//     cmd.bind (1, ValueHolder(ant));
+//     cmd.bind (2, ValueHolder(startTime));
+//     cmd.bind (3, ValueHolder(endTime));
+//     Table result = cmd.execute().table();
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Services often issue many queries which only differ in some values.
+// Parsing and opening the tables each time is a waste of time.
+// The time needed to create the column objects and expression nodes is
+// usually small compared to evaluating the expressions.
+// </motivation>
+
+class TaQLPrepared
+{
+public:
+  // Parse the command. An exception is thrown in case of parse errors.
+  // The optional temporary tables are used for $n in table names.
+  // The pointers are kept, so the tables must stay alive.
+  // <group>
+  explicit TaQLPrepared (const String& command);
+  TaQLPrepared (const String& command,
+                const std::vector<const Table*>& tempTables);
+  // </group>
+
+  // Get the command.
+  const String& command() const
+    { return itsCommand; }
+
+  // Get the number of parameters (the highest $n used).
+  uInt nparams() const
+    { return itsValues.size(); }
+
+  // Bind a value to parameter $nr (1-relative).
+  // The value must be a scalar or array of a standard data type.
+  // The value stays bound until it is replaced or cleared.
+  void bind (uInt nr, const ValueHolder& value);
+
+  // Remove all bound values.
+  void clearBindings();
+
+  // Execute the command using the bound values.
+  // An exception is thrown if a parameter has no value.
+  // The command type (select, update, etc.) and the selected or updated
+  // column names can be returned.
+  // <group>
+  TaQLResult execute();
+  TaQLResult execute (Vector<String>& columnNames, String& commandType);
+  // </group>
+
+  // Close the tables kept open by the last execution (if not used
+  // elsewhere).
+  void releaseTables();
+
+  // Convert a value to a constant expression node.
+  // A null TableExprNode is returned if the value is null.
+  static TableExprNode makeNode (const ValueHolder& value);
+
+private:
+  // Forbid copy constructor and assignment.
+  // <group>
+  TaQLPrepared (const TaQLPrepared&);
+  TaQLPrepared& operator= (const TaQLPrepared&);
+  // </group>
+
+  // Parse the command.
+  void init();
+
+  //# Data members.
+  String                     itsCommand;
+  TaQLNode                   itsTree;
+  std::vector<const Table*>  itsTempTables;
+  std::vector<TableExprNode> itsValues;
+  std::vector<Table>         itsTables;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
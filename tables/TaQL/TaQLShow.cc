@@ -139,6 +139,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     "  COUNT [column_list] FROM table_list [WHERE ...]",
     "",
     "All commands can be preceeded by 'WITH table-list' having temporary tables.",
+    "A SELECT, UPDATE, DELETE or COUNT command can be preceeded by",
+    "  EXPLAIN  to show the execution plan without executing the command, or",
+    "  PROFILE  to execute it and show the plan with the time of each step",
+    "           and the evaluation statistics (rows, true/false results,",
+    "           bytes read, time) of each node in the WHERE expression.",
+    "           The WHERE expression is evaluated by a single thread.",
     "Use 'show command <command>' for more information about a command.",
     "    'show expr(essions)'     for more information about forming expressions.",
     "See http://casacore.github.io/casacore-notes/199.html for full info.",
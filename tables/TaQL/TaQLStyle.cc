@@ -37,7 +37,10 @@ TaQLStyle::TaQLStyle (uInt origin)
     itsEndExcl   (False),
     itsCOrder    (False),
     itsDoTiming  (False),
-    itsDoTracing (False)
+    itsDoTracing (False),
+    itsDoExplain (False),
+    itsDoProfile (False),
+    itsNThreads  (1)
 {
   // Define mscal as a synonym for derivedmscal.
   defineSynonym ("mscal", "derivedmscal");
@@ -47,6 +50,18 @@ TaQLStyle::TaQLStyle (uInt origin)
 void TaQLStyle::set (const String& value)
 {
   String val = upcase(value);
+  // A value like THREADS=n sets the number of threads.
+  String::size_type pos = val.find ('=');
+  if (pos != String::npos) {
+    String name = trim(String(val.before(pos)));
+    String nr   = trim(String(val.after(pos)));
+    if (name != "THREADS"  ||  nr.empty()
+    ||  nr.find_first_not_of ("0123456789") != String::npos) {
+      throw TableError(value + " is an invalid TaQL STYLE value");
+    }
+    setNThreads (String::toInt (nr));
+    return;
+  }
   if (val == "GLISH") {
     itsOrigin  = 1;
     itsEndExcl = False;
@@ -85,6 +100,9 @@ void TaQLStyle::reset()
   set ("GLISH");
   itsDoTiming  = False;
   itsDoTracing = False;
+  itsDoExplain = False;
+  itsDoProfile = False;
+  itsNThreads  = 1;
 }
 
 void TaQLStyle::defineSynonym (const String& synonym, const String& udfLibName)
@@ -54,7 +54,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // The default style is Glish.
 //
 // The class is also used to tell the TaQL execution engine if timings
-// or tracing of the various parts of the TaQL command need to be done.
+// or tracing of the various parts of the TaQL command need to be done,
+// if the command has to be explained (EXPLAIN) or profiled (PROFILE),
+// and how many threads can be used to evaluate the WHERE clause
+// (e.g., <src>using style threads=8</src>).
+// Only the WHERE clause is evaluated in parallel; GROUPBY and the
+// aggregate functions are still evaluated by a single thread.
 //
 // Finally it is possible to define synonyms for UDF library names.
 // For example, 'derivedmscal' is a lot to type, so a synonym 'mscal'
@@ -73,6 +78,8 @@ public:
   // Set the style according to the (case-insensitive) value.
   // Possible values are Glish, Python, Base0, Base1, FortranOrder, Corder,
   // InclEnd, and ExclEnd.
+  // Furthermore <src>Threads=n</src> can be given to set the number of
+  // threads.
   void set (const String& value);
 
   // Define a UDF library name synonym.
@@ -115,12 +122,41 @@ public:
   Bool doTracing() const
     { return itsDoTracing; }
 
+  // Set if only the execution plan has to be shown (EXPLAIN command).
+  void setExplain (Bool doExplain)
+    { itsDoExplain = doExplain; }
+
+  // Should only the execution plan be shown?
+  Bool doExplain() const
+    { return itsDoExplain; }
+
+  // Set if the command has to be profiled (PROFILE command).
+  void setProfile (Bool doProfile)
+    { itsDoProfile = doProfile; }
+
+  // Should the command be profiled?
+  Bool doProfile() const
+    { return itsDoProfile; }
+
+  // Set the number of threads to use for the evaluation of the WHERE
+  // clause. A value 0 is the same as 1 (thus no parallelisation).
+  // It is not used for GROUPBY and aggregation.
+  void setNThreads (uInt nthreads)
+    { itsNThreads = (nthreads == 0  ?  1 : nthreads); }
+
+  // Get the number of threads to use.
+  uInt nthreads() const
+    { return itsNThreads; }
+
 private:
   uInt itsOrigin;
   Bool itsEndExcl;
   Bool itsCOrder;
   Bool itsDoTiming;
   Bool itsDoTracing;
+  Bool itsDoExplain;
+  Bool itsDoProfile;
+  uInt itsNThreads;
   std::map<String,String> itsUDFLibNameMap;
 };
 
@@ -117,6 +117,8 @@ INTERSECT [Ii][Nn][Tt][Ee][Rr][Ss][Ee][Cc][Tt]
 EXCEPT    ([Ee][Xx][Cc][Ee][Pp][Tt])|([Mm][Ii][Nn][Uu][Ss])
 STYLE     [Uu][Ss][Ii][Nn][Gg]{WHITE}[Ss][Tt][Yy][Ll][Ee]{WHITE1}
 TIMEWORD  [Tt][Ii][Mm][Ee]
+EXPLAIN   [Ee][Xx][Pp][Ll][Aa][Ii][Nn]
+PROFILE   [Pp][Rr][Oo][Ff][Ii][Ll][Ee]
 SHOW      ([Ss][Hh][Oo][Ww])|([Hh][Ee][Ll][Pp])
 WITH      [Ww][Ii][Tt][Hh]
 SELECT    [Ss][Ee][Ll][Ee][Cc][Tt]
@@ -164,6 +166,8 @@ GROUPBY   [Gg][Rr][Oo][Uu][Pp]{WHITE}[Bb][Yy]{WHITE1}
 GROUPROLL {GROUPBY}{WHITE}[Rr][Oo][Ll][Ll][Uu][Pp]{WHITE1}
 HAVING    [Hh][Aa][Vv][Ii][Nn][Gg]
 JOIN      [Jj][Oo][Ii][Nn]
+INNERJOIN [Ii][Nn][Nn][Ee][Rr]{WHITE1}{WHITE}{JOIN}
+LEFTJOIN  [Ll][Ee][Ff][Tt]{WHITE1}{WHITE}([Oo][Uu][Tt][Ee][Rr]{WHITE1}{WHITE})?{JOIN}
 ON        [Oo][Nn]
 ASC       [Aa][Ss][Cc]
 DESC      [Dd][Ee][Ss][Cc]
@@ -190,6 +194,8 @@ NAME      \\?[A-Za-z_]([A-Za-z_0-9]|(\\.))*
 NAMEFLD   ({NAME}".")?{NAME}?("::")?{NAME}("."{NAME})*
 /* A temporary table name can be followed by field names */
 TEMPTAB   [$]{INT}(("."{NAME})?"::"{NAME}("."{NAME})*)?
+/* A parameter of a prepared command */
+PARAM     [$]{INT}
 /* A table name can contain about every character
    (but is recognized in specific states only).
    It can be a mix of quoted and unquoted strings (with escaped characters).
@@ -198,6 +204,8 @@ NAMETABC  ([A-Za-z0-9_./+\-~$@:]|(\\.))+
 NAMETAB   {NAMETABC}|(({STRING}|{NAMETABC})+)
 /* A UDFlib synonym */
 UDFLIBSYN {NAME}{WHITE}"="{WHITE}{NAME}
+/* A style option with a numeric value (e.g. threads=8) */
+STYLEOPT  {NAME}{WHITE}"="{WHITE}{INT}
 /* A regular expression can be delimited by / % or @ optionall=y followed by i
    to indicate case-insensitive matching.
      m is a partial match (match if part of string matches the regex)
@@ -243,6 +251,8 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
     between TABLENAMEstate and EXPRstate.
     A table name can be $nnn indicating a temporary table. It can optionally
     be followed by :: and the name of a subtable of that temporary table.
+    In an expression $nnn (not followed by ::) is a parameter whose value
+    is bound when executing a prepared command (see TaQLPrepared).
 
     The order in the following list is important, since, for example,
     the word "giving" must be recognized as GIVING and not as NAME.
@@ -454,13 +464,25 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
 	    BEGIN(EXPRstate);
 	    return HAVING;
           }
-{JOIN} {
+{JOIN}    {
             tableGramPosition() += yyleng;
-            throw (TableInvExpr ("JOIN ON is not supported yet"));
+	    BEGIN(TABLENAMEstate);
+	    return JOIN;
           }
-{ON}  {
+{INNERJOIN} {
             tableGramPosition() += yyleng;
-            throw (TableInvExpr ("JOIN ON is not supported yet"));
+	    BEGIN(TABLENAMEstate);
+	    return JOIN;
+          }
+{LEFTJOIN} {
+            tableGramPosition() += yyleng;
+	    BEGIN(TABLENAMEstate);
+	    return LEFTJOIN;
+          }
+{ON}      {
+            tableGramPosition() += yyleng;
+	    BEGIN(EXPRstate);
+	    return ON;
           }
 
 {AS}      {
@@ -500,6 +522,15 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
             return SEMICOL;
           }
 
+ /* Style option with a value; it is handled like a style name */
+<STYLEstate>{STYLEOPT} {
+            tableGramPosition() += yyleng;
+            lvalp->val = new TaQLConstNode(
+                new TaQLConstNodeRep (String(TableGramtext)));
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+	    return NAME;
+	  }
+
  /* UDF libname synonym definition */
 <STYLEstate>{UDFLIBSYN} {
             tableGramPosition() += yyleng;
@@ -657,7 +688,7 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
 
  /* In most states the word TIME is a normal column or function name.
     Otherwise it is the TIME keyword (to show timings).
-    The same for SHOW.
+    The same for EXPLAIN, PROFILE, and SHOW.
  */
 <EXPRstate,TABLENAMEstate>{TIMEWORD} { 
             tableGramPosition() += yyleng;
@@ -670,6 +701,28 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
             tableGramPosition() += yyleng;
 	    return TIMING;
 	  }
+<EXPRstate,TABLENAMEstate>{EXPLAIN} { 
+            tableGramPosition() += yyleng;
+            lvalp->val = new TaQLConstNode(
+                new TaQLConstNodeRep (tableGramRemoveEscapes (TableGramtext)));
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+	    return NAME;
+	  }
+{EXPLAIN} {
+            tableGramPosition() += yyleng;
+	    return EXPLAIN;
+	  }
+<EXPRstate,TABLENAMEstate>{PROFILE} { 
+            tableGramPosition() += yyleng;
+            lvalp->val = new TaQLConstNode(
+                new TaQLConstNodeRep (tableGramRemoveEscapes (TableGramtext)));
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+	    return NAME;
+	  }
+{PROFILE} {
+            tableGramPosition() += yyleng;
+	    return PROFILE;
+	  }
 <EXPRstate,TABLENAMEstate>{SHOW} { 
             tableGramPosition() += yyleng;
             lvalp->val = new TaQLConstNode(
@@ -720,6 +773,15 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
 	    return FLDNAME;
 	  }
 
+ /* A parameter in an expression; it has to precede TEMPTAB */
+<EXPRstate>{PARAM} {
+            tableGramPosition() += yyleng;
+            lvalp->node = new TaQLNode(
+                new TaQLParamNodeRep (atoi(TableGramtext+1)));
+            TaQLNode::theirNodesCreated.push_back (lvalp->node);
+	    return PARAM;
+	  }
+
  /* A temporary table number possibly followed by a subtable name*/
 {TEMPTAB} {
             tableGramPosition() += yyleng;
@@ -45,6 +45,8 @@ Expect them, so bison does not generate an error message.
 /* Define the terminals (tokens returned by flex), if needed with their type */
 %token STYLE
 %token TIMING
+%token EXPLAIN
+%token PROFILE
 %token SHOW
 %token SELECT
 %token UPDATE
@@ -63,6 +65,9 @@ Expect them, so bison does not generate an error message.
 %token GROUPBY
 %token GROUPROLL
 %token HAVING
+%token JOIN
+%token LEFTJOIN
+%token ON
 %token ORDERBY
 %token NODUPL
 %token GIVING
@@ -89,6 +94,7 @@ Expect them, so bison does not generate an error message.
 %token <val> TABNAME        /* table name */
 %token <val> LITERAL
 %token <val> STRINGLITERAL
+%token <node> PARAM          /* parameter $n of a prepared command */
 %token <valre> REGEX
 %token AS
 %token TO
@@ -150,6 +156,9 @@ Expect them, so bison does not generate an error message.
 %type <node> groupby
 %type <nodelist> exprlist
 %type <node> having
+%type <nodelist> joins
+%type <nodelist> joinlist
+%type <node> joinpart
 %type <node> order
 %type <node> limitoff
 %type <nodelist> tabnmopts
@@ -268,20 +277,25 @@ topcomm:   topcomm1
          | topcomm1 SEMICOL
          ;
 
-/* A command can be preceded by the TIME keyword and style arguments */
+/* A command can be preceded by the TIME, EXPLAIN or PROFILE keyword
+   and style arguments */
 topcomm1:  command
          | sttimcoms command
          ;
 
-sttimcoms: TIMING
-             { TaQLNode::theirStyle.setTiming (True); }
+sttimcoms: timkey
          | stylecoms
-         | stylecoms TIMING
-             { TaQLNode::theirStyle.setTiming (True); }
-         | TIMING stylecoms
-             { TaQLNode::theirStyle.setTiming (True); }
-         | stylecoms TIMING stylecoms
+         | stylecoms timkey
+         | timkey stylecoms
+         | stylecoms timkey stylecoms
+         ;
+
+timkey:    TIMING
              { TaQLNode::theirStyle.setTiming (True); }
+         | EXPLAIN
+             { TaQLNode::theirStyle.setExplain (True); }
+         | PROFILE
+             { TaQLNode::theirStyle.setProfile (True); }
          ;
 
 /* Multiple STYLE commands can be given */
@@ -397,16 +411,16 @@ withpart:  {   /* no WITH part */
 
 /* The SELECT command; note that many parts are optional which is handled
    in the rule of that part. The FROM part being optional is handled here. */
-selcomm:   withpart SELECT selcol FROM tables whexpr groupby having order limitoff given dminfo {
+selcomm:   withpart SELECT selcol FROM tables joins whexpr groupby having order limitoff given dminfo {
                $$ = new TaQLQueryNode(
-                    new TaQLSelectNodeRep (*$3, *$1, *$5, 0, *$6, *$7, *$8,
-					   *$9, *$10, *$11, *$12));
+                    new TaQLSelectNodeRep (*$3, *$1, *$5, *$6, *$7, *$8, *$9,
+					   *$10, *$11, *$12, *$13));
 	       TaQLNode::theirNodesCreated.push_back ($$);
            }
-         | withpart SELECT selcol into FROM tables whexpr groupby having order limitoff dminfo {
+         | withpart SELECT selcol into FROM tables joins whexpr groupby having order limitoff dminfo {
                $$ = new TaQLQueryNode(
-		    new TaQLSelectNodeRep (*$3, *$1, *$6, 0, *$7, *$8, *$9,
-					   *$10, *$11, *$4, *$12));
+		    new TaQLSelectNodeRep (*$3, *$1, *$6, *$7, *$8, *$9, *$10,
+					   *$11, *$12, *$4, *$13));
 	       TaQLNode::theirNodesCreated.push_back ($$);
            }
          | withpart SELECT selcol whexpr groupby having order limitoff given dminfo {
@@ -423,6 +437,41 @@ selcomm:   withpart SELECT selcol FROM tables whexpr groupby having order limito
            }
          ;
 
+/* The JOIN clauses are optional. Multiple can be given. */
+joins:     {   /* no join */
+               $$ = new TaQLMultiNode();
+	       TaQLNode::theirNodesCreated.push_back ($$);
+           }
+         | joinlist {
+               $$ = $1;
+           }
+         ;
+
+joinlist:  joinpart {
+               $$ = new TaQLMultiNode(False);
+	       TaQLNode::theirNodesCreated.push_back ($$);
+               $$->setSeparator ("");
+               $$->add (*$1);
+           }
+         | joinlist joinpart {
+               $$ = $1;
+               $$->add (*$2);
+           }
+         ;
+
+/* An inner or left join of a table using a condition on the keys. */
+joinpart:  JOIN tables ON orexpr {
+               $$ = new TaQLNode(
+                    new TaQLJoinNodeRep (TaQLJoinNodeRep::Inner, *$2, *$4));
+	       TaQLNode::theirNodesCreated.push_back ($$);
+           }
+         | LEFTJOIN tables ON orexpr {
+               $$ = new TaQLNode(
+                    new TaQLJoinNodeRep (TaQLJoinNodeRep::Left, *$2, *$4));
+	       TaQLNode::theirNodesCreated.push_back ($$);
+           }
+         ;
+
 /* The column list can be preceded by ALL or DISTINCT */
 selcol:    normcol {
                $$ = $1;
@@ -1718,6 +1767,9 @@ simbexpr:  LPAREN orexpr RPAREN     /* subexpression in parentheses */
          | literal {
 	       $$ = $1;
 	   }
+         | PARAM {            /* parameter of a prepared command */
+	       $$ = $1;
+	   }
          | set {
 	       $$ = $1;
 	   }
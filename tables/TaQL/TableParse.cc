@@ -30,6 +30,7 @@
 #include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/tables/TaQL/TableGram.h>
 #include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/TaQL/TaQLPrepared.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/tables/TaQL/ExprDerNodeArray.h>
@@ -53,6 +54,8 @@
 #include <casacore/tables/Tables/ArrColDesc.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/Tables/TableIndexCache.h>
+#include <casacore/tables/TaQL/TableParseJoin.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
@@ -65,6 +68,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/OS/PrecTimer.h>
 #include <casacore/casa/ostream.h>
 
 #include <casacore/casa/Containers/BlockIO.h>
@@ -229,7 +233,11 @@ TableParseSelect::TableParseSelect (CommandType commandType)
     stride_p        (1),
     insSel_p        (0),
     noDupl_p        (False),
-    order_p         (Sort::Ascending)
+    order_p         (Sort::Ascending),
+    joinDuplicates_p (False),
+    timingStream_p  (0),
+    joinKeyUse_p    (-1),
+    joinSavedNApply_p (0)
 {}
 
 TableParseSelect::~TableParseSelect()
@@ -241,12 +249,12 @@ TableParseSelect::~TableParseSelect()
 
 
 //# Construct a TableParse object and add it to the container.
-void TableParseSelect::addTable (Int tabnr, const String& name,
-                                 const Table& ftab,
-                                 const String& shorthand,
-                                 Bool addToFromList,
-                                 const vector<const Table*> tempTables,
-                                 const vector<TableParseSelect*>& stack)
+Table TableParseSelect::addTable (Int tabnr, const String& name,
+                                  const Table& ftab,
+                                  const String& shorthand,
+                                  Bool addToFromList,
+                                  const vector<const Table*> tempTables,
+                                  const vector<TableParseSelect*>& stack)
 {
   Table table = makeTable (tabnr, name, ftab, shorthand, tempTables, stack);
   if (addToFromList) {
@@ -254,6 +262,7 @@ void TableParseSelect::addTable (Int tabnr, const String& name,
   } else {
     withTables_p.push_back (TableParse(table, shorthand));
   }
+  return table;
 }
 
 Table TableParseSelect::makeTable (Int tabnr, const String& name,
@@ -330,6 +339,117 @@ void TableParseSelect::replaceTable (const Table& table)
   fromTables_p[0] = TableParse(table, fromTables_p[0].shorthand());
 }
 
+const String& TableParseSelect::startJoin() const
+{
+  AlwaysAssert (fromTables_p.size() > 1, AipsError);
+  const String& shorthand = fromTables_p.back().shorthand();
+  if (shorthand.empty()) {
+    throw TableInvExpr ("A table in a JOIN must be given an alias");
+  }
+  return shorthand;
+}
+
+void TableParseSelect::startJoinKey()
+{
+  // Each side of a join condition can use differently sized tables,
+  // so clear the table used to check the sizes.
+  joinKeyUse_p      = 0;
+  joinSavedTable_p  = firstColTable_p;
+  joinSavedName_p   = firstColName_p;
+  joinSavedNApply_p = applySelNodes_p.size();
+  firstColTable_p   = Table();
+  firstColName_p    = String();
+}
+
+Int TableParseSelect::endJoinKey()
+{
+  Int use = joinKeyUse_p;
+  joinKeyUse_p    = -1;
+  firstColTable_p = joinSavedTable_p;
+  firstColName_p  = joinSavedName_p;
+  joinSavedTable_p = Table();
+  // The join keys are only used to find the rows, so their columns
+  // should not be adjusted for the selection.
+  applySelNodes_p.resize (joinSavedNApply_p);
+  return use;
+}
+
+void TableParseSelect::handleJoin (Bool leftJoin,
+                                   const vector<TableExprNode>& mainKeys,
+                                   const vector<TableExprNode>& joinKeys)
+{
+  uInt joinInx = fromTables_p.size() - 1;
+  Table mainTab = fromTables_p[0].table();
+  Table joinTab = fromTables_p[joinInx].table();
+  TableParseJoin join (mainKeys, joinKeys, mainTab.nrow(), joinTab.nrow());
+  Vector<rownr_t> mainRows, joinRows;
+  rownr_t nunmatched = join.findRows (leftJoin, mainRows, joinRows);
+  // Align the main table and the tables joined before with the matching
+  // rows. That is not needed if each main row matches exactly once.
+  Bool allRows = (mainRows.size() == mainTab.nrow());
+  Bool duplicates = False;
+  for (rownr_t i=0; i<mainRows.size(); ++i) {
+    if (mainRows[i] != i) {
+      allRows = False;
+    }
+    if (i > 0  &&  mainRows[i] == mainRows[i-1]) {
+      duplicates = True;
+      break;
+    }
+  }
+  if (! allRows) {
+    // A main row matching multiple rows occurs multiple times in the
+    // reference table. The WHERE has to take that into account.
+    if (duplicates) {
+      joinDuplicates_p = True;
+    }
+    fromTables_p[0] = TableParse (mainTab(mainRows),
+                                  fromTables_p[0].shorthand());
+    for (uInt i=0; i<joinedTables_p.size(); ++i) {
+      TableParse& tp = fromTables_p[joinedTables_p[i]];
+      tp = TableParse (tp.table()(mainRows), tp.shorthand());
+    }
+  }
+  // Main rows without a match in a left join use an extra empty row.
+  // It is a memory table of one row concatenated to the joined table,
+  // so the joined table itself does not need to be copied.
+  if (nunmatched > 0) {
+    Table emptyTab = TableCopy::makeEmptyMemoryTable
+      ("leftjoin_" + fromTables_p[joinInx].shorthand(), joinTab, True);
+    emptyTab.addRow (1, True);
+    Block<Table> tabs(2);
+    tabs[0] = joinTab;
+    tabs[1] = emptyTab;
+    joinTab = Table(tabs);
+  }
+  fromTables_p[joinInx] = TableParse (joinTab(joinRows),
+                                      fromTables_p[joinInx].shorthand());
+  joinedTables_p.push_back (joinInx);
+  // Keep the info for EXPLAIN.
+  std::ostringstream os;
+  os << (leftJoin ? "LEFT JOIN " : "JOIN     ")
+     << fromTables_p[joinInx].shorthand() << " on " << join.nkeys()
+     << " key(s) using ";
+  if (join.byRownr()) {
+    os << "row numbers";
+  } else {
+    os << "a hash table of the "
+       << (join.hashedMain() ? "main" : "joined") << " table";
+  }
+  os << "; " << mainRows.size() << " of " << mainTab.nrow()
+     << " main rows result";
+  if (leftJoin) {
+    os << " (" << nunmatched << " without match)";
+  }
+  if (duplicates) {
+    os << "; main rows matching multiple rows";
+  }
+  joinInfo_p.push_back (os.str());
+  // The table sizes have changed, so start checking them afresh.
+  firstColTable_p = Table();
+  firstColName_p  = String();
+}
+
 Table TableParseSelect::tableKey (const String& name,
                                   const String& shorthand,
                                   const String& columnName,
@@ -567,6 +687,11 @@ TableExprNode TableParseSelect::handleKeyCol (const String& name, Bool tryProj)
     // If it is a column, check if all tables used have the same size.
     // Note: the projected table (used above) should not be checked.
     if (tab.tableDesc().isColumn (columnName)) {
+      // Register if a join key uses the joined table or another table.
+      if (joinKeyUse_p >= 0) {
+        joinKeyUse_p |= (!shand.empty()  &&
+                         shand == fromTables_p.back().shorthand()  ?  1 : 2);
+      }
       if (firstColTable_p.isNull()) {
         firstColTable_p = tab;
         firstColName_p  = name;
@@ -1992,7 +2117,7 @@ Table TableParseSelect::doFromQuery (Bool showTimings)
   // Execute the nested command.
   execute (False, False, True, 0);
   if (showTimings) {
-    timer.show ("  From query  ");
+    showTiming (timer, "  From query  ");
   }
   return table_p;
 }
@@ -2005,10 +2130,11 @@ TableExprNode TableParseSelect::doExists (Bool notexists, Bool showTimings)
   // Default limit_p is 1.
   execute (False, True, True, 1);
   if (showTimings) {
-    timer.show ("  Exists query");
+    showTiming (timer, "  Exists query");
   }
   // Flag notexists tells if NOT EXISTS or EXISTS was given.
-  return TableExprNode (notexists == (table_p.nrow() < limit_p));
+  return TableExprNode (notexists == (limit_p >= 0  &&
+                                      table_p.nrow() < rownr_t(limit_p)));
 }
 
 //# Execute a subquery and create the correct node object for it.
@@ -2026,7 +2152,7 @@ TableExprNode TableParseSelect::doSubQuery (Bool showTimings)
     result = getColSet();
   }
   if (showTimings) {
-    timer.show ("  Subquery    ");
+    showTiming (timer, "  Subquery    ");
   }
   return result;
 }
@@ -2290,7 +2416,7 @@ void TableParseSelect::handleCount()
 
 //# Execute the updates.
 void TableParseSelect::doUpdate (Bool showTimings, const Table& origTable,
-                                 Table& updTable, const Vector<uInt>& rownrs,
+                                 Table& updTable, const Vector<rownr_t>& rownrs,
                                  const CountedPtr<TableExprGroupResult>& groups)
 {
   Timer timer;
@@ -2393,7 +2519,7 @@ void TableParseSelect::doUpdate (Bool showTimings, const Table& origTable,
   }
   // Loop through all rows in the table and update each row.
   TableExprIdAggr rowid(groups);
-  for (uInt row=0; row<rownrs.size(); ++row) {
+  for (rownr_t row=0; row<rownrs.size(); ++row) {
     rowid.setRownr (rownrs[row]);
     for (uInt i=0; i<nrkey; i++) {
       TableColumn& col = cols[i];
@@ -2540,12 +2666,12 @@ void TableParseSelect::doUpdate (Bool showTimings, const Table& origTable,
     }
   }
   if (showTimings) {
-    timer.show ("  Update      ");
+    showTiming (timer, "  Update      ");
   }
 }
 
 template<typename TCOL, typename TNODE>
-void TableParseSelect::copyMaskedValue (uInt row, ArrayColumn<TCOL>& acol,
+void TableParseSelect::copyMaskedValue (rownr_t row, ArrayColumn<TCOL>& acol,
                                         const Slicer* slicerPtr,
                                         const TNODE* val,
                                         uInt incr, const Array<Bool>& mask)
@@ -2608,7 +2734,7 @@ Array<Bool> TableParseSelect::makeMaskSlice (const Array<Bool>& mask,
 }
 
 template<typename TCOL, typename TNODE>
-void TableParseSelect::updateScalar (uInt row, const TableExprId& rowid,
+void TableParseSelect::updateScalar (rownr_t row, const TableExprId& rowid,
                                      const TableExprNode& node,
                                      TableColumn& col)
 {
@@ -2619,7 +2745,7 @@ void TableParseSelect::updateScalar (uInt row, const TableExprId& rowid,
   col.putScalar (row, value);
 }
 template<typename TCOL, typename TNODE>
-void TableParseSelect::updateArray (uInt row, const TableExprId& rowid,
+void TableParseSelect::updateArray (rownr_t row, const TableExprId& rowid,
                                     const TableExprNode& node,
                                     const Array<TNODE>& res,
                                     ArrayColumn<TCOL>& col)
@@ -2637,7 +2763,7 @@ void TableParseSelect::updateArray (uInt row, const TableExprId& rowid,
   }
 }
 template<typename TCOL, typename TNODE>
-void TableParseSelect::updateSlice (uInt row, const TableExprId& rowid,
+void TableParseSelect::updateSlice (rownr_t row, const TableExprId& rowid,
                                     const TableExprNode& node,
                                     const Array<TNODE>& res,
                                     const Slicer& slice,
@@ -2688,7 +2814,7 @@ void TableParseSelect::checkMaskColumn (Bool hasMask,
 }
 
 template<typename TCOL, typename TNODE>
-void TableParseSelect::updateValue (uInt row, const TableExprId& rowid,
+void TableParseSelect::updateValue (rownr_t row, const TableExprId& rowid,
                                     Bool isScalarCol,
                                     const TableExprNode& node,
                                     const Array<Bool>& mask,
@@ -2784,9 +2910,9 @@ Table TableParseSelect::doInsert (Bool showTimings, Table& table)
     } else if (limit_p < 0) {
       nrow = table.nrow() + limit_p;
     }
-    Vector<uInt> newRownrs(nrow);
+    Vector<rownr_t> newRownrs(nrow);
     indgen (newRownrs, table.nrow());
-    Vector<uInt> selRownrs(1, table.nrow() + nrow);
+    Vector<rownr_t> selRownrs(1, table.nrow() + nrow);
     // Add new rows to TableExprNodeRowid.
     // It works because NodeRowid does not obey disableApplySelection.
     for (vector<TableExprNode>::iterator iter=applySelNodes_p.begin();
@@ -2847,9 +2973,9 @@ Table TableParseSelect::doInsert (Bool showTimings, Table& table)
     }
   }
   // Add the required nr of rows to the table and make a selection of it.
-  uInt rownr = table.nrow();
+  rownr_t rownr = table.nrow();
   table.addRow (sel.nrow());
-  Vector<uInt> rownrs(sel.nrow());
+  Vector<rownr_t> rownrs(sel.nrow());
   indgen (rownrs, rownr);     // fill with rownr, rownr+1, etc.
   Table tab = table(rownrs);
   TableRow rowto (tab, Vector<String>(columnNames_p));
@@ -2858,7 +2984,7 @@ Table TableParseSelect::doInsert (Bool showTimings, Table& table)
     rowto.put (i, rowfrom.get(i), False);
   }
   if (showTimings) {
-    timer.show ("  Insert      ");
+    showTiming (timer, "  Insert      ");
   }
   return tab;
 }
@@ -2880,7 +3006,7 @@ void TableParseSelect::doDelete (Bool showTimings, Table& table)
   // Delete all rows.
   table.removeRow (rownrs_p);
   if (showTimings) {
-    timer.show ("  Delete      ");
+    showTiming (timer, "  Delete      ");
   }
 }
 
@@ -2905,7 +3031,7 @@ Table TableParseSelect::doCount (Bool showTimings, const Table& table)
   while (!iter.pastEnd()) {
     Table tabfrom = iter.table();
     // Add one row containing the column values.
-    uInt rownr = tab.nrow();
+    rownr_t rownr = tab.nrow();
     tab.addRow();
     Table tabto = tab.project (bcolNames);
     TableCopy::copyRows (tabto, tabfrom, rownr, 0, 1);
@@ -2914,7 +3040,7 @@ Table TableParseSelect::doCount (Bool showTimings, const Table& table)
     iter++;
   }
   if (showTimings) {
-    timer.show ("  Count       ");
+    showTiming (timer, "  Count       ");
   }
   return tab;
 }
@@ -2935,11 +3061,37 @@ CountedPtr<TableExprGroupResult> TableParseSelect::doGroupby
     result = doGroupByAggr (aggrNodes);
   }
   if (showTimings) {
-    timer.show ("  Groupby     ");
+    showTiming (timer, "  Groupby     ");
   }
   return result;
 }
 
+Table TableParseSelect::doWhereJoin (const Table& table, rownr_t nrmax)
+{
+  // Evaluate the WHERE in batches of rows and keep the matching rows
+  // (i.e., their positions in the table) in rownrs_p.
+  const uInt batchSize = 4096;
+  Block<Bool> vals(batchSize, False);
+  std::vector<rownr_t> rows;
+  rownr_t nrrow = table.nrow();
+  for (rownr_t st=0; st<nrrow; st+=batchSize) {
+    uInt n = std::min (nrrow - st, rownr_t(batchSize));
+    node_p.getRep()->getBoolBatch (st, n, vals.storage(), 0);
+    for (uInt j=0; j<n; ++j) {
+      if (vals[j]) {
+        rows.push_back (st + j);
+      }
+    }
+    if (nrmax > 0  &&  rows.size() >= nrmax) {
+      rows.resize (nrmax);
+      break;
+    }
+  }
+  rownrs_p.resize (rows.size());
+  std::copy (rows.begin(), rows.end(), rownrs_p.begin());
+  return table(rownrs_p);
+}
+
 Table TableParseSelect::adjustApplySelNodes (const Table& table)
 {
   for (vector<TableExprNode>::iterator iter=applySelNodes_p.begin();
@@ -2958,7 +3110,7 @@ void TableParseSelect::doHaving (Bool showTimings,
 {
   Timer timer;
   // Find the rows matching the HAVING expression.
-  Vector<uInt> rownrs(rownrs_p.size());
+  Vector<rownr_t> rownrs(rownrs_p.size());
   uInt nr = 0;
   TableExprIdAggr rowid(groups);
   for (uInt i=0; i<rownrs_p.size(); ++i) {
@@ -2971,7 +3123,7 @@ void TableParseSelect::doHaving (Bool showTimings,
   rownrs.resize (nr, True);
   rownrs_p.reference (rownrs);
   if (showTimings) {
-    timer.show ("  Having      ");
+    showTiming (timer, "  Having      ");
   }
 }
 
@@ -2993,7 +3145,7 @@ CountedPtr<TableExprGroupResult> TableParseSelect::doOnlyCountAll
   func.setResult (rownrs_p.size());
   // The resulting table has only 1 group; use the last row with it.
   if (! rownrs_p.empty()) {
-    rownrs_p.reference (Vector<uInt>(1, rownrs_p[rownrs_p.size()-1]));
+    rownrs_p.reference (Vector<rownr_t>(1, rownrs_p[rownrs_p.size()-1]));
   }
   // Save the aggregation results in a result object.
   return CountedPtr<TableExprGroupResult>(new TableExprGroupResult(funcSets));
@@ -3072,7 +3224,7 @@ CountedPtr<TableExprGroupResult> TableParseSelect::doGroupByAggr
   // Let the function nodes finish their operation.
   // Form the rownr vector from the rows kept in the aggregate objects.
   // Similarly, form the TableExprId vector if there are lazy nodes.
-  Vector<uInt> rownrs(funcSets.size());
+  Vector<rownr_t> rownrs(funcSets.size());
   vector<CountedPtr<vector<TableExprId> > > ids;
   ids.reserve (funcSets.size());
   uInt n=0;
@@ -3109,13 +3261,13 @@ void replaceIds (vector<CountedPtr<vector<TableExprId> > >& ids)
       rowids[inx++] = vec[j].rownr();
     }
   }
-  Vector<uInt> inxVec;
-  GenSortIndirect<Int64>::sort (inxVec, rowids);
+  Vector<rownr_t> inxVec;
+  GenSortIndirect<Int64,rownr_t>::sort (inxVec, rowids);
   // We need to replace each rowid by its sequence nr because a table selection
   // will map the selected rows to rowid 0..n.
   // So store the index in the rowids.
-  for (uInt i=0; i<rowids.size(); ++i) {
-    rowids[inxVec[i]] = i;
+  for (rownr_t i=0; i<rowids.size(); ++i) {
+    rowids[inxVec[i]] = Int64(i);
   }
   // Now replace the TableExprIds by the new rowids.
   inx = 0;
@@ -3128,7 +3280,7 @@ void replaceIds (vector<CountedPtr<vector<TableExprId> > >& ids)
 }
 
 //# Execute the sort.
-void TableParseSelect::doSort (Bool showTimings)
+void TableParseSelect::doSort (Bool showTimings, rownr_t nrtop)
 {
   //# If no rows, return immediately.
   //# (the code below will fail if empty)
@@ -3274,13 +3426,18 @@ void TableParseSelect::doSort (Bool showTimings)
       AlwaysAssert (False, AipsError);
     }
   }
-  uInt nrrow = rownrs_p.size();
-  Vector<uInt> newRownrs (nrrow);
-  int sortOpt = Sort::HeapSort;
-  if (noDupl_p) {
-    sortOpt += Sort::NoDuplicates;
+  rownr_t nrrow = rownrs_p.size();
+  Vector<rownr_t> newRownrs (nrrow);
+  if (nrtop > 0  &&  nrtop < nrrow  &&  !noDupl_p) {
+    // Only the first rows are needed, which is much faster than a full sort.
+    sort.partialSort (newRownrs, nrrow, nrtop);
+  } else {
+    int sortOpt = Sort::HeapSort;
+    if (noDupl_p) {
+      sortOpt += Sort::NoDuplicates;
+    }
+    sort.sort (newRownrs, nrrow, sortOpt);
   }
-  sort.sort (newRownrs, nrrow, sortOpt);
   for (i=0; i<nrkey; i++) {
     const TableParseSort& key = sort_p[i];
     switch (key.node().getColumnDataType()) {
@@ -3325,7 +3482,7 @@ void TableParseSelect::doSort (Bool showTimings)
     }
   }
   if (showTimings) {
-    timer.show ("  Orderby     ");
+    showTiming (timer, "  Orderby     ");
   }
   // Convert index to rownr.
   for (uInt i=0; i<newRownrs.size(); ++i) {
@@ -3338,7 +3495,7 @@ void TableParseSelect::doSort (Bool showTimings)
 void TableParseSelect::doLimOff (Bool showTimings)
 {
   Timer timer;
-  Vector<uInt> newRownrs;
+  Vector<rownr_t> newRownrs;
   // Negative values mean from the end (a la Python indexing).
   Int64 nrow = rownrs_p.size();
   if (offset_p < 0) {
@@ -3362,7 +3519,7 @@ void TableParseSelect::doLimOff (Bool showTimings)
   }
   rownrs_p.reference (newRownrs);
   if (showTimings) {
-    timer.show ("  Limit/Offset");
+    showTiming (timer, "  Limit/Offset");
   }
 }
 
@@ -3374,7 +3531,7 @@ Table TableParseSelect::doLimOff (Bool showTimings, const Table& table)
   doLimOff (False);
   return table(rownrs_p);
   if (showTimings) {
-    timer.show ("  Limit/Offset");
+    showTiming (timer, "  Limit/Offset");
   }
 }
 
@@ -3403,7 +3560,7 @@ Table TableParseSelect::doProject
     }
   }
   if (showTimings) {
-    timer.show ("  Projection  ");
+    showTiming (timer, "  Projection  ");
   }
   if (distinct_p) {
     tabp = doDistinct (showTimings, tabp);
@@ -3458,7 +3615,7 @@ Table TableParseSelect::doFinish (Bool showTimings, Table& table)
     }
   }
   if (showTimings) {
-    timer.show ("  Giving      ");
+    showTiming (timer, "  Giving      ");
   }
   return result;
 }
@@ -3704,15 +3861,15 @@ Table TableParseSelect::doDistinct (Bool showTimings, const Table& table)
   } else {
     // Get the rownumbers.
     // Make sure it does not reference an internal array.
-    Vector<uInt> rownrs(tabs.rowNumbers(table));
+    Vector<rownr_t> rownrs(tabs.rowNumbers(table));
     rownrs.unique();
     // Put the rownumbers back in the original order.
-    GenSort<uInt>::sort (rownrs);
+    GenSort<rownr_t>::sort (rownrs);
     result = table(rownrs);
     rownrs_p.reference (rownrs);
   }
   if (showTimings) {
-    timer.show ("  Distinct    ");
+    showTiming (timer, "  Distinct    ");
   }
   return result;
 }
@@ -3853,7 +4010,7 @@ void TableParseSelect::checkTableProjSizes() const
 {
   // Check if all tables used in non-constant select expressions
   // have the same size as the first table.
-  Int64 nrow = fromTables_p[0].table().nrow();
+  rownr_t nrow = fromTables_p[0].table().nrow();
   for (uInt i=0; i<columnExpr_p.size(); i++) {
     if (! columnExpr_p[i].getRep()->isConstant()) {
       if (columnExpr_p[i].getRep()->nrow() != nrow) {
@@ -3866,8 +4023,8 @@ void TableParseSelect::checkTableProjSizes() const
 
 //# Execute all parts of a TaQL command doing some selection.
 void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
-                                Bool mustSelect, uInt maxRow,
-                                Bool doTracing)
+                                Bool mustSelect, rownr_t maxRow,
+                                Bool doTracing, uInt nthreads)
 {
   //# A selection query consists of:
   //#  - SELECT to do projection
@@ -3958,7 +4115,7 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
   //# Determine if we can pre-empt the selection loop.
   //# That is possible if a positive limit and offset are given
   //# without sorting, select distinct, groupby, or aggregation.
-  uInt nrmax=0;
+  rownr_t nrmax=0;
   if (endrow_p > 0  &&  sort_p.size() == 0  &&  !distinct_p  &&
       groupAggrUsed == 0) {
     nrmax = endrow_p;
@@ -3969,24 +4126,30 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
   //# First do the where selection.
   Table resultTable(table);
   if (! node_p.isNull()) {
-//#//        cout << "Showing TableExprRange values ..." << endl;
-//#//        Block<TableExprRange> rang;
-//#//        node_p->ranges(rang);
-//#//        for (Int i=0; i<rang.size(); i++) {
-//#//            cout << rang[i].getColumn().columnDesc().name() << rang[i].start()
-//#//                 << rang[i].end() << endl;
-//#//        }
     Timer timer;
-    resultTable = table(node_p, nrmax);
+    if (joinDuplicates_p) {
+      resultTable = doWhereJoin (table, nrmax);
+    } else {
+      resultTable = table(node_p, nrmax, 0, nthreads);
+    }
     if (showTimings) {
-      timer.show ("  Where       ");
+      showTiming (timer, "  Where       ");
     }
     if (doTracing) {
       cerr << "WHERE resulted in " << resultTable.nrow() << " rows" << endl;
     }
   }
   // Get the row numbers of the result of the possible first step.
-  rownrs_p.reference (resultTable.rowNumbers(table));
+  // Without WHERE only the first rows are needed if pre-empted.
+  if (node_p.isNull()  &&  nrmax > 0  &&  nrmax < table.nrow()) {
+    rownrs_p.resize (nrmax);
+    indgen (rownrs_p);
+  } else if (node_p.isNull()  &&  joinDuplicates_p) {
+    rownrs_p.resize (table.nrow());
+    indgen (rownrs_p);
+  } else if (! joinDuplicates_p) {
+    rownrs_p.reference (resultTable.rowNumbers(table));
+  }
   // Execute possible groupby/aggregate.
   CountedPtr<TableExprGroupResult> groupResult;
   if (groupAggrUsed != 0) {
@@ -4022,8 +4185,14 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
     }
   }
   //# Then do the sort.
+  //# If a positive limit and offset are given without select distinct,
+  //# only the first endrow_p rows in the sort order are needed.
   if (sort_p.size() > 0) {
-    doSort (showTimings);
+    rownr_t nrtop = 0;
+    if (endrow_p > 0  &&  offset_p >= 0  &&  !distinct_p) {
+      nrtop = endrow_p;
+    }
+    doSort (showTimings, nrtop);
     if (doTracing) {
       cerr << "ORDERBY resulted in " << rownrs_p.size() << " rows" << endl;
     }
@@ -4103,6 +4272,210 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
   table_p = resultTable;
 }
 
+//# Get the execution plan of a TaQL command.
+String TableParseSelect::getPlan (uInt nthreads)
+{
+  std::ostringstream os;
+  String cmd;
+  switch (commandType_p) {
+  case PSELECT:
+    cmd = "SELECT";
+    break;
+  case PUPDATE:
+    cmd = "UPDATE";
+    break;
+  case PDELETE:
+    cmd = "DELETE";
+    break;
+  case PCOUNT:
+    cmd = "COUNT";
+    break;
+  default:
+    cmd = "TaQL";
+  }
+  os << "Plan of " << cmd << " command" << endl;
+  for (uInt i=0; i<fromTables_p.size(); ++i) {
+    const Table& tab = fromTables_p[i].table();
+    os << "  FROM     " << tab.tableName();
+    if (! fromTables_p[i].shorthand().empty()) {
+      os << " (" << fromTables_p[i].shorthand() << ')';
+    }
+    os << " with " << tab.nrow() << " rows" << endl;
+  }
+  for (uInt i=0; i<joinInfo_p.size(); ++i) {
+    os << "  " << joinInfo_p[i] << endl;
+  }
+  // Estimate how many rows can be skipped using the value ranges.
+  // Only the first value range of a limited number of evenly spread
+  // row intervals is looked at, so a large table is not scanned.
+  if (! node_p.isNull()) {
+    const TENShPtr& rep = node_p.getRep();
+    rownr_t nrow = fromTables_p[0].table().nrow();
+    rownr_t nsample = std::min (nrow, rownr_t(64));
+    rownr_t nlook = 0;
+    rownr_t nskip = 0;
+    for (rownr_t i=0; i<nsample; ++i) {
+      rownr_t row    = i * nrow / nsample;
+      rownr_t endRow = (i+1) * nrow / nsample - 1;
+      Bool mayBe = rep->mayBeTrue (row, endRow);
+      nlook += endRow - row + 1;
+      if (! mayBe) {
+        nskip += endRow - row + 1;
+      }
+    }
+    os << "  WHERE    evaluated in batches using " << nthreads
+       << " thread(s); value ranges skip ";
+    if (nsample == nrow) {
+      os << nskip;
+    } else {
+      os << "about " << rownr_t(Double(nskip) / nlook * nrow + 0.5);
+    }
+    os << " of " << nrow << " rows" << endl;
+    // Tell which column indices can be used to find the matching rows.
+    TableIndexCache* cache = TableIndexCache::get (fromTables_p[0].table());
+    if (cache != 0) {
+      Block<TableExprRange> ranges;
+      rep->ranges (ranges);
+      for (uInt i=0; i<ranges.size(); ++i) {
+        const String& name = ranges[i].getColumn().columnDesc().name();
+        if (cache->isOwnColumn (ranges[i].getColumn())  &&
+            cache->canIndex (name)) {
+          os << "           index on " << name << " for "
+             << ranges[i].start().size() << " value range(s) "
+             << (cache->hasIndex(name) ?  "exists" :
+                 cache->withinLimits(name) ?
+                 "is created when used repeatedly" :
+                 "is not created (table size outside the limits)") << endl;
+        }
+      }
+    }
+    rep->showProfile (os, 11);
+  }
+  vector<TableExprNodeRep*> aggrNodes;
+  Int groupAggrUsed = testGroupAggr (aggrNodes);
+  if (groupAggrUsed != 0) {
+    os << "  GROUPBY  ";
+    if ((groupAggrUsed & ONLY_COUNTALL) != 0  &&
+        (groupAggrUsed & GROUPBY) == 0) {
+      os << "only count(*), thus the rows are not aggregated" << endl;
+    } else {
+      os << groupbyNodes_p.size() << " key(s) with "
+         << aggrNodes.size() << " aggregate function(s) using ";
+      if (groupbyNodes_p.size() == 1  &&
+          (groupbyNodes_p[0].dataType() == TpDouble  ||
+           groupbyNodes_p[0].dataType() == TpInt)) {
+        os << "a map of the single key";
+      } else {
+        os << "a map of the combined keys";
+      }
+      if (groupbyRollup_p) {
+        os << " with ROLLUP";
+      }
+      os << endl;
+      for (uInt i=0; i<groupbyNodes_p.size(); ++i) {
+        groupbyNodes_p[i].getRep()->showProfile (os, 11);
+      }
+    }
+  }
+  if (! havingNode_p.isNull()) {
+    os << "  HAVING" << endl;
+    havingNode_p.getRep()->showProfile (os, 11);
+  }
+  if (! sort_p.empty()) {
+    os << "  ORDERBY  " << sort_p.size() << " key(s)";
+    if (noDupl_p) {
+      os << " removing duplicates";
+    } else if (offset_p >= 0  &&  limit_p > 0  &&  !distinct_p) {
+      // See execute for the conditions to do a partial sort.
+      os << "; only first " << offset_p + limit_p*stride_p << " rows";
+    }
+    os << endl;
+    for (uInt i=0; i<sort_p.size(); ++i) {
+      os << "           "
+         << (getOrder(sort_p[i]) == Sort::Ascending ?
+             "ascending:" : "descending:") << endl;
+      sort_p[i].node().getRep()->showProfile (os, 13);
+    }
+  }
+  if (distinct_p) {
+    os << "  DISTINCT" << endl;
+  }
+  if (limit_p != 0  ||  offset_p != 0  ||  endrow_p != 0  ||  stride_p != 1) {
+    os << "  LIMIT    limit=" << limit_p << " offset=" << offset_p
+       << " endrow=" << endrow_p << " stride=" << stride_p;
+    // See execute for the conditions to pre-empt the WHERE.
+    if (offset_p >= 0  &&  limit_p > 0  &&  ! node_p.isNull()  &&
+        sort_p.empty()  &&  !distinct_p  &&  groupAggrUsed == 0) {
+      os << "; WHERE stops after " << offset_p + limit_p*stride_p << " rows";
+    }
+    os << endl;
+  }
+  if (commandType_p == PUPDATE) {
+    os << "  UPDATE   " << update_p.size() << " column(s):";
+    for (uInt i=0; i<update_p.size(); ++i) {
+      os << ' ' << update_p[i]->columnName();
+    }
+    os << endl;
+  } else if (commandType_p == PDELETE) {
+    os << "  DELETE   the selected rows" << endl;
+  } else if (columnNames_p.size() > 0) {
+    os << "  SELECT   " << columnNames_p.size() << " column(s):";
+    for (uInt i=0; i<columnNames_p.size(); ++i) {
+      os << ' ' << columnNames_p[i];
+    }
+    os << endl;
+  }
+  if (! resultName_p.empty()) {
+    os << "  GIVING   " << resultName_p << endl;
+  }
+  return os.str();
+}
+
+//# Show the time used by a step.
+void TableParseSelect::showTiming (const Timer& timer,
+                                   const String& prefix) const
+{
+  if (timingStream_p) {
+    timer.show (*timingStream_p, prefix);
+  } else {
+    timer.show (prefix);
+  }
+}
+
+//# Execute a TaQL command and profile its steps and WHERE clause.
+String TableParseSelect::doProfile (Bool mustSelect, Bool doTracing)
+{
+  // Get the plan first, because executing changes the object.
+  String plan = getPlan (1);
+  if (! node_p.isNull()) {
+    node_p.getRep()->setProfiling (True);
+  }
+  // Collect the timings of the steps.
+  std::ostringstream timings;
+  timingStream_p = &timings;
+  PrecTimer timer;
+  timer.start();
+  try {
+    execute (True, False, mustSelect, 0, doTracing, 1);
+  } catch (...) {
+    timingStream_p = 0;
+    throw;
+  }
+  timer.stop();
+  timingStream_p = 0;
+  std::ostringstream os;
+  os << plan << "Profile" << endl;
+  os << "  executed in " << timer.getReal() << " sec resulting in "
+     << table_p.nrow() << " rows" << endl;
+  os << timings.str();
+  if (! node_p.isNull()) {
+    os << "  WHERE    evaluated by a single thread" << endl;
+    node_p.getRep()->showProfile (os, 4);
+    node_p.getRep()->setProfiling (False);
+  }
+  return os.str();
+}
+
 void TableParseSelect::checkAggrFuncs (const TableExprNode& node)
 {
   if (! node.isNull()) {
@@ -4255,34 +4628,11 @@ TaQLResult tableCommand (const String& str,
                          String& commandType)
 {
   commandType = "error";
-  // Do the first parse step. It returns a raw parse tree
+  // Do the first parse step. It creates a raw parse tree
   // (or throws an exception).
-  Timer timer;
-  TaQLNode tree = TaQLNode::parse(str);
-  // Now process the raw tree and get the final ParseSelect object.
-  try {
-    TaQLNodeHandler treeHandler;
-    TaQLNodeResult res = treeHandler.handleTree (tree, tempTables);
-    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
-    commandType = hrval.getString();
-    TableExprNode expr = hrval.getExpr();
-    if (tree.style().doTiming()) {
-      timer.show (" Total time   ");
-    }
-    if (! expr.isNull()) {
-      return TaQLResult(expr);                 // result of CALC command
-    }
-    //# Copy the possibly selected column names.
-    if (hrval.getNames()) {
-      Vector<String> tmp(*(hrval.getNames()));
-      cols.reference (tmp);
-    } else {
-      cols.resize (0);
-    }
-    return hrval.getTable();
-  } catch (std::exception& x) {
-    throw TableParseError ("'" + str + "'\n  " + x.what());
-  }
+  TaQLPrepared command (str, tempTables);
+  // Now process the raw tree and execute it.
+  return command.execute (cols, commandType);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -51,6 +51,7 @@ class TableExprNodeSetElem;
 class TableExprNodeIndex;
 class TableColumn;
 class AipsIO;
+class Timer;
 template<class T> class Vector;
 template<class T> class ArrayColumn;
 
@@ -423,8 +424,25 @@ public:
   // Optionally the maximum nr of rows to be selected can be given.
   // It will be used as the default value for the LIMIT clause.
   // 0 = no maximum.
+  // The WHERE clause is evaluated using the given number of threads.
   void execute (Bool showTimings, Bool setInGiving,
-                Bool mustSelect, uInt maxRow, Bool doTracing=False);
+                Bool mustSelect, rownr_t maxRow, Bool doTracing=False,
+                uInt nthreads=1);
+
+  // Get the execution plan of the command (as done by EXPLAIN) without
+  // executing it. It shows the tables, how the WHERE clause is evaluated
+  // (including the rows that can be skipped using the value ranges),
+  // the GROUPBY strategy, the sort keys, limit/offset, and projection.
+  String getPlan (uInt nthreads);
+
+  // Execute the command (as done by PROFILE) while collecting the profile
+  // statistics of the WHERE clause. It returns the plan followed by
+  // the execution time, the time of each step (WHERE, GROUPBY, HAVING,
+  // ORDERBY, projection, etc.) and the statistics per node of the WHERE
+  // clause. Only the WHERE clause is profiled per node; it is evaluated
+  // by a single thread, because the statistics are not collected in a
+  // thread-safe way.
+  String doProfile (Bool mustSelect, Bool doTracing);
 
   // Execute a query in a from clause resulting in a Table.
   Table doFromQuery (Bool showTimings);
@@ -537,12 +555,13 @@ public:
   void handleAddRow (const TableExprNode& expr);
 
   // Add a table nr, name, or object to the container.
-  void addTable (Int tabnr, const String& name,
-                 const Table& table,
-                 const String& shorthand,
-                 Bool addToFromList,
-                 const vector<const Table*> tempTables,
-                 const vector<TableParseSelect*>& stack);
+  // It returns the table added.
+  Table addTable (Int tabnr, const String& name,
+                  const Table& table,
+                  const String& shorthand,
+                  Bool addToFromList,
+                  const vector<const Table*> tempTables,
+                  const vector<TableParseSelect*>& stack);
 
   // Make a Table object for given name, seqnr or so.
   // If <src>alwaysOpen=False</src> the table will only be looked up,
@@ -558,6 +577,37 @@ public:
   // Replace the first table (used by CALC command).
   void replaceTable (const Table& table);
 
+  // Start handling the JOIN of the table last added to the FROM list.
+  // It returns the shorthand of the table, which must have been given
+  // because the columns of the joined table can only be used that way.
+  const String& startJoin() const;
+
+  // Start and end handling a key expression in the condition of a JOIN.
+  // While handling it, it is registered which tables are used.
+  // <src>endJoinKey</src> returns 0 if no table is used, 1 if only the
+  // joined table is used, 2 if only other tables, and 3 if both are used.
+  // <group>
+  void startJoinKey();
+  Int endJoinKey();
+  // </group>
+
+  // Join the table last added to the FROM list with the main table
+  // using the key expressions of both tables (see
+  // <linkto class=TableParseJoin>TableParseJoin</linkto>).
+  // A null join key means the row number in the joined table.
+  // <br>The main table and the tables joined before are replaced by
+  // a selection of the rows having a match, while the joined table is
+  // replaced by a selection of its matching rows. In this way all these
+  // tables have the same number of rows with matching rows at the same
+  // position, as needed to use their columns in the other clauses.
+  // <br>In a left join the main rows without a match are kept. An extra
+  // row holding default values is used for them. It is held in a memory
+  // table of one row, which is concatenated to the joined table.
+  // <br>No data are copied; in case a main row matches multiple rows, it
+  // occurs multiple times in the selection of the main table.
+  void handleJoin (Bool leftJoin, const vector<TableExprNode>& mainKeys,
+                   const vector<TableExprNode>& joinKeys);
+
   // Find the keyword or column name and create a TableExprNode from it.
   // If <src>tryProj=True</src> it is first tried if the column is a coluymn
   // in the projected table (i.e., result from the SELECT part).
@@ -654,7 +704,7 @@ private:
   // Rows 0,1,2,.. in UpdTable are updated from the expression result
   // for the rows in the given rownrs vector.
   void doUpdate (Bool showTimings, const Table& origTable,
-                 Table& updTable, const Vector<uInt>& rownrs,
+                 Table& updTable, const Vector<rownr_t>& rownrs,
                  const CountedPtr<TableExprGroupResult>& groups =
                  CountedPtr<TableExprGroupResult>());
 
@@ -701,6 +751,12 @@ private:
   // It returns the Table containing the subset of rows in the input Table.
   Table adjustApplySelNodes (const Table&);
 
+  // Do the WHERE selection if a join resulted in a main table containing
+  // rows multiple times. The selected rows cannot be derived from the
+  // resulting reference table, so their positions are kept in rownrs_p.
+  // At most nrmax rows are selected (0 means all).
+  Table doWhereJoin (const Table&, rownr_t nrmax);
+
   // Do the groupby/aggregate step and return its result.
   CountedPtr<TableExprGroupResult> doGroupby
   (bool showTimings, const std::vector<TableExprNodeRep*> aggrNodes,
@@ -718,7 +774,9 @@ private:
   (const std::vector<TableExprNodeRep*>& aggrNodes);
 
   // Do the sort step.
-  void doSort (Bool showTimings);
+  // If <src>nrtop</src> is positive, only the first <src>nrtop</src> rows
+  // in the sort order are determined (for ORDERBY with a LIMIT).
+  void doSort (Bool showTimings, rownr_t nrtop = 0);
 
   // Do the limit/offset step.
   void  doLimOff (Bool showTimings);
@@ -730,31 +788,35 @@ private:
   // Finish the table (rename, copy, and/or flush).
   Table doFinish (Bool showTimings, Table& table);
 
+  // Show the time used by a step on cout or, while profiling, add it
+  // to the profile output.
+  void showTiming (const Timer& timer, const String& prefix) const;
+
   // Update the values in the columns (helpers of doUpdate).
   // <group>
   template<typename TCOL, typename TNODE>
-  void updateValue (uInt row, const TableExprId& rowid,
+  void updateValue (rownr_t row, const TableExprId& rowid,
                     Bool isScalarCol, const TableExprNode& node,
                     const Array<Bool>& mask, Bool maskFirst,
                     TableColumn& col, const Slicer* slicerPtr,
                     ArrayColumn<Bool>& maskCol);
   template<typename TCOL, typename TNODE>
-  void updateScalar (uInt row, const TableExprId& rowid,
+  void updateScalar (rownr_t row, const TableExprId& rowid,
                      const TableExprNode& node,
                      TableColumn& col);
   template<typename TCOL, typename TNODE>
-  void updateArray (uInt row, const TableExprId& rowid,
+  void updateArray (rownr_t row, const TableExprId& rowid,
                     const TableExprNode& node,
                     const Array<TNODE>& res,
                     ArrayColumn<TCOL>& col);
   template<typename TCOL, typename TNODE>
-  void updateSlice (uInt row, const TableExprId& rowid,
+  void updateSlice (rownr_t row, const TableExprId& rowid,
                     const TableExprNode& node,
                     const Array<TNODE>& res,
                     const Slicer& slice,
                     ArrayColumn<TCOL>& col);
   template<typename TCOL, typename TNODE>
-  void copyMaskedValue (uInt row, ArrayColumn<TCOL>& acol,
+  void copyMaskedValue (rownr_t row, ArrayColumn<TCOL>& acol,
                         const Slicer* slicerPtr,
                         const TNODE* val,
                         uInt incr, const Array<Bool>& mask);
@@ -943,13 +1005,27 @@ private:
   //# All other tables used for them should have the same size.
   Table  firstColTable_p;
   String firstColName_p;
+  //# The indices in fromTables_p of the joined tables.
+  vector<uInt> joinedTables_p;
+  //# The description of the joins (for EXPLAIN).
+  vector<String> joinInfo_p;
+  //# Does the main table contain rows multiple times due to a join?
+  Bool   joinDuplicates_p;
+  //# The stream collecting the timings of the steps while profiling.
+  std::ostream* timingStream_p;
+  //# The tables used in a join key expression (-1 = not handling a key).
+  //# The first table and applySelNodes_p size are saved while handling it.
+  Int    joinKeyUse_p;
+  Table  joinSavedTable_p;
+  String joinSavedName_p;
+  size_t joinSavedNApply_p;
   //# The table resulting from a projection with expressions.
   Table projectExprTable_p;
   //# The projected columns used in the HAVING and ORDERBY clauses.
   Block<uInt>  projectExprSubset_p;
   Block<Bool>  projectExprSelColumn_p;
   //# The resulting row numbers.
-  Vector<uInt> rownrs_p;
+  Vector<rownr_t> rownrs_p;
 };
 
 
@@ -0,0 +1,281 @@
+//# TableParseJoin.cc: Find the matching rows of a TaQL join
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/TableParseJoin.h>
+#include <casacore/tables/TaQL/ExprNodeRep.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# The number of rows for which the keys are evaluated at once.
+static const uInt theirJoinBatchSize = 4096;
+
+TableParseJoin::TableParseJoin (const std::vector<TableExprNode>& mainKeys,
+                                const std::vector<TableExprNode>& joinKeys,
+                                rownr_t mainNrow, rownr_t joinNrow)
+  : itsMainKeys   (mainKeys),
+    itsJoinKeys   (joinKeys),
+    itsMainNrow   (mainNrow),
+    itsJoinNrow   (joinNrow),
+    itsByRownr    (False),
+    itsHashedMain (False)
+{
+  AlwaysAssert (mainKeys.size() == joinKeys.size()  &&  !mainKeys.empty(),
+                AipsError);
+  itsTypes.reserve (mainKeys.size());
+  for (uInt i=0; i<mainKeys.size(); ++i) {
+    // A null join key means the row number of the joined table.
+    TableExprNodeRep::NodeDataType dtm = mainKeys[i].getNodeRep()->dataType();
+    TableExprNodeRep::NodeDataType dtj = TableExprNodeRep::NTInt;
+    if (! joinKeys[i].isNull()) {
+      dtj = joinKeys[i].getNodeRep()->dataType();
+      if (! joinKeys[i].isScalar()) {
+        throw TableInvExpr ("JOIN key expressions must be scalars");
+      }
+    }
+    if (! mainKeys[i].isScalar()) {
+      throw TableInvExpr ("JOIN key expressions must be scalars");
+    }
+    if (dtm == TableExprNodeRep::NTString  &&
+        dtj == TableExprNodeRep::NTString) {
+      itsTypes.push_back (StringKey);
+    } else if (dtm == TableExprNodeRep::NTBool  &&
+               dtj == TableExprNodeRep::NTBool) {
+      itsTypes.push_back (BoolKey);
+    } else if (dtm == TableExprNodeRep::NTInt  &&
+               dtj == TableExprNodeRep::NTInt) {
+      itsTypes.push_back (IntKey);
+    } else if ((dtm == TableExprNodeRep::NTInt  ||
+                dtm == TableExprNodeRep::NTDouble)  &&
+               (dtj == TableExprNodeRep::NTInt  ||
+                dtj == TableExprNodeRep::NTDouble)) {
+      itsTypes.push_back (DoubleKey);
+    } else {
+      throw TableInvExpr ("JOIN key expressions must have matching "
+                          "data types (bool, numeric, or string)");
+    }
+  }
+  itsByRownr = (joinKeys.size() == 1  &&  joinKeys[0].isNull()  &&
+                itsTypes[0] == IntKey);
+}
+
+rownr_t TableParseJoin::findRows (Bool leftJoin,
+                                  Vector<rownr_t>& mainRows,
+                                  Vector<rownr_t>& joinRows)
+{
+  std::vector<rownr_t> mrows;
+  std::vector<rownr_t> jrows;
+  rownr_t nunmatched = 0;
+  if (itsByRownr) {
+    findRowsByRownr (leftJoin, mrows, jrows, nunmatched);
+  } else {
+    findRowsByHash (leftJoin, mrows, jrows, nunmatched);
+  }
+  mainRows.resize (mrows.size());
+  std::copy (mrows.begin(), mrows.end(), mainRows.begin());
+  joinRows.resize (jrows.size());
+  std::copy (jrows.begin(), jrows.end(), joinRows.begin());
+  return nunmatched;
+}
+
+void TableParseJoin::findRowsByRownr (Bool leftJoin,
+                                      std::vector<rownr_t>& mainRows,
+                                      std::vector<rownr_t>& joinRows,
+                                      rownr_t& nunmatched)
+{
+  mainRows.reserve (itsMainNrow);
+  joinRows.reserve (itsMainNrow);
+  std::vector<Int64> vals(theirJoinBatchSize);
+  for (rownr_t row=0; row<itsMainNrow; row+=theirJoinBatchSize) {
+    uInt nrow = std::min (rownr_t(theirJoinBatchSize), itsMainNrow - row);
+    itsMainKeys[0].getRep()->getIntBatch (row, nrow, vals.data(), 0);
+    for (uInt i=0; i<nrow; ++i) {
+      if (vals[i] >= 0  &&  rownr_t(vals[i]) < itsJoinNrow) {
+        mainRows.push_back (row+i);
+        joinRows.push_back (vals[i]);
+      } else if (leftJoin) {
+        mainRows.push_back (row+i);
+        joinRows.push_back (itsJoinNrow);
+        nunmatched++;
+      }
+    }
+  }
+}
+
+void TableParseJoin::findRowsByHash (Bool leftJoin,
+                                     std::vector<rownr_t>& mainRows,
+                                     std::vector<rownr_t>& joinRows,
+                                     rownr_t& nunmatched)
+{
+  // Build the hash table for the table with the fewest rows.
+  itsHashedMain = itsMainNrow < itsJoinNrow;
+  const std::vector<TableExprNode>& buildKeys =
+    (itsHashedMain ? itsMainKeys : itsJoinKeys);
+  const std::vector<TableExprNode>& probeKeys =
+    (itsHashedMain ? itsJoinKeys : itsMainKeys);
+  rownr_t buildNrow = (itsHashedMain ? itsMainNrow : itsJoinNrow);
+  rownr_t probeNrow = (itsHashedMain ? itsJoinNrow : itsMainNrow);
+  typedef std::unordered_map<std::string, std::vector<rownr_t> > KeyMap;
+  KeyMap keyMap;
+  std::vector<std::string> keys;
+  std::vector<Bool> undefined;
+  for (rownr_t row=0; row<buildNrow; row+=theirJoinBatchSize) {
+    uInt nrow = std::min (rownr_t(theirJoinBatchSize), buildNrow - row);
+    getKeys (buildKeys, row, nrow, keys, undefined);
+    for (uInt i=0; i<nrow; ++i) {
+      if (! undefined[i]) {
+        keyMap[keys[i]].push_back (row+i);
+      }
+    }
+  }
+  // Look up the keys of the other table.
+  std::vector<std::pair<rownr_t,rownr_t> > pairs;
+  std::vector<Bool> matched;
+  if (itsHashedMain  &&  leftJoin) {
+    matched.resize (itsMainNrow, False);
+  }
+  for (rownr_t row=0; row<probeNrow; row+=theirJoinBatchSize) {
+    uInt nrow = std::min (rownr_t(theirJoinBatchSize), probeNrow - row);
+    getKeys (probeKeys, row, nrow, keys, undefined);
+    for (uInt i=0; i<nrow; ++i) {
+      KeyMap::const_iterator iter = keyMap.end();
+      if (! undefined[i]) {
+        iter = keyMap.find (keys[i]);
+      }
+      if (iter != keyMap.end()) {
+        const std::vector<rownr_t>& rows = iter->second;
+        for (std::vector<rownr_t>::const_iterator riter = rows.begin();
+             riter != rows.end(); ++riter) {
+          if (itsHashedMain) {
+            pairs.push_back (std::make_pair (*riter, row+i));
+            if (leftJoin) {
+              matched[*riter] = True;
+            }
+          } else {
+            pairs.push_back (std::make_pair (row+i, *riter));
+          }
+        }
+      } else if (leftJoin  &&  !itsHashedMain) {
+        pairs.push_back (std::make_pair (row+i, itsJoinNrow));
+        nunmatched++;
+      }
+    }
+  }
+  if (itsHashedMain) {
+    // The pairs were found in order of joined row, so sort them in
+    // order of main row. Add the main rows without a match first.
+    for (rownr_t row=0; row<matched.size(); ++row) {
+      if (! matched[row]) {
+        pairs.push_back (std::make_pair (row, itsJoinNrow));
+        nunmatched++;
+      }
+    }
+    std::sort (pairs.begin(), pairs.end());
+  }
+  mainRows.resize (pairs.size());
+  joinRows.resize (pairs.size());
+  for (size_t i=0; i<pairs.size(); ++i) {
+    mainRows[i] = pairs[i].first;
+    joinRows[i] = pairs[i].second;
+  }
+}
+
+void TableParseJoin::getKeys (const std::vector<TableExprNode>& nodes,
+                              rownr_t startRow, uInt nrow,
+                              std::vector<std::string>& keys,
+                              std::vector<Bool>& undefined)
+{
+  keys.assign (nrow, std::string());
+  undefined.assign (nrow, False);
+  for (uInt k=0; k<nodes.size(); ++k) {
+    const TableExprNode& node = nodes[k];
+    switch (itsTypes[k]) {
+    case BoolKey:
+      {
+        Block<Bool> vals(nrow);
+        node.getRep()->getBoolBatch (startRow, nrow, vals.storage(), 0);
+        for (uInt i=0; i<nrow; ++i) {
+          keys[i].push_back (vals[i] ? '1' : '0');
+        }
+      }
+      break;
+    case IntKey:
+      {
+        std::vector<Int64> vals(nrow);
+        if (node.isNull()) {
+          for (uInt i=0; i<nrow; ++i) {
+            vals[i] = startRow + i;
+          }
+        } else {
+          node.getRep()->getIntBatch (startRow, nrow, vals.data(), 0);
+        }
+        for (uInt i=0; i<nrow; ++i) {
+          keys[i].append (reinterpret_cast<const char*>(&vals[i]),
+                          sizeof(Int64));
+        }
+      }
+      break;
+    case DoubleKey:
+      {
+        std::vector<Double> vals(nrow);
+        if (node.isNull()) {
+          for (uInt i=0; i<nrow; ++i) {
+            vals[i] = startRow + i;
+          }
+        } else {
+          node.getRep()->getDoubleBatch (startRow, nrow, vals.data(), 0);
+        }
+        for (uInt i=0; i<nrow; ++i) {
+          if (isNaN (vals[i])) {
+            undefined[i] = True;
+          } else if (vals[i] == 0) {
+            vals[i] = 0;            // -0 and 0 must give the same key
+          }
+          keys[i].append (reinterpret_cast<const char*>(&vals[i]),
+                          sizeof(Double));
+        }
+      }
+      break;
+    case StringKey:
+      for (uInt i=0; i<nrow; ++i) {
+        String val = node.getString (startRow + i);
+        // Prefix the length to make keys of multiple strings unique.
+        uInt len = val.size();
+        keys[i].append (reinterpret_cast<const char*>(&len), sizeof(uInt));
+        keys[i].append (val);
+      }
+      break;
+    }
+  }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,161 @@
+//# TableParseJoin.h: Find the matching rows of a TaQL join
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TABLEPARSEJOIN_H
+#define TABLES_TABLEPARSEJOIN_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <string>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Find the matching rows of a TaQL join
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTableParseJoin.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TableParseSelect>TableParseSelect</linkto>
+//   <li> <linkto class=TableExprNode>TableExprNode</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TableParseJoin finds the pairs of matching rows of the main table and
+// the table being joined for a JOIN clause in a TaQL SELECT command like
+// <srcblock>
+//   select ANTENNA1, a1.NAME from my.ms join ::ANTENNA a1 on ANTENNA1=a1.rowid()
+//   select FIELD_ID, f.CODE from my.ms left join other.tab f on FIELD_ID=f.ID
+// </srcblock>
+// The condition of the join must be one or more equalities combined with
+// AND, where one side of each equality only uses the joined table and the
+// other side the other tables. Each such pair of expressions is a key of
+// the join. The key expressions of each side are given to this class.
+// <br>A key of the joined table can also be a null TableExprNode, which
+// means that the row number in the joined table is the key
+// (given as <src>a1.rowid()</src> above).
+// <p>
+// The keys can be integer, real, bool, or string scalars. An integer and
+// a real key are compared as reals. A real key containing a NaN never
+// matches.
+// <p>
+// A join on a single row number key does not need a hash table; the value
+// of the main key is directly used as the row number in the joined table.
+// Otherwise it is done as a hash join. The key values of the table having
+// the fewest rows (usually the joined subtable) are stored once in a hash
+// table, after which the key values of the other table are evaluated in
+// batches of rows and looked up in the hash table.
+// <p>
+// The result are two vectors containing the row numbers of the matching
+// pairs in ascending order of main row. If a main row matches multiple
+// rows in the joined table, it appears multiple times (in ascending order
+// of the joined rows). In an inner join main rows without a match are
+// left out, while in a left join they are paired with a row number equal
+// to the number of rows in the joined table (thus a row beyond the end).
+// </synopsis>
+
+// <motivation>
+// Joining the main table of a MeasurementSet with a subtable like FIELD
+// using a subquery per row is slow. Building a hash table once is much
+// faster and makes the join expressible in a single query.
+// </motivation>
+
+class TableParseJoin
+{
+public:
+    // Construct from the key expressions of the main table and of the
+    // joined table. Both must have the same number of keys.
+    // It checks if the data types of the keys match.
+    TableParseJoin (const std::vector<TableExprNode>& mainKeys,
+                    const std::vector<TableExprNode>& joinKeys,
+                    rownr_t mainNrow, rownr_t joinNrow);
+
+    // Find the pairs of matching rows (see synopsis).
+    // It returns the number of main rows without a match.
+    rownr_t findRows (Bool leftJoin,
+                      Vector<rownr_t>& mainRows, Vector<rownr_t>& joinRows);
+
+    // Is the join done directly on the row numbers of the joined table?
+    Bool byRownr() const
+      { return itsByRownr; }
+
+    // Get the number of keys.
+    uInt nkeys() const
+      { return itsTypes.size(); }
+
+    // Tell if the hash table was built for the main table (because it
+    // has fewer rows than the joined table). It is only valid after
+    // findRows has been called.
+    Bool hashedMain() const
+      { return itsHashedMain; }
+
+private:
+    // The data type of a key.
+    enum KeyType {BoolKey, IntKey, DoubleKey, StringKey};
+
+    // Get the key values of the given rows as strings to be used in
+    // the hash table. A flag is set if a key is undefined (NaN).
+    void getKeys (const std::vector<TableExprNode>& nodes,
+                  rownr_t startRow, uInt nrow,
+                  std::vector<std::string>& keys,
+                  std::vector<Bool>& undefined);
+
+    // Find the rows for a join on a single row number key.
+    void findRowsByRownr (Bool leftJoin,
+                          std::vector<rownr_t>& mainRows,
+                          std::vector<rownr_t>& joinRows,
+                          rownr_t& nunmatched);
+
+    // Find the rows using a hash table.
+    void findRowsByHash (Bool leftJoin,
+                         std::vector<rownr_t>& mainRows,
+                         std::vector<rownr_t>& joinRows,
+                         rownr_t& nunmatched);
+
+    //# Data members.
+    std::vector<TableExprNode> itsMainKeys;
+    std::vector<TableExprNode> itsJoinKeys;
+    std::vector<KeyType>       itsTypes;
+    rownr_t                    itsMainNrow;
+    rownr_t                    itsJoinNrow;
+    Bool                       itsByRownr;
+    Bool                       itsHashedMain;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
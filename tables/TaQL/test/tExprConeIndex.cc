@@ -0,0 +1,252 @@
+//# tExprConeIndex.cc: Test program for the index used in cone searches
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprConeNode.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/Constants.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <limits>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the declination zone index used in cone searches.
+// The cones are given as constants (using the index) and as a column
+// (not using the index); both must give the same results.
+// </summary>
+
+// Use a simple random generator to get the same numbers on all systems.
+uInt seed = 1;
+Double uniform (Double st, Double end)
+{
+  seed = seed * 1103515245 + 12345;
+  return st + (end-st) * ((seed / 65536) % 32768) / 32768.;
+}
+
+const uInt ncone = 200;
+const uInt nsrc  = 4;
+const uInt nrow  = 1000;
+
+void makeTable (Matrix<Double>& cones, Matrix<Double>& conePos,
+                Vector<Double>& radii)
+{
+  // Cones with small radii, some in the other hemisphere or beyond the pole.
+  for (uInt i=0; i<ncone; ++i) {
+    cones(0,i) = uniform (-C::_2pi, C::_2pi);
+    cones(1,i) = uniform (-2, 2);
+    cones(2,i) = uniform (-0.1, 0.1);
+    conePos(0,i) = cones(0,i);
+    conePos(1,i) = cones(1,i);
+  }
+  // A few special radii: one covering most of the sky and an undefined one.
+  cones(2,10) = 3.5;
+  cones(2,20) = 0.;
+  cones(2,30) = std::numeric_limits<Double>::quiet_NaN();
+  radii(0) = 0.01;
+  radii(1) = -0.05;
+  radii(2) = 0.03;
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Double> ("SRC", IPosition(1,2),
+                                         ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Double> ("SRCS", IPosition(2,2,nsrc),
+                                         ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Double> ("CONES", IPosition(2,3,ncone),
+                                         ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Double> ("CONEPOS", IPosition(2,2,ncone),
+                                         ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Double> ("RADII", IPosition(1,3),
+                                         ColumnDesc::FixedShape));
+  SetupNewTable newtab("tExprConeIndex_tmp.tab", td, Table::New);
+  Table tab(newtab, nrow);
+  ArrayColumn<Double> srcCol (tab, "SRC");
+  ArrayColumn<Double> srcsCol (tab, "SRCS");
+  ArrayColumn<Double> conesCol (tab, "CONES");
+  ArrayColumn<Double> conePosCol (tab, "CONEPOS");
+  ArrayColumn<Double> radiiCol (tab, "RADII");
+  Vector<Double> src(2);
+  Matrix<Double> srcs(2, nsrc);
+  for (uInt i=0; i<nrow; ++i) {
+    // Put about half of the sources near a cone.
+    uInt cone = i%ncone;
+    if (i%2 == 0) {
+      src(0) = cones(0,cone) + uniform (-0.1, 0.1);
+      src(1) = cones(1,cone) + uniform (-0.1, 0.1);
+    } else {
+      src(0) = uniform (-C::_2pi, C::_2pi);
+      src(1) = uniform (-2, 2);
+    }
+    srcCol.put (i, src);
+    for (uInt j=0; j<nsrc; ++j) {
+      srcs(0,j) = cones(0,(cone+j)%ncone) + uniform (-0.1, 0.1);
+      srcs(1,j) = cones(1,(cone+j)%ncone) + uniform (-0.1, 0.1);
+    }
+    srcsCol.put (i, srcs);
+    conesCol.put (i, cones);
+    conePosCol.put (i, conePos);
+    radiiCol.put (i, radii);
+  }
+}
+
+void testCones (const Table& tab, const Matrix<Double>& cones)
+{
+  TableExprNode src (tab.col("SRC"));
+  TableExprNode srcs (tab.col("SRCS"));
+  TableExprNode cnst (cones);
+  TableExprNode col (tab.col("CONES"));
+  TableExprNode any1 = anyCone(src, cnst);
+  TableExprNode any2 = anyCone(src, col);
+  TableExprNode find1 = findCone(src, cnst);
+  TableExprNode find2 = findCone(src, col);
+  TableExprNode finds1 = findCone(srcs, cnst);
+  TableExprNode finds2 = findCone(srcs, col);
+  TableExprNode cones1 = casacore::cones(srcs, cnst);
+  TableExprNode cones2 = casacore::cones(srcs, col);
+  uInt nany = 0;
+  uInt nfind = 0;
+  uInt ncones = 0;
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    Bool b1, b2;
+    Int64 i1, i2;
+    any1.get (i, b1);
+    any2.get (i, b2);
+    AlwaysAssertExit (b1 == b2);
+    if (b1) nany++;
+    find1.get (i, i1);
+    find2.get (i, i2);
+    AlwaysAssertExit (i1 == i2);
+    AlwaysAssertExit (b1 == (i1 >= 0));
+    Array<Int64> f1, f2;
+    finds1.get (i, f1);
+    finds2.get (i, f2);
+    AlwaysAssertExit (allEQ (f1, f2));
+    nfind += ntrue (f1 >= Int64(0));
+    Array<Bool> c1, c2;
+    cones1.get (i, c1);
+    cones2.get (i, c2);
+    AlwaysAssertExit (allEQ (c1, c2));
+    ncones += ntrue (c1);
+  }
+  cout << "cones:  " << nany << " anycone, " << nfind << " findcone, "
+       << ncones << " in cones" << endl;
+}
+
+void testCones3 (const Table& tab, const Matrix<Double>& conePos,
+                 const Vector<Double>& radii)
+{
+  TableExprNode src (tab.col("SRC"));
+  TableExprNode srcs (tab.col("SRCS"));
+  TableExprNode cnst (conePos);
+  TableExprNode col (tab.col("CONEPOS"));
+  TableExprNode rad1 (radii);
+  TableExprNode rad2 (tab.col("RADII"));
+  // Also use a single radius.
+  TableExprNode any1 = anyCone(src, cnst, rad1);
+  TableExprNode any2 = anyCone(src, col, rad2);
+  TableExprNode anys1 = anyCone(src, cnst, 0.02);
+  TableExprNode anys2 = anyCone(src, col, 0.02);
+  TableExprNode finds1 = findCone(srcs, cnst, rad1);
+  TableExprNode finds2 = findCone(srcs, col, rad2);
+  TableExprNode cones1 = casacore::cones(srcs, cnst, rad1);
+  TableExprNode cones2 = casacore::cones(srcs, col, rad2);
+  uInt nany = 0;
+  uInt nanys = 0;
+  uInt nfind = 0;
+  uInt ncones = 0;
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    Bool b1, b2;
+    any1.get (i, b1);
+    any2.get (i, b2);
+    AlwaysAssertExit (b1 == b2);
+    if (b1) nany++;
+    anys1.get (i, b1);
+    anys2.get (i, b2);
+    AlwaysAssertExit (b1 == b2);
+    if (b1) nanys++;
+    Array<Int64> f1, f2;
+    finds1.get (i, f1);
+    finds2.get (i, f2);
+    AlwaysAssertExit (allEQ (f1, f2));
+    nfind += ntrue (f1 >= Int64(0));
+    Array<Bool> c1, c2;
+    cones1.get (i, c1);
+    cones2.get (i, c2);
+    AlwaysAssertExit (allEQ (c1, c2));
+    ncones += ntrue (c1);
+  }
+  cout << "cones3: " << nany << " anycone, " << nanys << " anycone1, "
+       << nfind << " findcone, " << ncones << " in cones" << endl;
+}
+
+void testIndex (const Matrix<Double>& cones)
+{
+  // Test the candidates directly.
+  TableExprConeIndex index (cones, Array<Double>());
+  AlwaysAssertExit
+    (index.candidates(std::numeric_limits<Double>::quiet_NaN()).empty());
+  // The cone covering most of the sky must be a candidate everywhere
+  // and the cone with undefined radius nowhere.
+  for (Double dec=-3; dec<=3; dec+=0.01) {
+    const std::vector<uInt>& cand = index.candidates (dec);
+    Bool found10 = False;
+    for (uInt i=0; i<cand.size(); ++i) {
+      AlwaysAssertExit (cand[i] != 30);
+      AlwaysAssertExit (i == 0  ||  cand[i] > cand[i-1]);
+      if (cand[i] == 10) found10 = True;
+    }
+    AlwaysAssertExit (found10);
+  }
+  cout << "index: " << index.candidates(0.).size() << " candidates at dec=0"
+       << endl;
+}
+
+int main()
+{
+  try {
+    Matrix<Double> cones(3, ncone);
+    Matrix<Double> conePos(2, ncone);
+    Vector<Double> radii(3);
+    makeTable (cones, conePos, radii);
+    Table tab("tExprConeIndex_tmp.tab");
+    testCones (tab, cones);
+    testCones3 (tab, conePos, radii);
+    testIndex (cones);
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,289 @@
+//# tExprNodeBatch.cc: Test program for batch evaluation of expressions
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/TaQLStyle.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the batch evaluation of expressions, which must give
+// the same results as the evaluation row by row (also in parallel).
+// It also tests the profiling of the batch evaluation.
+// </summary>
+
+void makeTable (const String& name, uInt nrow)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ival"));
+  td.addColumn (ScalarColumnDesc<Short> ("shval"));
+  td.addColumn (ScalarColumnDesc<Float> ("fval"));
+  td.addColumn (ScalarColumnDesc<Double> ("dval"));
+  td.addColumn (ScalarColumnDesc<Bool> ("bval"));
+  td.addColumn (ScalarColumnDesc<String> ("sval"));
+  SetupNewTable newtab(name, td, Table::New);
+  Table table(newtab, nrow);
+  ScalarColumn<Int> icol (table, "ival");
+  ScalarColumn<Short> shcol (table, "shval");
+  ScalarColumn<Float> fcol (table, "fval");
+  ScalarColumn<Double> dcol (table, "dval");
+  ScalarColumn<Bool> bcol (table, "bval");
+  ScalarColumn<String> scol (table, "sval");
+  dcol.rwKeywordSet().define ("UNIT", "deg");
+  for (uInt i=0; i<nrow; ++i) {
+    icol.put (i, (i*7) % 100);
+    shcol.put (i, i%13 - 6);
+    fcol.put (i, i*0.25);
+    dcol.put (i, i%360);
+    bcol.put (i, i%3 == 0);
+    scol.put (i, String::toString(i%10));
+  }
+}
+
+// Check if the batch result of a Bool expression matches the row result
+// for all rows and for the rows in a mask.
+void checkBool (const String& str, const TableExprNode& expr,
+                rownr_t startRow, uInt nrow)
+{
+  Block<Bool> vals(nrow, False);
+  Block<Bool> mask(nrow, False);
+  for (uInt i=0; i<nrow; i+=3) {
+    mask[i] = True;
+  }
+  expr.getRep()->getBoolBatch (startRow, nrow, vals.storage(), 0);
+  Block<Bool> mvals(nrow, False);
+  expr.getRep()->getBoolBatch (startRow, nrow, mvals.storage(),
+                               mask.storage());
+  uInt ntrue = 0;
+  for (uInt i=0; i<nrow; ++i) {
+    Bool val = expr.getBool (startRow+i);
+    AlwaysAssertExit (vals[i] == val);
+    if (mask[i]) {
+      AlwaysAssertExit (mvals[i] == val);
+    }
+    if (val) ntrue++;
+  }
+  cout << str << ": " << ntrue << " of " << nrow << " true" << endl;
+}
+
+// Check if the batch result of a numeric expression matches the row result.
+void checkDouble (const String& str, const TableExprNode& expr,
+                  rownr_t startRow, uInt nrow)
+{
+  std::vector<Double> vals(nrow);
+  expr.getRep()->getDoubleBatch (startRow, nrow, vals.data(), 0);
+  Double sum = 0;
+  for (uInt i=0; i<nrow; ++i) {
+    Double val = expr.getDouble (startRow+i);
+    AlwaysAssertExit (vals[i] == val);
+    sum += val;
+  }
+  cout << str << ": sum " << sum << endl;
+}
+
+void checkInt (const String& str, const TableExprNode& expr,
+               rownr_t startRow, uInt nrow)
+{
+  std::vector<Int64> vals(nrow);
+  expr.getRep()->getIntBatch (startRow, nrow, vals.data(), 0);
+  Int64 sum = 0;
+  for (uInt i=0; i<nrow; ++i) {
+    Int64 val = expr.getInt (startRow+i);
+    AlwaysAssertExit (vals[i] == val);
+    sum += val;
+  }
+  cout << str << ": sum " << sum << endl;
+}
+
+// Check if the selection gives the same rows as the row evaluation.
+void checkSelect (const String& str, const Table& table,
+                  const TableExprNode& expr, rownr_t maxRow = 0,
+                  rownr_t offset = 0, uInt nthreads = 1)
+{
+  Table sel = table(expr, maxRow, offset, nthreads);
+  Vector<rownr_t> rows = sel.rowNumbers (table);
+  uInt nr = 0;
+  for (rownr_t i=0; i<table.nrow()  &&  nr<rows.size(); ++i) {
+    if (expr.getBool(i)) {
+      if (offset > 0) {
+        offset--;
+      } else {
+        AlwaysAssertExit (rows[nr] == i);
+        nr++;
+      }
+    }
+  }
+  AlwaysAssertExit (nr == rows.size());
+  cout << str << ": selected " << rows.size() << " rows" << endl;
+}
+
+void doIt (const String& name)
+{
+  Table table(name);
+  TableExprNode ival = table.col("ival");
+  TableExprNode shval = table.col("shval");
+  TableExprNode fval = table.col("fval");
+  TableExprNode dval = table.col("dval");
+  TableExprNode bval = table.col("bval");
+  TableExprNode sval = table.col("sval");
+  checkInt ("ival+shval*2-1", ival + shval*2 - 1, 0, 10000);
+  checkDouble ("ival+shval*2-1", ival + shval*2 - 1, 0, 10000);
+  checkDouble ("fval/2+dval", fval/2 + dval, 100, 5000);
+  checkDouble ("sin(dval)", sin(dval), 0, 10000);
+  checkDouble ("sqrt(abs(shval))", sqrt(abs(shval)), 0, 10000);
+  checkDouble ("square(fval-dval)", square(fval-dval), 10, 9990);
+  checkBool ("ival>50", ival > 50, 0, 10000);
+  checkBool ("ival<=shval+40", ival <= shval+40, 5, 4000);
+  checkBool ("dval==fval", dval == fval, 0, 10000);
+  checkBool ("ival!=21", ival != 21, 0, 10000);
+  checkBool ("bval", bval, 0, 10000);
+  checkBool ("!bval||fval>1000", !bval || fval > 1000, 0, 10000);
+  checkBool ("bval&&dval>=1rad", bval && dval >= TableExprNode(1.).useUnit("rad"),
+             0, 10000);
+  // A string comparison is evaluated row by row.
+  checkBool ("sval=='3'&&ival<20", sval == "3" && ival < 20, 0, 10000);
+  checkSelect ("ival>50&&!bval", table, ival > 50 && !bval);
+  checkSelect ("sval=='3'||dval<10", table, sval == "3" || dval < 10);
+  checkSelect ("ival<10 limit 25", table, ival < 10, 25);
+  checkSelect ("cos(dval)>0.99", table, cos(dval) > 0.99);
+  // A selection on a selection.
+  Table sel = table(ival > 50);
+  checkSelect ("ival>50 -> shval>0", sel, sel.col("shval") > 0);
+  // Selections using multiple threads.
+  checkSelect ("ival>50&&!bval threads=4", table, ival > 50 && !bval,
+               0, 0, 4);
+  checkSelect ("sval=='3'||dval<10 threads=4", table,
+               sval == "3" || dval < 10, 0, 0, 4);
+  checkSelect ("ival<10 limit 25 offset 10 threads=3", table,
+               ival < 10, 25, 10, 3);
+  checkSelect ("ival>50 -> shval>0 threads=2", sel, sel.col("shval") > 0,
+               0, 0, 2);
+}
+
+// Test IN with a constant array, which is looked up in a hash set.
+void testIN (const Table& table)
+{
+  TableExprNode ival = table.col("ival");
+  TableExprNode fval = table.col("fval");
+  TableExprNode sval = table.col("sval");
+  Vector<Int> ivec(50);
+  indgen (ivec);
+  checkBool ("ival in [0:50)", ival.in (TableExprNode(ivec)), 0, 10000);
+  Vector<Double> dvec(3);
+  dvec[0] = 1.5;
+  dvec[1] = 2.25;
+  dvec[2] = 3;
+  checkBool ("fval in [1.5,2.25,3]", fval.in (TableExprNode(dvec)), 0, 10000);
+  // Integer values in a set of reals.
+  dvec[0] = 7;
+  dvec[1] = 14.5;
+  checkBool ("ival in [7,14.5,3]", ival.in (TableExprNode(dvec)), 0, 10000);
+  Vector<String> svec(2);
+  svec[0] = "3";
+  svec[1] = "5";
+  checkBool ("sval in ['3','5']", sval.in (TableExprNode(svec)), 0, 10000);
+  checkSelect ("ival in [0:50) && sval in ['3','5'] threads=4", table,
+               ival.in (TableExprNode(ivec)) && sval.in (TableExprNode(svec)),
+               0, 0, 4);
+  // An empty set never matches.
+  checkBool ("ival in []", ival.in (TableExprNode(Vector<Int>())), 0, 100);
+}
+
+// Show the profile statistics of a node and its children
+// (without the times which vary).
+void showProfile (const TableExprNodeRep* node, uInt indent)
+{
+  cout << String(indent, ' ') << node->description();
+  const TableExprNodeProfile* prof = node->profile();
+  AlwaysAssertExit (prof != 0);
+  AlwaysAssertExit (prof->time() >= 0);
+  cout << ": " << prof->nbatch() << ' ' << prof->nrow() << ' '
+       << prof->ntrue() << ' ' << prof->nfalse() << ' '
+       << prof->nbytes() << endl;
+  std::vector<TableExprNodeRep*> children;
+  node->getChildren (children);
+  for (uInt i=0; i<children.size(); ++i) {
+    showProfile (children[i], indent+2);
+  }
+}
+
+void testProfile (const Table& table)
+{
+  TableExprNode expr (table.col("ival") > 50  &&
+                      (table.col("sval") == "3"  ||  table.col("fval") < 100));
+  expr.getRep()->setProfiling (True);
+  Table sel = table(expr);
+  cout << "profile of selection of " << sel.nrow() << " rows" << endl;
+  showProfile (expr.getRep().get(), 2);
+  const TableExprNodeProfile* prof = expr.getRep()->profile();
+  AlwaysAssertExit (prof->ntrue() == sel.nrow());
+  // Switching it off removes the statistics.
+  expr.getRep()->setProfiling (False);
+  AlwaysAssertExit (expr.getRep()->profile() == 0);
+}
+
+void testStyle()
+{
+  TaQLStyle style;
+  cout << "nthreads " << style.nthreads();
+  style.set ("Threads = 8");
+  cout << ' ' << style.nthreads();
+  style.reset();
+  cout << ' ' << style.nthreads() << endl;
+  try {
+    style.set ("threads=x");
+  } catch (const AipsError& x) {
+    cout << x.getMesg() << endl;
+  }
+}
+
+int main()
+{
+  try {
+    makeTable ("tExprNodeBatch_tmp.data", 10000);
+    doIt ("tExprNodeBatch_tmp.data");
+    testIN (Table("tExprNodeBatch_tmp.data"));
+    testProfile (Table("tExprNodeBatch_tmp.data"));
+    testStyle();
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
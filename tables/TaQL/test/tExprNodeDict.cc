@@ -0,0 +1,263 @@
+//# tExprNodeDict.cc: Test program for dictionary encoded String columns
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Utilities/Regex.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for dictionary encoded String columns in the StandardStMan
+// and for the evaluation of TaQL comparisons using the dictionary.
+// Column MODE is dictionary encoded; column PLAIN holds the same values
+// without encoding, so results can be compared.
+// </summary>
+
+const char* modes[] = {"OBSERVE_TARGET#ON_SOURCE", "CALIBRATE_PHASE#ON_SOURCE",
+                       "CALIBRATE_BANDPASS#ON_SOURCE", "OFF", "",
+                       "CALIBRATE_POINTING#ON_SOURCE"};
+
+String modeValue (uInt row)
+{
+  return modes[(row/7 + row%3) % 6];
+}
+
+void makeTable (const String& name, uInt nrow)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ID"));
+  td.addColumn (ScalarColumnDesc<String> ("MODE"));
+  td.addColumn (ScalarColumnDesc<String> ("PLAIN"));
+  Record spec;
+  spec.define ("DICTIONARYCOLUMNS", Vector<String>(1, "MODE"));
+  spec.define ("BUCKETSIZE", 512);
+  StandardStMan stman ("SSM", spec);
+  SetupNewTable newtab(name, td, Table::New);
+  newtab.bindAll (stman);
+  Table table(newtab, nrow);
+  ScalarColumn<Int> idcol (table, "ID");
+  ScalarColumn<String> mcol (table, "MODE");
+  ScalarColumn<String> pcol (table, "PLAIN");
+  // Put the first half per row, the second half as a column range.
+  uInt nhalf = nrow/2;
+  for (uInt i=0; i<nhalf; ++i) {
+    idcol.put (i, i);
+    mcol.put (i, modeValue(i));
+    pcol.put (i, modeValue(i));
+  }
+  Vector<String> vals(nrow-nhalf);
+  for (uInt i=nhalf; i<nrow; ++i) {
+    idcol.put (i, i);
+    vals[i-nhalf] = modeValue(i);
+  }
+  mcol.putColumnRange (Slicer(IPosition(1,nhalf), IPosition(1,nrow-nhalf)),
+                       vals);
+  pcol.putColumnRange (Slicer(IPosition(1,nhalf), IPosition(1,nrow-nhalf)),
+                       vals);
+  // Overwrite a value.
+  mcol.put (3, "OFF");
+  pcol.put (3, "OFF");
+}
+
+void showDictionary (const TableColumn& col)
+{
+  Vector<String> entries;
+  AlwaysAssertExit (col.getDictionary (0, entries));
+  cout << "dictionary of " << col.columnDesc().name() << " has "
+       << entries.size() << " entries:";
+  for (uInt i=0; i<entries.size(); ++i) {
+    cout << " '" << entries[i] << "'";
+  }
+  cout << endl;
+  // Getting from the end gives no entries.
+  AlwaysAssertExit (col.getDictionary (entries.size(), entries));
+  AlwaysAssertExit (entries.empty());
+}
+
+void checkTable (const Table& table)
+{
+  ScalarColumn<String> mcol (table, "MODE");
+  ScalarColumn<String> pcol (table, "PLAIN");
+  Vector<String> mvals = mcol.getColumn();
+  AlwaysAssertExit (allEQ (mvals, pcol.getColumn()));
+  for (rownr_t i=0; i<table.nrow(); i+=11) {
+    AlwaysAssertExit (mcol(i) == pcol(i));
+  }
+  Vector<String> part = mcol.getColumnRange (Slicer(IPosition(1,5),
+                                                    IPosition(1,10)));
+  AlwaysAssertExit (allEQ (part, mvals(Slice(5,10))));
+  // Check that the codes refer to the values.
+  TableColumn tcol (table, "MODE");
+  Vector<String> entries;
+  AlwaysAssertExit (tcol.getDictionary (0, entries));
+  std::vector<uInt> codes(table.nrow());
+  tcol.getDictCodes (0, table.nrow(), codes.data());
+  for (rownr_t i=0; i<table.nrow(); ++i) {
+    AlwaysAssertExit (entries[codes[i]] == mvals[i]);
+  }
+  cout << "checked " << table.nrow() << " rows" << endl;
+}
+
+// Check if the batch result of a Bool expression matches the result
+// of the same expression on the plain column.
+void checkBool (const String& str, const TableExprNode& expr,
+                const TableExprNode& plainExpr, rownr_t nrow)
+{
+  Block<Bool> vals(nrow, False);
+  expr.getRep()->getBoolBatch (0, nrow, vals.storage(), 0);
+  uInt ntrue = 0;
+  for (rownr_t i=0; i<nrow; ++i) {
+    AlwaysAssertExit (vals[i] == plainExpr.getBool(i));
+    AlwaysAssertExit (vals[i] == expr.getBool(i));
+    if (vals[i]) ntrue++;
+  }
+  cout << str << ": " << ntrue << " of " << nrow << " true" << endl;
+}
+
+void checkSelect (const String& str, const Table& table,
+                  const TableExprNode& expr, const TableExprNode& plainExpr,
+                  uInt nthreads = 1)
+{
+  Table sel1 = table(expr, 0, 0, nthreads);
+  Table sel2 = table(plainExpr);
+  AlwaysAssertExit (allEQ (sel1.rowNumbers(table), sel2.rowNumbers(table)));
+  cout << str << ": selected " << sel1.nrow() << " rows" << endl;
+}
+
+void testExpr (const Table& table)
+{
+  TableExprNode mcol = table.col("MODE");
+  TableExprNode pcol = table.col("PLAIN");
+  rownr_t nrow = table.nrow();
+  checkBool ("MODE=='OFF'", mcol == "OFF", pcol == "OFF", nrow);
+  checkBool ("'OFF'==MODE", "OFF" == mcol, "OFF" == pcol, nrow);
+  checkBool ("MODE==''", mcol == "", pcol == "", nrow);
+  checkBool ("MODE=='none'", mcol == "none", pcol == "none", nrow);
+  checkBool ("MODE!='OFF'", mcol != "OFF", pcol != "OFF", nrow);
+  checkBool ("'OFF'!=MODE", "OFF" != mcol, "OFF" != pcol, nrow);
+  TableExprNode regex (TaqlRegex(Regex("CALIBRATE_.*")));
+  checkBool ("MODE~p/CALIBRATE_*/", mcol == regex, pcol == regex, nrow);
+  checkBool ("MODE!~p/CALIBRATE_*/", mcol != regex, pcol != regex, nrow);
+  Vector<String> svec(3);
+  svec[0] = "OFF";
+  svec[1] = "CALIBRATE_PHASE#ON_SOURCE";
+  svec[2] = "none";
+  TableExprNode set(svec);
+  checkBool ("MODE in [...]", mcol.in(set), pcol.in(set), nrow);
+  // Comparing two columns cannot use the dictionary.
+  checkBool ("MODE==PLAIN", mcol == pcol, pcol == mcol, nrow);
+  checkSelect ("MODE=='OFF'", table, mcol == "OFF", pcol == "OFF");
+  checkSelect ("MODE~p/CALIBRATE_*/ threads=4", table,
+               mcol == regex, pcol == regex, 4);
+}
+
+void testUpdate (const String& name)
+{
+  Table table(name, Table::Update);
+  ScalarColumn<String> mcol (table, "MODE");
+  ScalarColumn<String> pcol (table, "PLAIN");
+  TableExprNode expr (table.col("MODE") == "NEW");
+  TableExprNode plainExpr (table.col("PLAIN") == "NEW");
+  checkBool ("MODE=='NEW'", expr, plainExpr, table.nrow());
+  // Added rows get an empty string.
+  table.addRow (3);
+  AlwaysAssertExit (mcol(table.nrow()-1) == "");
+  AlwaysAssertExit (pcol(table.nrow()-1) == "");
+  // A new value extends the dictionary, which the expression has to use.
+  mcol.put (table.nrow()-2, "NEW");
+  pcol.put (table.nrow()-2, "NEW");
+  checkBool ("MODE=='NEW'", expr, plainExpr, table.nrow());
+  table.removeRow (10);
+  table.removeRow (table.nrow()-1);
+  checkTable (table);
+  showDictionary (TableColumn(table, "MODE"));
+  // A column without a dictionary.
+  Vector<String> entries;
+  AlwaysAssertExit (! TableColumn(table, "PLAIN").getDictionary (0, entries));
+  try {
+    std::vector<uInt> codes(1);
+    TableColumn(table, "PLAIN").getDictCodes (0, 1, codes.data());
+    AlwaysAssertExit (False);
+  } catch (const AipsError& x) {
+    cout << "Expected exception: " << x.getMesg() << endl;
+  }
+}
+
+void testAddColumn (const String& name)
+{
+  Table table(name, Table::Update);
+  Record spec;
+  spec.define ("DICTIONARYCOLUMNS", Vector<String>(1, "MODE2"));
+  StandardStMan stman ("SSM2", spec);
+  table.addColumn (ScalarColumnDesc<String>("MODE2"), stman);
+  ScalarColumn<String> mcol (table, "MODE");
+  ScalarColumn<String> m2col (table, "MODE2");
+  m2col.putColumn (mcol.getColumn());
+  table.flush();
+  Record dmspec = table.dataManagerInfo().subRecord(1).asRecord("SPEC");
+  cout << "DICTIONARYCOLUMNS " << dmspec.asArrayString("DICTIONARYCOLUMNS")
+       << endl;
+}
+
+int main()
+{
+  try {
+    makeTable ("tExprNodeDict_tmp.data", 3000);
+    {
+      Table table("tExprNodeDict_tmp.data");
+      Record dmspec = table.dataManagerInfo().subRecord(0).asRecord("SPEC");
+      cout << "DICTIONARYCOLUMNS "
+           << dmspec.asArrayString("DICTIONARYCOLUMNS") << endl;
+      checkTable (table);
+      showDictionary (TableColumn(table, "MODE"));
+      testExpr (table);
+    }
+    testUpdate ("tExprNodeDict_tmp.data");
+    testAddColumn ("tExprNodeDict_tmp.data");
+    Table table("tExprNodeDict_tmp.data");
+    AlwaysAssertExit (allEQ (ScalarColumn<String>(table, "MODE").getColumn(),
+                             ScalarColumn<String>(table, "MODE2").getColumn()));
+    showDictionary (TableColumn(table, "MODE2"));
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -50,7 +50,7 @@ void doIt (const String& str)
   TableExprNode expr = RecordGram::parse (tab, str);
   cout << str << ": ";
   if (expr.isScalar()) {
-    Vector<uInt> rownrs(expr.nrow());
+    Vector<rownr_t> rownrs(expr.nrow());
     indgen (rownrs);
     switch (expr.getColumnDataType()) {
     case TpBool:
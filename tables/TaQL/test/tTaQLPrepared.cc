@@ -0,0 +1,172 @@
+//# tTaQLPrepared.cc: Test program for prepared TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/TaQLPrepared.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/Tables/TableProxy.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Containers/ValueHolder.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for prepared TaQL commands (class TaQLPrepared).
+// It executes commands with parameters for various values and checks
+// that the tables are kept open between executions.
+// </summary>
+
+void makeTable()
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ANT"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  SetupNewTable newtab("tTaQLPrepared_tmp.tab", td, Table::New);
+  Table tab(newtab, 20);
+  ScalarColumn<Int> antCol (tab, "ANT");
+  ScalarColumn<Double> timeCol (tab, "TIME");
+  ScalarColumn<String> nameCol (tab, "NAME");
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    antCol.put (i, i%4);
+    timeCol.put (i, i*10.);
+    nameCol.put (i, "A" + String::toString(i%4));
+  }
+}
+
+void showRows (const String& str, const Table& tab)
+{
+  cout << str << ": " << tab.nrow() << " rows "
+       << tab.rowNumbers(Table("tTaQLPrepared_tmp.tab")) << endl;
+}
+
+void testSelect()
+{
+  TaQLPrepared cmd ("select from tTaQLPrepared_tmp.tab "
+                    "where ANT==$1 && TIME>=$2");
+  AlwaysAssertExit (cmd.nparams() == 2);
+  AlwaysAssertExit (! Table::isOpened ("tTaQLPrepared_tmp.tab"));
+  for (Int ant=0; ant<4; ++ant) {
+    cmd.bind (1, ValueHolder(ant));
+    cmd.bind (2, ValueHolder(ant*25.));
+    showRows ("ANT==" + String::toString(ant), cmd.execute().table());
+    // The table is kept open.
+    AlwaysAssertExit (Table::isOpened ("tTaQLPrepared_tmp.tab"));
+  }
+  // A bound value can be replaced by a value of another type.
+  cmd.bind (2, ValueHolder(Int(100)));
+  showRows ("ANT==3 && TIME>=100", cmd.execute().table());
+  cmd.releaseTables();
+  AlwaysAssertExit (! Table::isOpened ("tTaQLPrepared_tmp.tab"));
+  // All values must be bound.
+  cmd.clearBindings();
+  cmd.bind (1, ValueHolder(1));
+  try {
+    cmd.execute();
+    AlwaysAssertExit (False);
+  } catch (const TableParseError& x) {
+    cout << "Expected exception: " << x.getMesg() << endl;
+  }
+  try {
+    cmd.bind (3, ValueHolder(1));
+    AlwaysAssertExit (False);
+  } catch (const TableError& x) {
+    cout << "Expected exception: " << x.getMesg() << endl;
+  }
+}
+
+void testSet()
+{
+  // An array value can be used as a set; a string value can be used as well.
+  TaQLPrepared cmd ("select from tTaQLPrepared_tmp.tab "
+                    "where ANT in $1 && NAME != $2 orderby TIME desc");
+  Vector<Int> ants(2);
+  ants[0] = 0;
+  ants[1] = 3;
+  cmd.bind (1, ValueHolder(ants));
+  cmd.bind (2, ValueHolder(String("A0")));
+  showRows ("ANT in [0,3] && NAME!='A0'", cmd.execute().table());
+  ants[1] = 2;
+  cmd.bind (1, ValueHolder(ants));
+  cmd.bind (2, ValueHolder(String("A3")));
+  showRows ("ANT in [0,2] && NAME!='A3'", cmd.execute().table());
+}
+
+void testCalc()
+{
+  // The parameter can be combined with a temporary table ($1 in FROM).
+  Table tab("tTaQLPrepared_tmp.tab");
+  std::vector<const Table*> tempTables(1, &tab);
+  TaQLPrepared cmd ("calc from $1 calc sum([select TIME from $1 "
+                    "where ANT==$1]) + $2", tempTables);
+  AlwaysAssertExit (cmd.nparams() == 2);
+  for (Int ant=0; ant<2; ++ant) {
+    cmd.bind (1, ValueHolder(ant));
+    cmd.bind (2, ValueHolder(0.5));
+    TaQLResult res = cmd.execute();
+    AlwaysAssertExit (! res.isTable());
+    cout << "calc " << ant << ": " << res.node().getDouble(0) << endl;
+  }
+}
+
+void testProxy()
+{
+  // Execute using the TableProxy interface.
+  TaQLPrepared cmd ("select from tTaQLPrepared_tmp.tab where ANT==$1");
+  std::vector<ValueHolder> values(1);
+  values[0] = ValueHolder(2);
+  TableProxy proxy (cmd, values);
+  showRows ("proxy ANT==2", proxy.table());
+  // A null value keeps the value bound before.
+  values[0] = ValueHolder();
+  TableProxy proxy2 (cmd, values);
+  showRows ("proxy ANT==2", proxy2.table());
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testSelect();
+    testSet();
+    testCalc();
+    testProxy();
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
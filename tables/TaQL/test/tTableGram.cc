@@ -33,7 +33,9 @@
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Utilities/Regex.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -240,7 +242,7 @@ void showExpr(const TableExprNode& expr)
     cout << "Unit: " << unit.getName() << endl;
   }
   if (expr.isScalar()) {
-    Vector<uInt> rownrs(expr.nrow());
+    Vector<rownr_t> rownrs(expr.nrow());
     indgen (rownrs);
     switch (expr.getColumnDataType()) {
     case TpBool:
@@ -349,7 +351,8 @@ void seltab (const String& str)
                   s=="calc" || s=="delete" || s=="count" ||
                   s=="create" || s=="createtable" ||
                   s=="alter" || s=="altertable" ||
-                  s=="using"  || s=="usingstyle"  || s=="time");
+                  s=="using"  || s=="usingstyle"  || s=="time" ||
+                  s=="explain"  || s=="profile");
     }
   } 
   String strc(str);
@@ -394,6 +397,22 @@ void seltab (const String& str)
     if (vecstr.nelements() > 0) {
       showtab (*tabp, vecstr);
     }
+  } else if (cmd == "explain"  ||  cmd == "profile") {
+    // Show the plan or profile line by line.
+    // The times vary, so remove them from the step and node statistics
+    // and enclose the total time in >>> and <<<, so it is ignored when
+    // comparing the output.
+    Vector<String> lines = stringToVector (result.node().getString(0), '\n');
+    for (i=0; i<lines.size(); i++) {
+      String line (lines[i]);
+      line.gsub (Regex(", [^ ]* sec$"), "");
+      line.gsub (Regex(" *[^ ]* real .* system$"), "");
+      if (line.contains(" sec ")) {
+        cout << ">>>" << line << "<<<" << endl;
+      } else if (! line.empty()) {
+        cout << line << endl;
+      }
+    }
   } else {
     showExpr (result.node());
   }
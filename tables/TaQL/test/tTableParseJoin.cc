@@ -0,0 +1,247 @@
+//# tTableParseJoin.cc: Test program for the joins in TaQL
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/TableParseJoin.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/tables/TaQL/TaQLNodeDer.h>
+#include <casacore/tables/TaQL/TaQLNodeHandler.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the joins in TaQL.
+// It tests the class TableParseJoin finding the matching rows and
+// a SELECT command with a JOIN clause.
+// </summary>
+
+// Create the main table and two tables to join.
+void makeTables()
+{
+  {
+    TableDesc td ("", "1", TableDesc::Scratch);
+    td.addColumn (ScalarColumnDesc<Int> ("ANT"));
+    td.addColumn (ScalarColumnDesc<String> ("FLD"));
+    td.addColumn (ScalarColumnDesc<Double> ("DVAL"));
+    SetupNewTable newtab("tTableParseJoin_tmp.main", td, Table::New);
+    Table tab(newtab, 12);
+    ScalarColumn<Int> antCol (tab, "ANT");
+    ScalarColumn<String> fldCol (tab, "FLD");
+    ScalarColumn<Double> dCol (tab, "DVAL");
+    for (uInt i=0; i<tab.nrow(); ++i) {
+      antCol.put (i, Int(i%5) - 1);
+      fldCol.put (i, "f" + String::toString(i%4));
+      dCol.put (i, i%3);
+    }
+  }
+  {
+    TableDesc td ("", "1", TableDesc::Scratch);
+    td.addColumn (ScalarColumnDesc<String> ("NAME"));
+    td.addColumn (ScalarColumnDesc<Double> ("POS"));
+    SetupNewTable newtab("tTableParseJoin_tmp.ant", td, Table::New);
+    Table tab(newtab, 3);
+    ScalarColumn<String> nameCol (tab, "NAME");
+    ScalarColumn<Double> posCol (tab, "POS");
+    for (uInt i=0; i<tab.nrow(); ++i) {
+      nameCol.put (i, "A" + String::toString(i));
+      posCol.put (i, i*10.);
+    }
+  }
+  {
+    TableDesc td ("", "1", TableDesc::Scratch);
+    td.addColumn (ScalarColumnDesc<String> ("ID"));
+    td.addColumn (ScalarColumnDesc<Int> ("IVAL"));
+    SetupNewTable newtab("tTableParseJoin_tmp.fld", td, Table::New);
+    Table tab(newtab, 4);
+    ScalarColumn<String> idCol (tab, "ID");
+    ScalarColumn<Int> iCol (tab, "IVAL");
+    // f2 occurs twice, f3 does not occur.
+    const char* ids[] = {"f0", "f2", "f1", "f2"};
+    for (uInt i=0; i<tab.nrow(); ++i) {
+      idCol.put (i, ids[i]);
+      iCol.put (i, i);
+    }
+  }
+}
+
+void doJoin (const String& str, Bool leftJoin,
+             const std::vector<TableExprNode>& mainKeys,
+             const std::vector<TableExprNode>& joinKeys,
+             rownr_t mainNrow, rownr_t joinNrow)
+{
+  TableParseJoin join (mainKeys, joinKeys, mainNrow, joinNrow);
+  Vector<rownr_t> mainRows, joinRows;
+  rownr_t nunmatched = join.findRows (leftJoin, mainRows, joinRows);
+  AlwaysAssertExit (mainRows.size() == joinRows.size());
+  cout << str << ": byRownr=" << join.byRownr()
+       << " hashedMain=" << join.hashedMain()
+       << " nunmatched=" << nunmatched << endl;
+  cout << "  " << mainRows << endl;
+  cout << "  " << joinRows << endl;
+}
+
+void testJoin()
+{
+  Table mainTab("tTableParseJoin_tmp.main");
+  Table antTab("tTableParseJoin_tmp.ant");
+  Table fldTab("tTableParseJoin_tmp.fld");
+  std::vector<TableExprNode> mainKeys(1);
+  std::vector<TableExprNode> joinKeys(1);
+  // Join on the row number in the ANT table.
+  mainKeys[0] = mainTab.col("ANT");
+  doJoin ("ANT=a.rowid()", False, mainKeys, joinKeys,
+          mainTab.nrow(), antTab.nrow());
+  doJoin ("ANT=a.rowid() left", True, mainKeys, joinKeys,
+          mainTab.nrow(), antTab.nrow());
+  // Join on a string value (with duplicates in the joined table).
+  mainKeys[0] = mainTab.col("FLD");
+  joinKeys[0] = fldTab.col("ID");
+  doJoin ("FLD=f.ID", False, mainKeys, joinKeys,
+          mainTab.nrow(), fldTab.nrow());
+  doJoin ("FLD=f.ID left", True, mainKeys, joinKeys,
+          mainTab.nrow(), fldTab.nrow());
+  // Join a small main table with a larger table, so the hash table is
+  // built for the main table.
+  mainKeys[0] = fldTab.col("ID");
+  joinKeys[0] = mainTab.col("FLD");
+  doJoin ("ID=m.FLD", False, mainKeys, joinKeys,
+          fldTab.nrow(), mainTab.nrow());
+  doJoin ("ID=m.FLD left", True, mainKeys, joinKeys,
+          fldTab.nrow(), mainTab.nrow());
+  // Join on an integer and a real key using an expression.
+  mainKeys.resize (2);
+  joinKeys.resize (2);
+  mainKeys[0] = mainTab.col("ANT");
+  mainKeys[1] = mainTab.col("DVAL") * 10;
+  joinKeys[0] = TableExprNode();
+  joinKeys[1] = antTab.col("POS");
+  doJoin ("ANT=a.rowid() && DVAL*10=a.POS", False, mainKeys, joinKeys,
+          mainTab.nrow(), antTab.nrow());
+  // Mismatching data types.
+  mainKeys.resize (1);
+  joinKeys.resize (1);
+  mainKeys[0] = mainTab.col("FLD");
+  joinKeys[0] = fldTab.col("IVAL");
+  try {
+    TableParseJoin join (mainKeys, joinKeys, mainTab.nrow(), fldTab.nrow());
+    AlwaysAssertExit (False);
+  } catch (const TableInvExpr& x) {
+    cout << "Expected exception: " << x.getMesg() << endl;
+  }
+}
+
+// Create a node for a table (with alias) in a FROM or JOIN clause.
+TaQLMultiNode makeTableNode (const String& name, const String& alias)
+{
+  TaQLMultiNode tables(False);
+  tables.add (new TaQLTableNodeRep (TaQLNode(new TaQLConstNodeRep(name, True)),
+                                    alias));
+  return tables;
+}
+
+TaQLNode makeCol (const String& name)
+{
+  return TaQLNode (new TaQLKeyColNodeRep (name));
+}
+
+// Execute the parse tree of a SELECT command with a JOIN clause like
+//   select ANT, FLD, a.NAME as ANAME, f.IVAL as IVAL
+//      from tTableParseJoin_tmp.main
+//      join tTableParseJoin_tmp.ant a on ANT = a.rowid()
+//      [left] join tTableParseJoin_tmp.fld f on FLD = f.ID
+//      where ANT != 1
+void testSelect (Bool leftJoin)
+{
+  TaQLMultiNode cols(False);
+  cols.add (new TaQLColNodeRep (makeCol("ANT"), "", "", ""));
+  cols.add (new TaQLColNodeRep (makeCol("FLD"), "", "", ""));
+  cols.add (new TaQLColNodeRep (makeCol("a.NAME"), "ANAME", "", ""));
+  cols.add (new TaQLColNodeRep (makeCol("f.IVAL"), "IVAL", "", ""));
+  TaQLNode columns (new TaQLColumnsNodeRep (False, cols));
+  TaQLMultiNode joins(False);
+  joins.setSeparator ("");
+  joins.add (new TaQLJoinNodeRep
+             (TaQLJoinNodeRep::Inner,
+              makeTableNode ("tTableParseJoin_tmp.ant", "a"),
+              TaQLNode (new TaQLBinaryNodeRep
+                        (TaQLBinaryNodeRep::B_EQ, makeCol("ANT"),
+                         TaQLNode (new TaQLFuncNodeRep("a.rowid"))))));
+  joins.add (new TaQLJoinNodeRep
+             (leftJoin ? TaQLJoinNodeRep::Left : TaQLJoinNodeRep::Inner,
+              makeTableNode ("tTableParseJoin_tmp.fld", "f"),
+              TaQLNode (new TaQLBinaryNodeRep
+                        (TaQLBinaryNodeRep::B_EQ, makeCol("FLD"),
+                         makeCol("f.ID")))));
+  TaQLNode where (new TaQLBinaryNodeRep
+                  (TaQLBinaryNodeRep::B_NE, makeCol("ANT"),
+                   TaQLNode (new TaQLConstNodeRep(Int64(1)))));
+  TaQLNode select (new TaQLSelectNodeRep
+                   (columns, TaQLMultiNode(),
+                    makeTableNode ("tTableParseJoin_tmp.main", ""),
+                    joins, where, TaQLNode(), TaQLNode(), TaQLNode(),
+                    TaQLNode(), TaQLNode(), TaQLMultiNode()));
+  select.show (cout);
+  cout << endl;
+  TaQLNodeHandler handler;
+  std::vector<const Table*> tempTables;
+  TaQLNodeResult res = handler.handleTree (select, tempTables);
+  Table tab = TaQLNodeHandler::getHR(res).getTable();
+  TableColumn antCol (tab, "ANT");
+  TableColumn fldCol (tab, "FLD");
+  TableColumn anameCol (tab, "ANAME");
+  TableColumn ivalCol (tab, "IVAL");
+  cout << "selected " << tab.nrow() << " rows" << endl;
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    cout << "  " << antCol.asInt64(i) << ' ' << fldCol.asString(i) << ' '
+         << anameCol.asString(i) << ' ' << ivalCol.asInt64(i) << endl;
+  }
+}
+
+int main()
+{
+  try {
+    makeTables();
+    testJoin();
+    testSelect (False);
+    testSelect (True);
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
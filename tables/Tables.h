@@ -306,7 +306,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //     ArrayColumn<Float> arr2Col (tab, "arr2");
 //
 //     // Loop through all rows in the table.
-//     uInt nrrow = tab.nrow();
+//     rownr_t nrrow = tab.nrow();
 //     for (uInt i=0; i<nrow; i++) {
 //         // Read the row for both columns.
 //         cout << "Column ac in row i = " << acCol(i) << endl;
@@ -1089,6 +1089,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //   to deal with the cache size and to show the behaviour of the cache.
 //
 //  <li>
+//   <linkto class="PackedStMan:description">PackedStMan</linkto>
+//   encodes the values of integer, real and Bool scalar columns in buckets
+//   using frame-of-reference, delta or dictionary encoding with
+//   bit-packing. It is very well suited for columns with few distinct or
+//   regularly changing values (like ANTENNA1 or TIME in a MeasurementSet).
+//   It holds the encoded data in memory.
+//
+//  <li>
 //   The <a href="#Tables:TiledStMan">Tiled Storage Managers</a>
 //   store the data as a tiled hypercube allowing for more or less equally
 //   efficient data access along all main axes. It can be used for
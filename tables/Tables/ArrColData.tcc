@@ -99,7 +99,7 @@ void ArrayColumnData<T>::createDataManagerColumn()
 //# Initialize the array in the given rows.
 //# This removes an array if present.
 template<class T>
-void ArrayColumnData<T>::initialize (uInt, uInt)
+void ArrayColumnData<T>::initialize (rownr_t, rownr_t)
 {}
 
 template<class T>
@@ -134,29 +134,29 @@ void ArrayColumnData<T>::setShapeColumn (const IPosition& shp)
 }
 
 template<class T>
-Bool ArrayColumnData<T>::isDefined (uInt rownr) const
+Bool ArrayColumnData<T>::isDefined (rownr_t rownr) const
 {
     return dataColPtr_p->isShapeDefined(rownr);
 }
 template<class T>
-uInt ArrayColumnData<T>::ndim (uInt rownr) const
+uInt ArrayColumnData<T>::ndim (rownr_t rownr) const
 {
     return dataColPtr_p->ndim(rownr);
 }
 template<class T>
-IPosition ArrayColumnData<T>::shape (uInt rownr) const
+IPosition ArrayColumnData<T>::shape (rownr_t rownr) const
 {
     return dataColPtr_p->shape(rownr);
 }
 template<class T>
-IPosition ArrayColumnData<T>::tileShape (uInt rownr) const
+IPosition ArrayColumnData<T>::tileShape (rownr_t rownr) const
 {
     return dataColPtr_p->tileShape(rownr);
 }
 
 
 template<class T>
-void ArrayColumnData<T>::setShape (uInt rownr, const IPosition& shp)
+void ArrayColumnData<T>::setShape (rownr_t rownr, const IPosition& shp)
 {
     checkShape (shp);
     checkWriteLock (True);
@@ -164,7 +164,7 @@ void ArrayColumnData<T>::setShape (uInt rownr, const IPosition& shp)
     autoReleaseLock();
 }
 template<class T>
-void ArrayColumnData<T>::setShape (uInt rownr, const IPosition& shp,
+void ArrayColumnData<T>::setShape (rownr_t rownr, const IPosition& shp,
 				   const IPosition& tileShp)
 {
     checkShape (shp);
@@ -202,7 +202,7 @@ Bool ArrayColumnData<T>::canAccessColumnSlice (Bool& reask) const
 
 
 template<class T>
-void ArrayColumnData<T>::get (uInt rownr, void* arrayPtr) const
+void ArrayColumnData<T>::get (rownr_t rownr, void* arrayPtr) const
 {
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr,
@@ -214,7 +214,20 @@ void ArrayColumnData<T>::get (uInt rownr, void* arrayPtr) const
 }
 
 template<class T>
-void ArrayColumnData<T>::getSlice (uInt rownr, const Slicer& ns,
+Bool ArrayColumnData<T>::getMapped (rownr_t rownr, void* arrayPtr) const
+{
+    if (rtraceColumn_p) {
+      TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr,
+                         shape(rownr));
+    }
+    checkReadLock (True);
+    Bool mapped = dataColPtr_p->getArrayMappedV (rownr, arrayPtr);
+    autoReleaseLock();
+    return mapped;
+}
+
+template<class T>
+void ArrayColumnData<T>::getSlice (rownr_t rownr, const Slicer& ns,
 				   void* arrayPtr) const
 {
     if (rtraceColumn_p) {
@@ -229,7 +242,7 @@ void ArrayColumnData<T>::getSlice (uInt rownr, const Slicer& ns,
 
 
 template<class T>
-void ArrayColumnData<T>::put (uInt rownr, const void* arrayPtr)
+void ArrayColumnData<T>::put (rownr_t rownr, const void* arrayPtr)
 {
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr,
@@ -242,7 +255,7 @@ void ArrayColumnData<T>::put (uInt rownr, const void* arrayPtr)
 }
 
 template<class T>
-void ArrayColumnData<T>::putSlice (uInt rownr, const Slicer& ns,
+void ArrayColumnData<T>::putSlice (rownr_t rownr, const Slicer& ns,
 				   const void* arrayPtr)
 {
     if (wtraceColumn_p) {
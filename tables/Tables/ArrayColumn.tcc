@@ -165,7 +165,7 @@ void ArrayColumn<T>::checkShape (const IPosition& shp,
 }
 
 template<class T>
-Array<T> ArrayColumn<T>::operator() (uInt rownr) const
+Array<T> ArrayColumn<T>::operator() (rownr_t rownr) const
 {
     Array<T> arr;
     get (rownr, arr);
@@ -173,7 +173,7 @@ Array<T> ArrayColumn<T>::operator() (uInt rownr) const
 }
 
 template<class T>
-Array<T> ArrayColumn<T>::get (uInt rownr) const
+Array<T> ArrayColumn<T>::get (rownr_t rownr) const
 {
     Array<T> arr;
     get (rownr, arr);
@@ -181,7 +181,18 @@ Array<T> ArrayColumn<T>::get (uInt rownr) const
 }
 
 template<class T>
-void ArrayColumn<T>::get (uInt rownr, Array<T>& arr, Bool resize) const
+Array<T> ArrayColumn<T>::getMapped (rownr_t rownr) const
+{
+    TABLECOLUMNCHECKROW(rownr);
+    Array<T> arr;
+    if (! baseColPtr_p->getMapped (rownr, &arr)) {
+        get (rownr, arr, True);
+    }
+    return arr;
+}
+
+template<class T>
+void ArrayColumn<T>::get (rownr_t rownr, Array<T>& arr, Bool resize) const
 {
     TABLECOLUMNCHECKROW(rownr);
     // Check array conformance and resize if needed and possible.
@@ -191,7 +202,7 @@ void ArrayColumn<T>::get (uInt rownr, Array<T>& arr, Bool resize) const
 
 
 template<class T>
-Array<T> ArrayColumn<T>::getSlice (uInt rownr,
+Array<T> ArrayColumn<T>::getSlice (rownr_t rownr,
                                    const Slicer& arraySection) const
 {
     Array<T> arr;
@@ -200,7 +211,7 @@ Array<T> ArrayColumn<T>::getSlice (uInt rownr,
 }
 
 template<class T>
-void ArrayColumn<T>::getSlice (uInt rownr, const Slicer& arraySection,
+void ArrayColumn<T>::getSlice (rownr_t rownr, const Slicer& arraySection,
                                Array<T>& arr, Bool resize) const
                                {
     TABLECOLUMNCHECKROW(rownr);
@@ -239,7 +250,7 @@ void ArrayColumn<T>::getSlice (uInt rownr, const Slicer& arraySection,
 
 template<class T>
 Array<T> ArrayColumn<T>::getSlice
-(uInt rownr, const Vector<Vector<Slice> >& arraySlices) const
+(rownr_t rownr, const Vector<Vector<Slice> >& arraySlices) const
 {
     Array<T> arr;
     getSlice (rownr, arraySlices, arr);
@@ -247,7 +258,7 @@ Array<T> ArrayColumn<T>::getSlice
 }
 
 template<class T>
-void ArrayColumn<T>::getSlice (uInt rownr,
+void ArrayColumn<T>::getSlice (rownr_t rownr,
                                const Vector<Vector<Slice> >& arraySlices,
                                Array<T>& arr, Bool resize) const
 {
@@ -291,7 +302,7 @@ ArrayColumn<T>::getColumnCells (const RefRows & rows,
    // row numbers.  When sliced, rowNumbers is a triple: (start, nRows, increment).
    // Thus we have two different ways of walking through the selected rows.
 
-   const Vector<uInt> & rowNumbers = rows.rowVector();
+   const Vector<rownr_t> & rowNumbers = rows.rowVector();
    Bool useRowSlicing = rows.isSliced();
    Int row = 0;
    Int increment = 1;
@@ -305,14 +316,14 @@ ArrayColumn<T>::getColumnCells (const RefRows & rows,
    }
 
    uInt nSlicers = dataSlicers.size();
-   uInt nRows = rows.nrows();
+   rownr_t nRows = rows.nrows();
 
    //# Ask if we can access the slice (if that is not known yet).
    if (reaskAccessSlice_p) {
      canAccessSlice_p = baseColPtr_p->canAccessSlice (reaskAccessSlice_p);
    }
    
-   for (uInt i = 0; i < nRows; i++){
+   for (rownr_t i = 0; i < nRows; i++){
 
        // Create a section of the destination array that will hold the
        // data for this row ([s1, ...,sN, nR] --> [s1,...,sN].
@@ -426,7 +437,7 @@ Array<T> ArrayColumn<T>::getColumn() const
 template<class T>
 void ArrayColumn<T>::getColumn (Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     //# Take shape of array in first row.
     IPosition shp;
     if (nrrow > 0) {
@@ -448,7 +459,7 @@ void ArrayColumn<T>::getColumn (Array<T>& arr, Bool resize) const
 	baseColPtr_p->getArrayColumn (&arr);
       }else{
         ArrayIterator<T> iter(arr, arr.ndim()-1);
-        for (uInt rownr=0; rownr<nrrow; rownr++) {
+        for (rownr_t rownr=0; rownr<nrrow; rownr++) {
           Array<T>& darr = iter.array();
           if (! darr.shape().isEqual (baseColPtr_p->shape (rownr))) {
             throw TableArrayConformanceError
@@ -476,7 +487,7 @@ template<class T>
 void ArrayColumn<T>::getColumn (const Slicer& arraySection,
                                 Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     //# Use shape of array in first row.
     IPosition shp, blc,trc,inc;
     if (nrrow > 0) {
@@ -499,7 +510,7 @@ void ArrayColumn<T>::getColumn (const Slicer& arraySection,
         baseColPtr_p->getColumnSlice (defSlicer, &arr);
       }else{
         ArrayIterator<T> iter(arr, arr.ndim()-1);
-        for (uInt rownr=0; rownr<nrrow; rownr++) {
+        for (rownr_t rownr=0; rownr<nrrow; rownr++) {
           getSlice (rownr, defSlicer, iter.array());
           iter.next();
         }
@@ -521,7 +532,7 @@ template<class T>
 void ArrayColumn<T>::getColumn (const Vector<Vector<Slice> >& arraySlices,
                                 Array<T>& arr, Bool resize) const
 {
-  uInt nrrow = nrow();
+  rownr_t nrrow = nrow();
   // Get total shape.
   // Use shape of first row (if there) as overall array shape.
   IPosition colShp;
@@ -555,7 +566,7 @@ template<class T>
 void ArrayColumn<T>::getColumnRange (const Slicer& rowRange,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -578,7 +589,7 @@ template<class T>
 void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
      //# Take shape of array in first row.
     IPosition arrshp;
     if (nrrow > 0) {
@@ -606,7 +617,7 @@ void ArrayColumn<T>::getColumnRange (const Slicer& rowRange,
                                      const Slicer& arraySection,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -632,7 +643,7 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
                                      const Slicer& arraySection,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
     IPosition arrshp, arrblc, arrtrc, arrinc;
     if (nrrow > 0) {
 	arrshp = arraySection.inferShapeFromSource (shape(rownrs.firstRow()),
@@ -657,9 +668,9 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
         ArrayIterator<T> iter(arr, arr.ndim()-1);
         RefRowsSliceIter rowsIter(rownrs);
         while (! rowsIter.pastEnd()) {
-          uInt rownr = rowsIter.sliceStart();
-          uInt end   = rowsIter.sliceEnd();
-          uInt incr  = rowsIter.sliceIncr();
+          rownr_t rownr = rowsIter.sliceStart();
+          rownr_t end   = rowsIter.sliceEnd();
+          rownr_t incr  = rowsIter.sliceIncr();
           while (rownr <= end) {
             getSlice (rownr, defSlicer, iter.array());
             iter.next();
@@ -673,7 +684,7 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
 
 
 template<class T>
-void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape)
+void ArrayColumn<T>::setShape (rownr_t rownr, const IPosition& shape)
 {
     checkWritable();
     TABLECOLUMNCHECKROW(rownr); 
@@ -692,7 +703,7 @@ void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape)
 }
 	
 template<class T>
-void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape,
+void ArrayColumn<T>::setShape (rownr_t rownr, const IPosition& shape,
 			       const IPosition& tileShape)
 {
     checkWritable();
@@ -712,7 +723,7 @@ void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape,
 }
 	
 template<class T>
-void ArrayColumn<T>::put (uInt rownr, const Array<T>& arr)
+void ArrayColumn<T>::put (rownr_t rownr, const Array<T>& arr)
 {
     checkWritable();
     TABLECOLUMNCHECKROW(rownr); 
@@ -734,7 +745,7 @@ void ArrayColumn<T>::put (uInt rownr, const Array<T>& arr)
 }
 
 template<class T>
-void ArrayColumn<T>::putSlice (uInt rownr, const Slicer& arraySection,
+void ArrayColumn<T>::putSlice (rownr_t rownr, const Slicer& arraySection,
 			       const Array<T>& arr)
 {
     checkWritable();
@@ -765,7 +776,7 @@ void ArrayColumn<T>::putSlice (uInt rownr, const Slicer& arraySection,
 }
 
 template<class T>
-void ArrayColumn<T>::putSlice (uInt rownr,
+void ArrayColumn<T>::putSlice (rownr_t rownr,
                                const Vector<Vector<Slice> >& arraySlices,
 			       const Array<T>& arr)
 {
@@ -796,14 +807,14 @@ void ArrayColumn<T>::putColumnCells (const RefRows & rows,
     checkWritable();
     // Empty the destination array one row at a time.
 
-    const Vector<uInt>& rowNumbers = rows.rowVector();
+    const Vector<rownr_t>& rowNumbers = rows.rowVector();
 
     // If rows is not sliced then rowNumbers is simply a vector of the relevant
     // row numbers.  When sliced, rowNumbers is a triple: (start, nRows, increment).
     // Thus we have two different ways of walking through the selected rows.
 
-    Int row=0;
-    Int increment=1;
+    rownr_t row=0;
+    rownr_t increment=1;
     Bool useSlices = rows.isSliced();
 
     if (useSlices){
@@ -814,7 +825,7 @@ void ArrayColumn<T>::putColumnCells (const RefRows & rows,
         row = rowNumbers [0] - increment; // allows increment before use inside loop
     }
 
-    for (uInt i = 0; i < rows.nrows(); i++){
+    for (rownr_t i = 0; i < rows.nrows(); i++){
 
         Array<T> sourceSection = source [i]; // this row's data as array
 
@@ -858,10 +869,10 @@ ArrayColumn<T>::putColumnCells (const RefRows& rows,
    // row numbers.  When sliced, rowNumbers is a triple: (start, nRows, increment).
    // Thus we have two different ways of walking through the selected rows.
 
-   const Vector<uInt> & rowNumbers = rows.rowVector();
+   const Vector<rownr_t> & rowNumbers = rows.rowVector();
    Bool useRowSlicing = rows.isSliced();
-   int row = 0;
-   int increment = 1;
+   rownr_t row = 0;
+   rownr_t increment = 1;
 
    if (useRowSlicing){
 
@@ -872,14 +883,14 @@ ArrayColumn<T>::putColumnCells (const RefRows& rows,
    }
 
    uInt nSlicers = bufferSlicers.size();
-   uInt nRows = rows.nrows();
+   rownr_t nRows = rows.nrows();
 
    //# Ask if we can access the slice (if that is not known yet).
    if (reaskAccessSlice_p) {
      canAccessSlice_p = baseColPtr_p->canAccessSlice (reaskAccessSlice_p);
    }
    
-   for (uInt i = 0; i < nRows; i++){
+   for (rownr_t i = 0; i < nRows; i++){
 
        // Create a section of the source array that will hold the
        // data for this row ([s1, ...,sN, nR] --> [s1,...,sN].
@@ -903,8 +914,8 @@ ArrayColumn<T>::putColumnCells (const RefRows& rows,
 
 
 template<class T>
-void ArrayColumn<T>::put (uInt thisRownr, const TableColumn& that,
-			  uInt thatRownr, Bool preserveTileShape)
+void ArrayColumn<T>::put (rownr_t thisRownr, const TableColumn& that,
+			  rownr_t thatRownr, Bool preserveTileShape)
 {
   TableColumn::put (thisRownr, that, thatRownr, preserveTileShape);
 }
@@ -914,7 +925,7 @@ void ArrayColumn<T>::putColumn (const Array<T>& arr)
 {
     checkWritable();
     //# First check if number of rows matches.
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp  = arr.shape();
     uInt last = shp.nelements() - 1;
     if (shp(last) != Int(nrrow)) {
@@ -934,7 +945,7 @@ void ArrayColumn<T>::putColumn (const Array<T>& arr)
 	}
     }else{
 	//# Otherwise set the shape of each cell (as far as needed).
-	for (uInt i=0; i<nrrow; i++) {
+	for (rownr_t i=0; i<nrrow; i++) {
 	    setShape (i, shp);
 	}
     }
@@ -950,7 +961,7 @@ void ArrayColumn<T>::putColumn (const Array<T>& arr)
     }else{
         if (arr.nelements() > 0) {
 	    ReadOnlyArrayIterator<T> iter(arr, arr.ndim()-1);
-	    for (uInt rownr=0; rownr<nrrow; rownr++) {
+	    for (rownr_t rownr=0; rownr<nrrow; rownr++) {
 	        baseColPtr_p->put (rownr, &(iter.array()));
 		iter.next();
 	    }
@@ -962,7 +973,7 @@ template<class T>
 void ArrayColumn<T>::putColumn (const Slicer& arraySection, const Array<T>& arr)
 {
     checkWritable();
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     //# First check if number of rows matches.
     IPosition arrshp = arr.shape();
     uInt last = arrshp.nelements() - 1;
@@ -997,7 +1008,7 @@ void ArrayColumn<T>::putColumn (const Slicer& arraySection, const Array<T>& arr)
     }else{
         if (arr.nelements() > 0) {
 	    ReadOnlyArrayIterator<T> iter(arr, arr.ndim()-1);
-	    for (uInt rownr=0; rownr<nrrow; rownr++) {
+	    for (rownr_t rownr=0; rownr<nrrow; rownr++) {
 	        putSlice (rownr, arraySection, iter.array());
 		iter.next();
 	    }
@@ -1010,7 +1021,7 @@ void ArrayColumn<T>::putColumn (const Vector<Vector<Slice> >& arraySlices,
                                 const Array<T>& arr)
 {
   checkWritable();
-  uInt nrrow = nrow();
+  rownr_t nrrow = nrow();
   // Get total shape.
   // Use shape of first row (if there) as overall array shape.
   IPosition colShp;
@@ -1040,7 +1051,7 @@ template<class T>
 void ArrayColumn<T>::putColumnRange (const Slicer& rowRange,
 				     const Array<T>& arr)
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -1057,7 +1068,7 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 {
     checkWritable();
     //# First check if number of rows matches.
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
     IPosition arrshp  = arr.shape();
     uInt last = arrshp.nelements() - 1;
     if (arrshp(last) != Int(nrrow)) {
@@ -1079,9 +1090,9 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 	//# Otherwise set the shape of each cell (as far as needed).
         RefRowsSliceIter iter(rownrs);
         while (! iter.pastEnd()) {
-            uInt rownr = iter.sliceStart();
-            uInt end = iter.sliceEnd();
-            uInt incr = iter.sliceIncr();
+            rownr_t rownr = iter.sliceStart();
+            rownr_t end = iter.sliceEnd();
+            rownr_t incr = iter.sliceIncr();
             while (rownr <= end) {
 		setShape (rownr, arrshp);
 		rownr += incr;
@@ -1098,7 +1109,7 @@ void ArrayColumn<T>::putColumnRange (const Slicer& rowRange,
 				     const Slicer& arraySection,
 				     const Array<T>& arr)
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -1116,7 +1127,7 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 {
     checkWritable();
     //# First check if number of rows matches.
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
     IPosition arrshp = arr.shape();
     uInt last = arrshp.nelements() - 1;
     if (arrshp(last) != Int(nrrow)) {
@@ -1150,8 +1161,8 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 template<class T>
 void ArrayColumn<T>::fillColumn (const Array<T>& value)
 {
-    uInt nrrow = nrow();
-    for (uInt i=0; i<nrrow; i++) {
+    rownr_t nrrow = nrow();
+    for (rownr_t i=0; i<nrrow; i++) {
 	put (i, value);
     }
 }
@@ -1161,13 +1172,13 @@ void ArrayColumn<T>::putColumn (const ArrayColumn<T>& that)
 {
     checkWritable();
     //# Check the column lengths.
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     if (nrrow != that.nrow()) {
       throw (TableConformanceError
              ("Nr of rows differ in ArrayColumn::putColumn for column " +
               baseColPtr_p->columnDesc().name()));
     }
-    for (uInt i=0; i<nrrow; i++) {
+    for (rownr_t i=0; i<nrrow; i++) {
 	put (i, that, i);
     }
 }
@@ -43,13 +43,13 @@ BaseColumn::~BaseColumn()
 //# By default all functions throw an exception
 //# to ensure they are called correctly.
 
-void BaseColumn::setShape (uInt, const IPosition&)
+void BaseColumn::setShape (rownr_t, const IPosition&)
 {
   throw (TableInvOper ("invalid setShape() for column " + colDescPtr_p->name() +
                        "; only valid for an array"));
 }
 
-void BaseColumn::setShape (uInt, const IPosition&, const IPosition&)
+void BaseColumn::setShape (rownr_t, const IPosition&, const IPosition&)
 {
   throw (TableInvOper ("invalid setShape() for column " + colDescPtr_p->name() +
                        "; only valid for an array"));
@@ -69,21 +69,21 @@ IPosition BaseColumn::shapeColumn() const
   return IPosition(0);
 }
 
-uInt BaseColumn::ndim (uInt) const
+uInt BaseColumn::ndim (rownr_t) const
 {
   throw (TableInvOper ("invalid ndim() for column " + colDescPtr_p->name() +
                        "; only valid for an array"));
   return 0;
 }
 
-IPosition BaseColumn::shape (uInt) const
+IPosition BaseColumn::shape (rownr_t) const
 {
   throw (TableInvOper ("invalid shape() for column " + colDescPtr_p->name() +
                        "; only valid for an array"));
   return IPosition(0);
 }
 
-IPosition BaseColumn::tileShape (uInt) const
+IPosition BaseColumn::tileShape (rownr_t) const
 {
   throw (TableInvOper ("invalid tileShape() for column " + colDescPtr_p->name() +
                        "; only valid for an array"));
@@ -127,7 +127,28 @@ Bool BaseColumn::canAccessColumnSlice (Bool& reask) const
 }
 
 
-void BaseColumn::getSlice (uInt, const Slicer&, void*) const
+Bool BaseColumn::getMapped (rownr_t, void*) const
+{
+  return False;
+}
+
+Bool BaseColumn::getValueRange (rownr_t, rownr_t&, Double&, Double&) const
+{
+  return False;
+}
+
+Bool BaseColumn::getDictionary (uInt, Vector<String>&) const
+{
+  return False;
+}
+
+void BaseColumn::getDictCodes (rownr_t, uInt, uInt*) const
+{
+  throw TableInvOper ("getDictCodes not possible for column " +
+                      columnDesc().name());
+}
+
+void BaseColumn::getSlice (rownr_t, const Slicer&, void*) const
 {
   throw (TableInvOper ("getSlice() not implemented for column " +
                        colDescPtr_p->name() + "; only valid for an array"));
@@ -170,7 +191,7 @@ void BaseColumn::getColumnSlice (const Slicer&, void*) const
                        colDescPtr_p->name() + "; only valid for an array"));
 }
 
-void BaseColumn::putSlice (uInt, const Slicer&, const void*)
+void BaseColumn::putSlice (rownr_t, const Slicer&, const void*)
 {
   throw (TableInvOper ("putSlice() not implemented for column " +
                        colDescPtr_p->name() + "; only valid for an array"));
@@ -221,7 +242,7 @@ void BaseColumn::makeSortKey (Sort&, CountedPtr<BaseCompare>&, Int,
                        " is only valid for a scalar"));
 }
 void BaseColumn::makeRefSortKey (Sort&, CountedPtr<BaseCompare>&, Int,
-				 const Vector<uInt>&, const void*&)
+				 const Vector<rownr_t>&, const void*&)
 {
   throw (TableInvOper ("makeSortKey(rownrs) for column " + colDescPtr_p->name() +
                        " is only valid for a scalar"));
@@ -243,7 +264,7 @@ void BaseColumn::freeIterBuf (void*&, void*&)
 }
 
 
-void BaseColumn::getScalar (uInt rownr, Bool& value) const
+void BaseColumn::getScalar (rownr_t rownr, Bool& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -257,7 +278,7 @@ void BaseColumn::getScalar (uInt rownr, Bool& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, uChar& value) const
+void BaseColumn::getScalar (rownr_t rownr, uChar& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -271,7 +292,7 @@ void BaseColumn::getScalar (uInt rownr, uChar& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Short& value) const
+void BaseColumn::getScalar (rownr_t rownr, Short& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -285,7 +306,7 @@ void BaseColumn::getScalar (uInt rownr, Short& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, uShort& value) const
+void BaseColumn::getScalar (rownr_t rownr, uShort& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -304,7 +325,7 @@ void BaseColumn::getScalar (uInt rownr, uShort& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Int& value) const
+void BaseColumn::getScalar (rownr_t rownr, Int& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -333,7 +354,7 @@ void BaseColumn::getScalar (uInt rownr, Int& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, uInt& value) const
+void BaseColumn::getScalar (rownr_t rownr, uInt& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -357,7 +378,7 @@ void BaseColumn::getScalar (uInt rownr, uInt& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Int64& value) const
+void BaseColumn::getScalar (rownr_t rownr, Int64& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -396,7 +417,7 @@ void BaseColumn::getScalar (uInt rownr, Int64& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, float& value) const
+void BaseColumn::getScalar (rownr_t rownr, float& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -445,7 +466,7 @@ void BaseColumn::getScalar (uInt rownr, float& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, double& value) const
+void BaseColumn::getScalar (rownr_t rownr, double& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -494,7 +515,7 @@ void BaseColumn::getScalar (uInt rownr, double& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Complex& value) const
+void BaseColumn::getScalar (rownr_t rownr, Complex& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -554,7 +575,7 @@ void BaseColumn::getScalar (uInt rownr, Complex& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, DComplex& value) const
+void BaseColumn::getScalar (rownr_t rownr, DComplex& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -613,7 +634,7 @@ void BaseColumn::getScalar (uInt rownr, DComplex& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, String& value) const
+void BaseColumn::getScalar (rownr_t rownr, String& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -627,7 +648,7 @@ void BaseColumn::getScalar (uInt rownr, String& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, TableRecord& value) const
+void BaseColumn::getScalar (rownr_t rownr, TableRecord& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -641,7 +662,7 @@ void BaseColumn::getScalar (uInt rownr, TableRecord& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, void* value,
+void BaseColumn::getScalar (rownr_t rownr, void* value,
 			    const String& dataTypeId) const
 {
     if (!colDescPtr_p->isScalar()) {
@@ -655,7 +676,7 @@ void BaseColumn::getScalar (uInt rownr, void* value,
 }
 
 
-void BaseColumn::putScalar (uInt rownr, const Bool& value)
+void BaseColumn::putScalar (rownr_t rownr, const Bool& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -669,7 +690,7 @@ void BaseColumn::putScalar (uInt rownr, const Bool& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const uChar& value)
+void BaseColumn::putScalar (rownr_t rownr, const uChar& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -726,7 +747,7 @@ void BaseColumn::putScalar (uInt rownr, const uChar& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Short& value)
+void BaseColumn::putScalar (rownr_t rownr, const Short& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -768,7 +789,7 @@ void BaseColumn::putScalar (uInt rownr, const Short& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const uShort& value)
+void BaseColumn::putScalar (rownr_t rownr, const uShort& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -815,7 +836,7 @@ void BaseColumn::putScalar (uInt rownr, const uShort& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Int& value)
+void BaseColumn::putScalar (rownr_t rownr, const Int& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -852,7 +873,7 @@ void BaseColumn::putScalar (uInt rownr, const Int& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const uInt& value)
+void BaseColumn::putScalar (rownr_t rownr, const uInt& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -889,7 +910,7 @@ void BaseColumn::putScalar (uInt rownr, const uInt& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Int64& value)
+void BaseColumn::putScalar (rownr_t rownr, const Int64& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -921,7 +942,7 @@ void BaseColumn::putScalar (uInt rownr, const Int64& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const float& value)
+void BaseColumn::putScalar (rownr_t rownr, const float& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -948,7 +969,7 @@ void BaseColumn::putScalar (uInt rownr, const float& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const double& value)
+void BaseColumn::putScalar (rownr_t rownr, const double& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -975,7 +996,7 @@ void BaseColumn::putScalar (uInt rownr, const double& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Complex& value)
+void BaseColumn::putScalar (rownr_t rownr, const Complex& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -993,7 +1014,7 @@ void BaseColumn::putScalar (uInt rownr, const Complex& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const DComplex& value)
+void BaseColumn::putScalar (rownr_t rownr, const DComplex& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -1011,7 +1032,7 @@ void BaseColumn::putScalar (uInt rownr, const DComplex& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const String& value)
+void BaseColumn::putScalar (rownr_t rownr, const String& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -1025,7 +1046,7 @@ void BaseColumn::putScalar (uInt rownr, const String& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const TableRecord& value)
+void BaseColumn::putScalar (rownr_t rownr, const TableRecord& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
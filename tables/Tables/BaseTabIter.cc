@@ -141,7 +141,7 @@ BaseTable* BaseTableIterator::next()
 	colPtr_p[i]->get (lastRow_p, lastVal_p[i]);
     }
     Bool match;
-    uInt nr = sortTab_p->nrow();
+    rownr_t nr = sortTab_p->nrow();
     while (++lastRow_p < nr) {
 	match = True;
 	for (i=0; i<nrkeys_p; i++) {
@@ -164,7 +164,7 @@ BaseTable* BaseTableIterator::next()
       keyChangeAtLastNext_p=String();
 
     //# Adjust rownrs in case source table is already a RefTable.
-    Vector<uInt>& rownrs = *(itp->rowStorage());
+    Vector<rownr_t>& rownrs = *(itp->rowStorage());
     sortTab_p->adjustRownrs (itp->nrow(), rownrs, False);
     return itp;
 }
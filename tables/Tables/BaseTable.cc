@@ -37,7 +37,9 @@
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprRange.h>
 #include <casacore/tables/Tables/BaseTabIter.h>
+#include <casacore/tables/Tables/TableIndexCache.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -56,26 +58,32 @@
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/OS/Directory.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <limits>
+#include <vector>
+#include <exception>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 // The constructor of the derived class should call unmarkForDelete
 // when the construction ended succesfully.
-BaseTable::BaseTable (const String& name, int option, uInt nrrow)
+BaseTable::BaseTable (const String& name, int option, rownr_t nrrow)
+    : exprMutex_p (Mutex::Recursive)
 {
     BaseTableCommon(name, option, nrrow);
 }
 
 #ifdef HAVE_MPI
-BaseTable::BaseTable (MPI_Comm mpiComm, const String& name, int option, uInt nrrow)
-    :itsMpiComm  (mpiComm)
+BaseTable::BaseTable (MPI_Comm mpiComm, const String& name, int option, rownr_t nrrow)
+    : exprMutex_p (Mutex::Recursive),
+      itsMpiComm  (mpiComm)
 {
     BaseTableCommon(name, option, nrrow);
 }
 #endif
 
-void BaseTable::BaseTableCommon (const String& name, int option, uInt nrrow)
+void BaseTable::BaseTableCommon (const String& name, int option, rownr_t nrrow)
 {
     nrlink_p = 0;
     nrrow_p = nrrow;
@@ -87,6 +95,7 @@ void BaseTable::BaseTableCommon (const String& name, int option, uInt nrrow)
     delete_p = False;
     madeDir_p = True;
     itsTraceId = -1;
+    indexCache_p = 0;
 
     if (name_p.empty()) {
         name_p = File::newUniqueName ("", "tab").originalName();
@@ -106,6 +115,7 @@ void BaseTable::BaseTableCommon (const String& name, int option, uInt nrrow)
 
 BaseTable::~BaseTable()
 {
+    delete indexCache_p;
     delete tdescPtr_p;
     //# Delete the table files (if there) if marked for delete.
     if (isMarkedForDelete()) {
@@ -349,8 +359,15 @@ void BaseTable::writeStart (AipsIO& ios, Bool bigEndian)
     ios.open (Table::fileName(name_p), ByteIO::New);
     //# Start the object as Table, so class Table can read it back.
     //# Version 2 (of PlainTable) does not have its own TableRecord anymore.
-    ios.putstart ("Table", 2);
-    ios << nrrow_p;
+    //# Version 3 stores the number of rows as a 64-bit value. It is only
+    //# used if needed, so older software can still read smaller tables.
+    if (nrrow_p > std::numeric_limits<uInt>::max()) {
+        ios.putstart ("Table", 3);
+        ios << nrrow_p;
+    } else {
+        ios.putstart ("Table", 2);
+        ios << uInt(nrrow_p);
+    }
     //# Write endianity as a uInt, because older tables contain a uInt 0 here.
     uInt endian = 0;
     if (!bigEndian) {
@@ -372,6 +389,32 @@ void BaseTable::writeEnd (AipsIO& ios)
 void BaseTable::setTableChanged()
 {}
 
+TableIndexCache* BaseTable::indexCache()
+{
+    return 0;
+}
+
+void BaseTable::setIndexChanged (const String& columnName)
+{
+    if (indexCache_p != 0) {
+        indexCache_p->setChanged (columnName);
+    }
+}
+
+void BaseTable::setIndexChanged()
+{
+    if (indexCache_p != 0) {
+        indexCache_p->setChanged();
+    }
+}
+
+void BaseTable::clearIndexCache()
+{
+    if (indexCache_p != 0) {
+        indexCache_p->clear();
+    }
+}
+
 
 void BaseTable::markForDelete (Bool callback, const String& oldName)
 {
@@ -598,18 +641,18 @@ Bool BaseTable::canAddRow() const
 Bool BaseTable::canRemoveRow() const
     { return False; }
 
-void BaseTable::addRow (uInt, Bool)
+void BaseTable::addRow (rownr_t, Bool)
     { throw (TableInvOper ("Table: cannot add a row to table " + name_p)); }
 
-void BaseTable::removeRow (uInt)
+void BaseTable::removeRow (rownr_t)
     { throw (TableInvOper ("Table: cannot remove a row from table " + name_p)); }
 
-void BaseTable::removeRow (const Vector<uInt>& rownrs)
+void BaseTable::removeRow (const Vector<rownr_t>& rownrs)
 {
     //# Copy the rownrs and sort them.
     //# Loop through them from end to start. In that way we are sure
     //# that the deletion of a row does not affect later rows.
-    Vector<uInt> rownrsCopy;
+    Vector<rownr_t> rownrsCopy;
     rownrsCopy = rownrs;
     genSort (rownrsCopy);
     for (Int i=rownrsCopy.nelements()-1; i>=0; i--) {
@@ -654,11 +697,11 @@ void BaseTable::addColumns (const TableDesc& desc, const Record& dmInfo,
 
 
 //# Get a vector of row numbers.
-Vector<uInt> BaseTable::rowNumbers() const
+Vector<rownr_t> BaseTable::rowNumbers() const
 {
     AlwaysAssert (!isNull(), AipsError);
-    Vector<uInt> vec(nrow());
-    indgen (vec, (uInt)0);                  // store 0,1,... in it
+    Vector<rownr_t> vec(nrow());
+    indgen (vec, rownr_t(0));               // store 0,1,... in it
     return vec;
 }
 
@@ -671,7 +714,7 @@ Bool BaseTable::rowOrder() const
     { return True; }
 
 //# By the default the table cannot return the storage of rownrs.
-Vector<uInt>* BaseTable::rowStorage()
+Vector<rownr_t>* BaseTable::rowStorage()
 {
     throw (TableInvOper ("rowStorage() not possible; table " + name_p +
                          " is no RefTable"));
@@ -723,12 +766,12 @@ BaseTable* BaseTable::doSort (PtrBlock<BaseColumn*>& sortCol,
     }
     //# Create a reference table.
     //# This table will NOT be in row order.
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     RefTable* resultTable = makeRefTable (False, nrrow);
     //# Now sort the table storing the row-numbers in the RefTable.
     //# Adjust rownrs in case source table is already a RefTable.
     //# Then delete possible allocated data blocks.
-    Vector<uInt>& rows = *(resultTable->rowStorage());
+    Vector<rownr_t>& rows = *(resultTable->rowStorage());
     //# Note that nrrow can change in case Sort::NoDuplicates was given.
     nrrow = sortobj.sort (rows, nrrow, option);
     adjustRownrs (nrrow, rows, False);
@@ -739,7 +782,7 @@ BaseTable* BaseTable::doSort (PtrBlock<BaseColumn*>& sortCol,
     return resultTable;
 }
 
-RefTable* BaseTable::makeRefTable (Bool rowOrder, uInt initialNrrow)
+RefTable* BaseTable::makeRefTable (Bool rowOrder, rownr_t initialNrrow)
 {
     RefTable* rtp = new RefTable(this, rowOrder, initialNrrow);
     return rtp;
@@ -747,10 +790,10 @@ RefTable* BaseTable::makeRefTable (Bool rowOrder, uInt initialNrrow)
 
 
 //# No rownrs have to be adjusted and they are by default in ascending order.
-Bool BaseTable::adjustRownrs (uInt, Vector<uInt>&, Bool) const
+Bool BaseTable::adjustRownrs (rownr_t, Vector<rownr_t>&, Bool) const
     { return True; }
 
-BaseTable* BaseTable::select (uInt maxRow, uInt offset)
+BaseTable* BaseTable::select (rownr_t maxRow, rownr_t offset)
 {
     if (offset > nrow()) {
         offset = nrow();
@@ -761,14 +804,15 @@ BaseTable* BaseTable::select (uInt maxRow, uInt offset)
     if (offset == 0  &&  maxRow == nrow()) {
         return this;
     }
-    Vector<uInt> rownrs(maxRow);
+    Vector<rownr_t> rownrs(maxRow);
     indgen(rownrs, offset);
     return select(rownrs);
 }
 
 // Do the row selection.
 BaseTable* BaseTable::select (const TableExprNode& node,
-                              uInt maxRow, uInt offset)
+                              rownr_t maxRow, rownr_t offset,
+                              uInt nthreads)
 {
     // Check we don't deal with a null table.
     AlwaysAssert (!isNull(), AipsError);
@@ -788,7 +832,7 @@ BaseTable* BaseTable::select (const TableExprNode& node,
             return select (maxRow, offset);
         }
         // Select no rows.
-        return select(Vector<uInt>());
+        return select(Vector<rownr_t>());
     }
     // Now check if this table has been used for all columns.
     // Accept that the expression has no table, which can be the case for
@@ -802,31 +846,173 @@ BaseTable* BaseTable::select (const TableExprNode& node,
     //# Loop through all rows and add to reference table if true.
     //# Add the rownr of the root table (one may search a reference table).
     //# Adjust the row numbers to reflect row numbers in the root table.
+    //# If possible, column indices are used to find the rows to evaluate.
+    //# Otherwise rows for which the expression cannot be true (as derived
+    //# from the value ranges kept by the storage managers) are skipped.
+    //# The other rows are evaluated in batches. If a maximum number of
+    //# rows is given, a batch is not larger than needed to reach it.
     SPtrHolder<RefTable> resultTable (makeRefTable (True, 0));
-    Bool val;
-    uInt nrrow = nrow();
-    TableExprId id;
-    for (uInt i=0; i<nrrow; i++) {
-      id.setRownr (i);
-      node.get (id, val);
-      if (val) {
-        if (offset == 0) {
-          resultTable->addRownr (i);                  // add row
-          // Stop if max #rows reached (note that maxRow==0 means no limit).
-          if (resultTable->nrow() == maxRow) {
-            break;
+    // If the columns in the expression are indexed, only the rows found
+    // using the indices need to be evaluated (see TableIndexCache).
+    // They are only used if they reduce the number of rows considerably,
+    // because evaluating a batch of consecutive rows is much faster.
+    TableIndexCache* cache = indexCache();
+    if (cache != 0) {
+      Block<TableExprRange> ranges;
+      node.getRep()->ranges (ranges);
+      Vector<rownr_t> rows;
+      if (cache->findRows (ranges, rows)  &&  rows.size() <= nrow() / 4) {
+        for (rownr_t i=0; i<rows.size(); ++i) {
+          if (node.getBool (rows[i])) {
+            if (offset == 0) {
+              resultTable->addRownr (rows[i]);
+              if (resultTable->nrow() == maxRow) {
+                break;
+              }
+            } else {
+              offset--;
+            }
           }
-        } else {
-          // Skip first offset matching rows.
-          offset--;
         }
+        adjustRownrs (resultTable->nrow(), *(resultTable->rowStorage()),
+                      False);
+        return resultTable.transfer();
+      }
+    }
+#ifndef USE_THREADS
+    // The evaluation cannot be serialized where needed.
+    nthreads = 1;
+#endif
+    if (nthreads > 1) {
+      selectParallel (node, maxRow, offset, nthreads, *resultTable);
+      adjustRownrs (resultTable->nrow(), *(resultTable->rowStorage()), False);
+      return resultTable.transfer();
+    }
+    const uInt batchSize = 4096;
+    Block<Bool> vals(batchSize, False);
+    rownr_t nrrow = nrow();
+    rownr_t i = 0;
+    Bool done = False;
+    while (i < nrrow  &&  !done) {
+      rownr_t endRow = nrrow - 1;
+      if (! node.getRep()->mayBeTrue (i, endRow)) {
+        i = std::max (i, endRow) + 1;
+        continue;
+      }
+      endRow = std::max (i, endRow);
+      while (i <= endRow  &&  !done) {
+        uInt n = std::min (endRow - i + 1, rownr_t(batchSize));
+        if (maxRow > 0) {
+          n = std::min (rownr_t(n), maxRow - resultTable->nrow() + offset);
+        }
+        node.getRep()->getBoolBatch (i, n, vals.storage(), 0);
+        for (uInt j=0; j<n; j++) {
+          if (vals[j]) {
+            if (offset == 0) {
+              resultTable->addRownr (i+j);              // add row
+              // Stop if max #rows reached (note that maxRow==0 means no limit).
+              if (resultTable->nrow() == maxRow) {
+                done = True;
+                break;
+              }
+            } else {
+              // Skip first offset matching rows.
+              offset--;
+            }
+          }
+        }
+        i += n;
       }
     }
     adjustRownrs (resultTable->nrow(), *(resultTable->rowStorage()), False);
     return resultTable.transfer();
 }
 
-BaseTable* BaseTable::select (const Vector<uInt>& rownrs)
+void BaseTable::selectParallel (const TableExprNode& node,
+                                rownr_t maxRow, rownr_t offset,
+                                uInt nthreads, RefTable& resultTable)
+{
+    // Determine the batches of rows to evaluate, skipping the rows
+    // for which the expression cannot be true.
+    const uInt batchSize = 4096;
+    std::vector<std::pair<rownr_t,uInt> > batches;
+    rownr_t nrrow = nrow();
+    rownr_t i = 0;
+    while (i < nrrow) {
+      rownr_t endRow = nrrow - 1;
+      Bool mayBeTrue = node.getRep()->mayBeTrue (i, endRow);
+      endRow = std::max (i, endRow);
+      if (mayBeTrue) {
+        for (rownr_t st=i; st<=endRow; st+=batchSize) {
+          batches.push_back (std::make_pair
+                             (st, uInt(std::min (endRow - st + 1,
+                                                 rownr_t(batchSize)))));
+        }
+      }
+      i = endRow + 1;
+    }
+    // Evaluate a number of batches at a time, so the selection can stop
+    // early when the maximum number of rows is reached.
+    const Int nbatch = 4 * nthreads;
+    std::vector<std::vector<rownr_t> > found(nbatch);
+    Bool done = False;
+    for (size_t b=0; b<batches.size()  &&  !done; b+=nbatch) {
+      Int nb = std::min (size_t(nbatch), batches.size() - b);
+      // Exceptions cannot be thrown out of a parallel region, so keep
+      // the first one and rethrow it thereafter.
+      std::exception_ptr excp;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+      {
+        Block<Bool> vals(batchSize, False);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (Int k=0; k<nb; ++k) {
+          found[k].clear();
+          try {
+            rownr_t startRow = batches[b+k].first;
+            uInt n = batches[b+k].second;
+            node.getRep()->getBoolBatch (startRow, n, vals.storage(), 0);
+            for (uInt j=0; j<n; ++j) {
+              if (vals[j]) {
+                found[k].push_back (startRow + j);
+              }
+            }
+          } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(BaseTable_selectParallel)
+#endif
+            {
+              if (!excp) {
+                excp = std::current_exception();
+              }
+            }
+          }
+        }
+      }
+      if (excp) {
+        std::rethrow_exception (excp);
+      }
+      // Merge the results in row order.
+      for (Int k=0; k<nb  &&  !done; ++k) {
+        for (size_t j=0; j<found[k].size(); ++j) {
+          if (offset == 0) {
+            resultTable.addRownr (found[k][j]);
+            if (resultTable.nrow() == maxRow) {
+              done = True;
+              break;
+            }
+          } else {
+            offset--;
+          }
+        }
+      }
+    }
+}
+
+BaseTable* BaseTable::select (const Vector<rownr_t>& rownrs)
 {
     AlwaysAssert (!isNull(), AipsError);
     RefTable* rtp = new RefTable(this, rownrs);
@@ -866,10 +1052,10 @@ BaseTable* BaseTable::tabAnd (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refAnd (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -897,10 +1083,10 @@ BaseTable* BaseTable::tabOr (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refOr (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -931,10 +1117,10 @@ BaseTable* BaseTable::tabSub (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refSub (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -964,10 +1150,10 @@ BaseTable* BaseTable::tabXor (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refXor (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -992,8 +1178,8 @@ BaseTable* BaseTable::tabNot()
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted.
     Bool allsw1;
-    uInt* inx1;
-    uInt nr1 = this->logicRows (inx1, allsw1);
+    rownr_t* inx1;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refNot (nr1, inx1, root()->nrow());    // store rownrs in new RefTable
     if (allsw1) {
@@ -1013,18 +1199,18 @@ void BaseTable::logicCheck (BaseTable* that)
 //# Get the rownrs from the reference table.
 //# Note that rowStorage() throws an exception if it is not a RefTable.
 //# Sort them if not in row order.
-uInt BaseTable::logicRows (uInt*& inx, Bool& allsw)
+rownr_t BaseTable::logicRows (rownr_t*& inx, Bool& allsw)
 {
     AlwaysAssert (!isNull(), AipsError);
     allsw = False;
     inx = RefTable::getStorage (*rowStorage());
-    uInt nr = nrow();
+    rownr_t nr = nrow();
     if (!rowOrder()) {
 	//# rows are not in order, so sort them.
 	//# They have to be copied, because the original should not be changed.
-	uInt* inxcp = new uInt[nr];
+	rownr_t* inxcp = new rownr_t[nr];
 	objcopy (inxcp, inx, nr);
-	GenSort<uInt>::sort (inxcp, nr);
+	GenSort<rownr_t>::sort (inxcp, nr);
 	inx = inxcp;
 	allsw = True;
     }
@@ -1084,7 +1270,7 @@ Bool BaseTable::checkRemoveColumn (const Vector<String>& columnNames,
     return True;
 }
 
-void BaseTable::checkRowNumberThrow (uInt rownr) const
+void BaseTable::checkRowNumberThrow (rownr_t rownr) const
 {
     throw (TableError ("TableColumn: row number " + String::toString(rownr) +
 		       " exceeds #rows " +
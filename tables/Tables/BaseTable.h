@@ -38,6 +38,7 @@
 #include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/IO/FileLocker.h>
+#include <casacore/casa/OS/Mutex.h>
 
 #ifdef HAVE_MPI
 #include <mpi.h>
@@ -56,6 +57,7 @@ class Record;
 class TableExprNode;
 class BaseTableIterator;
 class DataManager;
+class TableIndexCache;
 class IPosition;
 template<class T> class Vector;
 template<class T> class Block;
@@ -105,15 +107,15 @@ class BaseTable
 public:
 
     // Initialize the object.
-    BaseTable (const String& tableName, int tableOption, uInt nrrow);
+    BaseTable (const String& tableName, int tableOption, rownr_t nrrow);
 
 #ifdef HAVE_MPI
     // MPI version of the constructor
-    BaseTable (MPI_Comm mpiComm, const String& tableName, int tableOption, uInt nrrow);
+    BaseTable (MPI_Comm mpiComm, const String& tableName, int tableOption, rownr_t nrrow);
 #endif
 
     // Common code shared by the MPI constructor and non-MPI constructor
-    void BaseTableCommon (const String& tableName, int tableOption, uInt nrrow);
+    void BaseTableCommon (const String& tableName, int tableOption, rownr_t nrrow);
 
     virtual ~BaseTable();
 
@@ -171,6 +173,29 @@ public:
     // Set the table to being changed. By default it does nothing.
     virtual void setTableChanged();
 
+    // Get the cache of column indices used to speed up a selection.
+    // By default a null pointer is returned, meaning that the table type
+    // does not support it. Only plain and memory tables support it, because
+    // only for them all changes of the column data can be tracked.
+    virtual TableIndexCache* indexCache();
+
+    // Get the mutex serializing the access to the table when a TaQL
+    // expression is evaluated by multiple threads. Columns in the same
+    // table share the data managers, so they cannot be read in parallel.
+    Mutex& exprMutex()
+        { return exprMutex_p; }
+
+    // Tell the index cache (if any) that the data in the given column or
+    // in all columns have changed.
+    // <group>
+    void setIndexChanged (const String& columnName);
+    void setIndexChanged();
+    // </group>
+
+    // Remove all indices from the index cache (if any), which is needed if
+    // columns are removed or renamed.
+    void clearIndexCache();
+
     // Do not write the table (used in in case of exceptions).
     void doNotWrite()
 	{ noWrite_p = True; }
@@ -306,7 +331,7 @@ public:
     virtual void flushTableInfo();
 
     // Get number of rows.
-    uInt nrow() const
+    rownr_t nrow() const
 	{ return nrrow_p; }
 
     // Get a column object using its index.
@@ -320,7 +345,7 @@ public:
 
     // Add one or more rows and possibly initialize them.
     // This will fail for tables not supporting addition of rows.
-    virtual void addRow (uInt nrrow = 1, Bool initialize = True);
+    virtual void addRow (rownr_t nrrow = 1, Bool initialize = True);
 
     // Test if it is possible to remove a row from this table.
     virtual Bool canRemoveRow() const;
@@ -342,8 +367,8 @@ public:
     // row 21 into row 20.
     // </note>
     // <group>
-    virtual void removeRow (uInt rownr);
-    void removeRow (const Vector<uInt>& rownrs);
+    virtual void removeRow (rownr_t rownr);
+    void removeRow (const Vector<rownr_t>& rownrs);
     // </group>
 
     // Find the data manager with the given name or for the given column.
@@ -353,13 +378,16 @@ public:
     // Select rows using the given expression (which can be null).
     // Skip first <src>offset</src> matching rows.
     // Return at most <src>maxRow</src> matching rows.
-    BaseTable* select (const TableExprNode&, uInt maxRow, uInt offset);
+    // If <src>nthreads>1</src>, the batches of rows are evaluated in
+    // parallel (see selectParallel).
+    BaseTable* select (const TableExprNode&, rownr_t maxRow, rownr_t offset,
+                       uInt nthreads=1);
 
     // Select maxRow rows and skip first offset rows. maxRow=0 means all.
-    BaseTable* select (uInt maxRow, uInt offset);
+    BaseTable* select (rownr_t maxRow, rownr_t offset);
 
     // Select rows using a vector of row numbers.
-    BaseTable* select (const Vector<uInt>& rownrs);
+    BaseTable* select (const Vector<rownr_t>& rownrs);
 
     // Select rows using a mask block.
     // The length of the block must match the number of rows in the table.
@@ -442,7 +470,7 @@ public:
     // Get a vector of row numbers.
     // By default it returns the row numbers 0..nrrow()-1.
     // It needs to be implemented for RefTable only.
-    virtual Vector<uInt> rowNumbers() const;
+    virtual Vector<rownr_t> rowNumbers() const;
 
     // Get pointer to root table (i.e. parent of a RefTable).
     // Default it is this table.
@@ -458,12 +486,12 @@ public:
 
     // By the default the table cannot return the storage of rownrs.
     // That can only be done by a RefTable, where it is implemented.
-    virtual Vector<uInt>* rowStorage();
+    virtual Vector<rownr_t>* rowStorage();
 
     // Adjust the row numbers to be the actual row numbers in the
     // root table. This is, for instance, used when a RefTable is sorted.
     // Optionally it also determines if the resulting rows are in order.
-    virtual Bool adjustRownrs (uInt nrrow, Vector<uInt>& rownrs,
+    virtual Bool adjustRownrs (rownr_t nrrow, Vector<rownr_t>& rownrs,
 			       Bool determineOrder) const;
 
     // Do the actual sort.
@@ -475,11 +503,11 @@ public:
 			       int sortOption);
 
     // Create a RefTable object.
-    RefTable* makeRefTable (Bool rowOrder, uInt initialNrrow);
+    RefTable* makeRefTable (Bool rowOrder, rownr_t initialNrrow);
 
     // Check if the row number is valid.
     // It throws an exception if out of range.
-    void checkRowNumber (uInt rownr) const
+    void checkRowNumber (rownr_t rownr) const
         { if (rownr >= nrrow_p + nrrowToAdd_p) checkRowNumberThrow (rownr); }
 
     // Get the table's trace-id.
@@ -489,8 +517,8 @@ public:
 
 protected:
     uInt           nrlink_p;            //# #references to this table
-    uInt           nrrow_p;             //# #rows in this table
-    uInt           nrrowToAdd_p;        //# #rows to be added
+    rownr_t        nrrow_p;             //# #rows in this table
+    rownr_t        nrrowToAdd_p;        //# #rows to be added
     TableDesc*     tdescPtr_p;          //# Pointer to table description
     String         name_p;              //# table name
     int            option_p;            //# Table constructor option
@@ -499,6 +527,8 @@ protected:
     TableInfo      info_p;              //# Table information (type, etc.)
     Bool           madeDir_p;           //# True = table dir has been created
     int            itsTraceId;          //# table-id for TableTrace tracing
+    TableIndexCache* indexCache_p;      //# Column indices used in select
+    Mutex          exprMutex_p;         //# Serializes parallel TaQL access
 
 
     // Do the callback for scratch tables (if callback is set).
@@ -570,7 +600,15 @@ private:
                          Bool cOrder) const;
 
     // Throw an exception for checkRowNumber.
-    void checkRowNumberThrow (uInt rownr) const;
+    void checkRowNumberThrow (rownr_t rownr) const;
+
+    // Select the rows matching the expression using multiple threads
+    // and add them to the result table. The rows are divided in batches
+    // which are evaluated in parallel (using TableExprNodeRep::getBoolBatch).
+    // The matching rows of the batches are merged in row order.
+    void selectParallel (const TableExprNode&, rownr_t maxRow,
+                         rownr_t offset, uInt nthreads,
+                         RefTable& resultTable);
 
     // Check if the tables combined in a logical operation have the
     // same root.
@@ -578,7 +616,7 @@ private:
 
     // Get the rownrs of the table in ascending order to be
     // used in the logical operation on the table.
-    uInt logicRows (uInt*& rownrs, Bool& allocated);
+    rownr_t logicRows (rownr_t*& rownrs, Bool& allocated);
 
     // Make an empty table description.
     // This is used if one asks for the description of a NullTable.
@@ -108,7 +108,7 @@ void ColumnSet::removeLastDataManager()
     seqCount_p--;
 }
 
-void ColumnSet::initDataManagers (uInt nrrow, Bool bigEndian,
+void ColumnSet::initDataManagers (rownr_t nrrow, Bool bigEndian,
                                   const TSMOption& tsmOption,
                                   Table& tab)
 {
@@ -202,7 +202,7 @@ void ColumnSet::openMultiFile (uInt from, const Table& tab,
   }
 }
 
-uInt ColumnSet::resync (uInt nrrow, Bool forceSync)
+uInt ColumnSet::resync (rownr_t nrrow, Bool forceSync)
 {
     //# There may be no sync data (when new table locked for first time).
     if (dataManChanged_p.nelements() > 0) {
@@ -210,7 +210,7 @@ uInt ColumnSet::resync (uInt nrrow, Bool forceSync)
 		                   blockDataMan_p.nelements(), AipsError);
 	for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
 	    if (dataManChanged_p[i]  ||  nrrow != nrrow_p  ||  forceSync) {
-                uInt nrr = BLOCKDATAMANVAL(i)->resync1 (nrrow);
+                rownr_t nrr = BLOCKDATAMANVAL(i)->resync1 (nrrow);
                 if (nrr > nrrow) {
                     nrrow = nrr;
                 }
@@ -274,7 +274,7 @@ Bool ColumnSet::canRenameColumn (const String& columnName) const
 
 
 //# Add rows to all data managers.
-void ColumnSet::addRow (uInt nrrow)
+void ColumnSet::addRow (rownr_t nrrow)
 {
     // First add row to storage managers, thereafter to virtual engines.
     for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
@@ -290,7 +290,7 @@ void ColumnSet::addRow (uInt nrrow)
     nrrow_p += nrrow;
 }
 //# Remove a row from all data managers.
-void ColumnSet::removeRow (uInt rownr)
+void ColumnSet::removeRow (rownr_t rownr)
 {
     if (!canRemoveRow()) {
 	throw (TableInvOper ("Rows cannot be removed from table " +
@@ -720,7 +720,7 @@ Record ColumnSet::dataManagerInfo (Bool virtualOnly) const
 
 
 //# Initialize rows.
-void ColumnSet::initialize (uInt startRow, uInt endRow)
+void ColumnSet::initialize (rownr_t startRow, rownr_t endRow)
 {
     for (uInt i=0; i<colMap_p.size(); i++) {
         getColumn(i)->initialize (startRow, endRow);
@@ -778,7 +778,7 @@ Bool ColumnSet::putFile (Bool writeTable, AipsIO& ios,
 	//# (because nrrow_p is always positive).
         // Still use version 2 if MultiFile is not used and #rows fit in a uInt.
         if (storageOpt_p.option() != StorageOption::SepFile  ||
-            nrrow_p > Int64(std::numeric_limits<uInt>::max())) {
+            nrrow_p > rownr_t(std::numeric_limits<uInt>::max())) {
           ios << Int(-3);          // version (must be negative !!!)
           ios << nrrow_p;
           ios << Int(storageOpt_p.option()) << storageOpt_p.blockSize();
@@ -828,7 +828,7 @@ Bool ColumnSet::putFile (Bool writeTable, AipsIO& ios,
 }
 
 
-uInt ColumnSet::getFile (AipsIO& ios, Table& tab, uInt nrrow, Bool bigEndian,
+uInt ColumnSet::getFile (AipsIO& ios, Table& tab, rownr_t nrrow, Bool bigEndian,
                          const TSMOption& tsmOption)
 {
     //# If the first value is negative, it is the version.
@@ -904,7 +904,7 @@ uInt ColumnSet::getFile (AipsIO& ios, Table& tab, uInt nrrow, Bool bigEndian,
 	ios.getnew (leng, data);
 	MemoryIO memio (data, leng);
 	AipsIO aio(&memio);
-	uInt nrrow = BLOCKDATAMANVAL(i)->open1 (nrrow_p, aio);
+	rownr_t nrrow = BLOCKDATAMANVAL(i)->open1 (nrrow_p, aio);
         if (nrrow > nrrow_p) {
           nrrow_p = nrrow;
         }
@@ -66,31 +66,34 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return keywordSet_p;
   }
 
-  uInt ConcatColumn::nrow() const
+  rownr_t ConcatColumn::nrow() const
   {
     return refTabPtr_p->nrow();
   }
 
-  void ConcatColumn::initialize (uInt startRow, uInt endRow)
+  void ConcatColumn::initialize (rownr_t startRow, rownr_t endRow)
   {
-    uInt tableNr, tabRownr;
-    for (uInt i=startRow; i<endRow; ++i) {
+    uInt tableNr;
+    rownr_t tabRownr;
+    for (rownr_t i=startRow; i<endRow; ++i) {
       refTabPtr_p->rows().mapRownr (tableNr, tabRownr, i);
       refColPtr_p[tableNr]->initialize (tabRownr, tabRownr);
     }
   }
 
-  void ConcatColumn::setShape (uInt rownr, const IPosition& shape)
+  void ConcatColumn::setShape (rownr_t rownr, const IPosition& shape)
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     refColPtr_p[tableNr]->setShape (tabRownr, shape);
   }
 
-  void ConcatColumn::setShape (uInt rownr, const IPosition& shape,
+  void ConcatColumn::setShape (rownr_t rownr, const IPosition& shape,
 			       const IPosition& tileShape)
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     refColPtr_p[tableNr]->setShape (tabRownr, shape, tileShape);
   }
@@ -105,30 +108,34 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return refColPtr_p[0]->shapeColumn();
   }
 
-  uInt ConcatColumn::ndim (uInt rownr) const
+  uInt ConcatColumn::ndim (rownr_t rownr) const
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     return refColPtr_p[tableNr]->ndim (tabRownr);
   }
 
-  IPosition ConcatColumn::shape(uInt rownr) const
+  IPosition ConcatColumn::shape(rownr_t rownr) const
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     return refColPtr_p[tableNr]->shape (tabRownr);
   }
 
-  IPosition ConcatColumn::tileShape(uInt rownr) const
+  IPosition ConcatColumn::tileShape(rownr_t rownr) const
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     return refColPtr_p[tableNr]->tileShape (tabRownr);
   }
 
-  Bool ConcatColumn::isDefined (uInt rownr) const
+  Bool ConcatColumn::isDefined (rownr_t rownr) const
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     return refColPtr_p[tableNr]->isDefined (tabRownr);
   }
@@ -165,36 +172,40 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
-  void ConcatColumn::get (uInt rownr, void* dataPtr) const
+  void ConcatColumn::get (rownr_t rownr, void* dataPtr) const
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     refColPtr_p[tableNr]->get (tabRownr, dataPtr);
     // Set the column cache to the table used.
     ///setColumnCache (tableNr, refColPtr_p[tableNr]->columnCache());
   }
 
-  void ConcatColumn::getSlice (uInt rownr, const Slicer& ns,
+  void ConcatColumn::getSlice (rownr_t rownr, const Slicer& ns,
 			       void* dataPtr) const
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     refColPtr_p[tableNr]->getSlice (tabRownr, ns, dataPtr);
   }
 
-  void ConcatColumn::put (uInt rownr, const void* dataPtr)
+  void ConcatColumn::put (rownr_t rownr, const void* dataPtr)
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     refColPtr_p[tableNr]->put (tabRownr, dataPtr);
     // Set the column cache to the table used.
     ///setColumnCache (tableNr, refColPtr_p[tableNr]->columnCache());
   }
 
-  void ConcatColumn::putSlice (uInt rownr, const Slicer& ns,
+  void ConcatColumn::putSlice (rownr_t rownr, const Slicer& ns,
 			       const void* dataPtr)
   {
-    uInt tableNr, tabRownr;
+    uInt tableNr;
+    rownr_t tabRownr;
     refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
     refColPtr_p[tableNr]->putSlice (tabRownr, ns, dataPtr);
   }
@@ -272,7 +283,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     uInt nlast = arr.ndim() - 1;
     CountedPtr<ArrayBase> part;
     for (uInt i=0; i<refColPtr_p.nelements(); ++i) {
-      uInt nr = refColPtr_p[i]->nrow();
+      rownr_t nr = refColPtr_p[i]->nrow();
       sz[nlast] = nr;
       // Store in CountedPtr, so deleted in case of exception.
       part = arr.getSection (Slicer(st, sz));
@@ -288,7 +299,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     ArrayBase& arr = *static_cast<ArrayBase*>(dataPtr);
     // The rows to access.
-    Vector<uInt> rows = rownrs.convert();
+    Vector<rownr_t> rows = rownrs.convert();
     // We have one or more slices of rows.
     // Try to access them also in a sliced way, because that is faster.
     // First make resources.
@@ -298,7 +309,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     CountedPtr<ArrayBase> part;
     // The RefRows vector for the rownrs to be handled in an underlying table.
     // Make it as large as needed to avoid resizes.
-    Vector<uInt> tabRowNrs(rows.nelements());
+    Vector<rownr_t> tabRowNrs(rows.nelements());
     // The rows are handled by combining them as much as possible in a RefRows
     // slice. This is possible until a different underlying table needs to
     // be accessed.
@@ -309,16 +320,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int lastTabNr = -1;
     uInt tableNr;
     // Step through all concat rownrs.
-    for (uInt i=0; i<rows.nelements(); ++i) {
+    for (rownr_t i=0; i<rows.nelements(); ++i) {
       // Map to the table and rownr in it.
       ccRows.mapRownr (tableNr, tabRowNrs[i], rows[i]);
       // An access has to be done if we have another table.
       if (Int(tableNr) != lastTabNr) {
 	// Access the cells if not the first time.
 	if (lastTabNr >= 0) {
-	  uInt nrrow = i - st[rowAxis];
+	  rownr_t nrrow = i - st[rowAxis];
 	  sz[rowAxis] = nrrow;
-	  Vector<uInt> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
+	  Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
 	  part = arr.getSection (Slicer(st, sz));
 	  accessFunc (refColPtr_p[lastTabNr], RefRows(rowPart), ns,
 		      part.operator->());
@@ -328,9 +339,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
     }
     if (lastTabNr >= 0) {
-      uInt nrrow = rows.nelements() - st[rowAxis];
+      rownr_t nrrow = rows.nelements() - st[rowAxis];
       sz[rowAxis] = nrrow;
-      Vector<uInt> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
+      Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
       part = arr.getSection (Slicer(st, sz));
       accessFunc (refColPtr_p[lastTabNr], RefRows(rowPart), ns,
 		  part.operator->());
@@ -29,20 +29,22 @@
 #include <casacore/tables/Tables/ConcatRows.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/BinarySearch.h>
+#include <limits>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
-  void ConcatRows::add (uInt nrow)
+  void ConcatRows::add (rownr_t nrow)
   {
-    if (Int64(nrow) + itsRows[itsNTable] >= Int64(65536)*65536) {
-      throw TableError ("Concatenation of tables exceeds 2**32 rows");
+    if (nrow > std::numeric_limits<rownr_t>::max() - itsRows[itsNTable]) {
+      throw TableError ("Concatenation of tables exceeds the maximum "
+                        "number of rows");
     }
     itsNTable++;
     itsRows.resize (itsNTable+1);
     itsRows[itsNTable] = itsRows[itsNTable-1] + nrow;
   }
 
-  void ConcatRows::findRownr (uInt rownr) const
+  void ConcatRows::findRownr (rownr_t rownr) const
   {
     if (rownr >= itsRows[itsNTable]) {
       throw TableError ("ConcatTable: rownr " + String::toString(rownr) +
@@ -78,7 +80,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
     // Construct the iterator on a ConcatRows object for the given row range.
   ConcatRowsIter::ConcatRowsIter (const ConcatRows& rows,
-				  uInt start, uInt end, uInt incr)
+				  rownr_t start, rownr_t end, rownr_t incr)
     : itsRows  (&rows),
       itsChunk (3),
       itsStart (start),
@@ -104,7 +106,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       } else {
 	itsChunk[0] = 0;
 	if (itsIncr != 1) {
-	  uInt rem = ((*itsRows)[itsPos] - itsStart) % itsIncr;
+	  rownr_t rem = ((*itsRows)[itsPos] - itsStart) % itsIncr;
 	  if (rem != 0) {
 	    itsChunk[0] = itsIncr - rem;
 	  }
@@ -31,6 +31,7 @@
 #include <casacore/tables/Tables/TableLockData.h>
 #include <casacore/tables/Tables/ColumnSet.h>
 #include <casacore/tables/Tables/PlainColumn.h>
+#include <casacore/tables/Tables/TableIndexCache.h>
 #include <casacore/tables/DataMan/MemoryStMan.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Containers/Record.h>
@@ -40,7 +41,7 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
-MemoryTable::MemoryTable (SetupNewTable& newtab, uInt nrrow, Bool initialize)
+MemoryTable::MemoryTable (SetupNewTable& newtab, rownr_t nrrow, Bool initialize)
 : BaseTable   (newtab.name(), newtab.option(), 0),
   colSetPtr_p (0),
   lockPtr_p   (0)
@@ -147,6 +148,14 @@ void MemoryTable::resync()
   return 0;
 }
 
+TableIndexCache* MemoryTable::indexCache()
+{
+  if (indexCache_p == 0) {
+    indexCache_p = new TableIndexCache (Table(this, False));
+  }
+  return indexCache_p;
+}
+
 Bool MemoryTable::isWritable() const
 {
   return True;
@@ -220,7 +229,7 @@ Bool MemoryTable::canAddRow() const
   return True;
 }
 
-void MemoryTable::addRow (uInt nrrw, Bool initialize)
+void MemoryTable::addRow (rownr_t nrrw, Bool initialize)
 {
   if (nrrw > 0) {
     nrrowToAdd_p = nrrw;
@@ -238,10 +247,11 @@ Bool MemoryTable::canRemoveRow() const
   return True;
 }
 
-void MemoryTable::removeRow (uInt rownr)
+void MemoryTable::removeRow (rownr_t rownr)
 {
   colSetPtr_p->removeRow (rownr);
   nrrow_p--;
+  setIndexChanged();
 }
 
 void MemoryTable::addColumn (const ColumnDesc& columnDesc, Bool)
@@ -304,6 +314,7 @@ Bool MemoryTable::canRemoveColumn (const Vector<String>&) const
 void MemoryTable::removeColumn (const Vector<String>& columnNames)
 {
   colSetPtr_p->removeColumn (columnNames);
+  clearIndexCache();
 }
 
 Bool MemoryTable::canRenameColumn (const String&) const
@@ -314,6 +325,7 @@ Bool MemoryTable::canRenameColumn (const String&) const
 void MemoryTable::renameColumn (const String& newName, const String& oldName)
 {
   colSetPtr_p->renameColumn (newName, oldName);
+  clearIndexCache();
 }
 
 void MemoryTable::renameHypercolumn (const String& newName, const String& oldName)
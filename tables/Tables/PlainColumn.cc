@@ -55,7 +55,7 @@ PlainColumn::~PlainColumn()
 {}
 
 
-uInt PlainColumn:: nrow() const
+rownr_t PlainColumn:: nrow() const
     { return colSetPtr_p->nrow(); }
 
 
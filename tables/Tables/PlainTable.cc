@@ -35,6 +35,7 @@
 #include <casacore/tables/Tables/ColumnSet.h>
 #include <casacore/tables/Tables/TableTrace.h>
 #include <casacore/tables/Tables/PlainColumn.h>
+#include <casacore/tables/Tables/TableIndexCache.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/Record.h>
@@ -49,7 +50,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Initialize the static TableCache object.
 TableCache PlainTable::theirTableCache;
 
-PlainTable::PlainTable (SetupNewTable& newtab, uInt nrrow, Bool initialize,
+PlainTable::PlainTable (SetupNewTable& newtab, rownr_t nrrow, Bool initialize,
         const TableLock& lockOptions, int endianFormat,
         const TSMOption& tsmOption)
     : BaseTable (newtab.name(), newtab.option(), 0)
@@ -59,7 +60,7 @@ PlainTable::PlainTable (SetupNewTable& newtab, uInt nrrow, Bool initialize,
 }
 
 #ifdef HAVE_MPI
-PlainTable::PlainTable (MPI_Comm mpiComm, SetupNewTable& newtab, uInt nrrow,
+PlainTable::PlainTable (MPI_Comm mpiComm, SetupNewTable& newtab, rownr_t nrrow,
         Bool initialize, const TableLock& lockOptions, int endianFormat,
         const TSMOption& tsmOption)
     : BaseTable (mpiComm, newtab.name(), newtab.option(), 0)
@@ -69,7 +70,7 @@ PlainTable::PlainTable (MPI_Comm mpiComm, SetupNewTable& newtab, uInt nrrow,
 }
 #endif
 
-void PlainTable::PlainTableCommon (SetupNewTable& newtab, uInt nrrow,
+void PlainTable::PlainTableCommon (SetupNewTable& newtab, rownr_t nrrow,
         Bool initialize, const TableLock& lockOptions, int endianFormat,
         const TSMOption& tsmOption)
 {
@@ -169,7 +170,7 @@ void PlainTable::PlainTableCommon (SetupNewTable& newtab, uInt nrrow,
 }
 
 PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
-			const String& type, uInt nrrow, int opt,
+			const String& type, rownr_t nrrow, int opt,
 			const TableLock& lockOptions,
                         const TSMOption& tsmOption,
 			Bool addToCache, uInt locknr)
@@ -214,7 +215,13 @@ PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
     String tp;
     version = ios.getstart ("Table");
     uInt format;
-    ios >> nrrow;
+    if (version > 2) {
+        ios >> nrrow;
+    } else {
+        uInt nrrow32;
+        ios >> nrrow32;
+        nrrow = nrrow32;
+    }
     ios >> format;
     bigEndian_p = (format==0);
     ios >> tp;
@@ -435,7 +442,7 @@ Bool PlainTable::lock (FileLocker::LockType type, uInt nattempts)
 	    // Older readonly table files may have empty locksync data.
 	    // Skip the sync-ing in that case.
 	    uInt ncolumn;
-            uInt nrrow;
+            rownr_t nrrow;
 	    if (! lockSync_p.read (nrrow, ncolumn, tableChanged,
 				   colSetPtr_p->dataManChanged())) {
 		tableChanged = False;
@@ -499,6 +506,14 @@ uInt PlainTable::getModifyCounter() const
     return lockSync_p.getModifyCounter();
 }
 
+TableIndexCache* PlainTable::indexCache()
+{
+    if (indexCache_p == 0) {
+        indexCache_p = new TableIndexCache (Table(this, False));
+    }
+    return indexCache_p;
+}
+
 
 void PlainTable::flush (Bool fsync, Bool recursive)
 {
@@ -519,7 +534,7 @@ void PlainTable::resync()
     // Older readonly table files may have empty locksync data.
     // Skip the sync-ing in that case.
     uInt ncolumn;
-    uInt nrrow;
+    rownr_t nrrow;
     if (! lockSync_p.read (nrrow, ncolumn, tableChanged,
 			   colSetPtr_p->dataManChanged())) {
         tableChanged = False;
@@ -665,7 +680,7 @@ Bool PlainTable::canRenameColumn (const String& columnName) const
 
 
 //# Add rows.
-void PlainTable::addRow (uInt nrrw, Bool initialize)
+void PlainTable::addRow (rownr_t nrrw, Bool initialize)
 {
     if (nrrw > 0) {
         checkWritable("addRow");
@@ -683,7 +698,7 @@ void PlainTable::addRow (uInt nrrw, Bool initialize)
     }
 }
 
-void PlainTable::removeRow (uInt rownr)
+void PlainTable::removeRow (rownr_t rownr)
 {
     checkWritable("rowmoveRow");
     //# Locking has to be done here, otherwise nrrow_p is not up-to-date
@@ -691,6 +706,7 @@ void PlainTable::removeRow (uInt rownr)
     colSetPtr_p->checkWriteLock (True);
     colSetPtr_p->removeRow (rownr);
     nrrow_p--;
+    setIndexChanged();
     colSetPtr_p->autoReleaseLock();
 }
 
@@ -733,6 +749,7 @@ void PlainTable::removeColumn (const Vector<String>& columnNames)
 {
     checkWritable("removeColumn");
     colSetPtr_p->removeColumn (columnNames);
+    clearIndexCache();
     tableChanged_p = True;
 }
 
@@ -740,6 +757,7 @@ void PlainTable::renameColumn (const String& newName, const String& oldName)
 {
     checkWritable("renameColumn");
     colSetPtr_p->renameColumn (newName, oldName);
+    clearIndexCache();
     tableChanged_p = True;
 }
 
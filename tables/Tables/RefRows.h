@@ -92,11 +92,17 @@ public:
     // slices in the form start,end,incr.
     // When <src>collapse==True</src>, it will try to collapse the
     // individual row numbers to the slice form (to save memory).
+    // The constructor taking a Vector<uInt> is meant for backward
+    // compatibility with 32-bit row numbers.
+    // <group>
+    RefRows (const Vector<rownr_t>& rowNumbers, Bool isSliced = False,
+	     Bool collapse = False);
     RefRows (const Vector<uInt>& rowNumbers, Bool isSliced = False,
 	     Bool collapse = False);
+    // </group>
 
     // Create the object from a single start,end,incr slice.
-    RefRows (uInt start, uInt end, uInt incr=1);
+    RefRows (rownr_t start, rownr_t end, rownr_t incr=1);
 
     // Copy constructor (reference semantics).
     RefRows (const RefRows& other);
@@ -109,27 +115,27 @@ public:
     // Do this and the other object reference the same rows?
     Bool operator== (const RefRows& other) const;
 
-    // Convert this object to a Vector<uInt> by applying the given row numbers.
-    // It is used to convert the RefRows object with row numbers in a
-    // RefTable to row numbers in the original root table.
-    Vector<uInt> convert (const Vector<uInt>& rootRownrs) const;
+    // Convert this object to a Vector<rownr_t> by applying the given
+    // row numbers. It is used to convert the RefRows object with row numbers
+    // in a RefTable to row numbers in the original root table.
+    Vector<rownr_t> convert (const Vector<rownr_t>& rootRownrs) const;
 
-    // Convert this object to a Vector<uInt> by de-slicing it.
+    // Convert this object to a Vector<rownr_t> by de-slicing it.
     // I.e. it linearizes the row numbers.
-    Vector<uInt> convert() const;
+    Vector<rownr_t> convert() const;
 
     // Return the number of rows given by this object.
     // If the object contains slices, it counts the number of rows
     // represented by each slice.
     // <group>
-    uInt nrows() const
+    rownr_t nrows() const
         { return (itsNrows == 0  ?  fillNrows() : itsNrows); }
-    uInt nrow() const
+    rownr_t nrow() const
         { return (itsNrows == 0  ?  fillNrows() : itsNrows); }
     // </group>
 
     // Return the first row in the object.
-    uInt firstRow() const
+    rownr_t firstRow() const
         { return itsRows(0); }
 
     // Represents the vector a slice?
@@ -139,15 +145,15 @@ public:
     // Get the row vector as is (thus sliced if the object contains slices).
     // It is mainly useful to get all row numbers when the object does not
     // contain slices.
-    const Vector<uInt>& rowVector() const
+    const Vector<rownr_t>& rowVector() const
         { return itsRows; }
 
 private:
     // Fill the itsNrows variable.
-    uInt fillNrows() const;
+    rownr_t fillNrows() const;
 
-    Vector<uInt> itsRows;
-    uInt         itsNrows;            //# 0 = still unknown
+    Vector<rownr_t> itsRows;
+    rownr_t      itsNrows;            //# 0 = still unknown
     Bool         itsSliced;           //# True = vector contains slices
 };
 
@@ -186,9 +192,9 @@ private:
 //   RefRowsSliceIter rowiter(rownrs);
 //   while (! rowiter.pastEnd()) {
 //     // Get start, end, and increment for this slice.
-//     uInt rownr = rowiter.sliceStart();
-//     uInt end = rowiter.sliceEnd();
-//     uInt incr = rowiter.sliceIncr();
+//     rownr_t rownr = rowiter.sliceStart();
+//     rownr_t end = rowiter.sliceEnd();
+//     rownr_t incr = rowiter.sliceIncr();
 //     // Iterate through the row numbers in the slice.
 //     while (rownr <= end) {
 //       rownr += incr;
@@ -230,21 +236,21 @@ public:
 
     // Get the current slice start, end, or increment.
     // <group>
-    uInt sliceStart() const
+    rownr_t sliceStart() const
         { return itsStart; }
-    uInt sliceEnd() const
+    rownr_t sliceEnd() const
         { return itsEnd; }
-    uInt sliceIncr() const
+    rownr_t sliceIncr() const
         { return itsIncr; }
     // </group>
 
 private:
-    Vector<uInt> itsRows;
+    Vector<rownr_t> itsRows;
     Bool         itsSliced;
-    uInt         itsStart;
-    uInt         itsEnd;
-    uInt         itsIncr;
-    uInt         itsPos;
+    rownr_t      itsStart;
+    rownr_t      itsEnd;
+    rownr_t      itsIncr;
+    rownr_t      itsPos;
     Bool         itsPastEnd;
 };
 
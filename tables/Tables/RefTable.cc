@@ -40,10 +40,11 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/STLIO.h>
+#include <limits>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
-RefTable::RefTable (AipsIO& ios, const String& name, uInt nrrow, int opt,
+RefTable::RefTable (AipsIO& ios, const String& name, rownr_t nrrow, int opt,
 		    const TableLock& lockOptions, const TSMOption& tsmOption)
 : BaseTable    (name, opt, nrrow),
   rowStorage_p (0),              // initially empty vector of rownrs
@@ -60,7 +61,7 @@ RefTable::RefTable (AipsIO& ios, const String& name, uInt nrrow, int opt,
 }
 
 
-RefTable::RefTable (BaseTable* btp, Bool order, uInt nrall)
+RefTable::RefTable (BaseTable* btp, Bool order, rownr_t nrall)
 : BaseTable    ("", Table::Scratch, nrall),
   baseTabPtr_p (btp->root()),
   rowOrd_p     (order),
@@ -77,7 +78,7 @@ RefTable::RefTable (BaseTable* btp, Bool order, uInt nrall)
     TableTrace::traceRefTable (baseTabPtr_p->tableName(), 's');
 }
 
-RefTable::RefTable (BaseTable* btp, const Vector<uInt>& rownrs)
+RefTable::RefTable (BaseTable* btp, const Vector<rownr_t>& rownrs)
 : BaseTable    ("", Table::Scratch, rownrs.nelements()),
   baseTabPtr_p (btp->root()),
   rowOrd_p     (True),
@@ -90,10 +91,10 @@ RefTable::RefTable (BaseTable* btp, const Vector<uInt>& rownrs)
     rowStorage_p = rownrs;
     rows_p = getStorage (rowStorage_p);
     //# Check if the row numbers do not exceed #rows.
-    uInt nmax = btp->nrow();
-    for (uInt i=0; i<nrrow_p; i++) {
+    rownr_t nmax = btp->nrow();
+    for (rownr_t i=0; i<nrrow_p; i++) {
 	if (rows_p[i] >= nmax) {
-	    throw (indexError<Int> ((Int)rows_p[i], "RefTable Row vector"));
+	    throw (indexError<Int64> ((Int64)rows_p[i], "RefTable Row vector"));
 	}
     }
     //# Adjust rownrs in case input table is a reference table.
@@ -114,8 +115,8 @@ RefTable::RefTable (BaseTable* btp, const Vector<Bool>& mask)
     tdescPtr_p = new TableDesc (btp->tableDesc(), TableDesc::Scratch);
     setup (btp, Vector<String>());
     //# Store the rownr if the mask is set.
-    uInt nr = min (mask.nelements(), btp->nrow());
-    for (uInt i=0; i<nr; i++) {
+    rownr_t nr = min (rownr_t(mask.nelements()), btp->nrow());
+    for (rownr_t i=0; i<nr; i++) {
 	if (mask(i)) {
 	    addRownr (i);
 	}
@@ -182,10 +183,10 @@ void RefTable::getPartNames (Block<String>& names, Bool recursive) const
   }
 }
 
-uInt* RefTable::getStorage (Vector<uInt>& rownrs)
+rownr_t* RefTable::getStorage (Vector<rownr_t>& rownrs)
 {
     Bool deleteIt;
-    uInt* p = rownrs.getStorage (deleteIt);
+    rownr_t* p = rownrs.getStorage (deleteIt);
     AlwaysAssert (deleteIt == False, AipsError);
     return p;
 }
@@ -255,16 +256,16 @@ uInt RefTable::getModifyCounter() const
 
 
 //# Adjust the input rownrs to the actual rownrs in the root table.
-Bool RefTable::adjustRownrs (uInt nr, Vector<uInt>& rowStorage,
+Bool RefTable::adjustRownrs (rownr_t nr, Vector<rownr_t>& rowStorage,
 			     Bool determineOrder) const
 {
-    uInt* rownrs = getStorage (rowStorage);
+    rownr_t* rownrs = getStorage (rowStorage);
     Bool rowOrder = True;
-    for (uInt i=0; i<nr; i++) {
+    for (rownr_t i=0; i<nr; i++) {
 	rownrs[i] = rows_p[rownrs[i]];
     }
     if (determineOrder) {
-	for (uInt i=1; i<nr; i++) {
+	for (rownr_t i=1; i<nr; i++) {
 	    if (rownrs[i] <= rownrs[i-1]) {
 		rowOrder = False;
 		break;
@@ -285,7 +286,15 @@ void RefTable::writeRefTable (Bool)
 	AipsIO ios;
 	writeStart (ios, True);
 	ios << "RefTable";
-	ios.putstart ("RefTable", 2);
+	//# Version 3 stores the row numbers as 64-bit values. It is only
+	//# used if the number of rows or a row number does not fit in 32 bits,
+	//# so older software can still read smaller tables.
+	const rownr_t maxUInt = std::numeric_limits<uInt>::max();
+	Bool use64 = (nrrow_p > maxUInt);
+	for (rownr_t i=0; i<nrrow_p && !use64; i++) {
+	    use64 = (rows_p[i] > maxUInt);
+	}
+	ios.putstart ("RefTable", (use64 ? 3 : 2));
 	// Make the name of the base table relative to this table.
 	ios << Path::stripDirectory (baseTabPtr_p->tableName(),
 				     tableName());
@@ -296,14 +305,31 @@ void RefTable::writeRefTable (Bool)
 	    names(i) = tdescPtr_p->columnDesc(i).name();
 	}
 	ios << names;
-	ios << baseTabPtr_p->nrow();
-	ios << rowOrd_p;
-        ios << nrrow_p;
+	if (use64) {
+	    ios << baseTabPtr_p->nrow();
+	    ios << rowOrd_p;
+	    ios << nrrow_p;
+	} else {
+	    //# The #rows of the root table is only used to check if it has
+	    //# not decreased, so it can be limited to the 32-bit maximum.
+	    ios << uInt(std::min (baseTabPtr_p->nrow(), maxUInt));
+	    ios << rowOrd_p;
+	    ios << uInt(nrrow_p);
+	}
         // Do not write more than 2**20 rownrs at once (CAS-7020).
-        uInt done = 0;
+        Block<uInt> rows32;
+        rownr_t done = 0;
         while (done < nrrow_p) {
-          uInt todo = std::min(nrrow_p-done, 1048576u);
-          ios.put (todo, rows_p+done, False);
+          uInt todo = std::min(nrrow_p-done, rownr_t(1048576));
+          if (use64) {
+            ios.put (todo, rows_p+done, False);
+          } else {
+            rows32.resize (todo, False, False);
+            for (uInt i=0; i<todo; ++i) {
+              rows32[i] = rows_p[done+i];
+            }
+            ios.put (todo, rows32.storage(), False);
+          }
           done += todo;
         }
 	ios.putend();
@@ -320,7 +346,7 @@ void RefTable::getRef (AipsIO& ios, int opt, const TableLock& lockOptions,
 {
     //# Open the file, read name and type of root and read object data.
     String rootName;
-    uInt rootNrow, nrrow;
+    rownr_t rootNrow, nrrow;
     Int version = ios.getstart ("RefTable");
     ios >> rootName;
     rootName = Path::addDirectory (rootName, tableName());
@@ -329,18 +355,37 @@ void RefTable::getRef (AipsIO& ios, int opt, const TableLock& lockOptions,
     if (version > 1) {
         ios >> names;
     }
-    ios >> rootNrow;
-    ios >> rowOrd_p;
-    ios >> nrrow;
+    //# As of version 3 the row numbers are stored as 64-bit values.
+    if (version > 2) {
+        ios >> rootNrow;
+        ios >> rowOrd_p;
+        ios >> nrrow;
+    } else {
+        uInt rootNrow32, nrrow32;
+        ios >> rootNrow32;
+        ios >> rowOrd_p;
+        ios >> nrrow32;
+        rootNrow = rootNrow32;
+        nrrow    = nrrow32;
+    }
     DebugAssert (nrrow == nrrow_p, AipsError);
     //# Resize the block of rownrs and read them in.
     rowStorage_p.resize (nrrow);
     rows_p = getStorage (rowStorage_p);
     // Do not read more than 2**20 rows at once (CAS-7020).
-    uInt done = 0;
+    Block<uInt> rows32;
+    rownr_t done = 0;
     while (done < nrrow) {
-      uInt todo = std::min(nrrow_p-done, 1048576u);
-      ios.get (todo, rows_p+done);
+      uInt todo = std::min(nrrow_p-done, rownr_t(1048576));
+      if (version > 2) {
+        ios.get (todo, rows_p+done);
+      } else {
+        rows32.resize (todo, False, False);
+        ios.get (todo, rows32.storage());
+        for (uInt i=0; i<todo; ++i) {
+          rows_p[done+i] = rows32[i];
+        }
+      }
       done += todo;
     }
     ios.getend();
@@ -492,11 +537,11 @@ void RefTable::addRefCol (const TableDesc& tdesc)
 
 
 //# Add a row number of the root table.
-void RefTable::addRownr (uInt rnr)
+void RefTable::addRownr (rownr_t rnr)
 {
-    uInt nrow = rowStorage_p.nelements();
+    rownr_t nrow = rowStorage_p.nelements();
     if (nrrow_p >= nrow) {
-        nrow = max ( nrow + 1024, uInt(1.2f * nrow));
+        nrow = max ( nrow + 1024, rownr_t(1.2f * nrow));
 	rowStorage_p.resize (nrow, True);
 	rows_p = getStorage (rowStorage_p);
     }
@@ -505,7 +550,7 @@ void RefTable::addRownr (uInt rnr)
 }
 
 //# Set exact number of rows.
-void RefTable::setNrrow (uInt nrrow)
+void RefTable::setNrrow (rownr_t nrrow)
 {
     if (nrrow > nrrow_p) {
 	throw (TableError ("RefTable::setNrrow: exceeds current nrrow"));
@@ -662,15 +707,15 @@ BaseColumn* RefTable::getColumn (uInt columnIndex) const
 }
     
 
-Vector<uInt>* RefTable::rowStorage()
+Vector<rownr_t>* RefTable::rowStorage()
     { return &rowStorage_p; }
 
 //# Convert a vector of row numbers to row numbers in this table.
-Vector<uInt> RefTable::rootRownr (const Vector<uInt>& rownrs) const
+Vector<rownr_t> RefTable::rootRownr (const Vector<rownr_t>& rownrs) const
 {
-    uInt nrow = rownrs.nelements();
-    Vector<uInt> rnr(nrow);
-    for (uInt i=0; i<nrow; i++) {
+    rownr_t nrow = rownrs.nelements();
+    Vector<rownr_t> rnr(nrow);
+    for (rownr_t i=0; i<nrow; i++) {
 	rnr(i) = rows_p[rownrs(i)];
     }
     return rnr;
@@ -682,12 +727,12 @@ BaseTable* RefTable::root()
 Bool RefTable::rowOrder() const
     { return rowOrd_p; }
 
-Vector<uInt> RefTable::rowNumbers () const
+Vector<rownr_t> RefTable::rowNumbers () const
 {
     if (nrrow_p == rowStorage_p.nelements()) {
 	return rowStorage_p;
     }
-    Vector<uInt> vec (rowStorage_p);
+    Vector<rownr_t> vec (rowStorage_p);
     return vec(Slice(0, nrrow_p));
 }
 
@@ -765,7 +810,7 @@ Bool RefTable::canRemoveColumn (const Vector<String>& columnNames) const
 Bool RefTable::canRenameColumn (const String& columnName) const
     { return tdescPtr_p->isColumn (columnName); }
 
-void RefTable::removeRow (uInt rownr)
+void RefTable::removeRow (rownr_t rownr)
 {
     if (rownr >= nrrow_p) {
 	throw (TableInvOper ("removeRow: rownr out of bounds"));
@@ -822,13 +867,13 @@ DataManager* RefTable::findDataManager (const String& name, Bool byColumn) const
 
 
 // And 2 index arrays, which are both in ascending order.
-void RefTable::refAnd (uInt nr1, const uInt* inx1,
-		       uInt nr2, const uInt* inx2)
+void RefTable::refAnd (rownr_t nr1, const rownr_t* inx1,
+		       rownr_t nr2, const rownr_t* inx2)
 {
-    uInt allrow = (nr1 < nr2  ?  nr1 : nr2);  // max #output rows
+    rownr_t allrow = (nr1 < nr2  ?  nr1 : nr2);  // max #output rows
     rowStorage_p.resize (allrow);             // allocate output storage
     rows_p = getStorage (rowStorage_p);
-    uInt i1, i2, row1, row2;
+    rownr_t i1, i2, row1, row2;
     i1 = i2 = 0;
     while (True) {
 	if (i1 >= nr1) {
@@ -858,13 +903,13 @@ void RefTable::refAnd (uInt nr1, const uInt* inx1,
 }
 
 // Or 2 index arrays, which are both in ascending order.
-void RefTable::refOr (uInt nr1, const uInt* inx1,
-		      uInt nr2, const uInt* inx2)
+void RefTable::refOr (rownr_t nr1, const rownr_t* inx1,
+		      rownr_t nr2, const rownr_t* inx2)
 {
-    uInt allrow = nr1 + nr2;                  // max #output rows
+    rownr_t allrow = nr1 + nr2;                  // max #output rows
     rowStorage_p.resize (allrow);             // allocate output storage
     rows_p = getStorage (rowStorage_p);
-    uInt i1, i2, row1, row2;
+    rownr_t i1, i2, row1, row2;
     i1 = i2 = 0;
     while (True) {
 	if (i1 >= nr1) {
@@ -896,13 +941,13 @@ void RefTable::refOr (uInt nr1, const uInt* inx1,
 }
 
 // Subtract 2 index arrays, which are both in ascending order.
-void RefTable::refSub (uInt nr1, const uInt* inx1,
-		       uInt nr2, const uInt* inx2)
+void RefTable::refSub (rownr_t nr1, const rownr_t* inx1,
+		       rownr_t nr2, const rownr_t* inx2)
 {
-    uInt allrow = nr1;                        // max #output rows
+    rownr_t allrow = nr1;                        // max #output rows
     rowStorage_p.resize (allrow);             // allocate output storage
     rows_p = getStorage (rowStorage_p);
-    uInt i1, i2, row1, row2;
+    rownr_t i1, i2, row1, row2;
     i1 = i2 = 0;
     while (True) {
 	if (i1 >= nr1) {
@@ -932,13 +977,13 @@ void RefTable::refSub (uInt nr1, const uInt* inx1,
 }
 
 // Xor 2 index arrays, which are both in ascending order.
-void RefTable::refXor (uInt nr1, const uInt* inx1,
-		       uInt nr2, const uInt* inx2)
+void RefTable::refXor (rownr_t nr1, const rownr_t* inx1,
+		       rownr_t nr2, const rownr_t* inx2)
 {
-    uInt allrow = nr1 + nr2;                  // max #output rows
+    rownr_t allrow = nr1 + nr2;                  // max #output rows
     rowStorage_p.resize (allrow);             // allocate output storage
     rows_p = getStorage (rowStorage_p);
-    uInt i1, i2, row1, row2;
+    rownr_t i1, i2, row1, row2;
     i1 = i2 = 0;
     while (True) {
 	if (i1 >= nr1) {
@@ -969,16 +1014,16 @@ void RefTable::refXor (uInt nr1, const uInt* inx1,
 }
 
 // Negate a table.
-void RefTable::refNot (uInt nr, const uInt* inx, uInt nrtot)
+void RefTable::refNot (rownr_t nr, const rownr_t* inx, rownr_t nrtot)
 {
     // All rows not in the original table must be "selected".
     // The original table has NRTOT rows.
     // So loop through the inx-array and store all rownrs not in the array.
-    uInt allrow = nrtot - nr;                 // #output rows
+    rownr_t allrow = nrtot - nr;                 // #output rows
     rowStorage_p.resize (allrow);             // allocate output storage
     rows_p = getStorage (rowStorage_p);
-    uInt start = 0;
-    uInt i, j;
+    rownr_t start = 0;
+    rownr_t i, j;
     for (i=0; i<nr; i++) {                    // loop through inx-array
 	for (j=start; j<inx[i]; j++) {
 	    rows_p[nrrow_p++] = j;            // not in inx-array
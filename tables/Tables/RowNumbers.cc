@@ -0,0 +1,76 @@
+//# RowNumbers.cc: Vector of row numbers
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/RowNumbers.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <algorithm>
+#include <limits>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+RowNumbers::RowNumbers (const std::vector<rownr_t>& rows)
+  : Vector<rownr_t> (rows.size())
+{
+  std::copy (rows.begin(), rows.end(), begin());
+}
+
+RowNumbers::RowNumbers (const Vector<uInt>& rows)
+  : Vector<rownr_t> (convertRownrVector (rows))
+{}
+
+RowNumbers::RowNumbers (const std::vector<uInt>& rows)
+  : Vector<rownr_t> (rows.size())
+{
+  std::copy (rows.begin(), rows.end(), begin());
+}
+
+RowNumbers::operator Vector<uInt>() const
+{
+  Vector<uInt> vec(size());
+  Vector<uInt>::iterator outIter = vec.begin();
+  for (Vector<rownr_t>::const_iterator iter=begin(); iter!=end();
+       ++iter, ++outIter) {
+    if (*iter > std::numeric_limits<uInt>::max()) {
+      throw TableError ("RowNumbers: row number " + String::toString(*iter) +
+                        " exceeds 32 bits; cannot convert to Vector<uInt>");
+    }
+    *outIter = *iter;
+  }
+  return vec;
+}
+
+Vector<rownr_t> RowNumbers::convertRownrVector (const Vector<uInt>& rows)
+{
+  Vector<rownr_t> vec(rows.size());
+  std::copy (rows.begin(), rows.end(), vec.begin());
+  return vec;
+}
+
+
+} //# NAMESPACE CASACORE - END
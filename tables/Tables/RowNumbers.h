@@ -0,0 +1,113 @@
+//# RowNumbers.h: Vector of row numbers
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_ROWNUMBERS_H
+#define TABLES_ROWNUMBERS_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Vector of table row numbers.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tRowNumbers">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=Vector>Vector</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Row numbers in a table are of type <src>rownr_t</src>, which is a
+// 64-bit unsigned integer. Before that, the row numbers were 32-bit
+// <src>uInt</src> values.
+// <br>This class is a Vector of row numbers which can be constructed from
+// and converted to a <src>Vector<uInt></src> to make it possible that
+// existing code using 32-bit row numbers keeps on working.
+// A conversion to <src>Vector<uInt></src> throws an exception if a row
+// number does not fit in a <src>uInt</src>.
+// <br>Functions like <src>Table::rowNumbers</src> return an object of
+// this class.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   Table tab("my.tab");
+//   // Old style code using 32-bit row numbers.
+//   Vector<uInt> rows32 = tab.rowNumbers();
+//   // New style code using 64-bit row numbers.
+//   Vector<rownr_t> rows64 = tab.rowNumbers();
+//   // Both can be used to select rows.
+//   Table sel1 = tab(rows32);
+//   Table sel2 = tab(rows64);
+// </srcblock>
+// </example>
+
+class RowNumbers : public Vector<rownr_t>
+{
+public:
+  // Construct an empty RowNumbers Vector.
+  RowNumbers()
+  {}
+
+  // Construct from a Vector of row numbers (reference semantics).
+  RowNumbers (const Vector<rownr_t>& rows)
+    : Vector<rownr_t> (rows)
+  {}
+
+  // Construct from a std::vector of row numbers.
+  RowNumbers (const std::vector<rownr_t>& rows);
+
+  // Construct from a Vector or std::vector of 32-bit row numbers (copy).
+  // <group>
+  RowNumbers (const Vector<uInt>& rows);
+  RowNumbers (const std::vector<uInt>& rows);
+  // </group>
+
+  // Use the assignment operators of the base class.
+  using Vector<rownr_t>::operator=;
+
+  // Convert the row numbers to 32-bit ones.
+  // An exception is thrown if a row number exceeds 32 bits.
+  operator Vector<uInt>() const;
+
+  // Convert a Vector of 32-bit row numbers to a Vector of rownr_t.
+  static Vector<rownr_t> convertRownrVector (const Vector<uInt>& rows);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -111,13 +111,25 @@ public:
 
     // Initialize the rows from startRownr till endRownr (inclusive)
     // with the default value defined in the column description.
-    void initialize (uInt startRownr, uInt endRownr);
+    void initialize (rownr_t startRownr, rownr_t endRownr);
 
     // Test if the given cell contains a defined value.
-    Bool isDefined (uInt rownr) const;
+    Bool isDefined (rownr_t rownr) const;
 
     // Get the value from a particular cell.
-    void get (uInt rownr, void*) const;
+    void get (rownr_t rownr, void*) const;
+
+    // Get the range of the values from the data manager column
+    // (e.g. the zone map of the StandardStMan).
+    Bool getValueRange (rownr_t rownr, rownr_t& endRow,
+                        Double& minVal, Double& maxVal) const;
+
+    // Get the dictionary or the codes of a dictionary encoded column
+    // from the data manager column.
+    // <group>
+    Bool getDictionary (uInt startIndex, Vector<String>& entries) const;
+    void getDictCodes (rownr_t rownr, uInt nrow, uInt* codes) const;
+    // </group>
 
     // Get the array of all values in the column.
     // The length of the buffer pointed to by dataPtr must match
@@ -132,7 +144,7 @@ public:
     // Put the value in a particular cell.
     // The length of the buffer pointed to by dataPtr must match
     // the actual length. This is checked by ScalarColumn.
-    void put (uInt rownr, const void* dataPtr);
+    void put (rownr_t rownr, const void* dataPtr);
 
     // Put the array of all values in the column.
     // The length of the buffer pointed to by dataPtr must match
@@ -156,7 +168,7 @@ public:
 		      const void*& dataSave);
     // Do it only for the given row numbers.
     void makeRefSortKey (Sort&, CountedPtr<BaseCompare>& cmpFunc, Int order,
-			 const Vector<uInt>& rownrs, const void*& dataSave);
+			 const Vector<rownr_t>& rownrs, const void*& dataSave);
     // </group>
 
     // Free storage on the heap allocated by makeSortkey().
@@ -87,7 +87,7 @@ Bool ScalarColumnData<T>::canAccessScalarColumnCells (Bool& reask) const
 
 
 template<class T>
-void ScalarColumnData<T>::initialize (uInt startRow, uInt endRow)
+void ScalarColumnData<T>::initialize (rownr_t startRow, rownr_t endRow)
 {
     if (colDescPtr_p->dataType() != TpOther) {
 	for (uInt i=startRow; i<=endRow; i++) {
@@ -97,7 +97,7 @@ void ScalarColumnData<T>::initialize (uInt startRow, uInt endRow)
 }	
 
 template<class T>
-Bool ScalarColumnData<T>::isDefined (uInt rownr) const
+Bool ScalarColumnData<T>::isDefined (rownr_t rownr) const
 {
     if (!undefFlag_p) {
 	return True;
@@ -109,7 +109,7 @@ Bool ScalarColumnData<T>::isDefined (uInt rownr) const
 
 
 template<class T>
-void ScalarColumnData<T>::get (uInt rownr, void* val) const
+void ScalarColumnData<T>::get (rownr_t rownr, void* val) const
 {
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr);
@@ -119,6 +119,35 @@ void ScalarColumnData<T>::get (uInt rownr, void* val) const
     autoReleaseLock();
 }
 
+template<class T>
+Bool ScalarColumnData<T>::getValueRange (rownr_t rownr, rownr_t& endRow,
+                                         Double& minVal, Double& maxVal) const
+{
+    checkReadLock (True);
+    Bool fnd = dataColPtr_p->getValueRange (rownr, endRow, minVal, maxVal);
+    autoReleaseLock();
+    return fnd;
+}
+
+template<class T>
+Bool ScalarColumnData<T>::getDictionary (uInt startIndex,
+                                         Vector<String>& entries) const
+{
+    checkReadLock (True);
+    Bool fnd = dataColPtr_p->getDictionary (startIndex, entries);
+    autoReleaseLock();
+    return fnd;
+}
+
+template<class T>
+void ScalarColumnData<T>::getDictCodes (rownr_t rownr, uInt nrow,
+                                        uInt* codes) const
+{
+    checkReadLock (True);
+    dataColPtr_p->getDictCodes (rownr, nrow, codes);
+    autoReleaseLock();
+}
+
 
 template<class T>
 void ScalarColumnData<T>::getScalarColumn (void* val) const
@@ -143,7 +172,7 @@ void ScalarColumnData<T>::getScalarColumnCells (const RefRows& rownrs,
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownrs);
     }
     Vector<T>& vec = *(Vector<T>*)val;
-    uInt nr = rownrs.nrow();
+    rownr_t nr = rownrs.nrow();
     if (vec.nelements() != nr) {
 	throw (TableArrayConformanceError("ScalarColumnData::getColumnCells"));
     }
@@ -154,7 +183,7 @@ void ScalarColumnData<T>::getScalarColumnCells (const RefRows& rownrs,
 
 
 template<class T>
-void ScalarColumnData<T>::put (uInt rownr, const void* val)
+void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
 {
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr);
@@ -162,6 +191,7 @@ void ScalarColumnData<T>::put (uInt rownr, const void* val)
     checkValueLength ((const T*)val);
     checkWriteLock (True);
     dataColPtr_p->put (rownr, (const T*)val);
+    colSetPtr_p->setIndexChanged (columnDesc().name());
     autoReleaseLock();
 }
 
@@ -178,6 +208,7 @@ void ScalarColumnData<T>::putScalarColumn (const void* val)
     checkValueLength (vecPtr);
     checkWriteLock (True);
     dataColPtr_p->putScalarColumnV (vecPtr);
+    colSetPtr_p->setIndexChanged (columnDesc().name());
     autoReleaseLock();
 }
 
@@ -195,6 +226,7 @@ void ScalarColumnData<T>::putScalarColumnCells (const RefRows& rownrs,
     checkValueLength (&vec);
     checkWriteLock (True);
     dataColPtr_p->putScalarColumnCellsV (rownrs, &vec);
+    colSetPtr_p->setIndexChanged (columnDesc().name());
     autoReleaseLock();
 }
 
@@ -210,7 +242,7 @@ void ScalarColumnData<T>::makeSortKey (Sort& sortobj,
     //# Get the data as a column.
     //# Save the pointer to the vector for deletion by freeSortKey().
     dataSave = 0;
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     Vector<T>* vecPtr = new Vector<T>(nrrow);
     Bool reask;
     if (canAccessScalarColumn (reask)) {
@@ -230,14 +262,14 @@ template<class T>
 void ScalarColumnData<T>::makeRefSortKey (Sort& sortobj,
                                           CountedPtr<BaseCompare>& cmpObj,
 					  Int order,
-					  const Vector<uInt>& rownrs,
+					  const Vector<rownr_t>& rownrs,
 					  const void*& dataSave)
 {
     //#// Optimal is to ask the data manager for a pointer to
     //#// the consecutive data. Often this may succeed.
     //# Get the data as a column.
     dataSave = 0;
-    uInt nrrow = rownrs.nelements();
+    rownr_t nrrow = rownrs.nelements();
     Vector<T>* vecPtr = new Vector<T>(nrrow);
     Bool reask;
     if (canAccessScalarColumnCells (reask)) {
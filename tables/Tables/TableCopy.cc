@@ -36,6 +36,8 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/tables/DataMan/DataManInfo.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Utilities/LinearSearch.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -88,7 +90,7 @@ Table TableCopy::makeEmptyMemoryTable (const String& newName,
 }
 
 void TableCopy::copyRows (Table& out, const Table& in, uInt startout,
-			  uInt startin, uInt nrrow, Bool flush)
+			  uInt startin, rownr_t nrrow, Bool flush)
 {
   // Check if startin and nrrow are correct for input.
   if (startin + nrrow > in.nrow()) {
@@ -244,6 +246,57 @@ void TableCopy::copyColumnData (const Table& tabFrom, const String& colFrom,
   }
 }
 
+void TableCopy::retileColumns (Table& table, const Vector<String>& columns,
+                               const String& dataManagerName,
+                               const IPosition& tileShape,
+                               uInt maxCacheSizeMiB)
+{
+  if (! table.isWritable()) {
+    throw TableError ("TableCopy::retileColumns: table " + table.tableName() +
+                      " is not writable");
+  }
+  // Check that the old data managers can be removed entirely, so the
+  // table is not left half-way.
+  const TableDesc& tdesc = table.tableDesc();
+  for (uInt i=0; i<columns.size(); ++i) {
+    DataManager* dm = table.findDataManager (columns[i], True);
+    if (! dm->canRemoveColumn()) {
+      for (uInt j=0; j<tdesc.ncolumn(); ++j) {
+        const String& name = tdesc[j].name();
+        if (table.findDataManager (name, True) == dm
+            &&  ! anyEQ (columns, name)) {
+          throw TableError ("TableCopy::retileColumns: column " + name +
+                            " has to be retiled as well");
+        }
+      }
+    }
+    // Limit the cache of the old tiled storage manager (non-persistent).
+    TiledStMan* tsm = dynamic_cast<TiledStMan*>(dm);
+    if (tsm) {
+      tsm->setMaximumCacheSize (maxCacheSizeMiB);
+    }
+  }
+  // Add the new columns using temporary names.
+  TableDesc td;
+  Vector<String> tmpNames(columns.size());
+  for (uInt i=0; i<columns.size(); ++i) {
+    tmpNames[i] = columns[i] + "_retile_tmp";
+    td.addColumn (tdesc[columns[i]], tmpNames[i]);
+  }
+  td.defineHypercolumn (dataManagerName, tileShape.size(), tmpNames);
+  TiledShapeStMan stman (dataManagerName, tileShape);
+  table.addColumn (td, stman);
+  dynamic_cast<TiledStMan*>(table.findDataManager (dataManagerName))
+    ->setMaximumCacheSize (maxCacheSizeMiB);
+  for (uInt i=0; i<columns.size(); ++i) {
+    copyColumnData (table, columns[i], table, tmpNames[i], False);
+  }
+  table.removeColumn (columns);
+  for (uInt i=0; i<columns.size(); ++i) {
+    table.renameColumn (columns[i], tmpNames[i]);
+  }
+}
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -68,6 +68,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>CopyInfo</src> copies the table info data.
 //  <li> <src>copySubTables</src> copies all the subtables in table and
 //       column keywords. It is done recursively.
+//  <li> <src>retileColumns</src> rewrites array columns with another
+//       tile shape.
 // </ol>
 // </synopsis> 
 
@@ -118,7 +120,7 @@ public:
   static void copyRows (Table& out, const Table& in, Bool flush=True)
     { copyRows (out, in, 0, 0, in.nrow(), flush); }
   static void copyRows (Table& out, const Table& in,
-			uInt startout, uInt startin, uInt nrrow,
+			uInt startout, uInt startin, rownr_t nrrow,
                         Bool flush=True);
   // </group>
 
@@ -187,6 +189,21 @@ public:
                               const String& toColumn,
                               Bool preserveTileShape=True);
 
+  // Rewrite the data of the given array columns with another tile shape
+  // (e.g. as advised by <src>TiledStMan::adviseTileShape</src>).
+  // The columns are moved to a new TiledShapeStMan with the given name
+  // (which must not exist yet) and default tile shape. It is done by
+  // copying the data row by row to new columns, whereafter the old columns
+  // are removed and the new ones renamed.
+  // Memory usage is bounded, because the cache sizes of the old and new
+  // tiled storage managers are limited to the given size (in MiB).
+  // <br>All columns in the old data managers have to be given, unless
+  // the data manager can remove columns.
+  static void retileColumns (Table& table, const Vector<String>& columns,
+                             const String& dataManagerName,
+                             const IPosition& tileShape,
+                             uInt maxCacheSizeMiB = 256);
+
   // Fill the table column with the given array.
   // The template type must match the column data type.
   template<typename T>
@@ -0,0 +1,351 @@
+//# TableIndexCache.cc: Cache of column indices of a table used in selections
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableIndexCache.h>
+#include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/tables/Tables/BaseTable.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/tables/TaQL/ExprRange.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/Utilities/ValType.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TableIndexCache::TableIndexCache (const Table& table)
+: itsTable         (table),
+  itsModifyCounter (table.baseTablePtr()->getModifyCounter())
+{}
+
+TableIndexCache::~TableIndexCache()
+{}
+
+TableIndexCache* TableIndexCache::get (const Table& table)
+{
+  return table.baseTablePtr()->indexCache();
+}
+
+Bool TableIndexCache::isOwnColumn (const TableColumn& column) const
+{
+  return column.table().baseTablePtr() == itsTable.baseTablePtr();
+}
+
+Bool TableIndexCache::canIndex (const String& columnName) const
+{
+  const TableDesc& tdesc = itsTable.tableDesc();
+  if (! tdesc.isColumn (columnName)) {
+    return False;
+  }
+  const ColumnDesc& cdesc = tdesc.columnDesc (columnName);
+  if (! cdesc.isScalar()) {
+    return False;
+  }
+  switch (cdesc.dataType()) {
+  case TpUChar:
+  case TpShort:
+  case TpInt:
+  case TpUInt:
+  case TpInt64:
+  case TpFloat:
+  case TpDouble:
+  case TpString:
+    break;
+  default:
+    return False;
+  }
+  // The data of a virtual column can change without the column being
+  // written, so only stored columns can be indexed.
+  DataManager* dmPtr = itsTable.findDataManager (columnName, True);
+  return dmPtr != 0  &&  dmPtr->isStorageManager();
+}
+
+Bool TableIndexCache::findRows (const Block<TableExprRange>& ranges,
+                                Vector<rownr_t>& rows)
+{
+  Bool found = False;
+  std::vector<rownr_t> result;
+  for (uInt i=0; i<ranges.size(); ++i) {
+    const TableColumn& col = ranges[i].getColumn();
+    if (! isOwnColumn (col)) {
+      continue;
+    }
+    const String& name = col.columnDesc().name();
+    ColumnsIndex* index = getIndex (name);
+    if (index != 0) {
+      std::vector<rownr_t> colRows;
+      findRows (*index, name, col.columnDesc().dataType(), ranges[i],
+                colRows);
+      if (found) {
+        // Only the rows found for all columns can match.
+        std::vector<rownr_t> both;
+        std::set_intersection (result.begin(), result.end(),
+                               colRows.begin(), colRows.end(),
+                               std::back_inserter(both));
+        result.swap (both);
+      } else {
+        result.swap (colRows);
+        found = True;
+      }
+    }
+  }
+  if (found) {
+    rows.resize (result.size());
+    std::copy (result.begin(), result.end(), rows.begin());
+  }
+  return found;
+}
+
+// Define the keys for an integer column. The interval is rounded inwards
+// and clipped to the range of the data type.
+// False is returned if no value of the data type is inside the interval.
+template<typename T>
+static Bool defineIntKeys (Record& lower, Record& upper, const String& name,
+                           Double st, Double end)
+{
+  const T minVal = std::numeric_limits<T>::min();
+  const T maxVal = std::numeric_limits<T>::max();
+  st = ceil(st);
+  end = floor(end);
+  if (st > end  ||  st > Double(maxVal)  ||  end < Double(minVal)) {
+    return False;
+  }
+  lower.define (name, (st <= Double(minVal)  ?  minVal : T(st)));
+  upper.define (name, (end >= Double(maxVal)  ?  maxVal : T(end)));
+  return True;
+}
+
+// Define the keys for a floating point column. An unbounded side
+// (given as -DBL_MAX or DBL_MAX) also covers infinite values.
+template<typename T>
+static Bool defineRealKeys (Record& lower, Record& upper, const String& name,
+                            Double st, Double end)
+{
+  const Double maxVal = std::numeric_limits<T>::max();
+  const T inf = std::numeric_limits<T>::infinity();
+  if (st > end  ||  st > maxVal  ||  end < -maxVal) {
+    return False;
+  }
+  lower.define (name, (st <= -maxVal  ?  -inf : T(st)));
+  upper.define (name, (end >= maxVal  ?  inf : T(end)));
+  return True;
+}
+
+void TableIndexCache::findRows (ColumnsIndex& index, const String& name,
+                                DataType dtype, const TableExprRange& range,
+                                std::vector<rownr_t>& rows) const
+{
+  Record& lower = index.accessLowerKey();
+  Record& upper = index.accessUpperKey();
+  const Vector<Double>& st = range.start();
+  const Vector<Double>& end = range.end();
+  for (uInt i=0; i<st.size(); ++i) {
+    Bool ok = False;
+    switch (dtype) {
+    case TpUChar:
+      ok = defineIntKeys<uChar> (lower, upper, name, st[i], end[i]);
+      break;
+    case TpShort:
+      ok = defineIntKeys<Short> (lower, upper, name, st[i], end[i]);
+      break;
+    case TpInt:
+      ok = defineIntKeys<Int> (lower, upper, name, st[i], end[i]);
+      break;
+    case TpUInt:
+      ok = defineIntKeys<uInt> (lower, upper, name, st[i], end[i]);
+      break;
+    case TpInt64:
+      ok = defineIntKeys<Int64> (lower, upper, name, st[i], end[i]);
+      break;
+    case TpFloat:
+      ok = defineRealKeys<Float> (lower, upper, name, st[i], end[i]);
+      break;
+    case TpDouble:
+      ok = defineRealKeys<Double> (lower, upper, name, st[i], end[i]);
+      break;
+    default:
+      throw TableError ("TableIndexCache: column " + name +
+                        " has a data type that cannot be indexed");
+    }
+    if (ok) {
+      Vector<rownr_t> found = index.getRowNumbers (True, True);
+      rows.insert (rows.end(), found.begin(), found.end());
+    }
+  }
+  // The rows are in order of the keys. Remove possible duplicates in case
+  // the ranges overlapped after rounding to the data type.
+  std::sort (rows.begin(), rows.end());
+  rows.erase (std::unique (rows.begin(), rows.end()), rows.end());
+}
+
+ColumnsIndex* TableIndexCache::getIndex (const String& columnName,
+                                         Bool mayCreate)
+{
+  checkModified();
+  std::map<String,Entry>::iterator iter = itsIndices.find (columnName);
+  if (iter == itsIndices.end()) {
+    if (!mayCreate  ||  !canIndex (columnName)) {
+      return 0;
+    }
+    iter = itsIndices.insert (std::make_pair (columnName, Entry())).first;
+  }
+  Entry& entry = iter->second;
+  // Only create the index if the column is used repeatedly and if the
+  // table size is within the limits.
+  if (entry.index.null()  &&  entry.usable  &&  mayCreate
+  &&  withinLimits (columnName)) {
+    entry.nused++;
+    if (entry.nused > 1) {
+      if (hasNaN (columnName)) {
+        entry.usable = False;
+      } else {
+        entry.index = new ColumnsIndex (itsTable, columnName);
+      }
+    }
+  }
+  return entry.index.get();
+}
+
+Int64& TableIndexCache::theirMinRows()
+{
+  static Int64 minRows = -1;
+  return minRows;
+}
+
+Int64& TableIndexCache::theirMaxSizeMB()
+{
+  static Int64 maxSizeMB = -1;
+  return maxSizeMB;
+}
+
+void TableIndexCache::setLimits (Int64 minRows, Int64 maxSizeMB)
+{
+  theirMinRows()   = minRows;
+  theirMaxSizeMB() = maxSizeMB;
+}
+
+rownr_t TableIndexCache::minRows()
+{
+  Int64 minRows = theirMinRows();
+  if (minRows < 0) {
+    Int value;
+    AipsrcValue<Int>::find (value, "table.indexcache.minrows", 10000);
+    minRows = value;
+  }
+  return std::max (minRows, Int64(0));
+}
+
+Int64 TableIndexCache::maxSizeMB()
+{
+  Int64 maxSizeMB = theirMaxSizeMB();
+  if (maxSizeMB < 0) {
+    Int value;
+    AipsrcValue<Int>::find (value, "table.indexcache.maxsizemb", 256);
+    maxSizeMB = value;
+  }
+  return std::max (maxSizeMB, Int64(0));
+}
+
+Bool TableIndexCache::withinLimits (const String& columnName) const
+{
+  rownr_t nrow = itsTable.nrow();
+  if (nrow < minRows()) {
+    return False;
+  }
+  // An index holds a copy of the values and a sorted index of row numbers.
+  DataType dtype = itsTable.tableDesc().columnDesc(columnName).dataType();
+  Double size = Double(nrow) * (ValType::getTypeSize(dtype) +
+                                2 * sizeof(rownr_t));
+  return size <= maxSizeMB() * 1024. * 1024.;
+}
+
+Bool TableIndexCache::hasIndex (const String& columnName) const
+{
+  std::map<String,Entry>::const_iterator iter = itsIndices.find (columnName);
+  return iter != itsIndices.end()  &&  !iter->second.index.null();
+}
+
+Bool TableIndexCache::hasNaN (const String& columnName) const
+{
+  switch (itsTable.tableDesc().columnDesc(columnName).dataType()) {
+  case TpFloat:
+    return anyTrue (isNaN (ScalarColumn<Float>(itsTable,
+                                               columnName).getColumn()));
+  case TpDouble:
+    return anyTrue (isNaN (ScalarColumn<Double>(itsTable,
+                                                columnName).getColumn()));
+  default:
+    break;
+  }
+  return False;
+}
+
+// The index is deleted, so it gets recreated (and checked for NaNs)
+// the next time it is used.
+void TableIndexCache::setChanged()
+{
+  for (std::map<String,Entry>::iterator iter = itsIndices.begin();
+       iter != itsIndices.end(); ++iter) {
+    iter->second.index = 0;
+    iter->second.usable = True;
+  }
+}
+
+void TableIndexCache::setChanged (const String& columnName)
+{
+  std::map<String,Entry>::iterator iter = itsIndices.find (columnName);
+  if (iter != itsIndices.end()) {
+    iter->second.index = 0;
+    iter->second.usable = True;
+  }
+}
+
+void TableIndexCache::clear()
+{
+  itsIndices.clear();
+}
+
+void TableIndexCache::checkModified()
+{
+  uInt counter = itsTable.baseTablePtr()->getModifyCounter();
+  if (counter != itsModifyCounter) {
+    itsModifyCounter = counter;
+    setChanged();
+  }
+}
+
+} //# NAMESPACE CASACORE - END
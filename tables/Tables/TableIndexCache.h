@@ -0,0 +1,216 @@
+//# TableIndexCache.h: Cache of column indices of a table used in selections
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TABLEINDEXCACHE_H
+#define TABLES_TABLEINDEXCACHE_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
+#include <casacore/casa/Utilities/DataType.h>
+#include <map>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class ColumnsIndex;
+class TableColumn;
+class TableExprRange;
+
+
+// <summary>
+// Cache of column indices of a table used in selections
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTableIndexCache.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=ColumnsIndex>ColumnsIndex</linkto>
+//   <li> <linkto class=TableExprRange>TableExprRange</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A TableIndexCache object is kept by a plain or memory table to hold
+// the <linkto class=ColumnsIndex>ColumnsIndex</linkto> objects used
+// by a selection to find the rows matching the value ranges of scalar
+// columns in the selection expression (as determined by
+// <linkto class=TableExprRange>TableExprRange</linkto>).
+// Only the rows found that way have to be evaluated by the selection.
+// <p>
+// An index is created on demand. Because creating an index requires
+// reading and sorting the entire column, it is only worth doing if the
+// column is used repeatedly in selections. Therefore the cache counts the
+// number of times an index is asked for and only creates it when the
+// column is used for the second time. Thereafter the index is kept until
+// the table is closed.
+// <br>Furthermore an index is only created if the table has enough rows to
+// make it worthwhile and if the estimated memory needed for the index
+// (the values and row numbers) does not exceed a maximum. These limits
+// can be given by the aipsrc variables
+// <ul>
+//  <li> <src>table.indexcache.minrows</src> giving the minimum number of
+//       rows (default 10000).
+//  <li> <src>table.indexcache.maxsizemb</src> giving the maximum size of
+//       an index in MB (default 256). A value 0 means that no indices are
+//       created at all.
+// </ul>
+// They can also be set using the function <src>setLimits</src>.
+// <br>A floating point column containing a NaN value cannot be indexed,
+// because a NaN cannot be sorted.
+// <p>
+// The table tells the cache when data in a column change (using
+// <src>setChanged</src>) or when rows are removed, in which case
+// the index is recreated the next time it is used.
+// If the table is changed by another process, the cache notices it by means
+// of the table's modify counter.
+// </synopsis>
+
+// <motivation>
+// Interactive queries on a MeasurementSet often select on key columns
+// like FIELD_ID or DATA_DESC_ID. Using an index kept for the table
+// avoids scanning all rows for each such query.
+// </motivation>
+
+class TableIndexCache
+{
+public:
+    // Create the cache for the given table.
+    // The table object must not be counted to avoid a circular reference.
+    explicit TableIndexCache (const Table& table);
+
+    ~TableIndexCache();
+
+    // Get the index cache of the given table.
+    // A null pointer is returned if the table type does not support it
+    // (only plain and memory tables do).
+    static TableIndexCache* get (const Table& table);
+
+    // Tell if the column belongs to the table of this cache.
+    Bool isOwnColumn (const TableColumn& column) const;
+
+    // Find the rows for which the values of the columns are inside the
+    // given ranges using the indices of the columns. The row numbers are
+    // returned in ascending order.
+    // Ranges of columns not belonging to this table or without an index
+    // are ignored. False is returned if no index could be used.
+    Bool findRows (const Block<TableExprRange>& ranges, Vector<rownr_t>& rows);
+
+    // Get the index for the given column.
+    // A null pointer is returned if the index has not been created yet
+    // (because it is the first time the column is asked for), if the
+    // table size is outside the limits, or if the column is not suited
+    // for an index (it must be a stored scalar column).
+    // If <src>mayCreate=False</src>, it does not count as a usage, so
+    // the index will not be created.
+    ColumnsIndex* getIndex (const String& columnName, Bool mayCreate=True);
+
+    // Tell if the given column has an index in the cache.
+    Bool hasIndex (const String& columnName) const;
+
+    // Tell if the given column can have an index.
+    Bool canIndex (const String& columnName) const;
+
+    // Tell if the table size is within the limits for creating an index
+    // for the given column (see the synopsis).
+    Bool withinLimits (const String& columnName) const;
+
+    // Something has changed in the table, so the indices have to be
+    // recreated. The 2nd version indicates that a specific column
+    // has changed, so only the index of that column is affected.
+    // <group>
+    void setChanged();
+    void setChanged (const String& columnName);
+    // </group>
+
+    // Remove all indices, for instance when a column is removed or renamed.
+    void clear();
+
+    // Set the minimum number of rows in a table and the maximum size (in MB)
+    // of an index for it to be created. A negative value means the value
+    // given in the aipsrc variable (see the synopsis). A maximum size of 0
+    // means that no indices are created.
+    // It applies to the indices created thereafter.
+    static void setLimits (Int64 minRows, Int64 maxSizeMB);
+
+    // Get the current limits.
+    // <group>
+    static rownr_t minRows();
+    static Int64 maxSizeMB();
+    // </group>
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    TableIndexCache (const TableIndexCache&);
+    TableIndexCache& operator= (const TableIndexCache&);
+    // </group>
+
+    // Check if the table has been changed by another process.
+    void checkModified();
+
+    // Check if a floating point column contains a NaN value.
+    Bool hasNaN (const String& columnName) const;
+
+    // Get the limits as set or defined in the aipsrc variables.
+    // <group>
+    static Int64& theirMinRows();
+    static Int64& theirMaxSizeMB();
+    // </group>
+
+    // Find the rows (in ascending order) matching the given range
+    // of the column using its index.
+    void findRows (ColumnsIndex& index, const String& columnName,
+                   DataType dtype, const TableExprRange& range,
+                   std::vector<rownr_t>& rows) const;
+
+    //# The usage count and the index of a column.
+    struct Entry {
+      Entry() : nused(0), usable(True) {}
+      uInt                     nused;
+      Bool                     usable;
+      CountedPtr<ColumnsIndex> index;
+    };
+
+    Table                       itsTable;
+    uInt                        itsModifyCounter;
+    std::map<String,Entry>      itsIndices;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
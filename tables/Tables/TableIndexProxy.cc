@@ -120,7 +120,7 @@ Int TableIndexProxy::getRowNumber (const Record& key)
 
 Vector<Int> TableIndexProxy::getRowNumbers (const Record& key)
 {
-  Vector<uInt> rows;
+  Vector<rownr_t> rows;
   if (scaIndex_p != 0) {
     rows = scaIndex_p->getRowNumbers (key);
   } else {
@@ -136,7 +136,7 @@ Vector<Int> TableIndexProxy::getRowNumbersRange (const Record& lower,
 						 Bool lowerInclusive,
 						 Bool upperInclusive)
 {
-  Vector<uInt> rows;
+  Vector<rownr_t> rows;
   if (scaIndex_p != 0) {
     rows = scaIndex_p->getRowNumbers (lower, upper, lowerInclusive,
 				      upperInclusive);
@@ -42,6 +42,7 @@
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/TaQLPrepared.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/TableAttr.h>
 #include <casacore/tables/DataMan/DataManAccessor.h>
@@ -154,8 +155,22 @@ TableProxy::TableProxy (const String& command,
     tabs[i] = &(tables[i].table());
   }
   // Try to execute the command.
-  TaQLResult taqlResult;
-  taqlResult = tableCommand (command, tabs);
+  setTaQLResult (tableCommand (command, tabs));
+}
+
+TableProxy::TableProxy (TaQLPrepared& command,
+			const std::vector<ValueHolder>& values)
+{
+  for (uInt i=0; i<values.size(); ++i) {
+    if (! values[i].isNull()) {
+      command.bind (i+1, values[i]);
+    }
+  }
+  setTaQLResult (command.execute());
+}
+
+void TableProxy::setTaQLResult (const TaQLResult& taqlResult)
+{
   // Command succeeded.
   // Add table if result is a table.
   if (taqlResult.isTable()) {
@@ -735,7 +750,7 @@ TableProxy TableProxy::selectRows (const Vector<Int>& rownrs,
   table_p.unlock();
   // Create a table from the selected rows.
   // Rename it and make it non-scratch if a name is given.
-  Vector<uInt> rows(rownrs.nelements());
+  Vector<rownr_t> rows(rownrs.nelements());
   convertArray (rows, rownrs);
   Table ntable = table_p(rows);
   if (! outName.empty()) {
@@ -759,7 +774,7 @@ void TableProxy::stillSameShape (Int& same, IPosition& shape,
 void TableProxy::calcValues (Record& rec, const TableExprNode& expr)
 {
   if (expr.isScalar()) {
-    Vector<uInt> rownrs(expr.nrow());
+    Vector<rownr_t> rownrs(expr.nrow());
     indgen (rownrs);
     switch (expr.getColumnDataType()) {
     case TpBool:
@@ -1658,7 +1673,7 @@ void TableProxy::removeRow (const Vector<Int>& rownrs)
 {
   // If needed synchronize table to get up-to-date number of rows.
   syncTable (table_p);
-  Vector<uInt> rows(rownrs.nelements());
+  Vector<rownr_t> rows(rownrs.nelements());
   convertArray (rows, rownrs);
   table_p.removeRow (rows);
 }
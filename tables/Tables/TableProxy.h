@@ -40,6 +40,8 @@
 //# Forward Declarations
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
   class ValueHolder;
+  class TaQLPrepared;
+  class TaQLResult;
   class RecordFieldId;
   class Table;
   class TableLock;
@@ -154,6 +156,13 @@ public:
   TableProxy (const String& command,
 	      const std::vector<TableProxy>& tables);
 
+  // Execute a prepared TaQL command (see class TaQLPrepared) after
+  // binding the given values to its parameters $1, $2, etc. (in that order).
+  // A value that is null (ValueHolder()) leaves the value bound before.
+  // The result is the same as for the constructor above.
+  TableProxy (TaQLPrepared& command,
+	      const std::vector<ValueHolder>& values);
+
   // Create a table from an Ascii file.
   // It fills a string containing the names and types
   // of the columns (in the form COL1=R, COL2=D, ...).
@@ -656,6 +665,9 @@ public:
   // 'values' in rec.
   static void calcValues (Record& rec, const TableExprNode& expr);
 
+  // Keep the result of a TaQL command (a table or the values of CALC).
+  void setTaQLResult (const TaQLResult& result);
+
   // Get the type string as used externally (in e.g. glish).
   static String getTypeStr (DataType);
 
@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/tables/Tables/TableSyncData.h>
 #include <casacore/casa/Containers/BlockIO.h>
+#include <limits>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -46,7 +47,7 @@ TableSyncData::~TableSyncData()
     itsAipsIO.close();
 }
 
-void TableSyncData::write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
+void TableSyncData::write (rownr_t nrrow, uInt nrcolumn, Bool tableChanged,
 			   const Block<Bool>& dataManChanged)
 {
     // Increment change counter when the table has changed.
@@ -81,8 +82,7 @@ void TableSyncData::write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
     // Now write the data into the memoryIO object.
     // First clear it.
     itsMemIO.clear();
-    itsAipsIO.putstart ("sync" ,1);
-    itsAipsIO << itsNrrow;
+    writeStart();
     itsAipsIO << itsNrcolumn;
     itsAipsIO << itsModifyCounter;
     if (itsNrcolumn >= 0) {
@@ -92,7 +92,7 @@ void TableSyncData::write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
     itsAipsIO.putend();
 }
 
-void TableSyncData::write (uInt nrrow)
+void TableSyncData::write (rownr_t nrrow)
 {
     itsModifyCounter++;
     itsNrrow = nrrow;
@@ -100,14 +100,26 @@ void TableSyncData::write (uInt nrrow)
     // Now write the data into the memoryIO object.
     // First clear it.
     itsMemIO.clear();
-    itsAipsIO.putstart ("sync" ,1);
-    itsAipsIO << itsNrrow;
+    writeStart();
     itsAipsIO << itsNrcolumn;
     itsAipsIO << itsModifyCounter;
     itsAipsIO.putend();
 }
 
-Bool TableSyncData::read (uInt& nrrow, uInt& nrcolumn, Bool& tableChanged,
+void TableSyncData::writeStart()
+{
+    // Version 2 stores the number of rows as a 64-bit value.
+    // It is only used if needed, so older software can still read it.
+    if (itsNrrow > std::numeric_limits<uInt>::max()) {
+        itsAipsIO.putstart ("sync", 2);
+        itsAipsIO << itsNrrow;
+    } else {
+        itsAipsIO.putstart ("sync", 1);
+        itsAipsIO << uInt(itsNrrow);
+    }
+}
+
+Bool TableSyncData::read (rownr_t& nrrow, uInt& nrcolumn, Bool& tableChanged,
 			  Block<Bool>& dataManChanged)
 {
     // Read the data into the memoryIO object.
@@ -116,8 +128,14 @@ Bool TableSyncData::read (uInt& nrrow, uInt& nrcolumn, Bool& tableChanged,
     uInt i;
     Int nrcol = -1;
     if (itsMemIO.length() > 0) {
-	itsAipsIO.getstart ("sync");
-	itsAipsIO >> nrrow;
+	uInt version = itsAipsIO.getstart ("sync");
+        if (version > 1) {
+            itsAipsIO >> nrrow;
+        } else {
+            uInt nrrow32;
+            itsAipsIO >> nrrow32;
+            nrrow = nrrow32;
+        }
 	itsAipsIO >> nrcol;
 	itsAipsIO >> itsModifyCounter;
     }
@@ -85,19 +85,19 @@ public:
     // Update the synchronization data and write it into the MemoryIO object.
     // This function is called when a table flush is done to reflect
     // if anything has changed compared to the previous flush.
-    void write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
+    void write (rownr_t nrrow, uInt nrcolumn, Bool tableChanged,
 		const Block<Bool>& dataManChanged);
 
     // Update the synchronization data and write it into the MemoryIO object.
     // This function should be used by an external filler when it flushes
     // its data.
-    void write (uInt nrrow);
+    void write (rownr_t nrrow);
 
     // Read the synchronization data from the MemoryIO object.
     // This function is called when a lock is acquired to see if
     // table data has to be reread.
     // <br>It returns False when the MemoryIO object is empty.
-    Bool read (uInt& nrrow, uInt& nrcolumn, Bool& tableChanged,
+    Bool read (rownr_t& nrrow, uInt& nrcolumn, Bool& tableChanged,
 	       Block<Bool>& dataManChanged);
 
     // Get the MemoryIO object.
@@ -116,9 +116,13 @@ private:
     // Assignment is forbidden.
     TableSyncData& operator= (const TableSyncData& that);
 
+    // Start writing the object and write the number of rows.
+    // The version depends on the number of rows fitting in 32 bits.
+    void writeStart();
+
 
     //# Member variables.
-    uInt        itsNrrow;
+    rownr_t     itsNrrow;
     Int         itsNrcolumn;
     uInt        itsModifyCounter;
     uInt        itsTableChangeCounter;
@@ -40,7 +40,7 @@
 
 void doIt()
 {
-    Vector<uInt> vec(18);
+    Vector<rownr_t> vec(18);
     vec(0) = 1;
     vec(1) = 1;
     vec(2) = 2;
@@ -0,0 +1,139 @@
+//# tRowNumbers.cc: Test program for class RowNumbers and 64-bit row numbers
+//# Copyright (C) 2019
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/RowNumbers.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/ConcatRows.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class RowNumbers and for row numbers exceeding 32 bits.
+// </summary>
+
+
+void testConversion()
+{
+  // Conversion from and to 32-bit row numbers.
+  Vector<uInt> rows32(5);
+  indgen (rows32, 2u);
+  RowNumbers rows(rows32);
+  AlwaysAssertExit (rows.size() == 5);
+  AlwaysAssertExit (rows[0] == 2  &&  rows[4] == 6);
+  Vector<uInt> back = rows;
+  AlwaysAssertExit (allEQ (back, rows32));
+  std::vector<uInt> stdrows(3, 7);
+  RowNumbers rows2(stdrows);
+  AlwaysAssertExit (rows2.size() == 3  &&  rows2[2] == 7);
+  // A row number exceeding 32 bits cannot be converted.
+  Vector<rownr_t> rows64(2);
+  rows64[0] = 1;
+  rows64[1] = rownr_t(5) << 32;
+  RowNumbers rows3(rows64);
+  AlwaysAssertExit (rows3[1] == rows64[1]);
+  Bool failed = False;
+  try {
+    Vector<uInt> vec = rows3;
+  } catch (const TableError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+void testLargeRows()
+{
+  // RefRows and ConcatRows must handle row numbers beyond 32 bits.
+  const rownr_t big = rownr_t(6) << 30;
+  RefRows refrows(big, big+10, 2);
+  AlwaysAssertExit (refrows.isSliced());
+  AlwaysAssertExit (refrows.firstRow() == big);
+  AlwaysAssertExit (refrows.nrows() == 6);
+  ConcatRows crows;
+  crows.add (big);
+  crows.add (10);
+  AlwaysAssertExit (crows.nrow() == big+10);
+  uInt tabnr;
+  rownr_t tabrow;
+  crows.mapRownr (tabnr, tabrow, big+3);
+  AlwaysAssertExit (tabnr == 1  &&  tabrow == 3);
+  crows.mapRownr (tabnr, tabrow, big-1);
+  AlwaysAssertExit (tabnr == 0  &&  tabrow == big-1);
+}
+
+void testTable()
+{
+  // Row selection using both 32-bit and 64-bit row numbers.
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("col"));
+  SetupNewTable newtab("", td, Table::Scratch);
+  Table tab(newtab, Table::Memory, 10);
+  ScalarColumn<Int> col(tab, "col");
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    col.put (i, Int(i));
+  }
+  Vector<rownr_t> rows64(3);
+  rows64[0] = 1;
+  rows64[1] = 5;
+  rows64[2] = 8;
+  Vector<uInt> rows32(2);
+  rows32[0] = 3;
+  rows32[1] = 4;
+  Table sel64 = tab(rows64);
+  Table sel32 = tab(rows32);
+  AlwaysAssertExit (sel64.nrow() == 3);
+  AlwaysAssertExit (sel32.nrow() == 2);
+  AlwaysAssertExit (ScalarColumn<Int>(sel64, "col")(2) == 8);
+  AlwaysAssertExit (ScalarColumn<Int>(sel32, "col")(1) == 4);
+  // rowNumbers gives the rows in the parent table.
+  Vector<rownr_t> rn64 = sel64.rowNumbers(tab);
+  Vector<uInt> rn32 = sel64.rowNumbers(tab);
+  AlwaysAssertExit (allEQ (rn64, rows64));
+  AlwaysAssertExit (rn32[1] == 5);
+}
+
+int main()
+{
+  try {
+    testConversion();
+    testLargeRows();
+    testTable();
+  } catch (AipsError& x) {
+    cout << "\nCaught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;               // successfully executed
+}
@@ -0,0 +1,207 @@
+//# tTableIndexCache.cc: Test program for the TableIndexCache class
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableIndexCache.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprNodeSet.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the TableIndexCache class.
+// It checks that selections using an index give the same rows as the
+// evaluation row by row and that the index is recreated after changes.
+// </summary>
+
+void makeTable (const String& name, uInt nrow)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ival"));
+  td.addColumn (ScalarColumnDesc<Double> ("dval"));
+  td.addColumn (ScalarColumnDesc<Float> ("fval"));
+  td.addColumn (ScalarColumnDesc<String> ("sval"));
+  SetupNewTable newtab(name, td, Table::New);
+  Table table(newtab, nrow);
+  ScalarColumn<Int> icol (table, "ival");
+  ScalarColumn<Double> dcol (table, "dval");
+  ScalarColumn<Float> fcol (table, "fval");
+  ScalarColumn<String> scol (table, "sval");
+  for (uInt i=0; i<nrow; ++i) {
+    icol.put (i, i%100);
+    dcol.put (i, (i%250) * 0.5);
+    fcol.put (i, i);
+    scol.put (i, String::toString(i%10));
+  }
+  // A NaN in the float column makes it unsuited for an index.
+  fcol.put (nrow/2, floatNaN());
+}
+
+// Check if the selection gives the same rows as the row evaluation.
+void checkSelect (const String& str, const Table& table,
+                  const TableExprNode& expr, rownr_t maxRow = 0)
+{
+  Table sel = table(expr, maxRow);
+  Vector<rownr_t> rows = sel.rowNumbers (table);
+  uInt nr = 0;
+  for (rownr_t i=0; i<table.nrow()  &&  nr<rows.size(); ++i) {
+    if (expr.getBool(i)) {
+      AlwaysAssertExit (rows[nr] == i);
+      nr++;
+    }
+  }
+  AlwaysAssertExit (nr == rows.size());
+  cout << str << ": selected " << rows.size() << " rows" << endl;
+}
+
+void showIndices (const Table& table)
+{
+  TableIndexCache* cache = TableIndexCache::get (table);
+  AlwaysAssertExit (cache != 0);
+  cout << "  indices:";
+  const char* names[] = {"ival", "dval", "fval", "sval"};
+  for (uInt i=0; i<4; ++i) {
+    if (cache->hasIndex (names[i])) {
+      cout << ' ' << names[i];
+    }
+  }
+  cout << endl;
+}
+
+void doSelect (const Table& table)
+{
+  TableExprNode ival = table.col("ival");
+  TableExprNode dval = table.col("dval");
+  TableExprNode fval = table.col("fval");
+  TableExprNode sval = table.col("sval");
+  TableExprNodeSet set;
+  set.add (TableExprNodeSetElem (TableExprNode(3.)));
+  set.add (TableExprNodeSetElem (True, TableExprNode(10.),
+                                 TableExprNode(12.), False));
+  set.add (TableExprNodeSetElem (TableExprNode(95.)));
+  // The first time no index is used, thereafter it is.
+  for (uInt i=0; i<2; ++i) {
+    checkSelect ("ival==3", table, ival == 3);
+    showIndices (table);
+  }
+  checkSelect ("ival==3 limit 5", table, ival == 3, 5);
+  checkSelect ("ival in [3,10=:<12,95]", table, ival.in(set));
+  checkSelect ("ival>=97", table, ival >= 97);
+  checkSelect ("ival<2 || ival>98", table, ival < 2  ||  ival > 98);
+  checkSelect ("ival==3 && sval=='3'", table, ival == 3  &&  sval == "3");
+  checkSelect ("ival==3 && dval>100", table, ival == 3  &&  dval > 100);
+  showIndices (table);
+  checkSelect ("ival==3 && dval>100", table, ival == 3  &&  dval > 100);
+  checkSelect ("dval==1.5", table, dval == 1.5);
+  checkSelect ("ival>1.5 && ival<3.5", table, ival > 1.5  &&  ival < 3.5);
+  // No index is used if too many rows match.
+  checkSelect ("ival>10", table, ival > 10);
+  // The float column contains a NaN, so cannot be indexed.
+  checkSelect ("fval<10", table, fval < 10);
+  checkSelect ("fval<10", table, fval < 10);
+  showIndices (table);
+}
+
+void doIt (const String& name)
+{
+  Table table(name, Table::Update);
+  TableIndexCache* cache = TableIndexCache::get (table);
+  AlwaysAssertExit (cache != 0);
+  AlwaysAssertExit (cache->canIndex ("ival"));
+  AlwaysAssertExit (cache->canIndex ("sval"));
+  AlwaysAssertExit (! cache->canIndex ("xval"));
+  doSelect (table);
+  // Changing a value invalidates the index of that column only.
+  ScalarColumn<Int> icol (table, "ival");
+  icol.put (5, 3);
+  showIndices (table);
+  checkSelect ("ival==3 after put", table, table.col("ival") == 3);
+  showIndices (table);
+  checkSelect ("ival==3 after put", table, table.col("ival") == 3);
+  showIndices (table);
+  // Removing rows invalidates all indices.
+  table.removeRow (3);
+  showIndices (table);
+  checkSelect ("ival==3 after removeRow", table, table.col("ival") == 3);
+  checkSelect ("ival==3 after removeRow", table, table.col("ival") == 3);
+  showIndices (table);
+  // A memory table has an index cache as well.
+  cout << "memory table" << endl;
+  Table mtab = table.copyToMemoryTable ("tTableIndexCache_tmp.mem");
+  doSelect (mtab);
+}
+
+// Check that no index is created if the table size is outside the limits.
+void doLimits (const String& name)
+{
+  Table table(name);
+  TableExprNode ival = table.col("ival");
+  TableIndexCache* cache = TableIndexCache::get (table);
+  // Too few rows.
+  TableIndexCache::setLimits (2000, 256);
+  AlwaysAssertExit (! cache->withinLimits ("ival"));
+  checkSelect ("ival==3 minrows=2000", table, ival == 3);
+  checkSelect ("ival==3 minrows=2000", table, ival == 3);
+  checkSelect ("ival==3 minrows=2000", table, ival == 3);
+  showIndices (table);
+  // An index of 0 MB is not allowed, thus disables indices.
+  TableIndexCache::setLimits (100, 0);
+  AlwaysAssertExit (! cache->withinLimits ("ival"));
+  checkSelect ("ival==3 maxsizemb=0", table, ival == 3);
+  checkSelect ("ival==3 maxsizemb=0", table, ival == 3);
+  showIndices (table);
+  // Within the limits the index is created on the second use.
+  TableIndexCache::setLimits (100, 1);
+  AlwaysAssertExit (cache->withinLimits ("ival"));
+  checkSelect ("ival==3 maxsizemb=1", table, ival == 3);
+  checkSelect ("ival==3 maxsizemb=1", table, ival == 3);
+  showIndices (table);
+}
+
+int main()
+{
+  try {
+    // Use a limit suitable for the small test table.
+    TableIndexCache::setLimits (100, 256);
+    makeTable ("tTableIndexCache_tmp.data", 1000);
+    doIt ("tTableIndexCache_tmp.data");
+    cout << "limits" << endl;
+    doLimits ("tTableIndexCache_tmp.data");
+  } catch (const AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
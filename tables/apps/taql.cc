@@ -557,7 +557,7 @@ void showExpr(const TableExprNode& expr, ostream& os)
   if (! unit.empty()) {
     os << "Unit: " << unit.getName() << endl;
   }
-  Vector<uInt> rownrs (expr.nrow());
+  Vector<rownr_t> rownrs (expr.nrow());
   indgen (rownrs);
   if (expr.isScalar()) {
     switch (expr.getColumnDataType()) {
@@ -708,7 +708,7 @@ Table taqlCommand (const Options& options, const String& varName,
     }
     String s = command.substr(spos, epos-spos);
     s.downcase();
-    showHelp = (s=="show" || s=="help");
+    showHelp = (s=="show" || s=="help" || s=="explain" || s=="profile");
     addComm = !(s=="with" || s=="select" || s=="update" || s=="insert" ||
                 s=="calc" || s=="delete" || s=="count"  || 
                 s=="create" || s=="createtable" ||
@@ -770,7 +770,7 @@ Table taqlCommand (const Options& options, const String& varName,
         Bool showSubset = False;
         if (!printSelect && printAuto && tabp.nrow() > maxNRows) {
           showSubset = True;
-          Vector<uInt> rownrs(maxNRows);
+          Vector<rownr_t> rownrs(maxNRows);
           indgen (rownrs);
           tabc = tabp(rownrs);
         }
@@ -0,0 +1,161 @@
+//# tsmadvise.cc: Advise a tile shape for a tiled column and retile it
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/TableCopy.h>
+#include <casacore/tables/DataMan/TiledStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/ArrayIO.h>
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+
+using namespace casacore;
+using namespace std;
+
+// Convert the access patterns given as shape[:count] to a Record.
+// Missing trailing axes of a shape get length 1.
+Record makePatterns (const vector<String>& args, uInt ndim)
+{
+  Matrix<Int> shapes(ndim, args.size(), 1);
+  Vector<Int64> counts(args.size());
+  for (uInt i=0; i<args.size(); ++i) {
+    Vector<String> parts = stringToVector (args[i], ':');
+    Vector<String> lens  = stringToVector (parts[0]);
+    if (lens.size() > ndim  ||  parts.size() > 2) {
+      throw AipsError ("Invalid access shape " + args[i]);
+    }
+    for (uInt j=0; j<lens.size(); ++j) {
+      shapes(j,i) = atoi (lens[j].chars());
+    }
+    counts[i] = (parts.size() == 2  ?  atol (parts[1].chars()) : 1);
+  }
+  Record rec;
+  rec.define ("SHAPES", shapes);
+  rec.define ("COUNTS", counts);
+  return rec;
+}
+
+int main (int argc, char* argv[])
+{
+  uInt maxPixels = 32768;
+  String retileName;
+  int starg = 1;
+  while (argc > starg+1  &&  argv[starg][0] == '-') {
+    String opt(argv[starg]);
+    if (opt == "-maxpixels") {
+      maxPixels = atoi (argv[starg+1]);
+    } else if (opt == "-retile") {
+      retileName = argv[starg+1];
+    } else {
+      break;
+    }
+    starg += 2;
+  }
+  if (argc < starg+2) {
+    cerr << "Use as:   tsmadvise [-maxpixels n] [-retile dmname] "
+         << "tablename column [shape[:count] ...]" << endl;
+    cerr << "  It advises the tile shape minimizing the number of bytes read"
+         << endl;
+    cerr << "  when accessing the hypercube of the column with the given"
+         << endl;
+    cerr << "  section shapes (e.g. 4,1,100:10 for 10 accesses of 4x1x100)."
+         << endl;
+    cerr << "  If no shapes are given, the access patterns recorded in"
+         << endl;
+    cerr << "  column keyword TSM_ACCESS are used (as returned by"
+         << endl;
+    cerr << "  ROTiledStManAccessor::accessPatterns)." << endl;
+    cerr << "      -maxpixels  maximum number of pixels per tile (32768)"
+         << endl;
+    cerr << "      -retile     rewrite the columns of the storage manager"
+         << endl;
+    cerr << "                  with the advised tile shape in a new storage"
+         << endl;
+    cerr << "                  manager with the given name" << endl;
+    return 1;
+  }
+  try {
+    String columnName (argv[starg+1]);
+    Table table(argv[starg],
+                retileName.empty() ? Table::Old : Table::Update);
+    DataManager* dm = table.findDataManager (columnName, True);
+    if (dynamic_cast<TiledStMan*>(dm) == 0) {
+      throw AipsError ("Column " + columnName +
+                       " is not stored with a tiled storage manager");
+    }
+    ROTiledStManAccessor accessor (table, dm->dataManagerName());
+    IPosition cubeShape = accessor.hypercubeShape (0);
+    IPosition tileShape = accessor.tileShape (0);
+    Record patterns;
+    if (argc > starg+2) {
+      vector<String> args (argv+starg+2, argv+argc);
+      patterns = makePatterns (args, cubeShape.size());
+    } else {
+      TableRecord keys = TableColumn(table, columnName).keywordSet();
+      if (! keys.isDefined ("TSM_ACCESS")) {
+        throw AipsError ("No access shapes given and no TSM_ACCESS keyword");
+      }
+      patterns = keys.subRecord ("TSM_ACCESS");
+    }
+    IPosition advised = TiledStMan::adviseTileShape (cubeShape, patterns,
+                                                     maxPixels);
+    Double oldCost = TiledStMan::accessCost (cubeShape, tileShape,
+                                             patterns, maxPixels);
+    Double newCost = TiledStMan::accessCost (cubeShape, advised,
+                                             patterns, maxPixels);
+    cout << "Hypercube shape:    " << cubeShape << endl;
+    cout << "Current tile shape: " << tileShape
+         << "  relative cost 1" << endl;
+    cout << "Advised tile shape: " << advised
+         << "  relative cost " << (oldCost > 0 ? newCost/oldCost : 1.)
+         << endl;
+    if (! retileName.empty()) {
+      // Retile all columns in the storage manager.
+      vector<String> columns;
+      const TableDesc& tdesc = table.tableDesc();
+      for (uInt i=0; i<tdesc.ncolumn(); ++i) {
+        if (table.findDataManager (tdesc[i].name(), True) == dm) {
+          columns.push_back (tdesc[i].name());
+        }
+      }
+      TableCopy::retileColumns (table, Vector<String>(columns), retileName,
+                                advised);
+      cout << "Retiled " << Vector<String>(columns) << " into "
+           << retileName << endl;
+    }
+  } catch (std::exception& x) {
+    cerr << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}